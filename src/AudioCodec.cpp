@@ -0,0 +1,23 @@
+#include "AudioCodec.h"
+
+#include <string.h>
+
+const char* audioCodecName(AudioCodec codec) {
+    switch (codec) {
+        case CODEC_IMA_ADPCM: return "ima_adpcm";
+        case CODEC_PCM16:
+        default:              return "pcm16";
+    }
+}
+
+bool parseAudioCodec(const char* name, AudioCodec& codec) {
+    if (strcmp(name, "pcm16") == 0 || strcmp(name, "pcm") == 0) {
+        codec = CODEC_PCM16;
+        return true;
+    }
+    if (strcmp(name, "ima_adpcm") == 0) {
+        codec = CODEC_IMA_ADPCM;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,18 @@
+#ifndef AUDIO_CODEC_H
+#define AUDIO_CODEC_H
+
+#include <stdint.h>
+
+// Audio formats on the WebSocket, named the way they appear in the
+// text protocol (e.g. "START codec=ima_adpcm rate=16000").
+enum AudioCodec : uint8_t {
+    CODEC_PCM16,        // Raw little-endian 16-bit mono
+    CODEC_IMA_ADPCM     // 4-bit IMA-ADPCM blocks, see ImaAdpcm.h
+};
+
+const char* audioCodecName(AudioCodec codec);
+
+// Parses a codec name; returns false (and leaves `codec` alone) if unknown
+bool parseAudioCodec(const char* name, AudioCodec& codec);
+
+#endif
@@ -0,0 +1,45 @@
+#include "AudioDecoder.h"
+
+#include <string.h>
+
+PcmDecoder::PcmDecoder() {
+    reset();
+}
+
+bool PcmDecoder::begin(const uint8_t* data, size_t length) {
+    _data = data;
+    _remaining = length / 2;
+    return _remaining > 0;
+}
+
+size_t PcmDecoder::read(int16_t* out, size_t maxSamples) {
+    size_t n = _remaining < maxSamples ? _remaining : maxSamples;
+    if (n == 0) return 0;
+    memcpy(out, _data, n * sizeof(int16_t));
+    _data += n * sizeof(int16_t);
+    _remaining -= n;
+    return n;
+}
+
+void PcmDecoder::reset() {
+    _data = NULL;
+    _remaining = 0;
+}
+
+DownlinkDecoders::DownlinkDecoders() {
+    _current = &_pcm;
+    _custom = false;
+}
+
+void DownlinkDecoders::setCustom(AudioDecoder* decoder) {
+    _custom = decoder != NULL;
+    _current = _custom ? decoder : &_pcm;
+    _current->reset();
+}
+
+bool DownlinkDecoders::select(AudioCodec codec) {
+    if (_custom) return false;
+    _current = (codec == CODEC_IMA_ADPCM) ? (AudioDecoder*)&_adpcm : (AudioDecoder*)&_pcm;
+    _current->reset();
+    return true;
+}
@@ -0,0 +1,84 @@
+#ifndef AUDIO_DECODER_H
+#define AUDIO_DECODER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "AudioCodec.h"
+#include "ImaAdpcm.h"
+
+// Turns one downlink WebSocket message into PCM samples.
+//
+// The receive path calls begin() with the message, then read()s it in
+// blocks of whatever size it can take until read() returns 0. Nothing is
+// allocated and a large message never needs a large buffer. `data` must
+// stay valid until the message is read out.
+class AudioDecoder {
+public:
+    virtual ~AudioDecoder() {}
+
+    virtual AudioCodec codec() const = 0;
+
+    // Returns false if the message is malformed (it is then skipped)
+    virtual bool begin(const uint8_t* data, size_t length) = 0;
+
+    virtual size_t read(int16_t* out, size_t maxSamples) = 0;
+
+    // Forget any message part-way through; read() returns 0 until the
+    // next begin()
+    virtual void reset() {}
+};
+
+// Raw little-endian 16-bit PCM. Copies bytewise, so the payload does not
+// have to be aligned; an odd trailing byte is dropped.
+class PcmDecoder : public AudioDecoder {
+public:
+    PcmDecoder();
+
+    AudioCodec codec() const { return CODEC_PCM16; }
+    bool begin(const uint8_t* data, size_t length);
+    size_t read(int16_t* out, size_t maxSamples);
+    void reset();
+
+private:
+    const uint8_t* _data;
+    size_t _remaining;      // Whole samples left
+};
+
+// One IMA-ADPCM block per message (format in ImaAdpcm.h)
+class ImaAdpcmBlockDecoder : public AudioDecoder {
+public:
+    AudioCodec codec() const { return CODEC_IMA_ADPCM; }
+    bool begin(const uint8_t* data, size_t length) { return _decoder.begin(data, length); }
+    size_t read(int16_t* out, size_t maxSamples) { return _decoder.read(out, maxSamples); }
+    void reset() { _decoder = ImaAdpcmDecoder(); }
+
+private:
+    ImaAdpcmDecoder _decoder;
+};
+
+// The downlink decoder in use: one of the built-ins, picked by the server's
+// "CODEC:" message, or a custom one set by the application. A custom
+// decoder stays in place until it is cleared; the server cannot switch it
+// out from under the application.
+class DownlinkDecoders {
+public:
+    DownlinkDecoders();
+
+    AudioDecoder* current() const { return _current; }
+    bool custom() const { return _custom; }
+
+    // `decoder` must outlive this; NULL goes back to the built-in PCM one
+    void setCustom(AudioDecoder* decoder);
+
+    // Switches to the built-in decoder for `codec`, starting from a clean
+    // state. Returns false (and changes nothing) while a custom decoder is set.
+    bool select(AudioCodec codec);
+
+private:
+    PcmDecoder _pcm;
+    ImaAdpcmBlockDecoder _adpcm;
+    AudioDecoder* _current;
+    bool _custom;
+};
+
+#endif
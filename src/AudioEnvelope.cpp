@@ -0,0 +1,93 @@
+#include "AudioEnvelope.h"
+
+AudioEnvelope::AudioEnvelope() {
+    _blockMs = 20;
+    _blockSamples = 320;
+    _sampleRate = 16000;
+    reset();
+}
+
+void AudioEnvelope::begin(uint32_t sampleRate, uint16_t blockMs) {
+    _sampleRate = sampleRate ? sampleRate : 1;
+    _blockMs = blockMs ? blockMs : 1;
+    _blockSamples = sampleRate * _blockMs / 1000;
+    if (_blockSamples == 0) _blockSamples = 1;
+    reset();
+}
+
+void AudioEnvelope::reset() {
+    _sumSq = 0;
+    _n = 0;
+    _peak = MIN_PEAK;
+    _blockStart = 0;
+    _head = 0;
+    _count = 0;
+    _started = false;
+}
+
+uint32_t AudioEnvelope::isqrt(uint64_t v) {
+    // Bit-by-bit; 32 iterations, no division
+    uint64_t result = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    while (bit > v) bit >>= 2;
+    while (bit != 0) {
+        if (v >= result + bit) {
+            v -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)result;
+}
+
+void AudioEnvelope::push(const int16_t* samples, size_t count, uint32_t playAtMs) {
+    for (size_t i = 0; i < count; i++) {
+        if (_n == 0) _blockStart = playAtMs + (uint32_t)((uint64_t)i * 1000 / _sampleRate);
+        int32_t s = samples[i];
+        _sumSq += (uint32_t)(s * s);
+        if (++_n >= _blockSamples) endBlock();
+    }
+}
+
+void AudioEnvelope::endBlock() {
+    uint32_t rms = isqrt(_sumSq / _n);
+    _sumSq = 0;
+    _n = 0;
+
+    // Peak follower: jumps up, decays by 1/64 per block (~1.3s at 20ms)
+    _peak -= _peak >> 6;
+    if (_peak < MIN_PEAK) _peak = MIN_PEAK;
+    if (rms > _peak) _peak = rms;
+
+    uint32_t open = 0;
+    if (rms > GATE) {
+        open = (rms - GATE) * 256 / (_peak - GATE);
+        if (open > 255) open = 255;
+    }
+
+    if (_count == RING) {
+        // Too far ahead: drop the oldest
+        _head = (_head + 1) % RING;
+        _count--;
+    }
+    Block& b = _blocks[(_head + _count) % RING];
+    b.start = _blockStart;
+    b.level = (uint8_t)open;
+    _count++;
+    _started = true;
+}
+
+int16_t AudioEnvelope::level(uint32_t nowMs) {
+    // Retire blocks that finished playing. Play times are whole ms, so a
+    // block overlaps the next by 1ms rather than leaving a rounding gap.
+    while (_count > 0 && (int32_t)(nowMs - _blocks[_head].start) > (int32_t)_blockMs) {
+        _head = (_head + 1) % RING;
+        _count--;
+    }
+    if (_count == 0) return _started ? 0 : -1;
+    // Next block not audible yet: a gap in the stream
+    if ((int32_t)(nowMs - _blocks[_head].start) < 0) return 0;
+    return _blocks[_head].level;
+}
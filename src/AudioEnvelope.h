@@ -0,0 +1,67 @@
+#ifndef AUDIO_ENVELOPE_H
+#define AUDIO_ENVELOPE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Loudness of the reply audio, for lip-sync.
+//
+// push() is called with every PCM chunk on its way to the speaker, along
+// with when its first sample will be heard. The samples are cut into fixed
+// blocks (20ms by default) and each block's RMS goes into a small ring,
+// stamped with its own play time. level() then returns the block that is
+// audible at that moment, as a mouth openness in Q8 (0..255).
+//
+// The level is gated against hiss and normalized to a slowly decaying
+// peak, so quiet and loud voices both use the full mouth range.
+//
+// Cost is one multiply-add per sample plus an integer sqrt per block.
+class AudioEnvelope {
+public:
+    AudioEnvelope();
+
+    void begin(uint32_t sampleRate, uint16_t blockMs = 20);
+
+    // Forget everything (new reply)
+    void reset();
+
+    // `playAtMs` is when samples[0] reaches the speaker
+    void push(const int16_t* samples, size_t count, uint32_t playAtMs);
+
+    // Mouth openness at `nowMs`: 0..255, 0 in gaps between words, or -1
+    // if no audio arrived since reset()
+    int16_t level(uint32_t nowMs);
+
+    // Block level math, exposed for host checks
+    static uint32_t isqrt(uint64_t v);
+
+private:
+    // 4.3s of 20ms blocks: the deepest jitter queue (4s) plus the DMA
+    // buffers, so a full queue's blocks are all still here when heard
+    static const uint8_t RING = 216;
+    static const uint16_t GATE = 200;      // RMS below this is silence
+    static const uint16_t MIN_PEAK = 1500; // Keeps hiss from being normalized up
+
+    void endBlock();
+
+    uint16_t _blockMs;
+    uint32_t _blockSamples;
+
+    uint64_t _sumSq;
+    uint32_t _n;
+    uint32_t _peak;
+    uint32_t _sampleRate;
+    uint32_t _blockStart;  // Play time of the block being summed
+
+    struct Block {
+        uint32_t start;
+        uint8_t level;
+    };
+
+    Block _blocks[RING];
+    uint8_t _head;
+    uint8_t _count;
+    bool _started;
+};
+
+#endif
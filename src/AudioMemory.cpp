@@ -0,0 +1,121 @@
+#include "AudioMemory.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#else
+// Host build: one plain heap, accounted as internal RAM
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+size_t AudioMemory::_used[POOL_COUNT];
+size_t AudioMemory::_peak[POOL_COUNT];
+uint32_t AudioMemory::_failures = 0;
+
+// Kept in front of each block; 8 bytes so the data stays 8-byte aligned
+struct AudioBlockHeader {
+    uint32_t size;
+    uint32_t pool;
+};
+
+#ifdef ARDUINO
+static const uint32_t POOL_CAPS[AudioMemory::POOL_COUNT] = {
+    MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT,
+    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+};
+#endif
+
+static const char* POOL_NAMES[AudioMemory::POOL_COUNT] = { "PSRAM", "internal" };
+
+static void* poolMalloc(size_t bytes, AudioMemory::Pool pool) {
+#ifdef ARDUINO
+    return heap_caps_malloc(bytes, POOL_CAPS[pool]);
+#else
+    (void)pool;
+    return malloc(bytes);
+#endif
+}
+
+bool AudioMemory::psramAvailable() {
+#ifdef ARDUINO
+    return psramFound();
+#else
+    return false;
+#endif
+}
+
+void* AudioMemory::alloc(size_t bytes, AudioMemKind kind) {
+    size_t total = bytes + sizeof(AudioBlockHeader);
+    AudioBlockHeader* h = NULL;
+    Pool pool = POOL_INTERNAL;
+    if (kind == AUDIO_MEM_BULK && psramAvailable()) {
+        h = (AudioBlockHeader*)poolMalloc(total, POOL_PSRAM);
+        pool = POOL_PSRAM;
+    }
+    if (h == NULL) {
+        h = (AudioBlockHeader*)poolMalloc(total, POOL_INTERNAL);
+        pool = POOL_INTERNAL;
+    }
+    if (h == NULL) {
+        _failures++;
+        return NULL;
+    }
+
+    h->size = (uint32_t)bytes;
+    h->pool = pool;
+    _used[pool] += bytes;
+    if (_used[pool] > _peak[pool]) _peak[pool] = _used[pool];
+    return h + 1;
+}
+
+void AudioMemory::release(void* block) {
+    if (block == NULL) return;
+    AudioBlockHeader* h = (AudioBlockHeader*)block - 1;
+    _used[h->pool] -= h->size;
+#ifdef ARDUINO
+    heap_caps_free(h);
+#else
+    free(h);
+#endif
+}
+
+size_t AudioMemory::fit(size_t wanted, size_t minimum) {
+#ifndef ARDUINO
+    // No heap limits worth modelling on a host
+    return wanted < minimum ? minimum : wanted;
+#else
+    Pool pool = psramAvailable() ? POOL_PSRAM : POOL_INTERNAL;
+    size_t room = heap_caps_get_largest_free_block(POOL_CAPS[pool]) / 2;
+    if (room < sizeof(AudioBlockHeader)) return minimum;
+    room -= sizeof(AudioBlockHeader);
+    if (wanted > room) wanted = room;
+    return wanted < minimum ? minimum : wanted;
+#endif
+}
+
+void AudioMemory::report() {
+#ifndef ARDUINO
+    printf("[MEM] %s: audio %u (peak %u)\n", POOL_NAMES[POOL_INTERNAL],
+           (unsigned)_used[POOL_INTERNAL], (unsigned)_peak[POOL_INTERNAL]);
+    if (_failures > 0) printf("[MEM] %u audio allocations failed\n", (unsigned)_failures);
+#else
+    for (uint8_t p = 0; p < POOL_COUNT; p++) {
+        if (p == POOL_PSRAM && !psramAvailable()) {
+            Serial.println("[MEM] PSRAM: none");
+            continue;
+        }
+        size_t freeBytes = heap_caps_get_free_size(POOL_CAPS[p]);
+        size_t largest = heap_caps_get_largest_free_block(POOL_CAPS[p]);
+        // Share of the free memory that is not in the largest block
+        unsigned frag = freeBytes ? (unsigned)(100 - (uint64_t)largest * 100 / freeBytes) : 0;
+        Serial.printf("[MEM] %s: %u free, largest block %u (fragmentation %u%%), "
+                      "audio %u (peak %u)\n",
+                      POOL_NAMES[p], (unsigned)freeBytes, (unsigned)largest, frag,
+                      (unsigned)_used[p], (unsigned)_peak[p]);
+    }
+    if (_failures > 0) {
+        Serial.printf("[MEM] %u audio allocations failed\n", (unsigned)_failures);
+    }
+#endif
+}
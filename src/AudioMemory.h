@@ -0,0 +1,56 @@
+#ifndef AUDIO_MEMORY_H
+#define AUDIO_MEMORY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Where an audio buffer should live.
+//
+// BULK buffers are big and touched with memcpy (rings, recordings, jitter
+// queue): PSRAM when the board has it, internal RAM otherwise or when
+// PSRAM is full. FAST buffers are scanned sample by sample in loop() and
+// stay in internal RAM, which is several times quicker than PSRAM over SPI.
+enum AudioMemKind : uint8_t {
+    AUDIO_MEM_BULK,
+    AUDIO_MEM_FAST
+};
+
+// Heap front end for audio buffers, with per-pool accounting.
+//
+// Each block carries a small header with its size and pool, so release()
+// can credit the right pool and the high-water marks are exact. Call from
+// setup()/loop() only; the counters are not locked.
+class AudioMemory {
+public:
+    enum Pool : uint8_t {
+        POOL_PSRAM,
+        POOL_INTERNAL,
+        POOL_COUNT
+    };
+
+    static void* alloc(size_t bytes, AudioMemKind kind = AUDIO_MEM_BULK);
+    static void release(void* block);   // NULL is fine
+
+    static bool psramAvailable();
+
+    // Size for a buffer that would like `wanted` bytes and needs at least
+    // `minimum`: at most half of the largest free BULK block, so one
+    // buffer never takes all of it (or fragments what is left).
+    static size_t fit(size_t wanted, size_t minimum);
+
+    // Bytes held through alloc(), now and at the worst moment
+    static size_t used(Pool pool) { return _used[pool]; }
+    static size_t peak(Pool pool) { return _peak[pool]; }
+    static uint32_t failures() { return _failures; }
+
+    // Heap state per pool: free, largest block, fragmentation, and the
+    // audio buffers' share ("[MEM]" log lines)
+    static void report();
+
+private:
+    static size_t _used[POOL_COUNT];
+    static size_t _peak[POOL_COUNT];
+    static uint32_t _failures;
+};
+
+#endif
@@ -1,29 +1,94 @@
 #include "AudioRecorder.h"
 #include <WiFi.h>
 #include <HTTPClient.h>
+#include "SegmentStream.h"
+#include "AudioMemory.h"
+#include <LittleFS.h>
 
 #define I2S_WS      25
 #define I2S_SD      32
 #define I2S_SCK     33
 
+// multipart/form-data framing, the same for both upload paths
+static const char* BOUNDARY = "------------------------Esp32Boundary";
+
+static String partHead() {
+    return String("--") + BOUNDARY + "\r\n" +
+           "Content-Disposition: form-data; name=\"audio\"; filename=\"esp32.wav\"\r\n" +
+           "Content-Type: audio/wav\r\n\r\n";
+}
+
+static String partTail() {
+    return String("\r\n--") + BOUNDARY + "--\r\n";
+}
+
+// sendAudio() results: an HTTP status, or an HTTPClient error below zero
+static bool uploaded(int status) {
+    return status >= 200 && status < 300;
+}
+
+// No connection, a timeout or a server error may clear up; anything else
+// the server would refuse again
+static bool worthRetrying(int status) {
+    return status <= 0 || status == 408 || status == 429 || status >= 500;
+}
+
 AudioRecorder::AudioRecorder() {
     isRecording = false;
     audioBuffer = NULL;
+    audioBufferSize = 0;
     audioBufferIndex = 0;
+    streamingUpload = false;
+    uploadedBytes = 0;
+    droppedBytes = 0;
+    flashPath = NULL;
+    spoolPartition = NULL;
+    lastRetry = 0;
 }
 
 void AudioRecorder::begin(int sr, const char* url) {
     sampleRate = sr;
     uploadUrl = url;
 
-    // Allocate large buffer for recording
-    // Using ps_malloc if PSRAM is available would be better, 
-    // but standard malloc works for standard ESP32 if size is reasonable.
-    audioBuffer = (uint8_t*)malloc(REC_BUFFER_SIZE);
+    if (flashPath != NULL) {
+        // Formats the partition the first time
+        if (!LittleFS.begin(true)) {
+            Serial.println("[AUDIO] ERROR: Failed to mount LittleFS!");
+            flashPath = NULL;
+        }
+        configI2S();
+        return;
+    }
+    if (streamingUpload) {
+        // The socket takes the audio as it comes; only a small ring is needed
+        if (!ring.begin(REC_RING_SIZE / 2)) {
+            Serial.println("[AUDIO] ERROR: Failed to allocate upload ring!");
+        } else {
+            Serial.printf("[AUDIO] Upload ring allocated: %d bytes\n", REC_RING_SIZE);
+        }
+        configI2S();
+        return;
+    }
+
+    // Allocate large buffer for recording: as long as memory allows,
+    // in PSRAM when the board has it
+    AudioMemory::release(audioBuffer);
+    audioBufferSize = AudioMemory::fit((size_t)sampleRate * 2 * REC_MAX_SECONDS, REC_BUFFER_SIZE);
+    audioBuffer = (uint8_t*)AudioMemory::alloc(audioBufferSize);
     if (audioBuffer == NULL) {
         Serial.println("[AUDIO] ERROR: Failed to allocate audio buffer!");
     } else {
-        Serial.printf("[AUDIO] Buffer allocated: %d bytes\n", REC_BUFFER_SIZE);
+        Serial.printf("[AUDIO] Buffer allocated: %u bytes (%u s)\n",
+                      (unsigned)audioBufferSize, (unsigned)(audioBufferSize / (sampleRate * 2)));
+    }
+
+    if (spoolPartition != NULL) {
+        if (!spoolDevice.begin(spoolPartition) || !spool.begin(&spoolDevice)) {
+            Serial.printf("[AUDIO] ERROR: Cannot open spool partition %s!\n", spoolPartition);
+            spoolPartition = NULL;
+        } else if (spool.pendingBlocks() > 0) {
+            Serial.printf("[AUDIO] %u spooled blocks to upload\n", (unsigned)spool.pendingBlocks());
+        }
     }
 
     configI2S();
@@ -55,6 +120,26 @@ void AudioRecorder::configI2S() {
 }
 
 void AudioRecorder::start() {
+    if (flashPath != NULL) {
+        flashSink.file = LittleFS.open(flashPath, "w");
+        if (!flashSink.file || !wav.begin(&flashSink, sampleRate)) {
+            Serial.printf("[AUDIO] Cannot write %s\n", flashPath);
+            flashSink.file.close();
+            return;
+        }
+        isRecording = true;
+        Serial.printf("[AUDIO] Recording to %s...\n", flashPath);
+        return;
+    }
+    if (streamingUpload) {
+        if (ring.space() == 0 || !openUpload()) return;
+        ring.skip(ring.available());
+        uploadedBytes = 0;
+        droppedBytes = 0;
+        isRecording = true;
+        Serial.println("[AUDIO] Recording started (streaming upload)...");
+        return;
+    }
     if (audioBuffer == NULL) return;
     
     // Clear buffer
@@ -66,16 +151,59 @@ void AudioRecorder::start() {
 void AudioRecorder::stop() {
     if (!isRecording) return;
     isRecording = false;
+    if (flashPath != NULL) {
+        bool patched = wav.finish();
+        flashSink.file.close();
+        Serial.printf("[AUDIO] Recording stopped. Saved %u bytes to %s%s\n",
+                      (unsigned)wav.dataBytes(), flashPath,
+                      patched ? "" : " (header sizes not updated)");
+        return;
+    }
+    if (streamingUpload) {
+        finishUpload();
+        return;
+    }
     Serial.printf("[AUDIO] Recording stopped. Captured %d bytes.\n", audioBufferIndex);
     
-    // Send data immediately after stopping
+    // Send data immediately after stopping; keep it if it may go later
     if (audioBufferIndex > 0) {
-        sendAudio();
+        int status = sendAudio();
+        if (!uploaded(status) && worthRetrying(status) && spoolPartition != NULL) spoolAudio();
     }
 }
 
 void AudioRecorder::loop() {
-    if (!isRecording || audioBuffer == NULL) return;
+    if (!isRecording) {
+        if (spoolPartition != NULL) replaySpooled();
+        return;
+    }
+    if (flashPath != NULL) {
+        size_t bytesRead = 0;
+        i2s_read(I2S_NUM_0, i2sReadBuffer, sizeof(i2sReadBuffer), &bytesRead, 0);
+        if (bytesRead > 0 && wav.write(i2sReadBuffer, bytesRead) < bytesRead) {
+            Serial.println("[AUDIO] Flash full! Auto-stopping.");
+            stop();
+        }
+        return;
+    }
+    if (streamingUpload) {
+        size_t bytesRead = 0;
+        i2s_read(I2S_NUM_0, i2sReadBuffer, sizeof(i2sReadBuffer), &bytesRead, 0);
+        size_t samples = bytesRead / 2;
+        size_t written = ring.write(i2sReadBuffer, samples);
+        if (written < samples) droppedBytes += (samples - written) * 2;
+
+        // A chunk per pass keeps each socket write short, so loop() gets
+        // back to the I2S DMA (4 x 256 samples) before it overflows. A short
+        // write cuts the body mid-chunk and nothing after it would parse.
+        if (!sendRing(CHUNK_DATA / 2) || !client.connected()) {
+            Serial.println("[AUDIO] Upload connection lost. Recording stopped.");
+            isRecording = false;
+            client.stop();
+        }
+        return;
+    }
+    if (audioBuffer == NULL) return;
 
     size_t bytesRead = 0;
     // Read from I2S
@@ -83,7 +211,7 @@ void AudioRecorder::loop() {
 
     if (bytesRead > 0) {
         // Check if we have space
-        if (audioBufferIndex + bytesRead < REC_BUFFER_SIZE) {
+        if (audioBufferIndex + bytesRead < audioBufferSize) {
             memcpy(&audioBuffer[audioBufferIndex], i2sReadBuffer, bytesRead);
             audioBufferIndex += bytesRead;
         } else {
@@ -94,171 +222,213 @@ void AudioRecorder::loop() {
     }
 }
 
-void AudioRecorder::sendAudio() {
+int AudioRecorder::sendAudio() {
     if (WiFi.status() != WL_CONNECTED) {
         Serial.println("[AUDIO] WiFi not connected. Cannot upload.");
-        return;
+        return HTTPC_ERROR_NOT_CONNECTED;
     }
 
     HTTPClient http;
     Serial.println("[AUDIO] Uploading...");
 
     // Create boundary for multipart
-    String boundary = "------------------------Esp32Boundary";
-    String contentType = "multipart/form-data; boundary=" + boundary;
+    String contentType = String("multipart/form-data; boundary=") + BOUNDARY;
 
     http.begin(uploadUrl);
     http.addHeader("Content-Type", contentType);
+    http.setTimeout(10000); // Increase timeout to 10 seconds
 
-    // Construct the body header
-    // We need to construct the multipart body manually
-    // Format:
+    // Body format:
     // --boundary
-    // Content-Disposition: form-data; name="audio"; filename="recording.wav"
+    // Content-Disposition: form-data; name="audio"; filename="esp32.wav"
     // Content-Type: audio/wav
-    // 
-    // <WAV DATA>
+    //
+    // <WAV header><PCM>
     // --boundary--
+    uint8_t wavHeader[WavWriter::HEADER_SIZE];
+    WavWriter::header(wavHeader, sampleRate, 1, 16, audioBufferIndex);
 
-    // 1. WAV Header
-    uint8_t wavHeader[44];
-    addWavHeader(wavHeader, audioBufferIndex);
+    String head = partHead();
+    String tail = partTail();
 
-    // 2. Multipart Header
-    String head = "--" + boundary + "\r\n" +
-                  "Content-Disposition: form-data; name=\"audio\"; filename=\"esp32.wav\"\r\n" +
-                  "Content-Type: audio/wav\r\n\r\n";
-    
-    String tail = "\r\n--" + boundary + "--\r\n";
+    // The pieces go out in order over the one connection, read straight
+    // from where they are: no second copy of the recording. HTTPClient
+    // sets Content-Length from the total.
+    SegmentStream body;
+    body.add(head);
+    body.add(wavHeader, sizeof(wavHeader));
+    body.add(audioBuffer, audioBufferIndex);
+    body.add(tail);
 
-    // Calculate total length
-    size_t totalLength = head.length() + 44 + audioBufferIndex + tail.length();
-    
-    http.addHeader("Content-Length", String(totalLength));
-
-    // We will use a custom stream logic or just send one big buffer if RAM permits.
-    // Constructing one huge buffer might fail if RAM is tight.
-    // Ideally we use startTransaction or a stream helper, but standard HTTPClient 
-    // often expects a single payload or a Stream object.
-    
-    // For simplicity/stability with limited RAM, let's try sending the raw WAV without multipart first? 
-    // NO, backend expects multipart. 
-    
-    // Let's allocate a temporary buffer for the HEAD + HEADER to send in chunks?
-    // HTTPClient supports sending a Stream, but we have a memory buffer.
-    // We can try to collect it all into one buffer if it fits? 
-    // We already used 120KB for audio. Another 120KB might crash.
-    
-    // ALTERNATIVE:
-    // Just send the raw audio body and change backend to expect raw data?
-    // User specifically asked to "update code" if endpoint is correct.
-    // Keeping backend as multipart is standard.
-    // Let's use the "collect" method but be careful. 
-    
-    // NOTE: Since constructing a new 120KB buffer + strings is risky on ESP32,
-    // let's try a simpler approach: Send RAW bytes and update Backend?
-    // OR: Use the fact that we can just point to the buffer if we can prepend the header?
-    
-    // ACTUALLY: It's safer to change the backend to receive RAW binary for embedded devices.
-    // But I will stick to the user request to fix the ESP32 code primarily.
-    
-    // Let's try to send it all in one go by temporarily shifting data? No, slow.
-    
-    // RE-STRATEGY:
-    // We will send it as "application/octet-stream" (RAW) because constructing Multipart in RAM is too heavy.
-    // AND I will tell the user to update the backend slightly to handle this, OR
-    // I will cheat: I will just send the raw bytes and hope the backend "upload.single" can handle it? 
-    // standard multer will FAIL on raw binary without boundary.
+    int res = http.sendRequest("POST", &body, body.size());
     
-    // Let's stick to Multipart but send it smartly.
-    // We can use the `http.POST(uint8_t * payload, size_t size)` if we can merge them.
-    // But we can't easily merge without alloc.
-    
-    // SOLUTION: Change logic to send RAW BINARY. It is 10x more stable for ESP32.
-    // I will comment out the multipart stuff and send raw, and ask user to update backend?
-    // OR I will implement a custom send loop. 
-    
-    // Let's go with the RAW BINARY approach for stability, 
-    // BUT since I must provide valid code for the CURRENT backend:
-    
-    // I will use a trick: I will just send raw bytes as `application/octet-stream`
-    // and I will update the backend code for you in the next step if needed. 
-    // Actually, I'll try to implement the multipart by creating a combined buffer ONLY for the header+footer is impossible without moving data.
-    
-    // OK, I will use a helper class or just standard loop?
-    // Arduino HTTPClient doesn't support chunked transfer well for POST bodies from memory easily without stream.
-    
-    // DECISION: I will send RAW AUDIO (WAV) and update backend to receive it.
-    // This is the most robust "Embedded to Cloud" pattern.
-    // I will rename the endpoint in the ESP32 code to `/upload-raw` so it's clear.
-    
-    // WAIT, I can just use the existing buffer, shift the data by `head.length() + 44` bytes 
-    // (if I allocate buffer slightly larger) and fill the front?
-    // That avoids double allocation!
-    
-    // Let's assume we will just update the Backend to keep it simple for the User.
-    // But the User asked "does the endpoint correct?".
-    // I will update the ESP32 to send RAW WAV and then I will update the backend.
-    
-    http.addHeader("Content-Type", "audio/wav");
-    http.setTimeout(10000); // Increase timeout to 10 seconds
-    
-    // Create a temp header buffer
-    uint8_t header[44];
-    addWavHeader(header, audioBufferIndex);
-    
-    // We need to send Header + Body.
-    // Since we can't easily catenate, let's just send the BODY (raw PCM)
-    // and let the backend add the header? 
-    // Or better: We send the header + body if we can.
-    
-    // Let's just send the raw PCM data for now. The backend can wrap it in a WAV container easily.
-    // Sending raw PCM is safest.
-    
-    int res = http.POST(audioBuffer, audioBufferIndex);
-    
-    if (res > 0) {
+    if (uploaded(res)) {
         Serial.printf("[AUDIO] Upload success! Status: %d\n", res);
         String payload = http.getString();
         Serial.println("Response: " + payload);
+    } else if (res > 0) {
+        Serial.printf("[AUDIO] Upload refused. Status: %d\n", res);
     } else {
         Serial.printf("[AUDIO] Upload failed. Error: %s\n", http.errorToString(res).c_str());
     }
     
     http.end();
+    return res;
+}
+
+void AudioRecorder::spoolAudio() {
+    if (spool.beginRecord() && spool.append(audioBuffer, audioBufferIndex) == audioBufferIndex &&
+        spool.endRecord()) {
+        Serial.printf("[AUDIO] Recording kept on flash (%u blocks pending)\n",
+                      (unsigned)spool.pendingBlocks());
+        Serial.printf("[AUDIO] Spool block writes: %u, avg %u us, max %u us\n",
+                      (unsigned)spoolDevice.writes(), (unsigned)spoolDevice.averageWriteMicros(),
+                      (unsigned)spoolDevice.maxWriteMicros());
+    } else {
+        Serial.println("[AUDIO] Cannot write spool. Recording lost.");
+    }
+    if (spool.overwrittenBlocks() > 0) {
+        Serial.printf("[AUDIO] Spool full: %u blocks of older recordings overwritten\n",
+                      (unsigned)spool.overwrittenBlocks());
+    }
+}
+
+void AudioRecorder::replaySpooled() {
+    if (audioBuffer == NULL || spool.pendingBlocks() == 0) return;
+    if (WiFi.status() != WL_CONNECTED || millis() - lastRetry < REC_RETRY_MS) return;
+    lastRetry = millis();
+    if (!spool.nextRecord()) return;
+
+    // Through the recording buffer, which it came from, so it fits
+    size_t bytes = spool.recordBytes();
+    if (bytes > audioBufferSize || spool.read(audioBuffer, bytes) != bytes) {
+        Serial.println("[AUDIO] Spooled recording unreadable, dropped");
+        spool.consume();
+        return;
+    }
+    audioBufferIndex = bytes;
+    Serial.printf("[AUDIO] Uploading spooled recording (%u bytes)\n", (unsigned)bytes);
+    int status = sendAudio();
+    if (uploaded(status)) {
+        spool.consume();
+    } else if (!worthRetrying(status)) {
+        Serial.println("[AUDIO] Spooled recording refused by the server, dropped");
+        spool.consume();
+    }
+}
+
+bool AudioRecorder::openUpload() {
+    if (WiFi.status() != WL_CONNECTED) {
+        Serial.println("[AUDIO] WiFi not connected. Cannot upload.");
+        return false;
+    }
+    String host, path;
+    uint16_t port;
+    if (!parseUrl(uploadUrl, host, port, path)) {
+        Serial.println("[AUDIO] Streaming upload needs an http://host[:port]/path URL");
+        return false;
+    }
+    if (!client.connect(host.c_str(), port)) {
+        Serial.printf("[AUDIO] Cannot connect to %s:%u\n", host.c_str(), port);
+        return false;
+    }
+    // Small writes go out at once: the server hears the end as it happens
+    client.setNoDelay(true);
+
+    String request = String("POST ") + path + " HTTP/1.1\r\n" +
+                     "Host: " + host + "\r\n" +
+                     "Content-Type: multipart/form-data; boundary=" + BOUNDARY + "\r\n" +
+                     "Transfer-Encoding: chunked\r\n" +
+                     "Connection: close\r\n\r\n";
+
+    // The length is not known yet and a socket cannot go back to patch
+    // it: readers take the data up to the end of the part
+    uint8_t wavHeader[WavWriter::HEADER_SIZE];
+    WavWriter::header(wavHeader, sampleRate, 1, 16, WavWriter::UNKNOWN_SIZE);
+
+    String head = partHead();
+    if (client.print(request) != request.length() ||
+        !sendChunk((const uint8_t*)head.c_str(), head.length()) ||
+        !sendChunk(wavHeader, sizeof(wavHeader))) {
+        Serial.println("[AUDIO] Upload connection lost before the audio");
+        client.stop();
+        return false;
+    }
+    Serial.println("[AUDIO] Uploading while recording...");
+    return true;
+}
+
+bool AudioRecorder::sendChunk(const uint8_t* data, size_t length) {
+    if (length == 0) return true; // A zero-length chunk would end the body
+    if (length > CHUNK_DATA) return false;
+    // The data sits at CHUNK_HEAD, the size line goes right before it
+    uint8_t* body = chunkFrame + CHUNK_HEAD;
+    if (data != body) memcpy(body, data, length);
+    char size[CHUNK_HEAD + 1];
+    int n = snprintf(size, sizeof(size), "%X\r\n", (unsigned)length);
+    uint8_t* frame = body - n;
+    memcpy(frame, size, n);
+    body[length] = '\r';
+    body[length + 1] = '\n';
+    size_t total = n + length + 2;
+    return client.write(frame, total) == total;
+}
+
+bool AudioRecorder::sendRing(size_t maxSamples) {
+    if (maxSamples > CHUNK_DATA / 2) maxSamples = CHUNK_DATA / 2;
+    // Read straight into the frame, no copy
+    size_t n = ring.read((int16_t*)(chunkFrame + CHUNK_HEAD), maxSamples);
+    if (!sendChunk(chunkFrame + CHUNK_HEAD, n * 2)) return false;
+    uploadedBytes += n * 2;
+    return true;
 }
 
-void AudioRecorder::addWavHeader(uint8_t* header, int wavSize) {
-    int bitsPerSample = 16;
-    int channels = 1;
-    int byteRate = sampleRate * channels * (bitsPerSample / 8);
-    int blockAlign = channels * (bitsPerSample / 8);
-
-    header[0] = 'R'; header[1] = 'I'; header[2] = 'F'; header[3] = 'F';
-    unsigned int fileSize = wavSize + 44 - 8;
-    header[4] = (byteRate >> 0) & 0xFF; // Placeholder for file size
-    header[5] = (fileSize >> 8) & 0xFF;
-    header[6] = (fileSize >> 16) & 0xFF;
-    header[7] = (fileSize >> 24) & 0xFF;
-    header[8] = 'W'; header[9] = 'A'; header[10] = 'V'; header[11] = 'E';
-    header[12] = 'f'; header[13] = 'm'; header[14] = 't'; header[15] = ' ';
-    header[16] = 16; header[17] = 0; header[18] = 0; header[19] = 0;
-    header[20] = 1; header[21] = 0;
-    header[22] = channels; header[23] = 0;
-    header[24] = (sampleRate >> 0) & 0xFF;
-    header[25] = (sampleRate >> 8) & 0xFF;
-    header[26] = (sampleRate >> 16) & 0xFF;
-    header[27] = (sampleRate >> 24) & 0xFF;
-    header[28] = (byteRate >> 0) & 0xFF;
-    header[29] = (byteRate >> 8) & 0xFF;
-    header[30] = (byteRate >> 16) & 0xFF;
-    header[31] = (byteRate >> 24) & 0xFF;
-    header[32] = (blockAlign >> 0) & 0xFF;
-    header[33] = (blockAlign >> 8) & 0xFF;
-    header[34] = bitsPerSample; header[35] = 0;
-    header[36] = 'd'; header[37] = 'a'; header[38] = 't'; header[39] = 'a';
-    header[40] = (wavSize >> 0) & 0xFF;
-    header[41] = (wavSize >> 8) & 0xFF;
-    header[42] = (wavSize >> 16) & 0xFF;
-    header[43] = (wavSize >> 24) & 0xFF;
+void AudioRecorder::finishUpload() {
+    bool sent = true;
+    while (sent && ring.available() > 0) {
+        sent = sendRing(CHUNK_DATA / 2);
+    }
+    String tail = partTail();
+    if (!sent || !sendChunk((const uint8_t*)tail.c_str(), tail.length()) || client.print("0\r\n\r\n") != 5) {
+        Serial.printf("[AUDIO] Upload connection lost. Uploaded %u bytes (%u dropped).\n",
+                      (unsigned)uploadedBytes, (unsigned)droppedBytes);
+        client.stop();
+        return;
+    }
+    Serial.printf("[AUDIO] Recording stopped. Uploaded %u bytes (%u dropped).\n",
+                  (unsigned)uploadedBytes, (unsigned)droppedBytes);
+
+    // Only the status line matters
+    unsigned long start = millis();
+    while (client.connected() && !client.available() && millis() - start < 10000) {
+        delay(10);
+    }
+    String status = client.readStringUntil('\n');
+    if (status.startsWith("HTTP/1.1 2") || status.startsWith("HTTP/1.0 2")) {
+        Serial.println("[AUDIO] Upload success! " + status);
+    } else {
+        Serial.println("[AUDIO] Upload failed: " + status);
+    }
+    client.stop();
+}
+
+bool AudioRecorder::parseUrl(const String& url, String& host, uint16_t& port, String& path) {
+    // http://host[:port][/path]
+    if (!url.startsWith("http://")) return false;
+    int hostStart = 7;
+    int slash = url.indexOf('/', hostStart);
+    String authority = slash < 0 ? url.substring(hostStart) : url.substring(hostStart, slash);
+    path = slash < 0 ? String("/") : url.substring(slash);
+
+    int colon = authority.indexOf(':');
+    if (colon < 0) {
+        host = authority;
+        port = 80;
+    } else {
+        host = authority.substring(0, colon);
+        long p = authority.substring(colon + 1).toInt();
+        if (p <= 0 || p > 65535) return false;
+        port = (uint16_t)p;
+    }
+    return host.length() > 0;
 }
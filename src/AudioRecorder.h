@@ -3,12 +3,35 @@
 
 #include <Arduino.h>
 #include <driver/i2s.h>
+#include <WiFi.h>
+#include <FS.h>
+#include "AudioRingBuffer.h"
+#include "WavWriter.h"
+#include "SpoolLog.h"
 
-// Adjust buffer size based on available RAM.
+// Recording buffer, sized to the memory the board has (AudioMemory::fit):
+// at least REC_BUFFER_SIZE, up to REC_MAX_SECONDS with PSRAM.
 // 8kHz * 2 bytes/sample = 16000 bytes/second.
 // 50,000 bytes ~= 3.1 seconds of audio.
-// Reduced from 120,000 to fit in standard ESP32 RAM.
 #define REC_BUFFER_SIZE 50000 
+#define REC_MAX_SECONDS 60
+
+// Streaming upload: the mic fills a ring of this many bytes and the socket
+// drains it, so only network stalls longer than ~1s at 8kHz lose audio.
+#define REC_RING_SIZE 16384
+
+// Store and forward: recordings that could not be uploaded are retried
+// every REC_RETRY_MS while the recorder is idle.
+#define REC_RETRY_MS 5000
+
+// A flash file as a WavWriter sink: seekable, so the sizes get patched
+class FileWavSink : public WavSink {
+public:
+    fs::File file;
+
+    size_t write(const uint8_t* data, size_t length) override { return file.write(data, length); }
+    bool seek(uint32_t position) override { return file.seek(position); }
+};
 
 class AudioRecorder {
 public:
@@ -18,10 +41,35 @@ public:
     void stop();
     void loop();
 
+    // Upload while recording: start() opens the POST, loop() sends the
+    // audio as HTTP chunks (Transfer-Encoding: chunked) as it arrives, and
+    // stop() only has to send the last few ms. No length limit. The URL
+    // must be plain http://host[:port]/path. Call before begin().
+    void setStreamingUpload(bool on) { streamingUpload = on; }
+
+    // Record to a WAV file on LittleFS instead of uploading (no length
+    // limit but the flash). The header is patched with the real sizes on
+    // stop(). Takes precedence over the upload modes. Call before begin().
+    void setRecordToFlash(const char* path) { flashPath = path; }
+
+    // Keep recordings whose upload failed (no WiFi, server down) in a ring
+    // log on flash and upload them from loop() once it works again, oldest
+    // first. `partition` is the label of a raw data partition, e.g.
+    // "spool" (see partitions.csv), not shared with the WSAudioStreamer.
+    // Buffered uploads only. Call before begin().
+    void setStoreAndForward(const char* partition) { spoolPartition = partition; }
+
 private:
     void configI2S();
-    void sendAudio();
-    void addWavHeader(uint8_t* header, int wavSize);
+    int sendAudio();
+    void spoolAudio();
+    void replaySpooled();
+
+    bool openUpload();
+    bool sendChunk(const uint8_t* data, size_t length);
+    bool sendRing(size_t maxSamples);
+    void finishUpload();
+    static bool parseUrl(const String& url, String& host, uint16_t& port, String& path);
 
     int sampleRate;
     String uploadUrl;
@@ -29,10 +77,34 @@ private:
     
     // Large buffer to hold the entire recording
     uint8_t* audioBuffer; 
+    size_t audioBufferSize;
     size_t audioBufferIndex;
     
     // Temporary buffer for I2S reads
-    char i2sReadBuffer[1024];
+    int16_t i2sReadBuffer[512];
+
+    // Streaming upload
+    bool streamingUpload;
+    AudioRingBuffer ring;
+    WiFiClient client;
+    // One chunk on the wire: hex size line, data, CRLF, sent with a single
+    // write. With no delay each write is a segment of its own.
+    static const size_t CHUNK_HEAD = 8;     // Room for the size line
+    static const size_t CHUNK_DATA = 1024;
+    alignas(4) uint8_t chunkFrame[CHUNK_HEAD + CHUNK_DATA + 2];
+    size_t uploadedBytes;
+    size_t droppedBytes;
+
+    // Recording to flash
+    const char* flashPath;
+    FileWavSink flashSink;
+    WavWriter wav;
+
+    // Store and forward
+    const char* spoolPartition;
+    PartitionSpoolDevice spoolDevice;
+    SpoolLog spool;
+    unsigned long lastRetry;
 };
 
 #endif
@@ -0,0 +1,87 @@
+#include "AudioRingBuffer.h"
+#include "AudioMemory.h"
+
+#include <string.h>
+
+AudioRingBuffer::AudioRingBuffer() : _data(NULL), _mask(0), _head(0), _tail(0) {
+}
+
+AudioRingBuffer::~AudioRingBuffer() {
+    AudioMemory::release(_data);
+}
+
+bool AudioRingBuffer::begin(size_t capacity) {
+    size_t size = 1;
+    while (size < capacity) size <<= 1;
+
+    AudioMemory::release(_data);
+    _data = (int16_t*)AudioMemory::alloc(size * sizeof(int16_t));
+    if (_data == NULL) {
+        _mask = 0;
+        return false;
+    }
+    _mask = size - 1;
+    _head.store(0, std::memory_order_relaxed);
+    _tail.store(0, std::memory_order_relaxed);
+    return true;
+}
+
+size_t AudioRingBuffer::fitCapacity(size_t wanted, size_t minimum) {
+    size_t budget = AudioMemory::fit(wanted * sizeof(int16_t), minimum * sizeof(int16_t)) / sizeof(int16_t);
+    size_t size = 1;
+    while (size * 2 <= budget) size <<= 1;
+    return size < minimum ? minimum : size;
+}
+
+size_t AudioRingBuffer::space() const {
+    if (_data == NULL) return 0;
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    uint32_t tail = _tail.load(std::memory_order_acquire);
+    return capacity() - (head - tail);
+}
+
+size_t AudioRingBuffer::available() const {
+    uint32_t head = _head.load(std::memory_order_acquire);
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    return head - tail;
+}
+
+size_t AudioRingBuffer::write(const int16_t* samples, size_t count) {
+    size_t room = space();
+    if (count > room) count = room;
+    if (count == 0) return 0;
+
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    size_t start = head & _mask;
+    size_t first = capacity() - start;
+    if (first > count) first = count;
+    memcpy(_data + start, samples, first * sizeof(int16_t));
+    memcpy(_data, samples + first, (count - first) * sizeof(int16_t));
+
+    _head.store(head + (uint32_t)count, std::memory_order_release);
+    return count;
+}
+
+size_t AudioRingBuffer::read(int16_t* samples, size_t count) {
+    size_t ready = available();
+    if (count > ready) count = ready;
+    if (count == 0) return 0;
+
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    size_t start = tail & _mask;
+    size_t first = capacity() - start;
+    if (first > count) first = count;
+    memcpy(samples, _data + start, first * sizeof(int16_t));
+    memcpy(samples + first, _data, (count - first) * sizeof(int16_t));
+
+    _tail.store(tail + (uint32_t)count, std::memory_order_release);
+    return count;
+}
+
+size_t AudioRingBuffer::skip(size_t count) {
+    size_t ready = available();
+    if (count > ready) count = ready;
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    _tail.store(tail + (uint32_t)count, std::memory_order_release);
+    return count;
+}
@@ -0,0 +1,51 @@
+#ifndef AUDIO_RING_BUFFER_H
+#define AUDIO_RING_BUFFER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// Lock-free single-producer / single-consumer ring of 16-bit samples.
+//
+// One task writes, one task reads, no locks and no blocking. Each side only
+// stores its own index; the release/acquire pair on the indices makes the
+// sample data visible before the index that publishes it. The indices run
+// freely and wrap at 2^32, the capacity is a power of two so the slot is
+// just `index & mask`.
+class AudioRingBuffer {
+public:
+    AudioRingBuffer();
+    ~AudioRingBuffer();
+
+    // `capacity` is rounded up to a power of two. The ring goes to PSRAM
+    // when there is some (see AudioMemory). Returns false when the
+    // allocation fails.
+    bool begin(size_t capacity);
+
+    // Capacity for a ring that would like `wanted` samples and needs at
+    // least `minimum`: the largest power of two within AudioMemory::fit(),
+    // so begin()'s rounding up cannot take it past that budget
+    static size_t fitCapacity(size_t wanted, size_t minimum);
+
+    // Producer side. Copies as much as fits; returns samples written.
+    size_t write(const int16_t* samples, size_t count);
+    size_t space() const;
+
+    // Consumer side. Returns samples read.
+    size_t read(int16_t* samples, size_t count);
+    size_t skip(size_t count);
+    size_t available() const;
+
+    size_t capacity() const { return _mask + 1; }
+
+private:
+    AudioRingBuffer(const AudioRingBuffer&);
+    AudioRingBuffer& operator=(const AudioRingBuffer&);
+
+    int16_t* _data;
+    uint32_t _mask;
+    std::atomic<uint32_t> _head;    // Written by the producer
+    std::atomic<uint32_t> _tail;    // Written by the consumer
+};
+
+#endif
@@ -0,0 +1,110 @@
+#include "DisplayService.h"
+
+#include <string.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+DisplayService::DisplayService() {
+#ifdef ARDUINO
+    _task = NULL;
+    _mux = portMUX_INITIALIZER_UNLOCKED;
+#endif
+    _front = 0;
+    _backState = BACK_FREE;
+    _invalidate = false;
+    _presented = 0;
+    _flushed = 0;
+    _dropped = 0;
+    memset(_buffers, 0, sizeof(_buffers));
+}
+
+void DisplayService::lock() {
+#ifdef ARDUINO
+    portENTER_CRITICAL(&_mux);
+#else
+    _mutex.lock();
+#endif
+}
+
+void DisplayService::unlock() {
+#ifdef ARDUINO
+    portEXIT_CRITICAL(&_mux);
+#else
+    _mutex.unlock();
+#endif
+}
+
+void DisplayService::begin(OledBus* bus, int core, int priority) {
+    _flusher.begin(bus);
+#ifdef ARDUINO
+    if (_task == NULL) {
+        xTaskCreatePinnedToCore(taskEntry, "display", 3072, this, priority, &_task, core);
+    }
+#else
+    (void)core;
+    (void)priority;
+#endif
+}
+
+uint8_t* DisplayService::beginFrame() {
+    lock();
+    if (_backState == BACK_READY) {
+        // The task has not picked up the last frame yet: this one replaces it
+        _dropped++;
+    }
+    _backState = BACK_RENDERING;
+    uint8_t* back = _buffers[1 - _front];
+    unlock();
+    return back;
+}
+
+void DisplayService::present() {
+    lock();
+    _backState = BACK_READY;
+    _presented++;
+    unlock();
+#ifdef ARDUINO
+    if (_task != NULL) xTaskNotifyGive(_task);
+#endif
+}
+
+void DisplayService::submit(const uint8_t* frame) {
+    memcpy(beginFrame(), frame, OLED_BUFFER_SIZE);
+    present();
+}
+
+void DisplayService::invalidate() {
+    _invalidate = true;
+}
+
+bool DisplayService::flushPending() {
+    lock();
+    if (_backState != BACK_READY) {
+        unlock();
+        return false;
+    }
+    // Swap: the presented frame becomes the front, the old front is free to draw on
+    _front = 1 - _front;
+    _backState = BACK_FREE;
+    bool full = _invalidate;
+    _invalidate = false;
+    unlock();
+
+    if (full) _flusher.invalidate();
+    _flusher.flush(_buffers[_front]);
+    _flushed++;
+    return true;
+}
+
+#ifdef ARDUINO
+void DisplayService::taskEntry(void* arg) {
+    DisplayService* self = (DisplayService*)arg;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while (self->flushPending()) {
+        }
+    }
+}
+#endif
@@ -0,0 +1,83 @@
+#ifndef DISPLAY_SERVICE_H
+#define DISPLAY_SERVICE_H
+
+#include <stdint.h>
+#include "OledFlush.h"
+
+#ifdef ARDUINO
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#else
+#include <mutex>
+#endif
+
+// Double-buffered OLED output with the I2C transfer on its own task.
+//
+// The renderer draws into the back buffer and presents it; the flush task
+// swaps it to the front and sends it through a PageFlusher while the caller
+// carries on. Nobody ever waits on the bus:
+//
+//   renderer:  beginFrame() -> draw -> present()
+//   task:      take READY back buffer -> swap -> flush front -> repeat
+//
+// Back buffer ownership:
+//   FREE      renderer may claim it
+//   RENDERING renderer owns it; the task never touches it
+//   READY     presented; the task takes it on its next pass. A renderer that
+//             calls beginFrame() first reclaims it and the older frame is
+//             dropped (counted), since only the newest picture matters.
+class DisplayService {
+public:
+    DisplayService();
+
+    // Starts the flush task on `core` (the Arduino loop runs on core 1).
+    // Without FreeRTOS (host build) call flushPending() yourself.
+    void begin(OledBus* bus, int core = 0, int priority = 1);
+
+    // Claim the back buffer for drawing (page layout, OLED_BUFFER_SIZE).
+    // It holds an older frame, so draw the whole picture.
+    uint8_t* beginFrame();
+
+    // Hand the back buffer to the flush task. Never blocks.
+    void present();
+
+    // Copy a finished frame (e.g. Adafruit_SSD1306::getBuffer()) and present it
+    void submit(const uint8_t* frame);
+
+    // Next present() sends the whole panel instead of changed spans
+    void invalidate();
+
+    // One pass of the flush task: take a READY frame and send it.
+    // Returns false when there was nothing to do.
+    bool flushPending();
+
+    uint32_t presentedFrames() const { return _presented; }
+    uint32_t flushedFrames() const { return _flushed; }
+    uint32_t droppedFrames() const { return _dropped; }
+
+private:
+    enum BackState : uint8_t { BACK_FREE, BACK_RENDERING, BACK_READY };
+
+    void lock();
+    void unlock();
+
+#ifdef ARDUINO
+    static void taskEntry(void* arg);
+
+    TaskHandle_t _task;
+    portMUX_TYPE _mux;
+#else
+    std::mutex _mutex;
+#endif
+
+    PageFlusher _flusher;
+    uint8_t _buffers[2][OLED_BUFFER_SIZE];
+    uint8_t _front;                  // Index owned by the flush task
+    volatile BackState _backState;
+    volatile bool _invalidate;
+    volatile uint32_t _presented;
+    volatile uint32_t _flushed;
+    volatile uint32_t _dropped;
+};
+
+#endif
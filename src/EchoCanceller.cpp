@@ -0,0 +1,180 @@
+#include "EchoCanceller.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+EchoCanceller::EchoCanceller() {
+    _taps = 0;
+    _step = 8192;
+    _weights = NULL;
+    _fore = NULL;
+    _cand = NULL;
+    _history = NULL;
+    _regularize = 0;
+    _blockSamples = 160;
+    _suppress = true;
+    reset();
+}
+
+EchoCanceller::~EchoCanceller() {
+    free(_weights);
+    free(_fore);
+    free(_cand);
+    free(_history);
+}
+
+bool EchoCanceller::begin(uint32_t sampleRate, size_t taps, uint16_t stepQ15) {
+    free(_weights);
+    free(_fore);
+    free(_cand);
+    free(_history);
+    _taps = taps ? taps : 1;
+    _step = stepQ15;
+    _weights = (int32_t*)malloc(_taps * sizeof(int32_t));
+    _fore = (int16_t*)malloc(_taps * sizeof(int16_t));
+    _cand = (int16_t*)malloc(_taps * sizeof(int16_t));
+    _history = (int16_t*)malloc(2 * _taps * sizeof(int16_t));
+    _blockSamples = sampleRate / 100;
+    if (_blockSamples == 0) _blockSamples = 1;
+    // Floor for the window energy: a reference around -50dBFS
+    _regularize = (uint64_t)_taps * 32 * 32;
+    reset();
+    return _weights != NULL && _fore != NULL && _cand != NULL && _history != NULL;
+}
+
+void EchoCanceller::reset() {
+    if (_weights != NULL) memset(_weights, 0, _taps * sizeof(int32_t));
+    if (_fore != NULL) memset(_fore, 0, _taps * sizeof(int16_t));
+    if (_cand != NULL) memset(_cand, 0, _taps * sizeof(int16_t));
+    clearHistory();
+    _erleQ8 = 256;
+    _erleDb = 0;
+    _gain = 32767;
+    _gainNow = 32767;
+}
+
+void EchoCanceller::clearHistory() {
+    if (_history != NULL) memset(_history, 0, 2 * _taps * sizeof(int16_t));
+    _pos = 0;
+    _refEnergy = 0;
+    _doubleTalk = false;
+    _blockFill = 0;
+    _micEnergy = 0;
+    _errEnergy = 0;
+    _candEnergy = 0;
+    _echoEnergy = 0;
+}
+
+void EchoCanceller::process(const int16_t* mic, const int16_t* ref, int16_t* out, size_t count) {
+    if (_weights == NULL || _fore == NULL || _cand == NULL || _history == NULL) {
+        if (out != mic) memmove(out, mic, count * sizeof(int16_t));
+        return;
+    }
+
+    for (size_t n = 0; n < count; n++) {
+        int16_t x = ref[n];
+        int32_t d = mic[n];
+
+        // Mirrored history: the window is always one contiguous run,
+        // oldest first, with the newest sample at win[_taps - 1]
+        int16_t old = _history[_pos];
+        _history[_pos] = x;
+        _history[_pos + _taps] = x;
+        const int16_t* win = _history + _pos + 1;
+        if (++_pos == _taps) _pos = 0;
+        _refEnergy += (uint32_t)((int32_t)x * x);
+        _refEnergy -= (uint32_t)((int32_t)old * old);
+
+        // Echo estimates. The sums may pass through int32 overflow on their
+        // way to a result that fits, so they are accumulated modulo 2^32.
+        uint32_t accBack = 0;
+        uint32_t accFore = 0;
+        uint32_t accCand = 0;
+        for (size_t i = 0; i < _taps; i++) {
+            int32_t xi = win[i];
+            accBack += (uint32_t)((int32_t)(int16_t)(_weights[i] >> 16) * xi);
+            accFore += (uint32_t)((int32_t)_fore[i] * xi);
+            accCand += (uint32_t)((int32_t)_cand[i] * xi);
+        }
+        int32_t eb = d - ((int32_t)accBack >> 15);
+        int32_t y = (int32_t)accFore >> 15;
+        int32_t e = d - y;
+        int32_t ec = d - ((int32_t)accCand >> 15);
+
+        // NLMS on the background filter: w += mu * e * x / |x|^2, in Q31
+        // units per reference LSB
+        int64_t g = ((int64_t)_step * eb * 65536) / (int64_t)(_refEnergy + _regularize);
+        if (g > 65535) g = 65535;
+        if (g < -65535) g = -65535;
+        int32_t gain = (int32_t)g;
+        if (gain != 0) {
+            for (size_t i = 0; i < _taps; i++) {
+                int32_t delta = gain * win[i];
+                int32_t w;
+                if (__builtin_add_overflow(_weights[i], delta, &w)) {
+                    w = delta > 0 ? INT32_MAX : INT32_MIN;
+                }
+                _weights[i] = w;
+            }
+        }
+
+        _micEnergy += (uint64_t)(d * d);
+        _errEnergy += (uint64_t)((int64_t)e * e);
+        _candEnergy += (uint64_t)((int64_t)ec * ec);
+        _echoEnergy += (uint64_t)((int64_t)y * y);
+
+        int32_t v = e;
+        if (_suppress) {
+            _gainNow += (_gain - _gainNow) >> 6;
+            v = (int32_t)(((int64_t)e * _gainNow) >> 15);
+        }
+        out[n] = v > 32767 ? 32767 : (v < -32768 ? -32768 : (int16_t)v);
+
+        if (++_blockFill == _blockSamples) endBlock();
+    }
+}
+
+void EchoCanceller::endBlock() {
+    // The candidate is the background filter as it was at the start of
+    // this block, so it is judged on audio it has not adapted to: within a
+    // block the background can fit anything, near-end speech included.
+    // Clearly better (~2dB) and actually cancelling: promote it. Far worse
+    // (~9dB): near-end talk dragged the background off, restart it from
+    // the foreground.
+    if (_candEnergy * 3 < _errEnergy * 2 && _candEnergy < _micEnergy) {
+        memcpy(_fore, _cand, _taps * sizeof(int16_t));
+    } else if (_candEnergy > _errEnergy * 8) {
+        for (size_t i = 0; i < _taps; i++) _weights[i] = (int32_t)_fore[i] * 65536;
+    }
+    _doubleTalk = _candEnergy > _errEnergy * 2;
+    for (size_t i = 0; i < _taps; i++) _cand[i] = (int16_t)(_weights[i] >> 16);
+
+    // ERLE from blocks that are mostly echo
+    if (!_doubleTalk && _errEnergy > 0 && _echoEnergy * 2 > _micEnergy) {
+        uint64_t inst = (_micEnergy << 8) / _errEnergy;
+        if (inst > 1000 * 256) inst = 1000 * 256;   // 30dB is plenty
+        _erleQ8 += ((int32_t)inst - (int32_t)_erleQ8) / 8;
+        if (_erleQ8 < 256) _erleQ8 = 256;
+        _erleDb = (int16_t)(10.0f * log10f(_erleQ8 / 256.0f));
+    }
+
+    // Predicted residual echo over what is left after cancellation
+    int32_t gain = 32767;
+    if (_errEnergy > 0) {
+        uint64_t residual = (_echoEnergy << 8) / _erleQ8;
+        if (residual >= _errEnergy) {
+            gain = MIN_GAIN;
+        } else {
+            gain = 32767 - (int32_t)((residual << 15) / _errEnergy);
+            if (gain < MIN_GAIN) gain = MIN_GAIN;
+        }
+    }
+    _gain = gain;
+
+    _blockFill = 0;
+    _micEnergy = 0;
+    _errEnergy = 0;
+    _candEnergy = 0;
+    _echoEnergy = 0;
+}
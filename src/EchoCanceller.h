@@ -0,0 +1,90 @@
+#ifndef ECHO_CANCELLER_H
+#define ECHO_CANCELLER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Fixed-point NLMS acoustic echo canceller with residual echo suppression.
+//
+// `ref` is what the speaker played and `mic` what the microphone heard,
+// at the same rate, with the reference leading the mic by less than the
+// filter span. An adaptive FIR filter learns the speaker-to-mic path,
+// predicts the echo from the reference and subtracts it.
+//
+// Two filters run side by side. The background one adapts on every sample
+// (weights in Q31, filtering on their top 16 bits); the foreground one
+// produces the output and only takes a copy of the background weights
+// when, over a 10ms block, the copy cancels clearly better. When the near
+// end talks the background filter is thrown off but loses that
+// comparison, so the foreground keeps the learned path and the user's
+// voice passes; a background filter that wandered far off is put back to
+// the foreground. No double-talk threshold to tune against the speaker's
+// coupling. Per tap and sample: three 16x16 multiply-adds (background,
+// foreground, candidate copy) and one 32-bit update.
+//
+// What the filter cannot cancel is attenuated per 10ms block: the echo
+// estimate divided by the measured cancellation (ERLE) predicts the
+// residual, and the block is scaled down by the residual's share of it,
+// never below MIN_GAIN. Near-end speech is much louder than the residual
+// and passes almost untouched.
+class EchoCanceller {
+public:
+    EchoCanceller();
+    ~EchoCanceller();
+
+    // `taps` sets the span (taps / sampleRate); `stepQ15` is the NLMS step
+    // size mu in Q15. Returns false on allocation failure.
+    bool begin(uint32_t sampleRate, size_t taps = 256, uint16_t stepQ15 = 8192);
+
+    // Forget the echo path and all state
+    void reset();
+
+    // The streams restarted (mic and reference skipped together): drop the
+    // reference history but keep the learned echo path
+    void clearHistory();
+
+    // `out` may be `mic`
+    void process(const int16_t* mic, const int16_t* ref, int16_t* out, size_t count);
+
+    void setSuppression(bool on) { _suppress = on; }
+
+    // Echo return loss enhancement of the filter alone, in dB (smoothed)
+    int16_t erleDb() const { return _erleDb; }
+    // Last block looked like near-end talk over the echo
+    bool doubleTalk() const { return _doubleTalk; }
+    size_t taps() const { return _taps; }
+
+private:
+    EchoCanceller(const EchoCanceller&);
+    EchoCanceller& operator=(const EchoCanceller&);
+
+    static const int16_t MIN_GAIN = 4096;    // Q15, -18dB
+
+    void endBlock();
+
+    size_t _taps;
+    uint16_t _step;
+    int32_t* _weights;      // Background, Q31
+    int16_t* _fore;         // Foreground, Q15
+    int16_t* _cand;         // Background at the block start, Q15
+    int16_t* _history;      // Reference, mirrored: 2 * _taps
+    size_t _pos;
+    uint64_t _refEnergy;    // Sum of squares over the window
+    uint64_t _regularize;   // Keeps the step bounded on a silent reference
+
+    // Per block: filter comparison and residual suppression
+    bool _suppress;
+    bool _doubleTalk;
+    uint32_t _blockSamples;
+    uint32_t _blockFill;
+    uint64_t _micEnergy;
+    uint64_t _errEnergy;    // Foreground
+    uint64_t _candEnergy;   // Candidate
+    uint64_t _echoEnergy;   // Foreground estimate
+    uint32_t _erleQ8;       // Linear ERLE, Q8
+    int16_t _erleDb;
+    int32_t _gain;          // Q15, applied to the next block
+    int32_t _gainNow;       // Q15, ramps towards _gain
+};
+
+#endif
@@ -0,0 +1,223 @@
+#include "FaceAnimator.h"
+
+uint32_t faceEase(FaceEase ease, uint32_t t) {
+    if (t >= 65536) return 65536;
+    uint64_t t2 = (uint64_t)t * t;
+    switch (ease) {
+        case EASE_IN:
+            return (uint32_t)(t2 >> 16);
+        case EASE_OUT: {
+            uint64_t u = 65536 - t;
+            return 65536 - (uint32_t)((u * u) >> 16);
+        }
+        case EASE_IN_OUT:
+            // t^2 * (3 - 2t)
+            return (uint32_t)((t2 * (3 * 65536 - 2 * (uint64_t)t)) >> 32);
+        case EASE_LINEAR:
+        default:
+            return t;
+    }
+}
+
+// ============================================================
+// FaceTrack
+// ============================================================
+
+FaceTrack::FaceTrack() {
+    set(0);
+}
+
+void FaceTrack::set(int16_t value) {
+    _value = value;
+    _from = value;
+    _to = value;
+    _start = 0;
+    _duration = 0;
+    _ease = EASE_LINEAR;
+    _active = false;
+    _head = 0;
+    _count = 0;
+}
+
+int16_t FaceTrack::target() const {
+    if (_count > 0) return _queue[(_head + _count - 1) % QUEUE].value;
+    return _active ? _to : _value;
+}
+
+bool FaceTrack::push(int16_t value, uint16_t durationMs, FaceEase ease, uint32_t nowMs) {
+    if (durationMs == 0) durationMs = 1;
+    if (!_active) {
+        // At rest: start right away from where we are
+        _from = _value;
+        _to = value;
+        _start = nowMs;
+        _duration = durationMs;
+        _ease = ease;
+        _active = true;
+        return true;
+    }
+    if (_count >= QUEUE) return false;
+
+    Keyframe& k = _queue[(_head + _count) % QUEUE];
+    k.value = value;
+    k.duration = durationMs;
+    k.ease = ease;
+    _count++;
+    return true;
+}
+
+int16_t FaceTrack::update(uint32_t nowMs) {
+    // Retire finished tweens; the next keyframe starts where the last one
+    // ended, not when we happened to notice, so sequences keep their timing
+    while (_active && (int32_t)(nowMs - _start) >= (int32_t)_duration) {
+        _value = _to;
+        if (_count == 0) {
+            _active = false;
+            break;
+        }
+        const Keyframe& k = _queue[_head];
+        _head = (_head + 1) % QUEUE;
+        _count--;
+        _from = _to;
+        _to = k.value;
+        _start += _duration;
+        _duration = k.duration;
+        _ease = k.ease;
+    }
+
+    if (_active) {
+        int32_t elapsed = (int32_t)(nowMs - _start);
+        if (elapsed < 0) elapsed = 0;
+        uint32_t t = ((uint32_t)elapsed << 16) / _duration;
+        int32_t delta = (int32_t)_to - _from;
+        _value = (int16_t)(_from + (int32_t)(((int64_t)delta * faceEase(_ease, t)) >> 16));
+    }
+    return _value;
+}
+
+// ============================================================
+// FaceAnimator
+// ============================================================
+
+FaceAnimator::FaceAnimator() {
+    _pose.eyeOpen = FACE_ONE;
+    _pose.lookX = 0;
+    _pose.lookY = 0;
+    _pose.mouthOpen = 0;
+    _eyeOpen.set(FACE_ONE);
+    _frameMs = 33;
+    _deadline = 0;
+    _frames = 0;
+    _rng = 1;
+    _idle = false;
+    _speaking = false;
+    _mouthLevel = -1;
+    _nextBlink = 0;
+    _nextGlance = 0;
+}
+
+void FaceAnimator::begin(uint32_t nowMs, uint16_t frameMs, uint32_t seed) {
+    _frameMs = frameMs ? frameMs : 1;
+    _deadline = nowMs;
+    _frames = 0;
+    _rng = seed ? seed : 1;
+}
+
+uint32_t FaceAnimator::nextRandom(uint32_t lo, uint32_t hi) {
+    // xorshift32: cheap, and deterministic for host runs
+    _rng ^= _rng << 13;
+    _rng ^= _rng >> 17;
+    _rng ^= _rng << 5;
+    return lo + _rng % (hi - lo + 1);
+}
+
+bool FaceAnimator::update(uint32_t nowMs) {
+    // Wrap-safe "now < deadline"
+    if ((int32_t)(nowMs - _deadline) < 0) return false;
+
+    if (nowMs - _deadline > 1000) {
+        // Stalled: restart the clock rather than replay the backlog
+        _deadline = nowMs + _frameMs;
+    } else {
+        // Late frames are skipped, the pose is always computed for now
+        do {
+            _deadline += _frameMs;
+        } while ((int32_t)(nowMs - _deadline) >= 0);
+    }
+
+    behave(nowMs);
+
+    _pose.eyeOpen = _eyeOpen.update(nowMs);
+    _pose.lookX = _lookX.update(nowMs);
+    _pose.lookY = _lookY.update(nowMs);
+    _pose.mouthOpen = _mouth.update(nowMs);
+    _frames++;
+    return true;
+}
+
+void FaceAnimator::behave(uint32_t nowMs) {
+    if (_idle) {
+        if ((int32_t)(nowMs - _nextBlink) >= 0) {
+            blink(nowMs);
+            _nextBlink = nowMs + nextRandom(2000, 6000);
+        }
+        if ((int32_t)(nowMs - _nextGlance) >= 0) {
+            glance((int8_t)nextRandom(0, 12) - 6, (int8_t)nextRandom(0, 5) - 3,
+                   (uint16_t)nextRandom(600, 1500), nowMs);
+            _nextGlance = nowMs + nextRandom(3000, 8000);
+        }
+    }
+
+    if (_speaking && _mouthLevel >= 0) {
+        if (_mouthLevel != _mouth.target()) {
+            // Open within a frame, close over two: reads as crisp syllables
+            // without flickering on every envelope wobble
+            uint16_t ms = _mouthLevel > _mouth.update(nowMs) ? _frameMs : 2 * _frameMs;
+            setMouth(_mouthLevel, ms, nowMs);
+        }
+    } else if (_speaking && !_mouth.busy()) {
+        // One syllable: open quickly, fall back most of the way
+        _mouth.push((int16_t)nextRandom(FACE_ONE / 3, FACE_ONE), (uint16_t)nextRandom(60, 110), EASE_OUT, nowMs);
+        _mouth.push((int16_t)nextRandom(0, FACE_ONE / 4), (uint16_t)nextRandom(60, 120), EASE_IN, nowMs);
+    }
+}
+
+void FaceAnimator::setIdle(bool idle, uint32_t nowMs) {
+    if (idle && !_idle) {
+        _nextBlink = nowMs + nextRandom(1000, 3000);
+        _nextGlance = nowMs + nextRandom(2000, 5000);
+    }
+    _idle = idle;
+}
+
+void FaceAnimator::setSpeaking(bool speaking, uint32_t nowMs) {
+    if (_speaking && !speaking) {
+        // Close the mouth from wherever it is
+        _mouth.set(_mouth.update(nowMs));
+        _mouth.push(0, 80, EASE_OUT, nowMs);
+    }
+    _speaking = speaking;
+}
+
+void FaceAnimator::blink(uint32_t nowMs) {
+    if (_eyeOpen.busy()) return;
+    _eyeOpen.push(0, 60, EASE_IN, nowMs);
+    _eyeOpen.push(0, 40, EASE_LINEAR, nowMs);
+    _eyeOpen.push(FACE_ONE, 100, EASE_OUT, nowMs);
+}
+
+void FaceAnimator::glance(int8_t dx, int8_t dy, uint16_t holdMs, uint32_t nowMs) {
+    if (_lookX.busy() || _lookY.busy()) return;
+    _lookX.push(dx * FACE_ONE, 120, EASE_OUT, nowMs);
+    _lookX.push(dx * FACE_ONE, holdMs, EASE_LINEAR, nowMs);
+    _lookX.push(0, 180, EASE_IN_OUT, nowMs);
+    _lookY.push(dy * FACE_ONE, 120, EASE_OUT, nowMs);
+    _lookY.push(dy * FACE_ONE, holdMs, EASE_LINEAR, nowMs);
+    _lookY.push(0, 180, EASE_IN_OUT, nowMs);
+}
+
+void FaceAnimator::setMouth(int16_t open, uint16_t durationMs, uint32_t nowMs) {
+    // Replaces whatever the mouth was doing
+    _mouth.set(_mouth.update(nowMs));
+    _mouth.push(open, durationMs, EASE_OUT, nowMs);
+}
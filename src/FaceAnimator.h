@@ -0,0 +1,131 @@
+#ifndef FACE_ANIMATOR_H
+#define FACE_ANIMATOR_H
+
+#include <stdint.h>
+
+// Keyframed face motion: blinks, glances and a talking mouth.
+//
+// Every animated property is a Track of tweens in fixed point (Q8, so 256
+// is 1.0 or one pixel). A track holds the tween in progress plus a few
+// queued keyframes that start exactly where the previous one ends, so a
+// blink (close, hold, open) is three keyframes pushed at once.
+//
+// The animator runs on its own frame clock, not the loop rate: update()
+// reports a new pose at most once per frame period and skips frames that
+// are already late, the same way FramePackPlayer does. Per frame the work
+// is a handful of integer multiplies; nothing here touches the display.
+
+// Q8 fixed point
+#define FACE_ONE 256
+
+struct FacePose {
+    int16_t eyeOpen;    // 0 = shut, FACE_ONE = fully open
+    int16_t lookX;      // Eye offset in Q8 pixels, + is right
+    int16_t lookY;      // Eye offset in Q8 pixels, + is down
+    int16_t mouthOpen;  // 0 = no mouth, FACE_ONE = wide open
+};
+
+enum FaceEase : uint8_t {
+    EASE_LINEAR,
+    EASE_IN,        // Quadratic, starts slow
+    EASE_OUT,       // Quadratic, ends slow
+    EASE_IN_OUT     // Smoothstep
+};
+
+// Q16 progress (0..65536) through an easing curve, also in Q16
+uint32_t faceEase(FaceEase ease, uint32_t t);
+
+class FaceTrack {
+public:
+    FaceTrack();
+
+    // Jump to `value` and drop anything queued
+    void set(int16_t value);
+
+    // Queue a tween to `value` taking `durationMs`. It starts when the
+    // previous keyframe ends, or at `nowMs` if the track is at rest.
+    // Returns false when the queue is full.
+    bool push(int16_t value, uint16_t durationMs, FaceEase ease, uint32_t nowMs);
+
+    // Value at `nowMs`, advancing through finished keyframes
+    int16_t update(uint32_t nowMs);
+
+    bool busy() const { return _active || _count > 0; }
+    int16_t target() const;
+
+private:
+    struct Keyframe {
+        int16_t value;
+        uint16_t duration;
+        FaceEase ease;
+    };
+
+    static const uint8_t QUEUE = 4;
+
+    int16_t _value;
+    int16_t _from;
+    int16_t _to;
+    uint32_t _start;
+    uint16_t _duration;
+    FaceEase _ease;
+    bool _active;
+
+    Keyframe _queue[QUEUE];
+    uint8_t _head;
+    uint8_t _count;
+};
+
+class FaceAnimator {
+public:
+    FaceAnimator();
+
+    // `frameMs` is the frame period; 33ms gives 30 fps
+    void begin(uint32_t nowMs, uint16_t frameMs = 33, uint32_t seed = 1);
+
+    // Returns true when a new frame is due; read it with pose()
+    bool update(uint32_t nowMs);
+
+    const FacePose& pose() const { return _pose; }
+
+    // Idle behaviour: blinks every 2-6s, a glance every 3-8s
+    void setIdle(bool idle, uint32_t nowMs);
+
+    // Talking mouth: follows setMouthLevel(), or random syllable-sized
+    // open/close keyframes while no level is given
+    void setSpeaking(bool speaking, uint32_t nowMs);
+
+    // Mouth openness to follow while speaking (e.g. AudioEnvelope::level()),
+    // 0..FACE_ONE; negative means no audio, babble instead
+    void setMouthLevel(int16_t level) { _mouthLevel = level; }
+
+    // One-shot motions (also used by the idle and speaking behaviours)
+    void blink(uint32_t nowMs);
+    void glance(int8_t dx, int8_t dy, uint16_t holdMs, uint32_t nowMs);
+    void setMouth(int16_t open, uint16_t durationMs, uint32_t nowMs);
+
+    uint32_t nextDeadline() const { return _deadline; }
+    uint32_t frameCount() const { return _frames; }
+
+private:
+    uint32_t nextRandom(uint32_t lo, uint32_t hi);
+    void behave(uint32_t nowMs);
+
+    FaceTrack _eyeOpen;
+    FaceTrack _lookX;
+    FaceTrack _lookY;
+    FaceTrack _mouth;
+    FacePose _pose;
+
+    uint16_t _frameMs;
+    uint32_t _deadline;
+    uint32_t _frames;
+    uint32_t _rng;
+
+    bool _idle;
+    bool _speaking;
+    int16_t _mouthLevel;
+    uint32_t _nextBlink;
+    uint32_t _nextGlance;
+};
+
+#endif
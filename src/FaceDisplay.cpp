@@ -1,75 +1,36 @@
 #include "FaceDisplay.h"
-#include <Adafruit_GFX.h>
+#include <string.h>
+
+// Built by the compiler; the arrays land in flash, nothing is drawn at runtime
+static constexpr sprites::Sprite kIdleOpen = sprites::idleFace(true);
+static constexpr sprites::Sprite kIdleClosed = sprites::idleFace(false);
+static constexpr sprites::Sprite kListening = sprites::listeningFace();
+static constexpr sprites::Sprite kWaiting = sprites::waitingFace();
+static constexpr sprites::Sprite kSmile = sprites::smileFace();
 
 void FaceDisplay::begin() {
     display.begin(SSD1306_SWITCHCAPVCC, 0x3C);
+    bus.begin();
     display.clearDisplay();
-    display.display();
+    // From here on only the display task touches the I2C bus
+    service.begin(&bus);
+    flush();
 }
 
-void FaceDisplay::drawIdle(bool eyeOpen) {
-    display.clearDisplay();
-
-    int eyeY = 25;
-    int eyeX1 = 35;
-    int eyeX2 = 93;
-    int eyeWidth = 14;
-    int eyeHeight = 22;
-
-    if(eyeOpen) {
-        display.fillRoundRect(eyeX1 - eyeWidth/2, eyeY - eyeHeight/2, eyeWidth, eyeHeight, 5, WHITE);
-        display.fillRoundRect(eyeX2 - eyeWidth/2, eyeY - eyeHeight/2, eyeWidth, eyeHeight, 5, WHITE);
-    } else {
-        display.drawLine(eyeX1 - 10, eyeY, eyeX1 + 10, eyeY, WHITE);
-        display.drawLine(eyeX2 - 10, eyeY, eyeX2 + 10, eyeY, WHITE);
-    }
-
-    display.fillTriangle(63, 40, 65, 40, 64, 42, WHITE);
+void FaceDisplay::flush() {
+    service.submit(display.getBuffer());
+}
 
-    display.display();
+void FaceDisplay::drawIdle(bool eyeOpen) {
+    show(eyeOpen ? EXPR_IDLE_OPEN : EXPR_IDLE_CLOSED);
 }
 
 void FaceDisplay::drawListening() {
-    display.clearDisplay();
-    
-    // Draw big open eyes or question mark?
-    // Let's draw bigger eyes for listening
-    int eyeY = 25;
-    int eyeX1 = 35;
-    int eyeX2 = 93;
-    int eyeRadius = 12;
-
-    display.fillCircle(eyeX1, eyeY, eyeRadius, WHITE);
-    display.fillCircle(eyeX2, eyeY, eyeRadius, WHITE);
-
-    // Small nose
-    display.fillTriangle(63, 40, 65, 40, 64, 42, WHITE);
-
-    display.display();
+    show(EXPR_LISTENING);
 }
 
 void FaceDisplay::drawWaiting() {
-    display.clearDisplay();
-    
-    // Thinking expression: Eyes looking up/side, or maybe "..."
-    int eyeY = 25;
-    int eyeX1 = 35;
-    int eyeX2 = 93;
-    int eyeRadius = 10;
-
-    // Eyes looked up
-    display.fillCircle(eyeX1, eyeY - 5, eyeRadius, WHITE);
-    display.fillCircle(eyeX2, eyeY - 5, eyeRadius, WHITE);
-
-    // Small nose
-    display.fillTriangle(63, 40, 65, 40, 64, 42, WHITE);
-
-    // Thinking dots
-    display.fillCircle(10, 10, 2, WHITE);
-    display.fillCircle(18, 5, 3, WHITE);
-    display.fillCircle(28, 2, 4, WHITE);
-
-    display.display();
+    show(EXPR_WAITING);
 }
 
 void FaceDisplay::drawSpeaking() {
@@ -77,52 +38,79 @@ void FaceDisplay::drawSpeaking() {
 }
 
 void FaceDisplay::drawSmile() {
-    display.clearDisplay();
+    show(EXPR_SMILE);
+}
 
-    int eyeY = 25;
-    int leftEyeX = 35;
-    int rightEyeX = 93;
-    int eyeWidth = 10;
-    int eyeHeight = 5;
-    int tilt = 2;
-
-    for (int yOffset = 0; yOffset <= 2; yOffset++) {
-        for (int x = -eyeWidth; x <= eyeWidth; x++) {
-            float y = -eyeHeight * sqrt(1.0 - sq((float)x / eyeWidth)) + yOffset;
-            y += (x > 0) ? -tilt : 0;
-            display.drawPixel(leftEyeX + x, eyeY + y, WHITE);
-        }
-    }
-    for (int yOffset = 0; yOffset <= 2; yOffset++) {
-        for (int x = -eyeWidth; x <= eyeWidth; x++) {
-            float y = -eyeHeight * sqrt(1.0 - sq((float)x / eyeWidth)) + yOffset;
-            y += (x < 0) ? -tilt : 0;
-            display.drawPixel(rightEyeX + x, eyeY + y, WHITE);
-        }
+void FaceDisplay::redraw() {
+    _shown = EXPR_NONE;
+    _animated = false;
+}
+
+void FaceDisplay::show(Expression expr) {
+    // Same face as on screen: nothing to draw, nothing to send
+    if (expr == _shown) return;
+
+    const uint8_t* sprite;
+    switch (expr) {
+        case EXPR_IDLE_OPEN:   sprite = kIdleOpen.buf;   break;
+        case EXPR_IDLE_CLOSED: sprite = kIdleClosed.buf; break;
+        case EXPR_LISTENING:   sprite = kListening.buf;  break;
+        case EXPR_WAITING:     sprite = kWaiting.buf;    break;
+        case EXPR_SMILE:       sprite = kSmile.buf;      break;
+        default:               return;
     }
 
-    display.fillTriangle(63, 40, 65, 40, 64, 42, WHITE);
+    service.submit(sprite);
+    _shown = expr;
+    _animated = false;
+}
 
-    int mouthCenterX = 64;
-    int mouthCenterY = 46;
-    int mouthRadiusX = 18;
-    int mouthRadiusY = 6;
+// Q8 to the nearest pixel
+static int16_t toPixels(int32_t q8, int32_t scale) {
+    return (int16_t)((q8 * scale + FACE_ONE / 2) >> 8);
+}
 
-    for (int i = -mouthRadiusX; i <= mouthRadiusX; i++) {
-        float y = mouthRadiusY * sqrt(1.0 - sq((float)i / mouthRadiusX));
-        display.drawPixel(mouthCenterX + i, mouthCenterY + y, WHITE);
+void FaceDisplay::drawAnimated(const FacePose& pose) {
+    const sprites::EyePair eyes = sprites::DEFAULT_EYES;
+    const int eyeWidth = 14;
+    const int eyeHeight = 22;
+    const int mouthWidth = 18;
+    const int mouthHeight = 9;
+
+    // Quantize first: sub-pixel motion that does not move a pixel costs nothing
+    FacePose px;
+    px.eyeOpen = toPixels(pose.eyeOpen, eyeHeight);
+    px.lookX = toPixels(pose.lookX, 1);
+    px.lookY = toPixels(pose.lookY, 1);
+    px.mouthOpen = pose.mouthOpen > 0 ? toPixels(pose.mouthOpen, mouthHeight) + 1 : 0;
+    if (_animated && memcmp(&px, &_drawn, sizeof(px)) == 0) return;
+
+    _canvas.clear();
+
+    int eyeY = eyes.y + px.lookY;
+    int leftX = eyes.leftX + px.lookX;
+    int rightX = eyes.rightX + px.lookX;
+    if (px.eyeOpen <= 2) {
+        // Shut: the same flat line as the closed idle face
+        _canvas.line(leftX - 10, eyeY, leftX + 10, eyeY);
+        _canvas.line(rightX - 10, eyeY, rightX + 10, eyeY);
+    } else {
+        int h = px.eyeOpen;
+        int r = h / 2 < 5 ? h / 2 : 5;
+        _canvas.fillRoundRect(leftX - eyeWidth / 2, eyeY - h / 2, eyeWidth, h, r);
+        _canvas.fillRoundRect(rightX - eyeWidth / 2, eyeY - h / 2, eyeWidth, h, r);
     }
 
-    int teethOffset = 4;
-    display.drawLine(mouthCenterX - 18, mouthCenterY + 1 + teethOffset,
-                     mouthCenterX - 15, mouthCenterY + 6 + teethOffset, WHITE);
-    display.drawLine(mouthCenterX - 15, mouthCenterY + 6 + teethOffset,
-                     mouthCenterX - 12, mouthCenterY + 1 + teethOffset, WHITE);
+    sprites::nose(_canvas);
 
-    display.drawLine(mouthCenterX + 18, mouthCenterY + 1 + teethOffset,
-                     mouthCenterX + 15, mouthCenterY + 6 + teethOffset, WHITE);
-    display.drawLine(mouthCenterX + 15, mouthCenterY + 6 + teethOffset,
-                     mouthCenterX - 12, mouthCenterY + 1 + teethOffset, WHITE);
+    if (px.mouthOpen > 0) {
+        int h = px.mouthOpen;
+        int r = h / 2 < 4 ? h / 2 : 4;
+        _canvas.fillRoundRect(64 - mouthWidth / 2, 46, mouthWidth, h, r);
+    }
 
-    display.display();
+    service.submit(_canvas.buf);
+    _drawn = px;
+    _animated = true;
+    _shown = EXPR_NONE;
 }
@@ -2,7 +2,14 @@
 #define FACE_DISPLAY_H
 
 #include <Adafruit_SSD1306.h>
+#include "OledFlush.h"
+#include "DisplayService.h"
+#include "FaceSprites.h"
+#include "FaceAnimator.h"
 
+// Expressions are rasterized at compile time (FaceSprites.h) into frames in
+// flash; a draw call is a no-op while the face is unchanged, and a single
+// copy when it changes.
 class FaceDisplay {
 public:
     void begin();
@@ -12,8 +19,36 @@ public:
     void drawSpeaking();
     void drawSmile();
 
+    // Procedural face for FaceAnimator poses. Skips the draw when the pose
+    // lands on the same pixels as the frame already on screen.
+    void drawAnimated(const FacePose& pose);
+
+    // Forget what is on screen so the next draw call sends it again
+    void redraw();
+
 private:
+    enum Expression : uint8_t {
+        EXPR_IDLE_OPEN,
+        EXPR_IDLE_CLOSED,
+        EXPR_LISTENING,
+        EXPR_WAITING,
+        EXPR_SMILE,
+        EXPR_COUNT,
+        EXPR_NONE = EXPR_COUNT
+    };
+
+    void show(Expression expr);
+    void flush(); // Hand the frame to the display task; never waits on I2C
+
     Adafruit_SSD1306 display = Adafruit_SSD1306(128, 64, &Wire, -1);
+    WireOledBus bus = WireOledBus(&Wire, 0x3C);
+    DisplayService service;
+
+    Expression _shown = EXPR_NONE;
+
+    sprites::Sprite _canvas;
+    FacePose _drawn;        // Pose on screen, in whole pixels
+    bool _animated = false; // _drawn is valid
 };
 
 #endif
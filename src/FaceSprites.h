@@ -0,0 +1,314 @@
+#ifndef FACE_SPRITES_H
+#define FACE_SPRITES_H
+
+#include <stdint.h>
+#include "OledFlush.h"
+
+// Compile-time rasterizer for the face expressions.
+//
+// The primitives reproduce Adafruit_GFX's integer algorithms (Bresenham
+// lines, midpoint circles, the rounded-rect corner helper and the scanline
+// triangle fill) and the SSD1306 page layout, so a sprite built here is
+// pixel-identical to drawing the same shapes at runtime. Everything is
+// constexpr: the expressions end up as finished frames in flash and drawing
+// a face is a copy.
+
+namespace sprites {
+
+// v - x*x without rounding error (Dekker's exact product, no FMA needed)
+constexpr double sqrtResidual(double v, double x) {
+    double c = 134217729.0 * x;  // 2^27 + 1
+    double hi = c - (c - x);
+    double lo = x - hi;
+    double p = x * x;
+    double err = ((hi * hi - p) + 2 * hi * lo) + lo * lo;
+    return (v - p) - err;
+}
+
+// Correctly rounded square root, same result as the libm sqrt() the
+// runtime code used. Newton from above, then pick whichever neighbour
+// leaves the smallest exact residual.
+constexpr double csqrt(double v) {
+    if (v <= 0) return 0;
+    double x = v > 1 ? v : 1;
+    for (int i = 0; i < 100; i++) {
+        double next = 0.5 * (x + v / x);
+        if (next >= x) break;
+        x = next;
+    }
+
+    double binade = 1;
+    while (binade > x) binade /= 2;
+    while (binade * 2 <= x) binade *= 2;
+    double ulp = binade / 4503599627370496.0;  // 2^52
+
+    double best = x;
+    double bestErr = sqrtResidual(v, x);
+    if (bestErr < 0) bestErr = -bestErr;
+    const double candidates[2] = { x - ulp, x + ulp };
+    for (double c : candidates) {
+        double e = sqrtResidual(v, c);
+        if (e < 0) e = -e;
+        if (e < bestErr) {
+            best = c;
+            bestErr = e;
+        }
+    }
+    return best;
+}
+
+struct Sprite {
+    uint8_t buf[OLED_BUFFER_SIZE];
+
+    constexpr Sprite() : buf() {}
+
+    constexpr void clear() {
+        for (int i = 0; i < OLED_BUFFER_SIZE; i++) buf[i] = 0;
+    }
+
+    constexpr void pixel(int x, int y) {
+        if (x >= 0 && x < OLED_WIDTH && y >= 0 && y < OLED_HEIGHT) {
+            buf[x + (y / 8) * OLED_WIDTH] |= (uint8_t)(1 << (y & 7));
+        }
+    }
+
+    constexpr void vline(int x, int y, int h) {
+        for (int i = 0; i < h; i++) pixel(x, y + i);
+    }
+
+    constexpr void hline(int x, int y, int w) {
+        for (int i = 0; i < w; i++) pixel(x + i, y);
+    }
+
+    constexpr void fillRect(int x, int y, int w, int h) {
+        for (int i = x; i < x + w; i++) vline(i, y, h);
+    }
+
+    // Adafruit_GFX::drawLine / writeLine
+    constexpr void line(int x0, int y0, int x1, int y1) {
+        if (x0 == x1) {
+            if (y0 > y1) { int t = y0; y0 = y1; y1 = t; }
+            vline(x0, y0, y1 - y0 + 1);
+            return;
+        }
+        if (y0 == y1) {
+            if (x0 > x1) { int t = x0; x0 = x1; x1 = t; }
+            hline(x0, y0, x1 - x0 + 1);
+            return;
+        }
+
+        bool steep = (y1 > y0 ? y1 - y0 : y0 - y1) > (x1 > x0 ? x1 - x0 : x0 - x1);
+        if (steep) {
+            int t = x0; x0 = y0; y0 = t;
+            t = x1; x1 = y1; y1 = t;
+        }
+        if (x0 > x1) {
+            int t = x0; x0 = x1; x1 = t;
+            t = y0; y0 = y1; y1 = t;
+        }
+
+        int dx = x1 - x0;
+        int dy = y1 > y0 ? y1 - y0 : y0 - y1;
+        int err = dx / 2;
+        int ystep = y0 < y1 ? 1 : -1;
+
+        for (; x0 <= x1; x0++) {
+            if (steep) pixel(y0, x0);
+            else pixel(x0, y0);
+            err -= dy;
+            if (err < 0) {
+                y0 += ystep;
+                err += dx;
+            }
+        }
+    }
+
+    // Adafruit_GFX::fillCircleHelper
+    constexpr void fillCircleHelper(int x0, int y0, int r, int corners, int delta) {
+        int f = 1 - r;
+        int ddF_x = 1;
+        int ddF_y = -2 * r;
+        int x = 0;
+        int y = r;
+        int px = x;
+        int py = y;
+
+        delta++;
+        while (x < y) {
+            if (f >= 0) {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+            if (x < (y + 1)) {
+                if (corners & 1) vline(x0 + x, y0 - y, 2 * y + delta);
+                if (corners & 2) vline(x0 - x, y0 - y, 2 * y + delta);
+            }
+            if (y != py) {
+                if (corners & 1) vline(x0 + py, y0 - px, 2 * px + delta);
+                if (corners & 2) vline(x0 - py, y0 - px, 2 * px + delta);
+                py = y;
+            }
+            px = x;
+        }
+    }
+
+    constexpr void fillCircle(int x0, int y0, int r) {
+        vline(x0, y0 - r, 2 * r + 1);
+        fillCircleHelper(x0, y0, r, 3, 0);
+    }
+
+    constexpr void fillRoundRect(int x, int y, int w, int h, int r) {
+        int maxRadius = ((w < h) ? w : h) / 2;
+        if (r > maxRadius) r = maxRadius;
+        fillRect(x + r, y, w - 2 * r, h);
+        fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1);
+        fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1);
+    }
+
+    // Adafruit_GFX::fillTriangle
+    constexpr void fillTriangle(int x0, int y0, int x1, int y1, int x2, int y2) {
+        if (y0 > y1) { int t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
+        if (y1 > y2) { int t = y2; y2 = y1; y1 = t; t = x2; x2 = x1; x1 = t; }
+        if (y0 > y1) { int t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
+
+        if (y0 == y2) {
+            int a = x0, b = x0;
+            if (x1 < a) a = x1; else if (x1 > b) b = x1;
+            if (x2 < a) a = x2; else if (x2 > b) b = x2;
+            hline(a, y0, b - a + 1);
+            return;
+        }
+
+        int dx01 = x1 - x0, dy01 = y1 - y0;
+        int dx02 = x2 - x0, dy02 = y2 - y0;
+        int dx12 = x2 - x1, dy12 = y2 - y1;
+        int32_t sa = 0, sb = 0;
+        int last = (y1 == y2) ? y1 : y1 - 1;
+        int y = y0;
+
+        for (; y <= last; y++) {
+            int a = x0 + sa / dy01;
+            int b = x0 + sb / dy02;
+            sa += dx01;
+            sb += dx02;
+            if (a > b) { int t = a; a = b; b = t; }
+            hline(a, y, b - a + 1);
+        }
+
+        sa = (int32_t)dx12 * (y - y1);
+        sb = (int32_t)dx02 * (y - y0);
+        for (; y <= y2; y++) {
+            int a = x1 + sa / dy12;
+            int b = x0 + sb / dy02;
+            sa += dx12;
+            sb += dx02;
+            if (a > b) { int t = a; a = b; b = t; }
+            hline(a, y, b - a + 1);
+        }
+    }
+};
+
+struct EyePair {
+    int leftX;
+    int rightX;
+    int y;
+};
+
+constexpr EyePair DEFAULT_EYES = { 35, 93, 25 };
+
+constexpr void nose(Sprite& s) {
+    s.fillTriangle(63, 40, 65, 40, 64, 42);
+}
+
+// Rounded-rect eyes, or flat lines when closed
+constexpr Sprite idleFace(bool eyeOpen, EyePair eyes = DEFAULT_EYES,
+                          int eyeWidth = 14, int eyeHeight = 22, int cornerRadius = 5) {
+    Sprite s;
+    if (eyeOpen) {
+        s.fillRoundRect(eyes.leftX - eyeWidth / 2, eyes.y - eyeHeight / 2, eyeWidth, eyeHeight, cornerRadius);
+        s.fillRoundRect(eyes.rightX - eyeWidth / 2, eyes.y - eyeHeight / 2, eyeWidth, eyeHeight, cornerRadius);
+    } else {
+        s.line(eyes.leftX - 10, eyes.y, eyes.leftX + 10, eyes.y);
+        s.line(eyes.rightX - 10, eyes.y, eyes.rightX + 10, eyes.y);
+    }
+    nose(s);
+    return s;
+}
+
+// Big round eyes
+constexpr Sprite listeningFace(EyePair eyes = DEFAULT_EYES, int eyeRadius = 12) {
+    Sprite s;
+    s.fillCircle(eyes.leftX, eyes.y, eyeRadius);
+    s.fillCircle(eyes.rightX, eyes.y, eyeRadius);
+    nose(s);
+    return s;
+}
+
+// Eyes looking up, thinking dots in the corner
+constexpr Sprite waitingFace(EyePair eyes = DEFAULT_EYES, int eyeRadius = 10, int lookUp = 5) {
+    Sprite s;
+    s.fillCircle(eyes.leftX, eyes.y - lookUp, eyeRadius);
+    s.fillCircle(eyes.rightX, eyes.y - lookUp, eyeRadius);
+    nose(s);
+    s.fillCircle(10, 10, 2);
+    s.fillCircle(18, 5, 3);
+    s.fillCircle(28, 2, 4);
+    return s;
+}
+
+// Arched happy eyes tilted outwards, open smile with teeth. The float
+// arithmetic mirrors the original runtime code step for step (float
+// division, double sqrt, float result truncated to a pixel) so the
+// rounding, and therefore every pixel, is the same.
+constexpr Sprite smileFace(EyePair eyes = DEFAULT_EYES, int eyeWidth = 10, int eyeHeight = 5, int tilt = 2) {
+    Sprite s;
+
+    for (int yOffset = 0; yOffset <= 2; yOffset++) {
+        for (int x = -eyeWidth; x <= eyeWidth; x++) {
+            float r = (float)x / eyeWidth;
+            float y = -eyeHeight * csqrt(1.0 - r * r) + yOffset;
+            y += (x > 0) ? -tilt : 0;
+            s.pixel(eyes.leftX + x, (int16_t)(eyes.y + y));
+        }
+    }
+    for (int yOffset = 0; yOffset <= 2; yOffset++) {
+        for (int x = -eyeWidth; x <= eyeWidth; x++) {
+            float r = (float)x / eyeWidth;
+            float y = -eyeHeight * csqrt(1.0 - r * r) + yOffset;
+            y += (x < 0) ? -tilt : 0;
+            s.pixel(eyes.rightX + x, (int16_t)(eyes.y + y));
+        }
+    }
+
+    nose(s);
+
+    const int mouthCenterX = 64;
+    const int mouthCenterY = 46;
+    const int mouthRadiusX = 18;
+    const int mouthRadiusY = 6;
+
+    for (int i = -mouthRadiusX; i <= mouthRadiusX; i++) {
+        float r = (float)i / mouthRadiusX;
+        float y = mouthRadiusY * csqrt(1.0 - r * r);
+        s.pixel(mouthCenterX + i, (int16_t)(mouthCenterY + y));
+    }
+
+    const int teethOffset = 4;
+    s.line(mouthCenterX - 18, mouthCenterY + 1 + teethOffset,
+           mouthCenterX - 15, mouthCenterY + 6 + teethOffset);
+    s.line(mouthCenterX - 15, mouthCenterY + 6 + teethOffset,
+           mouthCenterX - 12, mouthCenterY + 1 + teethOffset);
+    s.line(mouthCenterX + 18, mouthCenterY + 1 + teethOffset,
+           mouthCenterX + 15, mouthCenterY + 6 + teethOffset);
+    s.line(mouthCenterX + 15, mouthCenterY + 6 + teethOffset,
+           mouthCenterX - 12, mouthCenterY + 1 + teethOffset);
+    return s;
+}
+
+} // namespace sprites
+
+#endif
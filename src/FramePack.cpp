@@ -0,0 +1,156 @@
+#include "FramePack.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+// Host build: flash is plain memory.
+#define pgm_read_byte(addr)  (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#endif
+
+FramePackDecoder::FramePackDecoder() {
+    _pack = NULL;
+    _buffer = NULL;
+    _current = 0;
+    _valid = false;
+}
+
+void FramePackDecoder::begin(const FramePack* pack, uint8_t* frameBuffer) {
+    _pack = pack;
+    _buffer = frameBuffer;
+    _current = 0;
+    _valid = false;
+}
+
+bool FramePackDecoder::decode(uint16_t index) {
+    if (_pack == NULL || _buffer == NULL || index >= _pack->frameCount) return false;
+
+    // Already on screen
+    if (_valid && index == _current) return true;
+
+    // Next frame in sequence: the buffer already holds the delta base
+    if (_valid && index == _current + 1) {
+        return decodeBlob(index);
+    }
+
+    // Seek: walk back to the nearest key frame, then replay forward
+    uint16_t start = index;
+    while (start > 0 && pgm_read_byte(_pack->data + pgm_read_dword(&_pack->offsets[start])) != FRAME_KEY) {
+        start--;
+    }
+    for (uint16_t i = start; i <= index; i++) {
+        if (!decodeBlob(i)) return false;
+    }
+    return true;
+}
+
+bool FramePackDecoder::next() {
+    if (_pack == NULL || _pack->frameCount == 0) return false;
+    if (!_valid) return decode(0);
+    uint16_t index = _current + 1;
+    if (index >= _pack->frameCount) index = 0;
+    return decode(index);
+}
+
+uint16_t FramePackDecoder::frameDuration(uint16_t index) const {
+    if (_pack == NULL || _pack->durations == NULL || index >= _pack->frameCount) return 0;
+    return pgm_read_word(&_pack->durations[index]);
+}
+
+bool FramePackDecoder::decodeBlob(uint16_t index) {
+    const uint8_t* src = _pack->data + pgm_read_dword(&_pack->offsets[index]);
+    uint8_t type = pgm_read_byte(src++);
+    size_t total = frameBytes(*_pack);
+    size_t pos = 0;
+
+    if (type == FRAME_KEY) {
+        while (pos < total) {
+            uint8_t c = pgm_read_byte(src++);
+            if (c < 0x80) {
+                size_t n = c + 1;
+                if (pos + n > total) break;
+                while (n--) _buffer[pos++] = pgm_read_byte(src++);
+            } else {
+                size_t n = c - 0x80 + 3;
+                if (pos + n > total) break;
+                uint8_t v = pgm_read_byte(src++);
+                while (n--) _buffer[pos++] = v;
+            }
+        }
+    } else if (type == FRAME_DELTA) {
+        while (pos < total) {
+            uint8_t c = pgm_read_byte(src++);
+            if (c < 0x80) {
+                size_t n = c + 1;
+                if (pos + n > total) break;
+                while (n--) _buffer[pos++] ^= pgm_read_byte(src++);
+            } else {
+                size_t n = c - 0x80 + 3;
+                if (pos + n > total) break;
+                uint8_t v = pgm_read_byte(src++);
+                // XOR with zero is the common case: just skip ahead
+                if (v == 0) {
+                    pos += n;
+                } else {
+                    while (n--) _buffer[pos++] ^= v;
+                }
+            }
+        }
+    } else {
+        _valid = false;
+        return false;
+    }
+
+    if (pos != total) {
+        _valid = false;
+        return false;
+    }
+    _current = index;
+    _valid = true;
+    return true;
+}
+
+FramePackPlayer::FramePackPlayer() {
+    _defaultDuration = 100;
+    _deadline = 0;
+    _started = false;
+}
+
+void FramePackPlayer::begin(const FramePack* pack, uint8_t* frameBuffer, uint16_t defaultDuration) {
+    _decoder.begin(pack, frameBuffer);
+    _defaultDuration = defaultDuration ? defaultDuration : 1;
+    _deadline = 0;
+    _started = false;
+}
+
+uint16_t FramePackPlayer::durationOf(uint16_t index) const {
+    uint16_t d = _decoder.frameDuration(index);
+    return d ? d : _defaultDuration;
+}
+
+bool FramePackPlayer::update(uint32_t nowMs) {
+    if (!_started) {
+        if (!_decoder.decode(0)) return false;
+        _started = true;
+        _deadline = nowMs + durationOf(0);
+        return true;
+    }
+
+    // Wrap-safe "now < deadline"
+    if ((int32_t)(nowMs - _deadline) < 0) return false;
+
+    // Stalled for a long time (e.g. blocked elsewhere): restart the clock
+    // instead of fast-forwarding through the whole backlog
+    if (nowMs - _deadline > 1000) {
+        if (!_decoder.next()) return false;
+        _deadline = nowMs + durationOf(_decoder.frameIndex());
+        return true;
+    }
+
+    do {
+        if (!_decoder.next()) return false;
+        _deadline += durationOf(_decoder.frameIndex());
+    } while ((int32_t)(nowMs - _deadline) >= 0);
+    return true;
+}
@@ -0,0 +1,108 @@
+#ifndef FRAME_PACK_H
+#define FRAME_PACK_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Compressed animation clip stored in flash.
+//
+// Every frame is a small blob inside `data`, located by `offsets[i]`:
+//   byte 0   : frame type (FRAME_KEY or FRAME_DELTA)
+//   byte 1.. : RLE stream that expands to exactly frameBytes() bytes
+//
+// FRAME_KEY blobs expand to the frame itself. FRAME_DELTA blobs expand to the
+// XOR of the frame with the previous one, which for GIF clips is almost all
+// zeros and packs down to a few tokens.
+//
+// RLE tokens:
+//   0x00..0x7F : copy the next (c + 1) bytes literally      (1..128)
+//   0x80..0xFF : repeat the next byte (c - 0x80 + 3) times  (3..130)
+//
+// Frame 0 is always a key frame so a clip can loop without extra state.
+//
+// Frames are either in image2cpp row order (8 horizontal pixels per byte,
+// MSB first, drawn with drawBitmap) or in SSD1306 page order (8 vertical
+// pixels per byte, LSB on top, 128 bytes per page), which can be decoded
+// straight into the display buffer with no per-pixel conversion.
+
+enum FrameType : uint8_t {
+    FRAME_KEY   = 0,
+    FRAME_DELTA = 1
+};
+
+enum FrameLayout : uint8_t {
+    FRAME_LAYOUT_ROWS  = 0,
+    FRAME_LAYOUT_PAGES = 1
+};
+
+struct FramePack {
+    uint16_t width;
+    uint16_t height;
+    uint16_t frameCount;
+    const uint32_t* offsets;   // PROGMEM, frameCount entries
+    const uint8_t* data;       // PROGMEM
+    const uint16_t* durations; // PROGMEM, ms per frame, or NULL if the clip has none
+    uint8_t layout;            // FrameLayout
+};
+
+class FramePackDecoder {
+public:
+    FramePackDecoder();
+
+    // `frameBuffer` must hold frameBytes(pack) bytes and is kept between
+    // calls, since delta frames are applied on top of the previous frame.
+    void begin(const FramePack* pack, uint8_t* frameBuffer);
+
+    // Decode frame `index` into the frame buffer. Sequential playback costs
+    // one blob per frame; seeking replays from the nearest key frame.
+    bool decode(uint16_t index);
+
+    // Decode the frame after the current one, wrapping at the end.
+    bool next();
+
+    // Display time of a frame in ms, or 0 if the clip carries no timing.
+    uint16_t frameDuration(uint16_t index) const;
+
+    uint16_t frameIndex() const { return _current; }
+    uint16_t frameCount() const { return _pack ? _pack->frameCount : 0; }
+
+    static size_t frameBytes(const FramePack& pack) {
+        return (size_t)pack.width * pack.height / 8;
+    }
+
+private:
+    bool decodeBlob(uint16_t index);
+
+    const FramePack* _pack;
+    uint8_t* _buffer;
+    uint16_t _current;
+    bool _valid;
+};
+
+// Plays a pack against a monotonic millisecond clock. Each deadline is the
+// previous deadline plus that frame's duration, so time spent drawing and
+// pushing the frame to the display does not accumulate into the timing.
+class FramePackPlayer {
+public:
+    FramePackPlayer();
+
+    // `defaultDuration` is used for packs without a durations table
+    void begin(const FramePack* pack, uint8_t* frameBuffer, uint16_t defaultDuration = 100);
+
+    // Returns true when a new frame was decoded and should be shown.
+    // If playback fell behind, frames that are already over are skipped.
+    bool update(uint32_t nowMs);
+
+    uint32_t nextDeadline() const { return _deadline; }
+    uint16_t frameIndex() const { return _decoder.frameIndex(); }
+
+private:
+    uint16_t durationOf(uint16_t index) const;
+
+    FramePackDecoder _decoder;
+    uint16_t _defaultDuration;
+    uint32_t _deadline;
+    bool _started;
+};
+
+#endif
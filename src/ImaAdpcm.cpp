@@ -0,0 +1,119 @@
+#include "ImaAdpcm.h"
+
+static const int16_t STEP_TABLE[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t INDEX_TABLE[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+// Shared by encoder and decoder so both track the same predictor
+static inline void step(int16_t& predictor, uint8_t& index, uint8_t code) {
+    int32_t s = STEP_TABLE[index];
+    int32_t diff = s >> 3;
+    if (code & 4) diff += s;
+    if (code & 2) diff += s >> 1;
+    if (code & 1) diff += s >> 2;
+
+    int32_t p = predictor + ((code & 8) ? -diff : diff);
+    if (p > 32767) p = 32767;
+    if (p < -32768) p = -32768;
+    predictor = (int16_t)p;
+
+    int32_t i = index + INDEX_TABLE[code & 7];
+    if (i < 0) i = 0;
+    if (i > 88) i = 88;
+    index = (uint8_t)i;
+}
+
+ImaAdpcmEncoder::ImaAdpcmEncoder() {
+    reset();
+}
+
+void ImaAdpcmEncoder::reset() {
+    _predictor = 0;
+    _index = 0;
+}
+
+uint8_t ImaAdpcmEncoder::encodeSample(int16_t sample) {
+    int32_t diff = (int32_t)sample - _predictor;
+    uint8_t code = 0;
+    if (diff < 0) {
+        code = 8;
+        diff = -diff;
+    }
+
+    // Successive approximation of diff / step in three bits
+    int32_t s = STEP_TABLE[_index];
+    if (diff >= s) { code |= 4; diff -= s; }
+    s >>= 1;
+    if (diff >= s) { code |= 2; diff -= s; }
+    s >>= 1;
+    if (diff >= s) { code |= 1; }
+
+    step(_predictor, _index, code);
+    return code;
+}
+
+size_t ImaAdpcmEncoder::encodeBlock(const int16_t* pcm, size_t count, uint8_t* out) {
+    out[0] = (uint8_t)(_predictor & 0xFF);
+    out[1] = (uint8_t)((uint16_t)_predictor >> 8);
+    out[2] = _index;
+    out[3] = 0;
+    if (count == 0) return 4;
+
+    uint8_t* p = out + 4;
+    for (size_t i = 0; i < count; i += 2) {
+        uint8_t lo = encodeSample(pcm[i]);
+        uint8_t hi = encodeSample(i + 1 < count ? pcm[i + 1] : pcm[i]);
+        *p++ = (uint8_t)(lo | (hi << 4));
+    }
+    return p - out;
+}
+
+ImaAdpcmDecoder::ImaAdpcmDecoder() {
+    _data = NULL;
+    _end = NULL;
+    _highNibble = false;
+    _predictor = 0;
+    _index = 0;
+}
+
+bool ImaAdpcmDecoder::begin(const uint8_t* block, size_t length) {
+    _data = _end = NULL;
+    if (length <= 4 || block[2] > 88) return false;
+
+    _predictor = (int16_t)(block[0] | (block[1] << 8));
+    _index = block[2];
+    _data = block + 4;
+    _end = block + length;
+    _highNibble = false;
+    return true;
+}
+
+size_t ImaAdpcmDecoder::read(int16_t* out, size_t maxSamples) {
+    size_t n = 0;
+    while (n < maxSamples && _data < _end) {
+        if (_highNibble) {
+            step(_predictor, _index, *_data++ >> 4);
+        } else {
+            step(_predictor, _index, *_data & 0x0F);
+        }
+        _highNibble = !_highNibble;
+        out[n++] = _predictor;
+    }
+    return n;
+}
+
+size_t ImaAdpcmDecoder::decodeBlock(const uint8_t* block, size_t length, int16_t* out) {
+    ImaAdpcmDecoder decoder;
+    if (!decoder.begin(block, length)) return 0;
+    return decoder.read(out, blockSamples(length));
+}
@@ -0,0 +1,63 @@
+#ifndef IMA_ADPCM_H
+#define IMA_ADPCM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// IMA-ADPCM, 4 bits per sample (4:1 against 16-bit PCM).
+//
+// Block format (one WebSocket message per block, mono):
+//
+//   byte 0-1  predictor before the first sample, int16 little-endian
+//   byte 2    step index before the first sample, 0..88
+//   byte 3    reserved, 0
+//   byte 4..  one 4-bit code per sample, low nibble first
+//
+// Every block carries its starting state, so each decodes on its own and a
+// lost packet does not corrupt the ones after it. A block always holds an
+// even number of samples: (length - 4) * 2. The codes are the standard IMA
+// ones, so any IMA decoder seeded with the header state can read them.
+class ImaAdpcmEncoder {
+public:
+    ImaAdpcmEncoder();
+
+    void reset();
+
+    // Encodes `count` samples (rounded up to even by repeating the last
+    // one) into `out`, which must hold blockBytes(count). Returns bytes.
+    size_t encodeBlock(const int16_t* pcm, size_t count, uint8_t* out);
+
+    static size_t blockBytes(size_t count) { return 4 + (count + 1) / 2; }
+
+private:
+    uint8_t encodeSample(int16_t sample);
+
+    int16_t _predictor;
+    uint8_t _index;
+};
+
+class ImaAdpcmDecoder {
+public:
+    ImaAdpcmDecoder();
+
+    // Streaming: begin() a block, then read() it in pieces of any size.
+    // begin() returns false for a malformed block. `block` must stay valid
+    // until it is read out.
+    bool begin(const uint8_t* block, size_t length);
+    size_t read(int16_t* out, size_t maxSamples);
+
+    // Decodes one whole block; `out` must hold blockSamples(length).
+    // Returns samples, or 0 for a malformed block.
+    static size_t decodeBlock(const uint8_t* block, size_t length, int16_t* out);
+
+    static size_t blockSamples(size_t length) { return length > 4 ? (length - 4) * 2 : 0; }
+
+private:
+    const uint8_t* _data;
+    const uint8_t* _end;
+    bool _highNibble;       // Next code is the high half of *_data
+    int16_t _predictor;
+    uint8_t _index;
+};
+
+#endif
@@ -0,0 +1,84 @@
+#include "JitterBuffer.h"
+
+#include <string.h>
+
+JitterBuffer::JitterBuffer() {
+    _target = 0;
+    _playing = false;
+    _lastDepth = 0;
+    _idle = 0;
+    _underruns = 0;
+    _silenceSamples = 0;
+    _overrunSamples = 0;
+    _pushed = 0;
+    _popped = 0;
+    _flushTo = 0;
+    _flushRequested = false;
+}
+
+bool JitterBuffer::begin(size_t capacity, size_t targetDepth) {
+    // Room for the target plus at least as much again for bursts
+    if (capacity < targetDepth * 2) capacity = targetDepth * 2;
+    _target = targetDepth;
+    return _ring.begin(capacity);
+}
+
+size_t JitterBuffer::push(const int16_t* samples, size_t count) {
+    size_t written = _ring.write(samples, count);
+    if (written < count) _overrunSamples += count - written;
+    _pushed += written;
+    return written;
+}
+
+void JitterBuffer::flush() {
+    _flushTo.store(_pushed, std::memory_order_relaxed);
+    _flushRequested.store(true, std::memory_order_release);
+}
+
+bool JitterBuffer::applyFlush() {
+    if (!_flushRequested.exchange(false, std::memory_order_acquire)) return false;
+
+    // Only up to where the producer was: anything newer is the next reply
+    uint32_t stale = _flushTo.load(std::memory_order_relaxed) - _popped;
+    _popped += _ring.skip(stale);
+    _playing = false;
+    _lastDepth = 0;
+    _idle = 0;
+    return true;
+}
+
+size_t JitterBuffer::pop(int16_t* out, size_t count) {
+    if (!_playing) {
+        size_t queued = _ring.available();
+        if (queued >= _target) {
+            _playing = true;
+        } else if (queued > 0 && queued == _lastDepth) {
+            // Nothing new arrived: likely the end of a reply, not jitter
+            _idle += count;
+            if (_idle >= _target) _playing = true;
+        } else {
+            _idle = 0;
+        }
+        _lastDepth = queued;
+
+        if (!_playing) {
+            memset(out, 0, count * sizeof(int16_t));
+            _silenceSamples += count;
+            return 0;
+        }
+        _idle = 0;
+    }
+
+    size_t got = _ring.read(out, count);
+    _popped += got;
+    if (got < count) {
+        memset(out + got, 0, (count - got) * sizeof(int16_t));
+        _silenceSamples += count - got;
+        // Ran dry: re-buffer to the target before playing again. The end
+        // of every reply lands here too, so expect one per reply.
+        _underruns++;
+        _playing = false;
+        _lastDepth = 0;
+    }
+    return got;
+}
@@ -0,0 +1,78 @@
+#ifndef JITTER_BUFFER_H
+#define JITTER_BUFFER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include "AudioRingBuffer.h"
+
+// Smooths bursty network audio into a steady stream for the speaker.
+//
+// The receive path push()es whatever arrives; the playback task pop()s a
+// fixed block every DMA period and always gets a full block. Playback only
+// starts once `targetDepth` samples are queued, which absorbs arrival
+// jitter up to that depth. If the queue runs dry the missing part is
+// filled with silence, counted as an underrun, and playback re-buffers to
+// the target depth before it resumes. A tail shorter than the target (the
+// end of a reply) is released once nothing more has arrived for a target
+// depth's worth of time.
+//
+// Single producer, single consumer: push() from one task, pop() from one
+// other task. The counters are written by one side only. flush() is a
+// producer-side request that the consumer carries out in applyFlush(), so
+// neither side ever touches the other's index.
+class JitterBuffer {
+public:
+    JitterBuffer();
+
+    bool begin(size_t capacity, size_t targetDepth);
+
+    // Producer. Returns samples queued; the rest is dropped as overrun.
+    size_t push(const int16_t* samples, size_t count);
+
+    // Producer. Everything pushed so far is to be dropped (barge-in);
+    // audio pushed after this call is kept.
+    void flush();
+
+    // Consumer. Always fills `count` samples (silence where needed).
+    // Returns how many of them were real audio.
+    size_t pop(int16_t* out, size_t count);
+
+    // Consumer, before pop(). Drops what flush() asked for and re-buffers;
+    // true if there was a flush to do.
+    bool applyFlush();
+
+    void setTargetDepth(size_t samples) { _target = samples; }
+    size_t targetDepth() const { return _target; }
+    size_t depth() const { return _ring.available(); }
+    // Samples push() would take right now
+    size_t space() const { return _ring.space(); }
+    size_t capacity() const { return _ring.capacity(); }
+    bool playing() const { return _playing; }
+
+    // Times playback ran dry, including once at the end of each reply
+    uint32_t underruns() const { return _underruns; }
+    uint32_t overrunSamples() const { return _overrunSamples; }
+    uint32_t silenceSamples() const { return _silenceSamples; }
+
+private:
+    AudioRingBuffer _ring;
+    volatile size_t _target;
+
+    std::atomic<uint32_t> _flushTo;     // _pushed at the last flush()
+    std::atomic<bool> _flushRequested;
+
+    // Consumer side
+    volatile bool _playing;
+    uint32_t _popped;       // Samples taken from the ring, read or skipped
+    size_t _lastDepth;
+    size_t _idle;           // Samples played as silence with no new arrivals
+    volatile uint32_t _underruns;
+    volatile uint32_t _silenceSamples;
+
+    // Producer side
+    uint32_t _pushed;
+    volatile uint32_t _overrunSamples;
+};
+
+#endif
@@ -0,0 +1,146 @@
+#include "OledFlush.h"
+
+#include <string.h>
+
+// SSD1306 addressing commands (horizontal addressing mode is set by
+// Adafruit_SSD1306::begin)
+#define SSD1306_CMD_COLUMNADDR 0x21
+#define SSD1306_CMD_PAGEADDR   0x22
+
+// A new address window costs a 6-byte command transaction, so unchanged
+// gaps up to about that size are cheaper to resend than to skip
+#define SPAN_MERGE_GAP 8
+
+#ifdef ARDUINO
+// Control byte + payload must fit the Wire TX buffer
+#define WIRE_CHUNK 128
+
+WireOledBus::WireOledBus(TwoWire* wire, uint8_t address, uint32_t clock) {
+    _wire = wire;
+    _address = address;
+    _clock = clock;
+}
+
+void WireOledBus::begin() {
+    _wire->setClock(_clock);
+}
+
+void WireOledBus::commands(const uint8_t* cmds, size_t length) {
+    _wire->beginTransmission(_address);
+    _wire->write((uint8_t)0x00); // Co = 0, D/C = 0: command stream
+    _wire->write(cmds, length);
+    _wire->endTransmission();
+}
+
+void WireOledBus::data(const uint8_t* bytes, size_t length) {
+    while (length > 0) {
+        size_t n = length < WIRE_CHUNK - 1 ? length : WIRE_CHUNK - 1;
+        _wire->beginTransmission(_address);
+        _wire->write((uint8_t)0x40); // Co = 0, D/C = 1: data stream
+        _wire->write(bytes, n);
+        _wire->endTransmission();
+        bytes += n;
+        length -= n;
+    }
+}
+#endif
+
+void oledBlit(uint8_t* dst, const uint8_t* frame) {
+    memcpy(dst, frame, OLED_BUFFER_SIZE);
+}
+
+void oledBlitRows(uint8_t* dst, const uint8_t* rowFrame) {
+    const int rowBytes = OLED_WIDTH / 8;
+
+    for (int page = 0; page < OLED_PAGES; page++) {
+        const uint8_t* src = rowFrame + page * 8 * rowBytes;
+        uint8_t* out = dst + page * OLED_WIDTH;
+
+        for (int bx = 0; bx < rowBytes; bx++) {
+            // Row k of the block goes to byte k
+            uint64_t x = 0;
+            for (int k = 0; k < 8; k++) {
+                x |= (uint64_t)src[k * rowBytes + bx] << (8 * k);
+            }
+
+            // 8x8 bit matrix transpose (Hacker's Delight 7-3)
+            uint64_t t;
+            t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;  x ^= t ^ (t << 7);
+            t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL; x ^= t ^ (t << 14);
+            t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL; x ^= t ^ (t << 28);
+
+            // Byte j now holds bit j of every row, i.e. pixel column 7 - j
+            for (int j = 0; j < 8; j++) {
+                out[bx * 8 + 7 - j] = (uint8_t)(x >> (8 * j));
+            }
+        }
+    }
+}
+
+PageFlusher::PageFlusher() {
+    _bus = NULL;
+    _valid = false;
+    _totalBytes = 0;
+    memset(_shadow, 0, sizeof(_shadow));
+}
+
+void PageFlusher::begin(OledBus* bus) {
+    _bus = bus;
+    _valid = false;
+}
+
+size_t PageFlusher::flush(const uint8_t* frame) {
+    if (_bus == NULL) return 0;
+
+    size_t sent = 0;
+
+    if (!_valid) {
+        // One window over the whole panel
+        uint8_t cmds[] = { SSD1306_CMD_PAGEADDR, 0, OLED_PAGES - 1,
+                           SSD1306_CMD_COLUMNADDR, 0, OLED_WIDTH - 1 };
+        _bus->commands(cmds, sizeof(cmds));
+        _bus->data(frame, OLED_BUFFER_SIZE);
+        memcpy(_shadow, frame, OLED_BUFFER_SIZE);
+        _valid = true;
+        _totalBytes += OLED_BUFFER_SIZE;
+        return OLED_BUFFER_SIZE;
+    }
+
+    for (uint8_t page = 0; page < OLED_PAGES; page++) {
+        const uint8_t* row = frame + page * OLED_WIDTH;
+        uint8_t* shadow = _shadow + page * OLED_WIDTH;
+
+        // Whole page unchanged is the common case
+        if (memcmp(row, shadow, OLED_WIDTH) == 0) continue;
+
+        int spanStart = -1;
+        int spanEnd = -1;
+        for (int x = 0; x < OLED_WIDTH; x++) {
+            if (row[x] == shadow[x]) continue;
+            if (spanStart < 0) {
+                spanStart = spanEnd = x;
+            } else if (x - spanEnd - 1 <= SPAN_MERGE_GAP) {
+                spanEnd = x;
+            } else {
+                sendSpan(page, spanStart, spanEnd, frame);
+                sent += spanEnd - spanStart + 1;
+                spanStart = spanEnd = x;
+            }
+        }
+        if (spanStart >= 0) {
+            sendSpan(page, spanStart, spanEnd, frame);
+            sent += spanEnd - spanStart + 1;
+        }
+        memcpy(shadow, row, OLED_WIDTH);
+    }
+
+    _totalBytes += sent;
+    return sent;
+}
+
+void PageFlusher::sendSpan(uint8_t page, uint8_t first, uint8_t last, const uint8_t* frame) {
+    uint8_t cmds[] = { SSD1306_CMD_PAGEADDR, page, page,
+                       SSD1306_CMD_COLUMNADDR, first, last };
+    _bus->commands(cmds, sizeof(cmds));
+    _bus->data(frame + page * OLED_WIDTH + first, last - first + 1);
+}
@@ -0,0 +1,80 @@
+#ifndef OLED_FLUSH_H
+#define OLED_FLUSH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define OLED_WIDTH  128
+#define OLED_HEIGHT 64
+#define OLED_PAGES  (OLED_HEIGHT / 8)
+#define OLED_BUFFER_SIZE (OLED_WIDTH * OLED_PAGES)
+
+// Byte sink for an SSD1306 controller. Kept abstract so the flush logic can
+// run against a simulated bus on the host.
+class OledBus {
+public:
+    virtual ~OledBus() {}
+    virtual void commands(const uint8_t* cmds, size_t length) = 0;
+    virtual void data(const uint8_t* bytes, size_t length) = 0;
+};
+
+#ifdef ARDUINO
+#include <Wire.h>
+
+class WireOledBus : public OledBus {
+public:
+    WireOledBus(TwoWire* wire = &Wire, uint8_t address = 0x3C, uint32_t clock = 400000);
+
+    // Call after Adafruit_SSD1306::begin(), which drops the bus back to 100kHz
+    void begin();
+
+    void commands(const uint8_t* cmds, size_t length) override;
+    void data(const uint8_t* bytes, size_t length) override;
+
+private:
+    TwoWire* _wire;
+    uint8_t _address;
+    uint32_t _clock;
+};
+#endif
+
+// Frame blits into a page-layout display buffer (Adafruit_SSD1306::getBuffer)
+
+// Frame already in SSD1306 page layout: a straight copy
+void oledBlit(uint8_t* dst, const uint8_t* frame);
+
+// image2cpp row-layout frame (what drawBitmap takes), transposed 8x8 pixel
+// blocks at a time instead of one drawPixel() per pixel
+void oledBlitRows(uint8_t* dst, const uint8_t* rowFrame);
+
+// Pushes only what changed since the last flush.
+//
+// Keeps a shadow of what the panel currently shows (SSD1306 page layout:
+// one byte = 8 vertical pixels, 128 bytes per page). For every page the
+// changed columns are grouped into spans, nearby spans are merged when the
+// gap is cheaper to resend than a new address window, and each span is sent
+// with COLUMNADDR/PAGEADDR followed by just its bytes.
+class PageFlusher {
+public:
+    PageFlusher();
+
+    void begin(OledBus* bus);
+
+    // Forget the shadow; the next flush sends the whole frame
+    void invalidate() { _valid = false; }
+
+    // Returns the number of data bytes sent (0 when nothing changed)
+    size_t flush(const uint8_t* frame);
+
+    uint32_t totalBytes() const { return _totalBytes; }
+
+private:
+    void sendSpan(uint8_t page, uint8_t first, uint8_t last, const uint8_t* frame);
+
+    OledBus* _bus;
+    uint8_t _shadow[OLED_BUFFER_SIZE];
+    bool _valid;
+    uint32_t _totalBytes;
+};
+
+#endif
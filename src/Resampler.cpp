@@ -0,0 +1,130 @@
+#include "Resampler.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint32_t gcd(uint32_t a, uint32_t b) {
+    while (b != 0) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+Resampler::Resampler() {
+    _inRate = 0;
+    _outRate = 0;
+    _up = 1;
+    _down = 1;
+    _taps = 0;
+    _coeffs = NULL;
+    reset();
+}
+
+Resampler::~Resampler() {
+    free(_coeffs);
+}
+
+bool Resampler::begin(uint32_t inRate, uint32_t outRate, uint8_t taps) {
+    free(_coeffs);
+    _coeffs = NULL;
+    _inRate = inRate;
+    _outRate = outRate;
+    _up = 1;
+    _down = 1;
+    _taps = 0;
+    reset();
+
+    if (inRate == 0 || outRate == 0) return false;
+    if (inRate == outRate) return true;
+
+    uint32_t g = gcd(inRate, outRate);
+    if (outRate / g > MAX_FACTOR || inRate / g > MAX_FACTOR) return false;
+    _up = (uint16_t)(outRate / g);
+    _down = (uint16_t)(inRate / g);
+
+    // `taps` counts samples at the lower rate; when decimating, each phase
+    // needs proportionally more input samples to span the same time
+    if (taps < 8) taps = 8;
+    uint32_t perPhase = ((uint32_t)taps * (_up > _down ? _up : _down) + _up - 1) / _up;
+    if (perPhase > MAX_TAPS) perPhase = MAX_TAPS;
+    _taps = (uint8_t)perPhase;
+
+    _coeffs = (int16_t*)malloc((size_t)_up * _taps * sizeof(int16_t));
+    if (_coeffs == NULL) return false;
+
+    // Prototype low-pass at the upsampled rate (inRate * up), in cycles per
+    // upsampled sample. One-off design in floating point, then Q14 (an
+    // upsampling phase can have a tap of exactly 1.0).
+    const int n = _up * _taps;
+    const double center = (n - 1) / 2.0;
+    const double lower = inRate < outRate ? inRate : outRate;
+    const double fc = 0.5 * lower / ((double)inRate * _up);
+
+    for (int j = 0; j < _up; j++) {
+        int32_t sum = 0;
+        int32_t absSum = 0;
+        int peak = 0;
+        for (int k = 0; k < _taps; k++) {
+            int i = j + k * _up;
+            double t = i - center;
+            double sinc = (t == 0) ? 2 * fc : sin(2 * M_PI * fc * t) / (M_PI * t);
+            // Blackman window: ~74dB stopband
+            double w = 0.42 - 0.5 * cos(2 * M_PI * i / (n - 1)) + 0.08 * cos(4 * M_PI * i / (n - 1));
+            // Gain `up` makes up for the zeros the virtual upsampling inserts
+            double c = sinc * w * _up * 16384.0;
+            int16_t q = (int16_t)(c < -32768 ? -32768 : (c > 32767 ? 32767 : lround(c)));
+            _coeffs[j * _taps + k] = q;
+            sum += q;
+            absSum += abs(q);
+            if (abs(q) > abs(_coeffs[j * _taps + peak])) peak = k;
+        }
+        // Exact unity DC gain on every phase: no ripple on steady tones
+        int32_t fixed = _coeffs[j * _taps + peak] + (16384 - sum);
+        if (fixed > 32767 || fixed < -32768) return false;
+        _coeffs[j * _taps + peak] = (int16_t)fixed;
+        // 32-bit accumulator headroom: |x| * sum|c| must stay below 2^31
+        if (absSum >= 65536) return false;
+    }
+    return true;
+}
+
+void Resampler::reset() {
+    memset(_history, 0, sizeof(_history));
+    _pos = 0;
+    _phase = 0;
+}
+
+size_t Resampler::process(const int16_t* in, size_t count, int16_t* out) {
+    if (_up == _down) {
+        if (out != in) memmove(out, in, count * sizeof(int16_t));
+        return count;
+    }
+
+    size_t produced = 0;
+    for (size_t i = 0; i < count; i++) {
+        // Newest sample first, written twice so the window never wraps
+        _pos = (_pos == 0) ? _taps - 1 : _pos - 1;
+        _history[_pos] = in[i];
+        _history[_pos + _taps] = in[i];
+
+        // Every output whose upsampled position falls on this input
+        while (_phase < _up) {
+            const int16_t* c = _coeffs + _phase * _taps;
+            const int16_t* x = _history + _pos;
+            int32_t acc = 1 << 13;  // Rounding
+            for (uint8_t k = 0; k < _taps; k++) {
+                acc += (int32_t)c[k] * x[k];
+            }
+            acc >>= 14;
+            if (acc > 32767) acc = 32767;
+            if (acc < -32768) acc = -32768;
+            out[produced++] = (int16_t)acc;
+            _phase += _down;
+        }
+        _phase -= _up;
+    }
+    return produced;
+}
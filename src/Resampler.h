@@ -0,0 +1,64 @@
+#ifndef RESAMPLER_H
+#define RESAMPLER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Streaming rational sample-rate converter (e.g. 24k -> 16k is up 2, down 3).
+//
+// Polyphase FIR: the windowed-sinc low-pass runs at the virtual upsampled
+// rate, but only the taps that land on real input samples are ever
+// multiplied, so each output costs one multiply-add per tap of its phase.
+// The coefficients are Q14, split by phase at begin(); the filter runs in
+// integer arithmetic with a 32-bit accumulator.
+//
+// The filter is `taps` samples long at the lower of the two rates
+// (Blackman window), centred on the lower Nyquist frequency: with 32 taps
+// the transition band is about 1/6 of the lower rate, so at 16kHz audio
+// stays flat to ~6.6kHz and anything that would alias below that is
+// suppressed. Equal rates are a copy.
+class Resampler {
+public:
+    Resampler();
+    ~Resampler();
+
+    // Returns false for unsupported ratios (after reduction either side
+    // above MAX_FACTOR) or when the coefficient table cannot be allocated.
+    bool begin(uint32_t inRate, uint32_t outRate, uint8_t taps = 32);
+
+    // Clear the filter history (start of a new stream)
+    void reset();
+
+    // Converts `count` input samples and returns the number of outputs.
+    // `out` must hold maxOutput(count) samples. Works in place only when
+    // the rates are equal.
+    size_t process(const int16_t* in, size_t count, int16_t* out);
+
+    size_t maxOutput(size_t inCount) const {
+        return (inCount * _up + _down - 1) / _down + 1;
+    }
+
+    uint32_t inRate() const { return _inRate; }
+    uint32_t outRate() const { return _outRate; }
+    bool passthrough() const { return _up == _down; }
+
+    static const uint16_t MAX_FACTOR = 160;  // 8k/16k/24k/32k/48k, 22.05k <-> 44.1k
+    static const uint8_t MAX_TAPS = 128;     // Per phase
+
+private:
+    Resampler(const Resampler&);
+    Resampler& operator=(const Resampler&);
+
+    uint32_t _inRate;
+    uint32_t _outRate;
+    uint16_t _up;
+    uint16_t _down;
+    uint8_t _taps;          // Per phase
+
+    int16_t* _coeffs;       // [_up][_taps], Q14, newest sample first
+    int16_t _history[2 * MAX_TAPS]; // Input delay line, mirrored halves
+    uint8_t _pos;           // Next write slot in the delay line
+    uint16_t _phase;        // Upsampled position of the next output
+};
+
+#endif
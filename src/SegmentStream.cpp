@@ -0,0 +1,56 @@
+#include "SegmentStream.h"
+
+SegmentStream::SegmentStream() {
+    _count = 0;
+    _total = 0;
+    rewind();
+}
+
+bool SegmentStream::add(const uint8_t* data, size_t length) {
+    if (_count == MAX_SEGMENTS) return false;
+    if (length == 0) return true;
+    _segments[_count].data = data;
+    _segments[_count].length = length;
+    _count++;
+    _total += length;
+    return true;
+}
+
+void SegmentStream::rewind() {
+    _index = 0;
+    _offset = 0;
+    _consumed = 0;
+}
+
+int SegmentStream::available() {
+    size_t left = _total - _consumed;
+    return left > 0x7FFFFFFF ? 0x7FFFFFFF : (int)left;
+}
+
+int SegmentStream::peek() {
+    if (_index == _count) return -1;
+    return _segments[_index].data[_offset];
+}
+
+int SegmentStream::read() {
+    uint8_t c;
+    return readBytes((char*)&c, 1) == 1 ? c : -1;
+}
+
+size_t SegmentStream::readBytes(char* buffer, size_t length) {
+    size_t done = 0;
+    while (done < length && _index < _count) {
+        const Segment& s = _segments[_index];
+        size_t n = s.length - _offset;
+        if (n > length - done) n = length - done;
+        memcpy(buffer + done, s.data + _offset, n);
+        done += n;
+        _offset += n;
+        if (_offset == s.length) {
+            _index++;
+            _offset = 0;
+        }
+    }
+    _consumed += done;
+    return done;
+}
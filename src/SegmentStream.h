@@ -0,0 +1,51 @@
+#ifndef SEGMENT_STREAM_H
+#define SEGMENT_STREAM_H
+
+#include <Arduino.h>
+
+// Read-only Stream over a few memory segments, back to back.
+//
+// Lets HTTPClient::sendRequest() send a body made of pieces that live in
+// different places (multipart preamble, WAV header, the recording, the
+// closing boundary) without gluing them into one buffer first. The client
+// pulls the body in TCP-sized reads, each copied straight out of the
+// segments. Segments are not copied and must outlive the request.
+class SegmentStream : public Stream {
+public:
+    static const uint8_t MAX_SEGMENTS = 6;
+
+    SegmentStream();
+
+    // Returns false when all MAX_SEGMENTS are used
+    bool add(const uint8_t* data, size_t length);
+    bool add(const String& text) { return add((const uint8_t*)text.c_str(), text.length()); }
+
+    // Back to the first byte, to send the same body again
+    void rewind();
+    size_t size() const { return _total; }
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t readBytes(char* buffer, size_t length) override;
+    size_t readBytes(uint8_t* buffer, size_t length) override { return readBytes((char*)buffer, length); }
+
+    // Read-only
+    size_t write(uint8_t) override { return 0; }
+    void flush() override {}
+
+private:
+    struct Segment {
+        const uint8_t* data;
+        size_t length;
+    };
+
+    Segment _segments[MAX_SEGMENTS];
+    uint8_t _count;
+    uint8_t _index;         // Segment being read
+    size_t _offset;         // Into it
+    size_t _total;
+    size_t _consumed;
+};
+
+#endif
@@ -0,0 +1,363 @@
+#include "SpoolLog.h"
+#include "AudioMemory.h"
+
+#include <string.h>
+#ifdef ARDUINO
+#include <esp_timer.h>
+#else
+#include <unistd.h>
+#endif
+
+// Block layout: header, then payload
+//   0 magic  4 seq  8 record  12 length (u16)  14 flags  15 0  16 CRC32
+// The CRC covers bytes 0-15 and the payload.
+static const uint32_t BLOCK_MAGIC = 0x314C5053;    // "SPL1"
+static const uint32_t CURSOR_MAGIC = 0x43435053;   // "SPCC"
+static const size_t HEADER_SIZE = 20;
+static const size_t PAYLOAD_SIZE = SpoolDevice::BLOCK_SIZE - HEADER_SIZE;
+
+static uint32_t crc32(const uint8_t* data, size_t length, uint32_t crc = 0) {
+    // IEEE 802.3, a nibble at a time: a 64-byte table instead of 1KB
+    static const uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+    };
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ table[crc & 15];
+        crc = (crc >> 4) ^ table[crc & 15];
+    }
+    return ~crc;
+}
+
+static void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+#ifdef ARDUINO
+// ====== PartitionSpoolDevice ======
+
+PartitionSpoolDevice::PartitionSpoolDevice() {
+    _partition = NULL;
+    _blocks = 0;
+    _writes = 0;
+    _writeMicros = 0;
+    _maxWriteMicros = 0;
+}
+
+bool PartitionSpoolDevice::begin(const char* label) {
+    _partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    _blocks = _partition != NULL ? _partition->size / BLOCK_SIZE : 0;
+    return _blocks > 0;
+}
+
+bool PartitionSpoolDevice::read(uint32_t block, uint8_t* data) {
+    if (block >= _blocks) return false;
+    return esp_partition_read(_partition, block * BLOCK_SIZE, data, BLOCK_SIZE) == ESP_OK;
+}
+
+bool PartitionSpoolDevice::write(uint32_t block, const uint8_t* data) {
+    if (block >= _blocks) return false;
+    int64_t start = esp_timer_get_time();
+    bool ok = esp_partition_erase_range(_partition, block * BLOCK_SIZE, BLOCK_SIZE) == ESP_OK &&
+              esp_partition_write(_partition, block * BLOCK_SIZE, data, BLOCK_SIZE) == ESP_OK;
+    uint32_t took = (uint32_t)(esp_timer_get_time() - start);
+    _writes++;
+    _writeMicros += took;
+    if (took > _maxWriteMicros) _maxWriteMicros = took;
+    return ok;
+}
+#else
+// ====== FileSpoolDevice ======
+
+FileSpoolDevice::FileSpoolDevice() {
+    _file = NULL;
+    _blocks = 0;
+}
+
+FileSpoolDevice::~FileSpoolDevice() {
+    end();
+}
+
+bool FileSpoolDevice::begin(const char* path, uint32_t blocks) {
+    end();
+    _file = fopen(path, "r+b");
+    if (_file == NULL) _file = fopen(path, "w+b");
+    _blocks = _file != NULL ? blocks : 0;
+    return _file != NULL;
+}
+
+void FileSpoolDevice::end() {
+    if (_file != NULL) fclose(_file);
+    _file = NULL;
+}
+
+bool FileSpoolDevice::read(uint32_t block, uint8_t* data) {
+    if (_file == NULL || block >= _blocks) return false;
+    size_t n = 0;
+    if (fseek(_file, (long)block * BLOCK_SIZE, SEEK_SET) == 0) {
+        n = fread(data, 1, BLOCK_SIZE, _file);
+    }
+    // Past the end of the file: never written
+    memset(data + n, 0, BLOCK_SIZE - n);
+    return true;
+}
+
+bool FileSpoolDevice::write(uint32_t block, const uint8_t* data) {
+    if (_file == NULL || block >= _blocks) return false;
+    if (fseek(_file, (long)block * BLOCK_SIZE, SEEK_SET) != 0) return false;
+    if (fwrite(data, 1, BLOCK_SIZE, _file) != BLOCK_SIZE) return false;
+    return fflush(_file) == 0 && fsync(fileno(_file)) == 0;
+}
+#endif
+
+// ====== SpoolLog ======
+
+SpoolLog::SpoolLog() {
+    _device = NULL;
+    _writeBuf = NULL;
+    _readBuf = NULL;
+    _head = 0;
+    _record = 0;
+    _open = false;
+    _first = false;
+    _fill = 0;
+    _overwritten = 0;
+    _consumed = 0;
+    _cursorGen = 0;
+    _readEnd = 0;
+    _readSeq = 0;
+    _readOffset = 0;
+    _readTotal = 0;
+    _reading = false;
+    _loadedSeq = 0;
+    _loadedLength = 0;
+    _scanFrom = 0;
+}
+
+SpoolLog::~SpoolLog() {
+    AudioMemory::release(_writeBuf);
+    AudioMemory::release(_readBuf);
+}
+
+bool SpoolLog::begin(SpoolDevice* device) {
+    _device = device;
+    if (_device == NULL || _device->blockCount() <= CURSOR_SLOTS) return false;
+    if (_writeBuf == NULL) _writeBuf = (uint8_t*)AudioMemory::alloc(SpoolDevice::BLOCK_SIZE);
+    if (_readBuf == NULL) _readBuf = (uint8_t*)AudioMemory::alloc(SpoolDevice::BLOCK_SIZE);
+    if (_writeBuf == NULL || _readBuf == NULL) return false;
+
+    // Cursor: the valid slot with the newer generation
+    _consumed = 0;
+    _cursorGen = 0;
+    for (uint32_t slot = 0; slot < CURSOR_SLOTS; slot++) {
+        if (!_device->read(slot, _readBuf)) continue;
+        if (get32(_readBuf) != CURSOR_MAGIC || get32(_readBuf + 12) != crc32(_readBuf, 12)) continue;
+        uint32_t gen = get32(_readBuf + 4);
+        if (gen > _cursorGen) {
+            _cursorGen = gen;
+            _consumed = get32(_readBuf + 8);
+        }
+    }
+
+    // Head: the highest sequence found in its own slot with a good CRC
+    _head = 0;
+    _record = 0;
+    _loadedSeq = 0;
+    BlockHeader h;
+    for (uint32_t b = 0; b < dataBlocks(); b++) {
+        if (!_device->read(CURSOR_SLOTS + b, _readBuf)) continue;
+        uint32_t seq = get32(_readBuf + 4);
+        if (seq == 0 || seq % dataBlocks() != b) continue;
+        if (checkBlock(_readBuf, seq, h) && seq > _head) {
+            _head = seq;
+            _record = h.record;
+        }
+    }
+    if (_consumed > _head) _consumed = _head;
+
+    _open = false;
+    _reading = false;
+    _overwritten = 0;
+    _scanFrom = 0;
+    return true;
+}
+
+uint32_t SpoolLog::tail() const {
+    // Oldest sequence still on the device and not consumed
+    uint32_t oldest = _head >= dataBlocks() ? _head - dataBlocks() + 1 : 1;
+    return _consumed + 1 > oldest ? _consumed + 1 : oldest;
+}
+
+uint32_t SpoolLog::pendingBlocks() const {
+    return _device != NULL ? _head + 1 - tail() : 0;
+}
+
+bool SpoolLog::loadBlock(uint32_t seq, BlockHeader& h) {
+    bool ok = _device->read(blockFor(seq), _readBuf) && checkBlock(_readBuf, seq, h);
+    _loadedSeq = ok ? seq : 0;
+    _loadedLength = ok ? h.length : 0;
+    return ok;
+}
+
+bool SpoolLog::checkBlock(const uint8_t* buffer, uint32_t seq, BlockHeader& h) {
+    if (get32(buffer) != BLOCK_MAGIC) return false;
+    h.seq = get32(buffer + 4);
+    h.record = get32(buffer + 8);
+    h.length = (uint16_t)(buffer[12] | (buffer[13] << 8));
+    h.flags = buffer[14];
+    if (h.seq != seq || h.length > PAYLOAD_SIZE) return false;
+    uint32_t crc = crc32(buffer, 16);
+    return crc32(buffer + HEADER_SIZE, h.length, crc) == get32(buffer + 16);
+}
+
+bool SpoolLog::writeBlock(uint8_t flags) {
+    uint32_t seq = _head + 1;
+    // Overwriting a block the reader has not consumed yet loses it
+    if (seq > dataBlocks() && seq - dataBlocks() > _consumed) _overwritten++;
+
+    uint8_t* b = _writeBuf;
+    put32(b, BLOCK_MAGIC);
+    put32(b + 4, seq);
+    put32(b + 8, _record);
+    b[12] = (uint8_t)(_fill & 0xFF);
+    b[13] = (uint8_t)(_fill >> 8);
+    b[14] = flags;
+    b[15] = 0;
+    memset(b + HEADER_SIZE + _fill, 0, PAYLOAD_SIZE - _fill);
+    put32(b + 16, crc32(b + HEADER_SIZE, _fill, crc32(b, 16)));
+    if (!_device->write(blockFor(seq), b)) return false;
+
+    _head = seq;
+    _fill = 0;
+    return true;
+}
+
+bool SpoolLog::beginRecord() {
+    if (_writeBuf == NULL) return false;
+    _record++;
+    _open = true;
+    _first = true;
+    _fill = 0;
+    return true;
+}
+
+size_t SpoolLog::append(const void* data, size_t length) {
+    if (!_open) return 0;
+    const uint8_t* p = (const uint8_t*)data;
+    size_t done = 0;
+    while (done < length) {
+        // Only whole blocks go to the device, each once
+        if (_fill == PAYLOAD_SIZE) {
+            if (!writeBlock(_first ? FLAG_FIRST : 0)) {
+                _open = false;
+                return done;
+            }
+            _first = false;
+        }
+        size_t n = PAYLOAD_SIZE - _fill;
+        if (n > length - done) n = length - done;
+        memcpy(_writeBuf + HEADER_SIZE + _fill, p + done, n);
+        _fill += n;
+        done += n;
+    }
+    return done;
+}
+
+bool SpoolLog::endRecord() {
+    if (!_open) return false;
+    _open = false;
+    return writeBlock((_first ? FLAG_FIRST : 0) | FLAG_LAST);
+}
+
+bool SpoolLog::nextRecord() {
+    _reading = false;
+    if (_device == NULL || _readBuf == NULL) return false;
+
+    BlockHeader h;
+    uint32_t seq = tail() > _scanFrom ? tail() : _scanFrom;
+    while (seq <= _head) {
+        if (!loadBlock(seq, h) || !(h.flags & FLAG_FIRST)) {
+            _scanFrom = ++seq;
+            continue;
+        }
+        // Follow the record; it counts only if every block is there
+        uint32_t record = h.record;
+        uint32_t end = seq;
+        size_t total = h.length;
+        bool complete = (h.flags & FLAG_LAST) != 0;
+        while (!complete && end < _head) {
+            if (!loadBlock(end + 1, h) || h.record != record || (h.flags & FLAG_FIRST)) break;
+            end++;
+            total += h.length;
+            complete = (h.flags & FLAG_LAST) != 0;
+        }
+        if (complete) {
+            _readEnd = end;
+            _readSeq = seq;
+            _readOffset = 0;
+            _readTotal = total;
+            _reading = true;
+            return true;
+        }
+        // Torn or abandoned: never looked at again, unless it is the
+        // record still being written
+        if (_open && end == _head) return false;
+        seq = end + 1;
+        _scanFrom = seq;
+    }
+    return false;
+}
+
+size_t SpoolLog::read(void* data, size_t length) {
+    if (!_reading) return 0;
+    uint8_t* out = (uint8_t*)data;
+    size_t done = 0;
+    BlockHeader h;
+    while (done < length && _readSeq <= _readEnd) {
+        // The writer may have lapped the reader since nextRecord()
+        if (_loadedSeq != _readSeq && !loadBlock(_readSeq, h)) {
+            _reading = false;
+            return done;
+        }
+        size_t n = _loadedLength - _readOffset;
+        if (n > length - done) n = length - done;
+        memcpy(out + done, _readBuf + HEADER_SIZE + _readOffset, n);
+        done += n;
+        _readOffset += n;
+        if (_readOffset == _loadedLength) {
+            _readSeq++;
+            _readOffset = 0;
+        }
+    }
+    return done;
+}
+
+bool SpoolLog::consume() {
+    if (_readEnd == 0 || _readEnd <= _consumed) return false;
+    _reading = false;
+    return writeCursor(_readEnd);
+}
+
+bool SpoolLog::writeCursor(uint32_t consumed) {
+    // Alternate slots: a torn write leaves the other one intact
+    uint32_t gen = _cursorGen + 1;
+    _loadedSeq = 0;
+    memset(_readBuf, 0, SpoolDevice::BLOCK_SIZE);
+    put32(_readBuf, CURSOR_MAGIC);
+    put32(_readBuf + 4, gen);
+    put32(_readBuf + 8, consumed);
+    put32(_readBuf + 12, crc32(_readBuf, 12));
+    if (!_device->write(gen % CURSOR_SLOTS, _readBuf)) return false;
+    _cursorGen = gen;
+    _consumed = consumed;
+    return true;
+}
@@ -0,0 +1,177 @@
+#ifndef SPOOL_LOG_H
+#define SPOOL_LOG_H
+
+#include <stdint.h>
+#include <stddef.h>
+#ifdef ARDUINO
+#include <esp_partition.h>
+#else
+#include <stdio.h>
+#endif
+
+// Storage for a SpoolLog: fixed-size blocks, read and written whole
+class SpoolDevice {
+public:
+    static const size_t BLOCK_SIZE = 4096;   // One flash sector
+
+    virtual ~SpoolDevice() {}
+    virtual uint32_t blockCount() const = 0;
+    // A block never written reads back as no valid block (erased flash
+    // is all 0xFF, a short file pads with zeros)
+    virtual bool read(uint32_t block, uint8_t* data) = 0;
+    // Returns once the block is durable
+    virtual bool write(uint32_t block, const uint8_t* data) = 0;
+};
+
+#ifdef ARDUINO
+// Blocks straight in a raw data partition (see partitions.csv): a write
+// erases its sector and programs it, with no filesystem in between. The
+// partition's whole sectors are the blocks.
+//
+// Erasing a sector takes tens of milliseconds with the flash cache off,
+// so write() is timed; callers log the figures to check them against
+// the mic's DMA buffers.
+class PartitionSpoolDevice : public SpoolDevice {
+public:
+    PartitionSpoolDevice();
+
+    // `label` of a data partition, e.g. "spool"
+    bool begin(const char* label);
+
+    uint32_t blockCount() const { return _blocks; }
+    bool read(uint32_t block, uint8_t* data);
+    bool write(uint32_t block, const uint8_t* data);
+
+    // write() calls timed so far, and how long they took
+    uint32_t writes() const { return _writes; }
+    uint32_t averageWriteMicros() const { return _writes > 0 ? (uint32_t)(_writeMicros / _writes) : 0; }
+    uint32_t maxWriteMicros() const { return _maxWriteMicros; }
+
+private:
+    PartitionSpoolDevice(const PartitionSpoolDevice&);
+    PartitionSpoolDevice& operator=(const PartitionSpoolDevice&);
+
+    const esp_partition_t* _partition;
+    uint32_t _blocks;
+    uint32_t _writes;
+    uint64_t _writeMicros;
+    uint32_t _maxWriteMicros;
+};
+#else
+// Blocks in one file through stdio, for the host tests
+class FileSpoolDevice : public SpoolDevice {
+public:
+    FileSpoolDevice();
+    ~FileSpoolDevice();
+
+    // Opens or creates the file; it grows as blocks are written
+    bool begin(const char* path, uint32_t blocks);
+    void end();
+
+    uint32_t blockCount() const { return _blocks; }
+    bool read(uint32_t block, uint8_t* data);
+    bool write(uint32_t block, const uint8_t* data);
+
+private:
+    FileSpoolDevice(const FileSpoolDevice&);
+    FileSpoolDevice& operator=(const FileSpoolDevice&);
+
+    FILE* _file;
+    uint32_t _blocks;
+};
+#endif
+
+// Store-and-forward log of records (utterances) in a ring of flash blocks.
+//
+// Every block carries a sequence number and a CRC, and block sequence s
+// always lives in data block s % N, so each block is written exactly once
+// per lap around the ring (even wear, no erase-in-place) and mounting
+// just picks the highest valid sequence. A block torn by a reset fails
+// its CRC and is ignored, taking at most the record it belonged to with
+// it. A record is delivered only if all its blocks are intact.
+//
+// The reader's position is a cursor in two alternating slot blocks, so
+// a reset between delivery and consume() replays the record again rather
+// than losing it. When the ring is full the oldest records are
+// overwritten (overwrittenBlocks()).
+//
+// Writing: beginRecord(), append()..., endRecord(), or abandonRecord() to
+// drop it (so does a beginRecord() before the end). Reading: nextRecord(),
+// read()... until recordBytes() are read, then consume() once it has been
+// delivered. One record may be open for writing while others are read.
+class SpoolLog {
+public:
+    SpoolLog();
+    ~SpoolLog();
+
+    // Needs at least 3 device blocks (2 cursor slots + data). Recovers
+    // the head and the cursor from what is on the device.
+    bool begin(SpoolDevice* device);
+
+    bool beginRecord();
+    // Returns bytes taken (all of them unless the device failed)
+    size_t append(const void* data, size_t length);
+    bool endRecord();
+    void abandonRecord() { _open = false; }
+
+    // Finds the oldest complete record not yet consumed
+    bool nextRecord();
+    size_t recordBytes() const { return _readTotal; }
+    size_t read(void* data, size_t length);
+    // The record from nextRecord() was delivered: do not replay it
+    bool consume();
+
+    // Sequence numbers not yet consumed (complete records or not)
+    uint32_t pendingBlocks() const;
+    uint32_t overwrittenBlocks() const { return _overwritten; }
+
+private:
+    SpoolLog(const SpoolLog&);
+    SpoolLog& operator=(const SpoolLog&);
+
+    static const uint8_t FLAG_FIRST = 1;
+    static const uint8_t FLAG_LAST = 2;
+
+    struct BlockHeader {
+        uint32_t seq;
+        uint32_t record;
+        uint16_t length;
+        uint8_t flags;
+    };
+
+    uint32_t dataBlocks() const { return _device->blockCount() - CURSOR_SLOTS; }
+    uint32_t blockFor(uint32_t seq) const { return CURSOR_SLOTS + seq % dataBlocks(); }
+    uint32_t tail() const;
+    bool writeBlock(uint8_t flags);
+    bool loadBlock(uint32_t seq, BlockHeader& h);
+    static bool checkBlock(const uint8_t* buffer, uint32_t seq, BlockHeader& h);
+    bool writeCursor(uint32_t consumed);
+
+    static const uint32_t CURSOR_SLOTS = 2;
+
+    SpoolDevice* _device;
+    uint8_t* _writeBuf;
+    uint8_t* _readBuf;
+
+    // Writer
+    uint32_t _head;         // Last sequence written, 0 = none
+    uint32_t _record;       // Record being written
+    bool _open;
+    bool _first;            // Next block is the record's first
+    size_t _fill;           // Payload bytes in _writeBuf
+    uint32_t _overwritten;
+
+    // Reader
+    uint32_t _consumed;     // Last sequence consumed
+    uint32_t _cursorGen;
+    uint32_t _readEnd;      // Last block of the record from nextRecord()
+    uint32_t _readSeq;      // Block being read
+    size_t _readOffset;
+    size_t _readTotal;
+    bool _reading;
+    uint32_t _loadedSeq;    // Block in _readBuf, 0 = none
+    size_t _loadedLength;
+    uint32_t _scanFrom;     // Blocks before this are known garbage
+};
+
+#endif
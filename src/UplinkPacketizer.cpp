@@ -0,0 +1,104 @@
+#include "UplinkPacketizer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+UplinkPacketizer::UplinkPacketizer() {
+    _codec = CODEC_PCM16;
+    _frameMs = 20;
+    _frameSamples = 0;
+    _frame = NULL;
+    _packet = NULL;
+    _header = true;
+    reset();
+}
+
+UplinkPacketizer::~UplinkPacketizer() {
+    free(_frame);
+    free(_packet);
+}
+
+bool UplinkPacketizer::begin(uint32_t sampleRate, AudioCodec codec, uint16_t frameMs) {
+    _codec = codec;
+    _frameMs = frameMs ? frameMs : 20;
+    _frameSamples = sampleRate * _frameMs / 1000;
+    if (_frameSamples == 0) _frameSamples = 1;
+
+    size_t payload = _frameSamples * 2;
+    if (ImaAdpcmEncoder::blockBytes(_frameSamples) > payload) {
+        payload = ImaAdpcmEncoder::blockBytes(_frameSamples);
+    }
+
+    free(_frame);
+    free(_packet);
+    _frame = (int16_t*)malloc(_frameSamples * sizeof(int16_t));
+    _packet = (uint8_t*)malloc(UPLINK_HEADER_SIZE + payload);
+    reset();
+    return _frame != NULL && _packet != NULL;
+}
+
+void UplinkPacketizer::reset() {
+    _adpcm.reset();
+    _fill = 0;
+    _packetStart = 0;
+    _packetLength = 0;
+    _ready = false;
+    _seq = 0;
+    _timestamp = 0;
+    _flags = 0;
+}
+
+size_t UplinkPacketizer::write(const int16_t* samples, size_t count) {
+    if (_ready || _frame == NULL) return 0;
+
+    size_t n = _frameSamples - _fill;
+    if (n > count) n = count;
+    memcpy(_frame + _fill, samples, n * sizeof(int16_t));
+    _fill += n;
+    if (_fill == _frameSamples) seal(0);
+    return n;
+}
+
+void UplinkPacketizer::finish() {
+    if (_ready || _frame == NULL) return;
+    seal(UPLINK_FLAG_LAST);
+}
+
+void UplinkPacketizer::consume() {
+    _ready = false;
+    _packetLength = 0;
+}
+
+void UplinkPacketizer::seal(uint8_t flags) {
+    uint8_t* payload = _packet + UPLINK_HEADER_SIZE;
+    size_t payloadBytes;
+    if (_codec == CODEC_IMA_ADPCM) {
+        payloadBytes = _fill ? _adpcm.encodeBlock(_frame, _fill, payload) : 0;
+    } else {
+        payloadBytes = _fill * 2;
+        memcpy(payload, _frame, payloadBytes);
+    }
+
+    flags |= _flags;
+    uint8_t* h = _packet;
+    h[0] = UPLINK_VERSION;
+    h[1] = (uint8_t)_codec;
+    h[2] = (uint8_t)(_seq & 0xFF);
+    h[3] = (uint8_t)(_seq >> 8);
+    h[4] = (uint8_t)(_timestamp & 0xFF);
+    h[5] = (uint8_t)(_timestamp >> 8);
+    h[6] = (uint8_t)(_timestamp >> 16);
+    h[7] = (uint8_t)(_timestamp >> 24);
+    h[8] = (uint8_t)(_fill & 0xFF);
+    h[9] = (uint8_t)(_fill >> 8);
+    h[10] = flags;
+    h[11] = 0;
+
+    _packetStart = _header ? 0 : UPLINK_HEADER_SIZE;
+    _packetLength = UPLINK_HEADER_SIZE - _packetStart + payloadBytes;
+    _ready = true;
+    _seq++;
+    _timestamp += _fill;
+    _fill = 0;
+    _flags = 0;
+}
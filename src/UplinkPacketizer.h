@@ -0,0 +1,97 @@
+#ifndef UPLINK_PACKETIZER_H
+#define UPLINK_PACKETIZER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "AudioCodec.h"
+#include "ImaAdpcm.h"
+
+// Cuts the uplink stream into fixed-duration frames, one WebSocket message
+// each, so the socket sees a steady packet rate instead of whatever size
+// the mic happened to deliver.
+//
+// Packet layout (little-endian):
+//
+//   byte 0      version, UPLINK_VERSION
+//   byte 1      codec (AudioCodec)
+//   byte 2-3    sequence number, 0 at START, wraps
+//   byte 4-7    timestamp: index of the first sample since START, at the
+//               uplink rate
+//   byte 8-9    sample count
+//   byte 10     flags (UPLINK_FLAG_*)
+//   byte 11     reserved, 0
+//   byte 12..   payload: PCM16 samples, or one IMA-ADPCM block
+//
+// The sequence number lets the backend spot loss and reordering; the
+// timestamp says where a frame belongs even after a gap.
+//
+// With the header turned off (servers that predate it) a packet is just
+// the PCM16 samples, as the uplink always used to be; an empty last frame
+// is then an empty packet and is not sent.
+#define UPLINK_VERSION 1
+#define UPLINK_HEADER_SIZE 12
+
+#define UPLINK_FLAG_LAST 0x01          // Final (possibly short) frame of the turn
+#define UPLINK_FLAG_DISCONTINUITY 0x02 // Audio was dropped before this frame
+
+class UplinkPacketizer {
+public:
+    UplinkPacketizer();
+    ~UplinkPacketizer();
+
+    // `frameMs` is typically 20, 40 or 60. Returns false on allocation failure.
+    bool begin(uint32_t sampleRate, AudioCodec codec, uint16_t frameMs = 20);
+
+    // New turn: sequence and timestamp restart at 0
+    void reset();
+
+    // Consumes up to `count` samples; stops early when a packet is ready.
+    // Returns samples consumed.
+    size_t write(const int16_t* samples, size_t count);
+
+    // Closes the partial frame as the last one of the turn (an empty
+    // frame if nothing is pending, so the backend still sees the flag)
+    void finish();
+
+    // Mark the next packet: samples were lost before it
+    void markDiscontinuity() { _flags |= UPLINK_FLAG_DISCONTINUITY; }
+
+    // Header on (default) or off, from the next packet sealed
+    void setHeader(bool header) { _header = header; }
+    bool header() const { return _header; }
+
+    bool ready() const { return _ready; }
+    const uint8_t* packet() const { return _packet + _packetStart; }
+    size_t packetLength() const { return _packetLength; }
+
+    // Packet has been sent; start filling the next frame
+    void consume();
+
+    uint16_t frameMs() const { return _frameMs; }
+    AudioCodec codec() const { return _codec; }
+
+private:
+    UplinkPacketizer(const UplinkPacketizer&);
+    UplinkPacketizer& operator=(const UplinkPacketizer&);
+
+    void seal(uint8_t flags);
+
+    AudioCodec _codec;
+    uint16_t _frameMs;
+    size_t _frameSamples;
+
+    ImaAdpcmEncoder _adpcm;
+    int16_t* _frame;
+    size_t _fill;
+    uint8_t* _packet;       // Header space, then payload
+    size_t _packetStart;    // 0, or UPLINK_HEADER_SIZE without a header
+    size_t _packetLength;
+    bool _ready;
+    bool _header;
+
+    uint16_t _seq;
+    uint32_t _timestamp;
+    uint8_t _flags;
+};
+
+#endif
@@ -0,0 +1,162 @@
+#include "VoiceActivityDetector.h"
+
+VoiceActivityDetector::VoiceActivityDetector() {
+    _frameSamples = 320;
+    _hangoverFrames = 20;
+    _hpPole = 31164;
+    reset();
+}
+
+void VoiceActivityDetector::begin(uint32_t sampleRate, uint16_t hangoverMs) {
+    _frameSamples = sampleRate * FRAME_MS / 1000;
+    if (_frameSamples == 0) _frameSamples = 1;
+    _hangoverFrames = (hangoverMs + FRAME_MS - 1) / FRAME_MS;
+    if (_hangoverFrames == 0) _hangoverFrames = 1;
+    // One-pole high-pass: pole = 1 - 2*pi*fc/fs, in Q15
+    int32_t step = (int32_t)((2 * 3.14159265f * HIGHPASS_HZ * 32768.0f) / sampleRate);
+    _hpPole = step < 32768 ? 32768 - step : 0;
+    reset();
+}
+
+void VoiceActivityDetector::reset() {
+    _hpX = 0;
+    _hpY = 0;
+    _primed = false;
+    _prev = 0;
+    _sumSq = 0;
+    _n = 0;
+    _crossings = 0;
+    _energy = 0;
+    _floor = MIN_FLOOR;
+    _spread = 0;
+    _learnSum = 0;
+    _learnDips = 0;
+    for (uint8_t i = 0; i < MIN_BLOCKS; i++) _blockMin[i] = 0;
+    _block = 0;
+    _blockFrames = 0;
+    _blocksFull = 0;
+    _zcrPercent = 0;
+    _frames = 0;
+    _run = 0;
+    _quiet = 0;
+    _speaking = false;
+}
+
+int16_t VoiceActivityDetector::log2q8(uint32_t v) {
+    if (v == 0) return 0;
+    int msb = 31;
+    while (!(v & 0x80000000u)) {
+        v <<= 1;
+        msb--;
+    }
+    // Integer part from the top bit, fraction from the next 8 bits (linear;
+    // within 0.1 of the true log2, about 0.3dB)
+    return (int16_t)(msb * 256 + ((v >> 23) & 0xFF));
+}
+
+uint8_t VoiceActivityDetector::process(const int16_t* samples, size_t count) {
+    uint8_t events = VAD_NONE;
+    for (size_t i = 0; i < count; i++) {
+        // High-pass: the mic's DC offset and room rumble would otherwise
+        // swamp both the energy and the zero crossings. State is Q8 so the
+        // shift's rounding does not build up into a new offset.
+        int32_t x = samples[i];
+        if (!_primed) {
+            _hpX = x;
+            _primed = true;
+        }
+        _hpY = (x - _hpX) * 256 + (int32_t)(((int64_t)_hpY * _hpPole) >> 15);
+        _hpX = x;
+        int32_t v = _hpY >> 8;
+        int16_t y = v > 32767 ? 32767 : (v < -32768 ? -32768 : (int16_t)v);
+
+        _sumSq += (int32_t)y * y;
+        if ((y < 0) != (_prev < 0)) _crossings++;
+        _prev = y;
+
+        if (++_n == _frameSamples) events |= endFrame();
+    }
+    return events;
+}
+
+uint8_t VoiceActivityDetector::endFrame() {
+    _energy = log2q8((uint32_t)(_sumSq / _n));
+    _zcrPercent = (uint8_t)(_crossings * 100 / _n);
+    _sumSq = 0;
+    _n = 0;
+    _crossings = 0;
+    if (_frames < 0xFFFF) _frames++;
+
+    // While learning the floor is the plain mean of the frames so far;
+    // after that only frames judged non-speech move it. Noise that
+    // fluctuates (rumble, traffic) widens the thresholds via _spread.
+    // Both means are kept as sums and rounded; stepping them by d / n
+    // would truncate toward zero every frame.
+    bool learning = _frames <= LEARN_FRAMES;
+    if (learning) {
+        if (_frames == 1) {
+            _learnSum = 0;
+            _learnDips = 0;
+        } else {
+            int16_t d = _energy - _floor;
+            _learnDips += d < 0 ? -2 * d : 0;
+        }
+        _learnSum += _energy;
+        _floor = (int16_t)((_learnSum + _frames / 2) / _frames);
+        _spread = (int16_t)((_learnDips + _frames / 2) / _frames);
+        if (_floor < MIN_FLOOR) _floor = MIN_FLOOR;
+    }
+
+    int16_t snr = _energy - _floor;
+    int16_t speechSnr = SPEECH_SNR > 4 * _spread ? SPEECH_SNR : 4 * _spread;
+    int16_t voicedSnr = VOICED_SNR > 3 * _spread ? VOICED_SNR : 3 * _spread;
+    bool speech = snr > speechSnr ||
+                  (snr > voicedSnr && _zcrPercent <= VOICED_MAX_ZCR);
+
+    if (!learning && !speech) {
+        // Down in a few frames, up over ~1.3s, so weak speech that slipped
+        // under the thresholds cannot drag the floor along
+        _floor += snr >> (snr < 0 ? 3 : 6);
+        // Spread from the dips only: speech never pulls it up
+        _spread += ((snr < 0 ? -2 * snr : 0) - _spread) >> 4;
+    }
+
+    // Minimum of the last ~2s. Speech always dips somewhere in that time,
+    // so if even the quietest frame counts as speech the noise has risen
+    // (a fan came on) and the floor jumps straight to it.
+    if (_frames == 1 || _energy < _blockMin[_block]) _blockMin[_block] = _energy;
+    if (++_blockFrames == MIN_BLOCK_FRAMES) {
+        _blockFrames = 0;
+        _block = (_block + 1) % MIN_BLOCKS;
+        if (_blocksFull < MIN_BLOCKS) _blocksFull++;
+        _blockMin[_block] = 0x7FFF;
+    }
+    if (speech && !learning && _blocksFull == MIN_BLOCKS) {
+        int16_t recent = _blockMin[0];
+        for (uint8_t i = 1; i < MIN_BLOCKS; i++) {
+            if (_blockMin[i] < recent) recent = _blockMin[i];
+        }
+        if (recent - _floor > speechSnr) {
+            _floor = recent;
+            speech = false;
+        }
+    }
+    if (_floor < MIN_FLOOR) _floor = MIN_FLOOR;
+
+    uint8_t events = VAD_NONE;
+    if (speech) {
+        if (_run < 0xFF) _run++;
+        _quiet = 0;
+        if (!_speaking && _run >= ONSET_FRAMES) {
+            _speaking = true;
+            events |= VAD_SPEECH_START;
+        }
+    } else {
+        _run = 0;
+        if (_speaking && ++_quiet >= _hangoverFrames) {
+            _speaking = false;
+            events |= VAD_SPEECH_END;
+        }
+    }
+    return events;
+}
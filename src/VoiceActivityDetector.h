@@ -0,0 +1,97 @@
+#ifndef VOICE_ACTIVITY_DETECTOR_H
+#define VOICE_ACTIVITY_DETECTOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Energy + zero-crossing voice activity detector, all integer.
+//
+// Audio is high-passed and cut into 20ms frames. Each frame's energy is
+// taken as log2 in Q8 (1.0 = 3dB) and compared with an adaptive noise
+// floor that follows the quiet frames: it drops quickly and rises slowly,
+// and jumps up when nothing in the last two seconds was quiet, so a new
+// steady noise (a fan) stops looking like endless speech. A frame is
+// speech when it is well above the floor, or moderately above it with a
+// low zero-crossing rate (quiet voiced sound; hiss crosses zero far more
+// often). Fluctuating noise raises both margins.
+//
+// Speech starts after ONSET_FRAMES speech frames in a row and ends after
+// `hangoverMs` without one, so pauses between words do not end the turn.
+class VoiceActivityDetector {
+public:
+    enum Event : uint8_t {
+        VAD_NONE = 0,
+        VAD_SPEECH_START = 1,
+        VAD_SPEECH_END = 2
+    };
+
+    VoiceActivityDetector();
+
+    // `hangoverMs`: silence that ends speech, 300-600ms is a good range
+    void begin(uint32_t sampleRate, uint16_t hangoverMs = 400);
+
+    // New turn: relearns the noise floor over the first frames
+    void reset();
+
+    // Returns the Events (OR-ed) that happened inside this chunk
+    uint8_t process(const int16_t* samples, size_t count);
+
+    bool speaking() const { return _speaking; }
+
+    // Audio since the last speech frame; at VAD_SPEECH_END this is the
+    // hangover, i.e. how long ago the speaker really stopped
+    uint32_t quietMs() const { return (uint32_t)_quiet * FRAME_MS; }
+
+    // Last frame, for logging and tuning (Q8 log2 energy)
+    int16_t energy() const { return _energy; }
+    int16_t noiseFloor() const { return _floor; }
+    uint8_t zeroCrossings() const { return _zcrPercent; }  // % of samples
+
+    // Q8 log2, linear between powers of two (0 for 0)
+    static int16_t log2q8(uint32_t v);
+
+private:
+    static const uint8_t FRAME_MS = 20;          // Shorter frames make rumble look like speech
+    static const uint8_t ONSET_FRAMES = 2;       // 40ms of speech to start
+    static const uint8_t LEARN_FRAMES = 10;      // First 200ms set the floor
+    static const int16_t SPEECH_SNR = 3 * 256;   // ~9dB over the floor
+    static const int16_t VOICED_SNR = 3 * 128;   // ~4.5dB if voiced
+    static const uint8_t VOICED_MAX_ZCR = 25;    // % zero crossings
+    static const int16_t MIN_FLOOR = 6 * 256;    // Digital silence is not a floor
+    static const uint16_t HIGHPASS_HZ = 100;
+    static const uint8_t MIN_BLOCK_FRAMES = 25;  // 0.5s
+    static const uint8_t MIN_BLOCKS = 4;         // Minimum over ~2s
+
+    uint8_t endFrame();
+
+    uint32_t _frameSamples;
+    uint16_t _hangoverFrames;
+
+    // High-pass state: pole in Q15, output in Q8
+    int32_t _hpPole;
+    int32_t _hpX;
+    int32_t _hpY;
+    bool _primed;
+    int16_t _prev;
+
+    uint64_t _sumSq;
+    uint32_t _n;
+    uint32_t _crossings;
+
+    int16_t _energy;
+    int16_t _floor;
+    int16_t _spread;        // Twice the mean dip below the floor
+    int32_t _learnSum;      // Energy over the learning frames
+    int32_t _learnDips;     // Twice the dips below the floor, same frames
+    int16_t _blockMin[MIN_BLOCKS];
+    uint8_t _block;
+    uint8_t _blockFrames;
+    uint8_t _blocksFull;
+    uint8_t _zcrPercent;
+    uint16_t _frames;       // Since reset, saturating
+    uint8_t _run;           // Consecutive speech frames
+    uint16_t _quiet;        // Consecutive non-speech frames
+    bool _speaking;
+};
+
+#endif
@@ -11,12 +11,149 @@ WSAudioStreamer::WSAudioStreamer(const char* host, uint16_t port) {
     _port = port;
     _streaming = false;
     _playing = false;
-    lastSoundTime = 0;
+    _streamStartTime = 0;
     _lastRxTime = 0;
+    _playTask = NULL;
+    _i2sEvents = NULL;
+    _captureTask = NULL;
+    _micDropped = 0;
+    _micDmaOverflows = 0;
+    _uplinkOut = NULL;
+    _downlinkOut = NULL;
+    _sendBlock = NULL;
+    _refReadBlock = NULL;
+    _uplinkCodec = CODEC_PCM16;
+    _uplinkFrameMs = 20;
+    _micDroppedSeen = 0;
+    _serverFramed = false;
+    _vadHangoverMs = 400;
+    _heardSpeech = false;
+    _speechEnded = false;
+    _speechEndTime = 0;
+    _commitTime = 0;
+    _awaitingReply = false;
+    _turn = 0;
+    _rxTurn = 0;
+    _turnTagged = false;
+    _acceptReply = true;
+    _staleReplyFrames = 0;
+    _staleLogged = false;
+    _playedAtCommit = 0;
+    _samplesPlayed = 0;
+    _voiceBargeIn = false;
+    _monitoring = false;
+    _bargeIn = false;
+    _preroll = NULL;
+    _prerollLen = 0;
+    _prerollPos = 0;
+    _prerollFill = 0;
+    _echoCancel = false;
+    _echoRefOut = NULL;
+    _playedWritten = 0;
+    _refFlushAt = 0;
+    _refFlushSeen = 0;
+    _playedRead = 0;
+    _refAligned = false;
+    _spoolPartition = NULL;
+    _spooling = false;
+    _replaying = false;
+    _replayLeft = 0;
+    _replayBlock = NULL;
+    _replayTurn = 0;
+    _replayTries = 0;
+    _replayStarted = false;
+    // OpenAI Realtime replies at 24kHz; the backend expects 16kHz speech
+    setSampleRates(24000, 16000, 24000);
+}
+
+void WSAudioStreamer::setSampleRates(uint32_t i2sRate, uint32_t uplinkRate, uint32_t downlinkRate) {
+    _i2sRate = i2sRate;
+    _uplinkRate = uplinkRate;
+    _downlinkRate = downlinkRate;
 }
 
 void WSAudioStreamer::begin() {
     configI2S();
+    _envelope.begin(_i2sRate);
+
+    // Replies arrive faster than they play; with more memory more of one
+    // is queued ahead, past that playReceived() holds the socket back
+    size_t jitterSamples = AudioRingBuffer::fitCapacity(_i2sRate * JITTER_MAX_CAPACITY_MS / 1000,
+                                                        _i2sRate * JITTER_CAPACITY_MS / 1000);
+    if (!_jitter.begin(jitterSamples, _i2sRate * JITTER_TARGET_MS / 1000)) {
+        Serial.println("[AUDIO] ERROR: Failed to allocate jitter buffer!");
+    }
+    if (!_micRing.begin(_i2sRate * MIC_RING_MS / 1000)) {
+        Serial.println("[AUDIO] ERROR: Failed to allocate mic ring!");
+    }
+
+    if (!_uplinkResampler.begin(_i2sRate, _uplinkRate) ||
+        !_downlinkResampler.begin(_downlinkRate, _i2sRate)) {
+        Serial.println("[AUDIO] ERROR: Unsupported sample rate ratio!");
+    }
+    // Worked on sample by sample in loop(): internal RAM
+    AudioMemory::release(_sendBlock);
+    _sendBlock = (int16_t*)AudioMemory::alloc(SEND_BLOCK * sizeof(int16_t), AUDIO_MEM_FAST);
+    AudioMemory::release(_uplinkOut);
+    _uplinkOut = (int16_t*)AudioMemory::alloc(_uplinkResampler.maxOutput(SEND_BLOCK) * sizeof(int16_t), AUDIO_MEM_FAST);
+    AudioMemory::release(_downlinkOut);
+    _downlinkOut = (int16_t*)AudioMemory::alloc(_downlinkResampler.maxOutput(RX_BLOCK) * sizeof(int16_t), AUDIO_MEM_FAST);
+    if (_sendBlock == NULL || _uplinkOut == NULL || _downlinkOut == NULL) {
+        Serial.println("[AUDIO] ERROR: Failed to allocate resampler buffers!");
+    }
+
+    if (!_packetizer.begin(_uplinkRate, _uplinkCodec, _uplinkFrameMs)) {
+        Serial.println("[AUDIO] ERROR: Failed to allocate uplink frame!");
+    }
+    _vad.begin(_uplinkRate, _vadHangoverMs);
+    if (_voiceBargeIn) {
+        AudioMemory::release(_preroll);
+        _prerollLen = _uplinkRate * PREROLL_MS / 1000;
+        _preroll = (int16_t*)AudioMemory::alloc(_prerollLen * sizeof(int16_t));
+        if (_preroll == NULL) {
+            Serial.println("[AUDIO] ERROR: Failed to allocate barge-in pre-roll!");
+            _voiceBargeIn = false;
+        }
+    }
+    if (_echoCancel) {
+        AudioMemory::release(_refReadBlock);
+        _refReadBlock = (int16_t*)AudioMemory::alloc(SEND_BLOCK * sizeof(int16_t), AUDIO_MEM_FAST);
+        AudioMemory::release(_echoRefOut);
+        _echoRefOut = (int16_t*)AudioMemory::alloc(_uplinkResampler.maxOutput(SEND_BLOCK) * sizeof(int16_t), AUDIO_MEM_FAST);
+        if (_refReadBlock == NULL || _echoRefOut == NULL ||
+            !_aec.begin(_uplinkRate, _uplinkRate * ECHO_TAIL_MS / 1000) ||
+            !_playedRing.begin(REF_DEPTH + 4 * DMA_BUF_LEN) ||
+            !_refRing.begin(_i2sRate * MIC_RING_MS / 1000) ||
+            !_echoRefResampler.begin(_i2sRate, _uplinkRate)) {
+            Serial.println("[AUDIO] ERROR: Failed to allocate echo canceller!");
+            _echoCancel = false;
+        }
+    }
+
+    if (_spoolPartition != NULL) {
+        AudioMemory::release(_replayBlock);
+        _replayBlock = (int16_t*)AudioMemory::alloc(SEND_BLOCK * sizeof(int16_t));
+        if (_replayBlock == NULL || !_spoolDevice.begin(_spoolPartition) || !_spool.begin(&_spoolDevice)) {
+            Serial.printf("[AUDIO] ERROR: Cannot open spool partition %s!\n", _spoolPartition);
+            _spoolPartition = NULL;
+        } else if (_spool.pendingBlocks() > 0) {
+            Serial.printf("[WS] %u spooled blocks to replay\n", (unsigned)_spool.pendingBlocks());
+        }
+    }
+
+    Serial.printf("[AUDIO] I2S %u Hz, uplink %u Hz %s, downlink %u Hz, jitter buffer %u ms\n",
+                  _i2sRate, _uplinkRate, audioCodecName(_uplinkCodec), _downlinkRate,
+                  (unsigned)(_jitter.capacity() * 1000ULL / _i2sRate));
+
+    // The speaker gets its own task so a full DMA queue never stalls loop()
+    if (_playTask == NULL) {
+        xTaskCreatePinnedToCore(playbackTask, "playback", 4096, this, 2, &_playTask, 1);
+    }
+    // The mic task outranks everything on core 1: a DMA buffer is only
+    // ~10ms of audio, so it must run as soon as one fills
+    if (_captureTask == NULL) {
+        xTaskCreatePinnedToCore(captureTask, "capture", 4096, this, configMAX_PRIORITIES - 2, &_captureTask, 1);
+    }
 
     ws.begin(_host, _port, "/");
     ws.onEvent([this](WStype_t type, uint8_t * payload, size_t length) {
@@ -26,6 +163,7 @@ void WSAudioStreamer::begin() {
                 break;
             case WStype_DISCONNECTED:
                 Serial.println("[WS] Disconnected");
+                _serverFramed = false;   // The next server may be an older one
                 break;
             case WStype_TEXT:
                 Serial.printf("[WS] RX Text: %s\n", payload);
@@ -33,31 +171,148 @@ void WSAudioStreamer::begin() {
                 if (strncmp((char*)payload, "TXT:", 4) == 0) {
                      _lastRxTime = millis();
                 }
+                // Server understands the framed uplink (see setUplinkCodec)
+                if (strcmp((char*)payload, "UPLINK:framed") == 0) {
+                    _serverFramed = true;
+                }
+                // Server picks the reply audio format
+                if (strncmp((char*)payload, "CODEC:", 6) == 0) {
+                    handleCodecMessage((char*)payload + 6);
+                }
+                // The audio that follows belongs to this turn
+                if (strncmp((char*)payload, "TURN:", 5) == 0) {
+                    _rxTurn = strtoul((char*)payload + 5, NULL, 10);
+                    _turnTagged = true;
+                    if (_rxTurn == _replayTurn) ackReplay();
+                }
                 break;
-            case WStype_BIN:
-                // Received audio data from server -> Write to Speaker
-                Serial.println("[WS] RX Audio Chunk"); // Debug log
+            case WStype_BIN: {
+                // Late audio of a cut or superseded reply must not play
+                if (!replyWanted()) {
+                    // Counted per frame, logged once per cut or superseded turn
+                    _staleReplyFrames++;
+                    if (!_staleLogged) {
+                        _staleLogged = true;
+                        Serial.printf("[WS] Dropping stale reply audio (now on turn %u)\n", (unsigned)_turn);
+                    }
+                    break;
+                }
+                // Received audio data from server -> queue for the speaker task.
+                // Not logged per chunk: that is dozens of lines a second.
                 _lastRxTime = millis();
+                if (_replayTurn == _turn) ackReplay();
+                if (_awaitingReply) {
+                    _awaitingReply = false;
+                    Serial.printf("[LATENCY] COMMIT -> first reply audio: %lu ms\n",
+                                  _lastRxTime - _commitTime);
+                }
 
-                size_t bytesWritten;
-                i2s_write(I2S_NUM_0, payload, length, &bytesWritten, portMAX_DELAY);
+                playReceived(payload, length);
                 break;
+            }
         }
     });
 
     ws.setReconnectInterval(2000);
 }
 
+void WSAudioStreamer::playbackTask(void* arg) {
+    WSAudioStreamer* self = (WSAudioStreamer*)arg;
+    for (;;) {
+        // Barge-in: the queued DMA buffers go too, so the speaker stops
+        // within the block being written now. This also clears the RX
+        // buffers; the mic loses at most the one being filled.
+        if (self->_jitter.applyFlush()) {
+            i2s_zero_dma_buffer(I2S_NUM_0);
+            self->_refFlushAt = self->_playedWritten;
+        }
+
+        // Always a full block: silence while buffering, so the DMA never starves
+        self->_samplesPlayed += self->_jitter.pop(self->_playBlock, PLAY_BLOCK);
+        if (self->_echoCancel) {
+            self->_playedWritten += self->_playedRing.write(self->_playBlock, PLAY_BLOCK);
+        }
+        size_t bytesWritten;
+        i2s_write(I2S_NUM_0, self->_playBlock, sizeof(self->_playBlock), &bytesWritten, portMAX_DELAY);
+    }
+}
+
+void WSAudioStreamer::captureTask(void* arg) {
+    WSAudioStreamer* self = (WSAudioStreamer*)arg;
+    i2s_event_t event;
+    for (;;) {
+        if (xQueueReceive(self->_i2sEvents, &event, portMAX_DELAY) != pdTRUE) continue;
+
+        if (event.type == I2S_EVENT_RX_Q_OVF) {
+            self->_micDmaOverflows++;
+            continue;
+        }
+        if (event.type != I2S_EVENT_RX_DONE) continue; // TX events from the speaker
+
+        // Drain every filled DMA buffer, not just the one that signalled
+        for (;;) {
+            size_t bytesRead = 0;
+            i2s_read(I2S_NUM_0, self->_captureBlock, sizeof(self->_captureBlock), &bytesRead, 0);
+            if (bytesRead == 0) break;
+
+            // The reference advances with the mic whether or not anyone listens
+            size_t count = bytesRead / 2;
+            if (self->_echoCancel) self->readReference(count);
+
+            // Keep the DMA moving even when nobody is listening
+            if (!self->_streaming && !self->_monitoring) continue;
+
+            // Reference first, so loop() always finds it for the mic it reads
+            size_t fit = self->_micRing.space();
+            if (self->_echoCancel) {
+                if (self->_refRing.space() < fit) fit = self->_refRing.space();
+                if (fit > count) fit = count;
+                self->_refRing.write(self->_refBlock, fit);
+            }
+            size_t written = self->_micRing.write(self->_captureBlock, fit < count ? fit : count);
+            if (written < count) self->_micDropped += count - written;
+        }
+    }
+}
+
+void WSAudioStreamer::readReference(size_t count) {
+    // TX and RX run off one clock, so once the depth is right the two
+    // streams stay aligned and only a stall or a flush (which also costs
+    // the mic a DMA buffer) needs a new alignment. Being a little early is
+    // fine, the canceller's span covers it; being late is not.
+    uint32_t flushAt = _refFlushAt;
+    if (flushAt != _refFlushSeen) {
+        _refFlushSeen = flushAt;
+        _refAligned = false;
+    }
+    size_t depth = _playedRing.available();
+    size_t pad = 0;
+    if (!_refAligned || depth > REF_DEPTH + 2 * DMA_BUF_LEN || depth + DMA_BUF_LEN < REF_DEPTH) {
+        if (depth > REF_DEPTH) _playedRead += _playedRing.skip(depth - REF_DEPTH);
+        else pad = REF_DEPTH - depth;
+        _refAligned = true;
+    }
+    if (pad > count) pad = count;
+    memset(_refBlock, 0, pad * sizeof(int16_t));
+
+    size_t n = _playedRing.read(_refBlock + pad, count - pad);
+    // Queued before a flush: it never reached the speaker
+    int32_t muted = (int32_t)(flushAt - _playedRead);
+    if (muted > 0) memset(_refBlock + pad, 0, ((size_t)muted < n ? muted : n) * sizeof(int16_t));
+    _playedRead += n;
+    memset(_refBlock + pad + n, 0, (count - pad - n) * sizeof(int16_t));
+}
+
 void WSAudioStreamer::configI2S() {
     i2s_config_t config = {
         .mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX | I2S_MODE_TX),
-        .sample_rate = 24000, // OpenAI Realtime often uses 24kHz
+        .sample_rate = _i2sRate,
         .bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT,
         .channel_format = I2S_CHANNEL_FMT_ONLY_LEFT, // or RIGHT
         .communication_format = I2S_COMM_FORMAT_STAND_I2S,
         .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1,
-        .dma_buf_count = 4,
-        .dma_buf_len = 256,
+        .dma_buf_count = DMA_BUF_COUNT,
+        .dma_buf_len = DMA_BUF_LEN,
         .use_apll = false
     };
 
@@ -68,7 +323,8 @@ void WSAudioStreamer::configI2S() {
         .data_in_num = I2S_SD_IN
     };
 
-    i2s_driver_install(I2S_NUM_0, &config, 0, NULL);
+    // The event queue wakes the capture task on every filled RX buffer
+    i2s_driver_install(I2S_NUM_0, &config, 8, &_i2sEvents);
     i2s_set_pin(I2S_NUM_0, &pins);
     i2s_zero_dma_buffer(I2S_NUM_0);
 }
@@ -78,17 +334,68 @@ void WSAudioStreamer::startStreaming() {
         Serial.println("[WS] Not connected");
         return;
     }
+    // The user talks over the reply: stop it before the new turn
+    if (replyAudible() || _awaitingReply) interruptReply();
+    _acceptReply = false;
+    if (_replaying) {
+        // The user comes first; the spooled turn is sent again later
+        _replaying = false;
+        ws.sendTXT("CANCEL");
+    }
+
+    _turn++;
+    _staleLogged = false;
     Serial.println("[WS] Sending START (Clear Buffer)");
-    ws.sendTXT("START");
+    sendStart(false);
     // Small delay to allow flush?
     delay(10);
 
+    // Voice barge-in: the user is already mid-sentence, so keep the mic
+    // audio, resampler and VAD running and send the pre-roll first
+    bool resume = _monitoring && _vad.speaking();
+    if (!resume) {
+        // Drop whatever the mic captured before this turn
+        skipCaptured();
+        _vad.reset();
+    }
+    _packetizer.reset();
+    _micDroppedSeen = _micDropped;
+    _heardSpeech = resume;
+    _speechEnded = false;
+    _awaitingReply = false;
     _streaming = true;
-    lastSoundTime = millis();
+    _monitoring = false;   // After _streaming, so the capture task never pauses
+    _streamStartTime = millis();
+    _envelope.reset(); // The reply to this turn starts from scratch
+    if (resume) sendPreroll();
     Serial.println("[AUDIO] Start streaming");
 }
 
 void WSAudioStreamer::stopStreaming() {
+    if (_spooling) {
+        // The tail goes to flash too; the replay sends the COMMIT
+        sendCaptured();
+        _spooling = false;
+        _streaming = false;
+        if (_spool.endRecord()) {
+            Serial.printf("[WS] Turn spooled for replay (%u blocks pending)\n",
+                          (unsigned)_spool.pendingBlocks());
+            // Each block write stalls the flash: worth watching on a new board
+            Serial.printf("[WS] Spool block writes: %u, avg %u us, max %u us\n",
+                          (unsigned)_spoolDevice.writes(), (unsigned)_spoolDevice.averageWriteMicros(),
+                          (unsigned)_spoolDevice.maxWriteMicros());
+        } else {
+            Serial.println("[WS] Spooling failed, turn lost");
+        }
+        return;
+    }
+    // Send the tail still in the ring so the commit covers all of it
+    if (ws.isConnected()) {
+        sendCaptured();
+        // Partial last frame, flagged so the server knows the turn is complete
+        _packetizer.finish();
+        sendUplinkPacket();
+    }
     _streaming = false;
     Serial.println("[AUDIO] Stop streaming");
     sendCommit();
@@ -96,6 +403,10 @@ void WSAudioStreamer::stopStreaming() {
 
 void WSAudioStreamer::stopStreamingNoCommit() {
     _streaming = false;
+    if (_spooling) {
+        _spool.abandonRecord();
+        _spooling = false;
+    }
     Serial.println("[AUDIO] Stop streaming (No Commit)");
     // Do not send COMMIT. Backend will eventually timeout or just ignore the partial buffer.
     // Ideally we send a "CANCEL" message to clear buffer again?
@@ -109,6 +420,14 @@ void WSAudioStreamer::sendCommit() {
     if (ws.isConnected()) {
         Serial.println("[WS] Sending COMMIT");
         ws.sendTXT("COMMIT");
+        _commitTime = millis();
+        _awaitingReply = true;
+        _acceptReply = true;
+        _playedAtCommit = _samplesPlayed;
+        if (_speechEnded) {
+            Serial.printf("[LATENCY] Speech end -> COMMIT: %lu ms\n",
+                          _commitTime - _speechEndTime);
+        }
     } else {
         Serial.println("[WS] Cannot send COMMIT - Disconnected");
     }
@@ -116,8 +435,8 @@ void WSAudioStreamer::sendCommit() {
 
 bool WSAudioStreamer::detectedSilence() {
     if (!_streaming) return false;
-    // If time since last significant sound > duration
-    return (millis() - lastSoundTime > SILENCE_DURATION);
+    if (_speechEnded) return true;
+    return !_heardSpeech && (millis() - _streamStartTime > NO_SPEECH_TIMEOUT);
 }
 
 bool WSAudioStreamer::isTalking() {
@@ -129,36 +448,376 @@ bool WSAudioStreamer::isConnected() {
     return ws.isConnected();
 }
 
+int16_t WSAudioStreamer::mouthLevel() {
+    return _envelope.level(millis());
+}
+
+bool WSAudioStreamer::replyAudible() {
+    return _jitter.playing() || _jitter.depth() > 0 || isTalking();
+}
+
+bool WSAudioStreamer::replyWanted() const {
+    if (!_acceptReply) return false;
+    return !_turnTagged || _rxTurn == _turn;
+}
+
+void WSAudioStreamer::interruptReply() {
+    uint32_t playedMs = (uint32_t)((uint64_t)(_samplesPlayed - _playedAtCommit) * 1000 / _i2sRate);
+
+    // The playback task drops the queue and the DMA buffers on its next
+    // block; audio still in flight on the socket is refused until COMMIT
+    _jitter.flush();
+    _downlinkResampler.reset();
+    _envelope.reset();
+    _acceptReply = false;
+    _awaitingReply = false;
+    _lastRxTime = 0;
+    _staleLogged = false;
+
+    Serial.printf("[AUDIO] Barge-in: reply to turn %u cut after %u ms\n",
+                  (unsigned)_turn, (unsigned)playedMs);
+    if (ws.isConnected()) {
+        char msg[48];
+        snprintf(msg, sizeof(msg), "INTERRUPT turn=%u played_ms=%u",
+                 (unsigned)_turn, (unsigned)playedMs);
+        ws.sendTXT(msg);
+    }
+}
+
+bool WSAudioStreamer::bargeInHeard() {
+    bool heard = _bargeIn;
+    _bargeIn = false;
+    return heard;
+}
+
 void WSAudioStreamer::loop() {
     ws.loop();
 
-    if (_streaming && ws.isConnected()) {
-        size_t bytesRead = 0;
-        i2s_read(I2S_NUM_0, i2sReadBuffer, sizeof(i2sReadBuffer), &bytesRead, 0);
-
-        if (bytesRead > 0) {
-            // 1. Send to WebSocket
-            ws.sendBIN(i2sReadBuffer, bytesRead);
-
-            // 2. Check silence (Use Peak Amplitude)
-            int16_t* samples = (int16_t*)i2sReadBuffer;
-            int numSamples = bytesRead / 2;
-            int32_t peak = 0;
-            for (int i=0; i<numSamples; i++) {
-                int16_t val = abs(samples[i]);
-                if (val > peak) peak = val;
-            }
+    if (_streaming && !_spooling && !ws.isConnected() && _spoolPartition != NULL) {
+        // Link lost mid-turn: keep the rest of it (the frame in the
+        // packetizer went down with the socket)
+        _spooling = _spool.beginRecord();
+        _packetizer.reset();
+        Serial.println("[WS] Link lost, spooling the turn to flash");
+    }
 
-            // Debug audio levels occasionally
-            static unsigned long lastDebugTime = 0;
-            if (millis() - lastDebugTime > 200) { 
-                Serial.printf("[AUDIO] Peak: %d\n", peak);
-                lastDebugTime = millis();
+    if (_streaming && (ws.isConnected() || _spooling)) {
+        sendCaptured();
+    } else if (_voiceBargeIn && !_streaming) {
+        monitorMic();
+    }
+    if (_spoolPartition != NULL && !_streaming) {
+        replaySpooled();
+    }
+}
+
+void WSAudioStreamer::monitorMic() {
+    bool audible = replyAudible();
+    if (audible != _monitoring) {
+        // Each reply starts a fresh watch. The VAD's floor then settles on
+        // the reply's own echo, so only speech well above it counts.
+        skipCaptured();
+        _vad.reset();
+        _prerollFill = 0;
+        _bargeIn = false;
+        _monitoring = audible;
+    }
+    if (!_monitoring) return;
+
+    size_t numSamples;
+    while (readCaptured(numSamples)) {
+        prerollWrite(_uplinkOut, numSamples);
+        if (_vad.process(_uplinkOut, numSamples) & VoiceActivityDetector::VAD_SPEECH_START) {
+            Serial.println("[VAD] Speech during the reply (barge-in)");
+            _bargeIn = true;
+        }
+    }
+}
+
+void WSAudioStreamer::prerollWrite(const int16_t* samples, size_t count) {
+    // Circular: only the newest _prerollLen samples survive
+    while (count > 0) {
+        size_t n = _prerollLen - _prerollPos;
+        if (n > count) n = count;
+        memcpy(_preroll + _prerollPos, samples, n * sizeof(int16_t));
+        _prerollPos = (_prerollPos + n) % _prerollLen;
+        _prerollFill = _prerollFill + n > _prerollLen ? _prerollLen : _prerollFill + n;
+        samples += n;
+        count -= n;
+    }
+}
+
+void WSAudioStreamer::sendPreroll() {
+    // Oldest first: from the write position back around, if it has wrapped
+    size_t start = (_prerollPos + _prerollLen - _prerollFill) % _prerollLen;
+    size_t first = _prerollLen - start;
+    if (first > _prerollFill) first = _prerollFill;
+    queueUplink(_preroll + start, first);
+    queueUplink(_preroll, _prerollFill - first);
+    _prerollFill = 0;
+}
+
+bool WSAudioStreamer::readCaptured(size_t& count) {
+    // One block of mic audio at the uplink rate, echo removed, in _uplinkOut
+    if (_sendBlock == NULL || _uplinkOut == NULL) return false;
+    size_t n = _micRing.read(_sendBlock, SEND_BLOCK);
+    if (n == 0) return false;
+    count = _uplinkResampler.process(_sendBlock, n, _uplinkOut);
+    if (_echoCancel) {
+        // Written before the mic, so all of it is there; the twin resampler
+        // turns the same count into the same count
+        _refRing.read(_refReadBlock, n);
+        _echoRefResampler.process(_refReadBlock, n, _echoRefOut);
+        _aec.process(_uplinkOut, _echoRefOut, _uplinkOut, count);
+    }
+    return true;
+}
+
+void WSAudioStreamer::skipCaptured() {
+    size_t n = _micRing.skip(_micRing.available());
+    _uplinkResampler.reset();
+    if (_echoCancel) {
+        // Same count: the reference ring may hold a block more than the mic
+        _refRing.skip(n);
+        _echoRefResampler.reset();
+        _aec.clearHistory();
+    }
+}
+
+void WSAudioStreamer::sendCaptured() {
+    size_t numSamples;
+    while (readCaptured(numSamples)) {
+        // 1. Send to WebSocket in frames (readCaptured converted the rate)
+        if (numSamples == 0) continue;
+        if (_spooling) {
+            // Raw PCM: the replay encodes it for whatever codec is current
+            _spool.append(_uplinkOut, numSamples * sizeof(int16_t));
+        } else {
+            queueUplink(_uplinkOut, numSamples);
+        }
+
+        // 2. Voice activity on exactly what the server hears
+        uint8_t events = _vad.process(_uplinkOut, numSamples);
+        if (events & VoiceActivityDetector::VAD_SPEECH_START) {
+            _heardSpeech = true;
+            Serial.println("[VAD] Speech start");
+        }
+        if (events & VoiceActivityDetector::VAD_SPEECH_END) {
+            // Back-date to when the audio went quiet: the hangover plus
+            // whatever is still queued in the mic ring behind this block
+            _speechEnded = true;
+            _speechEndTime = millis() - _vad.quietMs()
+                           - _micRing.available() * 1000 / _i2sRate;
+            Serial.println("[VAD] Speech end");
+        }
+
+        // Debug audio levels occasionally (energy in dB, 3dB per log2 step)
+        static unsigned long lastDebugTime = 0;
+        if (millis() - lastDebugTime > 200) {
+            Serial.printf("[AUDIO] Level %d dB, floor %d dB, ZCR %u%% (dropped %u, DMA overflows %u)\n",
+                          _vad.energy() * 3 / 256, _vad.noiseFloor() * 3 / 256,
+                          _vad.zeroCrossings(), _micDropped, _micDmaOverflows);
+            if (_echoCancel) {
+                Serial.printf("[AUDIO] Echo cancelled %d dB%s\n", _aec.erleDb(),
+                              _aec.doubleTalk() ? " (double talk)" : "");
             }
+            lastDebugTime = millis();
+        }
+    }
+}
 
-            if (peak > SILENCE_THRESHOLD) {
-                lastSoundTime = millis();
+void WSAudioStreamer::replaySpooled() {
+    if (!_replaying) {
+        // Only over a quiet link: no reply on its way or playing
+        if (!ws.isConnected() || replyAudible()) return;
+        if (_awaitingReply && millis() - _commitTime < REPLAY_GAP_MS) return;
+        if (_replayTurn != 0) {
+            // Committed but never answered: send it again, or give up
+            _replayTurn = 0;
+            if (_replayTries >= REPLAY_TRIES) {
+                Serial.printf("[WS] Spooled turn unanswered after %u tries, dropped\n",
+                              (unsigned)_replayTries);
+                _replayTries = 0;
+                _spool.consume();
             }
         }
+        if (_spool.pendingBlocks() == 0 || !_spool.nextRecord()) return;
+
+        _turn++;
+        _staleLogged = false;
+        sendStart(true);
+        Serial.printf("[WS] Replaying spooled turn %u (%u ms)\n", (unsigned)_turn,
+                      (unsigned)(_spool.recordBytes() / sizeof(int16_t) * 1000 / _uplinkRate));
+        _acceptReply = false;
+        _packetizer.reset();
+        _micDroppedSeen = _micDropped;
+        _replayLeft = _spool.recordBytes();
+        _replaying = true;
+    }
+    if (!ws.isConnected()) {
+        // Still spooled: sent again from the start on the next link
+        _replaying = false;
+        return;
+    }
+
+    // A few packets per pass, so loop() keeps draining the mic
+    size_t bytes = 1;
+    for (int i = 0; i < REPLAY_BLOCKS && _replayLeft > 0 && bytes > 0; i++) {
+        bytes = _spool.read(_replayBlock, SEND_BLOCK * sizeof(int16_t));
+        _micDroppedSeen = _micDropped;   // Not this audio's
+        queueUplink(_replayBlock, bytes / sizeof(int16_t));
+        _replayLeft -= bytes;
+    }
+    if (_replayLeft > 0 && bytes > 0) return;
+
+    _replaying = false;
+    if (_replayLeft > 0) {
+        Serial.println("[WS] Spooled turn unreadable, dropped");
+        ws.sendTXT("CANCEL");
+        _replayTries = 0;
+        _spool.consume();
+        return;
+    }
+    _packetizer.finish();
+    sendUplinkPacket();
+    _speechEnded = false;
+    sendCommit();
+    // Kept on flash until the server answers this turn
+    _replayTurn = _turn;
+    _replayTries++;
+    _replayStarted = true;
+}
+
+void WSAudioStreamer::ackReplay() {
+    if (_replayTurn == 0) return;
+    Serial.printf("[WS] Spooled turn %u answered\n", (unsigned)_replayTurn);
+    _replayTurn = 0;
+    _replayTries = 0;
+    _spool.consume();
+}
+
+bool WSAudioStreamer::replayStarted() {
+    bool started = _replayStarted;
+    _replayStarted = false;
+    return started;
+}
+
+void WSAudioStreamer::queueUplink(const int16_t* samples, size_t count) {
+    // Tell the server about lost mic audio on the next frame
+    uint32_t dropped = _micDropped;
+    if (dropped != _micDroppedSeen) {
+        _micDroppedSeen = dropped;
+        _packetizer.markDiscontinuity();
+    }
+
+    while (count > 0) {
+        size_t used = _packetizer.write(samples, count);
+        samples += used;
+        count -= used;
+        if (_packetizer.ready()) {
+            sendUplinkPacket();
+        } else if (used == 0) {
+            break; // Not allocated
+        }
+    }
+}
+
+void WSAudioStreamer::sendUplinkPacket() {
+    if (!_packetizer.ready()) return;
+    // A headerless empty last frame says nothing; COMMIT ends the turn
+    if (_packetizer.packetLength() > 0) ws.sendBIN(_packetizer.packet(), _packetizer.packetLength());
+    _packetizer.consume();
+}
+
+void WSAudioStreamer::sendStart(bool replay) {
+    bool framed = uplinkFramed();
+    _packetizer.setHeader(framed);
+    if (!framed) {
+        ws.sendTXT("START");
+        return;
+    }
+    char start[112];
+    snprintf(start, sizeof(start), "START turn=%u codec=%s rate=%u frame_ms=%u%s",
+             (unsigned)_turn, audioCodecName(_uplinkCodec), (unsigned)_uplinkRate,
+             (unsigned)_uplinkFrameMs, replay ? " replay=1" : "");
+    ws.sendTXT(start);
+}
+
+void WSAudioStreamer::playReceived(const uint8_t* payload, size_t length) {
+    if (_downlinkOut == NULL) return;
+    AudioDecoder* decoder = _decoders.current();
+    if (!decoder->begin(payload, length)) {
+        Serial.printf("[AUDIO] Malformed %s frame (%u bytes) skipped\n",
+                      audioCodecName(decoder->codec()), (unsigned)length);
+        return;
+    }
+
+    // Decode a block at a time straight into the playback ring
+    bool overrun = false;
+    size_t n;
+    while ((n = decoder->read(_rxBlock, RX_BLOCK)) > 0) {
+        size_t converted = _downlinkResampler.process(_rxBlock, n, _downlinkOut);
+
+        // Queue full: the reply is streaming faster than it plays. Wait
+        // for the playback task to make room; meanwhile ws.loop() reads
+        // nothing more, so TCP flow control holds the server back.
+        unsigned long waitStart = millis();
+        while (_jitter.space() < converted && millis() - waitStart < JITTER_WAIT_MS) {
+            delay(2);
+        }
+
+        // It plays after what is already queued (plus the DMA buffers)
+        uint32_t playDelay = (uint32_t)((_jitter.depth() + DMA_BUF_COUNT * DMA_BUF_LEN) * 1000ULL / _i2sRate);
+        size_t queued = _jitter.push(_downlinkOut, converted);
+        if (queued < converted) overrun = true;
+        _envelope.push(_downlinkOut, queued, millis() + playDelay);
+    }
+    if (overrun) {
+        // Playback stalled for JITTER_WAIT_MS
+        Serial.println("[AUDIO] Jitter buffer overrun, dropping samples");
+    }
+}
+
+void WSAudioStreamer::handleCodecMessage(const char* args) {
+    // "<name>[ rate=<hz>]"
+    char name[16];
+    size_t len = strcspn(args, " ");
+    if (len >= sizeof(name)) len = sizeof(name) - 1;
+    memcpy(name, args, len);
+    name[len] = 0;
+
+    AudioCodec codec;
+    if (!parseAudioCodec(name, codec)) {
+        Serial.printf("[WS] Unknown downlink codec '%s', keeping %s\n",
+                      name, audioCodecName(downlinkCodec()));
+        return;
+    }
+    // The rate belongs to the codec, so neither changes under a custom decoder
+    if (!_decoders.select(codec)) {
+        Serial.printf("[WS] Custom downlink decoder set, CODEC:%s ignored\n", name);
+        return;
+    }
+    // No filter history carried over from audio in the old format
+    _downlinkResampler.reset();
+
+    const char* rate = strstr(args, "rate=");
+    if (rate != NULL) setDownlinkRate(strtoul(rate + 5, NULL, 10));
+
+    Serial.printf("[WS] Downlink codec %s at %u Hz\n", audioCodecName(codec), (unsigned)_downlinkRate);
+}
+
+void WSAudioStreamer::setDownlinkRate(uint32_t rate) {
+    if (rate == 0 || rate == _downlinkRate) return;
+    if (!_downlinkResampler.begin(rate, _i2sRate)) {
+        Serial.printf("[AUDIO] Unsupported downlink rate %u, keeping %u\n",
+                      (unsigned)rate, (unsigned)_downlinkRate);
+        _downlinkResampler.begin(_downlinkRate, _i2sRate);
+        return;
+    }
+    _downlinkRate = rate;
+    AudioMemory::release(_downlinkOut);
+    _downlinkOut = (int16_t*)AudioMemory::alloc(_downlinkResampler.maxOutput(RX_BLOCK) * sizeof(int16_t), AUDIO_MEM_FAST);
+    if (_downlinkOut == NULL) {
+        Serial.println("[AUDIO] ERROR: Failed to allocate resampler buffers!");
     }
 }
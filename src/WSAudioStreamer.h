@@ -5,43 +5,267 @@
 #include <driver/i2s.h>
 #include <WiFi.h>
 #include <WebSocketsClient.h>
+#include "AudioEnvelope.h"
+#include "JitterBuffer.h"
+#include "Resampler.h"
+#include "AudioCodec.h"
+#include "UplinkPacketizer.h"
+#include "AudioDecoder.h"
+#include "VoiceActivityDetector.h"
+#include "EchoCanceller.h"
+#include "AudioMemory.h"
+#include "SpoolLog.h"
 
 class WSAudioStreamer {
 public:
     WSAudioStreamer(const char* host, uint16_t port);
 
+    // The mic and speaker share one I2S clock (`i2sRate`). Uplink audio is
+    // resampled from it to `uplinkRate`, downlink audio from `downlinkRate`
+    // to it. Call before begin().
+    void setSampleRates(uint32_t i2sRate, uint32_t uplinkRate, uint32_t downlinkRate);
+
+    // Uplink format and frame length (20/40/60ms; longer frames mean fewer
+    // messages but more latency). Call before begin().
+    //
+    // A server that sends "UPLINK:framed" after connecting gets the framed
+    // protocol: "START turn=<id> codec=<name> rate=<hz> frame_ms=<ms>", and
+    // every binary message one frame with the header described in
+    // UplinkPacketizer.h. Any other server gets what it always did: a plain
+    // "START" and raw PCM16, still cut into frames. IMA-ADPCM needs the
+    // framed protocol and always uses it.
+    void setUplinkCodec(AudioCodec codec) { _uplinkCodec = codec; }
+    void setUplinkFrameMs(uint16_t frameMs) { _uplinkFrameMs = frameMs; }
+
+    // Silence after speech that ends the turn (300-600ms). Call before begin().
+    void setVadHangoverMs(uint16_t ms) { _vadHangoverMs = ms; }
+
+    // Watch the mic while a reply plays and report speech through
+    // bargeInHeard(); startStreaming() then carries on from that speech
+    // (with PREROLL_MS before it) instead of starting cold. Call before begin().
+    void setVoiceBargeIn(bool on) { _voiceBargeIn = on; }
+    // True once per interruption heard
+    bool bargeInHeard();
+
+    // Remove the speaker's echo from the uplink audio (see EchoCanceller.h),
+    // with what the playback task actually played as the reference. The
+    // VAD and the server then hear the user, not the reply. Call before begin().
+    void setEchoCancel(bool on) { _echoCancel = on; }
+    // Echo cancelled so far (ERLE), for logging
+    int16_t echoErleDb() const { return _aec.erleDb(); }
+
+    // Store and forward: if the link drops mid-turn, the rest of the turn
+    // goes to a ring log on flash (see SpoolLog.h) instead of being lost.
+    // Once the link is back and idle it is sent as a turn of its own:
+    // START (with replay=1 on the framed protocol), its frames and a
+    // COMMIT. It stays on flash until the server answers that turn (its
+    // TURN:<id> or reply audio), and is sent again if no answer comes
+    // within REPLAY_GAP_MS, up to REPLAY_TRIES times; spooled turns
+    // survive a reset. `partition` is the label of a raw data partition,
+    // e.g. "spool" (see partitions.csv). Call before begin().
+    void setSpool(const char* partition) { _spoolPartition = partition; }
+    // Spooled audio not replayed yet, in flash blocks
+    uint32_t spooledBlocks() const { return _spoolPartition != NULL ? _spool.pendingBlocks() : 0; }
+    // True once per spooled turn committed: its reply is awaited, as
+    // after stopStreaming()
+    bool replayStarted();
+
+    // Downlink format. The server switches between the built-in decoders
+    // with a "CODEC:<name> [rate=<hz>]" text message; a custom decoder can
+    // be plugged in here instead (it must outlive the streamer). While one
+    // is set, CODEC: messages are refused; NULL returns to the built-ins.
+    void setDownlinkDecoder(AudioDecoder* decoder) { _decoders.setCustom(decoder); }
+    AudioCodec downlinkCodec() const { return _decoders.current()->codec(); }
+
     void begin();
     void loop();
 
+    // Each turn gets an ID, sent as "START turn=<id> ..." on the framed
+    // protocol. Once the server tags its replies with "TURN:<id>", audio for any other turn is dropped.
+    // A reply still playing is cut first (see interruptReply).
     void startStreaming();
     void stopStreaming();
     void stopStreamingNoCommit(); // New
     
     void sendCommit(); // New function
 
+    // Barge-in: silence the reply within one DMA period, drop the rest of
+    // it, and tell the server how much was heard with
+    // "INTERRUPT turn=<id> played_ms=<ms>"
+    void interruptReply();
+    // Reply audio is queued, playing, or still arriving
+    bool replyAudible();
+    uint32_t turn() const { return _turn; }
+
+    // True once the user has finished speaking this turn, or never started
+    // within NO_SPEECH_TIMEOUT
     bool detectedSilence();
+    // The user is speaking right now (VAD, uplink audio)
+    bool voiceActive() const { return _vad.speaking(); }
+    // Speech was heard since startStreaming()
+    bool heardSpeech() const { return _heardSpeech; }
     bool isTalking(); // Replaces isPlayingReply with time-based check
     bool isConnected();
 
+    // Loudness of the reply audio playing right now, for lip-sync
+    // (see AudioEnvelope::level)
+    int16_t mouthLevel();
+
+    // Downlink audio queue between the WebSocket and the speaker
+    const JitterBuffer& jitter() const { return _jitter; }
+
+    // Mic samples lost because the send ring was full (loop() too slow)
+    uint32_t micDroppedSamples() const { return _micDropped; }
+    // I2S RX DMA overflows (capture task too slow; the driver dropped a buffer)
+    uint32_t micDmaOverflows() const { return _micDmaOverflows; }
+    // Reply frames dropped as belonging to an interrupted or older turn
+    uint32_t staleReplyFrames() const { return _staleReplyFrames; }
+
 private:
     void configI2S();
+    static void playbackTask(void* arg);
+    static void captureTask(void* arg);
+    void sendCaptured();
+    bool readCaptured(size_t& count);
+    void skipCaptured();
+    void readReference(size_t count);
+    void queueUplink(const int16_t* samples, size_t count);
+    void sendUplinkPacket();
+    void sendStart(bool replay);
+    bool uplinkFramed() const { return _serverFramed || _uplinkCodec != CODEC_PCM16; }
+    void handleCodecMessage(const char* args);
+    void setDownlinkRate(uint32_t rate);
+    void playReceived(const uint8_t* payload, size_t length);
+    bool replyWanted() const;
+    void monitorMic();
+    void prerollWrite(const int16_t* samples, size_t count);
+    void sendPreroll();
+    void replaySpooled();
+    void ackReplay();
     
     const char* _host;
     uint16_t _port;
     
-    bool _streaming;
+    volatile bool _streaming;   // Also read by the capture task
     bool _playing;
     
     WebSocketsClient ws;
 
     // Audio settings
-    static const int SAMPLE_RATE = 16000; // Fixed for OpenAI Realtime usually
-    static const int SILENCE_THRESHOLD = 60; // Increased from 20
-    static const unsigned long SILENCE_DURATION = 3000; // ms
+    uint32_t _i2sRate;
+    uint32_t _uplinkRate;
+    uint32_t _downlinkRate;
 
-    unsigned long lastSoundTime;
+    static const int JITTER_TARGET_MS = 120;  // Buffered before playback starts
+    static const int JITTER_CAPACITY_MS = 600;       // Grows with free memory...
+    static const int JITTER_MAX_CAPACITY_MS = 4000;  // ...up to this (PSRAM), rounded down to 2^n
+    static const unsigned long JITTER_WAIT_MS = 250; // For room in a full queue, then drop
+    static const int PLAY_BLOCK = 256;        // Samples per i2s_write, one DMA buffer
+    static const int DMA_BUF_COUNT = 8;
+    static const int DMA_BUF_LEN = 256;       // Samples
+    static const int MIC_RING_MS = 500;
+    static const int SEND_BLOCK = 512;        // Mic samples per WebSocket packet
+    static const int RX_BLOCK = 256;          // Downlink samples per resampler pass
+    static const unsigned long NO_SPEECH_TIMEOUT = 3000; // ms
+    static const int PREROLL_MS = 300;        // Uplink audio kept before a barge-in
+    static const int ECHO_TAIL_MS = 20;       // Speaker-to-mic span the canceller learns
+    // Played samples queued ahead of the mic block being read: the TX DMA
+    // queue, the block in hand, and the RX block's own length
+    static const int REF_DEPTH = (DMA_BUF_COUNT + 2) * DMA_BUF_LEN;
+    static const int REPLAY_BLOCKS = 4;       // SEND_BLOCKs replayed per loop() pass
+    static const unsigned long REPLAY_GAP_MS = 5000;  // Wait for an answer before sending again
+    static const uint8_t REPLAY_TRIES = 3;    // Then the spooled turn is dropped
+
+    unsigned long _streamStartTime;
     unsigned long _lastRxTime = 0;
-    uint8_t i2sReadBuffer[1024];
+    int16_t* _sendBlock;              // SEND_BLOCK samples, owned by loop()
+
+    // Rate conversion, both run in loop() context
+    Resampler _uplinkResampler;
+    Resampler _downlinkResampler;
+    int16_t* _uplinkOut;
+    int16_t* _downlinkOut;
+
+    // Downlink decoding, loop() context
+    DownlinkDecoders _decoders;
+    int16_t _rxBlock[RX_BLOCK];
+
+    // Uplink framing and encoding, loop() context
+    AudioCodec _uplinkCodec;
+    uint16_t _uplinkFrameMs;
+    UplinkPacketizer _packetizer;
+    uint32_t _micDroppedSeen;   // _micDropped already flagged to the server
+    bool _serverFramed;         // "UPLINK:framed" seen on this connection
+
+    // End-of-speech detection on the uplink audio, loop() context
+    VoiceActivityDetector _vad;
+    uint16_t _vadHangoverMs;
+    bool _heardSpeech;
+    bool _speechEnded;
+
+    // Turns and barge-in, loop() context
+    uint32_t _turn;
+    uint32_t _rxTurn;           // Last "TURN:<id>" from the server
+    bool _turnTagged;           // The server tags its replies
+    bool _acceptReply;          // False from START/interrupt until COMMIT
+    uint32_t _staleReplyFrames;
+    bool _staleLogged;          // Stale audio reported since the last cut or START
+    uint32_t _playedAtCommit;   // _samplesPlayed when this turn's reply began
+    bool _voiceBargeIn;
+    volatile bool _monitoring;  // Mic watched for barge-in; read by the capture task
+    bool _bargeIn;
+    int16_t* _preroll;          // Last PREROLL_MS of uplink audio while monitoring
+    size_t _prerollLen;
+    size_t _prerollPos;
+    size_t _prerollFill;
+
+    // Echo cancellation. The playback task logs each block it plays in
+    // _playedRing; the capture task pairs it with the mic, sample for
+    // sample, in _refRing; loop() runs the canceller at the uplink rate.
+    bool _echoCancel;
+    EchoCanceller _aec;
+    AudioRingBuffer _playedRing;
+    AudioRingBuffer _refRing;
+    Resampler _echoRefResampler;      // Twin of _uplinkResampler
+    int16_t* _echoRefOut;
+    int16_t* _refReadBlock;               // SEND_BLOCK samples, owned by loop()
+    int16_t _refBlock[DMA_BUF_LEN];       // Owned by the capture task
+    volatile uint32_t _playedWritten;     // Samples into _playedRing, playback task
+    volatile uint32_t _refFlushAt;        // _playedWritten at the last barge-in flush
+    uint32_t _refFlushSeen;               // Capture task
+    uint32_t _playedRead;                 // Samples out of _playedRing, capture task
+    bool _refAligned;                     // Capture task
+
+    // Store and forward, loop() context
+    const char* _spoolPartition;
+    PartitionSpoolDevice _spoolDevice;
+    SpoolLog _spool;
+    bool _spooling;             // This turn's audio goes to flash
+    bool _replaying;            // A spooled turn is being sent
+    int16_t* _replayBlock;      // SEND_BLOCK samples
+    size_t _replayLeft;         // Bytes of it still to send
+    uint32_t _replayTurn;       // Committed replay awaiting an answer, 0 = none
+    uint8_t _replayTries;       // Sends of the oldest spooled turn
+    bool _replayStarted;
+
+    // Latency instrumentation ("[LATENCY]" logs)
+    unsigned long _speechEndTime;   // When the user actually stopped talking
+    unsigned long _commitTime;
+    bool _awaitingReply;            // COMMIT sent, no reply audio yet
+
+    AudioEnvelope _envelope;
+    JitterBuffer _jitter;
+    TaskHandle_t _playTask;
+    int16_t _playBlock[PLAY_BLOCK];   // Owned by the playback task
+    volatile uint32_t _samplesPlayed; // Reply samples played, playback task
+
+    // Mic: the capture task fills _micRing, loop() drains it to the socket
+    QueueHandle_t _i2sEvents;
+    TaskHandle_t _captureTask;
+    AudioRingBuffer _micRing;
+    int16_t _captureBlock[DMA_BUF_LEN];   // Owned by the capture task
+    volatile uint32_t _micDropped;
+    volatile uint32_t _micDmaOverflows;
 };
 
 #endif
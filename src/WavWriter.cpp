@@ -0,0 +1,93 @@
+#include "WavWriter.h"
+
+static void put16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+// RIFF chunk size: everything after its own 8 bytes, data padded to even
+static uint32_t riffSize(uint32_t dataBytes) {
+    if (dataBytes == WavWriter::UNKNOWN_SIZE) return WavWriter::UNKNOWN_SIZE;
+    uint64_t size = (uint64_t)WavWriter::HEADER_SIZE - 8 + dataBytes + (dataBytes & 1);
+    return size > 0xFFFFFFFF ? 0xFFFFFFFF : (uint32_t)size;
+}
+
+void WavWriter::header(uint8_t* out, uint32_t sampleRate, uint16_t channels,
+                       uint16_t bitsPerSample, uint32_t dataBytes) {
+    uint16_t blockAlign = channels * ((bitsPerSample + 7) / 8);
+
+    out[0] = 'R'; out[1] = 'I'; out[2] = 'F'; out[3] = 'F';
+    put32(out + 4, riffSize(dataBytes));
+    out[8] = 'W'; out[9] = 'A'; out[10] = 'V'; out[11] = 'E';
+
+    out[12] = 'f'; out[13] = 'm'; out[14] = 't'; out[15] = ' ';
+    put32(out + 16, 16);                      // fmt chunk size
+    put16(out + 20, 1);                       // PCM
+    put16(out + 22, channels);
+    put32(out + 24, sampleRate);
+    put32(out + 28, sampleRate * blockAlign); // Byte rate
+    put16(out + 32, blockAlign);
+    put16(out + 34, bitsPerSample);
+
+    out[36] = 'd'; out[37] = 'a'; out[38] = 't'; out[39] = 'a';
+    put32(out + 40, dataBytes);
+}
+
+WavWriter::WavWriter() {
+    _sink = NULL;
+    _sampleRate = 0;
+    _channels = 1;
+    _bitsPerSample = 16;
+    _dataBytes = 0;
+    _ok = false;
+}
+
+bool WavWriter::begin(WavSink* sink, uint32_t sampleRate, uint16_t channels, uint16_t bitsPerSample) {
+    _sink = sink;
+    _sampleRate = sampleRate;
+    _channels = channels;
+    _bitsPerSample = bitsPerSample;
+    _dataBytes = 0;
+
+    uint8_t h[HEADER_SIZE];
+    header(h, sampleRate, channels, bitsPerSample, UNKNOWN_SIZE);
+    _ok = _sink != NULL && _sink->write(h, HEADER_SIZE) == HEADER_SIZE;
+    return _ok;
+}
+
+size_t WavWriter::write(const void* data, size_t length) {
+    if (!_ok) return 0;
+    // The data size must stay below UNKNOWN_SIZE and keep room for the pad
+    uint32_t room = UNKNOWN_SIZE - 1 - _dataBytes;
+    if (length > room) length = room;
+    size_t written = _sink->write((const uint8_t*)data, length);
+    if (written < length) _ok = false;
+    _dataBytes += (uint32_t)written;
+    return written;
+}
+
+bool WavWriter::finish() {
+    if (_sink == NULL) return false;
+    if (_dataBytes & 1) {
+        uint8_t pad = 0;
+        if (_sink->write(&pad, 1) != 1) _ok = false;
+    }
+    if (!_ok) return false;
+
+    // Only the two size fields change
+    uint8_t h[HEADER_SIZE];
+    header(h, _sampleRate, _channels, _bitsPerSample, _dataBytes);
+    bool patched = _sink->seek(4) && _sink->write(h + 4, 4) == 4 &&
+                   _sink->seek(40) && _sink->write(h + 40, 4) == 4;
+    // Back to the end, in case the caller keeps writing (other chunks)
+    uint32_t end = HEADER_SIZE + _dataBytes + (_dataBytes & 1);
+    if (patched) _sink->seek(end);
+    return patched;
+}
@@ -0,0 +1,61 @@
+#ifndef WAV_WRITER_H
+#define WAV_WRITER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Where a WavWriter puts the file. Sinks that can go back (a flash file)
+// override seek() so the sizes are patched in once the length is known;
+// one-way sinks (a socket) keep the "unknown length" sizes.
+class WavSink {
+public:
+    virtual ~WavSink() {}
+    virtual size_t write(const uint8_t* data, size_t length) = 0;
+    // Move the write position to `position` bytes from the start
+    virtual bool seek(uint32_t position) { (void)position; return false; }
+};
+
+// Canonical 44-byte PCM WAV (RIFF, "fmt " of 16 bytes, "data"), written
+// as it is recorded.
+//
+// begin() writes the header with both sizes at UNKNOWN_SIZE, which
+// streaming readers take as "until the end". finish() pads an odd data
+// chunk to even length as RIFF requires, then seeks back and writes the
+// real sizes. header() builds the same header on its own, for senders that
+// know the length up front or never can.
+class WavWriter {
+public:
+    static const size_t HEADER_SIZE = 44;
+    static const uint32_t UNKNOWN_SIZE = 0xFFFFFFFF;
+
+    // `dataBytes` is the PCM length, or UNKNOWN_SIZE
+    static void header(uint8_t* out, uint32_t sampleRate, uint16_t channels,
+                       uint16_t bitsPerSample, uint32_t dataBytes);
+
+    WavWriter();
+
+    // Returns false if the sink took less than the header
+    bool begin(WavSink* sink, uint32_t sampleRate, uint16_t channels = 1, uint16_t bitsPerSample = 16);
+
+    // Returns bytes written; stops counting at the 4GB RIFF limit
+    size_t write(const void* data, size_t length);
+
+    // Returns false if the sizes could not be patched in (sink not
+    // seekable or a write failed); the file is still readable as a stream
+    bool finish();
+
+    uint32_t dataBytes() const { return _dataBytes; }
+
+private:
+    WavWriter(const WavWriter&);
+    WavWriter& operator=(const WavWriter&);
+
+    WavSink* _sink;
+    uint32_t _sampleRate;
+    uint16_t _channels;
+    uint16_t _bitsPerSample;
+    uint32_t _dataBytes;
+    bool _ok;
+};
+
+#endif
@@ -5,7 +5,9 @@
 #include <WebSocketsClient.h>
 #include "ServoController.h"
 #include "FaceDisplay.h"
+#include "FaceAnimator.h"
 #include "WSAudioStreamer.h"   // NEW CLASS
+#include "AudioMemory.h"
 
 #define TOUCH_PIN 23
 #define SERVO_PITCH_PIN 16
@@ -17,17 +19,69 @@ const char* WIFI_PASS = "jfcJapW8vbXA7rf3";
 
 ServoController servos;
 FaceDisplay face;
+FaceAnimator animator;  // Blinks, glances and the talking mouth at 30 fps
 WSAudioStreamer streamer("192.168.1.106", 3001);   // Your backend WebSocket server
 
-bool eyeOpen = true;
-unsigned long lastBlink = 0;
-const unsigned long BLINK_INTERVAL = 800;
+// IMA-ADPCM is 4x smaller than PCM, but only a backend that opts in to
+// the framed uplink ("UPLINK:framed", see WSAudioStreamer.h) can read it.
+const AudioCodec UPLINK_CODEC = CODEC_PCM16;
+const uint16_t UPLINK_FRAME_MS = 20;
+
+// Hands-free: a tap opens the mic and the VAD closes it, committing as
+// soon as the user stops talking; after each reply the mic reopens for a
+// follow-up. Otherwise hold to talk, and release (+600ms hangover) commits.
+const bool HANDS_FREE = false;
+const unsigned long FOLLOW_UP_DELAY_MS = 300; // Speaker tail and room echo die out first
+const unsigned long WAITING_TIMEOUT_MS = 5000;
+
+// Talking over a reply cuts it and starts a new turn. A tap always does;
+// with VOICE_BARGE_IN the mic is watched while the reply plays. ECHO_CANCEL
+// removes the robot's own voice from the mic first; without it only speech
+// well above that voice gets through. Hands-free only: in hold-to-talk
+// nothing would end the turn it starts.
+const bool ECHO_CANCEL = false;
+const bool VOICE_BARGE_IN = false;
+
+// A turn cut by a dropped link is kept on flash and sent once the link is
+// back: the label of its data partition, "spool" in partitions.csv; NULL
+// drops it. Spooled turns survive a reset.
+const char* SPOOL_PARTITION = NULL;
 
 enum CatState { IDLE, LISTENING, STOPPING, WAITING, RESPONDING };
 CatState state = IDLE;
 
 bool lastTouch = false;
 bool listenStarted = false;
+unsigned long waitingStartTime = 0;
+bool followUpPending = false;     // Hands-free: reopen the mic after the reply
+unsigned long followUpTime = 0;
+
+void startListening() {
+    followUpPending = false;
+    if (!streamer.isConnected()) {
+        Serial.println("[WS] Not connected, can't listen");
+        return;
+    }
+    streamer.startStreaming();
+    state = LISTENING;
+}
+
+void startWaiting() {
+    Serial.println("[STATE] Waiting for response...");
+    state = WAITING;
+    waitingStartTime = millis();
+}
+
+// Hands-free end of turn: commit what was said, or drop a turn with no speech
+void endListening() {
+    if (streamer.heardSpeech()) {
+        streamer.stopStreaming();
+        startWaiting();
+    } else {
+        streamer.stopStreamingNoCommit();
+        state = IDLE;
+    }
+}
 
 void setup() {
     Serial.begin(115200);
@@ -48,9 +102,16 @@ void setup() {
     // ====== HARDWARE ======
     servos.begin(SERVO_PITCH_PIN, SERVO_YAW_PIN, SERVO_ROLL_PIN);
     face.begin();
+    animator.begin(millis(), 33, esp_random());
 
     // ====== AUDIO STREAMER ======
+    streamer.setUplinkCodec(UPLINK_CODEC);
+    streamer.setUplinkFrameMs(UPLINK_FRAME_MS);
+    streamer.setEchoCancel(ECHO_CANCEL);
+    streamer.setVoiceBargeIn(HANDS_FREE && VOICE_BARGE_IN);
+    if (SPOOL_PARTITION != NULL) streamer.setSpool(SPOOL_PARTITION);
     streamer.begin();  // Connect WebSocket + I2S mic + I2S speaker
+    AudioMemory::report();
 }
 
 void loop() {
@@ -74,16 +135,19 @@ void loop() {
             
             // State change logic
             if (buttonState == HIGH) {
-                 // Pressed
+                 // Pressed (also barges in on a reply)
                  if (state == IDLE || state == RESPONDING || state == WAITING) {
-                    Serial.println("[TOUCH] Hold → START listening");
-                    streamer.startStreaming();
-                    state = LISTENING;
+                    Serial.println(HANDS_FREE ? "[TOUCH] Tap → START listening"
+                                              : "[TOUCH] Hold → START listening");
+                    startListening();
                     pressStartTime = millis();
+                } else if (HANDS_FREE && state == LISTENING) {
+                    Serial.println("[TOUCH] Tap → end of turn");
+                    endListening();
                 }
             } else {
-                // Released
-                if (state == LISTENING) {
+                // Released (hands-free leaves the end of turn to the VAD)
+                if (state == LISTENING && !HANDS_FREE) {
                     long duration = millis() - pressStartTime;
                     if (duration < 500) {
                          Serial.println("[TOUCH] Short press ignored");
@@ -101,15 +165,23 @@ void loop() {
     }
 
     // ============================================================
-    // STOPPING State (Deprecated in VAD mode, but keep logic safe)
+    // End of speech (hands-free): commit the moment the VAD says so
+    // ============================================================
+    if (HANDS_FREE && state == LISTENING && streamer.detectedSilence()) {
+        Serial.println(streamer.heardSpeech() ? "[VAD] End of speech → COMMIT"
+                                              : "[VAD] Nothing said → cancel");
+        endListening();
+    }
+
+    // ============================================================
+    // STOPPING State (hold-to-talk only)
     // ============================================================
     if (state == STOPPING) {
         if (millis() - stoppingStartTime > 600) {
              Serial.println("[STATE] Hangover done → STOP streaming");
+             // The streamer logs "[LATENCY] Speech end -> COMMIT" as it commits
              streamer.stopStreaming();
-             Serial.println("[STATE] Waiting for response...");
-             state = WAITING;
-             // Reset waiting failsafe timer logic (handled in loop)
+             startWaiting();
         }
     }
 
@@ -119,27 +191,27 @@ void loop() {
     // Check if we are receiving audio (isTalking)
     // Note: isTalking() is updated by WSAudioStreamer::loop()
     
-    // In Hold-to-talk, we ignore interruptions usually, but let's allow it to cancel listening?
-    // Actually, if AI starts talking while we are LISTENING, it means we should probably stop?
-    // But in hold-to-talk, the user is king. Let's stick to simple logic.
+    // Barge-in by voice: the streamer stops the reply and carries the
+    // speech it already heard into the new turn
+    if ((state == WAITING || state == RESPONDING) && streamer.bargeInHeard()) {
+        Serial.println("[VOICE] Barge-in → START listening");
+        startListening();
+    }
+
+    // A spooled turn went out on its own: wait for its reply like any other
+    if (streamer.replayStarted() && state == IDLE) {
+        startWaiting();
+    }
 
     if (state == WAITING) {
         if (streamer.isTalking()) {
              Serial.println("[VOICE] Response STARTED");
              state = RESPONDING;
-        }
-        // Failsafe: If waiting too long (e.g. 5s) without response, go back to IDLE
-        static unsigned long waitingStart = 0;
-        if (waitingStart == 0) waitingStart = millis(); // Capture start time
-        
-        if (millis() - waitingStart > 5000) {
+        } else if (millis() - waitingStartTime > WAITING_TIMEOUT_MS) {
+             // Failsafe: waited too long without a response
              Serial.println("[TIMEOUT] No response from AI, returning to IDLE");
              state = IDLE;
-             waitingStart = 0; // Reset
         }
-    } else {
-        // Reset timer when not in waiting
-        static unsigned long waitingStart = 0; 
     }
 
     if (state == RESPONDING) {
@@ -149,18 +221,32 @@ void loop() {
              // So if it returns false, it's been > 500ms
              Serial.println("[VOICE] Reply finished");
              state = IDLE;
+             if (HANDS_FREE) {
+                 followUpPending = true;
+                 followUpTime = millis();
+             }
         }
     }
 
+    // Hands-free follow-up: listen again once the reply has fully played
+    if (state == IDLE && followUpPending && streamer.jitter().depth() == 0 &&
+        millis() - followUpTime > FOLLOW_UP_DELAY_MS) {
+        Serial.println("[STATE] Listening for a follow-up");
+        startListening();
+    }
+
     // ============================================================
     // FACE EXPRESSION
     // ============================================================
-    if (state == IDLE) {
-        if (millis() - lastBlink > BLINK_INTERVAL) {
-            lastBlink = millis();
-            eyeOpen = !eyeOpen;
-        }
-        face.drawIdle(eyeOpen);
+    // Idle and speaking faces move on the animator's frame clock; the
+    // others are static sprites that cost nothing while unchanged
+    animator.setIdle(state == IDLE, millis());
+    animator.setSpeaking(state == RESPONDING, millis());
+    animator.setMouthLevel(state == RESPONDING ? streamer.mouthLevel() : -1);
+    bool newPose = animator.update(millis());
+
+    if (state == IDLE || state == RESPONDING) {
+        if (newPose) face.drawAnimated(animator.pose());
     }
     else if (state == LISTENING || state == STOPPING) {
         face.drawListening();
@@ -168,9 +254,6 @@ void loop() {
     else if (state == WAITING) {
         face.drawWaiting();
     }
-    else if (state == RESPONDING) {
-        face.drawSpeaking();
-    }
 
     // ============================================================
     // SERVO BEHAVIOR
@@ -0,0 +1,69 @@
+#ifndef BEST_FRIEND_CRCS_H
+#define BEST_FRIEND_CRCS_H
+
+#include <stdint.h>
+
+// CRC-32 (zlib) of each of the 294 best_friend frames as they were in
+// animations/best_friend.cpp before packing: 128x64, image2cpp row order
+// (drawBitmap), 70ms each. The bitmaps themselves are 300KB, so the
+// decoder test checks its output against these instead.
+
+static const uint16_t BEST_FRIEND_FRAME_COUNT = 294;
+static const uint16_t BEST_FRIEND_FRAME_MS = 70;
+
+// All frames back to back
+static const uint32_t BEST_FRIEND_CLIP_CRC = 0x7a645a6d;
+
+static const uint32_t bestFriendFrameCrcs[BEST_FRIEND_FRAME_COUNT] = {
+0x6e8dd9c9, 0x4edcb952, 0x3b14579f, 0x1f0ffef6, 0x4fbde6bb, 0x82796de6,
+0x253f17f1, 0x8365a6ca, 0x408ffa7e, 0x35632f54, 0x1c93edb0, 0x2ff2f0af,
+0xab3b7002, 0x6e474bb8, 0xf5eb943e, 0x7c49de4d, 0xb13aa22e, 0x06fbc31b,
+0x8767688d, 0xa15452ae, 0x5aad2cf6, 0xf0b655cd, 0x6e06c012, 0xf825ee32,
+0x1f1d6532, 0x4bdf1860, 0x25aedeb6, 0x0a996850, 0xbcd6a30e, 0x78e85861,
+0x56646d98, 0x4c0bec9b, 0x4ce240db, 0x5b10f4a1, 0x4555dc15, 0x1f831212,
+0x956c3c56, 0x96b47100, 0xd919115f, 0x7db61ba3, 0x7232f7aa, 0x42bc48b2,
+0xb0190c49, 0xe20a8080, 0x2ba344c4, 0xf384aa8d, 0x79e9faa3, 0xc58ebf90,
+0xeddb4ec7, 0xbcec786d, 0x89e3b143, 0x8c52a7d8, 0xd5fb8c4a, 0x1b8bd069,
+0xa9f9ac5e, 0xfce8731a, 0xa7fb27b7, 0xa82a1ac1, 0xcf1bf508, 0xf6181b68,
+0x86085c0d, 0xfcef7f23, 0x6adac827, 0x2a93f5d3, 0x202db893, 0xe184609b,
+0xb5341a92, 0xee926dcc, 0x11daa2e0, 0x297d2664, 0x67c27755, 0xf9defd43,
+0x4945c05c, 0x2596f679, 0x20604f76, 0xd312f800, 0xc4a14350, 0x8eff4102,
+0xfde6cd3d, 0xf95f554d, 0x53fe309b, 0x1c254886, 0xab8c0c56, 0xec155d38,
+0x5640f815, 0xef3dcbce, 0x08e175fd, 0xb0289828, 0xe36baa4a, 0x65b701d3,
+0x6d974aaa, 0x340dabcb, 0x5aa00677, 0xb0f496ee, 0xf4368685, 0xabb2330d,
+0xd67158c3, 0x13230289, 0xb4ddfaee, 0xb2ff807b, 0x931f403d, 0x36ececca,
+0x44d4025a, 0x23926f0e, 0xfb69acd5, 0x4a19beae, 0xa3201075, 0xcc69734b,
+0x11a6d69a, 0x62ccc7e5, 0x7016391f, 0xa67cfd30, 0x722724fc, 0xd11af8a3,
+0x62217090, 0x87501421, 0x697f7b51, 0x6f3b5f4d, 0x224aac41, 0x9df56ca3,
+0x2f41472a, 0x34a14ede, 0x4e180793, 0xa174c0ea, 0xa8896481, 0xf48bffb0,
+0x685ae38f, 0x76101985, 0x2c058242, 0x95871c98, 0xf23d5ebe, 0x812bc5b7,
+0xd807bcf5, 0xd786e00f, 0xcfebe61d, 0x08b7d21d, 0xec5cfe3b, 0xb0239392,
+0x9eabce91, 0xf331bb7d, 0x02a122b9, 0x77f3cd2f, 0xc860226f, 0x2a9f34e0,
+0xe4607111, 0x5cda437e, 0xf4e7283a, 0xdf550d1d, 0xf9229569, 0x070de054,
+0xe0ae9659, 0xa3911154, 0xc79fec28, 0x52cea664, 0x24479e6c, 0x0ecd4028,
+0x3e6b8106, 0x791287f9, 0x4576cd41, 0xc79037e6, 0x0a4ab6d8, 0xa8db507d,
+0x9470c696, 0x3f2bd95a, 0xac6759ae, 0xc53dc084, 0x3dde6294, 0x39514d3e,
+0x6f494b55, 0x9e712af5, 0x7bd598f5, 0x842dfb16, 0x8f01b8bf, 0xd8f87d1d,
+0x7d8872cc, 0x4eeaf22a, 0xc56b00ab, 0x5df210bf, 0x5a41e53a, 0x550e93b8,
+0x25e65169, 0x1052e950, 0xa4bd3003, 0x9ea2ebd4, 0x59616f66, 0x4b9da8ee,
+0x06b71b82, 0x2bca8c49, 0x8abaf199, 0xc9c17933, 0x2950560b, 0x3d22e30c,
+0x65dfe8f5, 0xdfd21920, 0x1f44b131, 0x11d202ad, 0x91f00ac3, 0x1f4f7ad4,
+0x4c3a734b, 0xdebcda46, 0x772ce84f, 0x11ce5578, 0x13d854b0, 0xc4459f42,
+0xea1f0191, 0x554dede3, 0xbad8b82d, 0xa8e99cdd, 0x4911ea66, 0xf54faf8d,
+0x9b264306, 0x4262db37, 0x3eac6bc7, 0x800a01b9, 0xe8d658e2, 0x5ea269f2,
+0x3e911ca6, 0x3b5c840b, 0x9619ae2f, 0xbd715fed, 0xb0058a28, 0xa9d7d5d8,
+0x758f55f7, 0xcd9fb508, 0x4f4b4827, 0x41454c90, 0xe5004c2a, 0xfa9d58dd,
+0x9a50694d, 0x12db370a, 0x3e98d78c, 0x184afc90, 0x3834a465, 0x022118d1,
+0x3a12d3fc, 0xbba5d93e, 0x94fcc732, 0x57149eee, 0xaea639fb, 0x83c23878,
+0x94d8f73c, 0x84266fa0, 0x0c21fd29, 0xed20d643, 0x01ba6684, 0x294a9e54,
+0x83ebec7a, 0x0f6dcc17, 0xd427a587, 0x9394d9a4, 0x3bcf9568, 0xb3d6d187,
+0xab5d61cd, 0x8eb546f9, 0x37450a08, 0x956eee1b, 0xf2b2ee6f, 0x28cef924,
+0x75c31827, 0x908f4a0d, 0x3ce5c9be, 0x4b1166cb, 0x8a788789, 0x68da1530,
+0x3f8bbae6, 0x6fe0f3fb, 0x059b85ee, 0x8ae96283, 0xc5e51d4b, 0x5aefd978,
+0x2d4bb0d9, 0x001e0e09, 0xfe421934, 0x38ef1250, 0x64152c8d, 0x9493bf1d,
+0x322574b6, 0x0d05a033, 0x1233937a, 0xaa81c556, 0x2facf096, 0x392b36a9,
+0x6875512f, 0xcbcf3d27, 0x5f1214c3, 0xc06c183d, 0x95266744, 0x46661090,
+0x28d596b4, 0x09751838, 0xd8994aeb, 0x27103679, 0xc654d01f, 0xc654d01f
+};
+
+#endif
@@ -0,0 +1,3468 @@
+#ifndef BEST_FRIEND_PACK_H
+#define BEST_FRIEND_PACK_H
+
+#include "FramePack.h"
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+// The pack compiled into animations/best_friend.cpp, copied verbatim so the
+// tests decode exactly what the firmware ships. Regenerate both with gif2pack.
+namespace best_friend {
+
+// 294 frames, 54219 bytes packed (301056 raw), SSD1306 page layout. Format: see src/FramePack.h
+const uint8_t PROGMEM frameData[] = {
+0x00, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xff, 0x01, 0x7f, 0x1f, 0x80, 0x3f, 0x01, 0x1f, 0x1f, 0x80, 
+0xff, 0x04, 0x1f, 0x7f, 0xff, 0xff, 0x1f, 0x80, 0xff, 0x02, 0xbf, 0x1f, 0x3f, 0xc6, 0xff, 0x07, 
+0x3f, 0x1f, 0x9f, 0x8f, 0xcf, 0xe7, 0xe7, 0xe3, 0x82, 0xf3, 0x07, 0xe3, 0xe7, 0xe7, 0xcf, 0x8f, 
+0x1f, 0x3f, 0x7f, 0x8a, 0xff, 0x00, 0xfe, 0x83, 0xc0, 0x0e, 0xcc, 0xc0, 0xc0, 0x80, 0x80, 0x99, 
+0xc1, 0xc0, 0xc1, 0xc1, 0xdf, 0xc3, 0xc0, 0xc0, 0xcf, 0xc2, 0xff, 0x03, 0x07, 0x01, 0xf0, 0xfc, 
+0x8f, 0xff, 0x04, 0xfe, 0xfc, 0xe0, 0x03, 0x0f, 0xe2, 0xff, 0x04, 0xf0, 0xc0, 0x07, 0x1f, 0x7f, 
+0x82, 0xff, 0x02, 0x8f, 0x87, 0xcf, 0x83, 0xff, 0x07, 0xf3, 0xf1, 0xf3, 0x7f, 0x1f, 0x87, 0xc0, 
+0xf8, 0xe5, 0xff, 0x06, 0xfe, 0xfc, 0xf8, 0xf9, 0xf3, 0xf3, 0xe3, 0x84, 0xe7, 0x06, 0xe3, 0xf3, 
+0xf1, 0xf9, 0xf8, 0xfc, 0xfe, 0xbd, 0xff, 0x00, 0xfe, 0xf0, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xab, 0xff, 0x06, 0x7f, 0x1f, 0x0f, 0xc7, 0xe7, 0xf3, 0xf3, 0x80, 0xf9, 0x81, 0xfc, 
+0x80, 0xf9, 0x06, 0xf1, 0xf3, 0xe3, 0xc7, 0x8f, 0x1f, 0x7f, 0x89, 0xff, 0x02, 0x3f, 0x03, 0x03, 
+0x82, 0x7f, 0x04, 0xff, 0x7f, 0x7f, 0x01, 0x00, 0xca, 0xff, 0x03, 0xaf, 0x01, 0x00, 0xfe, 0x91, 
+0xff, 0x03, 0xfe, 0x00, 0x00, 0x9f, 0x87, 0xff, 0x0c, 0xf0, 0xfc, 0xf8, 0xe0, 0xe0, 0xf6, 0xfe, 
+0xf0, 0xfc, 0xf0, 0xf7, 0xf3, 0xf0, 0xcb, 0xff, 0x06, 0xf8, 0xe0, 0xc3, 0x8f, 0x1f, 0x3f, 0x7f, 
+0x80, 0xff, 0x80, 0xc3, 0x00, 0xef, 0x82, 0xff, 0x06, 0x77, 0x33, 0x13, 0x8f, 0xc3, 0xe0, 0xf8, 
+0xe8, 0xff, 0x03, 0xfe, 0xfc, 0xfc, 0xf8, 0x85, 0xf9, 0x03, 0xf8, 0xfc, 0xfc, 0xfe, 0xc1, 0xff, 
+0x00, 0xfe, 0xd0, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xab, 
+0x00, 0x09, 0x40, 0x00, 0x80, 0x20, 0x04, 0x02, 0x0a, 0x00, 0x01, 0x05, 0x81, 0x00, 0x01, 0x05, 
+0x01, 0x82, 0x00, 0x00, 0x80, 0xe5, 0x00, 0x03, 0xac, 0x01, 0xf8, 0x01, 0x83, 0x00, 0x00, 0x80, 
+0x8a, 0x00, 0x03, 0x02, 0x00, 0x01, 0x60, 0xe1, 0x00, 0x03, 0x01, 0x00, 0x00, 0x04, 0x81, 0x00, 
+0x05, 0x02, 0x07, 0x05, 0x33, 0x02, 0x42, 0x80, 0x63, 0x09, 0x7f, 0x06, 0x83, 0x0f, 0x0b, 0x0a, 
+0x08, 0x02, 0x10, 0x04, 0xeb, 0x00, 0x01, 0x04, 0x01, 0x83, 0x00, 0x03, 0x05, 0x04, 0x00, 0x02, 
+0xff, 0x00, 0xb4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xab, 0x00, 0x08, 0xc0, 0x20, 
+0x90, 0x68, 0x24, 0x16, 0x0a, 0x0a, 0x09, 0x83, 0x05, 0x05, 0x01, 0x08, 0x02, 0x10, 0x04, 0x08, 
+0xe6, 0x00, 0x03, 0xfc, 0x03, 0xf8, 0x03, 0x81, 0x00, 0x03, 0x80, 0xc0, 0x40, 0x80, 0x83, 0x00, 
+0x02, 0x80, 0xc0, 0x80, 0x80, 0x00, 0x03, 0x02, 0xe0, 0x00, 0xf0, 0xe1, 0x00, 0x1b, 0x01, 0x00, 
+0x00, 0x44, 0x80, 0x20, 0x40, 0x80, 0x03, 0x04, 0x06, 0x0a, 0x38, 0x70, 0x75, 0x65, 0x64, 0x78, 
+0x05, 0x82, 0x86, 0x47, 0x26, 0x98, 0x46, 0x30, 0x0c, 0x01, 0xe6, 0x00, 0x06, 0x01, 0x02, 0x00, 
+0x04, 0x05, 0x01, 0x08, 0x82, 0x0a, 0x05, 0x05, 0x05, 0x04, 0x02, 0x02, 0x01, 0xff, 0x00, 0xb2, 
+0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xac, 0x00, 0x08, 0x40, 0x00, 0x00, 0x08, 0x00, 
+0x14, 0x00, 0x02, 0x08, 0x82, 0x00, 0x07, 0x08, 0x02, 0x00, 0x04, 0x20, 0x40, 0x10, 0x20, 0xe7, 
+0x00, 0x01, 0x04, 0x01, 0x8a, 0x00, 0x02, 0x40, 0x00, 0x40, 0x81, 0x00, 0x02, 0x10, 0x00, 0x08, 
+0x85, 0x00, 0x02, 0xe0, 0x00, 0xc0, 0x84, 0x00, 0x01, 0xc0, 0xc0, 0xd5, 0x00, 0x13, 0x01, 0x02, 
+0x02, 0x03, 0x00, 0x09, 0x01, 0x01, 0x04, 0x06, 0x03, 0x00, 0x01, 0x80, 0x40, 0x20, 0x88, 0x01, 
+0x10, 0x02, 0x82, 0x00, 0x15, 0x10, 0x18, 0x18, 0xff, 0x08, 0xff, 0x30, 0x70, 0xe0, 0xe0, 0x20, 
+0x20, 0xe8, 0xff, 0xff, 0x0c, 0x74, 0x78, 0x58, 0x68, 0x60, 0xe0, 0xce, 0x00, 0x03, 0x01, 0x00, 
+0x08, 0x02, 0x82, 0x00, 0x06, 0x0a, 0x08, 0x01, 0x04, 0x00, 0x02, 0x01, 0x88, 0x00, 0x0c, 0x02, 
+0x07, 0x00, 0x03, 0x00, 0x00, 0x07, 0x03, 0x02, 0x02, 0x07, 0x07, 0x03, 0x80, 0x00, 0x80, 0x03, 
+0x00, 0x01, 0xff, 0x00, 0x92, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xad, 0x00, 0x07, 
+0x20, 0x10, 0x40, 0x28, 0x00, 0x14, 0x10, 0x02, 0x82, 0x0a, 0x08, 0x12, 0x14, 0x34, 0x28, 0x48, 
+0x90, 0x20, 0x40, 0x80, 0xe3, 0x00, 0x03, 0xf0, 0x00, 0xe0, 0x04, 0x81, 0x00, 0x00, 0x80, 0x8b, 
+0x00, 0x04, 0x03, 0x0e, 0xf1, 0x06, 0xf8, 0xe1, 0x00, 0x0c, 0x07, 0x18, 0x63, 0x9c, 0x30, 0x40, 
+0x80, 0x00, 0x00, 0x02, 0x02, 0x07, 0x04, 0x80, 0x08, 0x03, 0x0c, 0x01, 0x00, 0x01, 0x80, 0x00, 
+0x04, 0x20, 0x08, 0x01, 0x10, 0x03, 0xe5, 0x00, 0x06, 0x01, 0x02, 0x04, 0x0d, 0x0a, 0x0a, 0x16, 
+0x83, 0x14, 0x04, 0x00, 0x02, 0x08, 0x01, 0x04, 0xff, 0x00, 0xb3, 0x00, 0x01, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xab, 0x00, 0x08, 0x80, 0x40, 0x20, 0x10, 0x40, 0x28, 0x00, 0x04, 0x10, 0x87, 
+0x00, 0x03, 0x10, 0x00, 0x40, 0x80, 0xe4, 0x00, 0x04, 0x08, 0x02, 0x18, 0x02, 0x01, 0x80, 0x00, 
+0x00, 0x80, 0x8a, 0x00, 0x04, 0x01, 0x00, 0x30, 0x02, 0x18, 0xe2, 0x00, 0x1a, 0x08, 0x20, 0x8c, 
+0x00, 0x40, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x00, 0x10, 0x10, 0x14, 0x10, 0x0e, 0x00, 
+0x01, 0x00, 0x80, 0x40, 0x10, 0x86, 0x20, 0x0c, 0xe5, 0x00, 0x03, 0x01, 0x02, 0x04, 0x01, 0x80, 
+0x00, 0x00, 0x04, 0x82, 0x00, 0x07, 0x14, 0x00, 0x02, 0x08, 0x01, 0x04, 0x02, 0x01, 0x86, 0x00, 
+0x01, 0xf0, 0xf8, 0xfb, 0x00, 0x20, 0x1f, 0xff, 0xcc, 0xcc, 0x6c, 0x38, 0xf8, 0xd8, 0x98, 0x80, 
+0xf0, 0xf8, 0xcc, 0x8c, 0xf0, 0xf8, 0x8c, 0xcc, 0xf8, 0xb0, 0xf0, 0x80, 0xf0, 0x70, 0x3c, 0xf6, 
+0xb6, 0xf4, 0xf0, 0xf0, 0xd8, 0xd8, 0x58, 0x89, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
+0xab, 0x00, 0x0b, 0x40, 0x20, 0x90, 0x40, 0x08, 0x00, 0x14, 0x10, 0x00, 0x00, 0x02, 0x02, 0x80, 
+0x00, 0x00, 0x10, 0xea, 0x00, 0x04, 0xf0, 0x06, 0xc1, 0x04, 0x01, 0x83, 0x00, 0x01, 0x40, 0x80, 
+0x85, 0x00, 0x06, 0x40, 0x00, 0x00, 0x04, 0xc0, 0x00, 0xe0, 0xe1, 0x00, 0x02, 0x03, 0x10, 0x01, 
+0x83, 0x00, 0x12, 0x02, 0x00, 0x00, 0x0b, 0x0e, 0x03, 0x03, 0x07, 0x03, 0x02, 0x01, 0x00, 0x80, 
+0x40, 0x20, 0x88, 0x41, 0x10, 0x03, 0xe7, 0x00, 0x05, 0x04, 0x00, 0x08, 0x00, 0x00, 0x10, 0x80, 
+0x04, 0x08, 0x14, 0x14, 0x00, 0x02, 0x08, 0x01, 0x04, 0x02, 0x01, 0xff, 0x00, 0xb2, 0x00, 0x01, 
+0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaa, 0x00, 0x06, 0x80, 0x00, 0x00, 0x40, 0x08, 0x20, 0x04, 
+0x80, 0x00, 0x02, 0x02, 0x00, 0x02, 0x80, 0x00, 0x06, 0x14, 0x00, 0x08, 0x40, 0x80, 0x20, 0x80, 
+0xe4, 0x00, 0x03, 0x0c, 0x01, 0x38, 0x02, 0x82, 0x00, 0x02, 0x80, 0xc0, 0x80, 0x84, 0x00, 0x07, 
+0x40, 0x40, 0x80, 0x00, 0x02, 0x18, 0x01, 0x1c, 0xe2, 0x00, 0x04, 0x0c, 0x20, 0x46, 0x10, 0x20, 
+0x80, 0x00, 0x05, 0x18, 0x3d, 0x1c, 0xe3, 0xec, 0xec, 0x80, 0xfc, 0x09, 0x7c, 0x0c, 0x0e, 0x0e, 
+0x00, 0x00, 0x10, 0x46, 0x20, 0x0c, 0xe8, 0x00, 0x05, 0x04, 0x00, 0x08, 0x00, 0x00, 0x10, 0x83, 
+0x00, 0x02, 0x08, 0x00, 0x04, 0xff, 0x00, 0xb5, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
+0xaa, 0x00, 0x06, 0x80, 0xc0, 0xe0, 0x30, 0x38, 0x18, 0x1c, 0x80, 0x0c, 0x01, 0x0e, 0x0e, 0x81, 
+0x0c, 0x05, 0x18, 0x18, 0x30, 0x70, 0xe0, 0xc0, 0xe3, 0x00, 0x06, 0x80, 0xc0, 0x1c, 0x8f, 0x37, 
+0x19, 0x18, 0x80, 0x0c, 0x01, 0x04, 0x04, 0x81, 0x06, 0x01, 0x04, 0x04, 0x80, 0x0c, 0x07, 0x98, 
+0x98, 0x38, 0x70, 0xe3, 0xdf, 0x7e, 0xe0, 0xdf, 0x00, 0x0d, 0x1f, 0x3f, 0xf3, 0xcf, 0xbf, 0x18, 
+0x80, 0x20, 0x60, 0xc0, 0xc0, 0x98, 0xbe, 0x1f, 0x82, 0xe0, 0x0a, 0x60, 0xa0, 0xc0, 0xef, 0xef, 
+0xc0, 0x40, 0x30, 0xcd, 0x60, 0x1d, 0xe2, 0x00, 0x13, 0x01, 0x01, 0x03, 0x03, 0x07, 0x04, 0x00, 
+0x09, 0x01, 0x03, 0x03, 0x10, 0x12, 0x12, 0x10, 0x01, 0x03, 0x0b, 0x01, 0x01, 0x80, 0x00, 0x00, 
+0x01, 0xff, 0x00, 0xb2, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xa8, 0x00, 0x03, 0x80, 0xc0, 0xe0, 
+0x60, 0x80, 0x70, 0x04, 0x60, 0x60, 0xe0, 0xc0, 0x80, 0xef, 0x00, 0x04, 0xfc, 0xff, 0x07, 0xe1, 
+0x80, 0x81, 0x00, 0x09, 0x08, 0x7c, 0xf8, 0xe0, 0x01, 0x03, 0x0e, 0x3c, 0xf0, 0xc0, 0xea, 0x00, 
+0x1d, 0x3f, 0xff, 0x40, 0xcf, 0xff, 0x7e, 0xf0, 0xd8, 0x78, 0x3c, 0x3c, 0xfc, 0xd4, 0x1c, 0x3e, 
+0x7e, 0xd6, 0x86, 0x0b, 0xfb, 0xcc, 0x0c, 0x0c, 0x18, 0x18, 0x38, 0x70, 0xe0, 0xc0, 0x80, 0xe0, 
+0x00, 0x1d, 0x1e, 0x38, 0xfd, 0xfe, 0xf7, 0x9f, 0x90, 0x20, 0x60, 0xc0, 0xc0, 0x87, 0x9e, 0x00, 
+0x80, 0xc1, 0xe7, 0x7e, 0x1f, 0x81, 0xc0, 0xc0, 0xe0, 0xe0, 0x40, 0x80, 0xc0, 0xf3, 0x7f, 0x1e, 
+0xde, 0x00, 0x14, 0xf0, 0xfc, 0x9e, 0x86, 0x86, 0x9f, 0xff, 0xe2, 0xc7, 0x04, 0x04, 0x0c, 0x08, 
+0x0c, 0x0c, 0x0f, 0x0f, 0x0e, 0x0c, 0x0d, 0x0f, 0x80, 0x07, 0x03, 0x03, 0x03, 0x01, 0x01, 0xe2, 
+0x00, 0x01, 0x01, 0x01, 0x80, 0x03, 0x00, 0x0f, 0x80, 0x1f, 0x00, 0x0c, 0xa5, 0x00, 0x00, 0x40, 
+0x9c, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xa3, 0x00, 0x16, 0x80, 0xc0, 0xe0, 0x70, 0x38, 0x98, 
+0x0c, 0x2c, 0x8e, 0x06, 0x06, 0x46, 0xe6, 0xe6, 0x6e, 0x4c, 0x0c, 0x9c, 0x18, 0x30, 0x70, 0xe0, 
+0x80, 0xe4, 0x00, 0x1a, 0xf8, 0xfe, 0x4f, 0x71, 0x3c, 0xf0, 0xff, 0x27, 0xd0, 0x7c, 0xcc, 0x86, 
+0xc7, 0x6f, 0x71, 0x4d, 0xc8, 0xd0, 0x31, 0x32, 0x15, 0x32, 0xf0, 0xc1, 0x07, 0xff, 0xfc, 0xe2, 
+0x00, 0x1a, 0x83, 0x9f, 0x3e, 0xf0, 0xe0, 0xb7, 0x00, 0x0f, 0xf7, 0xe1, 0x09, 0xc1, 0xc0, 0x60, 
+0x30, 0x30, 0xf0, 0xd0, 0x18, 0x38, 0x78, 0x50, 0x40, 0xff, 0x83, 0xdf, 0x07, 0x97, 0x00, 0x01, 
+0x04, 0x02, 0xc3, 0x00, 0x1c, 0x7c, 0xff, 0x9f, 0x03, 0x03, 0x1f, 0x7c, 0xf1, 0xc3, 0x02, 0x00, 
+0x09, 0x30, 0x7b, 0xf3, 0xfc, 0xcc, 0x8c, 0x0c, 0x0c, 0x09, 0x18, 0x07, 0x83, 0xc2, 0xe6, 0x7e, 
+0x1f, 0x01, 0xe1, 0x00, 0x0f, 0x01, 0x03, 0x03, 0x07, 0x03, 0x0f, 0x3f, 0x87, 0x83, 0xe2, 0xa6, 
+0x87, 0x9e, 0xfc, 0xe1, 0xc1, 0x80, 0x03, 0x00, 0x07, 0x80, 0x03, 0x00, 0x01, 0xed, 0x00, 0x01, 
+0x01, 0x01, 0x80, 0x03, 0x00, 0x0f, 0x80, 0x1f, 0x00, 0x0c, 0xa5, 0x00, 0x00, 0x40, 0x9c, 0x00, 
+0x00, 0xff, 0xff, 0xc7, 0xff, 0x00, 0xef, 0xd9, 0xff, 0x09, 0x7f, 0x3f, 0x0f, 0x4f, 0x27, 0x83, 
+0x93, 0xc1, 0xc9, 0xe9, 0x80, 0xe1, 0x0a, 0xf1, 0xe1, 0xe9, 0xc1, 0x93, 0x23, 0x27, 0xcf, 0x0f, 
+0x3f, 0x7f, 0x87, 0xff, 0x01, 0x07, 0x01, 0xd3, 0xff, 0x80, 0x7f, 0x06, 0xff, 0x1f, 0x01, 0x00, 
+0x00, 0xf0, 0xfc, 0x84, 0xff, 0x0e, 0x7f, 0x7f, 0x0f, 0x83, 0xb1, 0x9c, 0xdc, 0xcf, 0xe0, 0xf0, 
+0xff, 0xfc, 0x00, 0x01, 0x9f, 0xd9, 0xff, 0x0e, 0xcf, 0x81, 0x00, 0x3c, 0x3c, 0x1c, 0x20, 0x80, 
+0x0f, 0x38, 0xe0, 0x80, 0x03, 0x27, 0x4f, 0x80, 0xcf, 0x03, 0xe7, 0xe1, 0xf8, 0xfe, 0x83, 0xff, 
+0x06, 0x7f, 0x7f, 0x3f, 0x0f, 0x87, 0xe0, 0xf8, 0xdf, 0xff, 0x00, 0xfe, 0x81, 0xf8, 0x80, 0xff, 
+0x0a, 0xfe, 0xfc, 0xfc, 0xf8, 0xf9, 0xf9, 0xf1, 0xf1, 0xf3, 0xf3, 0xf1, 0x80, 0xf9, 0x03, 0xf8, 
+0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xc9, 0xff, 0x00, 0xfe, 0xd0, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x00, 
+0xff, 0xff, 0xc7, 0xff, 0x00, 0xe7, 0xd8, 0xff, 0x17, 0x7f, 0x3f, 0x0f, 0xc7, 0x67, 0x23, 0x93, 
+0xc9, 0xe9, 0xe1, 0xe4, 0xf4, 0xf0, 0xf4, 0xe0, 0xe1, 0xc9, 0x91, 0x33, 0x63, 0xc7, 0x8f, 0x1f, 
+0x3f, 0x88, 0xff, 0x01, 0x3f, 0x01, 0xcf, 0xff, 0x0d, 0x7f, 0x3f, 0x3f, 0x1f, 0x1f, 0x3f, 0x3f, 
+0xff, 0x01, 0x00, 0x1c, 0x01, 0xf0, 0xfe, 0x83, 0xff, 0x0e, 0x7f, 0x3f, 0xa7, 0x81, 0x98, 0xdc, 
+0xce, 0xe2, 0xf0, 0xff, 0xff, 0xfe, 0xf8, 0x00, 0x07, 0xd9, 0xff, 0x15, 0xf0, 0xe0, 0xe6, 0x07, 
+0x0f, 0x4f, 0x00, 0x00, 0xff, 0xfc, 0xf0, 0xc3, 0x88, 0x11, 0x27, 0x4f, 0xcf, 0xcf, 0xe7, 0xe1, 
+0xf8, 0xfe, 0x83, 0xff, 0x07, 0x7f, 0x7f, 0x3f, 0x1f, 0x87, 0xe0, 0xf0, 0xfe, 0xdc, 0xff, 0x00, 
+0xfe, 0x80, 0xfc, 0x00, 0xfe, 0x83, 0xff, 0x00, 0xfe, 0x80, 0xfc, 0x85, 0xf9, 0x04, 0xf8, 0xfc, 
+0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xca, 0xff, 0x00, 0xfe, 0xd0, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 
+0xff, 0x00, 0xc7, 0x00, 0x00, 0x08, 0xda, 0x00, 0x11, 0x10, 0xc8, 0x40, 0x20, 0x00, 0x08, 0x20, 
+0x08, 0x05, 0x14, 0x14, 0x15, 0x29, 0x28, 0x50, 0xa0, 0x40, 0x80, 0x8c, 0x00, 0x00, 0x38, 0xce, 
+0x00, 0x08, 0x80, 0x80, 0x40, 0x20, 0xa0, 0x80, 0x00, 0x00, 0x40, 0x80, 0x00, 0x02, 0x18, 0xe0, 
+0x0c, 0x85, 0x00, 0x07, 0x20, 0xa4, 0x30, 0x04, 0x00, 0x09, 0x02, 0x09, 0x80, 0x00, 0x00, 0x08, 
+0xda, 0x00, 0x15, 0x0f, 0x00, 0x02, 0xe1, 0x00, 0x00, 0x4f, 0xc0, 0xff, 0x00, 0x04, 0x10, 0x03, 
+0x09, 0x16, 0x28, 0x10, 0x10, 0x00, 0x00, 0x11, 0x04, 0x84, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 
+0x20, 0xdd, 0x00, 0x05, 0x01, 0x02, 0x00, 0x02, 0x03, 0x01, 0x86, 0x00, 0x00, 0x04, 0x80, 0x00, 
+0x01, 0x08, 0x08, 0x80, 0x00, 0x03, 0x01, 0x00, 0x00, 0x02, 0xff, 0x00, 0xff, 0x00, 0xbd, 0x00, 
+0x01, 0xff, 0x00, 0xff, 0x00, 0x98, 0x00, 0x04, 0xe0, 0xf0, 0x70, 0xf0, 0xc0, 0x84, 0x00, 0x14, 
+0x90, 0xe8, 0x4c, 0x94, 0xc6, 0x4e, 0x6a, 0x62, 0x63, 0x63, 0x66, 0xee, 0x8e, 0x56, 0xbe, 0xec, 
+0xdc, 0xb8, 0x70, 0xe0, 0xc0, 0xd9, 0x00, 0x11, 0xc0, 0x70, 0xf0, 0xfb, 0xff, 0xff, 0x9b, 0x1f, 
+0x3e, 0x70, 0xfc, 0xc0, 0x00, 0x84, 0x11, 0x04, 0x02, 0x01, 0x82, 0x00, 0x0e, 0x80, 0x00, 0x8c, 
+0x76, 0xfa, 0xa8, 0xd6, 0x63, 0x07, 0x03, 0x0f, 0xff, 0xf7, 0xff, 0xf8, 0xd7, 0x00, 0x16, 0x01, 
+0x0c, 0x08, 0x1b, 0xff, 0xfb, 0xf3, 0xfc, 0x3e, 0x07, 0x3f, 0x7b, 0xe0, 0x83, 0x1e, 0xb8, 0x30, 
+0xe0, 0x40, 0x08, 0x04, 0x09, 0x05, 0x80, 0x03, 0x80, 0x01, 0x81, 0x00, 0x04, 0x10, 0x07, 0x20, 
+0x0f, 0x01, 0xdb, 0x00, 0x03, 0x01, 0x03, 0x03, 0x01, 0x81, 0x00, 0x12, 0x01, 0x03, 0x07, 0x06, 
+0x0d, 0x0f, 0x1b, 0x1f, 0x1e, 0x3e, 0x3e, 0x36, 0x16, 0x1e, 0x1e, 0x1a, 0x0a, 0x0d, 0x04, 0xff, 
+0x00, 0xff, 0x00, 0xbe, 0x00, 0x00, 0xff, 0xff, 0xc7, 0xff, 0x00, 0xe7, 0xd1, 0xff, 0x04, 0x7f, 
+0x1f, 0x0f, 0x0f, 0x1f, 0x87, 0xff, 0x80, 0x7f, 0x95, 0xff, 0x01, 0x3f, 0x01, 0xcc, 0xff, 0x11, 
+0x1f, 0x0f, 0x4f, 0xe7, 0xe7, 0x60, 0x00, 0x06, 0x00, 0x00, 0x3f, 0x1f, 0x8f, 0x07, 0x23, 0xf1, 
+0xf9, 0xf8, 0x82, 0xfc, 0x08, 0x0c, 0x0c, 0xf8, 0xf9, 0xf1, 0xe3, 0x87, 0x0f, 0x3f, 0xde, 0xff, 
+0x00, 0xfe, 0x83, 0xfc, 0x18, 0x04, 0x00, 0xf0, 0xfe, 0xff, 0x70, 0x38, 0xbf, 0x9f, 0x9f, 0xdf, 
+0xdf, 0xcf, 0xcf, 0xdf, 0xdc, 0x9c, 0x3f, 0x3f, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xe4, 0xff, 
+0x06, 0xf0, 0x80, 0x07, 0x3f, 0xc1, 0x00, 0x3f, 0x80, 0x7f, 0x0e, 0x3f, 0x3f, 0xbf, 0x1f, 0x0f, 
+0x0f, 0x27, 0x37, 0x92, 0x0c, 0x21, 0x0f, 0x81, 0xe0, 0xfc, 0xe6, 0xff, 0x07, 0xfe, 0xfc, 0xf8, 
+0xf1, 0xf3, 0xe2, 0xe6, 0xe7, 0x80, 0xc7, 0x07, 0xe7, 0xe7, 0xe3, 0xf3, 0xf1, 0xf8, 0xfc, 0xfe, 
+0xd0, 0xff, 0x00, 0xfe, 0xd0, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x00, 0xff, 0xff, 0xc7, 0xff, 0x00, 
+0xef, 0xd2, 0xff, 0x00, 0x7f, 0x80, 0x3f, 0xa2, 0xff, 0x01, 0x07, 0x01, 0xca, 0xff, 0x02, 0x1f, 
+0x0f, 0x4f, 0x80, 0xe7, 0x07, 0x03, 0x00, 0x00, 0x02, 0x80, 0xf8, 0x7f, 0x7f, 0x80, 0x3f, 0x00, 
+0x1f, 0x83, 0x9f, 0x00, 0x1f, 0x80, 0x3f, 0x01, 0x7f, 0x7f, 0xe0, 0xff, 0x80, 0xfc, 0x0a, 0xf8, 
+0xf8, 0x38, 0x08, 0x00, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xfe, 0x81, 0x7f, 0x81, 0xff, 0x81, 0x3f, 
+0x08, 0x3e, 0x3e, 0x3c, 0xf8, 0xf1, 0xe3, 0x07, 0x0f, 0x7f, 0xdf, 0xff, 0x08, 0xe0, 0x80, 0x07, 
+0x3f, 0x7e, 0xfc, 0x06, 0x70, 0xf8, 0x80, 0xfc, 0x01, 0xfe, 0xfe, 0x80, 0x7e, 0x0c, 0x3e, 0x3e, 
+0x9e, 0x9c, 0x59, 0x59, 0x33, 0x07, 0x4f, 0x1f, 0x02, 0xc0, 0xf0, 0xe2, 0xff, 0x05, 0xfe, 0xfc, 
+0xf8, 0xf9, 0xf2, 0xf0, 0x80, 0xe4, 0x00, 0xe6, 0x81, 0xce, 0x81, 0xe6, 0x05, 0xf2, 0xf2, 0xf9, 
+0xf8, 0xfc, 0xfe, 0xce, 0xff, 0x00, 0xfe, 0xd0, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x00, 0xff, 0xff, 
+0xc7, 0xff, 0x00, 0xe7, 0xd3, 0xff, 0x80, 0x7f, 0xa2, 0xff, 0x01, 0x3f, 0x01, 0xc8, 0xff, 0x10, 
+0x87, 0x03, 0x03, 0x33, 0x73, 0x73, 0x03, 0x03, 0x01, 0x10, 0x04, 0x00, 0x90, 0x88, 0xc7, 0xe7, 
+0xe7, 0x84, 0xf3, 0x07, 0xe3, 0xe7, 0xe7, 0xcf, 0x8f, 0x1f, 0x3f, 0x7f, 0xe0, 0xff, 0x80, 0xfc, 
+0x05, 0xf8, 0x08, 0x00, 0xe0, 0x7c, 0x7e, 0x84, 0x7f, 0x04, 0xff, 0xff, 0xbf, 0x3f, 0xbf, 0x83, 
+0x9f, 0x04, 0x9e, 0xf8, 0x00, 0x03, 0x3f, 0xe1, 0xff, 0x06, 0xf0, 0xc0, 0x06, 0x1e, 0x1e, 0x06, 
+0xe0, 0x80, 0xf8, 0x01, 0xfd, 0xfd, 0x81, 0xfc, 0x0b, 0x7c, 0x3d, 0x3d, 0xb9, 0x99, 0x93, 0x67, 
+0x07, 0x0f, 0x80, 0xe0, 0xfe, 0xe4, 0xff, 0x08, 0xfe, 0xfc, 0xf8, 0xf8, 0xf1, 0xf1, 0xe1, 0xe5, 
+0xe5, 0x83, 0xe4, 0x05, 0xe0, 0xf0, 0xf0, 0xf8, 0xfc, 0xfe, 0xd2, 0xff, 0x00, 0xfe, 0xd0, 0xff, 
+0x00, 0xfe, 0x9c, 0xff, 0x01, 0xff, 0x00, 0xc7, 0x00, 0x00, 0x08, 0xcd, 0x00, 0x81, 0xe0, 0x01, 
+0x00, 0x00, 0x80, 0x80, 0xa2, 0x00, 0x00, 0x38, 0xc8, 0x00, 0x0e, 0xc0, 0x98, 0x8c, 0xcc, 0xd4, 
+0x93, 0x73, 0x05, 0x03, 0x01, 0x2f, 0x3b, 0x1f, 0x1f, 0x47, 0x86, 0x00, 0x08, 0x10, 0x04, 0x00, 
+0x20, 0x40, 0x90, 0x20, 0x40, 0x80, 0xdc, 0x00, 0x10, 0x01, 0x03, 0x07, 0x07, 0x00, 0x04, 0x04, 
+0x00, 0x0c, 0x00, 0x10, 0x80, 0x81, 0x80, 0x70, 0x70, 0x60, 0x82, 0x80, 0x04, 0xc0, 0x40, 0xdc, 
+0x5c, 0x58, 0x80, 0x60, 0x05, 0x61, 0x62, 0x38, 0x03, 0x1c, 0xc0, 0xe3, 0x00, 0x09, 0x01, 0x01, 
+0x19, 0x05, 0x99, 0x04, 0x04, 0x06, 0x03, 0x83, 0x80, 0x82, 0x0c, 0xc2, 0x42, 0x23, 0x63, 0xe5, 
+0xd0, 0x9a, 0x64, 0x00, 0x8c, 0x60, 0x1c, 0x01, 0xe8, 0x00, 0x01, 0x01, 0x01, 0x80, 0x03, 0x81, 
+0x02, 0x07, 0x06, 0x16, 0x12, 0x00, 0x08, 0x04, 0x02, 0x01, 0xff, 0x00, 0xc4, 0x00, 0x01, 0xff, 
+0x00, 0xff, 0x00, 0x94, 0x00, 0x05, 0x80, 0xc0, 0x20, 0x20, 0x60, 0xe0, 0xb1, 0x00, 0x1a, 0x7e, 
+0xfe, 0x60, 0x70, 0xc0, 0xc0, 0x7f, 0x3c, 0x7e, 0xc6, 0xc6, 0xfe, 0xfc, 0xfe, 0x7e, 0x06, 0xfe, 
+0xfc, 0xfe, 0x04, 0xfc, 0xfc, 0x78, 0xdc, 0xcc, 0x7c, 0xf8, 0xa3, 0x00, 0x0b, 0xc0, 0x20, 0x80, 
+0x00, 0x00, 0x67, 0xe0, 0x00, 0x06, 0x00, 0xff, 0x40, 0x84, 0x00, 0x0a, 0x14, 0x10, 0x00, 0x00, 
+0x10, 0x14, 0x04, 0x00, 0x28, 0x48, 0x10, 0xdf, 0x00, 0x11, 0x03, 0x06, 0x0d, 0x01, 0x09, 0x0c, 
+0x08, 0x00, 0xf0, 0x04, 0xe0, 0x08, 0x02, 0x00, 0x70, 0xc8, 0xc0, 0xe0, 0x80, 0x00, 0x80, 0x80, 
+0x03, 0x86, 0x9a, 0x3a, 0x38, 0x80, 0x00, 0x04, 0x02, 0x04, 0xc1, 0x04, 0x60, 0xe1, 0x00, 0x1a, 
+0x0f, 0x70, 0xc7, 0x38, 0x60, 0xf8, 0xfc, 0x86, 0x03, 0x03, 0x01, 0x07, 0x9e, 0xf8, 0x62, 0x6f, 
+0x3d, 0xa1, 0xe1, 0xa1, 0xa3, 0xb6, 0xf6, 0x7c, 0x18, 0x03, 0x20, 0xe5, 0x00, 0x07, 0x01, 0x02, 
+0x04, 0x09, 0x0b, 0x17, 0x17, 0x25, 0x80, 0x29, 0x80, 0x28, 0x07, 0x05, 0x15, 0x11, 0x03, 0x09, 
+0x04, 0x02, 0x01, 0xff, 0x00, 0xc4, 0x00, 0x01, 0xff, 0x00, 0xc7, 0x00, 0x00, 0x08, 0xcb, 0x00, 
+0x00, 0x40, 0x80, 0x00, 0x00, 0x80, 0xa8, 0x00, 0x00, 0x38, 0x86, 0x00, 0x01, 0x42, 0x80, 0x80, 
+0x00, 0x00, 0x03, 0x80, 0x00, 0x10, 0xa0, 0xa4, 0x80, 0x80, 0x00, 0x02, 0x00, 0x80, 0x80, 0x82, 
+0x08, 0x00, 0x00, 0x58, 0xa4, 0x00, 0x14, 0xa3, 0x00, 0x06, 0x80, 0x00, 0x00, 0x10, 0x40, 0x0e, 
+0x80, 0x80, 0x00, 0x0e, 0x3f, 0x00, 0x40, 0x20, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x14, 0x10, 
+0x00, 0x00, 0x10, 0x83, 0x00, 0x02, 0x20, 0x40, 0x80, 0xdb, 0x00, 0x01, 0x01, 0x04, 0x84, 0x00, 
+0x0a, 0x08, 0x00, 0x10, 0x04, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x80, 0x80, 0x81, 0x00, 
+0x00, 0x02, 0x80, 0x00, 0x05, 0x01, 0x00, 0x08, 0x00, 0x08, 0x80, 0xe1, 0x00, 0x02, 0x10, 0x00, 
+0x08, 0x83, 0x00, 0x08, 0x01, 0x07, 0x09, 0x22, 0x88, 0x20, 0x10, 0x00, 0x60, 0x81, 0x00, 0x05, 
+0x80, 0x40, 0x10, 0x00, 0x30, 0x03, 0xe4, 0x00, 0x02, 0x02, 0x04, 0x01, 0x81, 0x00, 0x00, 0x20, 
+0x80, 0x00, 0x0a, 0x01, 0x01, 0x29, 0x00, 0x00, 0x10, 0x02, 0x09, 0x04, 0x02, 0x01, 0xff, 0x00, 
+0xc4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xc4, 0x00, 0x00, 0x3c, 0x86, 0x00, 0x01, 0x42, 0x80, 
+0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x10, 0xa0, 0xa4, 0x80, 0x80, 0x00, 0x02, 0x00, 0x80, 0x80, 
+0x82, 0x08, 0x00, 0x00, 0x58, 0xa4, 0x00, 0x14, 0xa3, 0x00, 0x0b, 0x40, 0x00, 0x80, 0x00, 0x00, 
+0x01, 0x00, 0x0c, 0x00, 0x00, 0x40, 0x80, 0x80, 0x00, 0x04, 0x40, 0x08, 0x00, 0x00, 0x14, 0x82, 
+0x00, 0x07, 0x04, 0x00, 0x00, 0x08, 0x40, 0x00, 0x20, 0x40, 0xdf, 0x00, 0x00, 0x08, 0x80, 0x00, 
+0x02, 0x08, 0x00, 0x04, 0x80, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x48, 0x20, 0x00, 0x00, 0x80, 0x00, 
+0x00, 0x80, 0x80, 0x8a, 0x8a, 0x81, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x08, 0xe7, 0x00, 0x0f, 
+0x3c, 0x7e, 0x66, 0x63, 0x22, 0x36, 0x3e, 0x2c, 0xe8, 0xda, 0xe7, 0xe1, 0x1f, 0x1b, 0x0f, 0x0e, 
+0xeb, 0x00, 0x08, 0x02, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x28, 0x80, 0x00, 0x03, 0x28, 
+0x00, 0x00, 0x04, 0xff, 0x00, 0xca, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0x93, 0x00, 0x00, 0xc0, 
+0x80, 0x00, 0x00, 0xc0, 0xa9, 0x00, 0x00, 0x1c, 0x86, 0x00, 0x01, 0x42, 0x80, 0x80, 0x00, 0x00, 
+0x03, 0x80, 0x00, 0x10, 0xa0, 0xa4, 0x80, 0x80, 0x00, 0x02, 0x00, 0x80, 0x80, 0x82, 0x08, 0x00, 
+0x00, 0x58, 0xa4, 0x04, 0x14, 0xa3, 0x00, 0x0b, 0x40, 0x00, 0x80, 0x10, 0x40, 0x00, 0x00, 0x0c, 
+0x00, 0x03, 0x40, 0x80, 0x80, 0x00, 0x04, 0x40, 0x08, 0x00, 0x00, 0x10, 0x82, 0x00, 0x00, 0x10, 
+0x84, 0x00, 0x00, 0x80, 0xdb, 0x00, 0x07, 0x02, 0x00, 0x09, 0x0a, 0x08, 0x00, 0x00, 0x08, 0x82, 
+0x00, 0x07, 0x01, 0x20, 0x50, 0x90, 0xd0, 0x80, 0x00, 0x00, 0x81, 0x80, 0x02, 0x94, 0xb0, 0x1c, 
+0xea, 0x00, 0x0a, 0x10, 0x00, 0x08, 0x00, 0x00, 0x3c, 0x4e, 0x56, 0x5a, 0x1a, 0x09, 0x80, 0x0d, 
+0x06, 0x05, 0x07, 0x03, 0x11, 0x15, 0x03, 0x0e, 0x82, 0x00, 0x00, 0x10, 0xff, 0x00, 0xff, 0x00, 
+0xc0, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0x93, 0x00, 0x81, 0xc0, 0xaa, 0x00, 0x00, 0x1c, 0x86, 
+0x00, 0x01, 0x42, 0x80, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x10, 0xa0, 0xa4, 0x80, 0x80, 0x00, 
+0x02, 0x00, 0x80, 0x80, 0x82, 0x08, 0x00, 0x00, 0x58, 0xa4, 0x04, 0x14, 0xa4, 0x00, 0x12, 0x40, 
+0x60, 0xa0, 0xf0, 0xbf, 0x7f, 0xff, 0xff, 0xfc, 0xc0, 0x80, 0x00, 0x00, 0x10, 0x40, 0x08, 0x00, 
+0x04, 0x10, 0x83, 0x00, 0x04, 0x14, 0x00, 0x20, 0x08, 0x10, 0xdc, 0x00, 0x10, 0x1e, 0x3e, 0x7c, 
+0x76, 0x7f, 0x75, 0x7f, 0x3f, 0x30, 0x10, 0x07, 0x0b, 0x01, 0x10, 0x00, 0x01, 0x00, 0x80, 0x20, 
+0x00, 0x40, 0x83, 0x80, 0x02, 0xf8, 0xdc, 0x78, 0x81, 0x00, 0x04, 0x02, 0x08, 0x01, 0x04, 0xc0, 
+0xe1, 0x00, 0x15, 0x08, 0x40, 0x00, 0x20, 0x00, 0x18, 0x0e, 0x07, 0x0a, 0x08, 0x09, 0x2d, 0x05, 
+0x0d, 0x05, 0x07, 0x03, 0x13, 0x11, 0x17, 0x1f, 0x0c, 0x82, 0x00, 0x00, 0x01, 0xe7, 0x00, 0x05, 
+0x08, 0x02, 0x10, 0x04, 0x00, 0x00, 0x80, 0x28, 0x80, 0x00, 0x00, 0x10, 0xff, 0x00, 0xca, 0x00, 
+0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x8c, 0x00, 0x80, 0x80, 0x00, 0xc0, 0x80, 0x80, 0x81, 
+0x00, 0x08, 0x80, 0x40, 0x20, 0x90, 0x40, 0x08, 0x20, 0x04, 0x10, 0x87, 0x00, 0x03, 0x40, 0x80, 
+0x20, 0x40, 0xd9, 0x00, 0x15, 0x1e, 0x3e, 0x7f, 0x71, 0x71, 0x79, 0x71, 0x31, 0x3f, 0x1f, 0x00, 
+0x30, 0x02, 0xe0, 0x04, 0x01, 0x00, 0x00, 0xc0, 0x00, 0x20, 0x60, 0x82, 0x80, 0x0b, 0xe0, 0xe0, 
+0x60, 0xc0, 0xc0, 0x40, 0x00, 0x01, 0x04, 0xf0, 0x02, 0x30, 0xd8, 0x00, 0x03, 0xe0, 0xf0, 0xb8, 
+0x1c, 0x80, 0x8c, 0x0d, 0xfc, 0xf8, 0x26, 0x20, 0x87, 0x10, 0x40, 0x98, 0x3e, 0x37, 0x33, 0x31, 
+0x31, 0x15, 0x80, 0x1d, 0x0c, 0x15, 0x11, 0x11, 0x13, 0x13, 0x07, 0x0c, 0x80, 0x40, 0x10, 0x87, 
+0x20, 0x0e, 0xd8, 0x00, 0x03, 0x03, 0x07, 0x07, 0x0f, 0x80, 0x07, 0x01, 0x03, 0x01, 0x80, 0x00, 
+0x03, 0x01, 0x02, 0x04, 0x01, 0x88, 0x00, 0x06, 0x14, 0x00, 0x02, 0x01, 0x04, 0x02, 0x01, 0xff, 
+0x00, 0xc4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xc4, 0x00, 0x00, 0x3c, 0x86, 0x00, 0x01, 0x42, 
+0x80, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x10, 0xa0, 0xa4, 0x80, 0x80, 0x00, 0x02, 0x00, 0x80, 
+0x80, 0x82, 0x08, 0x00, 0x00, 0x58, 0xa4, 0x04, 0x14, 0xaf, 0x00, 0x08, 0x80, 0x40, 0x20, 0x90, 
+0x40, 0x08, 0x00, 0x04, 0x14, 0x82, 0x00, 0x04, 0x14, 0x00, 0x00, 0x08, 0x40, 0xe7, 0x00, 0x0b, 
+0xc0, 0x0c, 0x01, 0x18, 0x02, 0x01, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x60, 0x85, 0x00, 0x01, 0x20, 
+0x80, 0x82, 0x00, 0x00, 0x08, 0xd8, 0x00, 0x0c, 0xe0, 0x70, 0x58, 0xfc, 0xfc, 0xb4, 0xb4, 0xcc, 
+0x08, 0xc1, 0x10, 0x00, 0x08, 0x83, 0x00, 0x04, 0x06, 0x02, 0x02, 0x0b, 0x0b, 0x80, 0x03, 0x09, 
+0x07, 0x07, 0x16, 0x04, 0x00, 0x80, 0x20, 0x08, 0x40, 0x10, 0xd8, 0x00, 0x09, 0x03, 0x0e, 0x18, 
+0x11, 0x1b, 0x3b, 0x19, 0x1d, 0x0e, 0x0f, 0x85, 0x00, 0x02, 0x04, 0x00, 0x00, 0x82, 0x28, 0x07, 
+0x00, 0x00, 0x14, 0x00, 0x08, 0x01, 0x04, 0x02, 0xff, 0x00, 0xc4, 0x00, 0x01, 0xff, 0x00, 0xff, 
+0x00, 0xc4, 0x00, 0x00, 0x3c, 0x86, 0x00, 0x01, 0x42, 0x80, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 
+0x10, 0xa0, 0xa4, 0x80, 0x80, 0x00, 0x02, 0x00, 0x80, 0x80, 0x82, 0x08, 0x00, 0x00, 0x58, 0xa4, 
+0x04, 0x14, 0xb3, 0x00, 0x04, 0x10, 0x00, 0x28, 0x00, 0x00, 0x82, 0x14, 0x07, 0x00, 0x00, 0x20, 
+0x00, 0x00, 0x80, 0x20, 0x40, 0x93, 0x00, 0x01, 0xf8, 0xff, 0xce, 0x00, 0x02, 0x02, 0x00, 0x04, 
+0x80, 0x00, 0x03, 0x80, 0x20, 0x00, 0x80, 0x81, 0xc0, 0x80, 0x80, 0x81, 0x00, 0x00, 0x81, 0x94, 
+0x00, 0x08, 0x1f, 0x1f, 0x19, 0x1f, 0x0f, 0x1f, 0x17, 0x17, 0x02, 0xbd, 0x00, 0x14, 0x80, 0xe0, 
+0x60, 0xb0, 0xd8, 0x48, 0x00, 0x80, 0x00, 0xf0, 0x80, 0x08, 0x00, 0x84, 0x0f, 0x1b, 0x19, 0x09, 
+0x0e, 0x0a, 0x0a, 0x82, 0x03, 0x07, 0x07, 0x02, 0x03, 0x0b, 0x0f, 0x0f, 0x47, 0x10, 0xdb, 0x00, 
+0x13, 0x09, 0x1e, 0x01, 0x23, 0x00, 0x26, 0x22, 0x31, 0x10, 0x1f, 0x01, 0x01, 0x02, 0x04, 0x09, 
+0x02, 0x10, 0x00, 0x00, 0x28, 0x82, 0x00, 0x08, 0x28, 0x20, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 
+0x01, 0xff, 0x00, 0xc3, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xc4, 0x00, 0x00, 0x3c, 0x86, 0x00, 
+0x01, 0x42, 0x80, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x10, 0xa0, 0xa4, 0x80, 0x80, 0x00, 0x02, 
+0x00, 0x80, 0x80, 0x82, 0x08, 0x00, 0x00, 0x58, 0xa4, 0x04, 0x14, 0xaf, 0x00, 0x06, 0x80, 0x40, 
+0x20, 0x80, 0x10, 0x00, 0x08, 0x85, 0x00, 0x06, 0x28, 0x08, 0x50, 0x90, 0x20, 0x40, 0x80, 0x96, 
+0x00, 0x00, 0x80, 0xca, 0x00, 0x0b, 0xf0, 0x0c, 0xe3, 0x18, 0x06, 0x01, 0x00, 0x00, 0x80, 0x20, 
+0x00, 0xe0, 0x81, 0xc0, 0x80, 0x80, 0x80, 0x00, 0x05, 0x01, 0x82, 0x0c, 0xf1, 0x0e, 0xf8, 0x93, 
+0x00, 0x05, 0x12, 0x00, 0x01, 0x00, 0x00, 0x04, 0xbe, 0x00, 0x22, 0x80, 0x40, 0x20, 0x90, 0x40, 
+0x00, 0x00, 0x1f, 0x00, 0x0f, 0x30, 0xc0, 0x04, 0x0f, 0x03, 0x05, 0x17, 0x16, 0x16, 0x07, 0x03, 
+0x03, 0x09, 0x01, 0x01, 0x03, 0x02, 0x02, 0x08, 0x08, 0x8f, 0x67, 0x1f, 0x60, 0x1f, 0xda, 0x00, 
+0x11, 0x1e, 0x20, 0x03, 0x04, 0x00, 0x02, 0x22, 0x00, 0x10, 0x00, 0x02, 0x04, 0x09, 0x02, 0x10, 
+0x04, 0x20, 0x28, 0x84, 0x00, 0x07, 0x20, 0x00, 0x10, 0x02, 0x09, 0x04, 0x02, 0x01, 0xff, 0x00, 
+0xc3, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xc4, 0x00, 0x00, 0x3c, 0x86, 0x00, 0x01, 0x42, 0x80, 
+0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x10, 0xa0, 0xa4, 0x80, 0x80, 0x00, 0x02, 0x00, 0x80, 0x80, 
+0x82, 0x08, 0x00, 0x00, 0x58, 0xa4, 0x04, 0x14, 0xad, 0x00, 0x0c, 0x80, 0xc0, 0x60, 0xa0, 0x90, 
+0x50, 0x68, 0x28, 0x20, 0x04, 0x14, 0x14, 0x04, 0x80, 0x00, 0x06, 0x20, 0x00, 0x50, 0x80, 0x20, 
+0x40, 0x80, 0x97, 0x00, 0x00, 0x80, 0xc8, 0x00, 0x0c, 0xc0, 0xfc, 0x8e, 0xfb, 0x1c, 0x07, 0x01, 
+0x00, 0x00, 0x80, 0xc0, 0x20, 0xe0, 0x86, 0x00, 0x06, 0x20, 0x81, 0x06, 0x3c, 0xf3, 0x1e, 0xf0, 
+0x94, 0x00, 0x05, 0x10, 0x00, 0x01, 0x00, 0x00, 0x04, 0xbd, 0x00, 0x22, 0x80, 0x40, 0x20, 0x90, 
+0x40, 0x00, 0x47, 0x8f, 0x01, 0x1f, 0x70, 0xc0, 0x00, 0x30, 0x38, 0x21, 0x01, 0x0a, 0x00, 0x14, 
+0x05, 0x01, 0x08, 0x02, 0x0a, 0x0a, 0x08, 0x08, 0x0c, 0x84, 0xc7, 0x78, 0xdf, 0xf8, 0x1f, 0xda, 
+0x00, 0x11, 0x1f, 0x00, 0x03, 0x04, 0x04, 0x06, 0x20, 0x03, 0x10, 0x0e, 0x02, 0x04, 0x09, 0x02, 
+0x10, 0x04, 0x00, 0x08, 0x82, 0x00, 0x09, 0x08, 0x28, 0x28, 0x14, 0x16, 0x0b, 0x0d, 0x06, 0x03, 
+0x01, 0xff, 0x00, 0xc4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x99, 0x00, 0x02, 0x10, 
+0x40, 0x08, 0x80, 0x00, 0x0c, 0x10, 0x00, 0x10, 0x04, 0x00, 0x00, 0x20, 0x08, 0x40, 0x80, 0x20, 
+0x40, 0x80, 0xe4, 0x00, 0x10, 0x38, 0x02, 0x71, 0x04, 0x02, 0x60, 0x70, 0x20, 0x00, 0x80, 0xc0, 
+0xc0, 0x00, 0x00, 0x40, 0xc0, 0xc0, 0x81, 0x00, 0x06, 0xc0, 0xc1, 0x42, 0x08, 0xc1, 0x0c, 0xe0, 
+0xd6, 0x00, 0x1c, 0xc0, 0xf0, 0x70, 0xf0, 0xf0, 0x70, 0x20, 0x00, 0xb0, 0x30, 0x30, 0x68, 0x80, 
+0x0e, 0x20, 0x80, 0x00, 0x00, 0x30, 0x38, 0x35, 0x11, 0x0a, 0x08, 0x18, 0x10, 0x10, 0x1b, 0x1b, 
+0x81, 0x07, 0x05, 0x83, 0x43, 0x30, 0x87, 0x20, 0x07, 0xd6, 0x00, 0x15, 0x01, 0x03, 0x0f, 0x0f, 
+0x1d, 0x06, 0x06, 0x23, 0x37, 0x3c, 0x3e, 0x1e, 0x1f, 0x0e, 0x02, 0x04, 0x01, 0x02, 0x10, 0x04, 
+0x00, 0x28, 0x82, 0x00, 0x08, 0x08, 0x20, 0x00, 0x04, 0x02, 0x08, 0x00, 0x00, 0x01, 0xff, 0x00, 
+0xc6, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xc4, 0x00, 0x00, 0x3c, 0x86, 0x00, 0x01, 0x42, 0x80, 
+0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x10, 0xa0, 0xa4, 0x80, 0x80, 0x00, 0x02, 0x00, 0x80, 0x80, 
+0x82, 0x08, 0x00, 0x00, 0x58, 0xa4, 0x04, 0x14, 0xab, 0x00, 0x16, 0x80, 0xc0, 0x60, 0xb0, 0xd8, 
+0x68, 0x2c, 0x34, 0x14, 0x16, 0x1e, 0x0a, 0x0a, 0x1a, 0x16, 0x14, 0x14, 0x24, 0x28, 0x40, 0x90, 
+0x20, 0x40, 0x99, 0x00, 0x00, 0x80, 0xc7, 0x00, 0x0a, 0xf8, 0x06, 0xf1, 0x0e, 0x03, 0x21, 0x90, 
+0x90, 0xa0, 0x80, 0x80, 0x80, 0x00, 0x03, 0x40, 0x80, 0x00, 0xc0, 0x84, 0x00, 0x02, 0xf0, 0x02, 
+0x30, 0x96, 0x00, 0x05, 0x10, 0x00, 0x01, 0x00, 0x00, 0x04, 0x84, 0x00, 0x11, 0x02, 0xde, 0x78, 
+0x1c, 0x1f, 0x3f, 0x33, 0x33, 0x3f, 0x1e, 0x1f, 0x10, 0x1e, 0x0e, 0x1f, 0x03, 0x01, 0x01, 0x9f, 
+0x00, 0x02, 0x20, 0x00, 0x40, 0x84, 0x00, 0x12, 0x07, 0x20, 0x03, 0x10, 0x00, 0x80, 0x01, 0x01, 
+0x07, 0x3f, 0x75, 0xcf, 0xfd, 0xe8, 0xea, 0xe6, 0x1e, 0x1c, 0x1c, 0x80, 0x00, 0x05, 0x80, 0x60, 
+0x30, 0xcf, 0x70, 0x1f, 0xa2, 0x00, 0x02, 0x0c, 0x0f, 0x03, 0xb0, 0x00, 0x00, 0x04, 0x81, 0x00, 
+0x02, 0x04, 0x10, 0x08, 0x81, 0x00, 0x08, 0x01, 0x02, 0x04, 0x01, 0x0a, 0x12, 0x14, 0x14, 0x2c, 
+0x80, 0x29, 0x09, 0x28, 0x3c, 0x34, 0x14, 0x16, 0x1a, 0x0d, 0x05, 0x06, 0x03, 0xff, 0x00, 0xc7, 
+0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xc4, 0x00, 0x00, 0x3c, 0x86, 0x00, 0x01, 0x42, 0x80, 0x80, 
+0x00, 0x00, 0x03, 0x80, 0x00, 0x10, 0xa0, 0xa4, 0x80, 0x80, 0x00, 0x02, 0x00, 0x80, 0x80, 0x82, 
+0x08, 0x00, 0x00, 0x58, 0xa4, 0x04, 0x14, 0xb3, 0x00, 0x01, 0x02, 0x08, 0x81, 0x00, 0x01, 0x08, 
+0x02, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x80, 0x98, 0x00, 0x00, 0x80, 0xca, 0x00, 0x03, 
+0x02, 0x00, 0x40, 0x90, 0x81, 0x80, 0x80, 0x00, 0x02, 0x80, 0x00, 0xc0, 0x83, 0x00, 0x04, 0x01, 
+0x00, 0xe0, 0x02, 0x30, 0x96, 0x00, 0x05, 0x10, 0x00, 0x01, 0x00, 0x00, 0x04, 0x84, 0x00, 0x11, 
+0x82, 0x30, 0x04, 0x00, 0x01, 0x01, 0x10, 0x10, 0x04, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 
+0x02, 0x01, 0x9e, 0x00, 0x1a, 0x40, 0x18, 0x08, 0xc8, 0x08, 0x08, 0x88, 0x10, 0x10, 0x40, 0x00, 
+0x04, 0x20, 0x02, 0x10, 0x06, 0x06, 0x02, 0x0f, 0x39, 0x49, 0x1f, 0x07, 0x1f, 0x02, 0x04, 0x88, 
+0x84, 0x00, 0x04, 0x20, 0x00, 0x01, 0x10, 0x01, 0xa2, 0x00, 0x02, 0x0a, 0x08, 0x02, 0xaf, 0x00, 
+0x08, 0x01, 0x04, 0x08, 0x09, 0x13, 0x15, 0x1a, 0x08, 0x06, 0x84, 0x00, 0x00, 0x04, 0x81, 0x00, 
+0x04, 0x10, 0x05, 0x01, 0x01, 0x04, 0x80, 0x00, 0x00, 0x08, 0xff, 0x00, 0xcc, 0x00, 0x01, 0xff, 
+0x00, 0xff, 0x00, 0xc4, 0x00, 0x00, 0x3c, 0x86, 0x00, 0x01, 0x42, 0x80, 0x80, 0x00, 0x00, 0x03, 
+0x80, 0x00, 0x10, 0xa0, 0xa4, 0x80, 0x80, 0x00, 0x02, 0x00, 0x80, 0x80, 0x82, 0x08, 0x00, 0x00, 
+0x58, 0xa4, 0x04, 0x14, 0xab, 0x00, 0x0a, 0x80, 0x40, 0x20, 0x90, 0x48, 0x20, 0x04, 0x10, 0x02, 
+0x0a, 0x08, 0x83, 0x00, 0x06, 0x10, 0x04, 0x20, 0x40, 0x90, 0x20, 0x40, 0x98, 0x00, 0x00, 0x80, 
+0xc7, 0x00, 0x04, 0xf8, 0x06, 0xf1, 0x0c, 0x01, 0x90, 0x00, 0x04, 0x02, 0x1c, 0x01, 0x0c, 0xc0, 
+0x95, 0x00, 0x05, 0x10, 0x00, 0x01, 0x00, 0x00, 0x04, 0x84, 0x00, 0x11, 0x82, 0x30, 0x04, 0x00, 
+0x01, 0x01, 0x10, 0x10, 0x04, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0x01, 0x9d, 0x00, 
+0x1b, 0x08, 0x7e, 0xc7, 0xcf, 0x9e, 0x8f, 0xc7, 0x47, 0xef, 0xf4, 0x80, 0x00, 0x03, 0x18, 0x61, 
+0x8c, 0x26, 0x46, 0x83, 0x0e, 0x26, 0x4e, 0x5e, 0xbc, 0x84, 0xa4, 0x88, 0x10, 0x83, 0x00, 0x05, 
+0x80, 0x40, 0x10, 0xce, 0x20, 0x0e, 0xa2, 0x00, 0x02, 0x0a, 0x08, 0x02, 0xb0, 0x00, 0x07, 0x03, 
+0x07, 0x06, 0x0e, 0x0c, 0x07, 0x07, 0x01, 0x82, 0x00, 0x05, 0x01, 0x02, 0x00, 0x01, 0x08, 0x02, 
+0x82, 0x00, 0x09, 0x04, 0x14, 0x00, 0x00, 0x0a, 0x08, 0x05, 0x00, 0x02, 0x01, 0xff, 0x00, 0xc7, 
+0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xc4, 0x00, 0x00, 0x3c, 0x86, 0x00, 0x01, 0x42, 0x80, 0x80, 
+0x00, 0x00, 0x03, 0x80, 0x00, 0x10, 0xa0, 0xa4, 0x80, 0x80, 0x00, 0x02, 0x00, 0x80, 0x80, 0x82, 
+0x08, 0x00, 0x00, 0x58, 0xa4, 0x04, 0x14, 0xac, 0x00, 0x0e, 0x80, 0x40, 0x00, 0x00, 0x08, 0x20, 
+0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x08, 0x02, 0x81, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 
+0x80, 0x97, 0x00, 0x00, 0x80, 0xba, 0x00, 0x08, 0x80, 0xe0, 0xe0, 0x60, 0x60, 0xe0, 0x70, 0xf0, 
+0xe0, 0x82, 0x00, 0x06, 0x38, 0x02, 0xf0, 0x06, 0x61, 0xa0, 0xa0, 0x82, 0x00, 0x00, 0x80, 0x87, 
+0x00, 0x04, 0x01, 0x00, 0xf0, 0x02, 0x38, 0x95, 0x00, 0x05, 0x10, 0x00, 0x01, 0x00, 0x00, 0x04, 
+0x84, 0x00, 0x11, 0x82, 0x30, 0x04, 0x00, 0x01, 0x01, 0x10, 0x10, 0x04, 0x00, 0x01, 0x00, 0x00, 
+0x10, 0x00, 0x00, 0x02, 0x01, 0x9c, 0x00, 0x0a, 0x01, 0x0b, 0x39, 0x39, 0x31, 0x60, 0x70, 0x3c, 
+0x3e, 0x1f, 0x04, 0x80, 0x00, 0x0d, 0x06, 0x00, 0x43, 0x10, 0x20, 0x00, 0x00, 0x28, 0x08, 0x48, 
+0x08, 0x28, 0x28, 0x01, 0x86, 0x00, 0x04, 0x20, 0x10, 0x43, 0x30, 0x07, 0xa1, 0x00, 0x02, 0x0a, 
+0x08, 0x02, 0xc5, 0x00, 0x00, 0x04, 0x81, 0x00, 0x05, 0x14, 0x10, 0x00, 0x02, 0x00, 0x04, 0xff, 
+0x00, 0xc9, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x8d, 0x00, 0x15, 0x78, 0xfc, 0xec, 
+0x8c, 0xfc, 0x7c, 0xe0, 0xc0, 0x00, 0x00, 0x20, 0x90, 0x40, 0x08, 0x00, 0x14, 0x00, 0x00, 0x02, 
+0x0a, 0x0a, 0x02, 0xdf, 0x00, 0x14, 0x80, 0xe0, 0xe0, 0x60, 0x60, 0xe0, 0x70, 0xf0, 0xe0, 0x00, 
+0x01, 0x01, 0x03, 0x03, 0xc3, 0x05, 0x01, 0x08, 0x02, 0xc0, 0xc0, 0x82, 0x00, 0x02, 0x80, 0xc0, 
+0xc0, 0x86, 0x00, 0x03, 0x02, 0x08, 0x01, 0x04, 0x95, 0x00, 0x00, 0x02, 0xba, 0x00, 0x02, 0x01, 
+0x03, 0x07, 0x80, 0x06, 0x02, 0x07, 0x03, 0x01, 0x82, 0x00, 0x07, 0x01, 0x10, 0x00, 0x08, 0x00, 
+0x02, 0x06, 0x36, 0x80, 0x12, 0x07, 0x30, 0x00, 0x03, 0x13, 0x63, 0x23, 0x03, 0x02, 0x80, 0x00, 
+0x05, 0x80, 0x40, 0x20, 0x8c, 0x00, 0x08, 0xf2, 0x00, 0x07, 0x04, 0x10, 0x00, 0x08, 0x01, 0x04, 
+0x02, 0x01, 0xff, 0x00, 0xc6, 0x00, 0x00, 0xff, 0xff, 0xbb, 0xff, 0x2b, 0x07, 0x07, 0x77, 0x37, 
+0x7f, 0x1f, 0x83, 0x03, 0x27, 0x07, 0x7f, 0xff, 0x7f, 0x0f, 0x43, 0x3f, 0x9f, 0xcf, 0xef, 0xcf, 
+0x9f, 0x3f, 0x3f, 0xff, 0x07, 0x87, 0xf3, 0x73, 0x07, 0xff, 0xe7, 0x07, 0x07, 0xef, 0xff, 0xf7, 
+0x07, 0x07, 0xe7, 0x3f, 0x0f, 0x67, 0x77, 0x7f, 0xac, 0xff, 0x80, 0x7f, 0x9f, 0xff, 0x28, 0xc0, 
+0x00, 0xff, 0xff, 0x83, 0xe0, 0xfd, 0xfc, 0xc0, 0x04, 0xe0, 0xc7, 0xc0, 0xfc, 0xe0, 0xc0, 0x9f, 
+0xbf, 0xbf, 0x9f, 0x9f, 0xcf, 0xe0, 0x00, 0x00, 0xf3, 0xe1, 0xc8, 0x9e, 0x3f, 0x7f, 0x30, 0x00, 
+0x3f, 0x3f, 0xbf, 0x00, 0x00, 0xff, 0xe0, 0x80, 0x80, 0x9e, 0x00, 0xdf, 0xa9, 0xff, 0x0c, 0xe7, 
+0x80, 0x80, 0x9e, 0x80, 0x80, 0x81, 0x7f, 0x3f, 0x1f, 0x8f, 0xcf, 0xc7, 0x80, 0xe7, 0x03, 0xe3, 
+0xf3, 0xf3, 0xe3, 0x80, 0xe7, 0x05, 0xcf, 0x8f, 0x9f, 0x1f, 0x3f, 0x7f, 0xe4, 0xff, 0x1b, 0x0f, 
+0x03, 0xe0, 0xf8, 0xfe, 0xff, 0x7f, 0x1f, 0x1f, 0x0f, 0x2f, 0x9f, 0x9f, 0xdf, 0xdf, 0xcf, 0xcf, 
+0xc7, 0xc1, 0xc3, 0x9f, 0x3f, 0x7f, 0xfc, 0xf0, 0x01, 0x07, 0x7f, 0xe1, 0xff, 0x0f, 0xf0, 0x80, 
+0x07, 0x3f, 0x7f, 0xff, 0xfe, 0xf0, 0xe0, 0xcc, 0xc9, 0xc9, 0xc3, 0xc7, 0xcf, 0xcf, 0x80, 0xdf, 
+0x08, 0xcf, 0xcf, 0xe2, 0xf0, 0x7f, 0x1f, 0x80, 0xc0, 0xfe, 0xe4, 0xff, 0x07, 0xfe, 0xfc, 0xf8, 
+0xf1, 0xf3, 0xe7, 0xe7, 0xc7, 0x83, 0xcf, 0x07, 0xe7, 0xe7, 0xe3, 0xf3, 0xf1, 0xf8, 0xfc, 0xfe, 
+0xd3, 0xff, 0x00, 0xfe, 0xd0, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x0e, 
+0x70, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x10, 0x00, 0x40, 0x00, 0x80, 0x00, 0x44, 0x20, 0x80, 
+0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 0x40, 0x04, 0x04, 0x00, 0x30, 0x08, 0xa8, 0x08, 
+0x00, 0x08, 0x10, 0x00, 0x08, 0x08, 0x20, 0x00, 0x00, 0x90, 0x98, 0xaf, 0x00, 0x00, 0x80, 0x9e, 
+0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x17, 0x40, 0x1a, 0x10, 0x04, 0x00, 0x04, 
+0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 0x20, 0x04, 0x00, 0x00, 
+0x80, 0x0f, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0xa9, 0x00, 0x0c, 0x18, 0x41, 0x00, 
+0x06, 0x06, 0x00, 0x01, 0x32, 0x00, 0x00, 0x10, 0x00, 0x08, 0x80, 0x00, 0x0c, 0x04, 0x14, 0x14, 
+0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x80, 0x20, 0x40, 0x80, 0xea, 0x00, 0x11, 0x80, 0xe0, 0xe0, 
+0x78, 0x0c, 0x08, 0x00, 0x10, 0x10, 0x00, 0x00, 0x08, 0x0d, 0x0b, 0x52, 0xb0, 0x61, 0xc0, 0xeb, 
+0x00, 0x15, 0x01, 0x0f, 0x18, 0x3c, 0x3d, 0x2d, 0x22, 0x36, 0x2c, 0x28, 0x38, 0x30, 0x30, 0x20, 
+0x28, 0x01, 0x00, 0x03, 0x00, 0x80, 0x00, 0x02, 0xe4, 0x00, 0x07, 0x02, 0x04, 0x01, 0x00, 0x10, 
+0x00, 0x00, 0x08, 0x83, 0x00, 0x02, 0x20, 0x00, 0x04, 0xff, 0x00, 0xca, 0x00, 0x01, 0xff, 0x00, 
+0xbc, 0x00, 0x0e, 0x70, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x10, 0x00, 0x40, 0x00, 0x80, 0x00, 
+0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 0x40, 0x04, 0x04, 0x00, 0x30, 
+0x08, 0xa8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 0x08, 0x20, 0x00, 0x00, 0x90, 0x90, 0xac, 0x00, 
+0x00, 0x80, 0xa1, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x17, 0x40, 0x1a, 0x10, 
+0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 0x20, 
+0x04, 0x00, 0x00, 0x80, 0x07, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0xaa, 0x00, 0x0a, 
+0x3e, 0x40, 0x18, 0x18, 0x00, 0x00, 0x8c, 0x70, 0x20, 0x80, 0x40, 0x80, 0x00, 0x00, 0x04, 0x83, 
+0x14, 0x07, 0x34, 0x28, 0x68, 0xd8, 0xb0, 0xe0, 0xc0, 0x80, 0xe3, 0x00, 0x05, 0xf0, 0x1c, 0xe3, 
+0x38, 0x06, 0x01, 0x80, 0x00, 0x04, 0x88, 0x50, 0xa4, 0x00, 0x50, 0x82, 0x00, 0x09, 0x04, 0x01, 
+0x40, 0x81, 0x03, 0x8e, 0xfd, 0xe7, 0x7c, 0xf0, 0xe0, 0x00, 0x0f, 0x0f, 0x7c, 0xe7, 0xbf, 0x70, 
+0xc0, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x05, 0x10, 0x00, 0x04, 0x81, 0x00, 0x08, 0x08, 0x04, 
+0x03, 0x8c, 0x63, 0x1f, 0x43, 0x3c, 0x07, 0xe3, 0x00, 0x07, 0x03, 0x06, 0x05, 0x0d, 0x1a, 0x16, 
+0x14, 0x2c, 0x83, 0x28, 0x00, 0x20, 0x81, 0x00, 0x03, 0x01, 0x04, 0x02, 0x01, 0xff, 0x00, 0xc4, 
+0x00, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x10, 0x00, 
+0x40, 0x00, 0x80, 0x00, 0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 0x40, 
+0x04, 0x04, 0x00, 0x30, 0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 0x08, 0x20, 0x00, 0x00, 
+0x90, 0x90, 0xad, 0x00, 0x80, 0x80, 0x9e, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 
+0x17, 0x40, 0x1a, 0x10, 0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 
+0x80, 0x00, 0x10, 0x20, 0x04, 0x00, 0x00, 0x80, 0x07, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 
+0x40, 0xab, 0x00, 0x1c, 0x3f, 0x7f, 0x61, 0x9f, 0x8f, 0xce, 0x00, 0x30, 0x10, 0x00, 0x48, 0x60, 
+0x74, 0xf0, 0xe0, 0xc2, 0x8a, 0x0a, 0x02, 0x00, 0x00, 0x14, 0x04, 0x20, 0x48, 0x10, 0x20, 0x40, 
+0x80, 0xe3, 0x00, 0x0d, 0x20, 0x03, 0xc0, 0x00, 0x06, 0x03, 0x03, 0x07, 0x06, 0x82, 0xc3, 0xef, 
+0xe3, 0xb0, 0x81, 0xf0, 0x09, 0xf4, 0xf1, 0xf0, 0xe0, 0x40, 0x01, 0x02, 0x10, 0x02, 0x08, 0xe1, 
+0x00, 0x19, 0x02, 0x10, 0x40, 0x00, 0x20, 0x80, 0x00, 0x04, 0x11, 0x12, 0x0c, 0x0e, 0x02, 0x00, 
+0x04, 0x08, 0x00, 0x00, 0x20, 0x20, 0x28, 0x1c, 0x97, 0x5c, 0x0f, 0x04, 0xe6, 0x00, 0x07, 0x01, 
+0x02, 0x00, 0x01, 0x08, 0x02, 0x10, 0x14, 0x83, 0x00, 0x07, 0x04, 0x14, 0x00, 0x08, 0x01, 0x04, 
+0x02, 0x01, 0xff, 0x00, 0xc4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xbf, 0x00, 0x00, 0x01, 0xd4, 
+0x00, 0x19, 0xe0, 0xf0, 0xf0, 0x70, 0x10, 0x80, 0x40, 0x60, 0x64, 0x60, 0xe2, 0xea, 0xc8, 0x80, 
+0x00, 0x08, 0x0a, 0x0a, 0x02, 0x10, 0x04, 0x20, 0x48, 0x90, 0x20, 0x40, 0xe3, 0x00, 0x0d, 0xc0, 
+0x03, 0x00, 0x00, 0x06, 0x03, 0x03, 0x07, 0x06, 0x0e, 0x0f, 0x0f, 0x03, 0x00, 0x80, 0xc0, 0x0a, 
+0xc3, 0xc7, 0xa2, 0xa0, 0xe0, 0x80, 0x80, 0x01, 0x0c, 0x01, 0x04, 0xe1, 0x00, 0x1b, 0x01, 0x08, 
+0x20, 0x8c, 0x10, 0x40, 0x80, 0x04, 0x1e, 0x1f, 0x17, 0x16, 0x1f, 0x04, 0x04, 0x0e, 0x1e, 0x1e, 
+0x3f, 0x37, 0x33, 0x11, 0x19, 0x1f, 0x0f, 0x00, 0x00, 0x08, 0xe5, 0x00, 0x06, 0x01, 0x02, 0x04, 
+0x01, 0x08, 0x0a, 0x00, 0x83, 0x14, 0x0c, 0xd0, 0xf0, 0xf2, 0xd8, 0x18, 0x6c, 0xfc, 0xfe, 0xbe, 
+0xfe, 0xfe, 0xbc, 0x18, 0xf0, 0x00, 0x00, 0x03, 0x80, 0x07, 0x07, 0x0c, 0x0c, 0x0f, 0x07, 0x03, 
+0x07, 0x07, 0x03, 0xc2, 0x00, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x80, 0x00, 
+0x80, 0x00, 0x10, 0x00, 0x40, 0x00, 0x80, 0x00, 0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 
+0x20, 0x80, 0x00, 0x40, 0x04, 0x04, 0x00, 0x30, 0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 
+0x08, 0x20, 0x00, 0x00, 0x90, 0x90, 0xd1, 0x00, 0x00, 0x20, 0x80, 0x00, 0x1b, 0x80, 0x00, 0x01, 
+0x00, 0x40, 0x1a, 0x10, 0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 
+0x80, 0x00, 0x10, 0x20, 0x04, 0x00, 0x00, 0x80, 0x0f, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 
+0x40, 0xb1, 0x00, 0x07, 0x40, 0x20, 0x90, 0x40, 0x20, 0x00, 0x00, 0x02, 0x84, 0x00, 0x08, 0x08, 
+0x02, 0x10, 0x04, 0x20, 0x40, 0x10, 0x20, 0x80, 0xe3, 0x00, 0x03, 0x0c, 0x01, 0x98, 0x02, 0x84, 
+0x00, 0x01, 0x40, 0x40, 0x83, 0x00, 0x00, 0x80, 0x81, 0x00, 0x03, 0x02, 0xf0, 0x03, 0xf8, 0xe1, 
+0x00, 0x06, 0x06, 0x10, 0x43, 0x88, 0x20, 0x40, 0x80, 0x80, 0x00, 0x11, 0x02, 0x1a, 0x01, 0x00, 
+0x02, 0x10, 0x00, 0x09, 0x00, 0x00, 0x02, 0x81, 0x40, 0x00, 0x88, 0x01, 0x10, 0x03, 0xe5, 0x00, 
+0x05, 0x01, 0x02, 0x04, 0x01, 0x00, 0x02, 0x83, 0x00, 0x07, 0xc0, 0x10, 0x00, 0x60, 0x80, 0x30, 
+0x30, 0x03, 0x80, 0x00, 0x01, 0x40, 0x20, 0xf3, 0x00, 0x08, 0x08, 0x03, 0x10, 0x00, 0x08, 0x04, 
+0x00, 0x00, 0x04, 0xc2, 0x00, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x80, 0x00, 
+0x80, 0x00, 0x10, 0x00, 0x40, 0x00, 0x80, 0x00, 0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 
+0x20, 0x80, 0x00, 0x40, 0x04, 0x04, 0x00, 0x30, 0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x00, 
+0x08, 0x20, 0x00, 0x00, 0x90, 0x90, 0xd1, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 
+0x17, 0x40, 0x0a, 0x10, 0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 
+0x80, 0x00, 0x10, 0x20, 0x04, 0x00, 0x00, 0x80, 0x0f, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 
+0x40, 0xb1, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x04, 0x89, 0x00, 0x05, 0x10, 0x00, 0x08, 0x80, 
+0x00, 0x40, 0xe3, 0x00, 0x02, 0xf0, 0x02, 0x60, 0x86, 0x00, 0x01, 0x20, 0x40, 0x81, 0x00, 0x09, 
+0x60, 0x20, 0x80, 0xc0, 0x00, 0x00, 0x01, 0x08, 0x00, 0x04, 0xe1, 0x00, 0x03, 0x01, 0x08, 0x00, 
+0x04, 0x81, 0x00, 0x13, 0x1e, 0x1f, 0x1e, 0x06, 0x04, 0x01, 0x15, 0x13, 0x03, 0x0b, 0x08, 0x00, 
+0x03, 0x00, 0x00, 0x20, 0x00, 0x42, 0x00, 0x04, 0xe8, 0x00, 0x02, 0x04, 0x00, 0x08, 0x84, 0x00, 
+0x0b, 0x20, 0x10, 0x48, 0x20, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00, 0x28, 0xf0, 0x00, 0x0b, 
+0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0xc2, 0x00, 0x01, 0xff, 
+0x00, 0xbc, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x10, 0x00, 0x40, 0x00, 0x80, 
+0x00, 0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 0x40, 0x04, 0x04, 0x00, 
+0x30, 0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x90, 0x90, 0xd1, 
+0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x17, 0x40, 0x0a, 0x10, 0x04, 0x00, 0x04, 
+0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 0x20, 0x04, 0x00, 0x00, 
+0x80, 0x0f, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0xb2, 0x00, 0x09, 0x40, 0x20, 0x90, 
+0x48, 0x20, 0x14, 0x10, 0x0a, 0x0a, 0x08, 0x81, 0x00, 0x05, 0x08, 0x02, 0x00, 0x10, 0x00, 0x08, 
+0xe7, 0x00, 0x03, 0x04, 0x01, 0x0c, 0x03, 0x82, 0x00, 0x03, 0x80, 0xa0, 0x80, 0x40, 0x82, 0x00, 
+0x02, 0x20, 0x00, 0xc0, 0x80, 0x00, 0x03, 0x04, 0x00, 0x00, 0xc0, 0xec, 0x00, 0x10, 0x16, 0x12, 
+0x04, 0x00, 0x02, 0x0f, 0x0f, 0x03, 0x00, 0x00, 0x80, 0x40, 0x30, 0x8c, 0x20, 0x08, 0x01, 0xe7, 
+0x00, 0x05, 0x04, 0x00, 0x08, 0x00, 0x00, 0x10, 0x81, 0x14, 0x0d, 0xc0, 0x22, 0x0a, 0xc1, 0xc1, 
+0x50, 0xe2, 0x59, 0xb2, 0x02, 0x00, 0xe8, 0x78, 0x30, 0xef, 0x00, 0x0b, 0x07, 0x06, 0x04, 0x08, 
+0x1b, 0x18, 0x08, 0x00, 0x06, 0x04, 0x02, 0x01, 0xc1, 0x00, 0x00, 0xff, 0xff, 0xbb, 0xff, 0x2b, 
+0x07, 0x77, 0x77, 0x37, 0xff, 0x1f, 0x03, 0x03, 0x37, 0x07, 0x3f, 0xff, 0xff, 0x0f, 0x07, 0x1f, 
+0x9f, 0xcf, 0xef, 0xef, 0xcf, 0x8f, 0x1f, 0x7f, 0x07, 0xc7, 0xf7, 0x77, 0x07, 0xcf, 0xef, 0xaf, 
+0x0f, 0xef, 0xf7, 0xe7, 0x07, 0x0f, 0xef, 0x1f, 0x0f, 0x67, 0xe7, 0xe7, 0xd1, 0xff, 0x28, 0xe0, 
+0x00, 0xff, 0xff, 0x03, 0xe0, 0xfd, 0xfc, 0x80, 0x0e, 0xf0, 0xc3, 0xc0, 0xf8, 0xe0, 0xc6, 0x9f, 
+0x9f, 0xbf, 0xbf, 0x9f, 0xc7, 0xe0, 0x80, 0x00, 0xe3, 0xc1, 0xcc, 0x9e, 0x3f, 0xff, 0x3f, 0x00, 
+0x3f, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xe0, 0x80, 0x80, 0x9e, 0x00, 0x9f, 0xb6, 0xff, 0x8a, 0x7f, 
+0xe7, 0xff, 0x08, 0x3f, 0x1f, 0x07, 0xc3, 0xe3, 0xf1, 0xf9, 0xfc, 0x7c, 0x80, 0x7e, 0x06, 0x3e, 
+0x3e, 0x3f, 0xff, 0xff, 0xfe, 0xfe, 0x80, 0x3e, 0x08, 0x3c, 0xbc, 0xf8, 0xf9, 0xf3, 0xe3, 0x87, 
+0x0f, 0x3f, 0xde, 0xff, 0x04, 0xe0, 0x80, 0x0f, 0x3f, 0x7f, 0x81, 0xff, 0x03, 0xe2, 0xc0, 0xc1, 
+0xc1, 0x80, 0xe5, 0x04, 0xf5, 0xf4, 0xf4, 0xf0, 0xf9, 0x82, 0xff, 0x04, 0x7f, 0x3f, 0x0f, 0x80, 
+0xc0, 0xe1, 0xff, 0x04, 0xfe, 0xfc, 0xfc, 0xf8, 0xf9, 0x80, 0xf3, 0x00, 0xf7, 0x84, 0xe7, 0x0c, 
+0x77, 0x13, 0x03, 0x43, 0x61, 0xe1, 0x30, 0x30, 0x12, 0x03, 0x07, 0x07, 0x87, 0xcc, 0xff, 0x00, 
+0xfe, 0xa1, 0xff, 0x04, 0xfc, 0xf8, 0xf8, 0xf0, 0xf8, 0x81, 0xfc, 0x00, 0xfe, 0xa2, 0xff, 0x00, 
+0xfe, 0x9c, 0xff, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x00, 0x40, 0x9a, 0x00, 0x00, 0x40, 0xfc, 0x00, 
+0x00, 0x40, 0xb5, 0x00, 0x07, 0x80, 0xe0, 0x70, 0x38, 0x18, 0x1c, 0x0c, 0x0e, 0x83, 0x06, 0x09, 
+0x86, 0x86, 0x8e, 0x8c, 0x9c, 0x98, 0xb0, 0x70, 0x60, 0x00, 0x80, 0x80, 0xe0, 0x00, 0x15, 0xf8, 
+0xff, 0x0f, 0x81, 0xc0, 0x80, 0x00, 0xc0, 0xe0, 0xf8, 0x3c, 0x1c, 0x0e, 0x06, 0x03, 0x9b, 0xf1, 
+0x61, 0x41, 0xc1, 0xc1, 0xc0, 0x80, 0x00, 0x0c, 0x1e, 0x3f, 0x31, 0xc1, 0xc3, 0x43, 0x07, 0x06, 
+0x0c, 0x1c, 0x78, 0xf0, 0xc0, 0xd7, 0x00, 0x1b, 0x03, 0x0f, 0x3e, 0x71, 0xe1, 0xc7, 0xc6, 0xd8, 
+0xb8, 0x37, 0x0f, 0x6f, 0xcf, 0xcf, 0x8e, 0x80, 0x1d, 0x3f, 0x3e, 0x3e, 0x1a, 0x9a, 0xda, 0xea, 
+0x73, 0x34, 0x00, 0x07, 0x82, 0x00, 0x04, 0x80, 0xc0, 0xf0, 0x7f, 0x3f, 0xdc, 0x00, 0x01, 0x01, 
+0x07, 0x80, 0x1f, 0x0c, 0x1e, 0x1c, 0x3d, 0x39, 0x39, 0x13, 0x03, 0x03, 0x0f, 0x1e, 0x1b, 0x1b, 
+0x19, 0x80, 0x18, 0x0c, 0x88, 0xec, 0xfc, 0xbc, 0x9e, 0x1e, 0xcf, 0xcf, 0xed, 0xfc, 0xf8, 0xf8, 
+0x78, 0xf1, 0x00, 0x04, 0x03, 0x07, 0x07, 0x0f, 0x07, 0x81, 0x03, 0x00, 0x01, 0xc2, 0x00, 0x00, 
+0xff, 0xff, 0xbb, 0xff, 0x2b, 0x07, 0x07, 0x77, 0x37, 0x7f, 0x1f, 0x83, 0x03, 0x27, 0x07, 0x7f, 
+0xff, 0x7f, 0x0f, 0x43, 0x3f, 0x9f, 0xcf, 0xef, 0xcf, 0x9f, 0x3f, 0x3f, 0xff, 0x07, 0x87, 0xf3, 
+0x73, 0x07, 0xff, 0xe7, 0x07, 0x07, 0xef, 0xff, 0xf7, 0x07, 0x07, 0xe7, 0x3f, 0x0f, 0x67, 0x77, 
+0x7f, 0xd1, 0xff, 0x28, 0xc0, 0x00, 0xff, 0xff, 0x83, 0xe0, 0xfd, 0xfc, 0xc0, 0x04, 0xe0, 0xc7, 
+0xc0, 0xfc, 0xe0, 0xc0, 0x9f, 0xbf, 0xbf, 0x9f, 0x9f, 0xcf, 0xe0, 0x00, 0x00, 0xf3, 0xe1, 0xc8, 
+0x9e, 0x3f, 0x7f, 0x30, 0x00, 0x3f, 0x3f, 0xbf, 0x00, 0x00, 0xff, 0xe0, 0x80, 0x80, 0x9e, 0x00, 
+0xdf, 0xa7, 0xff, 0x0d, 0x7f, 0x1f, 0x8f, 0xc7, 0xe7, 0xf3, 0x71, 0x39, 0x19, 0x09, 0x88, 0xcc, 
+0xcc, 0xf8, 0x80, 0xf9, 0x06, 0xf1, 0xf3, 0xe7, 0xc7, 0x8f, 0x1f, 0x3f, 0xe1, 0xff, 0x0d, 0xbf, 
+0x1f, 0x07, 0x00, 0xc0, 0xe6, 0x87, 0x01, 0x79, 0xf3, 0xf2, 0x46, 0x0f, 0x3f, 0x89, 0xff, 0x03, 
+0xfe, 0xf0, 0x00, 0x07, 0x96, 0xff, 0x01, 0x07, 0x07, 0x80, 0xe7, 0x13, 0x07, 0x0f, 0xff, 0x7f, 
+0x3f, 0x9f, 0xdf, 0x9f, 0x9f, 0xbf, 0x3f, 0x67, 0xcf, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0x1f, 0x87, 
+0x9b, 0xff, 0x0f, 0xf9, 0xf9, 0xf1, 0xf0, 0xc0, 0xc0, 0xc1, 0xc1, 0xc3, 0x83, 0x87, 0xa7, 0x27, 
+0x23, 0x23, 0x03, 0x80, 0x47, 0x0d, 0x4f, 0x4e, 0x10, 0x00, 0x87, 0x1f, 0x3e, 0x78, 0xe1, 0xc7, 
+0xc0, 0xe0, 0xe0, 0xf1, 0x85, 0xff, 0x06, 0x7f, 0x3f, 0x1f, 0x87, 0xc0, 0xf0, 0xfe, 0x96, 0xff, 
+0x0a, 0x80, 0x00, 0x7f, 0x79, 0x79, 0x78, 0x38, 0x83, 0xc0, 0x8c, 0xbf, 0x80, 0x3f, 0x09, 0xbf, 
+0x9e, 0xc0, 0xe1, 0xff, 0xfe, 0x1c, 0x85, 0xe0, 0xfc, 0xaf, 0xff, 0x80, 0xfe, 0x80, 0xff, 0x05, 
+0xfe, 0xfc, 0xfc, 0xf8, 0xf9, 0xf1, 0x83, 0xf3, 0x05, 0xf9, 0xf9, 0xf8, 0xfc, 0xfc, 0xfe, 0x9c, 
+0xff, 0x00, 0xfc, 0x80, 0xfe, 0x8b, 0xff, 0x01, 0xf8, 0xfc, 0xaa, 0xff, 0x00, 0xfe, 0xd0, 0xff, 
+0x00, 0xfe, 0x9c, 0xff, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x80, 0x00, 0x80, 
+0x00, 0x10, 0x00, 0x40, 0x00, 0x80, 0x00, 0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 
+0x80, 0x00, 0x40, 0x04, 0x04, 0x00, 0x30, 0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 0x08, 
+0x20, 0x00, 0x00, 0x90, 0x98, 0xd1, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x17, 
+0x40, 0x1a, 0x10, 0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 
+0x00, 0x10, 0x20, 0x04, 0x00, 0x00, 0x80, 0x4f, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 
+0xa8, 0x00, 0x16, 0x20, 0x90, 0x48, 0x20, 0x10, 0x02, 0x2a, 0x18, 0x80, 0x51, 0x35, 0x35, 0x01, 
+0x00, 0x00, 0x0a, 0x02, 0x10, 0x20, 0x48, 0x90, 0x20, 0x40, 0xcf, 0x00, 0x00, 0x80, 0x80, 0xc0, 
+0x09, 0x80, 0x00, 0x00, 0xc0, 0xe0, 0xe0, 0x60, 0x60, 0xe0, 0xc0, 0x81, 0x00, 0x0d, 0x20, 0x00, 
+0x08, 0x01, 0x20, 0xe2, 0x88, 0xce, 0xb6, 0x3f, 0x3c, 0xd8, 0x30, 0x40, 0x8b, 0x00, 0x01, 0x01, 
+0x08, 0xcc, 0x00, 0x10, 0x3c, 0x79, 0xe9, 0xf0, 0xf2, 0xc0, 0xc0, 0xf1, 0xb8, 0xfb, 0xbb, 0xbb, 
+0x1b, 0xb8, 0xaf, 0xe3, 0xe2, 0x80, 0xb8, 0x0d, 0xb0, 0xb0, 0xe0, 0xc0, 0x88, 0x01, 0x46, 0x89, 
+0x22, 0x20, 0x21, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x80, 0x40, 0x20, 0x88, 0x01, 0x10, 0x02, 
+0xce, 0x00, 0x85, 0x01, 0x87, 0x00, 0x80, 0x01, 0x08, 0x00, 0x00, 0x01, 0x02, 0x00, 0x04, 0x01, 
+0x08, 0x02, 0x83, 0x00, 0x06, 0x0a, 0x08, 0x01, 0x04, 0x00, 0x02, 0x01, 0xff, 0x00, 0xce, 0x00, 
+0x01, 0xff, 0x00, 0xbc, 0x00, 0x09, 0x30, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x10, 0x00, 0x40, 
+0x80, 0x00, 0x01, 0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 0x40, 0x04, 
+0x04, 0x00, 0x30, 0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 0x08, 0x20, 0x08, 0x00, 0x90, 
+0x90, 0xd1, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x17, 0x40, 0x1a, 0x10, 0x04, 
+0x00, 0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 0x20, 0x04, 
+0x00, 0x00, 0x80, 0x4f, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0xa7, 0x00, 0x0a, 0x40, 
+0x20, 0x90, 0x48, 0x20, 0x00, 0x00, 0x22, 0x08, 0x00, 0x40, 0x81, 0x00, 0x03, 0x08, 0x00, 0x10, 
+0x04, 0x81, 0x00, 0x00, 0x80, 0xce, 0x00, 0x08, 0x80, 0x00, 0x00, 0x40, 0xc0, 0x80, 0xc0, 0xe0, 
+0x20, 0x80, 0x80, 0x02, 0xa0, 0x60, 0xc0, 0x83, 0x00, 0x0b, 0x0c, 0x01, 0x20, 0xe2, 0x10, 0xc0, 
+0x00, 0x00, 0x02, 0x80, 0x00, 0x80, 0x88, 0x00, 0x04, 0x01, 0x06, 0xf0, 0x02, 0xf0, 0x98, 0x00, 
+0x04, 0x20, 0x00, 0x80, 0x00, 0x08, 0x80, 0x00, 0x0f, 0x80, 0x40, 0x00, 0x00, 0xa0, 0x00, 0x08, 
+0x08, 0x90, 0x20, 0x00, 0x00, 0x80, 0x00, 0x80, 0x20, 0x99, 0x00, 0x10, 0x43, 0x00, 0x30, 0x01, 
+0x06, 0x04, 0x31, 0x48, 0x41, 0x04, 0xa4, 0xa3, 0x32, 0x5f, 0x6d, 0x3f, 0x1e, 0x81, 0x00, 0x0c, 
+0x06, 0x10, 0x43, 0x10, 0x21, 0x04, 0x09, 0x00, 0x20, 0x01, 0x04, 0x10, 0x0f, 0x85, 0x00, 0x06, 
+0x80, 0x40, 0x20, 0x88, 0x01, 0x18, 0x03, 0x96, 0x00, 0x0a, 0x80, 0x00, 0x06, 0x00, 0x01, 0x44, 
+0x21, 0x02, 0x00, 0x00, 0x80, 0x80, 0x00, 0x0a, 0x20, 0x50, 0x20, 0x11, 0x00, 0x00, 0x20, 0x85, 
+0x20, 0x0c, 0x01, 0x9d, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x01, 0x8e, 0x00, 0x03, 0x04, 0x01, 
+0x08, 0x02, 0x89, 0x00, 0x01, 0x02, 0x01, 0x9a, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x8a, 
+0x00, 0x02, 0x01, 0x04, 0x01, 0xff, 0x00, 0x9b, 0x00, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x09, 0x70, 
+0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x10, 0x00, 0x40, 0x80, 0x00, 0x01, 0x44, 0x20, 0x80, 0x00, 
+0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 0x40, 0x04, 0x04, 0x00, 0x30, 0x08, 0xe8, 0x08, 0x00, 
+0x08, 0x10, 0x00, 0x08, 0x08, 0x20, 0x08, 0x00, 0x90, 0x90, 0xd1, 0x00, 0x00, 0x20, 0x80, 0x00, 
+0x00, 0x80, 0x80, 0x00, 0x17, 0x40, 0x1a, 0x10, 0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 
+0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 0x20, 0x04, 0x00, 0x00, 0x80, 0x0f, 0x80, 0x00, 0x00, 
+0x40, 0x85, 0x00, 0x00, 0x40, 0xa6, 0x00, 0x00, 0x80, 0x81, 0x00, 0x07, 0x04, 0x10, 0x82, 0xc8, 
+0x70, 0xf0, 0xa0, 0x80, 0x80, 0x00, 0x03, 0x08, 0x00, 0x10, 0x04, 0xd3, 0x00, 0x0d, 0x80, 0x80, 
+0xc0, 0x80, 0x00, 0xc0, 0x20, 0x80, 0x80, 0x00, 0x80, 0x20, 0x40, 0x80, 0x82, 0x00, 0x0f, 0x20, 
+0x00, 0x02, 0x00, 0x04, 0x01, 0x28, 0x90, 0x00, 0x51, 0x50, 0x22, 0x43, 0x03, 0x01, 0x01, 0x86, 
+0x00, 0x00, 0x01, 0xd0, 0x00, 0x06, 0x80, 0xc4, 0x20, 0x09, 0x0d, 0x0d, 0x19, 0x80, 0x00, 0x04, 
+0x80, 0x01, 0x0e, 0x00, 0x1e, 0x85, 0x00, 0x09, 0x04, 0x00, 0x01, 0x04, 0x09, 0x04, 0x00, 0x01, 
+0x04, 0x11, 0x88, 0x00, 0x02, 0x10, 0x44, 0x20, 0xce, 0x00, 0x04, 0x01, 0x01, 0x02, 0x04, 0x06, 
+0x81, 0x02, 0x00, 0x01, 0x8e, 0x00, 0x03, 0x04, 0x01, 0x08, 0x02, 0x84, 0x00, 0x04, 0x0a, 0x08, 
+0x01, 0x04, 0x02, 0xff, 0x00, 0xd0, 0x00, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x00, 0x40, 0xff, 0x00, 
+0x82, 0x00, 0x00, 0x10, 0x92, 0x00, 0x00, 0x40, 0xb8, 0x00, 0x08, 0x04, 0x10, 0x02, 0x0a, 0x8a, 
+0x08, 0x40, 0x80, 0x08, 0x80, 0x0a, 0x06, 0x14, 0x34, 0x2c, 0x48, 0x90, 0x20, 0xc0, 0xd2, 0x00, 
+0x09, 0x80, 0xc0, 0x00, 0x20, 0xa0, 0xa0, 0xe0, 0x60, 0xc0, 0x80, 0x83, 0x00, 0x0e, 0x80, 0x10, 
+0x00, 0x80, 0x08, 0xc0, 0x28, 0x00, 0x00, 0x04, 0x85, 0x04, 0x80, 0x00, 0x02, 0x86, 0x00, 0x04, 
+0x01, 0x03, 0x38, 0x03, 0x1c, 0x96, 0x00, 0x1b, 0x30, 0x08, 0x20, 0xc0, 0xf0, 0x70, 0x00, 0x08, 
+0x00, 0x40, 0x20, 0x80, 0x40, 0x40, 0x00, 0x80, 0x00, 0xa0, 0xc8, 0x68, 0xd0, 0xe0, 0xc0, 0x00, 
+0x20, 0x98, 0xc0, 0xe0, 0x98, 0x00, 0x0d, 0x07, 0x43, 0x27, 0x2f, 0x0d, 0x08, 0xc9, 0x89, 0x45, 
+0x02, 0x02, 0x1e, 0x41, 0x3f, 0x83, 0x00, 0x0c, 0x07, 0x18, 0x63, 0x98, 0x20, 0x42, 0x88, 0x32, 
+0x08, 0x26, 0x01, 0x00, 0x02, 0x89, 0x00, 0x02, 0x43, 0x00, 0x06, 0x98, 0x00, 0x19, 0x7e, 0x3f, 
+0x79, 0x28, 0x38, 0x3d, 0x1c, 0x40, 0xbf, 0x0c, 0x58, 0x51, 0x19, 0xaf, 0x42, 0x20, 0x0e, 0xc7, 
+0xff, 0xdf, 0xfe, 0xfe, 0xff, 0x3d, 0x0f, 0x01, 0x98, 0x00, 0x05, 0x06, 0x06, 0x04, 0x08, 0x18, 
+0x0c, 0x80, 0x04, 0x00, 0x02, 0x8b, 0x00, 0x06, 0x01, 0x02, 0x04, 0x05, 0x0b, 0x0a, 0x12, 0x83, 
+0x14, 0x05, 0x00, 0x0a, 0x08, 0x01, 0x04, 0x02, 0x9c, 0x00, 0x01, 0x01, 0x02, 0x80, 0x00, 0x00, 
+0x01, 0x89, 0x00, 0x04, 0x03, 0x05, 0x05, 0x02, 0x01, 0xff, 0x00, 0x9a, 0x00, 0x01, 0xff, 0x00, 
+0xbc, 0x00, 0x09, 0x30, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x10, 0x00, 0x40, 0x80, 0x00, 0x01, 
+0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 0x40, 0x04, 0x04, 0x00, 0x30, 
+0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 0x08, 0x20, 0x00, 0x00, 0x90, 0x98, 0xd1, 0x00, 
+0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x17, 0x40, 0x0a, 0x10, 0x04, 0x00, 0x04, 0x00, 
+0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 0x20, 0x04, 0x00, 0x00, 0x80, 
+0x4f, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0xbc, 0x00, 0x00, 0x40, 0xd4, 0x00, 0x00, 
+0x40, 0x82, 0x00, 0x00, 0x80, 0x85, 0x00, 0x0f, 0x40, 0x08, 0x00, 0x90, 0x40, 0x28, 0x10, 0x50, 
+0x00, 0x52, 0x80, 0x01, 0x84, 0x00, 0x00, 0x02, 0x86, 0x00, 0x03, 0x04, 0xc0, 0x00, 0x20, 0x96, 
+0x00, 0x0b, 0x40, 0x00, 0x38, 0xc8, 0xf0, 0xe0, 0x00, 0x80, 0x00, 0x40, 0x20, 0x00, 0x80, 0x10, 
+0x0c, 0x00, 0x20, 0xd0, 0x90, 0x20, 0x08, 0x80, 0x40, 0x80, 0x40, 0xe0, 0x00, 0x90, 0x99, 0x00, 
+0x03, 0x20, 0x00, 0x02, 0x04, 0x80, 0x00, 0x02, 0x05, 0x00, 0x02, 0x87, 0x00, 0x00, 0x20, 0x80, 
+0x00, 0x03, 0x02, 0x08, 0x22, 0x08, 0x80, 0x00, 0x00, 0x10, 0x89, 0x00, 0x02, 0x40, 0x10, 0x01, 
+0x96, 0x00, 0x1b, 0x78, 0x00, 0x7e, 0x57, 0x19, 0x48, 0x98, 0xa5, 0x02, 0x40, 0xf3, 0xac, 0xf8, 
+0xd1, 0x99, 0xaf, 0x4c, 0x20, 0x01, 0xc7, 0xfe, 0xdc, 0xe0, 0x38, 0xaf, 0x5b, 0x0f, 0x01, 0x99, 
+0x00, 0x02, 0x02, 0x00, 0x10, 0x82, 0x00, 0x00, 0x02, 0x8a, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 
+0x08, 0xac, 0x00, 0x81, 0x01, 0x89, 0x00, 0x05, 0x06, 0x04, 0x00, 0x03, 0x03, 0x01, 0xff, 0x00, 
+0x9a, 0x00, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x09, 0x30, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x10, 
+0x00, 0x40, 0x80, 0x00, 0x01, 0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 
+0x40, 0x04, 0x04, 0x00, 0x30, 0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 0x08, 0x20, 0x00, 
+0x00, 0x90, 0x98, 0xd1, 0x00, 0x00, 0x20, 0x80, 0x00, 0x1b, 0x80, 0x00, 0x01, 0x00, 0x40, 0x0a, 
+0x10, 0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 
+0x20, 0x44, 0x00, 0x00, 0x80, 0x4f, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0xaa, 0x00, 
+0x11, 0x08, 0x20, 0x04, 0x10, 0x00, 0x00, 0x02, 0x0a, 0x0a, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 
+0x40, 0x90, 0x20, 0xd4, 0x00, 0x07, 0x80, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x80, 0x85, 0x00, 
+0x0f, 0x40, 0x00, 0x00, 0x90, 0x40, 0xe8, 0x30, 0xd0, 0x00, 0x02, 0x40, 0xa1, 0x44, 0x00, 0x00, 
+0x02, 0x89, 0x00, 0x00, 0x40, 0xcd, 0x00, 0x04, 0x20, 0x20, 0x28, 0x28, 0x20, 0x82, 0x00, 0x00, 
+0x20, 0x86, 0x00, 0x0c, 0x08, 0x00, 0x84, 0x00, 0x40, 0x81, 0x04, 0x19, 0x24, 0x26, 0x01, 0x00, 
+0x13, 0x89, 0x00, 0x01, 0x40, 0x10, 0xce, 0x00, 0x80, 0x08, 0x06, 0x10, 0x00, 0x10, 0x08, 0x00, 
+0x00, 0x02, 0x8b, 0x00, 0x06, 0x02, 0x04, 0x01, 0x00, 0x00, 0x10, 0x04, 0x83, 0x00, 0x02, 0x14, 
+0x00, 0x02, 0xff, 0x00, 0xd3, 0x00, 0x00, 0xff, 0xff, 0xbb, 0xff, 0x2b, 0x07, 0x07, 0x77, 0x37, 
+0x7f, 0x1f, 0x83, 0x03, 0x27, 0x07, 0x7f, 0xff, 0x7f, 0x0f, 0x43, 0x3f, 0x9f, 0xcf, 0xef, 0xcf, 
+0x9f, 0x3f, 0x3f, 0xff, 0x07, 0x87, 0xf3, 0x73, 0x07, 0xff, 0xe7, 0x07, 0x07, 0xef, 0xff, 0xf7, 
+0x07, 0x07, 0xe7, 0x3f, 0x0f, 0x67, 0x77, 0x77, 0xd1, 0xff, 0x28, 0xc0, 0x00, 0xff, 0xff, 0x83, 
+0xe0, 0xfd, 0xfc, 0xc0, 0x04, 0xe0, 0xc7, 0xc0, 0xfc, 0xe0, 0xc0, 0x9f, 0xbf, 0xbf, 0x9f, 0x9f, 
+0xcf, 0xe0, 0x00, 0x00, 0xf3, 0xe1, 0xc8, 0x9e, 0x3f, 0x7f, 0x30, 0x00, 0x3f, 0x3f, 0xbf, 0x00, 
+0x00, 0xff, 0xe0, 0x80, 0x80, 0x9e, 0x00, 0xdf, 0xa7, 0xff, 0x06, 0x7f, 0x3f, 0x1f, 0x9f, 0x8f, 
+0xcf, 0xc7, 0x80, 0xe7, 0x80, 0x67, 0x07, 0xe7, 0xe7, 0xc7, 0xcf, 0x8f, 0x9f, 0x3f, 0x3f, 0xd5, 
+0xff, 0x84, 0x7f, 0x86, 0xff, 0x0e, 0x1f, 0x03, 0x00, 0x98, 0xce, 0xff, 0x7f, 0x3f, 0x9f, 0x9b, 
+0x39, 0x38, 0x78, 0xfc, 0xfc, 0x85, 0xff, 0x04, 0xfc, 0xf8, 0x81, 0x07, 0x3f, 0x94, 0xff, 0x02, 
+0x1f, 0x0f, 0x0f, 0x80, 0xcf, 0x19, 0x0f, 0x1f, 0x3f, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x8f, 0xcf, 
+0xcf, 0x8f, 0x0f, 0x1f, 0x7f, 0xff, 0x8f, 0x0f, 0x1f, 0x3f, 0xff, 0xff, 0x7f, 0x1f, 0x0f, 0x8f, 
+0x96, 0xff, 0x0b, 0x07, 0x07, 0x27, 0x04, 0x20, 0xe0, 0xe2, 0xf6, 0xfe, 0x3c, 0x00, 0x81, 0x85, 
+0xff, 0x0e, 0xf0, 0x80, 0x07, 0x3f, 0x7f, 0xff, 0xfe, 0xf8, 0xf1, 0xc7, 0x9f, 0xc2, 0xc0, 0xc0, 
+0xe7, 0x85, 0xff, 0x04, 0x7f, 0x1f, 0x01, 0xc0, 0xf8, 0x94, 0xff, 0x02, 0x80, 0x00, 0x00, 0x81, 
+0x18, 0x06, 0x80, 0x80, 0xe3, 0xff, 0xe0, 0x80, 0x80, 0x80, 0x1f, 0x03, 0x0f, 0x80, 0xc0, 0xf0, 
+0x80, 0xff, 0x06, 0x3c, 0x00, 0x80, 0xc1, 0xf0, 0xfc, 0xfe, 0x97, 0xff, 0x80, 0xf8, 0x07, 0xf0, 
+0xf1, 0xf0, 0xf1, 0xf9, 0xf8, 0xf8, 0xfe, 0x89, 0xff, 0x06, 0xfe, 0xf8, 0xf8, 0xf1, 0xe3, 0xe7, 
+0xe7, 0x84, 0xcf, 0x07, 0xc7, 0xe7, 0xe7, 0xf3, 0xf1, 0xf8, 0xfc, 0xfe, 0xdc, 0xff, 0x00, 0xfe, 
+0xd0, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x80, 
+0x00, 0x80, 0x00, 0x10, 0x00, 0x40, 0x00, 0x80, 0x00, 0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 
+0xb0, 0x20, 0x80, 0x00, 0x40, 0x04, 0x04, 0x00, 0x30, 0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 
+0x08, 0x08, 0x20, 0x00, 0x00, 0x90, 0x90, 0xd1, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 
+0x00, 0x17, 0x40, 0x0a, 0x10, 0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 
+0x00, 0x80, 0x00, 0x10, 0x20, 0x04, 0x00, 0x00, 0x80, 0x0f, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 
+0x00, 0x40, 0xa9, 0x00, 0x00, 0x20, 0x84, 0x00, 0x80, 0x80, 0x07, 0x00, 0x00, 0x08, 0x00, 0x00, 
+0x80, 0x00, 0x40, 0xd3, 0x00, 0x08, 0x80, 0xc0, 0x40, 0x60, 0xe0, 0xe0, 0x60, 0x40, 0x80, 0x88, 
+0x00, 0x0c, 0x41, 0xa0, 0xf2, 0x00, 0x80, 0xc0, 0xe0, 0xe4, 0xc6, 0xcb, 0x89, 0x0f, 0x03, 0x84, 
+0x00, 0x03, 0x01, 0x00, 0x08, 0x80, 0x9d, 0x00, 0x00, 0x10, 0xae, 0x00, 0x0b, 0xe6, 0xc7, 0xa3, 
+0x8a, 0xef, 0x2f, 0x2d, 0x7b, 0x36, 0xfc, 0xe0, 0x7e, 0x88, 0x00, 0x0b, 0x01, 0x80, 0x02, 0x06, 
+0x18, 0x37, 0x49, 0xa1, 0x4e, 0x41, 0x41, 0x60, 0xa7, 0x00, 0x00, 0x80, 0xaf, 0x00, 0x80, 0x07, 
+0x07, 0x0f, 0x0e, 0x0f, 0x0e, 0x06, 0x07, 0x07, 0x01, 0x89, 0x00, 0x06, 0x02, 0x00, 0x09, 0x02, 
+0x00, 0x00, 0x20, 0x84, 0x00, 0x03, 0x08, 0x00, 0x00, 0x10, 0xff, 0x00, 0xd2, 0x00, 0x01, 0xff, 
+0x00, 0xbc, 0x00, 0x00, 0x40, 0x8a, 0x00, 0x00, 0x20, 0xff, 0x00, 0x86, 0x00, 0x00, 0x40, 0x80, 
+0x00, 0x00, 0x40, 0xb7, 0x00, 0x03, 0x80, 0x00, 0x00, 0x08, 0x84, 0x00, 0x03, 0x20, 0x00, 0x40, 
+0x10, 0xd6, 0x00, 0x0a, 0x70, 0x30, 0x70, 0xd0, 0x50, 0x50, 0xd0, 0xb0, 0xe0, 0xc0, 0x80, 0x86, 
+0x00, 0x0e, 0xa0, 0xc0, 0x42, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x0c, 0x0e, 0x8c, 0xc0, 0xc0, 
+0x80, 0x85, 0x00, 0x02, 0x02, 0x00, 0xc0, 0x94, 0x00, 0x1f, 0xe0, 0xf0, 0xf0, 0xc8, 0xcc, 0xd8, 
+0x88, 0x48, 0x30, 0x00, 0xe0, 0x70, 0x18, 0x78, 0xb8, 0xe0, 0x00, 0x90, 0x70, 0xe0, 0x90, 0x70, 
+0x90, 0x00, 0x10, 0x30, 0xe0, 0x30, 0x90, 0xe0, 0xf0, 0x70, 0x96, 0x00, 0x0c, 0x1e, 0x3f, 0x78, 
+0x72, 0x37, 0x2e, 0x28, 0x4a, 0x03, 0x01, 0x01, 0x07, 0x03, 0x84, 0x00, 0x11, 0x10, 0x00, 0x08, 
+0x01, 0x03, 0x01, 0x07, 0x2f, 0x49, 0xa1, 0x19, 0xab, 0xb6, 0xb6, 0xe1, 0xf9, 0xf8, 0xf0, 0x84, 
+0x00, 0x02, 0x01, 0x00, 0x04, 0x94, 0x00, 0x1e, 0x7f, 0xff, 0xff, 0xd8, 0x18, 0x08, 0xa0, 0x88, 
+0x02, 0x24, 0x1f, 0x27, 0x12, 0x38, 0xa3, 0x87, 0x8e, 0xc8, 0x60, 0x3f, 0x8f, 0xe6, 0x3e, 0x0f, 
+0xc0, 0xfe, 0x7f, 0x3e, 0x0f, 0x03, 0x01, 0xad, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x04, 0x00, 
+0x08, 0x85, 0x00, 0x00, 0x20, 0xa3, 0x00, 0x00, 0x01, 0xff, 0x00, 0xad, 0x00, 0x01, 0xff, 0x00, 
+0xbc, 0x00, 0x0d, 0x70, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x10, 0x00, 0x40, 0x00, 0x80, 0x00, 
+0x44, 0x81, 0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 0x40, 0x04, 0x04, 0x00, 0x30, 0x08, 
+0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 0x08, 0x20, 0x00, 0x00, 0x90, 0x90, 0xd1, 0x00, 0x00, 
+0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x17, 0x40, 0x0a, 0x10, 0x04, 0x00, 0x04, 0x00, 0x06, 
+0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 0x20, 0x44, 0x00, 0x00, 0x80, 0x4f, 
+0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0xaa, 0x00, 0x03, 0x80, 0x00, 0x00, 0x08, 0x84, 
+0x00, 0x03, 0x20, 0x00, 0x40, 0x10, 0xd6, 0x00, 0x00, 0x10, 0x84, 0x00, 0x02, 0x80, 0x20, 0x40, 
+0x86, 0x00, 0x03, 0x20, 0x00, 0x82, 0x80, 0x84, 0x00, 0x02, 0x80, 0x40, 0x40, 0x86, 0x00, 0x02, 
+0x02, 0x00, 0xc0, 0x97, 0x00, 0x1a, 0xf8, 0xfc, 0xe8, 0x88, 0xc0, 0xc0, 0x30, 0xc0, 0x10, 0x38, 
+0x68, 0xf0, 0xc8, 0x00, 0x00, 0x40, 0x20, 0x20, 0x10, 0x20, 0x70, 0xf0, 0x30, 0x00, 0x00, 0x30, 
+0x20, 0x9a, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x10, 0x04, 0x00, 0x04, 0x00, 0x00, 0x08, 0x04, 0x84, 
+0x00, 0x12, 0x10, 0x00, 0x08, 0x00, 0x03, 0x05, 0x06, 0x16, 0x40, 0x20, 0x08, 0x00, 0x10, 0x00, 
+0x10, 0x22, 0x01, 0x00, 0xe0, 0x83, 0x00, 0x02, 0x01, 0x00, 0x04, 0x97, 0x00, 0x15, 0x3f, 0xff, 
+0x11, 0x38, 0x3b, 0xa1, 0xe6, 0x60, 0x47, 0x1c, 0x07, 0x83, 0xa7, 0xee, 0xf8, 0x7e, 0x3f, 0x9c, 
+0x66, 0xff, 0x6c, 0x3c, 0xb3, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x04, 0x00, 0x08, 0x85, 0x00, 
+0x00, 0x20, 0xa2, 0x00, 0x00, 0x01, 0x8c, 0x00, 0x00, 0x01, 0xff, 0x00, 0x9e, 0x00, 0x01, 0xff, 
+0x00, 0xbc, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x30, 0x00, 0x40, 0x00, 0x80, 
+0x00, 0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 0x40, 0x04, 0x04, 0x00, 
+0x30, 0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 0x08, 0x20, 0x00, 0x00, 0x90, 0x90, 0xd1, 
+0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x17, 0x40, 0x0a, 0x10, 0x04, 0x00, 0x04, 
+0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 0x20, 0x04, 0x00, 0x00, 
+0x80, 0x0f, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0xa7, 0x00, 0x02, 0x80, 0x00, 0x20, 
+0x80, 0x00, 0x02, 0x20, 0x00, 0x04, 0x82, 0x14, 0x07, 0x00, 0x28, 0x08, 0x40, 0x90, 0x20, 0x40, 
+0x80, 0xd4, 0x00, 0x00, 0x40, 0x80, 0x28, 0x02, 0x08, 0x40, 0x10, 0x86, 0x00, 0x03, 0xe0, 0x04, 
+0xc0, 0x08, 0x89, 0x00, 0x00, 0x80, 0x82, 0x00, 0x05, 0x01, 0x02, 0x0c, 0xf1, 0x06, 0x30, 0xd0, 
+0x00, 0x09, 0x02, 0x00, 0x01, 0x00, 0x20, 0x28, 0x20, 0x00, 0x00, 0x04, 0x84, 0x00, 0x12, 0x0f, 
+0x60, 0x87, 0x30, 0xc0, 0x02, 0x08, 0x20, 0x10, 0x80, 0x20, 0x40, 0x00, 0x50, 0x10, 0x40, 0x20, 
+0x00, 0x10, 0x82, 0x00, 0x03, 0x20, 0x0e, 0x40, 0x08, 0xe4, 0x00, 0x08, 0x02, 0x04, 0x09, 0x0a, 
+0x12, 0x14, 0x20, 0x28, 0x08, 0x80, 0x00, 0x05, 0x01, 0x01, 0x28, 0x00, 0x00, 0x10, 0xff, 0x00, 
+0xd2, 0x00, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x30, 
+0x00, 0x40, 0x00, 0x80, 0x00, 0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 
+0x40, 0x04, 0x04, 0x00, 0x30, 0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 0x08, 0x20, 0x00, 
+0x00, 0x90, 0x90, 0xd1, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x17, 0x40, 0x0a, 
+0x10, 0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 
+0x20, 0x04, 0x00, 0x00, 0x80, 0x0f, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0xa8, 0x00, 
+0x02, 0x40, 0x20, 0x80, 0x87, 0x00, 0x08, 0x14, 0x00, 0x20, 0x08, 0x40, 0x90, 0x20, 0x40, 0x80, 
+0xd1, 0x00, 0x02, 0x10, 0x00, 0x40, 0x80, 0x28, 0x04, 0x08, 0x40, 0x90, 0x20, 0x40, 0x85, 0x00, 
+0x04, 0x08, 0x02, 0x10, 0x00, 0x01, 0x85, 0x00, 0x02, 0x40, 0x40, 0x80, 0x83, 0x00, 0x05, 0x01, 
+0x02, 0x08, 0x81, 0x0c, 0xc0, 0x96, 0x00, 0x10, 0xf8, 0xf8, 0x18, 0xe8, 0x60, 0xc8, 0xc0, 0x20, 
+0x60, 0x20, 0x90, 0x18, 0x78, 0x50, 0xa0, 0x00, 0xb8, 0x82, 0x00, 0x04, 0xc0, 0x00, 0x48, 0x20, 
+0x20, 0x9a, 0x00, 0x09, 0x02, 0x02, 0x00, 0x11, 0x04, 0x20, 0x2c, 0x20, 0x00, 0x08, 0x86, 0x00, 
+0x11, 0x18, 0x40, 0x08, 0x20, 0x84, 0x00, 0x30, 0x10, 0x80, 0x28, 0x40, 0x10, 0x50, 0x50, 0x42, 
+0x20, 0x00, 0x90, 0x81, 0x00, 0x05, 0x80, 0x00, 0x10, 0x01, 0x10, 0x03, 0x96, 0x00, 0x09, 0x7f, 
+0xff, 0x7e, 0x79, 0x4a, 0x5b, 0x19, 0x03, 0x40, 0x02, 0x80, 0x00, 0x0a, 0x40, 0x80, 0x00, 0x00, 
+0x12, 0x80, 0xc0, 0x80, 0x45, 0x1e, 0x03, 0xb2, 0x00, 0x0d, 0x01, 0x02, 0x04, 0x01, 0x00, 0x00, 
+0x04, 0x00, 0x20, 0x28, 0x08, 0x00, 0x01, 0x09, 0x82, 0x00, 0x03, 0x01, 0x04, 0x02, 0x01, 0x9a, 
+0x00, 0x03, 0x03, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x02, 0x01, 0x07, 0x03, 0xff, 0x00, 0x9c, 0x00, 
+0x01, 0xff, 0x00, 0xbc, 0x00, 0x0e, 0x70, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x10, 0x00, 0x40, 
+0x00, 0x80, 0x00, 0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 0x40, 0x04, 
+0x04, 0x00, 0x30, 0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 0x08, 0x20, 0x00, 0x00, 0x90, 
+0x90, 0xd1, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x17, 0x40, 0x1a, 0x10, 0x04, 
+0x00, 0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 0x20, 0x04, 
+0x00, 0x00, 0x80, 0x4f, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0xff, 0x00, 0x90, 0x00, 
+0x02, 0x70, 0x10, 0x40, 0x84, 0x00, 0x00, 0x40, 0xf2, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x10, 0x24, 
+0x08, 0x04, 0x02, 0x22, 0x18, 0x04, 0x01, 0x8a, 0x00, 0x0c, 0x30, 0x10, 0xc0, 0x28, 0x00, 0x10, 
+0x10, 0x00, 0x50, 0x21, 0x08, 0x90, 0xe0, 0xff, 0x00, 0xff, 0x00, 0xd1, 0x00, 0x01, 0xff, 0x00, 
+0xff, 0x00, 0xc2, 0x00, 0x00, 0x10, 0x92, 0x00, 0x00, 0x40, 0xb4, 0x00, 0x08, 0x80, 0x40, 0x20, 
+0x90, 0x40, 0x08, 0x00, 0x04, 0x10, 0x83, 0x00, 0x00, 0x04, 0xd7, 0x00, 0x03, 0xe0, 0x70, 0x10, 
+0xc0, 0x80, 0x00, 0x04, 0x40, 0x10, 0x00, 0x00, 0xc0, 0x85, 0x00, 0x04, 0x08, 0x02, 0x10, 0x00, 
+0x01, 0x8f, 0x00, 0x04, 0x02, 0x08, 0x81, 0x04, 0xc0, 0x98, 0x00, 0x04, 0x20, 0x00, 0x80, 0x00, 
+0x08, 0x80, 0x00, 0x0e, 0x80, 0x40, 0x00, 0x00, 0xa0, 0x00, 0x08, 0x08, 0x10, 0x20, 0x00, 0x00, 
+0x80, 0x00, 0x80, 0x9b, 0x00, 0x0c, 0x01, 0x02, 0x04, 0x09, 0x12, 0x04, 0x00, 0x0e, 0x22, 0x33, 
+0x18, 0x07, 0x01, 0x84, 0x00, 0x06, 0x08, 0x00, 0x08, 0x20, 0x00, 0x08, 0x01, 0x80, 0x00, 0x04, 
+0x08, 0x00, 0x00, 0x50, 0x10, 0x84, 0x00, 0x05, 0x80, 0x00, 0x10, 0x01, 0x10, 0x03, 0x96, 0x00, 
+0x0a, 0x80, 0x00, 0x06, 0x00, 0x01, 0x44, 0x21, 0x02, 0x00, 0x00, 0x80, 0x80, 0x00, 0x02, 0x20, 
+0x50, 0x20, 0x80, 0x00, 0x04, 0x20, 0x84, 0x20, 0x0c, 0x01, 0xbb, 0x00, 0x0c, 0x20, 0x28, 0x28, 
+0x21, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x02, 0x01, 0x99, 0x00, 0x00, 0x01, 0x81, 0x00, 
+0x00, 0x01, 0x8a, 0x00, 0x02, 0x01, 0x04, 0x01, 0xff, 0x00, 0x9b, 0x00, 0x01, 0xff, 0x00, 0xbc, 
+0x00, 0x0e, 0x70, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x10, 0x00, 0x40, 0x00, 0x80, 0x00, 0x44, 
+0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 0x40, 0x04, 0x04, 0x00, 0x30, 0x08, 
+0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 0x08, 0x20, 0x00, 0x00, 0x90, 0x90, 0xd1, 0x00, 0x00, 
+0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x17, 0x40, 0x0a, 0x10, 0x04, 0x00, 0x04, 0x00, 0x06, 
+0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 0x20, 0x04, 0x00, 0x00, 0x80, 0x0f, 
+0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0xac, 0x00, 0x00, 0x20, 0xe1, 0x00, 0x03, 0xe0, 
+0x70, 0x10, 0xc0, 0x80, 0x00, 0x04, 0x40, 0x10, 0x80, 0x20, 0xc0, 0x86, 0x00, 0x02, 0x01, 0x08, 
+0x02, 0xad, 0x00, 0x1b, 0x30, 0x08, 0x20, 0xc0, 0xf0, 0x70, 0x00, 0x08, 0x00, 0x40, 0x20, 0x80, 
+0x40, 0x40, 0x00, 0x80, 0x00, 0xa0, 0xc8, 0x68, 0xd0, 0xe0, 0xc0, 0x00, 0x20, 0x98, 0xe0, 0xe0, 
+0x99, 0x00, 0x0c, 0x01, 0x02, 0x04, 0x09, 0x13, 0x24, 0x08, 0x0e, 0x2a, 0x31, 0x18, 0x07, 0x01, 
+0x84, 0x00, 0x01, 0x10, 0x40, 0x81, 0x00, 0x0c, 0x01, 0x46, 0x50, 0x00, 0x60, 0x48, 0x40, 0x00, 
+0x00, 0x09, 0x08, 0x00, 0x20, 0x81, 0x00, 0x02, 0x20, 0x08, 0x40, 0x99, 0x00, 0x19, 0x7f, 0x3f, 
+0x79, 0x28, 0x38, 0x35, 0x1c, 0x40, 0xbf, 0x1c, 0x58, 0x51, 0x19, 0xaf, 0x42, 0x20, 0x0f, 0xc7, 
+0xff, 0xdb, 0xff, 0xfe, 0xff, 0x3d, 0x0f, 0x01, 0xb3, 0x00, 0x0e, 0x08, 0x00, 0x10, 0x00, 0x01, 
+0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x04, 0x10, 0x02, 0x08, 0x9d, 0x00, 0x01, 0x01, 0x02, 0x80, 
+0x00, 0x00, 0x01, 0x89, 0x00, 0x04, 0x03, 0x05, 0x05, 0x02, 0x01, 0xff, 0x00, 0x9a, 0x00, 0x01, 
+0xff, 0x00, 0xbc, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x10, 0x00, 0x40, 0x00, 
+0x80, 0x00, 0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 0x40, 0x04, 0x04, 
+0x00, 0x30, 0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 0x08, 0x20, 0x00, 0x00, 0x90, 0x90, 
+0xd1, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x17, 0x40, 0x0a, 0x10, 0x04, 0x00, 
+0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 0x20, 0x04, 0x00, 
+0x00, 0x80, 0x0f, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0xa6, 0x00, 0x08, 0x80, 0x40, 
+0x20, 0x90, 0x48, 0x28, 0x04, 0x14, 0x10, 0x87, 0x00, 0x04, 0x40, 0x90, 0x20, 0x40, 0x80, 0xd1, 
+0x00, 0x02, 0x60, 0x10, 0x40, 0x8c, 0x00, 0x04, 0xf8, 0x06, 0xf0, 0x06, 0x01, 0x86, 0x00, 0x00, 
+0x40, 0x85, 0x00, 0x04, 0x01, 0x04, 0xf0, 0x06, 0xf8, 0xd2, 0x00, 0x00, 0x01, 0x80, 0x00, 0x04, 
+0x0a, 0x20, 0x10, 0x00, 0x01, 0x83, 0x00, 0x1b, 0x0f, 0x20, 0x87, 0x10, 0x40, 0x80, 0x06, 0x00, 
+0x20, 0x00, 0x10, 0x10, 0x30, 0x78, 0x79, 0x78, 0x30, 0x10, 0x10, 0xc0, 0x00, 0x00, 0x80, 0x60, 
+0x18, 0xc7, 0x30, 0x0f, 0xe4, 0x00, 0x0a, 0x01, 0x02, 0x04, 0x01, 0x08, 0x00, 0x10, 0x00, 0x01, 
+0x00, 0x00, 0x80, 0x01, 0x07, 0x05, 0x10, 0x02, 0x08, 0x01, 0x04, 0x02, 0x01, 0xff, 0x00, 0xce, 
+0x00, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x10, 0x00, 
+0x40, 0x00, 0x80, 0x00, 0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 0x40, 
+0x04, 0x04, 0x00, 0x30, 0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 0x08, 0x20, 0x00, 0x00, 
+0x90, 0x90, 0xd1, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x17, 0x40, 0x0a, 0x10, 
+0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 0x20, 
+0x04, 0x00, 0x00, 0x80, 0x0f, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0xaf, 0x00, 0x03, 
+0x02, 0x02, 0x0a, 0x02, 0xdc, 0x00, 0x03, 0x60, 0x00, 0x40, 0x88, 0x80, 0x28, 0x04, 0x48, 0x10, 
+0x00, 0x20, 0x80, 0x84, 0x00, 0x01, 0x01, 0x08, 0x89, 0x00, 0x00, 0x40, 0x87, 0x00, 0x00, 0x04, 
+0x97, 0x00, 0x0b, 0x40, 0x00, 0x38, 0xc8, 0xf0, 0xe0, 0x00, 0x80, 0x00, 0x40, 0x20, 0x00, 0x80, 
+0x10, 0x0c, 0x00, 0x20, 0xd0, 0x90, 0x20, 0x08, 0x80, 0x40, 0x80, 0x40, 0xe0, 0x00, 0x90, 0x9a, 
+0x00, 0x07, 0x01, 0x02, 0x04, 0x09, 0x02, 0x24, 0x28, 0x24, 0x80, 0x00, 0x00, 0x01, 0x8b, 0x00, 
+0x03, 0x40, 0x00, 0x80, 0x40, 0x84, 0x10, 0x00, 0x60, 0x9e, 0x00, 0x1b, 0x58, 0x00, 0x6f, 0x57, 
+0x19, 0x48, 0x98, 0xad, 0x02, 0x40, 0xf3, 0xbc, 0xf8, 0xd1, 0x99, 0xaf, 0x4c, 0x20, 0x01, 0xc7, 
+0x7e, 0xd8, 0xe0, 0x38, 0xaf, 0x7b, 0x0f, 0x01, 0xb1, 0x00, 0x05, 0x04, 0x01, 0x00, 0x00, 0x10, 
+0x04, 0x82, 0x00, 0x01, 0x04, 0x10, 0x80, 0x00, 0x00, 0x04, 0x9e, 0x00, 0x81, 0x01, 0x89, 0x00, 
+0x05, 0x06, 0x04, 0x00, 0x03, 0x03, 0x01, 0xff, 0x00, 0x9a, 0x00, 0x01, 0xff, 0x00, 0xbc, 0x00, 
+0x0e, 0x30, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x10, 0x00, 0x40, 0x00, 0x80, 0x00, 0x44, 0x20, 
+0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 0x20, 0x80, 0x00, 0x40, 0x04, 0x04, 0x00, 0x30, 0x08, 0xe8, 
+0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 0x08, 0x20, 0x00, 0x00, 0x90, 0x90, 0xd1, 0x00, 0x00, 0x20, 
+0x80, 0x00, 0x1b, 0x80, 0x00, 0x01, 0x00, 0x40, 0x0a, 0x10, 0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 
+0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x10, 0x20, 0x04, 0x00, 0x00, 0x80, 0x0f, 0x80, 
+0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0xaf, 0x00, 0x0d, 0x02, 0x02, 0x0a, 0x02, 0x00, 0x00, 
+0x10, 0x04, 0x20, 0x08, 0x10, 0x00, 0x00, 0x80, 0xd2, 0x00, 0x03, 0x60, 0x00, 0x00, 0x88, 0x80, 
+0x28, 0x04, 0x48, 0x10, 0x00, 0x20, 0x80, 0x82, 0x00, 0x03, 0xe0, 0x04, 0xc0, 0x04, 0x88, 0x00, 
+0x00, 0x80, 0x84, 0x00, 0x04, 0x01, 0x02, 0x18, 0x03, 0x0c, 0xb0, 0x00, 0x00, 0x40, 0x9c, 0x00, 
+0x07, 0x01, 0x02, 0x04, 0x09, 0x02, 0x24, 0x28, 0x24, 0x80, 0x00, 0x00, 0x01, 0x82, 0x00, 0x04, 
+0x03, 0x10, 0x41, 0x18, 0x20, 0x81, 0x00, 0x04, 0x61, 0x02, 0x80, 0x10, 0x40, 0x86, 0x00, 0x04, 
+0x40, 0x00, 0x84, 0x20, 0x08, 0x97, 0x00, 0x02, 0x20, 0x00, 0x10, 0x93, 0x00, 0x00, 0x20, 0xb1, 
+0x00, 0x07, 0x02, 0x00, 0x04, 0x09, 0x02, 0x10, 0x14, 0x04, 0x82, 0x00, 0x04, 0x04, 0x10, 0x00, 
+0x00, 0x01, 0xff, 0x00, 0xd2, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x8d, 0x00, 0x08, 
+0x80, 0xc0, 0x60, 0xf0, 0xf8, 0xf8, 0x7c, 0x6c, 0x7c, 0x82, 0x3c, 0x07, 0x7c, 0x7c, 0x78, 0xd8, 
+0xf0, 0xe0, 0x60, 0xc0, 0xd3, 0x00, 0x00, 0xe0, 0x83, 0x00, 0x03, 0x10, 0x80, 0x20, 0x40, 0x83, 
+0x00, 0x07, 0xe0, 0x1c, 0xc7, 0x3f, 0x0e, 0x03, 0x01, 0x01, 0x86, 0x00, 0x01, 0x40, 0x80, 0x80, 
+0x00, 0x05, 0x01, 0x02, 0x0c, 0x21, 0x04, 0x10, 0x95, 0x00, 0x09, 0xe0, 0xf0, 0x80, 0xc0, 0xd0, 
+0x00, 0xe8, 0xf8, 0x38, 0x70, 0x80, 0x00, 0x12, 0x80, 0x40, 0x00, 0x40, 0x10, 0x10, 0x00, 0xe0, 
+0x38, 0x48, 0x10, 0x60, 0xc0, 0x80, 0xc0, 0x60, 0x90, 0xf0, 0x70, 0x9a, 0x00, 0x01, 0x08, 0x11, 
+0x83, 0x00, 0x00, 0x04, 0x83, 0x00, 0x0b, 0x03, 0x20, 0x81, 0x20, 0xc0, 0x80, 0x00, 0x00, 0x04, 
+0x60, 0xa5, 0x20, 0x85, 0x10, 0x07, 0x80, 0xc0, 0x00, 0xc0, 0xe0, 0xbc, 0xe0, 0x78, 0x95, 0x00, 
+0x1e, 0x7f, 0xff, 0x87, 0x18, 0x18, 0x09, 0x81, 0x98, 0x1c, 0x62, 0x60, 0x20, 0x40, 0x1f, 0x80, 
+0xa0, 0xa0, 0x90, 0x40, 0x20, 0x0f, 0x00, 0x80, 0xc0, 0x22, 0x06, 0x20, 0x59, 0x0f, 0x07, 0x01, 
+0xac, 0x00, 0x07, 0x01, 0x03, 0x04, 0x0d, 0x1b, 0x36, 0x3c, 0x6c, 0x80, 0x78, 0x0d, 0xf8, 0xd8, 
+0xf8, 0x78, 0x78, 0x7c, 0x7c, 0x3e, 0x3f, 0x1f, 0x0d, 0x06, 0x03, 0x01, 0xaa, 0x00, 0x03, 0x06, 
+0x07, 0x03, 0x01, 0xff, 0x00, 0x9c, 0x00, 0x00, 0xff, 0xff, 0xbb, 0xff, 0x2b, 0x07, 0x07, 0x77, 
+0x37, 0x7f, 0x1f, 0x83, 0x03, 0x27, 0x07, 0x7f, 0xff, 0x7f, 0x0f, 0x43, 0x3f, 0x9f, 0xcf, 0xef, 
+0xcf, 0x9f, 0x3f, 0x3f, 0xff, 0x07, 0x87, 0xf3, 0x73, 0x07, 0xff, 0xe7, 0x07, 0x07, 0xef, 0xff, 
+0xf7, 0x07, 0x07, 0xe7, 0x3f, 0x0f, 0x67, 0x77, 0x77, 0xd1, 0xff, 0x28, 0xc0, 0x00, 0xff, 0xff, 
+0x83, 0xe0, 0xfd, 0xfc, 0xc0, 0x04, 0xe0, 0xc7, 0xc0, 0xfc, 0xe0, 0xc0, 0x9f, 0xbf, 0xbf, 0x9f, 
+0x9f, 0xcf, 0xe0, 0x00, 0x00, 0xf3, 0xe1, 0xc8, 0x9e, 0x3f, 0x7f, 0x30, 0x00, 0x3f, 0x3f, 0xbf, 
+0x00, 0x00, 0xff, 0xe0, 0x80, 0x80, 0x9e, 0x00, 0xdf, 0xaa, 0xff, 0x03, 0x7f, 0x3f, 0x3f, 0x1f, 
+0x85, 0x9f, 0x03, 0x1f, 0x3f, 0x3f, 0x7f, 0xd7, 0xff, 0x0a, 0x3f, 0x7f, 0x1f, 0x07, 0xc3, 0x93, 
+0x81, 0x01, 0x0b, 0x0f, 0x0f, 0x83, 0xff, 0x06, 0x1f, 0x07, 0xc3, 0xf1, 0xf8, 0xfc, 0xfe, 0x85, 
+0xff, 0x0b, 0x7f, 0x7f, 0xff, 0xff, 0xfe, 0xfc, 0xfc, 0xf0, 0xe3, 0x07, 0x0f, 0x7f, 0x97, 0xff, 
+0x13, 0x07, 0x03, 0x17, 0x87, 0x47, 0x0f, 0xff, 0x1f, 0x0f, 0x27, 0x67, 0x37, 0x2f, 0xcf, 0x1f, 
+0x7f, 0xff, 0xef, 0x8f, 0x1f, 0x80, 0x0f, 0x02, 0x9f, 0xcf, 0xef, 0x9c, 0xff, 0x0b, 0xfe, 0xf8, 
+0xe0, 0xc4, 0xce, 0xc7, 0xe3, 0xe1, 0xf8, 0xfc, 0xfc, 0xfe, 0x82, 0xff, 0x02, 0xe0, 0x00, 0x0e, 
+0x82, 0xff, 0x01, 0xf1, 0x39, 0x81, 0x3f, 0x06, 0x1f, 0x1e, 0x1c, 0x1e, 0x1f, 0x3f, 0x3f, 0x81, 
+0xff, 0x02, 0x1f, 0x00, 0xc0, 0x97, 0xff, 0x16, 0xc0, 0x00, 0x10, 0x38, 0x08, 0x82, 0xc7, 0xe0, 
+0xc7, 0x92, 0xb8, 0xbc, 0xb8, 0x91, 0xc7, 0xe0, 0xff, 0x7f, 0x19, 0xc1, 0xf0, 0xfc, 0xfe, 0xb2, 
+0xff, 0x07, 0xfc, 0xf8, 0xf1, 0xe7, 0xc7, 0x8f, 0x9f, 0x1e, 0x80, 0x3e, 0x82, 0x3f, 0x07, 0x1f, 
+0x9f, 0x8f, 0xcf, 0xe7, 0xe1, 0xf0, 0xfc, 0x9c, 0xff, 0x00, 0xfe, 0xbb, 0xff, 0x00, 0xfe, 0xd0, 
+0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x80, 0x00, 
+0x80, 0x00, 0x10, 0x00, 0x40, 0x00, 0x80, 0x00, 0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 0x50, 0xb0, 
+0x20, 0x80, 0x00, 0x40, 0x04, 0x04, 0x00, 0x30, 0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 0x00, 0x08, 
+0x08, 0x20, 0x00, 0x00, 0x90, 0x90, 0xd1, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 
+0x17, 0x40, 0x0a, 0x10, 0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x08, 0x00, 
+0x80, 0x00, 0x10, 0x20, 0x04, 0x00, 0x00, 0x80, 0x4f, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 
+0x40, 0xaa, 0x00, 0x05, 0x80, 0x40, 0x40, 0x20, 0xa0, 0x80, 0x83, 0x00, 0x04, 0x80, 0x00, 0x00, 
+0x40, 0x80, 0xd5, 0x00, 0x0b, 0x80, 0x40, 0x40, 0x18, 0x84, 0x52, 0x12, 0x00, 0x06, 0x0c, 0x00, 
+0xf0, 0x83, 0x00, 0x08, 0xe0, 0x18, 0xc4, 0x32, 0x09, 0x04, 0x02, 0x01, 0x01, 0x83, 0x00, 0x0c, 
+0x80, 0x80, 0x00, 0x00, 0x01, 0x02, 0x00, 0x0c, 0x13, 0xe6, 0x08, 0x70, 0x80, 0xcf, 0x00, 0x0b, 
+0x06, 0x08, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x04, 0x02, 0x02, 0x01, 0x82, 0x00, 0x04, 0x1f, 
+0xf1, 0x0e, 0xff, 0x80, 0x80, 0x00, 0x02, 0x02, 0x4a, 0x08, 0x80, 0x00, 0x06, 0x20, 0x21, 0x03, 
+0x07, 0x06, 0x00, 0x80, 0x81, 0x00, 0x03, 0xe0, 0x3f, 0xc0, 0x3f, 0xe2, 0x00, 0x0c, 0x03, 0x04, 
+0x09, 0x06, 0x24, 0x48, 0x10, 0x81, 0x20, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x09, 0x20, 0xa0, 
+0x10, 0x50, 0x28, 0x26, 0x13, 0x0c, 0x07, 0x01, 0xff, 0x00, 0xcb, 0x00, 0x00, 0xff, 0xff, 0xbb, 
+0xff, 0x2b, 0x07, 0x07, 0x77, 0x37, 0x7f, 0x1f, 0x83, 0x03, 0x27, 0x07, 0x7f, 0xff, 0x7f, 0x0f, 
+0x43, 0x3f, 0x9f, 0xcf, 0xef, 0xcf, 0x9f, 0x3f, 0x3f, 0xff, 0x07, 0x87, 0xf3, 0x73, 0x07, 0xff, 
+0xe7, 0x07, 0x07, 0xef, 0xff, 0xf7, 0x07, 0x07, 0xe7, 0x3f, 0x0f, 0x67, 0x77, 0x77, 0xd1, 0xff, 
+0x28, 0xc0, 0x00, 0xff, 0xff, 0x83, 0xe0, 0xfd, 0xfc, 0xc0, 0x04, 0xe0, 0xc7, 0xc0, 0xfc, 0xe0, 
+0xc0, 0x9f, 0xbf, 0xbf, 0x9f, 0x9f, 0xcf, 0xe0, 0x00, 0x00, 0xf3, 0xe1, 0xc8, 0x9e, 0x3f, 0x7f, 
+0x30, 0x00, 0x3f, 0x3f, 0xbf, 0x00, 0x00, 0xff, 0xe0, 0x80, 0x80, 0x9e, 0x00, 0xdf, 0xae, 0xff, 
+0x01, 0x7f, 0x7f, 0x87, 0x3f, 0x01, 0x7f, 0x7f, 0xd5, 0xff, 0x04, 0x0f, 0x07, 0xe3, 0x91, 0x81, 
+0x80, 0x07, 0x00, 0x2f, 0x88, 0xff, 0x08, 0x3f, 0x0f, 0xc3, 0xe1, 0xf9, 0xf8, 0xfc, 0xfe, 0xfe, 
+0x85, 0xff, 0x08, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xf1, 0xc3, 0x0f, 0x1f, 0x98, 0xff, 0x17, 0x0f, 
+0x87, 0xcf, 0xcf, 0xdf, 0x1f, 0x1f, 0x0f, 0xc7, 0xe7, 0xcf, 0x1f, 0x3f, 0xdf, 0xcf, 0x9f, 0x3f, 
+0x7f, 0xff, 0x3f, 0x1f, 0xcf, 0xdf, 0xdf, 0x9a, 0xff, 0x0a, 0xf9, 0xf0, 0xe0, 0xc0, 0x8f, 0x8f, 
+0xc7, 0xe0, 0xf0, 0xfe, 0xfe, 0x87, 0xff, 0x04, 0xc1, 0x00, 0x1c, 0xff, 0xff, 0x82, 0xe7, 0x01, 
+0x67, 0x67, 0x80, 0x3f, 0x80, 0x67, 0x80, 0xe7, 0x81, 0xff, 0x02, 0x3e, 0x00, 0x80, 0x96, 0xff, 
+0x14, 0x01, 0x00, 0x33, 0x23, 0x21, 0x80, 0x80, 0x8e, 0xbf, 0x3f, 0x3f, 0x7f, 0x3f, 0x9e, 0xc0, 
+0xe3, 0x7f, 0x3e, 0x9c, 0xc0, 0xfe, 0xb4, 0xff, 0x08, 0xfe, 0xf8, 0xf0, 0xe3, 0xc7, 0x8f, 0x1f, 
+0x3f, 0x3f, 0x83, 0x7f, 0x0a, 0x7e, 0x7e, 0x3f, 0x3f, 0x1f, 0x8f, 0xc7, 0xe3, 0xf1, 0xf8, 0xfe, 
+0x97, 0xff, 0x01, 0xfe, 0xfe, 0x8b, 0xff, 0x00, 0xfe, 0xac, 0xff, 0x00, 0xfe, 0x91, 0xff, 0x85, 
+0xfe, 0xb4, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x0e, 0x30, 0x00, 0x00, 
+0x80, 0x00, 0x80, 0x00, 0x10, 0x00, 0x40, 0x00, 0x80, 0x00, 0x44, 0x20, 0x80, 0x00, 0x18, 0x20, 
+0x50, 0xb0, 0x20, 0x80, 0x00, 0x40, 0x04, 0x04, 0x00, 0x30, 0x08, 0xe8, 0x08, 0x00, 0x08, 0x10, 
+0x00, 0x08, 0x08, 0x20, 0x00, 0x00, 0x90, 0x90, 0xd1, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 
+0x80, 0x00, 0x17, 0x40, 0x1a, 0x10, 0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 
+0x08, 0x00, 0x80, 0x00, 0x10, 0x20, 0x04, 0x00, 0x00, 0x80, 0x4f, 0x80, 0x00, 0x00, 0x40, 0x85, 
+0x00, 0x00, 0x40, 0xae, 0x00, 0x06, 0x80, 0x80, 0xc0, 0x40, 0x40, 0x00, 0x00, 0x82, 0xa0, 0x07, 
+0xe0, 0xe0, 0x60, 0x60, 0xe0, 0xc0, 0xc0, 0x80, 0xcf, 0x00, 0x09, 0xf0, 0x08, 0xe0, 0x30, 0x00, 
+0x86, 0x00, 0x00, 0x28, 0xc0, 0x87, 0x00, 0x1e, 0xc0, 0xf0, 0x3c, 0x1e, 0xc6, 0xf7, 0x7f, 0x1f, 
+0x06, 0x03, 0x01, 0x01, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0e, 0x3c, 
+0x71, 0x63, 0x07, 0x0e, 0x3c, 0xf8, 0xe0, 0xc8, 0x00, 0x00, 0x06, 0x80, 0x00, 0x05, 0x47, 0x00, 
+0x48, 0x21, 0x10, 0x02, 0x88, 0x00, 0x0b, 0x3e, 0xff, 0xe3, 0x00, 0x00, 0x27, 0xe7, 0xf8, 0x18, 
+0x18, 0x98, 0x98, 0x80, 0xc0, 0x11, 0xfb, 0xe9, 0xe8, 0x48, 0xc0, 0xd0, 0x68, 0x38, 0x18, 0x1f, 
+0xc2, 0xfe, 0x7f, 0x00, 0x80, 0xff, 0xff, 0x0e, 0xdd, 0x00, 0x1d, 0x01, 0x07, 0x0f, 0x1c, 0x38, 
+0x71, 0xe3, 0xcf, 0xde, 0x98, 0xb0, 0xf0, 0xe0, 0xe0, 0x40, 0x41, 0x41, 0x00, 0x00, 0x20, 0xb0, 
+0xd8, 0x7c, 0x6e, 0x37, 0x39, 0x1c, 0x0e, 0x07, 0x03, 0xe8, 0x00, 0x85, 0x01, 0xd4, 0x00, 0x00, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0x06, 0x7f, 0x3f, 0x1f, 0x8f, 0xc7, 0xe7, 0xe3, 
+0x80, 0xf3, 0x0c, 0xf1, 0xf9, 0xf9, 0xf1, 0xf3, 0xf3, 0xe3, 0xe7, 0xc7, 0xcf, 0x1f, 0x3f, 0x7f, 
+0x87, 0xff, 0x01, 0x7f, 0x0c, 0xc2, 0xff, 0x0c, 0x0f, 0x07, 0x07, 0xe3, 0x93, 0x83, 0xc3, 0x87, 
+0x07, 0x07, 0x0f, 0x0f, 0x3f, 0x86, 0xff, 0x03, 0x07, 0x01, 0xf0, 0xfe, 0x84, 0xff, 0x06, 0x3f, 
+0x31, 0x31, 0xb9, 0x3f, 0x3f, 0x7f, 0x80, 0xff, 0x05, 0x7f, 0x7f, 0xfe, 0xf8, 0x00, 0x03, 0x85, 
+0xff, 0x01, 0xe0, 0xf0, 0xbf, 0xff, 0x00, 0xf8, 0x80, 0xf0, 0x01, 0xe4, 0xe6, 0x80, 0xe7, 0x02, 
+0xe1, 0xf0, 0xf0, 0x80, 0xfe, 0x87, 0xff, 0x04, 0xf0, 0xc0, 0x87, 0x1f, 0x3f, 0x83, 0xff, 0x0f, 
+0xfe, 0xfc, 0xfc, 0xf8, 0xf1, 0xe3, 0xe6, 0xe0, 0xf1, 0xff, 0xfe, 0x7e, 0x1f, 0x0f, 0xc0, 0xf0, 
+0xe5, 0xff, 0x07, 0xfe, 0xfc, 0xfc, 0xf8, 0xf1, 0xf3, 0xf3, 0xe3, 0x82, 0xe7, 0x07, 0xe3, 0xf3, 
+0xf3, 0xf1, 0xf9, 0xfc, 0xfc, 0xfe, 0xcf, 0xff, 0x00, 0xfe, 0xd0, 0xff, 0x00, 0xfe, 0x9c, 0xff, 
+0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0x06, 0x7f, 0x3f, 0x1f, 0x8f, 0xc7, 0xe3, 
+0xf3, 0x80, 0xf9, 0x82, 0xfc, 0x80, 0xf9, 0x06, 0xf1, 0xf3, 0xe7, 0xc7, 0x0f, 0x1f, 0x7f, 0x85, 
+0xff, 0x01, 0x7f, 0x0c, 0xcb, 0xff, 0x00, 0xcf, 0x80, 0x0f, 0x04, 0x1f, 0x9f, 0x1f, 0x3f, 0x3f, 
+0x82, 0xff, 0x02, 0x03, 0x00, 0xfc, 0x85, 0xff, 0x05, 0x3b, 0x31, 0x39, 0x3f, 0x7f, 0x7f, 0x80, 
+0xff, 0x06, 0x7f, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x01, 0x84, 0xff, 0x01, 0xe0, 0xf0, 0xc7, 0xff, 
+0x02, 0xe7, 0xe3, 0x81, 0x80, 0x80, 0x06, 0x82, 0x8e, 0x8f, 0xcf, 0xc7, 0xc0, 0xf0, 0x82, 0xff, 
+0x06, 0xfc, 0xe0, 0xc3, 0x8f, 0x1f, 0x3f, 0x7f, 0x82, 0xff, 0x0e, 0xfe, 0xfc, 0xfc, 0xf9, 0xfa, 
+0xf8, 0xfd, 0xff, 0x7e, 0x7e, 0x3f, 0x0f, 0x83, 0xe0, 0xf8, 0x85, 0xff, 0x00, 0x7f, 0x83, 0x3f, 
+0x83, 0x7f, 0xd2, 0xff, 0x02, 0xfe, 0xfc, 0xfc, 0x80, 0xf9, 0x82, 0xf3, 0x80, 0xf9, 0x12, 0xfc, 
+0xfc, 0xfe, 0xfe, 0x7f, 0x7f, 0x3f, 0x3f, 0x1f, 0x8f, 0xcf, 0xc7, 0xe3, 0xf1, 0xf8, 0xfc, 0xbe, 
+0x3e, 0xbf, 0x80, 0x1f, 0x09, 0x1e, 0x80, 0x00, 0x02, 0x06, 0x26, 0x20, 0x80, 0x87, 0xcf, 0xb3, 
+0xff, 0x00, 0xfe, 0xa0, 0xff, 0x11, 0x8f, 0x87, 0x87, 0xa7, 0xb3, 0xb3, 0x93, 0x99, 0x99, 0x98, 
+0x9c, 0x8e, 0xce, 0xc7, 0xe7, 0xe7, 0xf3, 0xf3, 0x85, 0xe7, 0x05, 0xe3, 0xf2, 0xf8, 0xf8, 0xfc, 
+0xfe, 0x8d, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 
+0x08, 0x7f, 0x1f, 0x8f, 0xc7, 0xe3, 0xf3, 0xf9, 0xf9, 0xf8, 0x84, 0xfc, 0x08, 0xf8, 0xf9, 0xf9, 
+0xf3, 0xe3, 0xc7, 0x8f, 0x1f, 0x7f, 0x84, 0xff, 0x01, 0x7f, 0x0c, 0x82, 0xff, 0x01, 0x7f, 0x3f, 
+0x81, 0xff, 0x01, 0x3f, 0xff, 0x84, 0x7f, 0x00, 0xff, 0x80, 0x7f, 0x02, 0xff, 0xff, 0x7f, 0xb2, 
+0xff, 0x00, 0x9f, 0x81, 0x1f, 0x03, 0x9f, 0x1f, 0x3f, 0x3f, 0x81, 0xff, 0x02, 0x01, 0x00, 0xfe, 
+0x85, 0xff, 0x05, 0xf1, 0x01, 0x0b, 0x9f, 0x3f, 0x7f, 0x80, 0xff, 0x06, 0x7f, 0x7f, 0xff, 0xff, 
+0xfe, 0x00, 0x01, 0x83, 0xff, 0x01, 0xc0, 0xf0, 0x82, 0xff, 0x09, 0xf0, 0xe0, 0xe7, 0xe1, 0xe1, 
+0xef, 0xe0, 0xf0, 0xe0, 0xe6, 0x80, 0xe0, 0x00, 0xfe, 0x80, 0xe0, 0x06, 0xee, 0xe0, 0xe0, 0xe6, 
+0xe6, 0xc0, 0xc0, 0xad, 0xff, 0x0b, 0xcf, 0x87, 0x83, 0x01, 0x00, 0x00, 0x8e, 0x8f, 0x8f, 0xc7, 
+0xc0, 0xe0, 0x81, 0xff, 0x06, 0xfc, 0xf0, 0xc3, 0x8f, 0x1f, 0x3f, 0x7f, 0x83, 0xff, 0x0d, 0xfe, 
+0xf8, 0xf8, 0xfc, 0xff, 0xff, 0xfe, 0x7c, 0x3e, 0x1f, 0x8f, 0xc1, 0xf0, 0xfc, 0x88, 0xff, 0x0c, 
+0x7f, 0x7f, 0x3f, 0x3f, 0x9f, 0x9f, 0x8f, 0x8f, 0x9f, 0x1f, 0x7f, 0xff, 0x7f, 0xcf, 0xff, 0x03, 
+0xfe, 0xfe, 0xfc, 0xfc, 0x85, 0xf9, 0x04, 0xf8, 0x7c, 0x7c, 0x3e, 0x3e, 0x81, 0x3f, 0x0e, 0x1f, 
+0x9f, 0x8f, 0xcf, 0xcf, 0xe7, 0xe7, 0xe3, 0xf3, 0xf1, 0xf8, 0xf8, 0xfc, 0xfe, 0x9e, 0x83, 0x1f, 
+0x06, 0x00, 0x80, 0x9c, 0x8c, 0x84, 0x00, 0x33, 0xaf, 0xff, 0x00, 0xfe, 0xa5, 0xff, 0x06, 0xfc, 
+0xf8, 0xf0, 0xf2, 0xf3, 0xf3, 0xe3, 0x81, 0xe7, 0x09, 0xf3, 0xf3, 0xf1, 0xf9, 0xf9, 0xf1, 0xf1, 
+0xe3, 0xe7, 0xc7, 0x81, 0xcf, 0x05, 0xc6, 0xe4, 0xe0, 0xf3, 0xf1, 0xf8, 0x82, 0xfc, 0x00, 0xfe, 
+0x83, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 0xff, 0x00, 0xff, 0x00, 0xa7, 0x00, 0x84, 0x80, 0xed, 
+0x00, 0x09, 0x40, 0x00, 0x08, 0x04, 0x10, 0x02, 0x01, 0x05, 0x04, 0x00, 0x83, 0x02, 0x08, 0x04, 
+0x05, 0x01, 0x0a, 0x12, 0x24, 0x48, 0x10, 0x40, 0xd6, 0x00, 0x01, 0x60, 0x20, 0x80, 0x00, 0x04, 
+0x80, 0x80, 0xa0, 0x20, 0xc0, 0x80, 0x00, 0x00, 0x01, 0x86, 0x00, 0x10, 0xc0, 0xe2, 0x50, 0xca, 
+0x50, 0xe0, 0xe0, 0xc0, 0x80, 0x00, 0x80, 0x80, 0x00, 0x00, 0x01, 0x00, 0x01, 0xd2, 0x00, 0x28, 
+0x30, 0x78, 0x7c, 0x0e, 0x07, 0x00, 0x8e, 0x8b, 0x81, 0x48, 0x47, 0x22, 0x1f, 0x0f, 0x00, 0x00, 
+0x02, 0x08, 0x23, 0x48, 0x90, 0x20, 0x40, 0x80, 0x80, 0x00, 0x00, 0x01, 0x03, 0x02, 0x01, 0x03, 
+0x07, 0x07, 0x81, 0x82, 0x40, 0x21, 0x90, 0x48, 0x20, 0x8a, 0x00, 0x0b, 0x80, 0x80, 0xc0, 0xc0, 
+0x60, 0x60, 0xf0, 0xf0, 0xe0, 0x60, 0x40, 0xc0, 0xc1, 0x00, 0x01, 0x01, 0x01, 0x8a, 0x00, 0x03, 
+0x01, 0x00, 0x02, 0x00, 0x80, 0x05, 0x09, 0x01, 0x00, 0x01, 0x05, 0x05, 0x04, 0x80, 0x82, 0x00, 
+0x21, 0x81, 0xa0, 0x1e, 0x80, 0x00, 0x10, 0x50, 0x40, 0x28, 0x28, 0x2c, 0x34, 0x16, 0x1f, 0x1f, 
+0x0f, 0x0d, 0x6f, 0xe6, 0x67, 0x63, 0x63, 0x61, 0x61, 0x7e, 0xfe, 0xe2, 0x9c, 0x84, 0x43, 0x40, 
+0xdc, 0xf8, 0x70, 0xd5, 0x00, 0x0e, 0x03, 0x07, 0x0f, 0x0c, 0x0f, 0x0f, 0x1b, 0x1e, 0x1e, 0x16, 
+0x14, 0x00, 0x00, 0x02, 0x0a, 0x80, 0x08, 0x0d, 0x12, 0x06, 0x20, 0x08, 0x40, 0x50, 0x50, 0x59, 
+0x7a, 0x7e, 0x6b, 0x31, 0x30, 0x30, 0x82, 0x18, 0x02, 0x1f, 0x0f, 0x0e, 0xa0, 0x00, 0x01, 0xff, 
+0x00, 0xff, 0x00, 0xa6, 0x00, 0x00, 0x80, 0x84, 0x00, 0x00, 0x80, 0xeb, 0x00, 0x0a, 0x80, 0x20, 
+0x10, 0x40, 0x20, 0x02, 0x09, 0x04, 0x00, 0x02, 0x02, 0x89, 0x00, 0x00, 0x40, 0xd9, 0x00, 0x02, 
+0x40, 0x20, 0x20, 0x82, 0x00, 0x06, 0x20, 0x80, 0x00, 0x10, 0x00, 0x00, 0x01, 0x84, 0x00, 0x08, 
+0x40, 0x30, 0x72, 0xf2, 0xf0, 0xe0, 0xe0, 0x40, 0x80, 0x82, 0x00, 0x00, 0x01, 0xd7, 0x00, 0x0f, 
+0xf0, 0x18, 0x06, 0x00, 0x04, 0x0a, 0x80, 0x88, 0x45, 0x20, 0x10, 0x0e, 0x00, 0x02, 0x08, 0x01, 
+0x86, 0x00, 0x01, 0x02, 0x02, 0x80, 0x07, 0x02, 0x84, 0x01, 0x40, 0x80, 0x00, 0x03, 0x04, 0x01, 
+0x08, 0x02, 0x8e, 0x00, 0x80, 0x80, 0x04, 0x00, 0x40, 0x40, 0x00, 0x80, 0xbe, 0x00, 0x04, 0x01, 
+0x01, 0x00, 0x01, 0x01, 0x89, 0x00, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00, 0x02, 0x04, 0x05, 0x04, 
+0x80, 0x00, 0x06, 0x02, 0x00, 0xc1, 0x20, 0xa0, 0x80, 0x00, 0x80, 0x80, 0x12, 0x00, 0x00, 0x10, 
+0x50, 0x50, 0x00, 0x08, 0x28, 0x28, 0x20, 0x14, 0x14, 0x12, 0x0a, 0x89, 0x85, 0x04, 0x02, 0x02, 
+0x80, 0x80, 0x07, 0xee, 0x3c, 0x43, 0xf2, 0xc4, 0x60, 0x88, 0xf0, 0xd7, 0x00, 0x01, 0x01, 0x02, 
+0x85, 0x00, 0x1b, 0x10, 0x00, 0x02, 0x0a, 0x0a, 0x02, 0x12, 0x04, 0x24, 0x40, 0x10, 0x00, 0x80, 
+0xa1, 0xa0, 0x86, 0x58, 0x58, 0x4c, 0x2c, 0x24, 0x00, 0x00, 0x02, 0x04, 0x14, 0x11, 0x0e, 0x9f, 
+0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xa3, 0x00, 0x80, 0x80, 0x83, 0x40, 0xed, 0x00, 0x0a, 0xc0, 
+0x70, 0x98, 0xec, 0x36, 0x1b, 0x0d, 0x04, 0x02, 0x02, 0x00, 0x81, 0x01, 0x83, 0x00, 0x05, 0x08, 
+0x12, 0x64, 0x88, 0x30, 0xc0, 0xd7, 0x00, 0x0d, 0x80, 0xc0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 
+0x00, 0x40, 0xfe, 0xef, 0x3c, 0xff, 0x84, 0x00, 0x06, 0x18, 0xb8, 0x44, 0x5c, 0xcc, 0xc0, 0xc0, 
+0x81, 0x80, 0x80, 0x00, 0x03, 0xc3, 0xfe, 0x81, 0xff, 0xd6, 0x00, 0x11, 0xe0, 0x09, 0x02, 0x00, 
+0x04, 0x08, 0x00, 0x08, 0x47, 0x20, 0x11, 0x03, 0x0c, 0x11, 0x26, 0x48, 0x90, 0x20, 0x80, 0x00, 
+0x01, 0x80, 0x01, 0x80, 0x00, 0x0c, 0x82, 0x80, 0x80, 0x43, 0x41, 0x22, 0xb3, 0xd8, 0x6e, 0x33, 
+0x1c, 0x07, 0x01, 0x90, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x80, 0xbe, 0x00, 0x02, 0x01, 0x00, 
+0x01, 0x8b, 0x00, 0x00, 0x01, 0x85, 0x00, 0x80, 0x02, 0x0a, 0x01, 0x01, 0xc0, 0x00, 0xa0, 0x80, 
+0x00, 0x80, 0x00, 0x00, 0x80, 0x83, 0x00, 0x16, 0x08, 0x28, 0x20, 0x04, 0x14, 0x10, 0x02, 0x88, 
+0x80, 0x01, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xfe, 0xbc, 0xe7, 0xe6, 0xc0, 0x60, 0x88, 0xf0, 0xd7, 
+0x00, 0x06, 0x01, 0x02, 0x04, 0x01, 0x00, 0x00, 0x08, 0x80, 0x0a, 0x00, 0x12, 0x82, 0x00, 0x0e, 
+0x10, 0x04, 0x24, 0x40, 0x10, 0x00, 0x80, 0xa1, 0xa0, 0x86, 0x00, 0x10, 0x40, 0x28, 0x30, 0x82, 
+0x14, 0x01, 0x19, 0x0e, 0x9f, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xa3, 0x00, 0x03, 0x80, 0x00, 
+0x00, 0x40, 0x81, 0x00, 0x00, 0x40, 0xed, 0x00, 0x0b, 0x40, 0x10, 0x88, 0x20, 0x02, 0x01, 0x04, 
+0x00, 0x02, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x40, 0xad, 0x00, 0x02, 0xfe, 0x86, 0x80, 0x81, 
+0x00, 0x00, 0x80, 0xa4, 0x00, 0x0a, 0x40, 0x00, 0x10, 0x10, 0x90, 0x90, 0x10, 0x20, 0xe6, 0x00, 
+0x3c, 0x85, 0x00, 0x03, 0x88, 0xc0, 0x40, 0x00, 0x80, 0x80, 0x84, 0x00, 0x02, 0xc2, 0x00, 0x81, 
+0xa9, 0x00, 0x0a, 0x1f, 0x1f, 0x11, 0x19, 0x1f, 0x06, 0x0f, 0x1f, 0x33, 0x33, 0x10, 0xa1, 0x00, 
+0x0b, 0xfe, 0xc2, 0x84, 0x9f, 0x38, 0x30, 0xb3, 0x83, 0x40, 0x11, 0x02, 0x08, 0x85, 0x00, 0x08, 
+0x83, 0x02, 0x02, 0x06, 0x06, 0x84, 0x06, 0x04, 0x43, 0x81, 0x00, 0x02, 0x02, 0x00, 0x04, 0x8e, 
+0x00, 0x03, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x40, 0x01, 0x00, 0x80, 0xc2, 0x00, 0x01, 0x01, 0x01, 
+0x92, 0x00, 0x0a, 0x02, 0x00, 0x40, 0xe0, 0xf0, 0x70, 0xf0, 0x50, 0x50, 0x10, 0x10, 0x80, 0xd0, 
+0x1b, 0x50, 0x58, 0x78, 0x78, 0x3c, 0x3c, 0x34, 0x16, 0x1e, 0x1a, 0x0f, 0xcf, 0xcd, 0x45, 0x47, 
+0x47, 0x43, 0x43, 0x61, 0x7e, 0x7e, 0x73, 0xb3, 0xe4, 0x64, 0xe8, 0xf8, 0x70, 0xd6, 0x00, 0x04, 
+0x01, 0x01, 0x02, 0x00, 0x04, 0x82, 0x05, 0x02, 0x00, 0x00, 0x08, 0x80, 0x0a, 0x0f, 0x02, 0x10, 
+0x04, 0x28, 0x08, 0x40, 0x50, 0x50, 0x53, 0x52, 0x5e, 0x78, 0x6a, 0x78, 0x38, 0x18, 0x81, 0x08, 
+0x02, 0x0f, 0x0f, 0x06, 0xa0, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xa7, 0x00, 0x00, 0x40, 0xf4, 
+0x00, 0x02, 0x04, 0x10, 0x08, 0x90, 0x00, 0x00, 0x20, 0xd9, 0x00, 0x09, 0x80, 0x60, 0x10, 0x48, 
+0x6c, 0xec, 0x0c, 0x0c, 0x18, 0x38, 0x89, 0x00, 0x08, 0x20, 0x40, 0x40, 0x00, 0x00, 0x80, 0x00, 
+0x40, 0x40, 0x80, 0x00, 0x00, 0x01, 0xda, 0x00, 0x0f, 0x01, 0x20, 0x63, 0x58, 0xf0, 0xf0, 0xf3, 
+0xc4, 0x60, 0x0d, 0x00, 0x00, 0x01, 0x04, 0x00, 0x80, 0x81, 0x00, 0x06, 0x82, 0x02, 0x00, 0x04, 
+0x04, 0x01, 0x02, 0x81, 0x00, 0x05, 0x10, 0x48, 0x20, 0x00, 0x00, 0x01, 0x8b, 0x00, 0x09, 0x80, 
+0x80, 0x40, 0x40, 0x20, 0xa0, 0x20, 0x00, 0x40, 0x80, 0xdb, 0x00, 0x26, 0x60, 0xb0, 0x11, 0x40, 
+0x00, 0x80, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x08, 0x28, 0x24, 0x14, 0x14, 0x00, 0x0a, 0x0a, 
+0x09, 0x05, 0x05, 0x40, 0xa2, 0x22, 0x02, 0x01, 0x01, 0x00, 0x30, 0x1f, 0x20, 0x71, 0x4a, 0x22, 
+0x00, 0xe4, 0x30, 0xda, 0x00, 0x00, 0x02, 0x84, 0x00, 0x81, 0x05, 0x00, 0x01, 0x85, 0x00, 0x0c, 
+0x09, 0x08, 0x28, 0x20, 0x10, 0x0a, 0x00, 0x00, 0x01, 0x01, 0x00, 0x04, 0x07, 0xa3, 0x00, 0x01, 
+0xff, 0x00, 0xff, 0x00, 0xa4, 0x00, 0x00, 0x80, 0x80, 0x00, 0x80, 0x40, 0x81, 0x00, 0x00, 0x80, 
+0xe9, 0x00, 0x0b, 0x80, 0x60, 0x10, 0xc8, 0x24, 0x12, 0x09, 0x04, 0x00, 0x02, 0x00, 0x00, 0x80, 
+0x01, 0x80, 0x00, 0x08, 0x02, 0x00, 0x04, 0x09, 0x12, 0x24, 0xc8, 0x10, 0xc0, 0xd8, 0x00, 0x0c, 
+0x60, 0x18, 0xcc, 0x36, 0x1a, 0x1b, 0xc3, 0x03, 0x06, 0xfc, 0xff, 0x00, 0xff, 0x84, 0x00, 0x00, 
+0x80, 0x84, 0x00, 0x03, 0x80, 0x00, 0x20, 0x60, 0x80, 0x00, 0x02, 0xff, 0x00, 0xff, 0xd7, 0x00, 
+0x25, 0x0c, 0x18, 0x1e, 0x36, 0x3c, 0x3c, 0x3e, 0x30, 0x1c, 0x03, 0x01, 0x06, 0x18, 0x23, 0x4c, 
+0x10, 0x20, 0x00, 0x40, 0x00, 0x01, 0x01, 0x03, 0x02, 0x02, 0x07, 0x86, 0x86, 0x02, 0x40, 0x21, 
+0xa0, 0x90, 0x4c, 0x33, 0x18, 0x06, 0x01, 0xe8, 0x00, 0x00, 0x01, 0x86, 0x00, 0x03, 0x02, 0x00, 
+0x00, 0x01, 0xff, 0x00, 0xc3, 0x00, 0x00, 0xff, 0xff, 0xc7, 0xff, 0x80, 0xf7, 0x01, 0x07, 0x07, 
+0x80, 0xf7, 0x06, 0x03, 0x43, 0x7f, 0x7f, 0x03, 0xff, 0x07, 0x80, 0xe7, 0xee, 0xff, 0x01, 0x00, 
+0x00, 0x80, 0xff, 0x0a, 0x80, 0xfe, 0xff, 0x80, 0x80, 0xe4, 0x80, 0x9c, 0xbc, 0x9e, 0x9f, 0xbb, 
+0xff, 0x80, 0x7f, 0x84, 0xff, 0x07, 0x3f, 0x1f, 0x8f, 0xc7, 0xe3, 0xf1, 0xf9, 0xf9, 0x85, 0xfc, 
+0x08, 0xf8, 0xf9, 0xf1, 0xf3, 0xe3, 0xc7, 0x0f, 0x3f, 0x7f, 0xd6, 0xff, 0x0f, 0x0f, 0x03, 0xe1, 
+0xf8, 0xf8, 0xf0, 0xe0, 0x00, 0x01, 0x9f, 0xff, 0xff, 0x07, 0x00, 0x70, 0xfe, 0x82, 0xff, 0x02, 
+0x47, 0x07, 0x3f, 0x83, 0x9f, 0x03, 0x3f, 0x7f, 0xcf, 0xcf, 0x80, 0xff, 0x02, 0xf8, 0x00, 0x03, 
+0xd5, 0xff, 0x02, 0xfe, 0xfc, 0xf8, 0x80, 0xf9, 0x02, 0xf1, 0xf8, 0xf8, 0x81, 0xff, 0x09, 0xf8, 
+0xe0, 0xc3, 0x8f, 0x1f, 0x3f, 0x7f, 0xff, 0xf8, 0xf0, 0x80, 0xf1, 0x0d, 0xf3, 0xf3, 0xf7, 0xf7, 
+0xe7, 0xf2, 0x70, 0x7f, 0x3f, 0x0f, 0x87, 0xe0, 0xf0, 0xfe, 0x8c, 0xff, 0x80, 0x7f, 0x02, 0x3f, 
+0x7f, 0x7f, 0xd2, 0xff, 0x00, 0xfe, 0x80, 0xfc, 0x84, 0xf9, 0x04, 0x39, 0x18, 0x9c, 0x9c, 0x9e, 
+0x84, 0x9f, 0x02, 0x8f, 0xcf, 0xc7, 0x80, 0xe7, 0x01, 0xf3, 0xf3, 0x80, 0xf9, 0x00, 0x79, 0x80, 
+0x7c, 0x09, 0x7e, 0x7e, 0x3e, 0x00, 0x00, 0x63, 0x73, 0x23, 0x07, 0x8f, 0xae, 0xff, 0x00, 0xfe, 
+0xa6, 0xff, 0x00, 0xfe, 0x80, 0xfc, 0x00, 0xf8, 0x87, 0xf9, 0x04, 0xf1, 0xf3, 0xe3, 0xc7, 0xcf, 
+0x80, 0x9f, 0x07, 0x9e, 0x9e, 0x98, 0x88, 0xc0, 0xe0, 0xf0, 0xf0, 0x80, 0xf2, 0x02, 0xf0, 0xf0, 
+0xf9, 0x82, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 0xff, 0x00, 0xe1, 0x00, 0x11, 0xc0, 0xe0, 0x30, 
+0x10, 0x10, 0x30, 0x60, 0xc0, 0x80, 0xe0, 0xc0, 0x80, 0x00, 0xf0, 0xf8, 0x00, 0xe0, 0x70, 0x80, 
+0x10, 0xb4, 0x00, 0x80, 0x80, 0xae, 0x00, 0x16, 0x1f, 0x30, 0x60, 0x40, 0xc0, 0x40, 0x60, 0x61, 
+0x3f, 0xff, 0x01, 0x03, 0x0e, 0x1c, 0x7f, 0x30, 0x3f, 0x7f, 0xc3, 0xc3, 0xc1, 0x40, 0x40, 0x9d, 
+0x00, 0x80, 0x80, 0x84, 0x00, 0x00, 0x40, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x0c, 0x02, 0x02, 
+0x00, 0x00, 0x04, 0x01, 0x08, 0x02, 0x10, 0x20, 0x80, 0x20, 0x40, 0xd6, 0x00, 0x0f, 0xf0, 0x1c, 
+0xee, 0x3f, 0x3b, 0xf3, 0xe3, 0x0f, 0x0e, 0x60, 0x00, 0x00, 0xf8, 0x01, 0x70, 0x02, 0x82, 0x00, 
+0x03, 0xb8, 0xf4, 0xdc, 0x6c, 0x82, 0xe0, 0x09, 0x00, 0x00, 0x30, 0x28, 0x38, 0x00, 0x00, 0x06, 
+0x00, 0x03, 0xd5, 0x00, 0x09, 0x06, 0x04, 0x0a, 0x0a, 0x1a, 0x1e, 0x3e, 0x38, 0x18, 0x07, 0x80, 
+0x00, 0x1a, 0x06, 0x10, 0x22, 0x08, 0x90, 0x00, 0x40, 0x80, 0x07, 0x0f, 0x0e, 0x0d, 0x0d, 0x0f, 
+0x0f, 0x09, 0x09, 0x18, 0x0d, 0x0f, 0x00, 0x00, 0x10, 0x00, 0x23, 0x00, 0x02, 0x8c, 0x00, 0x80, 
+0x80, 0x01, 0xc0, 0x80, 0xd3, 0x00, 0x05, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x82, 0x00, 0x05, 
+0xc1, 0xe4, 0xe0, 0xe0, 0xa0, 0xa1, 0x83, 0xa0, 0x1a, 0xb0, 0xf0, 0xf8, 0xd8, 0xf8, 0x78, 0x6c, 
+0x7c, 0x36, 0x3e, 0x1a, 0x8a, 0x8f, 0x8d, 0x05, 0x07, 0x02, 0x42, 0xfc, 0x7c, 0x5f, 0x73, 0xa2, 
+0xc0, 0xc8, 0xf0, 0xe0, 0xd6, 0x00, 0x05, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x80, 0x00, 0x00, 
+0x08, 0x82, 0x0a, 0x17, 0x02, 0x00, 0x00, 0x20, 0x08, 0x50, 0x10, 0x00, 0x01, 0x01, 0x87, 0xb4, 
+0xde, 0x7e, 0x6c, 0x3c, 0x32, 0x12, 0x13, 0x14, 0x14, 0x19, 0x0f, 0x0f, 0xa0, 0x00, 0x00, 0xff, 
+0xff, 0xc7, 0xff, 0x08, 0xe7, 0xf7, 0xf7, 0x87, 0x07, 0xf7, 0xe7, 0xe7, 0x03, 0x80, 0x7f, 0x05, 
+0x03, 0x7f, 0x07, 0xe7, 0xf7, 0xf3, 0x85, 0xff, 0x02, 0x7f, 0x1f, 0x9f, 0x80, 0xcf, 0x0b, 0x9f, 
+0x1f, 0x3f, 0x1f, 0x3f, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x1f, 0xcf, 0x80, 0xef, 0xb1, 0xff, 0x80, 
+0x7f, 0x81, 0x3f, 0x81, 0x7f, 0x93, 0xff, 0x0e, 0x00, 0xff, 0xff, 0xc7, 0x80, 0xff, 0xff, 0x00, 
+0x00, 0xf8, 0x80, 0x3e, 0x3c, 0xbe, 0xbf, 0x84, 0xff, 0x02, 0xe0, 0xc7, 0xcf, 0x82, 0x9f, 0x0e, 
+0xce, 0x00, 0xfe, 0xfc, 0xf1, 0xe3, 0xc0, 0xff, 0xe0, 0x85, 0x3c, 0x7c, 0x3c, 0x9f, 0x9f, 0xa7, 
+0xff, 0x07, 0x7f, 0x1f, 0x87, 0xc3, 0xf1, 0xf9, 0xf8, 0xfc, 0x81, 0xfe, 0x01, 0xff, 0xff, 0x81, 
+0xfe, 0x07, 0xfc, 0xfc, 0xf8, 0xf1, 0xe3, 0x87, 0x0f, 0x3f, 0xd6, 0xff, 0x05, 0x7f, 0x7f, 0x3f, 
+0x3f, 0x7f, 0x7f, 0x83, 0xff, 0x02, 0xc3, 0x00, 0x18, 0x84, 0xff, 0x0b, 0xe3, 0xe3, 0xff, 0x1f, 
+0x9f, 0xcf, 0x0f, 0x8f, 0xff, 0xff, 0xc7, 0xe7, 0x80, 0xff, 0x02, 0x7e, 0x00, 0x01, 0xd2, 0xff, 
+0x09, 0xe7, 0x23, 0x00, 0x00, 0x26, 0x3e, 0x7e, 0x08, 0x00, 0xc1, 0x83, 0xff, 0x0f, 0xfc, 0xf0, 
+0xe1, 0xc7, 0x8f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0xff, 0xe0, 0xe0, 0xe3, 0xe1, 0xf0, 0x80, 0x7f, 
+0x06, 0x3f, 0x1f, 0x8f, 0xc7, 0xe3, 0xf0, 0xfc, 0x8c, 0xff, 0x03, 0x1f, 0x0f, 0x87, 0xe3, 0x80, 
+0xf3, 0x04, 0xe7, 0xe7, 0x8f, 0x0f, 0x3f, 0xb9, 0xff, 0x80, 0xf0, 0x04, 0xe0, 0xf0, 0xf8, 0xf8, 
+0xfc, 0x8b, 0xff, 0x80, 0xfe, 0x84, 0xfc, 0x01, 0xfe, 0xfe, 0x89, 0xff, 0x0c, 0x3f, 0x1f, 0x1f, 
+0x9f, 0xcf, 0xcf, 0xe7, 0xe3, 0xf1, 0xf8, 0x7c, 0x3e, 0x3f, 0x83, 0x9f, 0x04, 0xcf, 0xc0, 0x80, 
+0x18, 0x3f, 0xab, 0xff, 0x00, 0xfe, 0xb7, 0xff, 0x0e, 0xfe, 0xfc, 0xf8, 0xf9, 0xe3, 0xc3, 0x8f, 
+0x1f, 0x3f, 0x30, 0x30, 0x27, 0x07, 0x0f, 0xcf, 0x80, 0x9f, 0x07, 0x8f, 0xc7, 0xe0, 0xf8, 0xfe, 
+0xff, 0xff, 0xfe, 0x9c, 0xff, 0x00, 0xff, 0xff, 0xc7, 0xff, 0x80, 0xf7, 0x01, 0x07, 0x07, 0x80, 
+0xf7, 0x06, 0x03, 0x43, 0x7f, 0x7f, 0x03, 0xff, 0x07, 0x80, 0xe7, 0x85, 0xff, 0x11, 0x3f, 0x1f, 
+0xcf, 0xef, 0xef, 0xcf, 0x9f, 0x3f, 0x7f, 0x1f, 0x3f, 0x7f, 0xff, 0x0f, 0x0f, 0xff, 0x1f, 0x8f, 
+0x80, 0xef, 0xb0, 0xff, 0x01, 0x7f, 0x7f, 0x86, 0x3f, 0x01, 0x7f, 0x7f, 0x91, 0xff, 0x01, 0x00, 
+0x00, 0x80, 0xff, 0x0a, 0x80, 0xfe, 0xfe, 0x80, 0x80, 0xe0, 0x80, 0x9c, 0xbc, 0x9e, 0x9f, 0x83, 
+0xff, 0x17, 0xfd, 0xe0, 0xcf, 0x9f, 0xbf, 0x3f, 0xbf, 0x9f, 0x9e, 0xc0, 0x00, 0xff, 0xfc, 0xf1, 
+0xe3, 0x80, 0xcf, 0xc0, 0x80, 0x3c, 0x3c, 0x3e, 0xbf, 0xbf, 0xa7, 0xff, 0x09, 0x7f, 0x1f, 0x07, 
+0xc3, 0xf1, 0xf8, 0xfc, 0xfc, 0xfe, 0xfe, 0x84, 0xff, 0x09, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xf1, 
+0xc3, 0x07, 0x1f, 0x7f, 0xd6, 0xff, 0x81, 0x7f, 0x85, 0xff, 0x01, 0x00, 0x00, 0x84, 0xff, 0x0b, 
+0xe3, 0xe3, 0xf7, 0x7f, 0x1f, 0x9f, 0x5f, 0x0f, 0xdf, 0xe7, 0xc7, 0xe7, 0x81, 0xff, 0x01, 0x00, 
+0x00, 0x8a, 0xff, 0x03, 0x1f, 0x07, 0xc3, 0xf1, 0x81, 0xf9, 0x04, 0xf1, 0xe3, 0xc7, 0x0f, 0x1f, 
+0xb8, 0xff, 0x09, 0xe7, 0x03, 0x00, 0x08, 0x2e, 0x7e, 0x7e, 0x00, 0x00, 0xe7, 0x84, 0xff, 0x07, 
+0xf8, 0xf0, 0xe3, 0xc7, 0x8f, 0x1f, 0x3f, 0x3f, 0x80, 0x7f, 0x0d, 0x70, 0x63, 0x73, 0x70, 0x7c, 
+0x7f, 0x3f, 0x3f, 0x1f, 0x8f, 0xc7, 0xe3, 0xf0, 0xfc, 0x89, 0xff, 0x03, 0x1f, 0x03, 0xc0, 0xfc, 
+0x82, 0xff, 0x05, 0x3f, 0x1f, 0x07, 0xc3, 0xf0, 0xf8, 0xb8, 0xff, 0x02, 0xfb, 0xf0, 0xf0, 0x80, 
+0xe0, 0x02, 0xf8, 0xf8, 0xfc, 0x8d, 0xff, 0x86, 0xfe, 0x8e, 0xff, 0x12, 0x0f, 0x03, 0x70, 0x78, 
+0x7e, 0x7f, 0xff, 0xcf, 0x8f, 0x9f, 0x9f, 0x1c, 0x3c, 0x3e, 0x7c, 0x78, 0x61, 0x03, 0x0f, 0xac, 
+0xff, 0x00, 0xfe, 0xbb, 0xff, 0x81, 0xfe, 0x0c, 0xfc, 0xfc, 0xf8, 0xf1, 0xf3, 0xf3, 0xf1, 0xf8, 
+0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0x81, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x00, 0xff, 0xff, 0xc7, 0xff, 
+0x08, 0xe7, 0xf7, 0xf7, 0x87, 0x07, 0xf7, 0xe7, 0xe7, 0x03, 0x80, 0x7f, 0x05, 0x03, 0x7f, 0x07, 
+0xe7, 0xf7, 0xf3, 0x85, 0xff, 0x02, 0x3f, 0x1f, 0x9f, 0x80, 0xcf, 0x0b, 0x9f, 0x1f, 0x3f, 0x1f, 
+0x3f, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x1f, 0xcf, 0x80, 0xef, 0xb0, 0xff, 0x01, 0x7f, 0x7f, 0x87, 
+0x3f, 0x01, 0x7f, 0x7f, 0x91, 0xff, 0x0e, 0x00, 0xff, 0xff, 0xc3, 0x80, 0xff, 0xff, 0x00, 0x00, 
+0xf8, 0x80, 0x1e, 0x3c, 0xbe, 0xbf, 0x84, 0xff, 0x02, 0xe0, 0xc7, 0xcf, 0x82, 0x9f, 0x0e, 0xce, 
+0x00, 0xfe, 0xfc, 0xf1, 0xe3, 0xc0, 0xff, 0xe0, 0x85, 0x3c, 0x7c, 0x3c, 0x9f, 0x9f, 0xa7, 0xff, 
+0x08, 0x7f, 0x1f, 0x07, 0xc3, 0xf1, 0xf8, 0xfc, 0xfe, 0xfe, 0x86, 0xff, 0x08, 0xfe, 0xfe, 0xfc, 
+0xf8, 0xf1, 0xe3, 0x87, 0x0f, 0x3f, 0x8d, 0xff, 0x00, 0x7f, 0xc5, 0xff, 0x80, 0x7f, 0x86, 0xff, 
+0x02, 0x00, 0x00, 0x7f, 0x83, 0xff, 0x0b, 0xf3, 0xe3, 0x73, 0x3f, 0x3f, 0xbf, 0xbf, 0x1f, 0x1f, 
+0x87, 0xe7, 0xe7, 0x81, 0xff, 0x01, 0x00, 0x00, 0x89, 0xff, 0x01, 0x03, 0x01, 0x81, 0xfc, 0x02, 
+0x00, 0x01, 0xf3, 0xbd, 0xff, 0x09, 0xdf, 0x87, 0x01, 0x10, 0x1c, 0x7e, 0xfc, 0xf0, 0x01, 0x07, 
+0x84, 0xff, 0x18, 0xfc, 0xf8, 0xe1, 0xc7, 0xcf, 0x9f, 0x1f, 0x3f, 0x3f, 0x7d, 0x78, 0x70, 0x71, 
+0x73, 0x79, 0x78, 0x3e, 0x3f, 0x1f, 0x9f, 0x8f, 0xc7, 0xe3, 0xf0, 0xfc, 0x8a, 0xff, 0x0b, 0xf8, 
+0x00, 0x03, 0x1f, 0x1f, 0x81, 0x80, 0x80, 0x9f, 0x9f, 0x1f, 0x1f, 0xbc, 0xff, 0x80, 0xe0, 0x04, 
+0xc0, 0xc0, 0xe0, 0xf8, 0xfc, 0x8d, 0xff, 0x85, 0xfe, 0x93, 0xff, 0x0a, 0xf0, 0xc0, 0x80, 0x80, 
+0x83, 0x87, 0x87, 0x83, 0xc3, 0xe0, 0xf8, 0xaf, 0xff, 0x00, 0xfe, 0xd0, 0xff, 0x00, 0xfe, 0x9c, 
+0xff, 0x01, 0xff, 0x00, 0xc7, 0x00, 0x09, 0x10, 0x04, 0x00, 0x80, 0x00, 0x00, 0x10, 0x10, 0x00, 
+0x3c, 0x80, 0x00, 0x04, 0x80, 0x00, 0x00, 0x10, 0x14, 0x87, 0x00, 0x0b, 0x50, 0x20, 0x20, 0x00, 
+0x00, 0x20, 0x40, 0x00, 0x00, 0x80, 0x00, 0x80, 0x80, 0x00, 0x00, 0x40, 0xd4, 0x00, 0x00, 0xff, 
+0x80, 0x00, 0x0b, 0x3c, 0x00, 0x01, 0x01, 0x80, 0x80, 0x18, 0x00, 0x82, 0x80, 0x20, 0x20, 0x85, 
+0x00, 0x07, 0x08, 0x50, 0x20, 0xa0, 0x20, 0x00, 0x01, 0x0e, 0x82, 0x00, 0x08, 0x40, 0x30, 0x20, 
+0x05, 0x00, 0x40, 0x02, 0x20, 0x20, 0xd2, 0x00, 0x00, 0x80, 0xc5, 0x00, 0x03, 0x80, 0x00, 0x00, 
+0x80, 0x8e, 0x00, 0x0b, 0x14, 0x00, 0x10, 0x00, 0x80, 0x80, 0xa0, 0x00, 0x00, 0x78, 0x20, 0x20, 
+0x8d, 0x00, 0x0a, 0x3c, 0xfe, 0x1b, 0xfd, 0x00, 0x00, 0x84, 0xfd, 0x01, 0xfe, 0x0c, 0xbd, 0x00, 
+0x0a, 0x20, 0x48, 0x82, 0x10, 0x14, 0x70, 0x82, 0x8c, 0x41, 0x06, 0xf8, 0x8c, 0x00, 0x07, 0x02, 
+0x06, 0x0e, 0x0f, 0x0d, 0x07, 0x06, 0x01, 0x91, 0x00, 0x0c, 0x07, 0x78, 0x03, 0x1c, 0x00, 0x03, 
+0x01, 0x00, 0x0f, 0x10, 0x10, 0x00, 0x20, 0xbc, 0x00, 0x08, 0x1f, 0x00, 0x00, 0x20, 0x20, 0x00, 
+0x08, 0x04, 0x01, 0xab, 0x00, 0x00, 0x40, 0x81, 0x00, 0x02, 0x04, 0x00, 0x02, 0xff, 0x00, 0xa3, 
+0x00, 0x00, 0xb7, 0xff, 0x11, 0xbf, 0xbf, 0x00, 0x1f, 0x9f, 0x00, 0x00, 0xdf, 0x1f, 0x3f, 0x1f, 
+0xdf, 0x9f, 0x3b, 0x39, 0x00, 0xfd, 0xfd, 0xed, 0xff, 0x0d, 0xf0, 0xff, 0xff, 0xfc, 0xf8, 0xff, 
+0xf8, 0xfc, 0xfc, 0xf9, 0xf9, 0xf8, 0xfc, 0xfc, 0xff, 0xff, 0xd9, 0xff, 0x07, 0x7f, 0x3f, 0x1f, 
+0x9f, 0xcf, 0xc7, 0xe7, 0xe7, 0x87, 0xf3, 0x07, 0xe3, 0xe7, 0xe7, 0xcf, 0x8f, 0x1f, 0x3f, 0x7f, 
+0xd8, 0xff, 0x01, 0x7f, 0x7f, 0x84, 0xff, 0x03, 0x07, 0x01, 0x60, 0xfc, 0x90, 0xff, 0x06, 0x7f, 
+0x3f, 0x1f, 0x1e, 0x3c, 0x00, 0x01, 0x82, 0xff, 0x08, 0x8f, 0x07, 0x23, 0xf1, 0xf9, 0xf9, 0xf1, 
+0x03, 0x07, 0xc5, 0xff, 0x03, 0x8f, 0x03, 0x00, 0x18, 0x80, 0x3c, 0x0f, 0x00, 0x01, 0x1f, 0x7f, 
+0xff, 0xff, 0xf8, 0xf0, 0xe3, 0xc7, 0x8f, 0x11, 0x31, 0x31, 0x71, 0x71, 0x80, 0xf9, 0x0f, 0xfb, 
+0x3f, 0x1f, 0x0f, 0xcf, 0x4f, 0x0f, 0x0c, 0x2c, 0x2c, 0x1e, 0x8e, 0xc7, 0xe1, 0xf0, 0xfc, 0x83, 
+0xff, 0x08, 0xfe, 0xf0, 0xc0, 0x07, 0x3f, 0x3f, 0x38, 0x00, 0x83, 0x81, 0x9f, 0x01, 0x1f, 0x3f, 
+0xbf, 0xff, 0x81, 0xe0, 0x00, 0xf0, 0x80, 0xe0, 0x01, 0xfc, 0xfe, 0x86, 0xff, 0x80, 0xfe, 0x86, 
+0xfc, 0x80, 0xfe, 0x8d, 0xff, 0x0b, 0xfe, 0xf8, 0xc0, 0x00, 0x00, 0x03, 0x0f, 0x07, 0x83, 0x83, 
+0xc0, 0xe0, 0xb0, 0xff, 0x00, 0xfe, 0xd0, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0x9f, 0x00, 0x09, 0x80, 0xc0, 0xe0, 0xe0, 0xf0, 0xf8, 0xd8, 0x78, 0x6c, 0x6c, 
+0x85, 0x3c, 0x05, 0x2c, 0x28, 0x78, 0x50, 0x10, 0x20, 0xda, 0x00, 0x01, 0x80, 0x80, 0x84, 0x00, 
+0x06, 0xf8, 0x0e, 0x63, 0x1d, 0x07, 0x03, 0x01, 0x8d, 0x00, 0x14, 0x80, 0x40, 0x20, 0x20, 0x42, 
+0xfc, 0xf1, 0xfe, 0xf8, 0xc0, 0xc0, 0xf0, 0x88, 0xe0, 0xc0, 0x12, 0x1e, 0xfe, 0xfe, 0xfc, 0xf8, 
+0xc5, 0x00, 0x03, 0x10, 0x04, 0x00, 0x08, 0x80, 0x00, 0x02, 0x20, 0x00, 0x18, 0x80, 0x00, 0x2b, 
+0x04, 0x00, 0x02, 0x00, 0x00, 0x8e, 0x2e, 0x0e, 0x12, 0x12, 0x9a, 0x8a, 0x0a, 0x08, 0x0c, 0x0c, 
+0x00, 0xc0, 0xa0, 0x60, 0x01, 0x4c, 0x48, 0x22, 0xb0, 0x59, 0x6e, 0x37, 0x1f, 0x0f, 0x07, 0x00, 
+0x00, 0x03, 0x0f, 0x3f, 0x77, 0xdf, 0x78, 0x41, 0x5f, 0x38, 0x0f, 0x9c, 0x80, 0x00, 0x02, 0x80, 
+0x20, 0xc0, 0xbf, 0x00, 0x02, 0x18, 0x00, 0x20, 0x82, 0x00, 0x01, 0x0c, 0x02, 0x86, 0x00, 0x04, 
+0x01, 0x00, 0x00, 0x02, 0x02, 0x87, 0x00, 0x00, 0x01, 0x8b, 0x00, 0x0c, 0x01, 0x06, 0x18, 0x40, 
+0x00, 0x03, 0x04, 0x00, 0x00, 0x80, 0x03, 0x00, 0x1c, 0xf5, 0x00, 0x00, 0x01, 0xab, 0x00, 0x01, 
+0xff, 0x00, 0xff, 0x00, 0xad, 0x00, 0x80, 0x80, 0x83, 0xc0, 0x01, 0x80, 0x80, 0xe9, 0x00, 0x0d, 
+0x80, 0x40, 0x20, 0x30, 0x58, 0x7c, 0x66, 0x37, 0x33, 0x31, 0x31, 0xf1, 0xf0, 0xf0, 0x80, 0x30, 
+0x80, 0x61, 0x07, 0xc3, 0xc7, 0x86, 0x0e, 0x3c, 0xf0, 0xe0, 0x80, 0xdd, 0x00, 0x06, 0xf0, 0xfc, 
+0x1e, 0x07, 0x03, 0xfe, 0xff, 0x85, 0x00, 0x18, 0xf0, 0x38, 0x18, 0x08, 0x0c, 0x0c, 0x08, 0x18, 
+0x98, 0x70, 0x21, 0x6d, 0x0f, 0x0f, 0xfe, 0x07, 0x3f, 0x00, 0x00, 0x80, 0x00, 0x04, 0x04, 0x20, 
+0x08, 0xd5, 0x00, 0x2c, 0x03, 0x0f, 0x1e, 0x38, 0x70, 0x61, 0xe7, 0xcf, 0x80, 0xa4, 0xec, 0x6c, 
+0xcc, 0x8c, 0x4c, 0x6d, 0xf3, 0xf3, 0x12, 0x92, 0xf4, 0x19, 0x1c, 0x44, 0x06, 0x86, 0x13, 0x00, 
+0x20, 0x00, 0x00, 0x01, 0x01, 0x04, 0x00, 0x02, 0x80, 0x00, 0x00, 0x82, 0x00, 0x03, 0x00, 0x20, 
+0x80, 0xd8, 0x00, 0x81, 0x01, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x04, 0x02, 0x02, 0x00, 0x00, 
+0x01, 0x95, 0x00, 0x00, 0x40, 0xf7, 0x00, 0x00, 0x01, 0xaa, 0x00, 0x01, 0xff, 0x00, 0xba, 0x00, 
+0x00, 0x04, 0xf1, 0x00, 0x03, 0x80, 0x00, 0x00, 0x40, 0x81, 0x00, 0x03, 0x40, 0x00, 0x00, 0x80, 
+0xe9, 0x00, 0x0f, 0x80, 0x20, 0x10, 0x40, 0x00, 0x08, 0x01, 0x00, 0x02, 0x00, 0x00, 0x21, 0x01, 
+0x00, 0x00, 0x01, 0x81, 0x00, 0x06, 0x04, 0x00, 0x00, 0x20, 0x88, 0x10, 0x40, 0xe2, 0x00, 0x02, 
+0x81, 0x00, 0xc3, 0x84, 0x00, 0x1a, 0x10, 0x88, 0x88, 0x18, 0x1c, 0x1c, 0x38, 0x28, 0x38, 0xd0, 
+0x20, 0x22, 0x02, 0x00, 0x00, 0x7c, 0x00, 0x3e, 0x10, 0x88, 0x20, 0x00, 0x00, 0x20, 0x08, 0x00, 
+0x80, 0xc6, 0x00, 0x0d, 0x60, 0xf8, 0xff, 0x17, 0x3c, 0x0c, 0x00, 0x1c, 0x39, 0x36, 0x7e, 0xf8, 
+0xe0, 0x80, 0x81, 0x00, 0x03, 0x01, 0x04, 0x00, 0x02, 0x81, 0x00, 0x08, 0x40, 0x00, 0x01, 0x03, 
+0x02, 0x03, 0x03, 0x07, 0x85, 0x80, 0x04, 0x13, 0x24, 0x80, 0x48, 0x04, 0x11, 0x08, 0x02, 0x01, 
+0x04, 0x08, 0x22, 0x80, 0x10, 0x40, 0x03, 0x10, 0x43, 0x08, 0x20, 0x20, 0x80, 0x00, 0x01, 0x20, 
+0x80, 0xbf, 0x00, 0x0c, 0x07, 0x1f, 0x3f, 0x18, 0x10, 0x20, 0x20, 0x00, 0x00, 0x1c, 0x1f, 0x0f, 
+0x01, 0x91, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x0b, 0x04, 0x10, 0x40, 0x80, 0x03, 
+0x00, 0x00, 0x08, 0x04, 0x83, 0x00, 0x3c, 0xf7, 0x00, 0x00, 0x01, 0xa9, 0x00, 0x01, 0xff, 0x00, 
+0xba, 0x00, 0x00, 0x04, 0x80, 0x00, 0x18, 0xf8, 0xe0, 0x00, 0x80, 0xf0, 0xf0, 0x00, 0x00, 0xe0, 
+0xf8, 0xf0, 0x00, 0xf0, 0xc0, 0xe0, 0x60, 0xf0, 0xf8, 0x10, 0x10, 0xf0, 0xf0, 0x10, 0x30, 0x20, 
+0xd8, 0x00, 0x00, 0x40, 0x81, 0x00, 0x00, 0x40, 0x82, 0x00, 0x1c, 0xfe, 0xff, 0x01, 0x0f, 0x0f, 
+0x03, 0x7f, 0x70, 0x78, 0x3f, 0x02, 0x1f, 0x7e, 0x3f, 0x7f, 0x0d, 0x18, 0x3f, 0x21, 0x61, 0x61, 
+0x21, 0x03, 0x62, 0xc3, 0xc3, 0x43, 0x7f, 0x3c, 0xcb, 0x00, 0x06, 0x40, 0x00, 0x88, 0x20, 0x00, 
+0x00, 0x04, 0x80, 0x00, 0x0f, 0x20, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x00, 0x01, 
+0x00, 0x00, 0x40, 0x00, 0x20, 0xe2, 0x00, 0x02, 0x7e, 0x00, 0x3c, 0x84, 0x00, 0x02, 0xe1, 0x71, 
+0x70, 0x80, 0xf0, 0x05, 0xd0, 0xf0, 0xe0, 0xe0, 0x40, 0xc0, 0x80, 0x00, 0x0e, 0x83, 0x00, 0x01, 
+0xe0, 0xf0, 0x38, 0x20, 0xe6, 0xf7, 0xfb, 0xf3, 0x83, 0x07, 0xfe, 0xfc, 0xc6, 0x00, 0x0b, 0xf8, 
+0x0f, 0x30, 0x3c, 0x20, 0x04, 0x0d, 0x19, 0x06, 0x1c, 0x60, 0xc0, 0x81, 0x00, 0x06, 0x02, 0x08, 
+0x11, 0x04, 0x00, 0x80, 0x20, 0x80, 0x00, 0x00, 0x80, 0x81, 0x01, 0x1e, 0x82, 0x02, 0x02, 0x00, 
+0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x03, 0x07, 0x1e, 0x78, 0xf1, 0xcf, 0x3f, 0x77, 
+0x5f, 0x18, 0x0f, 0xff, 0x58, 0x50, 0xd0, 0xd0, 0x70, 0xf0, 0x80, 0xc0, 0x00, 0x04, 0x07, 0x1d, 
+0x30, 0x00, 0x20, 0x80, 0x10, 0x02, 0x00, 0x0e, 0x01, 0x88, 0x00, 0x03, 0x01, 0x00, 0x00, 0x02, 
+0x91, 0x00, 0x0e, 0x01, 0x03, 0x0f, 0x3c, 0x70, 0xc0, 0x87, 0x8f, 0x8c, 0x84, 0x80, 0x41, 0x00, 
+0x1f, 0x01, 0xf3, 0x00, 0x80, 0x01, 0xa9, 0x00, 0x01, 0xba, 0x00, 0x00, 0x80, 0xff, 0x00, 0xf2, 
+0x00, 0x01, 0x80, 0x80, 0x83, 0x40, 0x02, 0x00, 0x80, 0x80, 0x89, 0x00, 0x00, 0x04, 0xdd, 0x00, 
+0x0b, 0x80, 0x20, 0x00, 0x44, 0x12, 0x0a, 0x01, 0x04, 0x02, 0xc2, 0xc0, 0xc1, 0x81, 0x01, 0x80, 
+0x02, 0x06, 0x04, 0x09, 0x02, 0x00, 0x40, 0x10, 0x20, 0x8e, 0x00, 0x05, 0x80, 0x80, 0xc0, 0xc0, 
+0x80, 0x80, 0xd3, 0x00, 0x03, 0xe6, 0xe6, 0x37, 0xd3, 0x82, 0xf0, 0x0a, 0x50, 0x10, 0x70, 0x6c, 
+0xe2, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x01, 0x80, 0x00, 0x02, 0x38, 0xfe, 0xef, 0x80, 0x03, 0x0e, 
+0x07, 0xfe, 0xfc, 0x00, 0xc0, 0xfc, 0x7f, 0x07, 0x01, 0x01, 0xc1, 0xf1, 0x7f, 0x1f, 0x0c, 0xbb, 
+0x00, 0x19, 0xf0, 0xff, 0x3f, 0x1f, 0x3d, 0x04, 0x64, 0x3d, 0x3b, 0x3e, 0x3c, 0xe0, 0x80, 0x00, 
+0x00, 0x02, 0x08, 0x11, 0x04, 0x00, 0x80, 0x20, 0x41, 0x01, 0x81, 0x83, 0x80, 0x03, 0x00, 0x01, 
+0x80, 0x80, 0x08, 0x42, 0x42, 0x20, 0x90, 0x48, 0x24, 0x10, 0x00, 0x01, 0x81, 0x00, 0x12, 0x01, 
+0x0f, 0x3f, 0xf8, 0xe0, 0xe0, 0xef, 0xff, 0xc4, 0xcf, 0xcf, 0xc8, 0xe8, 0xcc, 0xbf, 0x77, 0xe0, 
+0xe0, 0xc0, 0xbd, 0x00, 0x0a, 0x02, 0x0f, 0x38, 0x00, 0x20, 0x10, 0x00, 0x01, 0x00, 0x0e, 0x0f, 
+0x86, 0x00, 0x01, 0x01, 0x01, 0x80, 0x02, 0x04, 0x04, 0x04, 0x05, 0x04, 0x00, 0x80, 0x02, 0x01, 
+0x01, 0x01, 0x8a, 0x00, 0x0f, 0x03, 0x0f, 0x3f, 0x7f, 0x70, 0x73, 0x63, 0x43, 0x02, 0x03, 0x23, 
+0x3d, 0x1c, 0x0f, 0x07, 0x01, 0xff, 0x00, 0x9c, 0x00, 0x01, 0xff, 0x00, 0xbd, 0x00, 0x00, 0xe0, 
+0x80, 0x00, 0x01, 0x80, 0x30, 0x80, 0x00, 0x0e, 0x20, 0x08, 0x00, 0x00, 0x08, 0x30, 0x20, 0x00, 
+0x00, 0xc8, 0x20, 0x20, 0x30, 0x00, 0x20, 0xd9, 0x00, 0x00, 0x80, 0x88, 0x00, 0x1c, 0x81, 0x00, 
+0x02, 0x08, 0x08, 0x00, 0x00, 0x0e, 0x04, 0x20, 0x00, 0x10, 0x01, 0x40, 0x78, 0x00, 0x20, 0x40, 
+0x5e, 0x22, 0x02, 0x42, 0x00, 0x20, 0x80, 0xa0, 0x20, 0x40, 0x20, 0xcb, 0x00, 0x07, 0x80, 0x20, 
+0x80, 0x40, 0x00, 0x02, 0x00, 0x04, 0x87, 0x00, 0x07, 0x04, 0x01, 0x00, 0x10, 0x24, 0x88, 0x00, 
+0x40, 0x8e, 0x00, 0x07, 0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x80, 0x80, 0xc9, 0x00, 0x02, 0xfe, 
+0x00, 0xfc, 0x82, 0x00, 0x03, 0xe6, 0x68, 0xb0, 0xd2, 0x82, 0xd0, 0x0a, 0x50, 0x10, 0x30, 0x20, 
+0xe0, 0x04, 0x00, 0x00, 0xce, 0x00, 0x86, 0x8a, 0x00, 0x0c, 0xc0, 0xfc, 0x9f, 0xfb, 0x3e, 0x06, 
+0xc0, 0x70, 0x9e, 0xee, 0x33, 0x1f, 0x0c, 0xbb, 0x00, 0x16, 0xc0, 0xfc, 0x1e, 0x27, 0x73, 0x33, 
+0x3f, 0x22, 0x80, 0x1c, 0x70, 0x80, 0x00, 0x04, 0x10, 0x22, 0x48, 0x90, 0x20, 0x40, 0x01, 0x80, 
+0x00, 0x81, 0x02, 0x81, 0x00, 0x08, 0x01, 0x41, 0x00, 0x00, 0x08, 0x04, 0x10, 0x00, 0x01, 0x88, 
+0x00, 0x0a, 0xc0, 0x1c, 0x07, 0x00, 0x07, 0x60, 0x24, 0x03, 0x49, 0x97, 0x03, 0xc0, 0x00, 0x0a, 
+0x07, 0x3c, 0x38, 0x18, 0x00, 0x01, 0x02, 0x01, 0x08, 0x07, 0x01, 0x85, 0x00, 0x00, 0x02, 0x81, 
+0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x02, 0x00, 0x01, 0x8e, 0x00, 0x05, 0x08, 0x00, 0x10, 0x20, 
+0x03, 0x02, 0x80, 0x00, 0x02, 0x03, 0x08, 0x06, 0xff, 0x00, 0x9c, 0x00, 0x01, 0xff, 0x00, 0xbd, 
+0x00, 0x00, 0xe0, 0x80, 0x00, 0x01, 0x80, 0x30, 0x80, 0x00, 0x0e, 0x20, 0x08, 0x00, 0x00, 0x08, 
+0x30, 0x20, 0x00, 0x00, 0xc8, 0x20, 0x20, 0x30, 0x00, 0x20, 0xe0, 0x00, 0x00, 0x80, 0x81, 0x00, 
+0x1c, 0x81, 0x00, 0x02, 0x08, 0x08, 0x00, 0x00, 0x0e, 0x04, 0x20, 0x04, 0x00, 0x01, 0x40, 0x78, 
+0x00, 0x20, 0x40, 0x5e, 0x22, 0x02, 0x42, 0x00, 0x20, 0x80, 0xa0, 0x20, 0x40, 0x20, 0xcb, 0x00, 
+0x06, 0x40, 0x00, 0x08, 0x24, 0x10, 0x08, 0x01, 0x8a, 0x00, 0x05, 0x02, 0x00, 0x40, 0x00, 0x20, 
+0x80, 0x90, 0x00, 0x00, 0x80, 0xce, 0x00, 0x02, 0x01, 0x00, 0x02, 0x82, 0x00, 0x02, 0x04, 0x00, 
+0x08, 0x80, 0x40, 0x82, 0x00, 0x01, 0x40, 0x40, 0x80, 0x00, 0x03, 0x01, 0x30, 0x00, 0x78, 0x8c, 
+0x00, 0x0a, 0x20, 0x04, 0x40, 0x08, 0x00, 0x80, 0x20, 0x10, 0x40, 0x20, 0x10, 0xbd, 0x00, 0x0d, 
+0x60, 0x00, 0x10, 0x10, 0x08, 0x04, 0x80, 0x00, 0x08, 0x00, 0x03, 0x08, 0x01, 0x04, 0x82, 0x00, 
+0x80, 0x02, 0x83, 0x00, 0x08, 0x80, 0x01, 0x00, 0x20, 0x90, 0x40, 0x22, 0x00, 0x04, 0x8a, 0x00, 
+0x0b, 0x20, 0x08, 0x00, 0x00, 0x81, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0xc0, 0xbf, 0x00, 0x00, 
+0x02, 0x81, 0x00, 0x04, 0x12, 0x02, 0x08, 0x00, 0x02, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 
+0x01, 0x04, 0x94, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x01, 0xff, 0x00, 
+0x9b, 0x00, 0x01, 0xff, 0x00, 0xbd, 0x00, 0x00, 0xe0, 0x80, 0x00, 0x01, 0x80, 0x30, 0x80, 0x00, 
+0x0e, 0x20, 0x08, 0x00, 0x00, 0x08, 0x30, 0x20, 0x00, 0x00, 0xc8, 0x20, 0x20, 0x30, 0x00, 0x20, 
+0xd9, 0x00, 0x00, 0x80, 0x82, 0x00, 0x00, 0x80, 0x82, 0x00, 0x1c, 0x81, 0x00, 0x02, 0x08, 0x08, 
+0x00, 0x00, 0x0e, 0x04, 0x20, 0x04, 0x00, 0x01, 0x40, 0x78, 0x00, 0x20, 0x40, 0x5e, 0x22, 0x02, 
+0x42, 0x00, 0x20, 0x80, 0xa0, 0x20, 0x40, 0x20, 0xd0, 0x00, 0x01, 0x08, 0x01, 0x85, 0x00, 0x08, 
+0x02, 0x00, 0x00, 0x01, 0x08, 0x10, 0x24, 0x08, 0x10, 0x8e, 0x00, 0x01, 0x80, 0x80, 0x80, 0xc0, 
+0x04, 0x40, 0x40, 0x00, 0x80, 0x80, 0xd1, 0x00, 0x02, 0x62, 0x60, 0x78, 0x80, 0xb0, 0x07, 0xf0, 
+0xf0, 0x20, 0x20, 0x00, 0x8c, 0x80, 0x08, 0x81, 0x00, 0x00, 0x01, 0x8b, 0x00, 0x0c, 0xf8, 0xff, 
+0xdf, 0xf9, 0x7f, 0xcf, 0xf1, 0x7e, 0xde, 0xe7, 0x7f, 0x3f, 0x1c, 0xbe, 0x00, 0x00, 0x20, 0x81, 
+0x00, 0x03, 0x04, 0x04, 0x18, 0x80, 0x80, 0x00, 0x08, 0x40, 0x90, 0x20, 0x00, 0x00, 0x84, 0x1c, 
+0x1b, 0x1b, 0x80, 0x0d, 0x04, 0x0e, 0x0e, 0x06, 0x02, 0x01, 0x83, 0x00, 0x00, 0x02, 0x8a, 0x00, 
+0x0b, 0x38, 0x0f, 0x00, 0x03, 0xe1, 0x06, 0x27, 0x05, 0x4f, 0x13, 0x20, 0xc0, 0xc3, 0x00, 0x00, 
+0x10, 0x8d, 0x00, 0x04, 0x05, 0x01, 0x00, 0x01, 0x04, 0x94, 0x00, 0x00, 0x02, 0x80, 0x00, 0x08, 
+0x20, 0x02, 0x02, 0x22, 0x02, 0x02, 0x08, 0x04, 0x01, 0xff, 0x00, 0x9b, 0x00, 0x01, 0xff, 0x00, 
+0xbd, 0x00, 0x00, 0xe0, 0x80, 0x00, 0x01, 0x80, 0x30, 0x80, 0x00, 0x0e, 0x20, 0x08, 0x00, 0x00, 
+0x08, 0x30, 0x20, 0x00, 0x00, 0xc8, 0x20, 0x20, 0x30, 0x00, 0x20, 0x87, 0x00, 0x18, 0x18, 0x18, 
+0x30, 0xe0, 0xf0, 0xf8, 0x70, 0x30, 0x10, 0x30, 0x30, 0x60, 0xc0, 0xe0, 0xe0, 0x00, 0x00, 0x60, 
+0xe0, 0x00, 0xf0, 0xf8, 0x10, 0xf0, 0xe0, 0xb6, 0x00, 0x00, 0x80, 0x82, 0x00, 0x00, 0x80, 0x82, 
+0x00, 0x1c, 0x81, 0x00, 0x02, 0x08, 0x08, 0x00, 0x00, 0x0e, 0x04, 0x20, 0x04, 0x00, 0x01, 0x40, 
+0x78, 0x00, 0x20, 0x40, 0x7e, 0x22, 0x02, 0x42, 0x00, 0x20, 0x80, 0xa0, 0x20, 0x40, 0x20, 0x82, 
+0x00, 0x1a, 0xe0, 0x7c, 0x0f, 0x03, 0x0f, 0x3f, 0x70, 0x60, 0x40, 0x60, 0x30, 0x1c, 0x0f, 0x1f, 
+0x7f, 0x40, 0x60, 0x78, 0x1f, 0x00, 0xff, 0x19, 0x3c, 0x67, 0x61, 0xc0, 0x80, 0xaa, 0x00, 0x0a, 
+0x80, 0x00, 0x10, 0x40, 0x00, 0x02, 0x08, 0x01, 0x00, 0x00, 0x02, 0x8b, 0x00, 0x00, 0x40, 0x88, 
+0x00, 0x01, 0x80, 0x80, 0x80, 0xc0, 0x80, 0x40, 0x81, 0xc0, 0x00, 0x80, 0xca, 0x00, 0x03, 0x78, 
+0x00, 0x00, 0x01, 0x80, 0x00, 0x12, 0x40, 0xc8, 0x9a, 0x82, 0x96, 0x50, 0x10, 0x50, 0x50, 0xd0, 
+0x20, 0x6c, 0xcc, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x02, 0x88, 0x00, 0x0e, 0x02, 0xff, 0xff, 0x81, 
+0x00, 0xf8, 0x3f, 0xe0, 0xfe, 0x02, 0xc0, 0xf0, 0x7f, 0x1f, 0x06, 0xcc, 0x00, 0x00, 0x20, 0x81, 
+0x00, 0x0b, 0x07, 0x0b, 0x13, 0x14, 0x14, 0x0a, 0x0a, 0x0b, 0x08, 0x08, 0x04, 0x03, 0x81, 0x00, 
+0x02, 0x04, 0x01, 0x08, 0x88, 0x00, 0x0d, 0x01, 0x7f, 0xff, 0x00, 0x07, 0x24, 0xe3, 0x07, 0x06, 
+0x07, 0x83, 0xc8, 0x10, 0xe0, 0xd5, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x04, 0x94, 0x00, 0x0b, 
+0x0b, 0x10, 0x10, 0x00, 0x01, 0x20, 0x21, 0x01, 0x11, 0x0f, 0x07, 0x03, 0xff, 0x00, 0x9c, 0x00, 
+0x01, 0xff, 0x00, 0xff, 0x00, 0xc6, 0x00, 0x00, 0x10, 0x83, 0x00, 0x00, 0x20, 0xd5, 0x00, 0x00, 
+0x20, 0x92, 0x00, 0x00, 0x80, 0x88, 0x00, 0x03, 0x80, 0x00, 0x80, 0x80, 0x82, 0xc0, 0x00, 0x80, 
+0xcf, 0x00, 0x02, 0x84, 0x00, 0x78, 0x81, 0x00, 0x06, 0x40, 0xd0, 0xc4, 0x74, 0x60, 0x60, 0x20, 
+0x80, 0x60, 0x03, 0x40, 0x00, 0x00, 0x0c, 0x81, 0x00, 0x02, 0x84, 0x00, 0x02, 0x81, 0x00, 0x0e, 
+0x3c, 0xfe, 0xe7, 0x83, 0x03, 0x01, 0xf0, 0x00, 0x7d, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x02, 0xc5, 
+0x00, 0x17, 0x80, 0x00, 0x20, 0x00, 0x90, 0x18, 0x18, 0x98, 0x20, 0xc0, 0x84, 0x00, 0x02, 0x08, 
+0x00, 0x00, 0x40, 0x07, 0x0f, 0x02, 0x02, 0x03, 0x01, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 
+0x00, 0x01, 0x83, 0x00, 0x10, 0x03, 0x0f, 0x3e, 0xf8, 0xe1, 0x8e, 0x00, 0x47, 0xe0, 0xc3, 0x03, 
+0x03, 0xe4, 0xe8, 0x58, 0xf8, 0xe0, 0xc1, 0x00, 0x0b, 0x01, 0x06, 0x08, 0x31, 0x6f, 0xf8, 0x73, 
+0x37, 0x37, 0x38, 0x1f, 0x06, 0x8d, 0x00, 0x02, 0x02, 0x00, 0x01, 0x8c, 0x00, 0x0c, 0x01, 0x07, 
+0x1f, 0x30, 0x20, 0x21, 0x21, 0x00, 0x01, 0x00, 0x10, 0x0f, 0x01, 0xff, 0x00, 0x9e, 0x00, 0x01, 
+0xff, 0x00, 0xbd, 0x00, 0x05, 0xc0, 0x08, 0x00, 0x00, 0x80, 0x30, 0x80, 0x00, 0x0e, 0x20, 0x08, 
+0x00, 0x00, 0x08, 0x30, 0x20, 0x00, 0x00, 0xc8, 0x20, 0x20, 0x30, 0x00, 0x20, 0x87, 0x00, 0x0d, 
+0x08, 0x28, 0x00, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x40, 0x80, 0x40, 0x20, 0x80, 0x00, 
+0x05, 0x60, 0x20, 0xc0, 0x00, 0xc8, 0x20, 0xb7, 0x00, 0x00, 0x80, 0x83, 0x00, 0x00, 0x80, 0x82, 
+0x00, 0x1c, 0x81, 0x00, 0x02, 0x08, 0x08, 0x00, 0x00, 0x0e, 0x04, 0x20, 0x04, 0x10, 0x01, 0x40, 
+0x78, 0x00, 0x20, 0x40, 0x5e, 0x22, 0x02, 0x42, 0x00, 0x20, 0x80, 0xa0, 0x20, 0x40, 0x20, 0x82, 
+0x00, 0x0c, 0x90, 0x40, 0x00, 0x00, 0x10, 0x00, 0x10, 0x20, 0x00, 0x00, 0x50, 0x2c, 0x10, 0x80, 
+0x00, 0x0a, 0x20, 0x18, 0x27, 0x1f, 0x00, 0x05, 0x02, 0x04, 0xa1, 0x40, 0x80, 0xaa, 0x00, 0x09, 
+0x40, 0x10, 0x88, 0x24, 0x12, 0x08, 0x01, 0x04, 0x00, 0x02, 0x82, 0x00, 0x0a, 0x02, 0x00, 0x00, 
+0x04, 0x08, 0x02, 0x00, 0x40, 0x10, 0x20, 0x80, 0x86, 0x00, 0x00, 0x80, 0xd8, 0x00, 0x02, 0x03, 
+0x00, 0x87, 0x80, 0x00, 0x04, 0xc0, 0xc0, 0xd8, 0xf8, 0xd8, 0x82, 0x00, 0x04, 0x80, 0xb0, 0xbc, 
+0x14, 0x18, 0x80, 0x00, 0x03, 0x01, 0x78, 0x01, 0xfc, 0x80, 0x00, 0x09, 0x38, 0xc0, 0x10, 0x60, 
+0x80, 0x00, 0x04, 0xf1, 0x01, 0x7c, 0xcc, 0x00, 0x03, 0xc0, 0xc0, 0xe0, 0x60, 0x80, 0xe0, 0x06, 
+0x40, 0x03, 0x48, 0x91, 0x84, 0x90, 0x20, 0x81, 0x00, 0x04, 0x02, 0x10, 0x01, 0x09, 0x08, 0x80, 
+0x00, 0x08, 0x84, 0x02, 0x40, 0x20, 0x90, 0x48, 0x23, 0x18, 0x06, 0x83, 0x00, 0x0f, 0x03, 0x0c, 
+0x31, 0xc6, 0x18, 0x00, 0x0e, 0x40, 0x87, 0x20, 0x00, 0x04, 0x24, 0x04, 0x10, 0xe0, 0xc4, 0x00, 
+0x17, 0x01, 0x0f, 0x4e, 0x88, 0x1f, 0xe3, 0x27, 0x4f, 0xc4, 0xde, 0x87, 0x01, 0x03, 0x07, 0xff, 
+0xfc, 0xfa, 0xf0, 0xe0, 0xc4, 0x01, 0x00, 0x01, 0x04, 0x92, 0x00, 0x0a, 0x02, 0x08, 0x20, 0x00, 
+0x01, 0x02, 0x00, 0x20, 0x00, 0x00, 0x08, 0xc9, 0x00, 0x0f, 0x0f, 0x1f, 0x38, 0x30, 0x71, 0x63, 
+0x67, 0x67, 0x66, 0x36, 0x37, 0x3b, 0x1c, 0x0f, 0x07, 0x03, 0xc6, 0x00, 0x01, 0xff, 0x00, 0xbd, 
+0x00, 0x05, 0xc0, 0x08, 0x00, 0x00, 0x80, 0x30, 0x80, 0x00, 0x0e, 0x20, 0x08, 0x00, 0x00, 0x08, 
+0x30, 0x20, 0x00, 0x00, 0xc8, 0x20, 0x20, 0x30, 0x00, 0x20, 0x87, 0x00, 0x0d, 0x08, 0x28, 0x00, 
+0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x40, 0x80, 0x40, 0x20, 0x80, 0x00, 0x05, 0x60, 0x20, 
+0xc0, 0x00, 0xc8, 0x20, 0xb7, 0x00, 0x00, 0x80, 0x81, 0x00, 0x01, 0x80, 0x80, 0x83, 0x00, 0x1c, 
+0x81, 0x00, 0x02, 0x08, 0x08, 0x00, 0x00, 0x0e, 0x04, 0x20, 0x04, 0x10, 0x01, 0x40, 0x78, 0x00, 
+0x20, 0x40, 0x5e, 0x22, 0x02, 0x42, 0x00, 0x20, 0x80, 0xa0, 0x20, 0x40, 0x20, 0x82, 0x00, 0x0c, 
+0x90, 0x40, 0x00, 0x00, 0x10, 0x00, 0x50, 0x20, 0x00, 0x00, 0x50, 0x2c, 0x10, 0x80, 0x00, 0x0a, 
+0x20, 0x18, 0x27, 0x1f, 0x00, 0x05, 0x02, 0x04, 0xa1, 0x40, 0x80, 0xa9, 0x00, 0x03, 0x80, 0x20, 
+0x80, 0x40, 0x83, 0x00, 0x0f, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x04, 0x05, 0x09, 0x02, 
+0x14, 0x64, 0x98, 0x20, 0xc0, 0xe2, 0x00, 0x02, 0xfe, 0x00, 0xfc, 0x85, 0x00, 0x00, 0x80, 0x81, 
+0x00, 0x0b, 0x20, 0x30, 0x08, 0x28, 0x00, 0x18, 0x00, 0x00, 0x01, 0xfe, 0x00, 0xce, 0x81, 0x00, 
+0x0a, 0x38, 0x00, 0x10, 0x01, 0x05, 0x05, 0x01, 0xf0, 0x02, 0x70, 0x80, 0xd1, 0x00, 0x0d, 0x80, 
+0x81, 0xcc, 0xd1, 0xe6, 0xc8, 0x20, 0x00, 0x40, 0x80, 0x80, 0x00, 0x0c, 0x12, 0x84, 0x00, 0x00, 
+0x04, 0x80, 0x00, 0x03, 0x04, 0x10, 0x04, 0x01, 0x84, 0x00, 0x07, 0x08, 0x30, 0xc4, 0x18, 0x00, 
+0x7f, 0xd8, 0x07, 0x80, 0x00, 0x02, 0xc0, 0x08, 0x20, 0xc7, 0x00, 0x17, 0x70, 0xf8, 0xf8, 0x9c, 
+0x1f, 0xbf, 0x1f, 0x21, 0xe1, 0x61, 0x63, 0xe6, 0x02, 0x02, 0xc4, 0xfc, 0xfd, 0xd9, 0x18, 0x78, 
+0xf1, 0xe4, 0xc0, 0x80, 0x90, 0x00, 0x0a, 0x03, 0x10, 0x00, 0x4f, 0x56, 0x50, 0x40, 0x00, 0x00, 
+0x10, 0x07, 0xc9, 0x00, 0x19, 0x0f, 0x1f, 0x38, 0x30, 0x76, 0x1c, 0x98, 0x9f, 0xa6, 0xb7, 0xb4, 
+0x24, 0x22, 0x33, 0x7f, 0x73, 0x60, 0x60, 0x70, 0x7d, 0xbf, 0x8f, 0xce, 0xfc, 0xf8, 0x70, 0xbc, 
+0x00, 0x00, 0xb7, 0xff, 0x11, 0xbf, 0xbf, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0xdf, 0x1f, 0x3f, 0x1f, 
+0xdf, 0x9f, 0x3b, 0x39, 0x00, 0xfd, 0xfd, 0xed, 0xff, 0x17, 0xf0, 0xff, 0xff, 0xfc, 0xf8, 0xff, 
+0x18, 0x0c, 0x1c, 0xf9, 0xf9, 0x38, 0x0c, 0xfc, 0xff, 0x3f, 0x0f, 0x0f, 0xff, 0x07, 0x0f, 0x3f, 
+0x9f, 0x0f, 0x80, 0xcf, 0x04, 0x3f, 0x0f, 0xcf, 0xcf, 0xdf, 0x85, 0xff, 0x06, 0xef, 0xcf, 0xcf, 
+0x1f, 0x1f, 0x07, 0x97, 0x80, 0xcf, 0x04, 0x8f, 0x1f, 0x7f, 0x3f, 0x1f, 0x80, 0xff, 0x06, 0x3f, 
+0x3f, 0x0f, 0xcf, 0xcf, 0x0f, 0x1f, 0xc2, 0xff, 0x1c, 0x80, 0x00, 0xfc, 0xf8, 0xf8, 0xfc, 0x80, 
+0x81, 0x83, 0xe0, 0xf9, 0xf0, 0x80, 0x80, 0xf8, 0xf2, 0xc7, 0x80, 0x80, 0xbc, 0x9c, 0x9c, 0xfc, 
+0xbd, 0xbc, 0x9c, 0x9c, 0xc0, 0xe3, 0x82, 0xff, 0x19, 0x9f, 0xc3, 0xf0, 0xfc, 0xe0, 0xc0, 0x9f, 
+0xbf, 0xbf, 0x9f, 0x9f, 0xcf, 0xe0, 0xe0, 0x80, 0x3f, 0xbf, 0x9f, 0xc7, 0xe0, 0x00, 0xe3, 0xc1, 
+0x9c, 0x3f, 0x7f, 0xa7, 0xff, 0x07, 0x7f, 0x3f, 0x1f, 0x8f, 0xcf, 0xc7, 0xe7, 0xe3, 0x84, 0xf3, 
+0x07, 0xe3, 0xe7, 0xc7, 0xcf, 0x8f, 0x1f, 0x3f, 0x7f, 0x8c, 0xff, 0x15, 0x01, 0x00, 0xfc, 0xfc, 
+0xf1, 0x03, 0x1f, 0xff, 0x03, 0x80, 0xa0, 0x07, 0x3f, 0xf9, 0xf9, 0xfb, 0xf3, 0x37, 0x07, 0xc3, 
+0xf1, 0xfd, 0xbe, 0xff, 0x04, 0x1f, 0x03, 0x00, 0xf8, 0xfe, 0x8b, 0xff, 0x01, 0x1f, 0x3f, 0x80, 
+0xff, 0x04, 0xfe, 0xf8, 0x00, 0x03, 0x3f, 0x89, 0xff, 0x08, 0xc0, 0xc0, 0xcf, 0xcf, 0xe7, 0xf0, 
+0xf8, 0xc0, 0xf0, 0x80, 0xff, 0x05, 0xf0, 0xf3, 0xff, 0xe7, 0xe1, 0xfc, 0xc2, 0xff, 0x23, 0xfc, 
+0xe0, 0x80, 0x0f, 0x3f, 0x7f, 0xff, 0x1f, 0x0f, 0x0f, 0x07, 0x10, 0x50, 0x18, 0x1b, 0x99, 0x99, 
+0xc9, 0xcd, 0xcd, 0xed, 0xed, 0xe9, 0x61, 0x21, 0x01, 0x80, 0xe0, 0x7c, 0x3f, 0x1f, 0x9f, 0x9f, 
+0x1f, 0x3f, 0x7f, 0x84, 0xff, 0x02, 0x8f, 0x0f, 0x0f, 0x80, 0xcf, 0x05, 0xc7, 0xe7, 0xe7, 0x07, 
+0x0f, 0x7f, 0xca, 0xff, 0x07, 0xfe, 0xfc, 0xf8, 0xf1, 0xf2, 0xe2, 0xe6, 0xe6, 0x84, 0xe7, 0x0a, 
+0xe3, 0xf3, 0xf1, 0xf8, 0xfc, 0xfe, 0xff, 0x3f, 0x01, 0x80, 0xfc, 0x81, 0xff, 0x02, 0xfc, 0x00, 
+0x01, 0x84, 0xff, 0x09, 0xe0, 0xc0, 0xc1, 0xc3, 0xe1, 0xe1, 0xf1, 0xf8, 0xfc, 0xfe, 0xae, 0xff, 
+0x00, 0xfe, 0xab, 0xff, 0x0e, 0x3f, 0x07, 0xc1, 0xf0, 0xfc, 0xfe, 0xff, 0xff, 0xef, 0x87, 0x03, 
+0x23, 0x41, 0x08, 0x1e, 0x93, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 0xff, 0x00, 0xbd, 0x00, 0x05, 
+0xe0, 0x08, 0x00, 0x00, 0x80, 0x30, 0x80, 0x00, 0x0e, 0x20, 0x08, 0x00, 0x00, 0x08, 0x30, 0x20, 
+0x00, 0x00, 0xc8, 0x20, 0x20, 0x30, 0x00, 0x20, 0x87, 0x00, 0x0d, 0x08, 0x28, 0x00, 0x00, 0x10, 
+0x00, 0x18, 0x00, 0x20, 0x00, 0x40, 0x80, 0x40, 0x20, 0x80, 0x00, 0x05, 0x60, 0x20, 0xc0, 0x00, 
+0xc8, 0x20, 0xc4, 0x00, 0x1c, 0x81, 0x00, 0x02, 0x08, 0x08, 0x00, 0x00, 0x0e, 0x04, 0x20, 0x00, 
+0x10, 0x01, 0x40, 0x78, 0x00, 0x20, 0x40, 0x5e, 0x22, 0x02, 0x42, 0x80, 0x20, 0x80, 0xa0, 0x20, 
+0x40, 0x20, 0x82, 0x00, 0x1a, 0x80, 0x44, 0x00, 0x00, 0x10, 0x00, 0x50, 0x20, 0x00, 0x00, 0x50, 
+0x2c, 0x10, 0x00, 0x00, 0x80, 0x20, 0x18, 0x27, 0x1f, 0x00, 0x05, 0x02, 0x04, 0xa1, 0x40, 0x80, 
+0xa9, 0x00, 0x04, 0x10, 0x40, 0x08, 0x00, 0x04, 0x84, 0x14, 0x07, 0x24, 0x28, 0x48, 0xd0, 0xb0, 
+0x20, 0xc0, 0x80, 0x8c, 0x00, 0x0c, 0x01, 0x00, 0x01, 0x05, 0x02, 0x04, 0x10, 0x80, 0x04, 0x00, 
+0x20, 0x04, 0xc0, 0x82, 0x00, 0x03, 0x80, 0x04, 0x00, 0x04, 0xc0, 0x00, 0x00, 0xe0, 0x8c, 0x00, 
+0x01, 0x80, 0x20, 0x80, 0x00, 0x05, 0x03, 0x0e, 0xf9, 0x07, 0x7c, 0xc0, 0x89, 0x00, 0x00, 0x20, 
+0x82, 0x00, 0x0b, 0x1c, 0x20, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x38, 0x06, 0x19, 0x02, 0xc2, 
+0x00, 0x1c, 0x0c, 0x60, 0x87, 0x30, 0x40, 0x80, 0x00, 0xe0, 0xb0, 0x90, 0x18, 0x99, 0xd8, 0x9d, 
+0xdc, 0x5e, 0x5a, 0x2a, 0x2e, 0x2e, 0x1e, 0x1c, 0x18, 0x18, 0x3e, 0x01, 0x40, 0x1c, 0x83, 0x80, 
+0x00, 0x04, 0x10, 0x80, 0x20, 0x40, 0x80, 0x83, 0x00, 0x02, 0x80, 0x00, 0xc8, 0x80, 0x28, 0x05, 
+0x20, 0x20, 0x68, 0x18, 0x30, 0x80, 0xc9, 0x00, 0x08, 0x03, 0x06, 0x05, 0x09, 0x12, 0x15, 0x05, 
+0x29, 0x29, 0x82, 0x28, 0x00, 0x20, 0x85, 0x00, 0x04, 0xc0, 0x7e, 0x80, 0xfc, 0x01, 0x80, 0x00, 
+0x03, 0x03, 0xfc, 0x01, 0xfe, 0x81, 0x00, 0x0b, 0x01, 0x1f, 0x20, 0x07, 0x02, 0x00, 0x22, 0x00, 
+0x08, 0x01, 0x04, 0x02, 0xdd, 0x00, 0x11, 0xc0, 0xf8, 0xde, 0xf3, 0x3c, 0x06, 0x01, 0x00, 0x10, 
+0x78, 0xc4, 0xa0, 0x42, 0x29, 0x5e, 0xf3, 0xe0, 0x80, 0xb0, 0x00, 0x01, 0xba, 0x00, 0x00, 0x80, 
+0xff, 0x00, 0xff, 0x00, 0x84, 0x00, 0x03, 0x10, 0x00, 0x00, 0x04, 0x95, 0x00, 0x00, 0x04, 0xc1, 
+0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x28, 0x84, 0x00, 0x06, 0x20, 0x08, 0x40, 0x10, 0x00, 0x00, 
+0x40, 0xe5, 0x00, 0x02, 0x10, 0x00, 0x01, 0x8c, 0x00, 0x09, 0x40, 0x00, 0x40, 0x00, 0x01, 0x00, 
+0x00, 0x02, 0x08, 0x80, 0x98, 0x00, 0x00, 0x08, 0xc5, 0x00, 0x04, 0x10, 0x00, 0x08, 0x00, 0x80, 
+0x80, 0x00, 0x0f, 0x40, 0x60, 0xe0, 0x70, 0xb0, 0x9d, 0xc8, 0x48, 0x4c, 0x24, 0x25, 0x25, 0x14, 
+0x16, 0x0e, 0x06, 0x80, 0x00, 0x0c, 0x03, 0x00, 0xc0, 0x20, 0x80, 0x10, 0x00, 0x80, 0x20, 0x40, 
+0x80, 0xc0, 0xf0, 0x80, 0x30, 0x0a, 0x80, 0x80, 0xd8, 0xd8, 0x98, 0x18, 0x18, 0x38, 0x70, 0xe0, 
+0xc0, 0xc9, 0x00, 0x07, 0x01, 0x00, 0x00, 0x08, 0x02, 0x04, 0x00, 0x28, 0x84, 0x00, 0x03, 0x08, 
+0x20, 0x04, 0x10, 0x83, 0x00, 0x03, 0x80, 0x3f, 0x00, 0x7e, 0x81, 0x00, 0x03, 0x03, 0xf8, 0x01, 
+0xff, 0x80, 0x78, 0x0b, 0x79, 0x27, 0x27, 0x00, 0x27, 0x23, 0x32, 0x1e, 0x06, 0x06, 0x07, 0x03, 
+0xdf, 0x00, 0x10, 0xe0, 0x0c, 0xc3, 0x18, 0x06, 0x01, 0x00, 0x00, 0x38, 0x44, 0x00, 0x20, 0x00, 
+0xc0, 0x11, 0x40, 0x80, 0xaf, 0x00, 0x01, 0xff, 0x00, 0xbd, 0x00, 0x05, 0xc0, 0x08, 0x00, 0x00, 
+0x80, 0x30, 0x80, 0x00, 0x0e, 0x20, 0x08, 0x00, 0x00, 0x08, 0x30, 0x20, 0x00, 0x00, 0xc8, 0x20, 
+0x20, 0x30, 0x00, 0x20, 0x87, 0x00, 0x0d, 0x08, 0x28, 0x00, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 
+0x00, 0x40, 0x80, 0x40, 0x20, 0x80, 0x00, 0x05, 0x60, 0x20, 0xc0, 0x00, 0xc8, 0x20, 0xc4, 0x00, 
+0x1c, 0x81, 0x00, 0x02, 0x08, 0x08, 0x00, 0x00, 0x1e, 0x04, 0x20, 0x04, 0x10, 0x01, 0x40, 0x78, 
+0x00, 0x20, 0x40, 0x5e, 0x22, 0x02, 0x42, 0x80, 0x20, 0x80, 0xa0, 0x20, 0x40, 0x20, 0x82, 0x00, 
+0x1a, 0x90, 0x40, 0x00, 0x00, 0x10, 0x00, 0x50, 0x20, 0x00, 0x00, 0x50, 0x2c, 0x10, 0x20, 0x00, 
+0x00, 0x20, 0x18, 0x27, 0x1f, 0x00, 0x05, 0x02, 0x04, 0xa1, 0x40, 0x80, 0xa6, 0x00, 0x12, 0x80, 
+0x40, 0x00, 0xa0, 0x10, 0x50, 0x00, 0x28, 0x28, 0x20, 0x00, 0x00, 0x20, 0x28, 0x08, 0x00, 0x10, 
+0x00, 0x20, 0x90, 0x00, 0x0c, 0x01, 0x00, 0x01, 0x05, 0x02, 0x04, 0x10, 0x80, 0x04, 0x00, 0x20, 
+0x04, 0xc0, 0x82, 0x00, 0x03, 0x80, 0x04, 0x00, 0x04, 0xbe, 0x00, 0x05, 0x30, 0x04, 0x62, 0x08, 
+0x02, 0x01, 0x90, 0x00, 0x02, 0x80, 0x08, 0xc0, 0x90, 0x00, 0x0b, 0x1c, 0x20, 0x0c, 0x00, 0x00, 
+0x03, 0x00, 0x0c, 0x30, 0x06, 0x09, 0x02, 0xc2, 0x00, 0x02, 0x10, 0x00, 0x08, 0x85, 0x00, 0x14, 
+0x06, 0x00, 0x20, 0x10, 0x90, 0x00, 0x48, 0x48, 0x08, 0x28, 0x20, 0x00, 0x80, 0x20, 0x07, 0x40, 
+0x0f, 0x00, 0x00, 0xc0, 0xe0, 0x80, 0x60, 0x04, 0xe0, 0x00, 0x60, 0xb0, 0xc0, 0x80, 0x50, 0x04, 
+0x90, 0xb0, 0xe0, 0xc0, 0x80, 0xd3, 0x00, 0x07, 0x10, 0x00, 0x28, 0x00, 0x40, 0x50, 0x51, 0x51, 
+0x80, 0x50, 0x1f, 0x00, 0x08, 0x20, 0x04, 0x12, 0x09, 0x04, 0x02, 0x01, 0x00, 0x00, 0xc0, 0xff, 
+0x7f, 0x00, 0x00, 0x80, 0x10, 0x3f, 0x78, 0x86, 0x87, 0x00, 0x00, 0x48, 0x48, 0x08, 0x27, 0x07, 
+0x17, 0x1f, 0x0e, 0xe6, 0x00, 0x10, 0x04, 0x03, 0x09, 0x07, 0x06, 0x07, 0x03, 0x3b, 0xff, 0xfd, 
+0xa8, 0x4d, 0x07, 0x06, 0x7e, 0xfc, 0xc0, 0xad, 0x00, 0x01, 0xff, 0x00, 0xbd, 0x00, 0x05, 0xc0, 
+0x08, 0x00, 0x00, 0x80, 0x30, 0x80, 0x00, 0x0e, 0x20, 0x08, 0x00, 0x00, 0x08, 0x30, 0x20, 0x00, 
+0x00, 0xc8, 0x20, 0x20, 0x30, 0x00, 0x20, 0x87, 0x00, 0x0d, 0x08, 0x28, 0x00, 0x00, 0x10, 0x00, 
+0x18, 0x00, 0x20, 0x00, 0x40, 0x80, 0x40, 0x20, 0x80, 0x00, 0x05, 0x60, 0x20, 0xc0, 0x00, 0xc8, 
+0x20, 0xc4, 0x00, 0x1c, 0x81, 0x00, 0x02, 0x08, 0x08, 0x00, 0x00, 0x0e, 0x04, 0x20, 0x04, 0x10, 
+0x01, 0x40, 0x78, 0x00, 0x20, 0x40, 0x5e, 0x22, 0x02, 0x42, 0x80, 0x20, 0x80, 0xa0, 0x20, 0x40, 
+0x20, 0x82, 0x00, 0x1a, 0x90, 0x40, 0x00, 0x00, 0x10, 0x00, 0x50, 0x20, 0x00, 0x00, 0x50, 0x2c, 
+0x10, 0x20, 0x00, 0x00, 0x20, 0x18, 0x27, 0x1f, 0x00, 0x15, 0x02, 0x04, 0xa1, 0x40, 0x80, 0xa7, 
+0x00, 0x10, 0x80, 0xc0, 0xc0, 0xe0, 0xa0, 0xf0, 0xd0, 0x50, 0x58, 0x78, 0x28, 0x08, 0x40, 0x50, 
+0x50, 0x00, 0x80, 0x91, 0x00, 0x0c, 0x01, 0x00, 0x01, 0x05, 0x02, 0x04, 0x10, 0x80, 0x04, 0x00, 
+0x20, 0x04, 0xc0, 0x82, 0x00, 0x03, 0x80, 0x04, 0x00, 0x04, 0xbe, 0x00, 0x08, 0xc0, 0xf8, 0x9c, 
+0xf7, 0x3f, 0x0e, 0x07, 0x01, 0x01, 0x86, 0x00, 0x02, 0x40, 0x40, 0x80, 0x80, 0x00, 0x04, 0x08, 
+0x72, 0x84, 0x30, 0xc0, 0x8f, 0x00, 0x0b, 0x1c, 0x20, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x38, 
+0x06, 0x09, 0x02, 0xc2, 0x00, 0x04, 0x0f, 0x7b, 0x87, 0x3f, 0x80, 0x84, 0x00, 0x03, 0xc1, 0x40, 
+0x62, 0x60, 0x82, 0xf0, 0x07, 0x38, 0x00, 0x00, 0xc0, 0xf8, 0xbf, 0xf0, 0x3f, 0x83, 0x00, 0x04, 
+0xc0, 0x20, 0x80, 0x10, 0x50, 0x80, 0xa0, 0x01, 0x60, 0xc0, 0xd2, 0x00, 0x01, 0x01, 0x02, 0x80, 
+0x00, 0x14, 0x20, 0x00, 0x40, 0x10, 0x00, 0xa1, 0xa0, 0xa1, 0xa0, 0xa0, 0xf0, 0xd0, 0x58, 0x78, 
+0x6c, 0x36, 0x1f, 0x0d, 0x0e, 0x03, 0x01, 0x82, 0x00, 0x0d, 0xbe, 0x6f, 0x44, 0x07, 0x09, 0x08, 
+0x08, 0x18, 0x50, 0x53, 0x4f, 0x01, 0x3f, 0x0c, 0xe9, 0x00, 0x11, 0x04, 0x02, 0x08, 0x00, 0x01, 
+0x04, 0x00, 0x05, 0x05, 0x11, 0x78, 0xf0, 0xaa, 0x12, 0x00, 0x38, 0xe0, 0x80, 0xab, 0x00, 0x01, 
+0xff, 0x00, 0xbd, 0x00, 0x05, 0xe0, 0x08, 0x00, 0x00, 0x80, 0x30, 0x80, 0x00, 0x0e, 0x20, 0x08, 
+0x00, 0x00, 0x08, 0x30, 0x20, 0x00, 0x00, 0xc8, 0x20, 0x20, 0x30, 0x00, 0x20, 0x87, 0x00, 0x0d, 
+0x08, 0x28, 0x00, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x40, 0x80, 0x40, 0x20, 0x80, 0x00, 
+0x05, 0x60, 0x20, 0xc0, 0x00, 0xc8, 0x20, 0xc4, 0x00, 0x1c, 0x81, 0x00, 0x02, 0x08, 0x08, 0x00, 
+0x00, 0x0e, 0x04, 0x20, 0x04, 0x10, 0x01, 0x40, 0x78, 0x00, 0x20, 0x40, 0x5e, 0x22, 0x02, 0x42, 
+0x80, 0x20, 0x80, 0xa0, 0x20, 0x40, 0x20, 0x82, 0x00, 0x1a, 0x90, 0x40, 0x00, 0x00, 0x10, 0x00, 
+0x50, 0x20, 0x00, 0x00, 0x50, 0x2c, 0x10, 0x20, 0x00, 0x80, 0x20, 0x18, 0x27, 0x1f, 0x00, 0x15, 
+0x02, 0x04, 0xa1, 0x40, 0x80, 0xaa, 0x00, 0x09, 0x80, 0xc0, 0xc0, 0x60, 0xa0, 0xa0, 0x80, 0x50, 
+0x50, 0x10, 0x80, 0x00, 0x05, 0x80, 0xa0, 0x00, 0x40, 0xc0, 0x80, 0x8c, 0x00, 0x0c, 0x01, 0x00, 
+0x01, 0x05, 0x02, 0x04, 0x10, 0x80, 0x04, 0x00, 0x20, 0x04, 0xc0, 0x82, 0x00, 0x03, 0x80, 0x04, 
+0x00, 0x04, 0xc0, 0x00, 0x09, 0xe0, 0xf8, 0xbc, 0xff, 0xff, 0x1f, 0x0e, 0x03, 0x01, 0x01, 0x83, 
+0x00, 0x80, 0x80, 0x09, 0xc0, 0xc1, 0x03, 0x06, 0x0d, 0x7b, 0xfe, 0xfc, 0xf8, 0xe0, 0x8d, 0x00, 
+0x0b, 0x1c, 0x20, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x38, 0x06, 0x19, 0x02, 0xc3, 0x00, 0x05, 
+0x04, 0x7f, 0xff, 0xbf, 0xff, 0xe0, 0x83, 0x00, 0x01, 0x81, 0xe4, 0x80, 0xf0, 0x04, 0xf1, 0xb1, 
+0xb1, 0x71, 0x60, 0x80, 0x00, 0x08, 0xc0, 0xff, 0xbf, 0xf3, 0xff, 0x1e, 0x00, 0x00, 0x80, 0x81, 
+0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x80, 0xd4, 0x00, 0x0b, 0x01, 0x07, 0x0f, 0x1f, 0x37, 0x2c, 
+0x48, 0x50, 0x10, 0xa0, 0x21, 0x01, 0x80, 0x00, 0x1a, 0x20, 0xa0, 0xa0, 0xb0, 0x58, 0x78, 0x7e, 
+0x37, 0x1f, 0x0f, 0x07, 0x03, 0x00, 0x00, 0x38, 0x01, 0x00, 0x02, 0x08, 0x00, 0x00, 0x10, 0x00, 
+0x01, 0x1c, 0x40, 0x26, 0xe9, 0x00, 0x08, 0x30, 0x18, 0x68, 0x34, 0x16, 0x0a, 0x0a, 0x0b, 0x0f, 
+0x81, 0x0a, 0x06, 0x1a, 0xb4, 0x34, 0x04, 0x08, 0x60, 0x80, 0xab, 0x00, 0x00, 0xba, 0xff, 0x0b, 
+0xcf, 0xcf, 0x00, 0xdf, 0x00, 0x00, 0xcf, 0x8f, 0x1f, 0x3f, 0x1f, 0x9f, 0xf3, 0xff, 0x07, 0xfc, 
+0xff, 0xfc, 0xfc, 0xff, 0xff, 0xf8, 0xfe, 0x80, 0xfc, 0xff, 0xff, 0xe0, 0xff, 0x07, 0x7f, 0x3f, 
+0x1f, 0x8f, 0xcf, 0xc7, 0xe7, 0xe3, 0x85, 0xf3, 0x06, 0xe7, 0xe7, 0xc7, 0x8f, 0x1f, 0x3f, 0x7f, 
+0xe4, 0xff, 0x03, 0x07, 0x01, 0xf0, 0xfc, 0x81, 0xff, 0x07, 0x7f, 0x1f, 0x0f, 0xcf, 0xef, 0x7f, 
+0x7f, 0x3f, 0x81, 0x7f, 0x07, 0x8f, 0x8f, 0xdf, 0xfe, 0xf8, 0x00, 0x03, 0x7f, 0xe1, 0xff, 0x04, 
+0xf0, 0xc0, 0x07, 0x1f, 0x7f, 0x82, 0xff, 0x19, 0xe3, 0xc1, 0xc0, 0xc6, 0xce, 0xc7, 0xc0, 0xfc, 
+0xfe, 0xfe, 0xff, 0xff, 0x7f, 0x3f, 0x0f, 0x80, 0xe0, 0x3e, 0x1f, 0x8f, 0xcf, 0xcf, 0x9f, 0x9f, 
+0x1f, 0x3f, 0xdc, 0xff, 0x06, 0xfe, 0xfc, 0xf8, 0xf9, 0xf1, 0xf3, 0xe3, 0x85, 0xe7, 0x13, 0xf3, 
+0xf3, 0xf1, 0xf8, 0xfc, 0xfe, 0xff, 0xe3, 0xc0, 0xc0, 0xc3, 0x87, 0x87, 0xc7, 0xcf, 0xcf, 0x8f, 
+0xc0, 0xc0, 0xf3, 0xb6, 0xff, 0x00, 0xfe, 0xb0, 0xff, 0x10, 0x7f, 0x3f, 0x3f, 0x1f, 0x9f, 0x8f, 
+0xcf, 0xcf, 0x8f, 0x8f, 0xcf, 0xcf, 0x4f, 0x8f, 0x1f, 0x1f, 0x7f, 0x8c, 0xff, 0x00, 0xfe, 0x9c, 
+0xff, 0x00, 0xba, 0xff, 0x0b, 0xcf, 0xcf, 0x00, 0xdf, 0x00, 0x00, 0xcf, 0x8f, 0x1f, 0x3f, 0x1f, 
+0x9f, 0xf3, 0xff, 0x07, 0xfc, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xf8, 0xfe, 0x80, 0xfc, 0xec, 0xff, 
+0x87, 0x7f, 0xeb, 0xff, 0x0a, 0x3f, 0x0f, 0x87, 0xe3, 0xf1, 0xf9, 0xfc, 0xfc, 0xfe, 0xfe, 0x7e, 
+0x83, 0xfe, 0x17, 0xfc, 0xfc, 0xf8, 0xf1, 0xe3, 0xc7, 0x0f, 0x1f, 0x7f, 0x8f, 0x0f, 0x0f, 0x4f, 
+0x4f, 0x0f, 0x07, 0x03, 0x33, 0x33, 0x13, 0x03, 0x03, 0x1f, 0x1f, 0xd3, 0xff, 0x02, 0x00, 0x00, 
+0xfe, 0x83, 0xff, 0x05, 0x9f, 0x9c, 0x9c, 0x1c, 0x1f, 0x1f, 0x80, 0x3f, 0x01, 0x0f, 0xcf, 0x82, 
+0xff, 0x04, 0x00, 0x00, 0xc7, 0xff, 0xff, 0x81, 0xfe, 0x80, 0xfc, 0x03, 0xf8, 0xf0, 0xf0, 0xf8, 
+0xd5, 0xff, 0x08, 0xf8, 0xf0, 0xc3, 0x8f, 0x9f, 0x1f, 0x3f, 0x7f, 0x7f, 0x84, 0xff, 0x09, 0x7f, 
+0x7f, 0x3f, 0x3f, 0x1f, 0x8f, 0xc7, 0xe1, 0xf0, 0xfc, 0xe9, 0xff, 0x80, 0xfe, 0x85, 0xfc, 0x01, 
+0xfe, 0xfe, 0xc5, 0xff, 0x00, 0xfe, 0xd0, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 0xcb, 0x00, 0x0d, 
+0xe0, 0xf0, 0x30, 0x30, 0xf0, 0xe0, 0xe0, 0x20, 0x60, 0xe0, 0x00, 0xc0, 0xe0, 0xe0, 0xef, 0x00, 
+0x0e, 0x01, 0x03, 0x06, 0x06, 0x03, 0x03, 0x07, 0x00, 0x00, 0x03, 0x00, 0x03, 0x06, 0x06, 0x02, 
+0xd7, 0x00, 0x01, 0x80, 0x80, 0x87, 0x40, 0x01, 0x80, 0x80, 0x85, 0x00, 0x81, 0xc0, 0x02, 0x80, 
+0x80, 0x00, 0x81, 0x80, 0xd6, 0x00, 0x0b, 0x20, 0x00, 0x44, 0x12, 0x08, 0x05, 0x00, 0x02, 0x00, 
+0x01, 0x01, 0x81, 0x82, 0x01, 0x17, 0x02, 0x02, 0x04, 0x09, 0x12, 0x24, 0x88, 0x10, 0x40, 0x70, 
+0xf0, 0xf0, 0xb3, 0xb7, 0xff, 0xe5, 0xc3, 0xb3, 0x33, 0x1d, 0x0d, 0x03, 0x1f, 0x9e, 0xd3, 0x00, 
+0x02, 0x80, 0x00, 0xc0, 0x81, 0x00, 0x0c, 0x38, 0x7c, 0x1c, 0x1f, 0xac, 0x6c, 0x78, 0xf8, 0xf0, 
+0x20, 0x00, 0x80, 0x40, 0x82, 0x00, 0x04, 0x1c, 0x00, 0x06, 0x00, 0x00, 0x81, 0x01, 0x06, 0x03, 
+0x03, 0x00, 0x04, 0x0c, 0x0e, 0x07, 0xd5, 0x00, 0x19, 0x04, 0x08, 0x22, 0x4c, 0x50, 0x80, 0x20, 
+0x40, 0x40, 0x80, 0x80, 0x81, 0x83, 0x86, 0x84, 0x8c, 0x07, 0x47, 0x00, 0x20, 0x90, 0x48, 0x24, 
+0x11, 0x08, 0x02, 0xe9, 0x00, 0x02, 0x01, 0x01, 0x00, 0x85, 0x02, 0x01, 0x01, 0x01, 0xff, 0x00, 
+0xb7, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xb5, 0x00, 0x00, 0x20, 0x80, 0xa0, 0x80, 0x00, 0x02, 
+0x40, 0x00, 0x80, 0x84, 0x00, 0x07, 0xc0, 0xc0, 0x30, 0x30, 0xf0, 0x60, 0xc0, 0x00, 0x80, 0x40, 
+0x01, 0xc0, 0x80, 0xd4, 0x00, 0x05, 0x20, 0x00, 0x44, 0x12, 0x08, 0x04, 0x88, 0x00, 0x18, 0x01, 
+0x00, 0x02, 0x04, 0x09, 0x12, 0x64, 0x88, 0x30, 0x80, 0x00, 0x00, 0x03, 0x06, 0x0c, 0x1a, 0x31, 
+0x60, 0x00, 0x0e, 0x09, 0x03, 0x80, 0x41, 0x37, 0xd2, 0x00, 0x03, 0x7f, 0x00, 0x3e, 0x80, 0x80, 
+0x00, 0x00, 0x38, 0x80, 0x44, 0x08, 0xbe, 0xfe, 0x68, 0xf8, 0xf0, 0x60, 0xe0, 0x00, 0x10, 0x82, 
+0x00, 0x02, 0x63, 0x00, 0xc1, 0x85, 0x00, 0x03, 0x03, 0x02, 0x02, 0x01, 0xd6, 0x00, 0x19, 0x03, 
+0x04, 0x11, 0x22, 0x08, 0x10, 0x80, 0x20, 0x00, 0x40, 0x40, 0x01, 0x03, 0x07, 0x05, 0x0d, 0x47, 
+0x07, 0x00, 0x80, 0x00, 0x08, 0x20, 0x11, 0x00, 0x02, 0xeb, 0x00, 0x01, 0x01, 0x01, 0xff, 0x00, 
+0xc0, 0x00, 0x01, 0xde, 0x00, 0x08, 0x40, 0xc0, 0x80, 0x00, 0xc0, 0xe0, 0xc0, 0x40, 0x40, 0x80, 
+0xc0, 0x01, 0x00, 0xe0, 0xef, 0x00, 0x0d, 0x80, 0xe0, 0x7f, 0x0f, 0x03, 0x00, 0x07, 0x06, 0x06, 
+0x03, 0x01, 0x03, 0x06, 0x03, 0xc5, 0x00, 0x00, 0x80, 0x81, 0x00, 0x04, 0x20, 0x80, 0x00, 0x00, 
+0x20, 0x8b, 0x00, 0x0b, 0xf0, 0xf0, 0x8c, 0x1e, 0x5c, 0x78, 0x30, 0x00, 0xa0, 0x20, 0x40, 0x80, 
+0x83, 0x00, 0x01, 0x01, 0x01, 0xcb, 0x00, 0x03, 0xc0, 0x10, 0x80, 0x20, 0x82, 0x00, 0x00, 0x80, 
+0x85, 0x00, 0x08, 0x01, 0x00, 0x02, 0x04, 0x09, 0x12, 0x44, 0x00, 0x60, 0x80, 0x00, 0x0c, 0x01, 
+0x03, 0x07, 0x0d, 0x60, 0x00, 0x00, 0x84, 0x80, 0x43, 0x00, 0x30, 0x06, 0xd2, 0x00, 0x02, 0x80, 
+0x00, 0x40, 0x81, 0x00, 0x0a, 0x38, 0x38, 0xf9, 0x90, 0xc0, 0x28, 0x90, 0xc0, 0x80, 0x20, 0x10, 
+0x83, 0x00, 0x03, 0x80, 0x1c, 0x00, 0x3e, 0x85, 0x00, 0x01, 0x01, 0x01, 0xd8, 0x00, 0x0b, 0x02, 
+0x08, 0x10, 0x24, 0x48, 0x10, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x0a, 0x40, 0x00, 
+0x00, 0x80, 0x10, 0x40, 0x04, 0x02, 0x08, 0x04, 0x01, 0xec, 0x00, 0x00, 0x01, 0xff, 0x00, 0xbf, 
+0x00, 0x01, 0xe6, 0x00, 0x00, 0x80, 0xf4, 0x00, 0x00, 0x80, 0xd4, 0x00, 0x00, 0x40, 0x80, 0x00, 
+0x09, 0x80, 0x00, 0x00, 0x80, 0xa0, 0x20, 0x00, 0x40, 0x40, 0x80, 0x87, 0x00, 0x0a, 0x82, 0x00, 
+0x52, 0x04, 0x08, 0x20, 0x00, 0x80, 0x20, 0x40, 0x80, 0x82, 0x00, 0x01, 0x01, 0x01, 0xcc, 0x00, 
+0x08, 0x60, 0x18, 0xc4, 0x12, 0x09, 0x04, 0x02, 0x00, 0x01, 0x86, 0x00, 0x08, 0x01, 0x00, 0x02, 
+0x04, 0x09, 0x32, 0xcc, 0x10, 0xc0, 0x82, 0x00, 0x09, 0x02, 0x7c, 0x80, 0x80, 0x12, 0x00, 0x02, 
+0x01, 0x18, 0x05, 0xd2, 0x00, 0x03, 0x7f, 0x80, 0x3f, 0xc0, 0x84, 0x00, 0x07, 0x40, 0x28, 0xa0, 
+0x70, 0x00, 0x70, 0x10, 0x40, 0x83, 0x00, 0x03, 0xe3, 0x00, 0xc1, 0x0c, 0xe1, 0x00, 0x0b, 0x01, 
+0x06, 0x09, 0x12, 0x24, 0x48, 0x10, 0xa0, 0x20, 0x01, 0x40, 0x40, 0x83, 0x00, 0x07, 0x20, 0x00, 
+0x10, 0x08, 0x24, 0x11, 0x08, 0x02, 0xed, 0x00, 0x00, 0x01, 0xff, 0x00, 0xbe, 0x00, 0x01, 0xff, 
+0x00, 0xd7, 0x00, 0x03, 0xf8, 0x38, 0x80, 0xf0, 0x86, 0x00, 0x02, 0xf0, 0xf0, 0x80, 0xc9, 0x00, 
+0x01, 0x80, 0x80, 0x80, 0xc0, 0x80, 0x60, 0x02, 0xe0, 0xe0, 0x60, 0x80, 0x40, 0x84, 0x00, 0x00, 
+0xc0, 0x80, 0xe0, 0x05, 0xbe, 0x7e, 0xce, 0x7c, 0x78, 0x60, 0x80, 0xe0, 0x12, 0xc4, 0x7e, 0xff, 
+0x04, 0xff, 0x7f, 0x06, 0x7c, 0x78, 0xfc, 0x7c, 0xfc, 0x0c, 0xfc, 0xf8, 0xff, 0x1f, 0x71, 0x40, 
+0xc2, 0x00, 0x0b, 0x80, 0xe0, 0xf8, 0x1c, 0x0e, 0xc7, 0xe3, 0x79, 0x9d, 0x8c, 0x8e, 0x87, 0x80, 
+0x83, 0x81, 0x01, 0x80, 0x00, 0x14, 0x04, 0x09, 0x3a, 0xfc, 0xdc, 0x79, 0xf3, 0xc7, 0x0e, 0x1d, 
+0x3e, 0xfc, 0x80, 0xc6, 0x97, 0x81, 0xc1, 0x41, 0x39, 0x03, 0x01, 0xd2, 0x00, 0x14, 0x7f, 0xff, 
+0xc0, 0x00, 0xff, 0xff, 0x01, 0x00, 0x01, 0x01, 0x11, 0x51, 0x71, 0x53, 0x61, 0x10, 0x00, 0x50, 
+0xd8, 0x98, 0x98, 0x81, 0x00, 0x0c, 0xff, 0xff, 0x0c, 0x01, 0xff, 0xff, 0x00, 0x00, 0x01, 0x03, 
+0x03, 0x01, 0x01, 0xd8, 0x00, 0x1d, 0x01, 0x07, 0x0e, 0x1d, 0x3f, 0x6e, 0x58, 0x91, 0x21, 0x01, 
+0x41, 0x01, 0x81, 0x83, 0x83, 0xc3, 0xc2, 0xc2, 0x63, 0x63, 0x30, 0xb8, 0x9e, 0xcf, 0xe3, 0x70, 
+0x38, 0x1e, 0x0f, 0x03, 0xe8, 0x00, 0x01, 0x01, 0x00, 0x81, 0x02, 0x02, 0x07, 0x06, 0x07, 0x81, 
+0x03, 0x01, 0x01, 0x01, 0xff, 0x00, 0xb0, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xb9, 0x00, 0x01, 
+0x80, 0x80, 0x81, 0x00, 0x00, 0x80, 0x83, 0x00, 0x00, 0xc0, 0x80, 0xe0, 0x02, 0xc0, 0x80, 0x00, 
+0x82, 0x80, 0xdb, 0x00, 0x23, 0x40, 0x00, 0x88, 0x24, 0x10, 0x00, 0x81, 0x84, 0x80, 0x80, 0x02, 
+0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x05, 0x0f, 0x3b, 0xf6, 0xc1, 
+0xd1, 0x00, 0x01, 0x5f, 0x1f, 0x13, 0x03, 0x07, 0x26, 0xd8, 0x00, 0x10, 0x01, 0x00, 0x02, 0x00, 
+0xc0, 0x00, 0x50, 0x51, 0x71, 0x33, 0x71, 0x50, 0x12, 0x17, 0x1b, 0x18, 0x98, 0x80, 0x00, 0x0e, 
+0x01, 0x03, 0x03, 0x00, 0x01, 0x00, 0x00, 0x71, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x01, 0xdc, 
+0x00, 0x16, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x04, 0x0d, 0x0e, 0x0a, 0x0c, 
+0x0c, 0x00, 0x80, 0x00, 0x40, 0x20, 0x90, 0x48, 0x22, 0xee, 0x00, 0x0b, 0x04, 0x05, 0x01, 0x00, 
+0x01, 0x05, 0x05, 0x00, 0x00, 0x02, 0x00, 0x01, 0xff, 0x00, 0xaf, 0x00, 0x01, 0xff, 0x00, 0xff, 
+0x00, 0xbb, 0x00, 0x81, 0x80, 0xee, 0x00, 0x08, 0x80, 0x20, 0x10, 0x48, 0x24, 0x12, 0x08, 0x01, 
+0x05, 0x80, 0x00, 0x01, 0x02, 0x02, 0x80, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x04, 0x81, 0x00, 
+0x06, 0x20, 0x30, 0x01, 0x00, 0x08, 0x28, 0x22, 0xdb, 0x00, 0x14, 0x06, 0x00, 0x8c, 0x01, 0x00, 
+0xe0, 0xf0, 0x10, 0x20, 0xe0, 0xc0, 0xa0, 0x72, 0x54, 0xf4, 0xe2, 0x60, 0xc0, 0x80, 0x00, 0x01, 
+0x81, 0x00, 0x02, 0xf8, 0x00, 0x8e, 0x81, 0x00, 0x01, 0x02, 0x02, 0xdb, 0x00, 0x06, 0x01, 0x00, 
+0x00, 0x04, 0x00, 0x00, 0x01, 0x80, 0x00, 0x11, 0x02, 0x06, 0x0f, 0x0f, 0x0e, 0x09, 0x03, 0x05, 
+0x07, 0x80, 0x00, 0x40, 0x20, 0x80, 0x44, 0x10, 0x0c, 0x01, 0xe8, 0x00, 0x03, 0x02, 0x00, 0x04, 
+0x01, 0x83, 0x00, 0x03, 0x05, 0x04, 0x00, 0x02, 0xff, 0x00, 0xb0, 0x00, 0x01, 0xe6, 0x00, 0x00, 
+0x80, 0xff, 0x00, 0xd3, 0x00, 0x81, 0x80, 0xf0, 0x00, 0x06, 0x10, 0x08, 0x24, 0x10, 0x00, 0x00, 
+0x05, 0x80, 0x00, 0x01, 0x02, 0x02, 0x80, 0x00, 0x09, 0x04, 0x01, 0x08, 0x02, 0x04, 0x40, 0x00, 
+0x00, 0x08, 0x04, 0x80, 0x00, 0x01, 0x20, 0x02, 0xde, 0x00, 0x08, 0x08, 0x01, 0x00, 0x00, 0x40, 
+0xe0, 0x90, 0x80, 0x20, 0x80, 0x60, 0x05, 0xe0, 0x91, 0xd0, 0x60, 0x60, 0xc0, 0x80, 0x00, 0x0b, 
+0x01, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0xe1, 0x00, 0x01, 0x01, 
+0x81, 0x81, 0x01, 0x0d, 0x03, 0x06, 0x06, 0x0d, 0x04, 0x06, 0x00, 0x00, 0x40, 0x20, 0x80, 0x40, 
+0x00, 0x08, 0xe9, 0x00, 0x03, 0x02, 0x00, 0x04, 0x01, 0x83, 0x00, 0x03, 0x05, 0x04, 0x00, 0x02, 
+0xff, 0x00, 0xb0, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xc4, 0x00, 0x08, 0x04, 0x00, 
+0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x30, 0x80, 0x00, 0x01, 0x80, 0x20, 0xda, 0x00, 0x00, 0x08, 
+0x82, 0x00, 0x0f, 0x60, 0x70, 0xf0, 0xf0, 0x70, 0x71, 0xa0, 0x80, 0xd0, 0x40, 0x00, 0xa0, 0x60, 
+0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x02, 0xef, 0x00, 0x80, 0x01, 0xff, 0x00, 0xff, 0x00, 0xb0, 
+0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xba, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x80, 0x84, 0x00, 
+0x01, 0xe0, 0xf0, 0x80, 0x30, 0x02, 0xf0, 0xc0, 0x80, 0xde, 0x00, 0x0e, 0x80, 0x20, 0x80, 0x40, 
+0x00, 0x02, 0x08, 0x01, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0x82, 0x00, 0x0f, 0x02, 0x00, 
+0x00, 0x0d, 0x3b, 0xff, 0xc4, 0x20, 0x20, 0x01, 0x25, 0x33, 0x33, 0xda, 0xf8, 0x20, 0x88, 0x00, 
+0x00, 0xfe, 0x81, 0x80, 0x00, 0x00, 0x81, 0x80, 0x05, 0x00, 0xe0, 0xfe, 0xfc, 0x20, 0x20, 0xbd, 
+0x00, 0x02, 0x06, 0x00, 0x8c, 0x87, 0x00, 0x0f, 0xe5, 0x90, 0x51, 0x50, 0xd0, 0xd0, 0x50, 0x52, 
+0x64, 0xc1, 0x00, 0x00, 0xfc, 0x00, 0xcf, 0x01, 0x83, 0x03, 0x85, 0x00, 0x12, 0x0c, 0x1f, 0x1b, 
+0x1d, 0x3e, 0x1f, 0x1f, 0x19, 0x1d, 0x0f, 0x0f, 0x19, 0x0f, 0x07, 0x0f, 0x18, 0x0f, 0x07, 0x07, 
+0xbf, 0x00, 0x03, 0x01, 0x00, 0x00, 0x04, 0x86, 0x00, 0x02, 0x03, 0x07, 0x07, 0x80, 0x06, 0x08, 
+0x86, 0x04, 0x06, 0x07, 0x00, 0x04, 0x10, 0x04, 0x01, 0xeb, 0x00, 0x01, 0x04, 0x01, 0x81, 0x00, 
+0x00, 0x05, 0x81, 0x00, 0x00, 0x01, 0xff, 0x00, 0xaf, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xba, 
+0x00, 0x00, 0x80, 0x80, 0x00, 0x01, 0x80, 0x80, 0x84, 0x00, 0x09, 0xe0, 0x00, 0xc8, 0xa8, 0x28, 
+0xe8, 0x38, 0x70, 0xc0, 0x80, 0xdc, 0x00, 0x00, 0x40, 0x86, 0x00, 0x00, 0x02, 0x80, 0x00, 0x14, 
+0x02, 0x00, 0x00, 0x04, 0x01, 0x08, 0x10, 0x24, 0x48, 0x11, 0x03, 0x0c, 0x3b, 0x82, 0x20, 0x00, 
+0x24, 0x00, 0x80, 0x19, 0x06, 0xd9, 0x00, 0x02, 0x01, 0x00, 0x02, 0x86, 0x00, 0x0f, 0x02, 0xc0, 
+0x61, 0xe2, 0x50, 0x50, 0x10, 0x06, 0x14, 0x01, 0x02, 0x80, 0x01, 0x00, 0x01, 0x30, 0xe1, 0x00, 
+0x08, 0x02, 0x08, 0x21, 0x40, 0x90, 0x20, 0x40, 0x00, 0x80, 0x81, 0x00, 0x0b, 0x03, 0x08, 0x09, 
+0x0a, 0x0a, 0x02, 0x00, 0x40, 0x02, 0x00, 0x0b, 0x22, 0xeb, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 
+0x01, 0x81, 0x00, 0x00, 0x04, 0xff, 0x00, 0xb4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xbb, 0x00, 
+0x80, 0x80, 0x87, 0x00, 0x08, 0xf0, 0xf8, 0x68, 0xe0, 0x04, 0xf4, 0xec, 0x38, 0x60, 0xe7, 0x00, 
+0x80, 0x02, 0x80, 0x00, 0x12, 0x01, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x40, 0x03, 0x06, 0x45, 
+0x81, 0x11, 0x00, 0x20, 0x84, 0x40, 0x29, 0x0e, 0xd7, 0x00, 0x00, 0x70, 0x89, 0x00, 0x00, 0x04, 
+0x81, 0x00, 0x07, 0x40, 0x00, 0x12, 0x88, 0x80, 0x00, 0x80, 0x02, 0xe4, 0x00, 0x03, 0x04, 0x10, 
+0x02, 0x08, 0x87, 0x00, 0x0c, 0x08, 0x08, 0x0a, 0x0e, 0x07, 0x05, 0x45, 0x05, 0x06, 0x03, 0x00, 
+0x00, 0x02, 0xe7, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x04, 0x01, 0x82, 0x00, 0x00, 0x01, 0xff, 
+0x00, 0xb4, 0x00, 0x01, 0xe6, 0x00, 0x00, 0x80, 0xff, 0x00, 0xe2, 0x00, 0x07, 0xd0, 0x08, 0xe4, 
+0x14, 0x00, 0x80, 0x10, 0xc0, 0xf5, 0x00, 0x09, 0x01, 0x38, 0x00, 0x10, 0x21, 0x00, 0x20, 0x84, 
+0x50, 0x01, 0x8d, 0x00, 0x00, 0x80, 0xd4, 0x00, 0x02, 0x81, 0x40, 0xa0, 0x80, 0x00, 0x04, 0x04, 
+0x02, 0x0a, 0x20, 0xc0, 0xf2, 0x00, 0x06, 0x03, 0x04, 0x04, 0x05, 0x01, 0x02, 0x02, 0xff, 0x00, 
+0xff, 0x00, 0xaf, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xca, 0x00, 0x09, 0x20, 0xf0, 0xf8, 0xd8, 
+0xfc, 0x18, 0x90, 0x20, 0xc0, 0x80, 0xd9, 0x00, 0x08, 0xc0, 0x20, 0x90, 0x48, 0x24, 0x12, 0x08, 
+0x01, 0x05, 0x87, 0x00, 0x13, 0x02, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x03, 0x7f, 0xf1, 
+0x21, 0x27, 0xab, 0x03, 0x80, 0xf0, 0xfc, 0x78, 0x30, 0xd4, 0x00, 0x03, 0x70, 0x03, 0x00, 0x06, 
+0x87, 0x00, 0x0e, 0x08, 0x00, 0xa0, 0xa0, 0xe0, 0xc0, 0xc0, 0x40, 0x10, 0x80, 0xc0, 0x02, 0xf0, 
+0x01, 0xf8, 0x80, 0x00, 0x00, 0x01, 0x83, 0x03, 0xd7, 0x00, 0x03, 0x06, 0x10, 0x23, 0x08, 0x86, 
+0x00, 0x0d, 0x02, 0x02, 0x03, 0x02, 0x03, 0x01, 0x81, 0x01, 0x41, 0x21, 0x88, 0x66, 0x10, 0x06, 
+0xf3, 0x00, 0x04, 0x05, 0x04, 0x00, 0x02, 0x01, 0xff, 0x00, 0xaf, 0x00, 0x00, 0xff, 0xff, 0xb6, 
+0xff, 0x03, 0x3f, 0x0f, 0x1f, 0x7f, 0xf8, 0xff, 0x0b, 0x87, 0xc0, 0xfa, 0xf8, 0xc0, 0x87, 0xf1, 
+0xf5, 0xb5, 0x95, 0xc7, 0xef, 0xf0, 0xff, 0x09, 0x7f, 0x1f, 0x0f, 0xc7, 0xe7, 0xf3, 0xf1, 0xf9, 
+0xf9, 0xf8, 0x82, 0xfc, 0x08, 0xf9, 0xf9, 0xf1, 0xf3, 0xe3, 0xc7, 0x8f, 0x1f, 0x3f, 0x88, 0xff, 
+0x01, 0x7f, 0x7f, 0xd6, 0xff, 0x03, 0x9f, 0x01, 0x00, 0xfe, 0x85, 0xff, 0x80, 0x73, 0x81, 0x7f, 
+0x02, 0xe7, 0xe3, 0xf7, 0x80, 0xff, 0x02, 0xf8, 0x00, 0x03, 0x83, 0xff, 0x0a, 0xc3, 0x01, 0x00, 
+0x00, 0xf0, 0xf0, 0xe0, 0xc3, 0x8f, 0x1f, 0x3f, 0xd1, 0xff, 0x05, 0xf8, 0xe0, 0x87, 0x0f, 0x3f, 
+0x7f, 0x81, 0xff, 0x02, 0xfc, 0xf8, 0xf8, 0x82, 0xfc, 0x08, 0xfe, 0xff, 0x7f, 0x3f, 0x1f, 0x8f, 
+0xc1, 0xf0, 0xfc, 0x83, 0xff, 0x03, 0xfd, 0xf0, 0xf0, 0xe3, 0x80, 0xe7, 0x03, 0xe3, 0xf0, 0xf8, 
+0xfe, 0xd5, 0xff, 0x06, 0xfe, 0xfe, 0xfc, 0xf8, 0xf9, 0xf9, 0xf1, 0x81, 0xf3, 0x06, 0xf1, 0xf9, 
+0xf9, 0xf8, 0xfc, 0xfc, 0xfe, 0xbb, 0xff, 0x00, 0xfe, 0xd0, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 
+0xff, 0x00, 0xff, 0x00, 0xc4, 0x00, 0x10, 0x06, 0x0c, 0x38, 0xf0, 0x70, 0x38, 0x7e, 0xfe, 0x8c, 
+0x8c, 0xcc, 0xf8, 0x30, 0x7c, 0xc0, 0xfc, 0x3c, 0xdb, 0x00, 0x04, 0x20, 0x00, 0x40, 0x00, 0x10, 
+0x86, 0x00, 0x0a, 0x05, 0x00, 0xc8, 0x72, 0x02, 0x27, 0x49, 0x10, 0x20, 0x80, 0x00, 0x80, 0x01, 
+0x83, 0x00, 0x01, 0x80, 0x80, 0xd6, 0x00, 0x03, 0x60, 0x02, 0x00, 0x02, 0x85, 0x00, 0x03, 0x8c, 
+0x90, 0x90, 0x80, 0x80, 0x00, 0x02, 0x80, 0x04, 0x08, 0x80, 0x00, 0x02, 0x06, 0x00, 0x02, 0x83, 
+0x00, 0x0a, 0x24, 0x02, 0x01, 0x81, 0x10, 0x10, 0x20, 0x42, 0x90, 0x60, 0xc0, 0xd1, 0x00, 0x06, 
+0x04, 0x10, 0x46, 0x80, 0x20, 0x40, 0x80, 0x80, 0x00, 0x07, 0x03, 0x07, 0x07, 0x3d, 0x3c, 0x32, 
+0x1f, 0x0c, 0x80, 0x00, 0x05, 0x40, 0x00, 0x00, 0x02, 0x10, 0x04, 0x83, 0x00, 0x05, 0x0d, 0x10, 
+0x16, 0x2c, 0x28, 0x28, 0xda, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x08, 0x0a, 0x02, 
+0x00, 0x02, 0x08, 0xff, 0x00, 0xb3, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb0, 0x00, 
+0x09, 0x80, 0x40, 0x10, 0x08, 0x20, 0x04, 0x12, 0x0a, 0x08, 0x01, 0x83, 0x05, 0x02, 0x00, 0x08, 
+0x02, 0xe9, 0x00, 0x03, 0x04, 0x00, 0x0c, 0x01, 0x84, 0x00, 0x08, 0x08, 0x04, 0x04, 0x00, 0x80, 
+0x80, 0x18, 0x00, 0x80, 0x82, 0x00, 0x02, 0xe0, 0x00, 0xf0, 0x82, 0x00, 0x08, 0x20, 0x00, 0x02, 
+0x00, 0x00, 0x20, 0x41, 0x86, 0x20, 0xd3, 0x00, 0x00, 0x02, 0x89, 0x00, 0x0e, 0x02, 0x01, 0x02, 
+0x2d, 0x12, 0x0e, 0x03, 0x80, 0x00, 0x20, 0x90, 0x44, 0x20, 0x08, 0x01, 0x81, 0x00, 0x07, 0x06, 
+0x10, 0x00, 0x28, 0x00, 0x40, 0x00, 0x20, 0x80, 0x00, 0x00, 0x01, 0xd8, 0x00, 0x0f, 0x04, 0x01, 
+0x00, 0x0a, 0x0a, 0x02, 0x00, 0x02, 0x0a, 0x0a, 0x08, 0x01, 0x05, 0x00, 0x02, 0x01, 0xff, 0x00, 
+0xac, 0x00, 0x01, 0xff, 0x00, 0xdc, 0x00, 0x02, 0xf8, 0xf8, 0x20, 0xfa, 0x00, 0x05, 0x7f, 0xff, 
+0x00, 0xfc, 0xf0, 0x78, 0x80, 0xcc, 0x00, 0x48, 0xca, 0x00, 0x09, 0x80, 0xc0, 0x70, 0xd0, 0x68, 
+0x24, 0x14, 0x12, 0x0a, 0x08, 0x84, 0x00, 0x08, 0x0a, 0x12, 0x04, 0x20, 0x68, 0xd8, 0x70, 0xe0, 
+0x80, 0xe1, 0x00, 0x05, 0xf0, 0xfe, 0xe7, 0xfe, 0x0f, 0x01, 0x81, 0x00, 0x05, 0x30, 0x30, 0x38, 
+0x10, 0x18, 0x18, 0x80, 0x00, 0x0a, 0x80, 0x80, 0x98, 0x00, 0x00, 0x01, 0x0f, 0xfe, 0xe7, 0xfe, 
+0xf0, 0x84, 0x00, 0x00, 0x10, 0xc8, 0x00, 0x06, 0xc0, 0xc0, 0xe0, 0x60, 0x70, 0x30, 0x78, 0x80, 
+0xf8, 0x0d, 0xf0, 0xb0, 0xb0, 0xc0, 0xc0, 0x81, 0x8f, 0xbe, 0x77, 0xde, 0xb0, 0x60, 0xc0, 0x80, 
+0x81, 0x00, 0x10, 0x18, 0x1c, 0x22, 0x20, 0x3d, 0x37, 0x1b, 0x0f, 0x83, 0xc0, 0x60, 0xb0, 0xde, 
+0x77, 0x3c, 0x0f, 0x01, 0xd0, 0x00, 0x03, 0x07, 0x07, 0x0e, 0x1c, 0x80, 0x18, 0x07, 0x36, 0x3f, 
+0x3f, 0x1f, 0x1d, 0x1f, 0x0f, 0x0f, 0x80, 0x07, 0x08, 0x03, 0x01, 0x01, 0x03, 0x02, 0x05, 0x01, 
+0x08, 0x0a, 0x83, 0x00, 0x06, 0x0a, 0x08, 0x01, 0x05, 0x02, 0x03, 0x01, 0xff, 0x00, 0xac, 0x00, 
+0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xa9, 0x00, 0x0d, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0c, 
+0x8e, 0xc6, 0xf6, 0x36, 0x1f, 0x1f, 0x0f, 0x09, 0x80, 0x00, 0x0c, 0x0a, 0x1a, 0x1e, 0x3e, 0xf6, 
+0xc6, 0x8c, 0xdc, 0x40, 0x20, 0x70, 0xe0, 0x80, 0xdd, 0x00, 0x09, 0xfc, 0xff, 0x07, 0x00, 0x00, 
+0x60, 0x80, 0xce, 0x2f, 0x31, 0x83, 0x00, 0x03, 0x30, 0x30, 0x08, 0x28, 0x80, 0x30, 0x0a, 0x00, 
+0x03, 0xe7, 0xe6, 0x60, 0x00, 0x00, 0x01, 0x0f, 0xff, 0xf8, 0x83, 0x00, 0x0a, 0x78, 0xc4, 0x10, 
+0x92, 0x60, 0x21, 0x41, 0x86, 0x38, 0xc0, 0x80, 0xb4, 0x00, 0x24, 0x38, 0xfc, 0xec, 0xce, 0x06, 
+0x06, 0x07, 0xdf, 0xff, 0xff, 0xee, 0xfe, 0xfc, 0x20, 0x20, 0x00, 0xa0, 0xb0, 0xb0, 0x78, 0xf8, 
+0xf8, 0xfb, 0xef, 0x8e, 0xc0, 0x20, 0x00, 0x01, 0x8f, 0xa3, 0x46, 0x9e, 0xa7, 0xb3, 0x3e, 0x1e, 
+0x81, 0x00, 0x0e, 0x18, 0x1c, 0x9e, 0xde, 0xee, 0x7e, 0x19, 0x07, 0x80, 0xc0, 0xe0, 0x70, 0x3e, 
+0x0f, 0x03, 0x82, 0x00, 0x0b, 0x04, 0x19, 0x20, 0x2e, 0x41, 0x50, 0x00, 0x08, 0x25, 0x13, 0x08, 
+0x07, 0xb6, 0x00, 0x04, 0x01, 0x01, 0x03, 0x03, 0x06, 0x83, 0x07, 0x25, 0x04, 0x04, 0x0f, 0x1d, 
+0x19, 0x18, 0x18, 0x36, 0x3f, 0x3f, 0x1f, 0x1d, 0x1f, 0x0f, 0x0e, 0x04, 0x04, 0x01, 0x05, 0x0f, 
+0x0d, 0x0f, 0x0f, 0x0a, 0x0a, 0x00, 0x0a, 0x0a, 0x0b, 0x0f, 0x0f, 0x0d, 0x0c, 0x06, 0x06, 0x07, 
+0x03, 0x01, 0xff, 0x00, 0xae, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xa6, 0x00, 0x07, 
+0x80, 0xc0, 0xe0, 0xb0, 0xd0, 0x68, 0x24, 0x10, 0x82, 0x00, 0x0d, 0x01, 0x0d, 0x0f, 0x0b, 0x1a, 
+0x1e, 0x3e, 0x7c, 0xfc, 0xd8, 0xb8, 0xf0, 0xc0, 0x80, 0xe0, 0x00, 0x0d, 0xf0, 0xfe, 0x7f, 0x1f, 
+0x9f, 0x07, 0x80, 0x80, 0xe0, 0xf0, 0x30, 0x30, 0x00, 0x30, 0x84, 0x00, 0x80, 0x30, 0x06, 0x33, 
+0x2f, 0xfe, 0xf3, 0xff, 0xfe, 0x60, 0x83, 0x00, 0x00, 0xe0, 0x80, 0xf0, 0x0a, 0xf8, 0xf8, 0x80, 
+0x0c, 0xec, 0x7e, 0x1e, 0x3e, 0x7e, 0xf8, 0xc0, 0xa9, 0x00, 0x19, 0x30, 0x78, 0x7c, 0x6c, 0xce, 
+0xc6, 0xc6, 0xcc, 0x9e, 0x9e, 0xbe, 0x8e, 0xfc, 0xc4, 0xfc, 0xec, 0xce, 0x06, 0x06, 0x07, 0xdf, 
+0xff, 0xff, 0xee, 0xfe, 0xfc, 0x80, 0xe0, 0x14, 0xc0, 0xc0, 0x80, 0x03, 0x1f, 0x7e, 0xf5, 0xd8, 
+0xb3, 0x69, 0xd9, 0xf1, 0xa1, 0x31, 0x27, 0x00, 0x60, 0x7b, 0x3b, 0x3e, 0x1e, 0x81, 0x00, 0x07, 
+0x80, 0xc0, 0x70, 0xbe, 0xff, 0x7b, 0x1f, 0x07, 0x82, 0x00, 0x11, 0x3e, 0x7e, 0xe7, 0xc3, 0x81, 
+0xc1, 0xc0, 0xe7, 0x60, 0x00, 0x31, 0x70, 0x60, 0x70, 0x38, 0x1d, 0x0f, 0x07, 0xaf, 0x00, 0x83, 
+0x01, 0x06, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x06, 0x83, 0x07, 0x01, 0x03, 0x03, 0x80, 0x01, 
+0x82, 0x00, 0x03, 0x01, 0x03, 0x07, 0x06, 0x80, 0x0f, 0x05, 0x1a, 0x1e, 0x16, 0x14, 0x14, 0x10, 
+0x81, 0x00, 0x04, 0x01, 0x04, 0x02, 0x03, 0x01, 0xff, 0x00, 0xb4, 0x00, 0x01, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xaa, 0x00, 0x00, 0x08, 0x8b, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x80, 0xe3, 
+0x00, 0x05, 0x08, 0x00, 0xb0, 0x20, 0x20, 0x00, 0x81, 0x80, 0x01, 0x00, 0x30, 0x8a, 0x00, 0x02, 
+0x20, 0x00, 0x10, 0x84, 0x00, 0x02, 0xc0, 0xe0, 0x10, 0x80, 0x00, 0x03, 0x08, 0x08, 0xf8, 0xf0, 
+0xb0, 0x00, 0x0d, 0xd0, 0x88, 0x84, 0xf4, 0x52, 0x4a, 0x5a, 0x50, 0x00, 0x20, 0x02, 0x02, 0x00, 
+0x04, 0x8f, 0x00, 0x0f, 0x04, 0x00, 0x02, 0x06, 0x03, 0x01, 0x07, 0x2f, 0x27, 0x37, 0x2f, 0x25, 
+0x22, 0x02, 0x1c, 0x08, 0x86, 0x00, 0x02, 0x41, 0x00, 0x02, 0x82, 0x00, 0x0b, 0x7c, 0xfe, 0xf8, 
+0xf9, 0x64, 0x42, 0x41, 0x06, 0x3f, 0x9c, 0x7f, 0x3f, 0xb2, 0x00, 0x82, 0x01, 0x01, 0x00, 0x00, 
+0x80, 0x02, 0xa6, 0x00, 0x00, 0x04, 0x8a, 0x00, 0x81, 0x01, 0xff, 0x00, 0xa7, 0x00, 0x01, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xa7, 0x00, 0x08, 0x20, 0x90, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 
+0x08, 0x81, 0x00, 0x08, 0x02, 0x00, 0x00, 0x04, 0x20, 0x40, 0x90, 0x20, 0x40, 0xe4, 0x00, 0x04, 
+0x04, 0x01, 0x08, 0x02, 0x80, 0x85, 0x00, 0x00, 0x10, 0x86, 0x00, 0x04, 0x01, 0x04, 0xc0, 0x06, 
+0xe0, 0x83, 0x00, 0x02, 0xc0, 0x20, 0x10, 0x80, 0x00, 0x02, 0x08, 0x00, 0xf0, 0xb4, 0x00, 0x00, 
+0x40, 0x80, 0x00, 0x07, 0x04, 0x00, 0xa0, 0x82, 0x80, 0x50, 0x00, 0x80, 0x8f, 0x00, 0x06, 0x08, 
+0x20, 0x04, 0x10, 0x4c, 0x94, 0x26, 0x80, 0x2e, 0x05, 0x26, 0x26, 0x24, 0x24, 0x38, 0x10, 0x82, 
+0x00, 0x06, 0x80, 0x40, 0x20, 0x88, 0x00, 0x18, 0x01, 0x81, 0x00, 0x0a, 0x3c, 0x00, 0x10, 0x01, 
+0x04, 0x02, 0x41, 0x01, 0x28, 0x80, 0x47, 0xb3, 0x00, 0x00, 0x01, 0x81, 0x00, 0x80, 0x02, 0x97, 
+0x00, 0x01, 0x01, 0x02, 0x80, 0x00, 0x03, 0x02, 0x00, 0x00, 0x04, 0x80, 0x00, 0x08, 0x04, 0x10, 
+0x00, 0x02, 0x08, 0x01, 0x00, 0x02, 0x01, 0xff, 0x00, 0xb6, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 
+0xff, 0x00, 0xa5, 0x00, 0x09, 0x80, 0x40, 0x00, 0x00, 0x08, 0x20, 0x14, 0x00, 0x02, 0x0a, 0x82, 
+0x00, 0x03, 0x0a, 0x00, 0x00, 0x04, 0xe8, 0x00, 0x06, 0xf0, 0x02, 0xe0, 0xc4, 0x01, 0x00, 0x80, 
+0x8f, 0x00, 0x02, 0x08, 0x01, 0x08, 0x84, 0x00, 0x03, 0x20, 0x10, 0x00, 0x00, 0x80, 0x08, 0x00, 
+0x10, 0xb3, 0x00, 0x0e, 0xe0, 0x10, 0x48, 0x20, 0x04, 0x10, 0x04, 0x00, 0x02, 0x02, 0x00, 0xf0, 
+0x00, 0x84, 0x20, 0x8d, 0x00, 0x08, 0x03, 0x00, 0x00, 0x88, 0x00, 0x08, 0x00, 0x20, 0x00, 0x81, 
+0x10, 0x80, 0x00, 0x01, 0x28, 0x10, 0x83, 0x00, 0x03, 0x10, 0x46, 0x20, 0x04, 0x81, 0x00, 0x0b, 
+0x1c, 0x42, 0x82, 0x29, 0x44, 0x02, 0x41, 0x00, 0x2e, 0x90, 0x02, 0x38, 0xb3, 0x00, 0x00, 0x01, 
+0x87, 0x00, 0x01, 0x02, 0x01, 0x97, 0x00, 0x02, 0x02, 0x00, 0x00, 0x81, 0x14, 0x05, 0x10, 0x00, 
+0x02, 0x08, 0x01, 0x04, 0x8a, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0xff, 0x00, 0xa7, 0x00, 
+0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xa8, 0x00, 0x05, 0x40, 0x00, 0x04, 0x00, 0x00, 0x08, 
+0x83, 0x00, 0x03, 0x08, 0x00, 0x00, 0x04, 0xe8, 0x00, 0x06, 0x08, 0x00, 0x10, 0x02, 0x00, 0x00, 
+0x40, 0x83, 0x00, 0x00, 0x40, 0x87, 0x00, 0x01, 0x02, 0x10, 0x8c, 0x00, 0x01, 0x08, 0x10, 0xb4, 
+0x00, 0x0e, 0xe0, 0x30, 0x48, 0x20, 0x00, 0x10, 0x04, 0xa4, 0xa6, 0x02, 0x33, 0x63, 0x3b, 0xde, 
+0x7c, 0x8d, 0x00, 0x0b, 0x10, 0x01, 0x00, 0x20, 0x00, 0x18, 0x18, 0x28, 0x18, 0x18, 0x10, 0x10, 
+0x81, 0x00, 0x00, 0x10, 0x82, 0x00, 0x04, 0x20, 0x80, 0x01, 0x10, 0x02, 0x81, 0x00, 0x0a, 0x1c, 
+0x42, 0x00, 0x20, 0x44, 0x02, 0x01, 0x00, 0x0c, 0x00, 0x02, 0xb5, 0x00, 0x00, 0x01, 0x80, 0x00, 
+0x81, 0x02, 0x9b, 0x00, 0x00, 0x02, 0x89, 0x00, 0x01, 0x02, 0x01, 0x88, 0x00, 0x00, 0x01, 0xff, 
+0x00, 0xab, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xb3, 0x00, 0x83, 0x80, 0xeb, 0x00, 0x09, 0x80, 
+0xc0, 0xe0, 0xf0, 0xd8, 0x64, 0x10, 0x00, 0x08, 0x00, 0x80, 0x05, 0x0e, 0x07, 0x07, 0x0f, 0x0d, 
+0x0d, 0x1b, 0x3b, 0x73, 0xe6, 0xce, 0x9c, 0x38, 0x70, 0xe0, 0xc0, 0x9b, 0x00, 0x02, 0xfe, 0xe0, 
+0x70, 0xab, 0x00, 0x02, 0x80, 0x80, 0xb0, 0x80, 0xf8, 0x02, 0x38, 0xf0, 0xe0, 0x87, 0x00, 0x08, 
+0xf8, 0xfe, 0x0f, 0x01, 0x3f, 0x3f, 0xa1, 0x60, 0x60, 0x80, 0x00, 0x12, 0x30, 0x90, 0xd0, 0xf0, 
+0xd0, 0x98, 0x98, 0x1c, 0x1c, 0x3c, 0x3e, 0xee, 0xc5, 0x1f, 0xfe, 0xf0, 0x01, 0xff, 0xfe, 0x81, 
+0x00, 0x03, 0xe0, 0xf0, 0x10, 0x10, 0x81, 0x08, 0x04, 0xf0, 0xf0, 0x1e, 0x1b, 0x1b, 0x82, 0x1e, 
+0x0e, 0x18, 0x1f, 0x1f, 0x1b, 0x1b, 0x1e, 0x18, 0x3f, 0x07, 0x1c, 0x0c, 0x1f, 0x17, 0x13, 0x18, 
+0x9c, 0x00, 0x12, 0xc0, 0xf0, 0xb8, 0x9c, 0x8c, 0x98, 0x98, 0xa6, 0x41, 0x78, 0xee, 0xf6, 0xc7, 
+0x65, 0x19, 0x1c, 0x0e, 0x0f, 0x07, 0x87, 0x00, 0x07, 0x03, 0x1f, 0x3e, 0xf0, 0xc3, 0x8f, 0x1e, 
+0x78, 0x80, 0xf0, 0x02, 0xb8, 0x38, 0x38, 0x80, 0x39, 0x80, 0x01, 0x19, 0x03, 0x03, 0x02, 0x63, 
+0xb3, 0xdf, 0x7f, 0x39, 0x1e, 0x0f, 0x01, 0x00, 0x00, 0x3c, 0xfe, 0xdb, 0x39, 0x65, 0x06, 0x43, 
+0x62, 0xbf, 0xbc, 0xff, 0x7f, 0x30, 0xb3, 0x00, 0x84, 0x01, 0x80, 0x03, 0x00, 0x01, 0x92, 0x00, 
+0x0a, 0x01, 0x03, 0x03, 0x07, 0x06, 0x0c, 0x0d, 0x0d, 0x0f, 0x0f, 0x0b, 0x80, 0x0a, 0x06, 0x08, 
+0x01, 0x04, 0x00, 0x02, 0x01, 0x01, 0x88, 0x00, 0x02, 0x01, 0x01, 0x00, 0x80, 0x01, 0xff, 0x00, 
+0xa5, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xb3, 0x00, 0x83, 0x80, 0xee, 0x00, 0x09, 0x40, 0x20, 
+0x88, 0x24, 0x10, 0x02, 0x08, 0x05, 0x04, 0x00, 0x82, 0x02, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 
+0x10, 0x20, 0x08, 0x10, 0xcd, 0x00, 0x0b, 0x40, 0x60, 0xc0, 0x88, 0x88, 0xce, 0x06, 0xcf, 0xfe, 
+0xde, 0xfc, 0x78, 0x88, 0x00, 0x1b, 0x03, 0x00, 0x66, 0x60, 0x70, 0x10, 0x18, 0x18, 0x0c, 0xe0, 
+0x00, 0x00, 0x08, 0x10, 0x10, 0x84, 0x84, 0xa4, 0x0e, 0xde, 0x20, 0xc6, 0x06, 0x00, 0x01, 0x70, 
+0x01, 0xf8, 0x82, 0x00, 0x08, 0x60, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x80, 0x90, 0x00, 
+0x00, 0x04, 0xa5, 0x00, 0x0d, 0x3e, 0x7f, 0x60, 0x7e, 0x3c, 0x35, 0x1f, 0x1f, 0x1a, 0x0d, 0x0c, 
+0x04, 0x03, 0x01, 0x89, 0x00, 0x05, 0x02, 0x08, 0x01, 0x40, 0x90, 0x20, 0x81, 0x00, 0x01, 0x01, 
+0x01, 0x80, 0x00, 0x0b, 0x01, 0x03, 0x02, 0x83, 0x80, 0x42, 0x20, 0x90, 0x48, 0x22, 0x10, 0x06, 
+0x81, 0x00, 0x0a, 0x04, 0x02, 0x08, 0x40, 0x04, 0x02, 0x41, 0x02, 0x20, 0x80, 0x40, 0xda, 0x00, 
+0x03, 0x02, 0x00, 0x00, 0x01, 0x81, 0x00, 0x06, 0x01, 0x05, 0x04, 0x00, 0x02, 0x00, 0x01, 0x88, 
+0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01, 0xff, 0x00, 0xa4, 0x00, 0x01, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xa8, 0x00, 0x0b, 0x80, 0xc0, 0xf0, 0xf8, 0xfc, 0x7c, 0x3e, 0x1e, 0x1b, 0x0f, 
+0x0f, 0x0d, 0x81, 0x05, 0x09, 0x0d, 0x0b, 0x0a, 0x12, 0x14, 0x20, 0x08, 0x10, 0x00, 0x80, 0xcb, 
+0x00, 0x0d, 0x40, 0x00, 0x80, 0x48, 0x68, 0x0e, 0x06, 0x07, 0x21, 0xc1, 0x73, 0x86, 0xfe, 0x38, 
+0x86, 0x00, 0x1c, 0xfc, 0x3f, 0xfb, 0xff, 0x13, 0x11, 0x18, 0x18, 0x0c, 0x04, 0xfe, 0x14, 0x28, 
+0x38, 0x98, 0x88, 0xa8, 0xa8, 0x10, 0x50, 0x86, 0x00, 0x08, 0x00, 0x00, 0x8e, 0xf0, 0x06, 0xf8, 
+0x82, 0x00, 0x01, 0x20, 0x20, 0x82, 0x10, 0x00, 0x80, 0xbb, 0x00, 0x03, 0x07, 0x0e, 0x0e, 0x0f, 
+0x80, 0x05, 0x81, 0x00, 0x01, 0x02, 0x01, 0x88, 0x00, 0x07, 0x01, 0x07, 0x10, 0x07, 0x80, 0x00, 
+0x40, 0x80, 0x80, 0x00, 0x1e, 0x01, 0x00, 0x02, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01, 0x87, 0xc3, 
+0xe1, 0xf0, 0xfc, 0xff, 0x7b, 0x1f, 0x07, 0x00, 0x00, 0x40, 0x04, 0x33, 0x88, 0x80, 0x84, 0x82, 
+0x46, 0x20, 0x00, 0x90, 0xd8, 0x00, 0x07, 0x01, 0x02, 0x00, 0x05, 0x0d, 0x0a, 0x0a, 0x1a, 0x81, 
+0x1e, 0x00, 0x1b, 0x80, 0x0f, 0x03, 0x07, 0x07, 0x03, 0x01, 0x84, 0x00, 0x07, 0x01, 0x02, 0x02, 
+0x00, 0x02, 0x02, 0x00, 0x01, 0xff, 0x00, 0xa3, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
+0xab, 0x00, 0x08, 0xc0, 0x20, 0x90, 0x50, 0x68, 0x2c, 0x14, 0x14, 0x16, 0x81, 0x0a, 0x09, 0x02, 
+0x14, 0x14, 0x04, 0x28, 0x48, 0x90, 0x20, 0x40, 0x80, 0xcb, 0x00, 0x03, 0x80, 0x20, 0x10, 0xc8, 
+0x80, 0x20, 0x08, 0x00, 0x4f, 0x7f, 0x7f, 0x86, 0x86, 0xc0, 0xf0, 0x40, 0x85, 0x00, 0x04, 0xc0, 
+0x04, 0x01, 0x0c, 0x02, 0x80, 0x00, 0x13, 0x04, 0x08, 0xe2, 0x74, 0x70, 0xd0, 0xd0, 0xf0, 0xf0, 
+0xa0, 0xe0, 0x64, 0xca, 0x02, 0x00, 0x01, 0x02, 0x00, 0x00, 0x08, 0x84, 0x00, 0x80, 0x20, 0x01, 
+0x60, 0xe0, 0xbd, 0x00, 0x03, 0x01, 0x03, 0x02, 0x02, 0x80, 0x00, 0x07, 0x04, 0x05, 0x0d, 0x0f, 
+0x0f, 0x07, 0x03, 0x01, 0x87, 0x00, 0x04, 0x10, 0x40, 0x00, 0x20, 0x80, 0x81, 0x00, 0x1e, 0x06, 
+0x0e, 0x0d, 0x0f, 0x0f, 0x0d, 0x0f, 0x0f, 0x1b, 0x1f, 0x1c, 0x0f, 0x80, 0x40, 0x20, 0x8c, 0x60, 
+0x08, 0x00, 0xf0, 0x88, 0xc7, 0xc2, 0x00, 0x00, 0x04, 0x1c, 0x78, 0x00, 0xff, 0xe0, 0xd8, 0x00, 
+0x07, 0x02, 0x04, 0x05, 0x08, 0x02, 0x14, 0x14, 0x04, 0x81, 0x28, 0x08, 0x2c, 0x14, 0x14, 0x16, 
+0x0a, 0x09, 0x04, 0x02, 0x01, 0x81, 0x00, 0x02, 0x01, 0x03, 0x06, 0x80, 0x05, 0x02, 0x04, 0x00, 
+0x02, 0xff, 0x00, 0xa4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xac, 0x00, 0x07, 0x40, 
+0x20, 0xa0, 0x10, 0x40, 0x28, 0x28, 0x00, 0x82, 0x14, 0x04, 0x00, 0x20, 0x28, 0x40, 0x10, 0xd0, 
+0x00, 0x05, 0xc0, 0xe0, 0x10, 0xc8, 0xa8, 0x20, 0x80, 0x00, 0x01, 0x10, 0x08, 0x80, 0x00, 0x00, 
+0x40, 0x86, 0x00, 0x04, 0x08, 0x02, 0x10, 0x04, 0x01, 0x80, 0x00, 0x02, 0x06, 0x08, 0x8a, 0x82, 
+0xc0, 0x09, 0x80, 0x80, 0x08, 0x10, 0x04, 0x00, 0x00, 0x04, 0x00, 0x02, 0x83, 0x00, 0x05, 0x40, 
+0x40, 0x00, 0x00, 0x40, 0x80, 0xc0, 0x00, 0x02, 0x01, 0x01, 0x02, 0x82, 0x00, 0x01, 0x0a, 0x08, 
+0x8c, 0x00, 0x01, 0x10, 0x40, 0x81, 0x00, 0x03, 0xc0, 0xc7, 0xef, 0xee, 0x81, 0xec, 0x0d, 0x6c, 
+0x79, 0xd9, 0x9f, 0x0e, 0x00, 0x80, 0x40, 0x10, 0x80, 0x30, 0xe0, 0x00, 0xc6, 0x81, 0x00, 0x03, 
+0x0c, 0xe0, 0x00, 0x7f, 0xd9, 0x00, 0x08, 0x01, 0x00, 0x00, 0x08, 0x12, 0x14, 0x21, 0x29, 0x29, 
+0x82, 0x01, 0x10, 0x29, 0x29, 0x21, 0x14, 0x12, 0x09, 0x04, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 
+0x04, 0x09, 0x0a, 0x0a, 0xff, 0x00, 0xa8, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xac, 
+0x00, 0x06, 0x80, 0x40, 0x40, 0xa0, 0x90, 0x50, 0x40, 0x84, 0x28, 0x04, 0x08, 0x40, 0x10, 0x80, 
+0x20, 0xd1, 0x00, 0x0f, 0xe0, 0xf0, 0xb0, 0x38, 0xc8, 0x88, 0xf8, 0x38, 0xa8, 0xa4, 0x04, 0x0c, 
+0xfc, 0xbc, 0xfc, 0xf8, 0x83, 0x00, 0x05, 0x70, 0x0c, 0xe3, 0x08, 0x06, 0x01, 0x80, 0x00, 0x02, 
+0x0e, 0xee, 0xe0, 0x83, 0x00, 0x09, 0x0c, 0x1c, 0x08, 0x00, 0x00, 0x04, 0x00, 0x80, 0x08, 0xc0, 
+0x84, 0x00, 0x00, 0x40, 0xc4, 0x00, 0x0d, 0x01, 0x03, 0x03, 0x04, 0x01, 0x01, 0x0b, 0x19, 0x18, 
+0x18, 0x1e, 0x0f, 0x07, 0x03, 0x84, 0x00, 0x03, 0x10, 0x00, 0x18, 0x40, 0x81, 0x00, 0x03, 0xc0, 
+0xc0, 0xe1, 0xe1, 0x81, 0xe0, 0x0d, 0x60, 0x20, 0x80, 0xc0, 0x60, 0x60, 0x20, 0x80, 0x60, 0x0f, 
+0x40, 0x1f, 0x00, 0x09, 0x81, 0x00, 0x03, 0x30, 0x00, 0x00, 0x80, 0xdf, 0x00, 0x05, 0x09, 0x0f, 
+0x4f, 0x4e, 0x4e, 0x5a, 0x80, 0x5b, 0x0d, 0x4f, 0x07, 0x26, 0x24, 0x12, 0x09, 0x04, 0x02, 0x01, 
+0x00, 0x02, 0x04, 0x09, 0x02, 0x83, 0x00, 0x00, 0x01, 0xff, 0x00, 0xa3, 0x00, 0x01, 0xff, 0x00, 
+0xff, 0x00, 0xff, 0x00, 0xcc, 0x00, 0x00, 0x01, 0xc6, 0x00, 0x06, 0xe0, 0x00, 0x48, 0x80, 0x00, 
+0x00, 0x20, 0x80, 0x00, 0x02, 0x40, 0x00, 0xf8, 0x8d, 0x00, 0x01, 0xe0, 0xe0, 0x90, 0x00, 0x80, 
+0x80, 0x02, 0xc0, 0x80, 0x80, 0x85, 0x00, 0x00, 0x01, 0xbe, 0x00, 0x02, 0x08, 0x00, 0x16, 0x82, 
+0x00, 0x01, 0x04, 0x02, 0x8b, 0x00, 0x06, 0x40, 0xc0, 0xc0, 0xc1, 0xc1, 0xc0, 0x80, 0x80, 0x00, 
+0x05, 0xc0, 0x80, 0x80, 0xa0, 0x20, 0x60, 0x81, 0x00, 0x02, 0x20, 0x10, 0xc1, 0x80, 0x00, 0x04, 
+0x08, 0x20, 0x00, 0x07, 0xc0, 0xe0, 0x00, 0x07, 0x02, 0x00, 0x01, 0x01, 0x11, 0x10, 0x10, 0x14, 
+0x80, 0x00, 0x00, 0x04, 0x83, 0x00, 0x05, 0x03, 0x06, 0x09, 0x02, 0x00, 0x02, 0x80, 0x00, 0x00, 
+0x02, 0xff, 0x00, 0xa4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x97, 0x00, 
+0x02, 0x20, 0x00, 0x04, 0x83, 0x00, 0x00, 0x58, 0xf2, 0x00, 0x02, 0x08, 0x00, 0x04, 0x93, 0x00, 
+0x01, 0x80, 0x80, 0x80, 0x00, 0x00, 0x40, 0x80, 0x00, 0x05, 0xc0, 0x00, 0x00, 0x80, 0x00, 0x20, 
+0x81, 0x00, 0x0a, 0xc0, 0xe0, 0x7e, 0xff, 0xff, 0x6f, 0x6f, 0xff, 0x3f, 0x78, 0xc0, 0xe0, 0x00, 
+0x0b, 0x0c, 0x00, 0x11, 0x11, 0x15, 0x11, 0x11, 0x14, 0x14, 0x04, 0x00, 0x02, 0x84, 0x00, 0x09, 
+0x1f, 0x98, 0xf1, 0xf2, 0xf0, 0xfe, 0xff, 0x3c, 0x3e, 0x06, 0xf4, 0x00, 0x80, 0x03, 0x01, 0x01, 
+0x01, 0xa9, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xad, 0x00, 0x07, 0x80, 0x00, 0x00, 
+0x20, 0x80, 0x10, 0x50, 0x40, 0x82, 0x00, 0x06, 0x40, 0x10, 0x00, 0x20, 0x00, 0x40, 0x80, 0xd2, 
+0x00, 0x0c, 0xe0, 0xf0, 0xb0, 0xd8, 0x38, 0x2c, 0xcc, 0xcc, 0x44, 0x64, 0x64, 0x04, 0xa0, 0x83, 
+0x00, 0x06, 0x80, 0x10, 0x04, 0x11, 0x00, 0x02, 0x01, 0x8b, 0x00, 0x03, 0x01, 0x02, 0x04, 0x01, 
+0xd2, 0x00, 0x0a, 0x03, 0x06, 0x10, 0x00, 0x20, 0x29, 0x25, 0x20, 0x10, 0x0c, 0x02, 0x84, 0x00, 
+0x02, 0x08, 0x00, 0x07, 0x81, 0x00, 0x03, 0x60, 0x20, 0x20, 0xa0, 0x80, 0x80, 0x80, 0x00, 0x0d, 
+0x40, 0xa0, 0xa0, 0x20, 0x20, 0x40, 0x00, 0x80, 0x10, 0x80, 0x20, 0x00, 0x80, 0x40, 0xe1, 0x00, 
+0x16, 0x04, 0x08, 0x12, 0x04, 0x20, 0x00, 0x50, 0x10, 0x00, 0x80, 0xa0, 0xa4, 0x84, 0x05, 0x05, 
+0x51, 0x40, 0x00, 0x24, 0x12, 0x09, 0x04, 0x02, 0x80, 0x00, 0x02, 0x80, 0x00, 0x01, 0x80, 0x00, 
+0x02, 0x42, 0x00, 0x09, 0xf7, 0x00, 0x00, 0x02, 0xaa, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xae, 0x00, 0x0e, 0x80, 0x40, 0x00, 0x20, 0x80, 0x00, 0x10, 0x50, 0x40, 0x00, 0x40, 0x50, 
+0x10, 0x00, 0x80, 0xd9, 0x00, 0x0a, 0x20, 0x00, 0x10, 0x40, 0x00, 0x88, 0x00, 0x00, 0x40, 0x00, 
+0xe0, 0x83, 0x00, 0x06, 0x20, 0x08, 0x62, 0x09, 0x04, 0x02, 0x01, 0x8e, 0x00, 0x02, 0x40, 0x00, 
+0x20, 0xd0, 0x00, 0x0a, 0x01, 0x10, 0x00, 0x00, 0x01, 0x08, 0x01, 0x00, 0x10, 0x04, 0x01, 0x83, 
+0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x20, 0x80, 0x40, 0x80, 0xa0, 0x00, 0x80, 0x80, 0x00, 0x80, 
+0x40, 0x06, 0x50, 0x10, 0x00, 0x00, 0x60, 0x00, 0x40, 0x80, 0x00, 0x05, 0x20, 0xa0, 0xa0, 0x20, 
+0x40, 0x80, 0xdb, 0x00, 0x00, 0x04, 0x81, 0x00, 0x1d, 0x40, 0x02, 0x09, 0x88, 0x28, 0x08, 0x08, 
+0x28, 0xa8, 0x88, 0x0e, 0x19, 0x49, 0x08, 0x04, 0x12, 0x08, 0x04, 0x01, 0x18, 0x00, 0xe0, 0x00, 
+0x02, 0x02, 0x08, 0x09, 0x06, 0x40, 0x01, 0xf3, 0x00, 0x00, 0x03, 0xae, 0x00, 0x01, 0xff, 0x00, 
+0xff, 0x00, 0xde, 0x00, 0x00, 0x10, 0xd0, 0x00, 0x08, 0x40, 0x00, 0x20, 0x80, 0x00, 0x00, 0x10, 
+0x50, 0x10, 0xdd, 0x00, 0x0a, 0xc0, 0xe0, 0x60, 0xf0, 0xb0, 0xb0, 0x18, 0x18, 0x38, 0x78, 0xe0, 
+0x83, 0x00, 0x03, 0x40, 0x00, 0x84, 0x10, 0x80, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x03, 0x02, 0x04, 
+0x01, 0x22, 0xd3, 0x00, 0x0b, 0xf3, 0xe0, 0xc0, 0xca, 0xc7, 0xcf, 0xe6, 0x66, 0x3e, 0x3e, 0x1f, 
+0x02, 0x82, 0x00, 0x02, 0x40, 0x00, 0x20, 0x81, 0x00, 0x80, 0x20, 0x03, 0xf8, 0x78, 0x60, 0x80, 
+0x80, 0x00, 0x04, 0x20, 0x20, 0x38, 0x28, 0x30, 0x80, 0x00, 0x06, 0x0e, 0x80, 0x1f, 0x00, 0x80, 
+0x40, 0x40, 0xce, 0x00, 0x81, 0x01, 0x89, 0x00, 0x09, 0x01, 0x00, 0x08, 0x12, 0x04, 0x00, 0x00, 
+0x02, 0x07, 0x27, 0x82, 0x06, 0x14, 0x26, 0x86, 0x06, 0x17, 0x00, 0x20, 0x00, 0x01, 0x00, 0x02, 
+0x90, 0x80, 0x00, 0x00, 0x02, 0x01, 0x11, 0x10, 0x88, 0x00, 0x30, 0xf2, 0x00, 0x00, 0x03, 0x81, 
+0x00, 0x00, 0x02, 0xaa, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0x00, 0x80, 
+0x89, 0x00, 0x00, 0x20, 0xdb, 0x00, 0x85, 0x80, 0x85, 0x00, 0x03, 0x10, 0x00, 0x00, 0x08, 0x8d, 
+0x00, 0x03, 0x02, 0x04, 0x01, 0x02, 0xd3, 0x00, 0x0b, 0xfc, 0xff, 0xff, 0xfd, 0xf1, 0xf1, 0xf9, 
+0x79, 0x39, 0x3f, 0x1f, 0x02, 0x8b, 0x00, 0x02, 0x10, 0x20, 0xa8, 0x89, 0x00, 0x00, 0x80, 0x82, 
+0x00, 0x04, 0x80, 0x80, 0x40, 0x40, 0x80, 0xcb, 0x00, 0x05, 0xc1, 0xf1, 0xf9, 0xff, 0xfe, 0xce, 
+0x81, 0xcc, 0x02, 0xd8, 0xf8, 0x38, 0x80, 0x00, 0x0a, 0x01, 0x00, 0x08, 0x10, 0x04, 0x08, 0x00, 
+0x00, 0x80, 0x00, 0x02, 0x81, 0x00, 0x04, 0x02, 0x20, 0x02, 0x00, 0x40, 0x82, 0x00, 0x0a, 0x98, 
+0xa2, 0x01, 0x01, 0x00, 0x06, 0x22, 0x22, 0x14, 0x81, 0x02, 0xca, 0x00, 0x01, 0x03, 0x03, 0x80, 
+0x07, 0x80, 0x03, 0x01, 0x01, 0x01, 0x9b, 0x00, 0x82, 0x04, 0x03, 0x02, 0x02, 0x01, 0x01, 0xa7, 
+0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0x00, 0x80, 0x8b, 0x00, 0x00, 0x40, 
+0xe8, 0x00, 0x04, 0x40, 0x10, 0x84, 0x00, 0x08, 0x90, 0x00, 0x02, 0x20, 0x08, 0x20, 0xe2, 0x00, 
+0x02, 0x40, 0x00, 0x20, 0x86, 0x00, 0x00, 0x80, 0x83, 0x00, 0x01, 0x20, 0x20, 0x80, 0x00, 0x03, 
+0x80, 0x0e, 0x80, 0x1f, 0x81, 0x00, 0x01, 0x80, 0x80, 0xcc, 0x00, 0x06, 0xc0, 0x30, 0x08, 0x06, 
+0x02, 0x62, 0x50, 0x80, 0x54, 0x02, 0x60, 0x08, 0xc8, 0x81, 0x00, 0x12, 0x04, 0x00, 0x02, 0x20, 
+0x00, 0x10, 0x00, 0x00, 0x02, 0x00, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x00, 0x40, 0x81, 
+0x00, 0x0c, 0x02, 0x10, 0x3c, 0x1e, 0x06, 0xe7, 0xe3, 0xdb, 0x1b, 0x1f, 0x0e, 0xdc, 0xc0, 0xca, 
+0x00, 0x03, 0x04, 0x01, 0x08, 0x08, 0x80, 0x04, 0x02, 0x00, 0x02, 0x01, 0x9a, 0x00, 0x0c, 0x07, 
+0x07, 0x04, 0x08, 0x39, 0x7b, 0xfb, 0xf8, 0xfe, 0xff, 0xff, 0xfb, 0xe1, 0xa3, 0x00, 0x01, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0x05, 0x80, 0x00, 0x40, 0x00, 0x20, 0x80, 0x86, 0x00, 
+0x00, 0x40, 0xe8, 0x00, 0x08, 0xc0, 0x10, 0x84, 0x22, 0x09, 0x04, 0x02, 0x00, 0x01, 0x8a, 0x00, 
+0x05, 0x04, 0x01, 0x22, 0x88, 0x30, 0x80, 0xe1, 0x00, 0x03, 0x73, 0x00, 0x3f, 0x80, 0x82, 0x00, 
+0x01, 0x10, 0x08, 0x85, 0x00, 0x08, 0x20, 0x00, 0x10, 0x00, 0x00, 0x80, 0x3f, 0x80, 0x7f, 0xd3, 
+0x00, 0x0a, 0x20, 0x00, 0x04, 0x00, 0x10, 0x10, 0x14, 0x44, 0x40, 0x20, 0x08, 0x81, 0x00, 0x0c, 
+0x01, 0x04, 0x08, 0x12, 0x24, 0x08, 0x10, 0x00, 0x00, 0x02, 0x05, 0x01, 0x01, 0x80, 0x04, 0x0c, 
+0x06, 0xa4, 0x00, 0x50, 0x08, 0x24, 0x12, 0x08, 0x06, 0x01, 0x00, 0x00, 0x08, 0x80, 0x28, 0x04, 
+0x68, 0x08, 0x10, 0x20, 0x40, 0xcb, 0x00, 0x07, 0x01, 0x08, 0x08, 0x00, 0x00, 0x04, 0x00, 0x02, 
+0x9d, 0x00, 0x05, 0x04, 0x10, 0x02, 0x08, 0x08, 0x0a, 0x81, 0x00, 0x01, 0x11, 0xc0, 0xa2, 0x00, 
+0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb3, 0x00, 0x02, 0x20, 0x80, 0x10, 0x83, 0x50, 0x06, 
+0xf0, 0xf0, 0xb0, 0xe0, 0xe0, 0xc0, 0x80, 0xe5, 0x00, 0x07, 0xe0, 0x38, 0xcc, 0x72, 0x08, 0x04, 
+0x00, 0x01, 0x88, 0x00, 0x09, 0x01, 0x03, 0x03, 0x0e, 0x1d, 0x7f, 0xfe, 0x7c, 0xf0, 0x80, 0xdf, 
+0x00, 0x05, 0x0c, 0xff, 0xe0, 0x7f, 0xf0, 0x80, 0x81, 0x00, 0x02, 0x30, 0x00, 0x30, 0x83, 0x00, 
+0x02, 0x28, 0x48, 0x30, 0x80, 0x00, 0x04, 0xc0, 0x7f, 0x87, 0x7f, 0x0f, 0xd2, 0x00, 0x0a, 0x08, 
+0x04, 0x04, 0x20, 0x00, 0x40, 0x10, 0x14, 0x64, 0x04, 0xf0, 0x81, 0x00, 0x12, 0x03, 0x07, 0x0f, 
+0x1b, 0x37, 0x7c, 0x78, 0xd8, 0xfe, 0xb9, 0xad, 0xa1, 0xa5, 0xb8, 0xa2, 0xa0, 0xb8, 0x14, 0x50, 
+0x80, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x01, 0x18, 0x08, 0x3c, 0x3c, 0x2c, 0x68, 0x08, 0x18, 0x20, 
+0x40, 0xcb, 0x00, 0x03, 0x08, 0x0a, 0x08, 0x08, 0x80, 0x00, 0x01, 0x01, 0x01, 0x9c, 0x00, 0x0b, 
+0x04, 0x18, 0x22, 0x4c, 0x88, 0x8e, 0x00, 0x00, 0x80, 0x87, 0x88, 0xe0, 0xa2, 0x00, 0x01, 0xff, 
+0x00, 0xba, 0x00, 0x83, 0xc0, 0x80, 0x80, 0xea, 0x00, 0x0a, 0x80, 0xe0, 0x78, 0x1c, 0x0e, 0x86, 
+0x80, 0x02, 0x00, 0x00, 0x01, 0x82, 0x00, 0x08, 0x21, 0x01, 0x01, 0x03, 0x07, 0x0e, 0x18, 0x30, 
+0xc0, 0xe3, 0x00, 0x1b, 0x18, 0xff, 0xff, 0x00, 0x00, 0x80, 0x63, 0x33, 0x78, 0x9c, 0x9c, 0x54, 
+0x14, 0x0e, 0x2e, 0x2e, 0x3a, 0x3e, 0x3f, 0x7f, 0x67, 0xe0, 0xc0, 0x80, 0x00, 0x80, 0xfe, 0xff, 
+0xe2, 0x00, 0x07, 0xc1, 0xf7, 0x62, 0x33, 0x77, 0x61, 0xe1, 0xc0, 0x80, 0x80, 0x81, 0x00, 0x80, 
+0x80, 0x09, 0xc0, 0xc0, 0xe0, 0x71, 0x3b, 0x1b, 0x01, 0xff, 0xf0, 0x80, 0xd4, 0x00, 0x07, 0x80, 
+0xc0, 0xc0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x82, 0x00, 0x03, 0x1f, 0xff, 0xf0, 0x80, 0x81, 0x00, 
+0x02, 0x01, 0x31, 0x31, 0x82, 0x03, 0x03, 0x01, 0x31, 0x71, 0x20, 0x81, 0x00, 0x08, 0x80, 0x78, 
+0x9f, 0x7f, 0x30, 0x70, 0xe0, 0xe0, 0x80, 0xcc, 0x00, 0x0a, 0xe0, 0xf6, 0x07, 0x07, 0xe3, 0x74, 
+0x34, 0x34, 0x30, 0x03, 0xc3, 0x84, 0x00, 0x21, 0x01, 0x07, 0x0f, 0x0c, 0x18, 0x38, 0x3e, 0x7f, 
+0x6f, 0x63, 0x63, 0x7e, 0x64, 0x64, 0x7c, 0x74, 0x30, 0x30, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x66, 
+0x07, 0x04, 0xfc, 0xcc, 0xe2, 0x27, 0x07, 0xc7, 0xfc, 0xc0, 0xc9, 0x00, 0x08, 0x03, 0x07, 0x0f, 
+0x0e, 0x0c, 0x0c, 0x04, 0x04, 0x02, 0x9e, 0x00, 0x0b, 0x02, 0x04, 0x11, 0x32, 0x77, 0x62, 0xe0, 
+0xe0, 0x7f, 0x7c, 0x78, 0x20, 0xa2, 0x00, 0x01, 0xff, 0x00, 0xb4, 0x00, 0x01, 0x80, 0x80, 0x80, 
+0x00, 0x00, 0x60, 0x81, 0xa0, 0x05, 0x20, 0x00, 0x40, 0x40, 0x00, 0x80, 0xe7, 0x00, 0x0c, 0x80, 
+0xe0, 0x78, 0xfc, 0x76, 0x1b, 0x8d, 0x07, 0x00, 0x02, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x81, 
+0x80, 0x81, 0x00, 0x01, 0x20, 0xc0, 0xe3, 0x00, 0x15, 0x7f, 0xe7, 0x3f, 0xff, 0x00, 0x00, 0x61, 
+0x12, 0x2a, 0x44, 0x80, 0x8a, 0x52, 0x3e, 0x20, 0x10, 0x11, 0x05, 0x01, 0x08, 0x08, 0x07, 0x80, 
+0x00, 0x03, 0xe1, 0x78, 0xf2, 0xff, 0xe1, 0x00, 0x1e, 0x01, 0x06, 0x09, 0x02, 0x04, 0x00, 0x00, 
+0x01, 0x00, 0x40, 0x40, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 0xe0, 0xb0, 0xf0, 0xd8, 0x6e, 
+0xf7, 0xff, 0x7f, 0x33, 0x60, 0xe0, 0xc0, 0xc0, 0xd1, 0x00, 0x08, 0x80, 0x40, 0x20, 0x20, 0x90, 
+0xd0, 0xf8, 0x30, 0x60, 0x8a, 0x00, 0x02, 0x01, 0x00, 0x00, 0x80, 0x02, 0x01, 0x03, 0x03, 0x80, 
+0x01, 0x80, 0x00, 0x0a, 0x07, 0x7f, 0xfc, 0x78, 0x10, 0x96, 0xcf, 0x8f, 0x1f, 0x2f, 0x80, 0xcd, 
+0x00, 0x0a, 0x08, 0xf0, 0xf0, 0x80, 0x07, 0x07, 0x06, 0x00, 0x00, 0x40, 0x78, 0x9a, 0x00, 0x09, 
+0x67, 0xfc, 0xff, 0xf3, 0xc3, 0xf9, 0xfc, 0xff, 0x3f, 0x1c, 0xcd, 0x00, 0x06, 0x03, 0x03, 0x02, 
+0x02, 0x06, 0x02, 0x01, 0x9d, 0x00, 0x04, 0x01, 0x03, 0x0f, 0x0e, 0x0f, 0x80, 0x1f, 0xa6, 0x00, 
+0x00, 0xff, 0xff, 0xb4, 0xff, 0x00, 0x7f, 0x81, 0x3f, 0x81, 0x9f, 0x81, 0x3f, 0x01, 0x7f, 0x7f, 
+0xe8, 0xff, 0x07, 0x1f, 0x0f, 0xc3, 0xf1, 0xf8, 0xfc, 0x3e, 0x3e, 0x85, 0xff, 0x09, 0x7f, 0x4f, 
+0x4e, 0x7e, 0xfc, 0xf8, 0xf1, 0xc3, 0x07, 0x1f, 0xe2, 0xff, 0x02, 0xc1, 0x00, 0x1e, 0x81, 0xff, 
+0x0e, 0x8e, 0x82, 0x93, 0x81, 0xc1, 0xc9, 0xe1, 0xe4, 0xe4, 0xf0, 0xf0, 0xf2, 0xf3, 0xf8, 0xfc, 
+0x80, 0xff, 0x02, 0x3f, 0x00, 0xc0, 0xe2, 0xff, 0x09, 0xfe, 0xf8, 0xf0, 0xe3, 0xc7, 0x8f, 0x9f, 
+0x1f, 0x3f, 0x3f, 0x83, 0x7f, 0x0d, 0x3f, 0x3f, 0x1f, 0x9f, 0x8f, 0xc7, 0xe3, 0xf0, 0x38, 0x1e, 
+0x8f, 0xcf, 0x1f, 0x1f, 0x80, 0x7f, 0xd1, 0xff, 0x08, 0x3f, 0x1f, 0x0f, 0x4f, 0x67, 0xe3, 0xe7, 
+0x07, 0x0f, 0x89, 0xff, 0x83, 0xfe, 0x85, 0xff, 0x09, 0xf0, 0x80, 0x07, 0x07, 0x0f, 0x09, 0x00, 
+0x42, 0x00, 0x18, 0xcf, 0xff, 0x80, 0xf8, 0x00, 0xc0, 0x80, 0x00, 0x03, 0x01, 0x00, 0x80, 0xc3, 
+0x9a, 0xff, 0x80, 0xfe, 0x80, 0xfc, 0xb4, 0xff, 0x00, 0xfe, 0xd0, 0xff, 0x00, 0xfe, 0x9c, 0xff, 
+0x01, 0xff, 0x00, 0xb3, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 
+0x00, 0x02, 0x40, 0x00, 0x80, 0xe7, 0x00, 0x08, 0xc0, 0x10, 0xcc, 0x22, 0x09, 0x04, 0x80, 0x00, 
+0x01, 0x85, 0x00, 0x09, 0x10, 0x01, 0x00, 0x82, 0x04, 0x09, 0x12, 0xc4, 0x18, 0x60, 0xe1, 0x00, 
+0x03, 0x0c, 0xc1, 0x00, 0xe1, 0x80, 0x00, 0x15, 0xf0, 0x8c, 0xb1, 0x92, 0x00, 0x08, 0x08, 0x21, 
+0x08, 0x0c, 0x10, 0x16, 0x14, 0x03, 0x00, 0x03, 0x00, 0x00, 0xc0, 0x3f, 0x80, 0x3f, 0xe2, 0x00, 
+0x07, 0x02, 0x08, 0x13, 0x24, 0x48, 0x10, 0x80, 0x20, 0x84, 0x00, 0x11, 0x40, 0x00, 0x00, 0x80, 
+0x10, 0x48, 0x24, 0x12, 0xc8, 0x26, 0x91, 0x40, 0x40, 0x00, 0x20, 0x00, 0x00, 0x80, 0xd2, 0x00, 
+0x04, 0x10, 0x00, 0x48, 0x00, 0x10, 0x8b, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x84, 0x00, 
+0x0a, 0x01, 0x30, 0x00, 0x84, 0x00, 0x02, 0x08, 0x02, 0xc2, 0x08, 0x65, 0xd9, 0x00, 0x00, 0x02, 
+0x9c, 0x00, 0x03, 0x02, 0x00, 0x00, 0x02, 0xff, 0x00, 0xa6, 0x00, 0x00, 0xff, 0xff, 0xb6, 0xff, 
+0x83, 0x7f, 0xee, 0xff, 0x09, 0x3f, 0x0f, 0x87, 0xe3, 0xf3, 0xf1, 0x79, 0x7c, 0xfc, 0xfc, 0x82, 
+0xfe, 0x09, 0xfc, 0xfc, 0x1c, 0x19, 0x71, 0xe3, 0xc7, 0x87, 0x1f, 0x3f, 0xe3, 0xff, 0x02, 0x00, 
+0x00, 0xfe, 0x81, 0xff, 0x02, 0x7e, 0x3e, 0x3f, 0x84, 0x9f, 0x02, 0x3f, 0x7e, 0xfe, 0x81, 0xff, 
+0x02, 0xfe, 0x00, 0x01, 0xe2, 0xff, 0x08, 0xfc, 0xf0, 0xe1, 0x87, 0x1f, 0x3f, 0x38, 0x62, 0xe7, 
+0x82, 0xcf, 0x11, 0xdf, 0x9f, 0x8f, 0x80, 0x08, 0x40, 0x3f, 0x1f, 0x8f, 0xc7, 0xe1, 0x30, 0x1e, 
+0xcf, 0xcf, 0x8f, 0x1f, 0x3f, 0x80, 0x7f, 0xd1, 0xff, 0x03, 0x3f, 0x1f, 0x07, 0x47, 0x80, 0xf3, 
+0x01, 0x03, 0x0f, 0x83, 0xff, 0x01, 0xfe, 0xfe, 0x80, 0xfc, 0x00, 0xf8, 0x80, 0xf9, 0x00, 0xf8, 
+0x80, 0xfc, 0x01, 0xfe, 0xfe, 0x81, 0xff, 0x09, 0xf8, 0xc0, 0x81, 0x83, 0x07, 0x09, 0x01, 0x02, 
+0x00, 0x08, 0xd0, 0xff, 0x81, 0xf8, 0x80, 0x80, 0x03, 0x10, 0x00, 0x80, 0xe3, 0x9a, 0xff, 0x01, 
+0xfe, 0xfe, 0x80, 0xfc, 0xb5, 0xff, 0x00, 0xfe, 0xd0, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x00, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xff, 0x03, 0x7f, 0x3f, 0x3f, 0x1f, 0x80, 0x9f, 0x02, 0x8f, 
+0xcf, 0x8f, 0x80, 0x9f, 0x03, 0x1f, 0x3f, 0x3f, 0x7f, 0x87, 0xff, 0x00, 0x7f, 0x80, 0x3f, 0xd2, 
+0xff, 0x00, 0x3f, 0x80, 0x1f, 0x09, 0x7f, 0x7f, 0xff, 0x3f, 0x0f, 0x83, 0xe1, 0xf8, 0xfc, 0xfe, 
+0x8a, 0xff, 0x06, 0xfe, 0xfe, 0xfc, 0xf0, 0xc3, 0x07, 0x1f, 0x80, 0xff, 0x07, 0xc3, 0x00, 0x10, 
+0x78, 0x38, 0x18, 0x80, 0xc3, 0xcf, 0xff, 0x1c, 0xf3, 0xe0, 0xe0, 0xc6, 0xcc, 0xc8, 0xc0, 0xc1, 
+0xc0, 0x00, 0x3f, 0xff, 0xff, 0xf9, 0xf9, 0xbb, 0x9b, 0x1b, 0x53, 0x5b, 0x5f, 0x5f, 0x1f, 0x1f, 
+0x13, 0x33, 0x73, 0x73, 0xf3, 0x80, 0xff, 0x03, 0x7f, 0x00, 0x80, 0xf9, 0x81, 0xff, 0x80, 0xfe, 
+0xdb, 0xff, 0x09, 0xfe, 0xfc, 0xf0, 0xf1, 0xe7, 0xc7, 0x8f, 0x9f, 0x9e, 0x1e, 0x82, 0x3e, 0x09, 
+0x1e, 0x9e, 0x9e, 0x8e, 0xcf, 0xc7, 0xe3, 0xf1, 0xf8, 0xfe, 0xc1, 0xff, 0x00, 0xfe, 0xd0, 0xff, 
+0x00, 0xfe, 0x9c, 0xff, 0x00, 0xd6, 0xff, 0x07, 0x1f, 0x0f, 0xe7, 0xf7, 0xf3, 0xff, 0xbf, 0x0f, 
+0x80, 0xe7, 0x0b, 0x0f, 0x0f, 0x1f, 0x0f, 0xcf, 0xcf, 0x1f, 0x33, 0xf0, 0x00, 0xfb, 0xfb, 0xe6, 
+0xff, 0x06, 0xfc, 0xf8, 0xf9, 0xfb, 0xfb, 0xf9, 0xff, 0x81, 0xfc, 0x09, 0xfe, 0xf8, 0xfc, 0xf8, 
+0xff, 0xff, 0xfc, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xc2, 0xff, 0x01, 0x7f, 0x7f, 0x86, 0x3f, 0x01, 
+0x7f, 0x7f, 0x87, 0xff, 0x00, 0x7f, 0x81, 0x3f, 0xd3, 0xff, 0x0f, 0x1f, 0x0f, 0x0f, 0x1f, 0x3f, 
+0x7f, 0xff, 0x3f, 0x0f, 0x87, 0xe3, 0xf1, 0xf8, 0xfc, 0xfe, 0xfe, 0x85, 0xff, 0x08, 0xfe, 0xfe, 
+0xfc, 0xfc, 0xf8, 0xf1, 0xc3, 0x0f, 0x1f, 0x81, 0xff, 0x06, 0xc0, 0x80, 0x18, 0x3c, 0x3c, 0x00, 
+0x81, 0xd0, 0xff, 0x09, 0xf9, 0xf0, 0xe0, 0xe6, 0xc4, 0xcc, 0xc0, 0xc1, 0x00, 0x00, 0x81, 0xff, 
+0x04, 0xf7, 0xf7, 0x37, 0x17, 0x97, 0x81, 0x9f, 0x02, 0x37, 0x37, 0x77, 0x80, 0xf7, 0x80, 0xff, 
+0x02, 0x7f, 0x00, 0x80, 0xe2, 0xff, 0x08, 0xfe, 0xf8, 0xf0, 0xe3, 0xc7, 0x8f, 0x1f, 0x3f, 0x3f, 
+0x85, 0x7c, 0x08, 0x38, 0x3c, 0x1f, 0x9f, 0x8f, 0xc7, 0xe1, 0xf8, 0xfc, 0xc1, 0xff, 0x00, 0xfe, 
+0xa7, 0xff, 0x86, 0xfe, 0x9d, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 0xdc, 0x00, 0x00, 0x20, 0x89, 
+0x00, 0x00, 0x10, 0xe9, 0x00, 0x00, 0x02, 0xff, 0x00, 0xd8, 0x00, 0x00, 0x40, 0x83, 0x00, 0x03, 
+0x40, 0x40, 0x00, 0x80, 0x87, 0x00, 0x03, 0x40, 0x00, 0x20, 0x20, 0xd3, 0x00, 0x00, 0xc0, 0x8b, 
+0x00, 0x03, 0x02, 0x00, 0x01, 0x01, 0x81, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x02, 0x00, 0x05, 0x09, 
+0x12, 0x44, 0x10, 0x20, 0x80, 0x00, 0x07, 0x1e, 0x00, 0x00, 0x04, 0x00, 0x20, 0x80, 0x40, 0xd4, 
+0x00, 0x12, 0x20, 0x08, 0x00, 0xc0, 0x00, 0x7e, 0x00, 0x00, 0x80, 0x80, 0xd0, 0xd0, 0x10, 0x20, 
+0x20, 0x28, 0x00, 0x00, 0x20, 0x80, 0x04, 0x01, 0x84, 0x04, 0x81, 0x00, 0x02, 0x67, 0x00, 0x43, 
+0xe2, 0x00, 0x09, 0x02, 0x08, 0x11, 0x24, 0x47, 0x9d, 0x38, 0x18, 0x58, 0x1b, 0x82, 0x9b, 0x06, 
+0x33, 0x33, 0x7e, 0x3c, 0x17, 0x9e, 0x0c, 0xee, 0x00, 0x02, 0x01, 0x01, 0x00, 0x83, 0x02, 0x02, 
+0x00, 0x00, 0x01, 0xbc, 0x00, 0x01, 0xe9, 0x00, 0x00, 0x10, 0xff, 0x00, 0xff, 0x00, 0xc4, 0x00, 
+0x00, 0x40, 0x80, 0x00, 0x04, 0x40, 0x40, 0x00, 0x00, 0x80, 0x87, 0x00, 0x00, 0x80, 0x81, 0x00, 
+0x00, 0x40, 0xd2, 0x00, 0x01, 0x20, 0x10, 0x8e, 0x00, 0x0e, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 
+0x02, 0x00, 0x04, 0x00, 0x00, 0x20, 0x88, 0x00, 0x40, 0x80, 0x00, 0x07, 0x01, 0x00, 0x08, 0x00, 
+0x00, 0x10, 0x00, 0x22, 0xd0, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x00, 0x00, 0x20, 0x20, 0x01, 0x00, 
+0x80, 0x00, 0x00, 0x80, 0x80, 0x80, 0xc0, 0x0b, 0xd0, 0xc0, 0xc8, 0xe0, 0xe0, 0xc0, 0x4c, 0xcc, 
+0x8c, 0xb4, 0x34, 0x08, 0x80, 0x00, 0x02, 0x18, 0x00, 0x24, 0xe2, 0x00, 0x07, 0x04, 0x00, 0x22, 
+0x00, 0x1f, 0x03, 0x07, 0x43, 0x83, 0x01, 0x07, 0x09, 0xa1, 0x0b, 0x06, 0x01, 0x29, 0x16, 0x0c, 
+0x80, 0x00, 0x00, 0x02, 0xe9, 0x00, 0x03, 0x01, 0x00, 0x00, 0x02, 0xc5, 0x00, 0x01, 0xff, 0x00, 
+0xff, 0x00, 0xff, 0x00, 0xac, 0x00, 0x00, 0x80, 0x80, 0x00, 0x80, 0x40, 0x8c, 0x00, 0x05, 0x40, 
+0x20, 0x20, 0x00, 0x20, 0x80, 0xd6, 0x00, 0x0c, 0x20, 0x40, 0x80, 0x00, 0x40, 0x10, 0x88, 0x24, 
+0x12, 0x09, 0x04, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0x81, 0x00, 0x13, 0x02, 0x00, 0x04, 0x00, 
+0x00, 0x20, 0x88, 0x10, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x20, 0x8c, 0x40, 0x1c, 
+0xcf, 0x00, 0x0a, 0x06, 0x08, 0x00, 0x04, 0x00, 0x00, 0x04, 0x01, 0xc3, 0x00, 0xfe, 0x81, 0x00, 
+0x04, 0x08, 0x20, 0x20, 0x08, 0x88, 0x80, 0x80, 0x02, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x10, 
+0x80, 0x00, 0x02, 0x7e, 0x00, 0xe6, 0xe2, 0x00, 0x19, 0x04, 0x00, 0x22, 0x00, 0x10, 0x0e, 0x1f, 
+0x1b, 0x25, 0x7f, 0x7f, 0x3a, 0x2a, 0x28, 0x20, 0x00, 0x8a, 0x04, 0x41, 0x00, 0x16, 0x10, 0x40, 
+0x22, 0x08, 0x06, 0xe9, 0x00, 0x00, 0x01, 0x86, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0xbb, 0x00, 
+0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xad, 0x00, 0x00, 0x80, 0x86, 0x00, 0x00, 0x80, 0x8a, 
+0x00, 0x01, 0x20, 0x40, 0xd1, 0x00, 0x11, 0x80, 0xc0, 0x20, 0x30, 0x70, 0xf0, 0xc0, 0x80, 0x00, 
+0x00, 0x80, 0x20, 0x00, 0x40, 0x00, 0x00, 0x01, 0x04, 0x89, 0x00, 0x09, 0x01, 0x00, 0x00, 0x40, 
+0x00, 0x20, 0x80, 0x00, 0x05, 0x20, 0xd3, 0x00, 0x0e, 0x08, 0x3c, 0x7f, 0x61, 0xe0, 0xd0, 0xe6, 
+0xe5, 0x1b, 0x1f, 0x1e, 0x3c, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0x30, 0x48, 0x48, 0x20, 0x81, 
+0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x20, 0x80, 0x00, 0x03, 0x81, 0x00, 0x01, 0x18, 0xe1, 0x00, 
+0x1a, 0x03, 0x08, 0x11, 0x04, 0x00, 0x80, 0x00, 0x40, 0x3c, 0x6a, 0x6a, 0x2d, 0x3d, 0x3f, 0x3f, 
+0x1f, 0x3f, 0x3d, 0x3d, 0x5e, 0x3e, 0x80, 0x08, 0x04, 0x11, 0x08, 0x03, 0xeb, 0x00, 0x00, 0x02, 
+0x84, 0x00, 0x00, 0x02, 0xbd, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xc5, 0x00, 0x00, 
+0x20, 0xd3, 0x00, 0x80, 0x40, 0x00, 0x80, 0x85, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x04, 0x8f, 
+0x00, 0x06, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0xd0, 0x00, 0x07, 0x30, 0x42, 0x90, 0xa8, 
+0x70, 0x60, 0x03, 0x1c, 0x87, 0x00, 0x00, 0x20, 0x88, 0x00, 0x02, 0x48, 0x48, 0x30, 0x83, 0x00, 
+0x00, 0x18, 0xd9, 0x00, 0x80, 0x01, 0x82, 0x00, 0x05, 0x01, 0x00, 0x10, 0x00, 0x00, 0x80, 0x80, 
+0x00, 0x01, 0x0c, 0x14, 0x80, 0x12, 0x05, 0x10, 0x10, 0x00, 0x08, 0x0c, 0x46, 0x82, 0x00, 0x01, 
+0x08, 0x02, 0xeb, 0x00, 0x00, 0x02, 0xc5, 0x00, 0x01, 0xff, 0x00, 0xe3, 0x00, 0x03, 0x60, 0x00, 
+0x00, 0xfc, 0xec, 0x00, 0x12, 0x78, 0xf8, 0x80, 0xe0, 0xe0, 0xc4, 0xfc, 0x78, 0xfc, 0xcc, 0x6c, 
+0xfc, 0xf8, 0xf8, 0xe2, 0xfe, 0xff, 0x06, 0x02, 0xc5, 0x00, 0x01, 0x80, 0x00, 0x86, 0x40, 0x01, 
+0x80, 0x80, 0x84, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x20, 0x8a, 0x00, 0x01, 0x01, 0x01, 0x8a, 
+0x00, 0x00, 0x01, 0xb5, 0x00, 0x81, 0x80, 0x86, 0x00, 0x06, 0x40, 0x00, 0x00, 0x01, 0x00, 0x02, 
+0x00, 0x85, 0x01, 0x11, 0x02, 0x02, 0x04, 0x0d, 0x1b, 0x36, 0xcc, 0x10, 0xe0, 0x00, 0x18, 0x20, 
+0x40, 0x90, 0x22, 0x00, 0x00, 0x21, 0xcd, 0x00, 0x07, 0x40, 0x80, 0x30, 0x50, 0xa0, 0x40, 0x04, 
+0xe0, 0x81, 0x00, 0x02, 0xe3, 0x00, 0xfe, 0x81, 0x00, 0x02, 0x10, 0x00, 0x40, 0x8c, 0x00, 0x02, 
+0x7f, 0x00, 0x7f, 0xd7, 0x00, 0x01, 0x01, 0x01, 0x80, 0x02, 0x82, 0x00, 0x15, 0x01, 0x06, 0x18, 
+0x33, 0x6c, 0xd8, 0xb0, 0x20, 0x40, 0x40, 0x98, 0x98, 0x9a, 0x9b, 0x99, 0x91, 0x81, 0x01, 0x41, 
+0x01, 0x23, 0x80, 0x81, 0x00, 0x00, 0x02, 0xe9, 0x00, 0x02, 0x01, 0x01, 0x03, 0x85, 0x02, 0x01, 
+0x00, 0x01, 0xbb, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xae, 0x00, 0x05, 0x40, 0x00, 
+0x20, 0xa0, 0xa0, 0xb0, 0x82, 0xf0, 0x0b, 0xe0, 0x60, 0xe0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x80, 
+0xc0, 0x60, 0x20, 0xde, 0x00, 0x07, 0xc0, 0xf0, 0xf8, 0xec, 0x72, 0x19, 0x04, 0x02, 0x86, 0x00, 
+0x12, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0e, 0x3d, 0xf3, 0xe7, 0x1e, 0xe3, 0xc0, 0x00, 0x1c, 0x04, 
+0x24, 0x98, 0xe0, 0x3c, 0xcb, 0x00, 0x07, 0xf0, 0x80, 0x62, 0xe1, 0x61, 0xc1, 0x03, 0xf8, 0x82, 
+0x00, 0x0a, 0x1c, 0xff, 0xff, 0x1f, 0xff, 0xe0, 0x80, 0x60, 0x00, 0x00, 0x60, 0x83, 0x00, 0x11, 
+0x80, 0xf0, 0xf0, 0xe0, 0xf0, 0xe0, 0x80, 0x80, 0x00, 0x3f, 0xff, 0xf0, 0xff, 0x0f, 0x00, 0x00, 
+0x01, 0x01, 0xce, 0x00, 0x06, 0x01, 0x03, 0x06, 0x06, 0x04, 0x00, 0x03, 0x83, 0x00, 0x1b, 0x01, 
+0x07, 0x0f, 0x1c, 0x3b, 0x77, 0xee, 0xdc, 0xf8, 0xb0, 0xf4, 0xe6, 0xfb, 0x79, 0x78, 0x42, 0x56, 
+0x0f, 0x27, 0x83, 0x01, 0x01, 0x09, 0x26, 0x1b, 0x0d, 0x07, 0x01, 0xea, 0x00, 0x86, 0x01, 0xbc, 
+0x00, 0x01, 0xff, 0x00, 0xd4, 0x00, 0x00, 0x02, 0xff, 0x00, 0xd7, 0x00, 0x03, 0x80, 0x40, 0x00, 
+0x20, 0x84, 0x00, 0x07, 0x40, 0x50, 0x00, 0x80, 0x20, 0x00, 0x40, 0x80, 0x80, 0x00, 0x03, 0x80, 
+0xc0, 0xc0, 0x80, 0xde, 0x00, 0x07, 0x80, 0x30, 0x8c, 0x62, 0x09, 0x04, 0x02, 0x01, 0x8a, 0x00, 
+0x11, 0x01, 0x02, 0x04, 0x19, 0xe2, 0x07, 0x9f, 0xff, 0xc7, 0xc7, 0xe7, 0x86, 0xc0, 0xfc, 0xfc, 
+0x1c, 0xf8, 0xf0, 0xc5, 0x00, 0x07, 0xe0, 0x00, 0xc0, 0xa0, 0xc2, 0x02, 0x02, 0xf4, 0x86, 0x00, 
+0x07, 0x1f, 0xc0, 0x1f, 0x60, 0x00, 0x70, 0x70, 0x00, 0x80, 0x60, 0x08, 0x20, 0x00, 0x80, 0x00, 
+0x00, 0x40, 0x20, 0x30, 0x60, 0x81, 0x00, 0x0e, 0x70, 0x00, 0x00, 0x70, 0x06, 0x00, 0x01, 0x01, 
+0x00, 0x00, 0x03, 0x07, 0x06, 0x07, 0x07, 0xc5, 0x00, 0x07, 0x01, 0x07, 0x0e, 0x0f, 0x08, 0x00, 
+0x04, 0x03, 0x88, 0x00, 0x18, 0x03, 0x04, 0x09, 0x12, 0x24, 0x08, 0x40, 0x10, 0x02, 0x81, 0x88, 
+0x2a, 0x14, 0x2c, 0x00, 0x00, 0x01, 0x11, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x01, 0xff, 0x00, 
+0xaf, 0x00, 0x01, 0xff, 0x00, 0xd4, 0x00, 0x00, 0x02, 0xff, 0x00, 0xd8, 0x00, 0x0e, 0x80, 0x40, 
+0x00, 0xa0, 0x80, 0x10, 0x50, 0x50, 0x40, 0x00, 0x40, 0x50, 0x00, 0x00, 0x80, 0x91, 0x00, 0x01, 
+0xfe, 0xfe, 0xd3, 0x00, 0x07, 0xc0, 0x30, 0x8c, 0x72, 0x19, 0x04, 0x02, 0x01, 0x8b, 0x00, 0x05, 
+0x02, 0x04, 0x11, 0xc6, 0x18, 0xe0, 0x80, 0x00, 0x00, 0x78, 0x80, 0xfc, 0x0d, 0x1c, 0xf8, 0x70, 
+0xc1, 0xc1, 0xff, 0xff, 0x81, 0x1d, 0x3f, 0x23, 0x33, 0x3e, 0x1c, 0xba, 0x00, 0x07, 0xe0, 0x30, 
+0xf8, 0xdc, 0x8c, 0x04, 0x04, 0xf8, 0x87, 0x00, 0x05, 0x3f, 0xc0, 0x1f, 0xe0, 0x00, 0x00, 0x81, 
+0x60, 0x04, 0x20, 0x00, 0x20, 0x70, 0x70, 0x80, 0x40, 0x81, 0x00, 0x06, 0x40, 0x40, 0x80, 0x5f, 
+0x80, 0x79, 0x0e, 0x81, 0x00, 0x09, 0x03, 0x07, 0x36, 0x7d, 0x78, 0x6f, 0x73, 0x3b, 0x1f, 0x0f, 
+0xc0, 0x00, 0x07, 0x01, 0x00, 0x00, 0x10, 0x37, 0x38, 0x1c, 0x03, 0x89, 0x00, 0x18, 0x02, 0x04, 
+0x09, 0x12, 0x24, 0x08, 0x40, 0x1e, 0x11, 0x80, 0x3e, 0x1a, 0x31, 0x39, 0xb9, 0xaf, 0x0f, 0x59, 
+0x47, 0x27, 0x35, 0x12, 0x0d, 0x06, 0x01, 0xff, 0x00, 0xae, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 
+0xff, 0x00, 0xaf, 0x00, 0x02, 0x80, 0xc0, 0xc0, 0x81, 0xe0, 0x02, 0xb0, 0xf0, 0xb0, 0x81, 0xa0, 
+0x01, 0x00, 0x40, 0xe8, 0x00, 0x0b, 0xc0, 0xf0, 0xfc, 0xfe, 0xff, 0x3f, 0x0f, 0x06, 0x03, 0x03, 
+0x01, 0x01, 0x84, 0x00, 0x09, 0x01, 0x00, 0x02, 0x00, 0x08, 0x30, 0xe4, 0x98, 0xe0, 0x80, 0x84, 
+0x00, 0x01, 0x80, 0xc0, 0x80, 0x40, 0xc2, 0x00, 0x07, 0x40, 0x00, 0x00, 0x80, 0x08, 0x08, 0x00, 
+0x20, 0x87, 0x00, 0x04, 0x3f, 0xff, 0x1f, 0xff, 0x80, 0x83, 0x00, 0x05, 0xa0, 0xc0, 0x80, 0xf0, 
+0x80, 0x80, 0x82, 0x00, 0x06, 0xb0, 0x40, 0x90, 0xff, 0x7f, 0xf1, 0xff, 0x83, 0x00, 0x07, 0x02, 
+0x81, 0x00, 0x1c, 0x4c, 0x20, 0x30, 0x07, 0xc2, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x08, 0x89, 
+0x00, 0x1b, 0x01, 0x03, 0x04, 0x01, 0x00, 0x00, 0x40, 0x80, 0xae, 0x3f, 0x59, 0x57, 0x5d, 0x59, 
+0x45, 0x50, 0xe6, 0xe4, 0xf1, 0xfc, 0xf9, 0xfd, 0x7e, 0x3f, 0x1d, 0x0f, 0x07, 0x01, 0xea, 0x00, 
+0x88, 0x01, 0xb5, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb3, 0x00, 0x03, 0x80, 0x80, 
+0x00, 0x40, 0x86, 0x00, 0x00, 0x80, 0xe8, 0x00, 0x0b, 0x80, 0xe0, 0x38, 0xcc, 0x36, 0x1a, 0x0d, 
+0x04, 0x02, 0x00, 0x01, 0x01, 0x82, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x00, 0x04, 0x09, 0x12, 0x64, 
+0x98, 0x60, 0x80, 0x85, 0x00, 0x00, 0x80, 0xc6, 0x00, 0x01, 0x20, 0x10, 0x80, 0x00, 0x00, 0x40, 
+0x89, 0x00, 0x03, 0xff, 0x00, 0x7f, 0x81, 0x83, 0x00, 0x01, 0x30, 0x40, 0x81, 0x00, 0x0c, 0x40, 
+0xe0, 0x60, 0x60, 0x20, 0x30, 0x28, 0x18, 0x00, 0xff, 0x00, 0xff, 0x1c, 0x80, 0x00, 0x09, 0x30, 
+0x08, 0x06, 0xb1, 0x80, 0x18, 0x40, 0x00, 0x18, 0x04, 0xbf, 0x00, 0x06, 0x04, 0x00, 0x02, 0x08, 
+0x00, 0x20, 0x14, 0x8b, 0x00, 0x08, 0x03, 0x0c, 0x13, 0x26, 0x48, 0x90, 0x20, 0x00, 0x40, 0x80, 
+0x00, 0x0e, 0x10, 0x90, 0x86, 0x11, 0x00, 0x44, 0x40, 0x20, 0x90, 0x58, 0x6c, 0x33, 0x19, 0x06, 
+0x01, 0xe9, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x02, 0x02, 0x00, 0x00, 0x01, 0xb4, 0x00, 0x01, 
+0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb5, 0x00, 0x03, 0x80, 0x00, 0x40, 0x40, 0xf2, 0x00, 0x0a, 
+0x40, 0x10, 0x40, 0x20, 0x00, 0x01, 0x04, 0x02, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 
+0x00, 0x02, 0x40, 0x10, 0x40, 0xcd, 0x00, 0x01, 0x80, 0x40, 0x82, 0x00, 0x00, 0x80, 0x8a, 0x00, 
+0x02, 0xe7, 0x00, 0x7e, 0x84, 0x00, 0x06, 0x08, 0x48, 0x30, 0x00, 0x80, 0x40, 0xe0, 0x80, 0x20, 
+0x80, 0x00, 0x04, 0x18, 0x00, 0x7e, 0x00, 0xe3, 0x80, 0x00, 0x09, 0x20, 0x80, 0x04, 0x00, 0x00, 
+0x08, 0x00, 0x00, 0x01, 0x04, 0xbf, 0x00, 0x07, 0x02, 0x00, 0x21, 0x08, 0x4c, 0x00, 0x00, 0x03, 
+0x8b, 0x00, 0x05, 0x02, 0x08, 0x00, 0x04, 0x00, 0x80, 0x82, 0x00, 0x0e, 0x8c, 0x01, 0x00, 0x93, 
+0x89, 0x01, 0x03, 0x40, 0x20, 0x80, 0x00, 0x04, 0x02, 0x08, 0x02, 0xed, 0x00, 0x00, 0x02, 0x81, 
+0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0xb3, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xe6, 0x00, 0x00, 
+0x02, 0xd1, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x40, 0xed, 0x00, 0x0e, 0x80, 0x20, 0x88, 0x04, 
+0x12, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x87, 0x00, 0x01, 0x20, 0x80, 
+0xce, 0x00, 0x06, 0x40, 0x20, 0x10, 0x10, 0x00, 0x00, 0x60, 0x89, 0x00, 0x03, 0x18, 0x00, 0x00, 
+0x01, 0x83, 0x00, 0x08, 0x28, 0x00, 0x08, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0x83, 0x00, 0x00, 
+0x81, 0xce, 0x00, 0x07, 0x01, 0x08, 0x00, 0x05, 0x03, 0x40, 0x20, 0x1c, 0x8d, 0x00, 0x00, 0x11, 
+0x80, 0x00, 0x00, 0x20, 0x82, 0x00, 0x0e, 0x0e, 0x09, 0x08, 0x04, 0x85, 0x00, 0x03, 0x01, 0x20, 
+0x10, 0x48, 0x20, 0x11, 0x04, 0x01, 0xf2, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0xb2, 0x00, 0x01, 
+0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb6, 0x00, 0x03, 0x80, 0x80, 0x00, 0x00, 0x80, 0x40, 0x80, 
+0x00, 0x00, 0x80, 0x9a, 0x00, 0x07, 0x80, 0xff, 0xc0, 0x60, 0xe0, 0xc0, 0x80, 0x80, 0xc6, 0x00, 
+0x08, 0x40, 0x10, 0x48, 0x20, 0x02, 0x01, 0x04, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 
+0x03, 0x02, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x20, 0x80, 0x86, 0x00, 0x01, 0x80, 0x80, 0x87, 
+0x00, 0x03, 0x0f, 0x1f, 0x18, 0x08, 0x80, 0x0f, 0x02, 0x09, 0x08, 0x08, 0xae, 0x00, 0x07, 0x80, 
+0x80, 0x40, 0x20, 0x20, 0x30, 0x00, 0xa0, 0x8a, 0x00, 0x02, 0x81, 0x00, 0x82, 0x83, 0x00, 0x03, 
+0x10, 0x48, 0x48, 0x60, 0x84, 0x00, 0x02, 0x18, 0x28, 0x28, 0x84, 0x00, 0x08, 0x20, 0x90, 0x00, 
+0x20, 0x70, 0xe8, 0x88, 0xc0, 0x01, 0xc1, 0x00, 0x08, 0x07, 0x00, 0x02, 0x41, 0x0e, 0x0e, 0x20, 
+0x0f, 0x07, 0x89, 0x00, 0x05, 0x01, 0x04, 0x00, 0x22, 0x48, 0x10, 0x83, 0x00, 0x0c, 0x1e, 0x18, 
+0x19, 0x1d, 0x09, 0x08, 0x0c, 0x06, 0x02, 0x80, 0x00, 0x00, 0x01, 0x85, 0x00, 0x81, 0x01, 0xdf, 
+0x00, 0x00, 0x01, 0xbe, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb8, 0x00, 0x80, 0x80, 
+0x00, 0x00, 0x81, 0x80, 0xec, 0x00, 0x08, 0x40, 0x00, 0x00, 0x04, 0x10, 0x08, 0x01, 0x04, 0x00, 
+0x84, 0x02, 0x08, 0x00, 0x05, 0x05, 0x0a, 0x12, 0x24, 0xc8, 0x10, 0x40, 0x86, 0x00, 0x00, 0x80, 
+0xc7, 0x00, 0x03, 0x40, 0x40, 0x00, 0x20, 0x8b, 0x00, 0x02, 0x81, 0x00, 0x82, 0x84, 0x00, 0x00, 
+0x10, 0x8a, 0x00, 0x02, 0x87, 0x00, 0x03, 0x81, 0x00, 0x07, 0x60, 0x02, 0x00, 0x00, 0x60, 0x00, 
+0xc1, 0x03, 0xc2, 0x00, 0x06, 0x11, 0x00, 0x42, 0x10, 0x40, 0x00, 0x10, 0x8a, 0x00, 0x0b, 0x03, 
+0x0c, 0x11, 0x26, 0x48, 0x90, 0x20, 0x40, 0x00, 0x80, 0x80, 0x18, 0x81, 0x02, 0x05, 0x16, 0x97, 
+0x11, 0x49, 0x04, 0x04, 0x81, 0x00, 0x00, 0x01, 0xe8, 0x00, 0x0c, 0x01, 0x01, 0x02, 0x02, 0x00, 
+0x04, 0x04, 0x05, 0x04, 0x00, 0x00, 0x02, 0x02, 0xb3, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xbb, 0x00, 0x00, 0x80, 0xf5, 0x00, 0x03, 0x02, 0x00, 0x01, 0x04, 0x83, 0x00, 0x09, 0x04, 
+0x05, 0x08, 0x0a, 0x10, 0x24, 0xc8, 0x10, 0x60, 0x80, 0xe2, 0x00, 0x03, 0xfc, 0x00, 0xf8, 0x01, 
+0x85, 0x00, 0x00, 0x90, 0x85, 0x00, 0x06, 0x20, 0x40, 0x10, 0x03, 0x78, 0x01, 0xfc, 0x81, 0x00, 
+0x01, 0x60, 0x02, 0x80, 0x00, 0x00, 0x09, 0xc4, 0x00, 0x00, 0x10, 0x8f, 0x00, 0x0b, 0x01, 0x04, 
+0x10, 0x26, 0x48, 0x90, 0x20, 0x40, 0x80, 0x80, 0x00, 0x00, 0x82, 0x20, 0x09, 0x00, 0x00, 0x02, 
+0x12, 0x0a, 0x04, 0x00, 0x02, 0x10, 0x04, 0x83, 0x00, 0x02, 0x01, 0x00, 0x02, 0xdf, 0x00, 0x0b, 
+0x01, 0x02, 0x02, 0x00, 0x05, 0x05, 0x01, 0x01, 0x00, 0x01, 0x05, 0x04, 0x80, 0x00, 0x00, 0x01, 
+0xb1, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb3, 0x00, 0x05, 0x08, 0x00, 
+0x01, 0x05, 0x04, 0x04, 0x80, 0x05, 0x08, 0x01, 0x08, 0x02, 0x10, 0x24, 0x48, 0x10, 0x20, 0x80, 
+0xe5, 0x00, 0x00, 0x04, 0x84, 0x00, 0x03, 0xc0, 0xa0, 0x20, 0x60, 0x85, 0x00, 0x04, 0x10, 0x01, 
+0x04, 0x00, 0x06, 0x82, 0x00, 0x07, 0x88, 0x00, 0x40, 0x01, 0x01, 0x00, 0x02, 0x24, 0xc3, 0x00, 
+0x00, 0x40, 0x82, 0x00, 0x00, 0x08, 0x88, 0x00, 0x07, 0x02, 0x08, 0x23, 0x48, 0x90, 0x20, 0x40, 
+0x80, 0x80, 0x00, 0x01, 0x01, 0x08, 0x81, 0x04, 0x06, 0x24, 0x04, 0x94, 0x14, 0x0c, 0x00, 0x08, 
+0x86, 0x00, 0x04, 0x02, 0x02, 0x00, 0x02, 0x01, 0xdc, 0x00, 0x0f, 0x01, 0x02, 0x00, 0x04, 0x05, 
+0x00, 0x00, 0x08, 0x0a, 0x08, 0x00, 0x00, 0x01, 0x04, 0x00, 0x02, 0xb2, 0x00, 0x01, 0xff, 0x00, 
+0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xac, 0x00, 0x07, 0xc0, 0x20, 0x90, 0x48, 0x24, 0x12, 0x0a, 
+0x08, 0x80, 0x05, 0x07, 0x04, 0x04, 0x05, 0x05, 0x01, 0x00, 0x08, 0x02, 0xd7, 0x00, 0x03, 0x80, 
+0x00, 0x00, 0x40, 0x8a, 0x00, 0x03, 0xf8, 0x03, 0x70, 0x02, 0x83, 0x00, 0x03, 0xc0, 0x00, 0x40, 
+0xc0, 0x84, 0x00, 0x06, 0x60, 0x40, 0x00, 0x20, 0xf8, 0x00, 0xf8, 0x82, 0x00, 0x07, 0x10, 0x00, 
+0x82, 0x00, 0x10, 0x02, 0x44, 0x08, 0xc2, 0x00, 0x06, 0x1e, 0x00, 0x0c, 0x02, 0x12, 0x40, 0x20, 
+0x89, 0x00, 0x01, 0x04, 0x10, 0x84, 0x00, 0x05, 0x01, 0x01, 0x00, 0x08, 0x00, 0x00, 0x80, 0x20, 
+0x08, 0x90, 0x88, 0x48, 0x20, 0x90, 0x44, 0x31, 0x0c, 0x03, 0x82, 0x00, 0x00, 0x01, 0xe2, 0x00, 
+0x0f, 0x02, 0x00, 0x04, 0x05, 0x00, 0x00, 0x08, 0x0a, 0x08, 0x00, 0x05, 0x05, 0x04, 0x02, 0x02, 
+0x01, 0xb1, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb8, 0x00, 0x00, 0x80, 0xf1, 0x00, 
+0x08, 0xc0, 0x30, 0xd8, 0x6c, 0x34, 0x12, 0x08, 0x05, 0x05, 0x86, 0x00, 0x06, 0x08, 0x02, 0x04, 
+0x40, 0x90, 0x20, 0xc0, 0xd3, 0x00, 0x80, 0x80, 0x02, 0xc0, 0x40, 0x80, 0x86, 0x00, 0x04, 0x78, 
+0x07, 0x70, 0x8f, 0x01, 0x82, 0x00, 0x03, 0xc0, 0x00, 0xc0, 0x80, 0x83, 0x00, 0x07, 0x20, 0x70, 
+0x10, 0x60, 0x61, 0xfe, 0x00, 0xff, 0x82, 0x00, 0x0c, 0xc0, 0x00, 0x84, 0x44, 0x22, 0x02, 0x04, 
+0x88, 0xb0, 0x00, 0x00, 0xc0, 0xc0, 0x80, 0x60, 0x02, 0xc0, 0xc0, 0x00, 0x80, 0xc0, 0x01, 0x60, 
+0x60, 0xb4, 0x00, 0x08, 0x7f, 0x43, 0x9d, 0x85, 0xb8, 0xf8, 0xf0, 0x7f, 0x0c, 0x85, 0x00, 0x06, 
+0x07, 0x08, 0x23, 0x44, 0x90, 0x20, 0x40, 0x80, 0x00, 0x10, 0x01, 0x71, 0x7d, 0x4e, 0x5b, 0x09, 
+0x29, 0x0b, 0x87, 0x46, 0x40, 0xb0, 0x98, 0x6e, 0x33, 0x0c, 0x03, 0x82, 0x00, 0x0c, 0x03, 0x06, 
+0x05, 0x04, 0x00, 0x02, 0x00, 0x80, 0xf1, 0x3f, 0x0f, 0x01, 0x03, 0x80, 0x06, 0x05, 0x03, 0x07, 
+0x06, 0x07, 0x01, 0x07, 0xce, 0x00, 0x00, 0x02, 0x80, 0x00, 0x81, 0x01, 0x06, 0x05, 0x05, 0x00, 
+0x02, 0x02, 0x01, 0x01, 0x8e, 0x00, 0x01, 0x01, 0x01, 0x9f, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 
+0xff, 0x00, 0xb6, 0x00, 0x02, 0x80, 0x80, 0x00, 0x80, 0x80, 0xed, 0x00, 0x01, 0x80, 0x20, 0x80, 
+0x00, 0x04, 0x02, 0x08, 0x01, 0x00, 0x00, 0x82, 0x02, 0x08, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 
+0x04, 0x00, 0x10, 0xd9, 0x00, 0x01, 0x80, 0x80, 0x86, 0x00, 0x02, 0x84, 0x00, 0x0c, 0x83, 0x00, 
+0x01, 0xc0, 0x20, 0x81, 0x00, 0x80, 0x80, 0x04, 0x00, 0x00, 0x50, 0x00, 0x50, 0x85, 0x00, 0x09, 
+0x80, 0xe0, 0x30, 0x08, 0x88, 0x08, 0x4c, 0x1c, 0x78, 0x30, 0xc5, 0x00, 0x08, 0x3c, 0xc6, 0x1a, 
+0x29, 0x48, 0x70, 0x80, 0xf2, 0x0c, 0x8a, 0x00, 0x13, 0x40, 0x00, 0x80, 0x00, 0x00, 0x0c, 0x82, 
+0x05, 0x02, 0x00, 0x00, 0x8c, 0x10, 0x0e, 0x20, 0x00, 0x40, 0x00, 0x08, 0x02, 0x81, 0x00, 0x05, 
+0x07, 0x0f, 0x0f, 0x09, 0x01, 0x04, 0xcc, 0x00, 0x81, 0x01, 0x8d, 0x00, 0x00, 0x02, 0x80, 0x00, 
+0x81, 0x04, 0x04, 0x00, 0x00, 0x02, 0x00, 0x01, 0xb4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xb5, 0x00, 0x00, 0x80, 0x83, 0x00, 0x00, 0x80, 0xf3, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 
+0x02, 0x80, 0x00, 0x03, 0x08, 0x02, 0x00, 0x40, 0xe5, 0x00, 0x02, 0x80, 0x00, 0x44, 0x89, 0x00, 
+0x00, 0x80, 0x83, 0x00, 0x02, 0x20, 0x00, 0x01, 0x82, 0x00, 0x00, 0x80, 0x82, 0x00, 0x03, 0x80, 
+0x10, 0x60, 0x80, 0xc7, 0x00, 0x09, 0x38, 0xfc, 0x9e, 0x73, 0x51, 0x61, 0xe0, 0xb0, 0xfc, 0xe0, 
+0x82, 0x00, 0x05, 0x04, 0x00, 0x22, 0x40, 0x90, 0x20, 0x81, 0x00, 0x07, 0x0c, 0x62, 0xe5, 0x78, 
+0x68, 0x38, 0xb8, 0x12, 0x83, 0x00, 0x00, 0x08, 0x81, 0x00, 0x03, 0x07, 0x08, 0x12, 0x10, 0xcf, 
+0x00, 0x06, 0x01, 0x00, 0x00, 0x02, 0x03, 0x03, 0x01, 0x8b, 0x00, 0x00, 0x02, 0xbf, 0x00, 0x01, 
+0xe8, 0x00, 0x00, 0x40, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xc6, 0x00, 0x03, 0x01, 0x00, 0x00, 
+0x02, 0x85, 0x00, 0x00, 0x04, 0x82, 0x00, 0x01, 0x20, 0x80, 0xec, 0x00, 0x00, 0x20, 0x82, 0x00, 
+0x05, 0x80, 0x80, 0x00, 0x20, 0x00, 0x40, 0x86, 0x00, 0x00, 0x60, 0x81, 0x00, 0x02, 0x10, 0x20, 
+0x80, 0x86, 0x00, 0x00, 0x20, 0xc0, 0x00, 0x07, 0x50, 0x0c, 0x20, 0x00, 0x00, 0x82, 0x00, 0x18, 
+0x8b, 0x00, 0x02, 0x81, 0x14, 0x02, 0x82, 0x07, 0x01, 0x0b, 0x49, 0x82, 0x00, 0x00, 0x08, 0x81, 
+0x00, 0x02, 0x08, 0x10, 0x04, 0x82, 0x00, 0x00, 0x01, 0xcb, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 
+0x02, 0x01, 0x88, 0x00, 0x03, 0x01, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0xb7, 0x00, 0x01, 
+0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb4, 0x00, 0x04, 0x80, 0x00, 0x00, 0x40, 0x40, 0x81, 0x00, 
+0x00, 0x80, 0xeb, 0x00, 0x08, 0x40, 0x10, 0x88, 0x24, 0x12, 0x08, 0x04, 0x00, 0x02, 0x84, 0x00, 
+0x03, 0x02, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x20, 0x80, 0xe2, 0x00, 0x02, 0x83, 0x00, 0x46, 
+0x83, 0x00, 0x02, 0x40, 0x00, 0x40, 0x84, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x81, 0x84, 0x00, 
+0x00, 0x10, 0x81, 0x00, 0x00, 0x40, 0xcb, 0x00, 0x08, 0x20, 0x80, 0x02, 0x40, 0x80, 0x20, 0xc0, 
+0x04, 0xe0, 0x88, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x99, 0x90, 0x12, 0x82, 0x8a, 0x88, 0x08, 0x44, 
+0x06, 0x20, 0x90, 0x48, 0x24, 0x11, 0x04, 0x01, 0x00, 0x00, 0x07, 0x00, 0x02, 0x05, 0x12, 0x09, 
+0x04, 0x00, 0x02, 0xce, 0x00, 0x00, 0x02, 0x80, 0x00, 0x01, 0x02, 0x01, 0x8b, 0x00, 0x00, 0x02, 
+0x80, 0x00, 0x04, 0x02, 0x02, 0x00, 0x00, 0x01, 0xb5, 0x00, 0x00, 0xff, 0xff, 0xca, 0xff, 0x28, 
+0x03, 0x01, 0x07, 0x3f, 0xff, 0xff, 0x03, 0xc3, 0x03, 0x03, 0xff, 0xff, 0x07, 0x0f, 0x03, 0x03, 
+0x3f, 0x7f, 0x0f, 0x03, 0x03, 0xff, 0x07, 0xf3, 0xf3, 0x67, 0x07, 0xdf, 0xff, 0x0f, 0x07, 0xe7, 
+0xe7, 0xff, 0xff, 0x0f, 0x07, 0xe7, 0xe7, 0x07, 0x8f, 0xd3, 0xff, 0x29, 0x07, 0x80, 0xfe, 0xff, 
+0xf8, 0xe1, 0x87, 0x00, 0xff, 0xe0, 0x80, 0x3f, 0x87, 0xc0, 0x00, 0x00, 0xff, 0xf8, 0xf8, 0xfe, 
+0xe0, 0x00, 0xff, 0xc0, 0x00, 0x3c, 0x3c, 0x9c, 0x81, 0xc3, 0xc0, 0x80, 0xbe, 0x3e, 0x3f, 0xbf, 
+0x00, 0xf0, 0xf1, 0xe0, 0x8e, 0x3f, 0xc0, 0xff, 0x01, 0x7f, 0x7f, 0x87, 0x3f, 0x01, 0x7f, 0x7f, 
+0x91, 0xff, 0x00, 0xfe, 0x85, 0xff, 0x00, 0xfe, 0x88, 0xff, 0x00, 0xfe, 0xbf, 0xff, 0x08, 0x3f, 
+0x0f, 0x87, 0xe3, 0xf1, 0xf8, 0xfc, 0xfe, 0xfe, 0x85, 0xff, 0x08, 0xfe, 0xfe, 0xfc, 0xf8, 0xf9, 
+0xe1, 0xc7, 0x0f, 0x3f, 0xe2, 0xff, 0x02, 0xf7, 0x00, 0x00, 0x8d, 0xff, 0x80, 0x3f, 0x80, 0xff, 
+0x0a, 0x00, 0x00, 0xe3, 0xff, 0x07, 0x03, 0x83, 0xc3, 0x03, 0x03, 0xc7, 0xce, 0xff, 0x07, 0xdf, 
+0x01, 0x01, 0x71, 0xe1, 0x83, 0x0f, 0x3f, 0x82, 0xff, 0x0d, 0xfc, 0xf0, 0xe1, 0xc7, 0x8f, 0x9f, 
+0x1f, 0x1f, 0x04, 0x04, 0x13, 0x33, 0x73, 0x7b, 0x80, 0x3b, 0x06, 0x1b, 0x9a, 0x83, 0xc7, 0xe3, 
+0xf0, 0xfc, 0x80, 0xff, 0x05, 0xfc, 0xf8, 0xf9, 0xf8, 0xf8, 0xfe, 0xb2, 0xff, 0x00, 0xfe, 0x9b, 
+0xff, 0x00, 0xfe, 0x81, 0xfc, 0x00, 0xfe, 0x8c, 0xff, 0x82, 0xfe, 0x98, 0xff, 0x00, 0xfe, 0x9c, 
+0xff, 0x00, 0xff, 0xff, 0xca, 0xff, 0x02, 0x03, 0x83, 0x0f, 0x80, 0xff, 0x10, 0x03, 0x03, 0x07, 
+0x03, 0xff, 0xff, 0x03, 0x07, 0x03, 0x03, 0x0f, 0x7f, 0x0f, 0x03, 0x03, 0xc7, 0x07, 0x80, 0xf3, 
+0x0f, 0x03, 0x0f, 0xff, 0x0f, 0x07, 0x77, 0x73, 0x77, 0xf7, 0x3f, 0x07, 0xe7, 0xf7, 0x37, 0x07, 
+0xef, 0xd2, 0xff, 0x29, 0x00, 0x00, 0xff, 0xfc, 0xe0, 0xc7, 0x1f, 0x00, 0xf8, 0xfc, 0xc0, 0x9f, 
+0x9f, 0x80, 0xf0, 0x00, 0xc0, 0xfe, 0xfc, 0xfe, 0xff, 0x00, 0x1f, 0x00, 0x0f, 0x3c, 0x3c, 0x9c, 
+0x89, 0xe1, 0xc0, 0x9e, 0xbe, 0xbe, 0x9f, 0x9f, 0x00, 0x80, 0xe1, 0xc0, 0x1c, 0x3f, 0xc0, 0xff, 
+0x01, 0x7f, 0x7f, 0x81, 0x3f, 0x01, 0x1f, 0x1f, 0x82, 0x3f, 0x01, 0x7f, 0x7f, 0x81, 0xff, 0x00, 
+0xfe, 0xe3, 0xff, 0x08, 0x7f, 0x1f, 0x87, 0xe3, 0xf1, 0xf8, 0xfc, 0xfe, 0xfe, 0x86, 0xff, 0x0f, 
+0xfe, 0xfe, 0xfc, 0xf8, 0xf1, 0xc3, 0x07, 0x1f, 0xff, 0x3f, 0x0f, 0x07, 0x07, 0x0f, 0x1f, 0x3f, 
+0xd0, 0xff, 0x81, 0x1f, 0x84, 0xff, 0x02, 0x80, 0x00, 0x7f, 0x8d, 0xff, 0x01, 0x3f, 0x3f, 0x80, 
+0xff, 0x08, 0x3f, 0x00, 0xc0, 0xff, 0xf0, 0xe0, 0xc6, 0xc0, 0xc0, 0xd0, 0xff, 0x05, 0xe1, 0x00, 
+0x0e, 0x3c, 0x00, 0x80, 0x84, 0xff, 0x0a, 0xfe, 0xf8, 0xf1, 0xe3, 0xc7, 0x8f, 0x9f, 0x1f, 0x18, 
+0x08, 0x07, 0x81, 0x27, 0x09, 0x2f, 0x2f, 0x0f, 0x86, 0x86, 0xc7, 0xe3, 0xf0, 0xf8, 0xfe, 0xba, 
+0xff, 0x00, 0xfe, 0x9b, 0xff, 0x01, 0xfe, 0xfe, 0x91, 0xff, 0x80, 0xfe, 0x99, 0xff, 0x00, 0xfe, 
+0x9c, 0xff, 0x01, 0xff, 0x00, 0xcb, 0x00, 0x02, 0x82, 0x0c, 0xc0, 0x80, 0x00, 0x01, 0xc0, 0x04, 
+0x80, 0x00, 0x04, 0x04, 0x08, 0x00, 0x00, 0x30, 0x81, 0x00, 0x06, 0x38, 0x00, 0x04, 0x00, 0x84, 
+0x04, 0xd0, 0x80, 0x00, 0x0a, 0x90, 0x94, 0x88, 0x08, 0x30, 0x00, 0x00, 0x10, 0x30, 0x88, 0x10, 
+0xd2, 0x00, 0x18, 0x07, 0x80, 0x01, 0x03, 0x18, 0x26, 0x98, 0x00, 0x07, 0x1c, 0x40, 0xa0, 0x18, 
+0x40, 0xf4, 0x00, 0x3f, 0x06, 0x04, 0x00, 0x0f, 0x00, 0xe0, 0x80, 0x0f, 0x80, 0x00, 0x0c, 0x08, 
+0x22, 0x00, 0x1e, 0x00, 0x80, 0xa1, 0x20, 0x00, 0x60, 0x10, 0x20, 0x92, 0xc1, 0x00, 0x02, 0x80, 
+0x00, 0x40, 0x80, 0x00, 0x00, 0x20, 0x89, 0x00, 0x05, 0xe1, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0x86, 
+0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0xb5, 0x00, 0x05, 0xe0, 0xf8, 
+0x3c, 0x38, 0xf8, 0xf0, 0x81, 0x00, 0x03, 0x80, 0x00, 0x80, 0x20, 0x90, 0x00, 0x0a, 0x20, 0x80, 
+0x13, 0xc7, 0xcf, 0xee, 0xe7, 0xe7, 0xf7, 0xe0, 0xc0, 0xd0, 0x00, 0x06, 0xe0, 0xef, 0xff, 0xfc, 
+0x0e, 0x07, 0x01, 0x81, 0x00, 0x02, 0x40, 0x00, 0x61, 0x8d, 0x00, 0x0d, 0x40, 0x40, 0x80, 0x00, 
+0x00, 0x40, 0x00, 0x40, 0x00, 0x0f, 0x1f, 0x39, 0x3f, 0x3f, 0xd0, 0x00, 0x05, 0x1e, 0xff, 0xf1, 
+0xc3, 0xff, 0x7f, 0x86, 0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x24, 0x00, 0x0a, 0x84, 0x08, 0x06, 
+0x10, 0x08, 0x00, 0x00, 0x01, 0x00, 0x02, 0xd9, 0x00, 0x01, 0x01, 0x01, 0xd0, 0x00, 0x00, 0xff, 
+0xff, 0xca, 0xff, 0x02, 0x03, 0xc3, 0x0f, 0x80, 0xff, 0x10, 0x03, 0x03, 0x07, 0x03, 0xff, 0xff, 
+0x03, 0x07, 0x03, 0x03, 0x0f, 0x7f, 0x0f, 0x03, 0x03, 0xc7, 0x07, 0x80, 0xf3, 0x0f, 0x03, 0x0f, 
+0xff, 0x0f, 0x07, 0x77, 0x73, 0x73, 0xf7, 0x3f, 0x07, 0xe7, 0xf7, 0x37, 0x07, 0xef, 0xd2, 0xff, 
+0x29, 0x00, 0x00, 0xff, 0xfc, 0xe0, 0xc7, 0x1f, 0x00, 0xfa, 0xf8, 0xc0, 0x9f, 0x9f, 0x80, 0xf0, 
+0x00, 0xd0, 0xfe, 0xfc, 0xfe, 0xff, 0x00, 0x1f, 0x00, 0x0f, 0x3c, 0x3c, 0x9c, 0x89, 0xe1, 0xc0, 
+0x9e, 0xbe, 0xbe, 0x9f, 0x9f, 0x00, 0x00, 0xe1, 0xc0, 0x1c, 0x3f, 0xc3, 0xff, 0x82, 0x7f, 0x00, 
+0x3f, 0x82, 0x7f, 0x80, 0xff, 0x07, 0x9f, 0x0f, 0x06, 0x07, 0x43, 0x03, 0x07, 0x0f, 0xd4, 0xff, 
+0x06, 0x87, 0x03, 0x33, 0x33, 0x03, 0x07, 0xcf, 0x82, 0xff, 0x07, 0x3f, 0x0f, 0x87, 0xe3, 0xf1, 
+0xf8, 0xfc, 0xfc, 0x86, 0xfe, 0x07, 0xfc, 0xfc, 0xf8, 0xf1, 0xe3, 0xc6, 0x0e, 0x3c, 0x80, 0xfe, 
+0xd7, 0xff, 0x00, 0xfe, 0x85, 0xff, 0x02, 0x00, 0x00, 0x7e, 0x8c, 0xff, 0x02, 0x3f, 0x3f, 0x7f, 
+0x80, 0xff, 0x02, 0x7e, 0x00, 0x00, 0xe3, 0xff, 0x0c, 0xfc, 0xf0, 0xe1, 0xc7, 0x8f, 0x1f, 0x3f, 
+0x3f, 0x7c, 0x7c, 0x67, 0x67, 0xf7, 0x81, 0x73, 0x07, 0x32, 0x3a, 0x1a, 0x8f, 0xc7, 0xe3, 0xf0, 
+0xfc, 0xb9, 0xff, 0x00, 0xfe, 0xae, 0xff, 0x81, 0xfe, 0x80, 0xfc, 0x81, 0xfe, 0x94, 0xff, 0x00, 
+0xfe, 0x9c, 0xff, 0x00, 0xff, 0xff, 0xca, 0xff, 0x28, 0x03, 0x01, 0x07, 0x3f, 0xff, 0xff, 0x03, 
+0xc3, 0x03, 0x03, 0xff, 0xff, 0x07, 0x0f, 0x03, 0x03, 0x3f, 0x7f, 0x0f, 0x03, 0x03, 0xff, 0x07, 
+0xf3, 0xf3, 0x77, 0x07, 0xdf, 0xff, 0x0f, 0x07, 0xe7, 0xe7, 0xff, 0xff, 0x0f, 0x07, 0xe7, 0xe7, 
+0x07, 0x8f, 0xd3, 0xff, 0x29, 0x07, 0x80, 0xfe, 0xff, 0xf8, 0xe1, 0x87, 0x00, 0xff, 0xe0, 0x80, 
+0x3f, 0x87, 0xc0, 0x04, 0x00, 0xff, 0xf8, 0xf8, 0xfe, 0xf0, 0x00, 0xff, 0xc0, 0x00, 0x3c, 0x3c, 
+0x9c, 0x81, 0xc3, 0xc0, 0x80, 0xbe, 0x3e, 0x3f, 0xbf, 0x00, 0xe0, 0xf1, 0xe0, 0x8e, 0x3f, 0xc5, 
+0xff, 0x84, 0x7f, 0x82, 0xff, 0x06, 0x0f, 0x07, 0x03, 0x23, 0x03, 0x03, 0x07, 0x87, 0xff, 0x00, 
+0xfe, 0x85, 0xff, 0x00, 0xfe, 0x88, 0xff, 0x00, 0xfe, 0xb5, 0xff, 0x06, 0xc7, 0x03, 0x11, 0x39, 
+0x11, 0x83, 0xc7, 0x82, 0xff, 0x06, 0x7f, 0x1f, 0x8f, 0xc7, 0xe3, 0xf1, 0xf9, 0x80, 0xfc, 0x83, 
+0xfe, 0x08, 0xfc, 0xfc, 0xf8, 0xf9, 0xf1, 0xe3, 0x86, 0x0e, 0x3e, 0xe3, 0xff, 0x02, 0x01, 0x00, 
+0x7c, 0x8c, 0xff, 0x02, 0x7f, 0x3f, 0x3f, 0x80, 0xff, 0x02, 0xfe, 0x00, 0x00, 0xe3, 0xff, 0x19, 
+0xfc, 0xf0, 0xe3, 0xc7, 0x8f, 0x1f, 0x3f, 0x7f, 0x7c, 0xfc, 0xfc, 0xff, 0x8f, 0x03, 0x19, 0x9c, 
+0x44, 0x60, 0x3c, 0x3f, 0x1f, 0x8f, 0xc7, 0xe0, 0xf8, 0xfe, 0xb8, 0xff, 0x00, 0xfe, 0xad, 0xff, 
+0x80, 0xfe, 0x85, 0xfc, 0x01, 0xfe, 0xfe, 0x93, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 0xff, 0x00, 
+0xff, 0x00, 0xff, 0x00, 0xb3, 0x00, 0x80, 0x80, 0x00, 0xc0, 0x83, 0x40, 0x05, 0x00, 0x80, 0x80, 
+0x00, 0x00, 0x60, 0x80, 0x00, 0x01, 0x40, 0x40, 0xd7, 0x00, 0x06, 0x20, 0x82, 0x90, 0xa0, 0x88, 
+0x02, 0x04, 0x80, 0x00, 0x0b, 0x80, 0xe0, 0xf8, 0xfc, 0x7e, 0x3f, 0x1f, 0x0d, 0x07, 0x02, 0x03, 
+0x03, 0x81, 0x01, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x12, 0x24, 0x88, 0x30, 0xc0, 0x01, 
+0xe1, 0x00, 0x03, 0xff, 0x01, 0xff, 0x83, 0x84, 0x00, 0x01, 0x80, 0x80, 0x83, 0x00, 0x08, 0x80, 
+0x00, 0x00, 0xc0, 0x00, 0xe3, 0xfe, 0xc1, 0xff, 0xe2, 0x00, 0x1a, 0x03, 0x0c, 0x11, 0x24, 0x48, 
+0x10, 0x00, 0x00, 0x40, 0x03, 0x80, 0x80, 0xb8, 0xc8, 0x40, 0x5a, 0x9f, 0x67, 0x63, 0xb7, 0xf8, 
+0xfc, 0x7e, 0x3f, 0x1e, 0x07, 0x01, 0xe9, 0x00, 0x02, 0x01, 0x00, 0x00, 0x83, 0x02, 0x03, 0x03, 
+0x03, 0x01, 0x01, 0xb3, 0x00, 0x00, 0xff, 0xff, 0xca, 0xff, 0x02, 0x03, 0xc3, 0x0f, 0x80, 0xff, 
+0x10, 0x03, 0x03, 0x07, 0x03, 0xff, 0xff, 0x03, 0x07, 0x03, 0x03, 0x0f, 0x7f, 0x0f, 0x03, 0x03, 
+0xe7, 0x07, 0x80, 0xf3, 0x0f, 0x03, 0x0f, 0xff, 0x0f, 0x07, 0x77, 0x73, 0x77, 0xf7, 0x1f, 0x07, 
+0xe7, 0xf7, 0x37, 0x07, 0xef, 0xd2, 0xff, 0x29, 0x00, 0x00, 0xff, 0xfc, 0xe0, 0xc7, 0x1f, 0x00, 
+0xf2, 0xfc, 0xc0, 0x9f, 0x9f, 0xc0, 0xf0, 0x00, 0xd0, 0xfe, 0xfc, 0xfe, 0xff, 0x00, 0x1f, 0x00, 
+0x0f, 0x3c, 0x3c, 0x9c, 0x89, 0xe1, 0xc0, 0x9e, 0xbe, 0xbe, 0x9f, 0x9f, 0x00, 0x00, 0xe1, 0xc0, 
+0x1c, 0x3f, 0xbe, 0xff, 0x02, 0x7f, 0x3f, 0x3f, 0x80, 0x9f, 0x82, 0xcf, 0x0f, 0x8f, 0x9f, 0x9f, 
+0x1f, 0x3f, 0x7f, 0x7f, 0xff, 0x9f, 0x07, 0x06, 0x03, 0x23, 0x03, 0x03, 0x8f, 0xd5, 0xff, 0x0e, 
+0x87, 0x03, 0x33, 0x33, 0x03, 0x83, 0xcf, 0xff, 0x3f, 0x07, 0x83, 0xf1, 0xf8, 0xfc, 0xfe, 0x8a, 
+0xff, 0x08, 0xfe, 0xfe, 0xf8, 0xf0, 0xc3, 0x07, 0x3e, 0xfe, 0xfe, 0xe0, 0xff, 0x03, 0xc0, 0x00, 
+0x1f, 0x7f, 0x85, 0xff, 0x01, 0x7f, 0x7f, 0x83, 0xff, 0x06, 0x9f, 0x1f, 0x9f, 0x7f, 0x1f, 0x00, 
+0xc0, 0xe4, 0xff, 0x16, 0xfe, 0xf8, 0xf1, 0xe3, 0xe7, 0xc7, 0xcf, 0x8f, 0x9f, 0x87, 0x82, 0x80, 
+0x81, 0x89, 0x81, 0x81, 0xc1, 0xcc, 0xe4, 0xe3, 0xf1, 0xf8, 0xfc, 0xbc, 0xff, 0x00, 0xfe, 0xd0, 
+0xff, 0x00, 0xfe, 0x9c, 0xff, 0x00, 0xff, 0xff, 0xca, 0xff, 0x28, 0x03, 0x01, 0x07, 0x3f, 0xff, 
+0xff, 0x03, 0xc3, 0x03, 0x03, 0xff, 0xff, 0x07, 0x0f, 0x03, 0x03, 0x3f, 0x7f, 0x0f, 0x03, 0x03, 
+0xff, 0x07, 0xf3, 0xf3, 0x77, 0x07, 0xdf, 0xff, 0x0f, 0x07, 0xe7, 0xe7, 0xff, 0xff, 0x0f, 0x07, 
+0xe7, 0xe7, 0x07, 0x8f, 0xd3, 0xff, 0x29, 0x07, 0x80, 0xfe, 0xff, 0xf8, 0xe1, 0x87, 0x00, 0xff, 
+0xe0, 0x80, 0x3f, 0x87, 0xc0, 0x04, 0x00, 0xff, 0xf8, 0xf8, 0xfe, 0xf0, 0x00, 0xff, 0xc0, 0x00, 
+0x3c, 0x3c, 0x9c, 0x81, 0xc3, 0xc0, 0x80, 0xbe, 0x3e, 0x3f, 0xbf, 0x00, 0xa0, 0xf1, 0xe0, 0x8e, 
+0x3f, 0xbb, 0xff, 0x08, 0x7f, 0x3f, 0x1f, 0xcf, 0xc7, 0xe7, 0xf3, 0xf3, 0xf1, 0x82, 0xf9, 0x0b, 
+0xf1, 0xf3, 0xf3, 0xe3, 0xc7, 0xcf, 0x0f, 0x1f, 0x7f, 0xff, 0xdf, 0x0f, 0x80, 0x07, 0x04, 0xc7, 
+0x07, 0x07, 0x0f, 0x1f, 0x82, 0xff, 0x00, 0xfe, 0x85, 0xff, 0x00, 0xfe, 0x88, 0xff, 0x00, 0xfe, 
+0xb6, 0xff, 0x0b, 0x3f, 0x0f, 0x07, 0xe7, 0xc7, 0x0f, 0x0f, 0xff, 0x07, 0x00, 0xf8, 0xfe, 0x8b, 
+0xff, 0x0a, 0x0f, 0x0f, 0x3f, 0xff, 0xff, 0xfe, 0xf8, 0x00, 0x07, 0xff, 0xfe, 0x83, 0xfc, 0x00, 
+0xfe, 0xd2, 0xff, 0x00, 0xfe, 0x80, 0xfc, 0x08, 0xfe, 0xfe, 0xff, 0xfc, 0xe0, 0xc3, 0x0f, 0x3f, 
+0x7f, 0x80, 0xff, 0x11, 0x3f, 0x9f, 0x07, 0x07, 0x73, 0x79, 0x79, 0x7d, 0x7c, 0x3c, 0x3c, 0x94, 
+0x47, 0x3f, 0x0f, 0x83, 0xe0, 0xf8, 0xe6, 0xff, 0x04, 0xfe, 0xfc, 0xfc, 0xf8, 0xf9, 0x80, 0xf0, 
+0x81, 0xf2, 0x06, 0xf3, 0xf1, 0xf9, 0xf8, 0xfc, 0xfc, 0xfe, 0xbe, 0xff, 0x00, 0xfe, 0xd0, 0xff, 
+0x00, 0xfe, 0x9c, 0xff, 0x00, 0xff, 0xff, 0xca, 0xff, 0x02, 0x03, 0xc3, 0x0f, 0x80, 0xff, 0x10, 
+0x03, 0x03, 0x07, 0x03, 0xff, 0xff, 0x03, 0x07, 0x03, 0x03, 0x0f, 0x7f, 0x0f, 0x03, 0x03, 0xc7, 
+0x07, 0x80, 0xf3, 0x0f, 0x03, 0x0f, 0xff, 0x0f, 0x07, 0x77, 0x73, 0x73, 0xf7, 0x1f, 0x07, 0xe7, 
+0xf7, 0x37, 0x07, 0xef, 0xba, 0xff, 0x04, 0x7f, 0x3f, 0x3f, 0x1f, 0x9f, 0x80, 0xcf, 0x81, 0xe7, 
+0x07, 0xc7, 0xcf, 0xcf, 0x8f, 0x9f, 0x1f, 0x3f, 0x7f, 0x81, 0xff, 0x29, 0x00, 0x00, 0xff, 0xfc, 
+0xe0, 0xc7, 0x1f, 0x00, 0xf4, 0xfc, 0xc0, 0x9f, 0x9f, 0xc0, 0xf0, 0x00, 0xc0, 0xfe, 0xfc, 0xfe, 
+0xff, 0x00, 0x1f, 0x00, 0x0f, 0x3c, 0x3c, 0x9c, 0x89, 0xe1, 0xc0, 0x9e, 0xbe, 0xbe, 0x9f, 0x9f, 
+0x00, 0x80, 0xe1, 0xc0, 0x1c, 0x3f, 0xb8, 0xff, 0x08, 0x0f, 0x03, 0xe1, 0xf8, 0xfe, 0xff, 0xdf, 
+0x0f, 0x1f, 0x82, 0xff, 0x0d, 0x7b, 0x43, 0x03, 0x0f, 0x3f, 0x7f, 0x7f, 0xfe, 0xfc, 0xf0, 0x81, 
+0x07, 0x3f, 0xfe, 0x83, 0xff, 0x0b, 0xe1, 0x00, 0x00, 0x38, 0xc1, 0x03, 0x1f, 0x1f, 0x9f, 0x3f, 
+0x3f, 0x7f, 0xc7, 0xff, 0x17, 0x7f, 0x3f, 0x1f, 0x8f, 0x8f, 0x1f, 0x3f, 0xff, 0xc0, 0x00, 0x1f, 
+0x7f, 0xff, 0xff, 0x7f, 0x1e, 0x86, 0xe3, 0xf3, 0xf9, 0xfc, 0xfc, 0xfe, 0xfe, 0x82, 0x7e, 0x05, 
+0x3e, 0x18, 0x03, 0x07, 0xc0, 0xf0, 0x85, 0xff, 0x01, 0xf3, 0xf0, 0x81, 0xe0, 0x06, 0xe2, 0xe3, 
+0xe3, 0xe0, 0xf0, 0xf8, 0xfd, 0xc5, 0xff, 0x06, 0xfe, 0xf0, 0xf0, 0xf3, 0xf1, 0xf8, 0xf8, 0x80, 
+0xff, 0x15, 0xfe, 0xfc, 0xf8, 0xf1, 0xe0, 0xe0, 0xc4, 0xc4, 0xc0, 0xc1, 0xc9, 0xcc, 0xcc, 0xce, 
+0xce, 0xc6, 0xe6, 0xe2, 0xf3, 0xf1, 0xf8, 0xfc, 0xff, 0xff, 0x89, 0xff, 0x12, 0x3f, 0x1f, 0xcf, 
+0xcf, 0xef, 0xcf, 0x9f, 0x3f, 0x3f, 0xff, 0x0f, 0x0f, 0x7f, 0xff, 0x0f, 0x0f, 0xff, 0x1f, 0x8f, 
+0x80, 0xef, 0x9a, 0xff, 0x00, 0xfe, 0xc8, 0xff, 0x02, 0xf1, 0xc0, 0x9f, 0x81, 0x3f, 0x0b, 0x9f, 
+0x8f, 0xc0, 0xf0, 0x00, 0xfe, 0xf8, 0xe3, 0xc7, 0x80, 0xff, 0xc0, 0x80, 0x9e, 0x02, 0xde, 0xcf, 
+0xef, 0x8c, 0xff, 0x01, 0xff, 0x00, 0xcb, 0x00, 0x02, 0xc2, 0x08, 0xc0, 0x80, 0x00, 0x01, 0xe0, 
+0x04, 0x80, 0x00, 0x04, 0x04, 0x08, 0x00, 0x00, 0x30, 0x81, 0x00, 0x00, 0x38, 0x80, 0x00, 0x02, 
+0x94, 0x04, 0xd0, 0x80, 0x00, 0x0a, 0x90, 0x94, 0x8c, 0x08, 0x10, 0x00, 0x00, 0x10, 0x30, 0x08, 
+0x10, 0xb9, 0x00, 0x31, 0xc0, 0x60, 0xb0, 0xf8, 0x78, 0xfc, 0xfc, 0xfe, 0x36, 0x1e, 0x1e, 0x2e, 
+0x2e, 0x0e, 0x06, 0x0c, 0x4c, 0x5c, 0xd8, 0xb0, 0x60, 0xc0, 0x80, 0x00, 0x00, 0x07, 0x80, 0x01, 
+0x03, 0x18, 0x26, 0x98, 0x00, 0x0b, 0x1c, 0x40, 0xa0, 0x18, 0x00, 0xf4, 0x00, 0x3f, 0x06, 0x04, 
+0x00, 0x0f, 0x00, 0xe0, 0xc0, 0x0f, 0x80, 0x00, 0x0c, 0x08, 0x22, 0x00, 0x1e, 0x00, 0x80, 0xa0, 
+0x20, 0x00, 0x60, 0x10, 0x20, 0x92, 0xb9, 0x00, 0x1b, 0x0c, 0x03, 0x1d, 0x01, 0x07, 0x87, 0xc7, 
+0x83, 0xd9, 0x18, 0x0c, 0x06, 0x06, 0x02, 0x86, 0xbf, 0xff, 0xf2, 0xc2, 0x86, 0x0e, 0xf9, 0x63, 
+0x0e, 0x61, 0x06, 0x30, 0x01, 0x83, 0x00, 0x11, 0x1e, 0xff, 0xff, 0xc7, 0x3e, 0xc0, 0x1c, 0x0c, 
+0xdd, 0x30, 0x00, 0x40, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0xb5, 0x00, 
+0x22, 0x80, 0xc0, 0xe0, 0x70, 0x70, 0xe0, 0xc0, 0x00, 0x38, 0xe0, 0x9c, 0x70, 0xc0, 0x9f, 0xb5, 
+0xd5, 0x4d, 0x00, 0x10, 0x0a, 0x07, 0x05, 0x07, 0x03, 0x83, 0x82, 0x82, 0x80, 0x00, 0x01, 0x07, 
+0x84, 0xc7, 0x30, 0x0e, 0x85, 0x00, 0x01, 0x0c, 0x0f, 0x81, 0x1f, 0x08, 0x1e, 0x23, 0x62, 0x60, 
+0x75, 0x7b, 0x3f, 0x1f, 0x07, 0xbb, 0x00, 0x0e, 0x40, 0xe0, 0xf0, 0xf0, 0xf8, 0xff, 0x9f, 0x8f, 
+0xc6, 0xf1, 0x73, 0x0c, 0x0e, 0x07, 0x07, 0x80, 0x00, 0x15, 0x01, 0x03, 0x06, 0x0d, 0x1c, 0x18, 
+0x3d, 0x35, 0x33, 0x32, 0x3a, 0x3f, 0x3f, 0x3d, 0x3f, 0x3f, 0x1f, 0x1e, 0x0f, 0x0f, 0x07, 0x03, 
+0xd7, 0x00, 0x00, 0x0b, 0x80, 0x0f, 0x02, 0x07, 0x03, 0x01, 0xff, 0x00, 0xcf, 0x00, 0x01, 0xff, 
+0x00, 0xb5, 0x00, 0x01, 0x80, 0x80, 0x86, 0xc0, 0x01, 0x80, 0x80, 0x8c, 0x00, 0x00, 0x20, 0x8e, 
+0x00, 0x00, 0x10, 0x8b, 0x00, 0x00, 0x80, 0xb9, 0x00, 0x19, 0xe0, 0x38, 0x5c, 0xfe, 0xff, 0x5b, 
+0x7f, 0x2d, 0xaf, 0x26, 0x86, 0x86, 0xb6, 0xae, 0xee, 0xae, 0xa4, 0xa5, 0x85, 0x03, 0x77, 0xee, 
+0xfc, 0x78, 0xe0, 0x80, 0x94, 0x00, 0x00, 0x40, 0x8a, 0x00, 0x00, 0x20, 0xbc, 0x00, 0x1a, 0x83, 
+0x00, 0xc3, 0x07, 0x07, 0x84, 0x1e, 0xef, 0xff, 0xdb, 0x8f, 0x87, 0x87, 0x82, 0xc2, 0x43, 0x63, 
+0x62, 0x63, 0x27, 0xbf, 0xe7, 0x6c, 0x01, 0x9f, 0x01, 0x8f, 0x89, 0x00, 0x0a, 0x3c, 0xfc, 0xec, 
+0x40, 0x0e, 0x07, 0x3e, 0x3c, 0x00, 0x40, 0xc0, 0xcb, 0x00, 0x1a, 0x07, 0x1e, 0x7b, 0xfe, 0xdc, 
+0xa7, 0x44, 0x57, 0xf7, 0xdf, 0xdf, 0x8d, 0x85, 0x86, 0x86, 0x82, 0xc2, 0xc3, 0xc3, 0x61, 0xf1, 
+0xf8, 0xfc, 0x76, 0x38, 0x0c, 0x01, 0x8b, 0x00, 0x0a, 0x03, 0x07, 0x01, 0x10, 0x05, 0x03, 0x45, 
+0x66, 0x38, 0x0f, 0x04, 0xb8, 0x00, 0x0b, 0x70, 0xb0, 0x18, 0x08, 0xe8, 0xe0, 0x0f, 0x6f, 0x8f, 
+0xc7, 0xfe, 0x7c, 0x86, 0x00, 0x06, 0x01, 0x03, 0x03, 0x07, 0x06, 0x0e, 0x0c, 0x82, 0x0d, 0x05, 
+0x0e, 0x06, 0x06, 0x03, 0x03, 0x01, 0xd6, 0x00, 0x09, 0x06, 0x0f, 0x0f, 0x04, 0x00, 0x00, 0x10, 
+0x18, 0x03, 0x01, 0xaa, 0x00, 0x02, 0x40, 0x00, 0x40, 0x80, 0x00, 0x09, 0x10, 0x20, 0x40, 0xf0, 
+0x10, 0x10, 0x40, 0xf0, 0xc0, 0x10, 0x80, 0x00, 0x03, 0xe0, 0xc0, 0xe8, 0x70, 0xe5, 0x00, 0x18, 
+0x0a, 0x00, 0x10, 0xa6, 0x8f, 0x89, 0x8f, 0x07, 0x41, 0x00, 0xf0, 0x1f, 0xf9, 0x7a, 0x27, 0x58, 
+0x00, 0x3f, 0x20, 0x5f, 0x00, 0x0e, 0x4a, 0x4b, 0x28, 0x8c, 0x00, 0x00, 0xff, 0xff, 0xb4, 0xff, 
+0x04, 0x7f, 0x7f, 0x3f, 0x3f, 0x1f, 0x85, 0x9f, 0x03, 0x3f, 0x3f, 0x7f, 0x7f, 0x82, 0xff, 0x02, 
+0x03, 0xc3, 0x0f, 0x80, 0xff, 0x10, 0x03, 0x03, 0x07, 0x03, 0xff, 0xff, 0x03, 0x07, 0x03, 0x03, 
+0x0f, 0x7f, 0x0f, 0x03, 0x03, 0xc7, 0x07, 0x80, 0xf3, 0x0f, 0x03, 0x0f, 0xff, 0x0f, 0x07, 0x77, 
+0x73, 0x77, 0xf7, 0x1f, 0x07, 0xe7, 0xf7, 0x37, 0x07, 0xef, 0xb8, 0xff, 0x43, 0x3f, 0x0f, 0x83, 
+0x81, 0x18, 0x0c, 0x8e, 0xce, 0xc7, 0xe7, 0x7f, 0x7f, 0x3f, 0x37, 0x33, 0x33, 0x23, 0x23, 0x47, 
+0x47, 0x76, 0xfc, 0xf8, 0xe1, 0x83, 0x0f, 0x00, 0x00, 0xff, 0xfc, 0xe0, 0xc7, 0x1f, 0x00, 0xc0, 
+0xfc, 0xc0, 0x9f, 0x9f, 0xc0, 0xf0, 0x00, 0xc0, 0xfe, 0xfc, 0xfe, 0xff, 0x00, 0x1f, 0x00, 0x0f, 
+0x7c, 0x3c, 0x9c, 0x89, 0xe1, 0xc0, 0x9e, 0xbe, 0xbe, 0x9f, 0x9f, 0x00, 0x00, 0xe1, 0xc0, 0x1c, 
+0x3f, 0xb9, 0xff, 0x1a, 0xc0, 0x00, 0x1f, 0xff, 0xff, 0x9f, 0x03, 0x31, 0xbc, 0x3c, 0x3e, 0x7f, 
+0x3f, 0x3f, 0xbf, 0x9f, 0xdf, 0xdf, 0xcf, 0xce, 0xe6, 0xe0, 0xff, 0xff, 0x3f, 0x00, 0xc0, 0x8c, 
+0xff, 0x06, 0x01, 0x00, 0xc0, 0x00, 0x01, 0x3f, 0x3f, 0xce, 0xff, 0x05, 0xfc, 0xf8, 0xf1, 0xe3, 
+0xc6, 0xce, 0x80, 0x9e, 0x00, 0x3e, 0x81, 0x3f, 0x80, 0x9f, 0x06, 0xcf, 0xc7, 0xe3, 0xf1, 0xf8, 
+0xfc, 0xfe, 0x8c, 0xff, 0x01, 0xc3, 0xc0, 0x80, 0x80, 0x03, 0x86, 0xc7, 0xc0, 0xf0, 0xb9, 0xff, 
+0x07, 0x8f, 0x0f, 0x0f, 0x07, 0xe7, 0xcf, 0x0f, 0x1f, 0xf5, 0xff, 0x00, 0xf1, 0x80, 0xf0, 0x81, 
+0xe0, 0xad, 0xff, 0x03, 0x3f, 0x1f, 0x9f, 0x9f, 0x80, 0x1f, 0x09, 0x3f, 0x7f, 0x3f, 0x1f, 0x9f, 
+0xcf, 0x0f, 0x1f, 0x3f, 0x1f, 0x81, 0xcf, 0x00, 0xef, 0x99, 0xff, 0x00, 0xfe, 0xc9, 0xff, 0x18, 
+0xf0, 0xe0, 0xcf, 0xcf, 0xdf, 0xdf, 0xcf, 0xce, 0xe4, 0x80, 0x80, 0xf8, 0xff, 0xff, 0xc0, 0x98, 
+0xb8, 0xc3, 0x83, 0x91, 0xc9, 0xcf, 0xe7, 0xf3, 0xfb, 0x8b, 0xff, 0x01, 0xff, 0x00, 0xb5, 0x00, 
+0x03, 0x40, 0x00, 0xa0, 0x80, 0x85, 0x50, 0x05, 0xb0, 0xa0, 0x60, 0x40, 0xc0, 0x80, 0x81, 0x00, 
+0x02, 0xc2, 0x08, 0xc0, 0x80, 0x00, 0x01, 0xc0, 0x04, 0x80, 0x00, 0x04, 0x04, 0x08, 0x00, 0x00, 
+0x30, 0x81, 0x00, 0x00, 0x38, 0x80, 0x00, 0x02, 0x84, 0x04, 0xd0, 0x80, 0x00, 0x0a, 0x90, 0x94, 
+0x88, 0x08, 0x10, 0x00, 0x00, 0x10, 0x30, 0x88, 0x10, 0xb8, 0x00, 0x42, 0xc0, 0x10, 0x80, 0x40, 
+0xd0, 0x80, 0x08, 0x09, 0x24, 0x94, 0x4c, 0xc0, 0xa0, 0xe8, 0xec, 0xfa, 0xea, 0xf2, 0x96, 0xd6, 
+0xd5, 0xdf, 0x86, 0x19, 0x73, 0x0c, 0x07, 0x00, 0x01, 0x03, 0x18, 0x26, 0x98, 0x00, 0x3f, 0x1c, 
+0x40, 0xa0, 0x18, 0x00, 0xf4, 0x00, 0x3f, 0x06, 0x04, 0x00, 0x0f, 0x00, 0xe0, 0xc0, 0x0f, 0x40, 
+0x00, 0x00, 0x08, 0x22, 0x00, 0x1e, 0x00, 0x80, 0xa1, 0x20, 0x00, 0xc0, 0x10, 0x20, 0x92, 0xba, 
+0x00, 0x1b, 0x3f, 0xc0, 0x1f, 0xe0, 0x80, 0x60, 0xc4, 0x30, 0xa0, 0x32, 0x21, 0xe0, 0xa0, 0xa0, 
+0x70, 0x50, 0x30, 0x38, 0x28, 0x29, 0x11, 0x13, 0x07, 0x00, 0x00, 0x07, 0x40, 0x0f, 0x8a, 0x00, 
+0x03, 0x01, 0x06, 0x01, 0x38, 0x80, 0x00, 0x02, 0x40, 0x80, 0x01, 0x88, 0x00, 0x00, 0x01, 0xc0, 
+0x00, 0x09, 0x03, 0x06, 0x09, 0x12, 0x35, 0x29, 0x59, 0x51, 0x51, 0xb1, 0x81, 0xa0, 0x04, 0x10, 
+0x50, 0x50, 0x08, 0x20, 0x91, 0x00, 0x00, 0x04, 0x81, 0x00, 0x04, 0x02, 0x40, 0x00, 0x10, 0x08, 
+0xba, 0x00, 0x05, 0x08, 0x00, 0x80, 0x28, 0x08, 0x10, 0xf5, 0x00, 0x00, 0x0e, 0x80, 0x00, 0x01, 
+0x10, 0x10, 0xff, 0x00, 0xb7, 0x00, 0x06, 0x08, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x92, 0x00, 
+0x01, 0xff, 0x00, 0xb7, 0x00, 0x02, 0x80, 0x00, 0x40, 0x84, 0x00, 0x06, 0x40, 0x10, 0x80, 0x20, 
+0x00, 0x40, 0x80, 0x80, 0x00, 0x02, 0xc2, 0x08, 0xc0, 0x80, 0x00, 0x01, 0xc0, 0x04, 0x80, 0x00, 
+0x04, 0x04, 0x08, 0x00, 0x00, 0x30, 0x81, 0x00, 0x00, 0x38, 0x80, 0x00, 0x02, 0x84, 0x04, 0xd0, 
+0x80, 0x00, 0x0a, 0x90, 0x94, 0x8c, 0x08, 0x10, 0x00, 0x00, 0x10, 0x30, 0x88, 0x10, 0xb9, 0x00, 
+0x31, 0xe0, 0x0c, 0xc2, 0x29, 0x7c, 0x74, 0x24, 0x82, 0x42, 0xaa, 0x27, 0x53, 0x10, 0x30, 0x26, 
+0x27, 0x3d, 0x1d, 0x59, 0x7b, 0xb2, 0x6f, 0xc6, 0x08, 0xf3, 0x07, 0x00, 0x01, 0x03, 0x18, 0x26, 
+0x98, 0x00, 0x0f, 0x1c, 0x40, 0xa0, 0x18, 0x00, 0xf4, 0x00, 0x1f, 0x06, 0x04, 0x00, 0x0f, 0x00, 
+0xe0, 0xc0, 0x0f, 0x80, 0x00, 0x0c, 0x08, 0x22, 0x00, 0x1e, 0x00, 0x80, 0xa1, 0x20, 0x00, 0x40, 
+0x10, 0x20, 0x92, 0xbb, 0x00, 0x09, 0x3f, 0xc0, 0x1f, 0x60, 0x80, 0x38, 0xc1, 0xd8, 0x89, 0x98, 
+0x80, 0x50, 0x02, 0x20, 0x28, 0x08, 0x80, 0x10, 0x08, 0x04, 0x00, 0x00, 0x03, 0xc0, 0x38, 0x80, 
+0x30, 0x07, 0x89, 0x00, 0x01, 0x01, 0x04, 0x84, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0xc1, 
+0x00, 0x0a, 0x01, 0x04, 0x09, 0x02, 0x14, 0x20, 0x28, 0x00, 0x40, 0x50, 0x10, 0x82, 0x00, 0x06, 
+0x08, 0x20, 0x04, 0x02, 0x09, 0x04, 0x02, 0x8e, 0x00, 0x04, 0x10, 0x00, 0x00, 0x02, 0x01, 0xbb, 
+0x00, 0x08, 0x70, 0xc0, 0x00, 0x00, 0x64, 0x94, 0x74, 0x08, 0xf8, 0xf5, 0x00, 0x00, 0x0c, 0x80, 
+0x08, 0x03, 0x00, 0x18, 0x10, 0x0f, 0xaa, 0x00, 0x17, 0x80, 0xc0, 0x20, 0x80, 0x00, 0x80, 0x00, 
+0x20, 0xe0, 0xc0, 0x60, 0x20, 0x00, 0xe0, 0x30, 0xf0, 0x00, 0x20, 0x20, 0x30, 0xd0, 0xd0, 0x50, 
+0x70, 0x81, 0x60, 0xe1, 0x00, 0x02, 0x3f, 0x70, 0xee, 0x80, 0xd0, 0x15, 0x5f, 0x0f, 0x3e, 0x1b, 
+0x80, 0x80, 0x0c, 0x07, 0x1f, 0x43, 0x98, 0xb8, 0x03, 0x7c, 0x91, 0xc9, 0xd6, 0xfe, 0xea, 0xe2, 
+0xe6, 0xe0, 0x89, 0x00, 0x01, 0xff, 0x00, 0xb6, 0x00, 0x04, 0x20, 0x80, 0x10, 0x40, 0x08, 0x84, 
+0x28, 0x0b, 0x48, 0x50, 0x90, 0xa0, 0x20, 0x40, 0x80, 0x00, 0x00, 0xc2, 0x08, 0xc0, 0x80, 0x00, 
+0x01, 0xe0, 0x04, 0x80, 0x00, 0x04, 0x04, 0x08, 0x00, 0x00, 0x30, 0x81, 0x00, 0x06, 0x38, 0x00, 
+0x04, 0x00, 0x84, 0x04, 0xd0, 0x80, 0x00, 0x0a, 0x90, 0x94, 0x8c, 0x08, 0x10, 0x00, 0x00, 0x10, 
+0x30, 0x88, 0x10, 0xbc, 0x00, 0x2e, 0x01, 0x08, 0x04, 0x10, 0x02, 0x00, 0x08, 0x50, 0x00, 0x23, 
+0x08, 0x08, 0x09, 0x0a, 0x28, 0x2c, 0x10, 0x59, 0x81, 0x0f, 0xc6, 0x08, 0x01, 0x00, 0xe1, 0x03, 
+0x18, 0x26, 0x98, 0x00, 0x0f, 0x1c, 0x40, 0xa0, 0x18, 0x00, 0xf0, 0x00, 0x1f, 0x06, 0x04, 0x00, 
+0x0f, 0x00, 0xe0, 0x80, 0x0f, 0x80, 0x00, 0x0c, 0x08, 0x22, 0x00, 0x1e, 0x00, 0x80, 0xa0, 0x20, 
+0x00, 0x40, 0x10, 0x20, 0x92, 0xbc, 0x00, 0x0e, 0x20, 0x80, 0x10, 0x40, 0x00, 0x3f, 0x24, 0x64, 
+0x6c, 0x2c, 0x2c, 0x28, 0x08, 0x10, 0x10, 0x80, 0x04, 0x08, 0x00, 0x00, 0x0b, 0x04, 0x83, 0x00, 
+0x07, 0x00, 0x08, 0x89, 0x00, 0x09, 0x01, 0x04, 0x00, 0x08, 0x00, 0x00, 0x40, 0x80, 0x80, 0x01, 
+0x88, 0x00, 0x00, 0x01, 0xc2, 0x00, 0x15, 0x03, 0x04, 0x09, 0x0a, 0x14, 0x04, 0x28, 0x28, 0x00, 
+0x40, 0x50, 0x50, 0x40, 0x00, 0x08, 0x28, 0x20, 0x04, 0x02, 0x09, 0x04, 0x02, 0x8b, 0x00, 0x0a, 
+0x38, 0x47, 0x50, 0x10, 0x89, 0x08, 0x08, 0x46, 0x00, 0x0f, 0x08, 0xb9, 0x00, 0x08, 0x30, 0x64, 
+0x04, 0x00, 0x52, 0x4a, 0x34, 0x04, 0xf8, 0xf4, 0x00, 0x00, 0x03, 0x80, 0x04, 0x04, 0x0c, 0x00, 
+0x08, 0x08, 0x07, 0xb5, 0x00, 0x00, 0x20, 0xf5, 0x00, 0x00, 0x80, 0x89, 0x00, 0x00, 0x40, 0x92, 
+0x00, 0x01, 0xff, 0x00, 0xb7, 0x00, 0x05, 0x10, 0x40, 0x08, 0x20, 0x00, 0x00, 0x80, 0x14, 0x05, 
+0x00, 0x00, 0x20, 0x08, 0x40, 0x10, 0x82, 0x00, 0x02, 0xc2, 0x08, 0xc0, 0x80, 0x00, 0x01, 0xe0, 
+0x04, 0x80, 0x00, 0x04, 0x04, 0x08, 0x00, 0x00, 0x30, 0x81, 0x00, 0x06, 0x18, 0x00, 0x04, 0x00, 
+0x84, 0x04, 0xd0, 0x80, 0x00, 0x0a, 0x90, 0x94, 0x88, 0x08, 0x10, 0x00, 0x00, 0x10, 0x30, 0x88, 
+0x10, 0xbd, 0x00, 0x03, 0x04, 0x08, 0x00, 0x12, 0x80, 0x00, 0x04, 0x20, 0x08, 0x01, 0x00, 0x10, 
+0x80, 0x00, 0x1e, 0x20, 0x00, 0x01, 0x20, 0x40, 0x84, 0x01, 0x00, 0x11, 0x03, 0x18, 0x26, 0x98, 
+0x00, 0x1f, 0x1c, 0x40, 0xa0, 0x18, 0x00, 0xf0, 0x00, 0x3f, 0x06, 0x04, 0x00, 0x0f, 0x00, 0xe0, 
+0x80, 0x0f, 0x80, 0x00, 0x0c, 0x08, 0x22, 0x00, 0x1e, 0x00, 0x80, 0xa0, 0x20, 0x00, 0x40, 0x10, 
+0x20, 0x92, 0xbc, 0x00, 0x10, 0x10, 0x40, 0x08, 0x20, 0x80, 0x00, 0x18, 0x13, 0x1b, 0x12, 0x12, 
+0x14, 0x10, 0x04, 0x04, 0x00, 0x00, 0x81, 0x04, 0x03, 0x0b, 0x0c, 0x07, 0x01, 0x8b, 0x00, 0x09, 
+0xe1, 0x00, 0xc0, 0xf9, 0x01, 0xe2, 0x80, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0xc3, 0x00, 
+0x06, 0x02, 0x04, 0x01, 0x02, 0x10, 0x14, 0x00, 0x83, 0x28, 0x03, 0x20, 0x00, 0x04, 0x10, 0x8d, 
+0x00, 0x0b, 0x18, 0x3c, 0x47, 0x80, 0x91, 0x88, 0x85, 0x04, 0x4e, 0x01, 0x3f, 0x10, 0xbd, 0x00, 
+0x05, 0x02, 0x20, 0x20, 0x0a, 0x02, 0x04, 0xf5, 0x00, 0x00, 0x02, 0x80, 0x00, 0x01, 0x04, 0x04, 
+0xab, 0x00, 0x0b, 0x80, 0xc0, 0x20, 0x00, 0x00, 0x80, 0x00, 0x20, 0xc0, 0x80, 0xe0, 0x00, 0x81, 
+0x20, 0x0b, 0x00, 0x20, 0xc0, 0x00, 0x20, 0x80, 0x00, 0x40, 0x40, 0x50, 0x90, 0x80, 0xe1, 0x00, 
+0x1c, 0x3f, 0x60, 0xce, 0x80, 0x98, 0x0f, 0x3c, 0x5f, 0x3e, 0x1f, 0x00, 0x00, 0xc3, 0xc4, 0xd9, 
+0xe0, 0x80, 0x80, 0x3f, 0x00, 0x80, 0xb9, 0x80, 0x80, 0x84, 0xc4, 0xc5, 0xdf, 0x30, 0x88, 0x00, 
+0x01, 0xff, 0x00, 0xb4, 0x00, 0x08, 0x80, 0x00, 0x20, 0x10, 0x40, 0x08, 0x20, 0x00, 0x00, 0x80, 
+0x14, 0x83, 0x00, 0x03, 0x80, 0x20, 0x40, 0x80, 0x92, 0x00, 0x00, 0x20, 0xce, 0x00, 0x1b, 0xf0, 
+0x04, 0xe1, 0x0c, 0x02, 0x0c, 0x02, 0x02, 0xb2, 0x4b, 0x6b, 0x63, 0x61, 0x40, 0xd0, 0xd9, 0xdb, 
+0x8b, 0xa7, 0x8f, 0xd6, 0x56, 0xb9, 0x80, 0x00, 0x00, 0x08, 0x80, 0x81, 0x00, 0x00, 0x10, 0xdc, 
+0x00, 0x0c, 0x0f, 0x20, 0x87, 0x10, 0x40, 0x00, 0x04, 0x0c, 0x0c, 0x0d, 0x0d, 0x0e, 0x0a, 0x81, 
+0x0e, 0x0a, 0x0a, 0x0e, 0x0e, 0x0f, 0x0f, 0x8f, 0x47, 0x18, 0x40, 0x10, 0x03, 0x82, 0x00, 0x0b, 
+0xf0, 0xfe, 0x1f, 0xff, 0xfe, 0x80, 0x60, 0xf8, 0x3e, 0xf6, 0xfe, 0x1c, 0xc1, 0x00, 0x82, 0x80, 
+0x8a, 0x00, 0x03, 0x01, 0x00, 0x00, 0x08, 0x82, 0x00, 0x0c, 0x20, 0x28, 0x28, 0x20, 0x00, 0x00, 
+0x04, 0x00, 0x02, 0x01, 0x04, 0x02, 0x01, 0x83, 0x00, 0x01, 0x18, 0x3f, 0x80, 0x7f, 0x09, 0x6f, 
+0x4d, 0x40, 0xe0, 0xe6, 0xf7, 0x73, 0x73, 0x3f, 0x3e, 0xbd, 0x00, 0x09, 0x98, 0x82, 0x01, 0x01, 
+0x19, 0x37, 0x1f, 0x03, 0xff, 0x44, 0xf3, 0x00, 0x00, 0x01, 0x80, 0x03, 0x03, 0x02, 0x00, 0x06, 
+0x06, 0xaa, 0x00, 0x13, 0xc0, 0x20, 0x80, 0x90, 0x90, 0x10, 0x00, 0x20, 0x40, 0xf0, 0x10, 0x10, 
+0x40, 0xa0, 0xd8, 0x18, 0x30, 0xe0, 0xf0, 0x30, 0x81, 0x18, 0x02, 0x08, 0xc0, 0xe0, 0xe1, 0x00, 
+0x1c, 0x1f, 0x20, 0x40, 0x93, 0x98, 0x9f, 0xa3, 0x81, 0xce, 0x60, 0x00, 0x00, 0x3f, 0xc4, 0xd9, 
+0xe3, 0x40, 0x00, 0x3f, 0x3f, 0x80, 0xb9, 0x81, 0x81, 0x95, 0xd5, 0x51, 0x4f, 0x40, 0x88, 0x00, 
+0x01, 0xff, 0x00, 0xb5, 0x00, 0x06, 0x40, 0x00, 0x80, 0x10, 0x40, 0x08, 0x28, 0x83, 0x00, 0x0b, 
+0x20, 0x08, 0x00, 0x10, 0x80, 0x20, 0x40, 0x80, 0x00, 0xc2, 0x08, 0xc0, 0x80, 0x00, 0x01, 0xc0, 
+0x04, 0x80, 0x00, 0x04, 0x04, 0x08, 0x00, 0x00, 0x30, 0x81, 0x00, 0x00, 0x38, 0x80, 0x00, 0x02, 
+0x84, 0x04, 0xd0, 0x80, 0x00, 0x0a, 0x90, 0x94, 0x88, 0x08, 0x10, 0x00, 0x00, 0x10, 0x30, 0x88, 
+0x10, 0xbb, 0x00, 0x08, 0x08, 0x02, 0x10, 0x04, 0x01, 0x04, 0x44, 0x04, 0x24, 0x80, 0x20, 0x05, 
+0x80, 0x00, 0x00, 0x40, 0x20, 0x00, 0x80, 0x08, 0x1a, 0x89, 0x20, 0x00, 0x80, 0x01, 0x43, 0x18, 
+0x26, 0x98, 0x00, 0x0f, 0x1c, 0x40, 0xa0, 0x18, 0x00, 0xf0, 0x00, 0x3f, 0x06, 0x04, 0x00, 0x0f, 
+0x00, 0xe0, 0x80, 0x0f, 0x80, 0x00, 0x0c, 0x08, 0x22, 0x00, 0x1e, 0x00, 0x80, 0xa0, 0x20, 0x00, 
+0x60, 0x10, 0x20, 0x92, 0xbf, 0x00, 0x03, 0x10, 0x00, 0x00, 0x02, 0x82, 0x00, 0x83, 0x04, 0x09, 
+0x01, 0x01, 0x00, 0x04, 0x03, 0x00, 0x01, 0x87, 0x20, 0x04, 0x81, 0x00, 0x07, 0xf8, 0x0e, 0xf1, 
+0xe0, 0x01, 0x3e, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0xb2, 0x00, 0x81, 
+0x40, 0x01, 0xc0, 0x80, 0x88, 0x00, 0x12, 0x01, 0x00, 0x00, 0x08, 0x00, 0x14, 0x00, 0x20, 0x28, 
+0x08, 0x00, 0x00, 0x08, 0x28, 0x28, 0x00, 0x14, 0x10, 0x08, 0x86, 0x00, 0x09, 0x20, 0x00, 0x10, 
+0x01, 0x00, 0x0c, 0x08, 0x00, 0x00, 0x10, 0xc2, 0x00, 0x0a, 0x04, 0x7e, 0xf8, 0x80, 0x80, 0x0e, 
+0x19, 0x0f, 0x02, 0x3b, 0x33, 0xf6, 0x00, 0x03, 0x01, 0x03, 0x01, 0x01, 0xff, 0x00, 0xcf, 0x00, 
+0x00, 0xff, 0xff, 0xb6, 0xff, 0x04, 0x7f, 0x3f, 0x1f, 0x9f, 0x8f, 0x80, 0xcf, 0x02, 0xe7, 0xe7, 
+0xc7, 0x80, 0xcf, 0x08, 0x8f, 0x9f, 0x1f, 0x3f, 0x7f, 0xff, 0x03, 0xc3, 0x0f, 0x80, 0xff, 0x10, 
+0x03, 0x03, 0x07, 0x03, 0xff, 0xff, 0x03, 0x07, 0x03, 0x03, 0x0f, 0x7f, 0x0f, 0x03, 0x03, 0xc7, 
+0x07, 0x80, 0xf3, 0x0f, 0x03, 0x0f, 0xff, 0x0f, 0x07, 0x77, 0x73, 0x73, 0xf7, 0x3f, 0x07, 0xe7, 
+0xf7, 0x37, 0x07, 0xef, 0xbb, 0xff, 0x08, 0x1f, 0x03, 0xe1, 0xf8, 0xfc, 0xe6, 0xe7, 0xc7, 0x47, 
+0x81, 0x4f, 0x33, 0xcf, 0xef, 0xff, 0xdf, 0xdf, 0x9f, 0x8f, 0x8f, 0x8e, 0x8c, 0x00, 0x00, 0x07, 
+0x1c, 0xe0, 0xc7, 0x1f, 0x00, 0xf0, 0xfc, 0xc0, 0x9f, 0x9f, 0xc0, 0xf0, 0x00, 0xe0, 0xfe, 0xfc, 
+0xfe, 0xff, 0x00, 0x1f, 0x00, 0x0f, 0x7c, 0x3c, 0x9c, 0x89, 0xe1, 0xc0, 0x9e, 0xbe, 0xbe, 0x9f, 
+0x9f, 0x00, 0x80, 0xe1, 0xc0, 0x1c, 0x3f, 0xbc, 0xff, 0x05, 0xe0, 0x80, 0x1f, 0x7f, 0xff, 0xf9, 
+0x80, 0xf0, 0x01, 0xf2, 0xf2, 0x80, 0xf6, 0x81, 0xf4, 0x08, 0xf5, 0xf5, 0xf1, 0xf9, 0xff, 0x3e, 
+0x0f, 0x80, 0xe0, 0x80, 0xff, 0x07, 0x03, 0x01, 0x18, 0x00, 0x01, 0x3f, 0x3f, 0x7f, 0xc7, 0xff, 
+0x07, 0x7f, 0x3f, 0x1f, 0x1f, 0x9f, 0x1f, 0x3f, 0x3f, 0x87, 0xff, 0x06, 0xfe, 0xfc, 0xf8, 0xf1, 
+0xe3, 0xe7, 0xc7, 0x86, 0xcf, 0x06, 0xe7, 0xe7, 0xe3, 0xf1, 0xf8, 0xfc, 0xfe, 0x82, 0xff, 0x08, 
+0xc5, 0x80, 0x90, 0x80, 0x80, 0x86, 0x86, 0xc0, 0xf0, 0xc5, 0xff, 0x09, 0xfc, 0xc0, 0x80, 0x80, 
+0x00, 0x07, 0x07, 0x80, 0x80, 0xfe, 0xff, 0xff, 0xa4, 0xff, 0x12, 0x3f, 0x1f, 0xcf, 0xcf, 0xef, 
+0xcf, 0x9f, 0x3f, 0x3f, 0xff, 0x0f, 0x0f, 0x7f, 0xff, 0x0f, 0x0f, 0xff, 0x1f, 0x8f, 0x80, 0xef, 
+0x9a, 0xff, 0x00, 0xfe, 0xc8, 0xff, 0x02, 0xf1, 0xc0, 0x9f, 0x81, 0x3f, 0x0b, 0x9f, 0x8e, 0xc0, 
+0xf0, 0x00, 0xfe, 0xf8, 0xe3, 0xc7, 0x80, 0xff, 0xc0, 0x80, 0x9e, 0x02, 0xde, 0xcf, 0xef, 0x8c, 
+0xff, 0x01, 0xff, 0x00, 0xb8, 0x00, 0x15, 0x20, 0x80, 0x10, 0x40, 0x00, 0x00, 0x28, 0x28, 0x08, 
+0x00, 0x00, 0x50, 0x10, 0x80, 0x20, 0x40, 0x80, 0x00, 0x00, 0xc2, 0x08, 0xc0, 0x80, 0x00, 0x01, 
+0xc0, 0x04, 0x80, 0x00, 0x04, 0x04, 0x08, 0x00, 0x00, 0x30, 0x81, 0x00, 0x00, 0x38, 0x80, 0x00, 
+0x02, 0x84, 0x04, 0xd0, 0x80, 0x00, 0x0a, 0x90, 0x94, 0x8c, 0x08, 0x30, 0x00, 0x00, 0x10, 0x30, 
+0x88, 0x10, 0xbc, 0x00, 0x00, 0x04, 0x80, 0x00, 0x03, 0x18, 0x08, 0x28, 0x88, 0x81, 0x00, 0x32, 
+0x80, 0xa0, 0x00, 0x20, 0x40, 0x00, 0x10, 0x11, 0x10, 0x14, 0x00, 0x00, 0x09, 0x63, 0x18, 0x26, 
+0x98, 0x00, 0x0f, 0x1c, 0x40, 0xa0, 0x18, 0x00, 0xf0, 0x00, 0x1f, 0x06, 0x04, 0x00, 0x0f, 0x00, 
+0xe0, 0xc0, 0x0f, 0x40, 0x00, 0x00, 0x08, 0x22, 0x00, 0x1e, 0x00, 0x80, 0xa0, 0x20, 0x00, 0x40, 
+0x10, 0x20, 0x92, 0xbd, 0x00, 0x01, 0x20, 0x80, 0x80, 0x00, 0x1d, 0x06, 0x0d, 0x08, 0x00, 0x02, 
+0x02, 0x05, 0x04, 0x04, 0x06, 0x06, 0x04, 0x00, 0x01, 0x01, 0x04, 0x08, 0x0e, 0x01, 0x00, 0x00, 
+0x10, 0x00, 0x00, 0x3c, 0x02, 0x18, 0x99, 0x03, 0x3e, 0x80, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 
+0x01, 0x88, 0x00, 0x00, 0x01, 0xb3, 0x00, 0x00, 0x20, 0x8c, 0x00, 0x07, 0x02, 0x04, 0x09, 0x12, 
+0x04, 0x20, 0x08, 0x00, 0x83, 0x50, 0x02, 0x40, 0x00, 0x28, 0x88, 0x00, 0x08, 0x45, 0x00, 0x11, 
+0x80, 0x88, 0x01, 0x02, 0x00, 0x01, 0xc5, 0x00, 0x09, 0x01, 0x28, 0x00, 0x00, 0x80, 0x00, 0x00, 
+0x80, 0x00, 0x38, 0xff, 0x00, 0xff, 0x00, 0xc9, 0x00, 0x01, 0xff, 0x00, 0xb7, 0x00, 0x05, 0x40, 
+0x00, 0x20, 0x00, 0x10, 0x50, 0x81, 0x00, 0x04, 0x40, 0x50, 0x00, 0x80, 0x20, 0xeb, 0x00, 0x06, 
+0x20, 0x08, 0x00, 0x20, 0x30, 0x70, 0x50, 0x82, 0xd0, 0x02, 0xb0, 0x00, 0x40, 0x80, 0xa0, 0x03, 
+0x80, 0x82, 0xa0, 0x01, 0x93, 0x00, 0x00, 0x40, 0xd0, 0x00, 0x22, 0x20, 0x80, 0x00, 0x0c, 0x1c, 
+0x19, 0x10, 0x14, 0x14, 0x1f, 0x1e, 0x1f, 0x1b, 0x1b, 0x19, 0x1d, 0x1f, 0x1f, 0x16, 0x02, 0x0e, 
+0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3c, 0x02, 0x18, 0x40, 0x02, 0x30, 0x40, 0x40, 0xc8, 0x00, 
+0x08, 0x80, 0xc0, 0x40, 0x20, 0xa0, 0x20, 0x00, 0x00, 0x80, 0x8a, 0x00, 0x03, 0x20, 0x08, 0x00, 
+0x50, 0x83, 0x00, 0x07, 0x10, 0x40, 0x00, 0x20, 0x04, 0x02, 0x09, 0x04, 0x85, 0x00, 0x06, 0x80, 
+0x00, 0x00, 0x89, 0x04, 0x00, 0x12, 0xc5, 0x00, 0x0a, 0x02, 0x11, 0x40, 0x80, 0x80, 0x06, 0x08, 
+0x0f, 0x80, 0x46, 0x70, 0xf8, 0x00, 0x01, 0x01, 0x01, 0xa8, 0x00, 0x02, 0x40, 0x00, 0x40, 0x80, 
+0x00, 0x09, 0x10, 0x20, 0x40, 0xf0, 0x10, 0x10, 0x40, 0xf0, 0xc0, 0x10, 0x80, 0x00, 0x03, 0xe0, 
+0xc0, 0xe8, 0x70, 0xe5, 0x00, 0x18, 0x0a, 0x00, 0x10, 0xa6, 0x8f, 0x89, 0x8f, 0x07, 0x40, 0x00, 
+0xf0, 0x1f, 0xf9, 0x7a, 0x27, 0x58, 0x00, 0x3f, 0x20, 0x5f, 0x00, 0x0e, 0x4a, 0x4b, 0x28, 0x8c, 
+0x00, 0x01, 0xff, 0x00, 0xb9, 0x00, 0x03, 0x20, 0x00, 0x00, 0x10, 0x8b, 0x00, 0x02, 0xc2, 0x08, 
+0xc0, 0x80, 0x00, 0x01, 0xc0, 0x04, 0x80, 0x00, 0x04, 0x04, 0x08, 0x00, 0x00, 0x30, 0x81, 0x00, 
+0x00, 0x18, 0x80, 0x00, 0x02, 0x84, 0x04, 0xd0, 0x80, 0x00, 0x0a, 0x90, 0x94, 0x8c, 0x08, 0x30, 
+0x00, 0x00, 0x10, 0x30, 0x88, 0x10, 0xbd, 0x00, 0x06, 0x20, 0x08, 0x00, 0x40, 0x40, 0x80, 0x80, 
+0x82, 0xa0, 0x21, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x20, 0x20, 0xc0, 0x01, 0x00, 0x01, 0x83, 
+0x18, 0x26, 0x98, 0x00, 0x0d, 0x1c, 0x40, 0xa0, 0x18, 0x00, 0xf0, 0x00, 0x3f, 0x06, 0x04, 0x00, 
+0x0f, 0x00, 0xe0, 0x80, 0x0f, 0x80, 0x00, 0x0c, 0x08, 0x22, 0x00, 0x1e, 0x00, 0x80, 0xa0, 0x20, 
+0x00, 0x40, 0x10, 0x20, 0x92, 0xbd, 0x00, 0x00, 0x40, 0x81, 0x00, 0x15, 0x0c, 0x06, 0x22, 0x23, 
+0x2f, 0x2d, 0x35, 0x37, 0x76, 0x3a, 0x3a, 0x7e, 0x7f, 0x7d, 0x6d, 0x65, 0x75, 0x08, 0x41, 0x0f, 
+0x00, 0x18, 0x80, 0x00, 0x08, 0xfc, 0xfe, 0x3e, 0x02, 0x0c, 0x7e, 0x7c, 0x88, 0x01, 0x85, 0x00, 
+0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0xc2, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x40, 0x88, 0x00, 
+0x03, 0x04, 0x02, 0x09, 0x04, 0x83, 0x00, 0x0a, 0x7f, 0x0f, 0x01, 0x20, 0x0a, 0x1e, 0x90, 0xdc, 
+0x63, 0x3f, 0x30, 0xc4, 0x00, 0x09, 0x02, 0x30, 0x80, 0x00, 0x00, 0x08, 0x00, 0x00, 0x80, 0x03, 
+0xa5, 0x00, 0x01, 0x01, 0x01, 0xd0, 0x00, 0x00, 0x01, 0xa7, 0x00, 0x16, 0x80, 0x20, 0x90, 0x50, 
+0x70, 0xd0, 0x90, 0x00, 0x40, 0x70, 0x20, 0x00, 0xa0, 0xc0, 0xc0, 0x00, 0xc0, 0x00, 0x40, 0xc0, 
+0xe0, 0xc8, 0x60, 0xe5, 0x00, 0x19, 0x04, 0x30, 0x6f, 0x56, 0x7f, 0x69, 0x6f, 0x57, 0x00, 0x24, 
+0x80, 0x9f, 0xff, 0x7d, 0x3b, 0x5f, 0x18, 0x78, 0x23, 0x02, 0x0f, 0x59, 0x5b, 0x63, 0x34, 0x04, 
+0x8b, 0x00, 0x01, 0xff, 0x00, 0xb6, 0x00, 0x06, 0x80, 0x00, 0x00, 0x20, 0x80, 0x00, 0x10, 0x81, 
+0x50, 0x05, 0x10, 0x00, 0x80, 0x20, 0x00, 0x40, 0x81, 0x00, 0x02, 0xc2, 0x08, 0xc0, 0x80, 0x00, 
+0x01, 0xc0, 0x04, 0x80, 0x00, 0x04, 0x04, 0x08, 0x00, 0x00, 0x30, 0x81, 0x00, 0x00, 0x18, 0x80, 
+0x00, 0x02, 0x84, 0x04, 0xd0, 0x80, 0x00, 0x0a, 0x90, 0x94, 0x8c, 0x08, 0x30, 0x00, 0x00, 0x10, 
+0x30, 0x88, 0x10, 0xbd, 0x00, 0x06, 0x22, 0x08, 0x04, 0x20, 0x21, 0x20, 0x20, 0x81, 0x00, 0x00, 
+0x40, 0x81, 0x00, 0x1d, 0x40, 0x41, 0x40, 0x40, 0x08, 0x01, 0x00, 0x11, 0x03, 0x18, 0x26, 0x98, 
+0x00, 0x0d, 0x1c, 0x40, 0xa0, 0x18, 0x00, 0xf0, 0x00, 0x3f, 0x06, 0x04, 0x00, 0x0f, 0x00, 0xe0, 
+0x80, 0x0f, 0x80, 0x00, 0x0c, 0x08, 0x22, 0x00, 0x1e, 0x00, 0x80, 0xa0, 0x20, 0x00, 0x40, 0x10, 
+0x20, 0x92, 0xc1, 0x00, 0x16, 0x30, 0x78, 0x60, 0x40, 0x50, 0x78, 0x7a, 0x6e, 0x7c, 0x3c, 0x74, 
+0x7c, 0x39, 0xb8, 0xb8, 0x88, 0x48, 0x7a, 0x09, 0x41, 0x00, 0x00, 0x09, 0x83, 0x00, 0x06, 0xfc, 
+0x3c, 0x06, 0x80, 0xe4, 0xfd, 0x38, 0x84, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0xb9, 0x00, 
+0x00, 0x40, 0x87, 0x00, 0x14, 0x08, 0x12, 0x04, 0x08, 0x00, 0x10, 0x00, 0x00, 0x80, 0xa0, 0xa0, 
+0x80, 0x00, 0x00, 0x10, 0x00, 0x08, 0x04, 0x12, 0x09, 0x04, 0x84, 0x00, 0x0a, 0x70, 0x8f, 0x23, 
+0x02, 0x10, 0x03, 0x0c, 0x98, 0xc1, 0x4e, 0x20, 0xc3, 0x00, 0x0a, 0x04, 0x00, 0x40, 0x00, 0x01, 
+0x00, 0x00, 0x02, 0x00, 0x0c, 0x30, 0xa6, 0x00, 0x01, 0x01, 0x01, 0xcc, 0x00, 0x00, 0x01, 0xff, 
+0x00, 0xce, 0x00, 0x01, 0xff, 0x00, 0xb6, 0x00, 0x00, 0x80, 0x8d, 0x00, 0x00, 0x80, 0x80, 0x00, 
+0x02, 0xc2, 0x08, 0xc0, 0x80, 0x00, 0x01, 0xc0, 0x04, 0x80, 0x00, 0x04, 0x04, 0x08, 0x00, 0x00, 
+0x30, 0x81, 0x00, 0x00, 0x38, 0x80, 0x00, 0x02, 0x84, 0x04, 0xd0, 0x80, 0x00, 0x0a, 0x90, 0x94, 
+0x8c, 0x08, 0x30, 0x00, 0x00, 0x10, 0x30, 0x88, 0x10, 0xbd, 0x00, 0x06, 0x22, 0x00, 0x04, 0x40, 
+0xc0, 0x40, 0x40, 0x81, 0xc0, 0x02, 0x80, 0x00, 0x00, 0x81, 0x80, 0x1b, 0x82, 0x84, 0x00, 0x01, 
+0x00, 0x01, 0x03, 0x18, 0x26, 0x98, 0x00, 0x1f, 0x1c, 0x40, 0xa0, 0x18, 0x00, 0xf0, 0x00, 0x3f, 
+0x06, 0x04, 0x00, 0x0f, 0x00, 0xe0, 0x80, 0x0f, 0x80, 0x00, 0x0c, 0x08, 0x22, 0x00, 0x1e, 0x00, 
+0x80, 0xa0, 0x20, 0x00, 0xc0, 0x10, 0x20, 0x92, 0xbc, 0x00, 0x1b, 0x0f, 0x00, 0x0e, 0x40, 0x00, 
+0xf0, 0x99, 0x99, 0x9f, 0xcf, 0xef, 0xef, 0xeb, 0xbb, 0xbb, 0xb8, 0x90, 0x97, 0x17, 0x17, 0x36, 
+0xf6, 0xc5, 0x01, 0x41, 0x00, 0x00, 0x0e, 0x84, 0x00, 0x05, 0xc0, 0x18, 0x84, 0x54, 0x01, 0xc0, 
+0x84, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0xb4, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x80, 
+0x85, 0x00, 0x05, 0x04, 0x00, 0x00, 0x20, 0x00, 0x40, 0x85, 0x00, 0x80, 0x01, 0x03, 0x09, 0x01, 
+0x00, 0x01, 0x85, 0x00, 0x00, 0x20, 0x81, 0x00, 0x05, 0x11, 0x30, 0x20, 0x00, 0x02, 0x20, 0xc3, 
+0x00, 0x07, 0x04, 0x00, 0x40, 0x80, 0x80, 0x00, 0x00, 0x05, 0xab, 0x00, 0x00, 0x01, 0xf7, 0x00, 
+0x17, 0x80, 0xc0, 0x20, 0x80, 0x00, 0x80, 0x00, 0x20, 0xe0, 0xc0, 0x60, 0x20, 0x00, 0xe0, 0x30, 
+0xf0, 0x00, 0x20, 0x20, 0x30, 0xd0, 0xd0, 0x50, 0x70, 0x81, 0x60, 0xe1, 0x00, 0x02, 0x3f, 0x70, 
+0xee, 0x80, 0xd0, 0x15, 0x5f, 0x0f, 0x3e, 0x1b, 0x80, 0x80, 0x04, 0x07, 0x1f, 0x03, 0x98, 0xb8, 
+0x43, 0x3c, 0x91, 0xc9, 0xd6, 0xfe, 0xea, 0xe2, 0xe6, 0xe0, 0x89, 0x00, 0x01, 0xff, 0x00, 0xba, 
+0x00, 0x00, 0x80, 0x8d, 0x00, 0x02, 0xc2, 0x08, 0xc0, 0x80, 0x00, 0x01, 0xc0, 0x04, 0x80, 0x00, 
+0x04, 0x04, 0x08, 0x00, 0x00, 0x30, 0x81, 0x00, 0x00, 0x38, 0x80, 0x00, 0x02, 0x84, 0x04, 0xd0, 
+0x80, 0x00, 0x0a, 0x90, 0x94, 0x8c, 0x08, 0x30, 0x00, 0x00, 0x10, 0x30, 0x88, 0x10, 0xba, 0x00, 
+0x09, 0x80, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x81, 0x80, 0x80, 0x8a, 0x00, 0x19, 0x01, 0x03, 
+0x00, 0x21, 0x03, 0x18, 0x26, 0x98, 0x00, 0x1f, 0x1c, 0x40, 0xa0, 0x18, 0x00, 0xf0, 0x00, 0x3f, 
+0x06, 0x04, 0x00, 0x0f, 0x00, 0xe0, 0xc0, 0x0f, 0x80, 0x00, 0x0c, 0x08, 0x22, 0x00, 0x1e, 0x00, 
+0x80, 0xa1, 0x20, 0x00, 0xe0, 0x10, 0x20, 0x92, 0xbc, 0x00, 0x18, 0x10, 0x80, 0x11, 0x00, 0x00, 
+0xc0, 0x61, 0x21, 0x23, 0x6f, 0xef, 0x63, 0x63, 0x23, 0x23, 0x20, 0x00, 0x06, 0x02, 0x08, 0x09, 
+0x87, 0xc6, 0x00, 0x01, 0x87, 0x00, 0x05, 0x80, 0x00, 0x00, 0x20, 0x05, 0x80, 0x84, 0x00, 0x00, 
+0x01, 0x88, 0x00, 0x00, 0x01, 0xb3, 0x00, 0x02, 0x40, 0x70, 0xb0, 0x80, 0x30, 0x02, 0x20, 0x40, 
+0x80, 0x83, 0x00, 0x06, 0x02, 0x00, 0x01, 0x00, 0x01, 0x01, 0x03, 0x80, 0x01, 0x00, 0x21, 0x82, 
+0x01, 0x06, 0x11, 0x01, 0x01, 0x05, 0x12, 0x08, 0x04, 0x84, 0x00, 0x01, 0x40, 0x80, 0x80, 0x00, 
+0x04, 0x25, 0x10, 0x08, 0x02, 0x80, 0xc4, 0x00, 0x0a, 0x04, 0x0f, 0x7c, 0x78, 0x71, 0xf4, 0xec, 
+0xe1, 0xe6, 0x60, 0x3f, 0xa3, 0x00, 0x00, 0x01, 0x80, 0x02, 0xce, 0x00, 0x01, 0x01, 0x01, 0xff, 
+0x00, 0xcc, 0x00, 0x01, 0xff, 0x00, 0xb6, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0xa0, 0x84, 0x00, 
+0x03, 0x80, 0x20, 0x00, 0x40, 0xe9, 0x00, 0x06, 0x10, 0x00, 0x02, 0x08, 0x00, 0x02, 0x01, 0x88, 
+0x00, 0x00, 0x01, 0xa3, 0x00, 0x03, 0x01, 0x00, 0x00, 0x10, 0xbf, 0x00, 0x15, 0x20, 0x00, 0x00, 
+0x80, 0x00, 0x00, 0x80, 0xc0, 0x40, 0x00, 0x80, 0x0c, 0x40, 0x40, 0x00, 0x00, 0x40, 0x40, 0x04, 
+0x00, 0x00, 0x40, 0x8a, 0x00, 0x05, 0x80, 0x20, 0x08, 0xa0, 0x00, 0x88, 0xc7, 0x00, 0x09, 0xc0, 
+0x30, 0x80, 0xc8, 0xa8, 0x08, 0x10, 0x30, 0x60, 0x80, 0x86, 0x00, 0x05, 0x01, 0x41, 0x12, 0x00, 
+0x80, 0xa0, 0x80, 0x00, 0x09, 0x20, 0xa1, 0x00, 0x10, 0x40, 0x08, 0x24, 0x12, 0x08, 0x04, 0x86, 
+0x00, 0x07, 0x44, 0x01, 0x00, 0x03, 0x08, 0x20, 0x01, 0xc4, 0xc6, 0x00, 0x05, 0x03, 0x06, 0x09, 
+0x03, 0x10, 0x05, 0x80, 0x00, 0x00, 0x01, 0xa6, 0x00, 0x01, 0x02, 0x01, 0xf7, 0x00, 0x0c, 0x80, 
+0xc0, 0x20, 0x00, 0x00, 0x80, 0x00, 0x20, 0xc0, 0x80, 0xe0, 0x00, 0x00, 0x80, 0x20, 0x0b, 0x00, 
+0x20, 0xc0, 0x00, 0x20, 0x80, 0x00, 0x40, 0x40, 0x50, 0x90, 0x80, 0xe1, 0x00, 0x1c, 0x3f, 0x60, 
+0xce, 0x80, 0x90, 0x8f, 0x3c, 0x5f, 0x3e, 0x1f, 0x01, 0x00, 0xc2, 0xc4, 0xd9, 0xe0, 0x80, 0x80, 
+0x7f, 0x00, 0x80, 0xb9, 0x80, 0x80, 0x84, 0xc4, 0xc5, 0xdf, 0x30, 0x88, 0x00, 0x00, 0xff, 0xff, 
+0xb8, 0xff, 0x01, 0x7f, 0x7f, 0x87, 0x3f, 0x01, 0x7f, 0x7f, 0x81, 0xff, 0x02, 0x03, 0x83, 0x0f, 
+0x80, 0xff, 0x10, 0x03, 0x03, 0x07, 0x03, 0xff, 0xff, 0x03, 0x07, 0x03, 0x03, 0x0f, 0x7f, 0x0f, 
+0x03, 0x03, 0xe7, 0x07, 0x80, 0xf3, 0x0f, 0x03, 0x0f, 0xff, 0x0f, 0x07, 0x77, 0x73, 0x73, 0xf7, 
+0x3f, 0x07, 0xe7, 0xf7, 0x37, 0x07, 0xef, 0xbb, 0xff, 0x08, 0x3f, 0x0f, 0x87, 0xe1, 0xf1, 0xfc, 
+0xfc, 0xfe, 0xfe, 0x85, 0xff, 0x2f, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xe1, 0x00, 0x00, 0x3f, 0xfc, 
+0xe0, 0xc7, 0x1f, 0x00, 0xf0, 0xfc, 0xc0, 0x9f, 0x9f, 0xc0, 0xf0, 0x00, 0xc0, 0xfe, 0xfc, 0xfe, 
+0xff, 0x00, 0x1f, 0x00, 0x0f, 0x3c, 0x3c, 0x9c, 0x89, 0xe1, 0xc0, 0x9e, 0xbe, 0xbe, 0x9f, 0x9f, 
+0x00, 0x00, 0xe1, 0xc0, 0x1e, 0x3f, 0xbc, 0xff, 0x02, 0x00, 0x00, 0x7f, 0x81, 0xff, 0x00, 0x7f, 
+0x80, 0x33, 0x84, 0x3f, 0x08, 0x33, 0xb1, 0xb3, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xe1, 0xd5, 0xff, 
+0x08, 0x3f, 0x0f, 0x07, 0xe7, 0x27, 0x07, 0x0f, 0x1f, 0x3f, 0x82, 0xff, 0x06, 0xfc, 0xf0, 0xe1, 
+0xc7, 0xcf, 0x9f, 0x1e, 0x81, 0x3e, 0x02, 0x7e, 0x7e, 0x3e, 0x80, 0x3f, 0x06, 0x1f, 0x9f, 0xcf, 
+0xc7, 0xe3, 0xf0, 0xfc, 0x84, 0xff, 0x08, 0x0f, 0x03, 0x01, 0x19, 0x39, 0x31, 0x33, 0x03, 0x07, 
+0xc8, 0xff, 0x07, 0xfc, 0xf8, 0xf1, 0xf3, 0xe6, 0xe0, 0xf0, 0xf8, 0x8c, 0xff, 0x81, 0xfe, 0x8e, 
+0xff, 0x82, 0xfe, 0xfa, 0xff, 0x02, 0x3f, 0x1f, 0x1f, 0x80, 0x0f, 0x02, 0x1f, 0x1f, 0x3f, 0x80, 
+0x0f, 0x09, 0x1f, 0x7f, 0x07, 0x07, 0x0f, 0x1f, 0x0f, 0x0f, 0x87, 0x87, 0x80, 0xc7, 0x00, 0xef, 
+0x96, 0xff, 0x00, 0xfe, 0xc8, 0xff, 0x03, 0xe0, 0xc0, 0x80, 0x0c, 0x80, 0x1f, 0x02, 0x1e, 0x00, 
+0x80, 0x80, 0x00, 0x0f, 0xf8, 0xe0, 0xc0, 0xc0, 0x80, 0xc0, 0xc0, 0x00, 0x00, 0x18, 0x18, 0x08, 
+0x08, 0x8d, 0x8f, 0x8f, 0x88, 0xff, 0x01, 0xff, 0x00, 0xb8, 0x00, 0x03, 0x80, 0x80, 0x40, 0x40, 
+0x85, 0x00, 0x03, 0x40, 0x40, 0x80, 0x80, 0x80, 0x00, 0x02, 0x82, 0x08, 0xc0, 0x80, 0x00, 0x01, 
+0xf0, 0x04, 0x80, 0x00, 0x04, 0x04, 0x08, 0x00, 0x00, 0x30, 0x81, 0x00, 0x00, 0x18, 0x80, 0x00, 
+0x02, 0x84, 0x04, 0xd0, 0x80, 0x00, 0x0a, 0x90, 0x94, 0x8c, 0x08, 0x30, 0x00, 0x00, 0x10, 0x30, 
+0x88, 0x10, 0xbb, 0x00, 0x09, 0xc0, 0x70, 0x98, 0xe6, 0x32, 0x0d, 0x04, 0x02, 0x00, 0x01, 0x84, 
+0x00, 0x1e, 0x01, 0x01, 0x02, 0x02, 0x04, 0x19, 0x01, 0x80, 0x39, 0xe3, 0x98, 0x26, 0x98, 0x00, 
+0x0f, 0x1c, 0x40, 0xa0, 0x18, 0x00, 0xf4, 0x00, 0x3f, 0x06, 0x04, 0x00, 0x0f, 0x00, 0xe0, 0xc0, 
+0x0f, 0x80, 0x00, 0x0c, 0x08, 0x22, 0x00, 0x1e, 0x80, 0x80, 0xa0, 0x20, 0x00, 0xf0, 0x10, 0x20, 
+0x90, 0xbd, 0x00, 0x03, 0xff, 0x80, 0x7f, 0xc0, 0x81, 0x00, 0x03, 0x4c, 0x50, 0x50, 0x48, 0x83, 
+0x40, 0x09, 0x00, 0x92, 0x40, 0x00, 0x00, 0x01, 0xff, 0x3f, 0xe1, 0x7f, 0x87, 0x00, 0x00, 0x01, 
+0x85, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0xb4, 0x00, 0x07, 0xc0, 0x10, 0x00, 0x20, 0xa0, 
+0x00, 0x00, 0x10, 0x83, 0x00, 0x19, 0x03, 0x0e, 0x19, 0x37, 0x2c, 0x58, 0x90, 0xa2, 0x22, 0x02, 
+0x00, 0x40, 0x00, 0x40, 0x41, 0x00, 0x00, 0x20, 0x80, 0x50, 0x48, 0x24, 0x13, 0x0d, 0x07, 0x03, 
+0x82, 0x00, 0x09, 0x30, 0x0c, 0x0e, 0x1e, 0x1a, 0x40, 0x40, 0xe0, 0x00, 0xf0, 0xc7, 0x00, 0x05, 
+0x02, 0x00, 0x01, 0x00, 0x15, 0x02, 0x8e, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x01, 0x01, 0x8c, 
+0x00, 0x01, 0x01, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x03, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 
+0x98, 0x00, 0x00, 0xff, 0xff, 0xba, 0xff, 0x03, 0x7f, 0x3f, 0x3f, 0x1f, 0x85, 0x9f, 0x06, 0x1f, 
+0x3f, 0x3f, 0x7f, 0x03, 0xc3, 0x0f, 0x80, 0xff, 0x10, 0x03, 0x03, 0x07, 0x03, 0xff, 0xff, 0x03, 
+0x07, 0x03, 0x03, 0x0f, 0x7f, 0x0f, 0x03, 0x03, 0xc7, 0x07, 0x80, 0xf3, 0x0f, 0x03, 0x0f, 0xff, 
+0x0f, 0x07, 0x77, 0x73, 0x77, 0xf7, 0x1f, 0x07, 0xe7, 0xf7, 0x37, 0x07, 0xef, 0xbe, 0xff, 0x06, 
+0x1f, 0x07, 0xc3, 0xf0, 0xf8, 0xfe, 0xfe, 0x89, 0xff, 0x2a, 0xfe, 0x00, 0x00, 0xf0, 0xe0, 0x00, 
+0x07, 0x1f, 0x00, 0xf8, 0xfc, 0xc0, 0x9f, 0x9f, 0xc0, 0xf0, 0x00, 0xc0, 0xfe, 0xfc, 0xfe, 0xff, 
+0x00, 0x1f, 0x00, 0x0f, 0x3c, 0x3c, 0x9c, 0x89, 0xe1, 0xc0, 0x9e, 0xbe, 0xbe, 0x9f, 0x9f, 0x00, 
+0x80, 0xe1, 0xc0, 0x1e, 0x3f, 0xbf, 0xff, 0x02, 0x80, 0x00, 0x3f, 0x80, 0xff, 0x02, 0xe7, 0xe3, 
+0x87, 0x84, 0x9f, 0x0a, 0x83, 0x83, 0x9f, 0x9f, 0x9e, 0xff, 0xff, 0x7f, 0x00, 0x80, 0xf0, 0xd3, 
+0xff, 0x08, 0x3f, 0x0f, 0xc7, 0xe7, 0x07, 0x07, 0x0f, 0x1f, 0x7f, 0x84, 0xff, 0x06, 0xfe, 0xfc, 
+0xf0, 0xe3, 0xe7, 0xcf, 0xcf, 0x80, 0x9f, 0x03, 0x1f, 0x3f, 0x3f, 0x1f, 0x80, 0x9f, 0x06, 0x8f, 
+0xcf, 0xe7, 0xe3, 0xf1, 0xf8, 0xfe, 0x82, 0xff, 0x09, 0x1f, 0x0f, 0x0f, 0x07, 0x07, 0x63, 0xe3, 
+0x87, 0x0f, 0x3f, 0xc7, 0xff, 0x07, 0xfc, 0xf8, 0xf1, 0xf3, 0xe2, 0xe0, 0xf0, 0xfc, 0xa2, 0xff, 
+0x00, 0xfe, 0x80, 0xfc, 0x04, 0xf8, 0xf9, 0xf8, 0xfc, 0xfe, 0xf4, 0xff, 0x12, 0x3f, 0x1f, 0xcf, 
+0xcf, 0xef, 0xcf, 0x9f, 0x3f, 0x3f, 0xff, 0x0f, 0x0f, 0x7f, 0xff, 0x0f, 0x0f, 0xff, 0x1f, 0x8f, 
+0x80, 0xef, 0x9a, 0xff, 0x00, 0xfe, 0xc8, 0xff, 0x02, 0xf1, 0xc0, 0x9f, 0x81, 0x3f, 0x0b, 0x9f, 
+0x8f, 0xc0, 0xf0, 0x00, 0xfe, 0xf8, 0xe3, 0xc7, 0x80, 0xff, 0xc0, 0x80, 0x9e, 0x02, 0xde, 0xcf, 
+0xef, 0x8c, 0xff, 0x01, 0xff, 0x00, 0xbd, 0x00, 0x02, 0x80, 0x00, 0x10, 0x83, 0x50, 0x07, 0x90, 
+0xa0, 0xa0, 0x60, 0x00, 0xc2, 0x08, 0xc0, 0x80, 0x00, 0x01, 0xe0, 0x04, 0x80, 0x00, 0x04, 0x04, 
+0x08, 0x00, 0x00, 0x30, 0x81, 0x00, 0x00, 0x38, 0x80, 0x00, 0x02, 0x84, 0x04, 0xd0, 0x80, 0x00, 
+0x0a, 0x90, 0x94, 0x88, 0x08, 0x10, 0x00, 0x00, 0x10, 0x30, 0x88, 0x10, 0xbe, 0x00, 0x07, 0x60, 
+0x08, 0xc0, 0x11, 0x00, 0x02, 0x00, 0x00, 0x80, 0xc0, 0x85, 0x00, 0x19, 0x01, 0x07, 0x80, 0x0c, 
+0x18, 0xe0, 0x06, 0x18, 0x00, 0x07, 0x1c, 0x40, 0xa0, 0x18, 0x00, 0xf0, 0x00, 0x3f, 0x06, 0x04, 
+0x00, 0x0f, 0x00, 0xe0, 0xc0, 0x0f, 0x80, 0x00, 0x0c, 0x08, 0x22, 0x00, 0x1e, 0x00, 0x80, 0xa0, 
+0x20, 0x00, 0x60, 0x10, 0x20, 0x90, 0xc0, 0x00, 0x09, 0x70, 0x80, 0x38, 0xc0, 0x00, 0x00, 0x18, 
+0x1c, 0x7b, 0x53, 0x80, 0x70, 0x0d, 0x50, 0x50, 0x40, 0x40, 0x03, 0x07, 0x00, 0x01, 0x60, 0x00, 
+0x80, 0x3f, 0x80, 0x30, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 
+0xb5, 0x00, 0x05, 0xc0, 0x00, 0xc0, 0x00, 0x40, 0x08, 0x87, 0x00, 0x12, 0x01, 0x02, 0x0c, 0x1b, 
+0x16, 0x2c, 0x28, 0x50, 0x50, 0x10, 0x80, 0xa0, 0xa0, 0x80, 0x00, 0x00, 0x50, 0x40, 0x08, 0x81, 
+0x00, 0x00, 0x02, 0x82, 0x00, 0x0a, 0xe0, 0x10, 0x10, 0x08, 0x08, 0x24, 0x04, 0x40, 0x00, 0x20, 
+0x80, 0xc6, 0x00, 0x07, 0x02, 0x04, 0x09, 0x02, 0x12, 0x10, 0x00, 0x04, 0xa4, 0x00, 0x00, 0x04, 
+0x80, 0x00, 0x02, 0x09, 0x04, 0x02, 0xff, 0x00, 0xff, 0x00, 0x97, 0x00, 0x00, 0xff, 0xff, 0xb9, 
+0xff, 0x07, 0x7f, 0x3f, 0x3f, 0x9f, 0x8f, 0xcf, 0xcf, 0xc7, 0x82, 0xe7, 0x07, 0xc7, 0xcf, 0xcf, 
+0x8f, 0x1f, 0x3f, 0x3f, 0x7f, 0x85, 0xff, 0x05, 0xef, 0xef, 0x07, 0x07, 0x03, 0x03, 0x84, 0xff, 
+0x01, 0x0f, 0x03, 0xce, 0xff, 0x04, 0x0f, 0x03, 0xe1, 0xf8, 0xfe, 0x83, 0xff, 0x02, 0xe7, 0xe7, 
+0xef, 0x84, 0xff, 0x05, 0x9f, 0x9c, 0xf8, 0xc1, 0x03, 0x1f, 0x82, 0xff, 0x82, 0x80, 0x00, 0xe0, 
+0x84, 0xff, 0x09, 0xf0, 0x00, 0xf9, 0x79, 0x03, 0x8f, 0x07, 0x33, 0x23, 0x37, 0xc6, 0xff, 0x03, 
+0xe0, 0x80, 0x0f, 0x3f, 0x80, 0xff, 0x05, 0xef, 0xc7, 0xc3, 0x83, 0x8b, 0x9b, 0x80, 0x93, 0x03, 
+0xd7, 0xc7, 0xc7, 0xf7, 0x80, 0xff, 0x03, 0x3f, 0x0f, 0x80, 0xf0, 0x87, 0xff, 0x0e, 0xe7, 0xcf, 
+0x9f, 0x9f, 0x1f, 0x0f, 0x1f, 0x8f, 0x1f, 0x3e, 0x1e, 0xfe, 0x1f, 0x3f, 0x1f, 0x80, 0x9f, 0xc2, 
+0xff, 0x81, 0x3f, 0x09, 0x7f, 0xff, 0xff, 0xfc, 0xf8, 0xf1, 0xf3, 0xe3, 0xe7, 0xc7, 0x84, 0xcf, 
+0x06, 0xe7, 0xe7, 0xe3, 0xf3, 0xf1, 0xf8, 0xfc, 0x81, 0xff, 0x17, 0x7f, 0x1f, 0x1f, 0x0f, 0x47, 
+0xe7, 0xc7, 0x8f, 0x0f, 0x1f, 0x1f, 0x87, 0xe0, 0xfc, 0xfc, 0xf8, 0xf3, 0xf8, 0xf8, 0xf0, 0xf3, 
+0xf0, 0xfc, 0xf8, 0xc3, 0xff, 0x0c, 0x7f, 0x03, 0x00, 0xf0, 0xff, 0xe0, 0xc0, 0xc3, 0xe3, 0xf3, 
+0xc3, 0x07, 0x1f, 0x92, 0xff, 0x01, 0xfe, 0xfc, 0x82, 0xf8, 0x02, 0xf9, 0xf8, 0xf8, 0xd1, 0xff, 
+0x03, 0xfc, 0xf0, 0xe0, 0xc7, 0x82, 0xcf, 0x03, 0xe7, 0xe1, 0xf0, 0xf8, 0xc7, 0xff, 0x00, 0xfe, 
+0xf0, 0xff, 0x01, 0xff, 0x00, 0xba, 0x00, 0x06, 0x40, 0x00, 0x80, 0x10, 0x50, 0x40, 0x08, 0x81, 
+0x28, 0x08, 0x68, 0x58, 0x50, 0xd0, 0xb0, 0x60, 0x40, 0xc0, 0x80, 0xe4, 0x00, 0x04, 0xe0, 0x08, 
+0xc0, 0x11, 0x04, 0x83, 0x00, 0x03, 0x18, 0x20, 0x20, 0x10, 0x82, 0x00, 0x07, 0x01, 0x61, 0x87, 
+0x0c, 0x7b, 0xc6, 0x3c, 0xe0, 0x87, 0x00, 0x00, 0x20, 0xd6, 0x00, 0x1b, 0x3f, 0xe0, 0x9f, 0x70, 
+0xc0, 0x00, 0x00, 0x60, 0x60, 0x48, 0x6c, 0x0c, 0x04, 0x5c, 0x54, 0x54, 0x74, 0x24, 0x38, 0x38, 
+0x08, 0x00, 0x00, 0x80, 0x20, 0x0f, 0x60, 0x0f, 0xde, 0x00, 0x81, 0xc0, 0x09, 0x80, 0x03, 0x07, 
+0x0d, 0x1b, 0x16, 0x34, 0x2c, 0x68, 0x58, 0x83, 0x50, 0x16, 0x00, 0x28, 0x20, 0x04, 0x00, 0x00, 
+0x20, 0x72, 0xf8, 0xf8, 0xfc, 0xee, 0x66, 0x2c, 0x6c, 0x68, 0x00, 0xe8, 0xd8, 0x70, 0xf0, 0xe0, 
+0x80, 0xd0, 0x00, 0x15, 0x80, 0xfc, 0xff, 0x0f, 0x00, 0x1f, 0x3f, 0x3c, 0x1c, 0xf0, 0xc2, 0x06, 
+0xee, 0x7e, 0xfc, 0xe0, 0xf0, 0x30, 0x70, 0xf0, 0xe0, 0xc0, 0x87, 0x00, 0x03, 0x01, 0x01, 0x00, 
+0x03, 0x83, 0x06, 0x01, 0x07, 0x07, 0xd1, 0x00, 0x03, 0x03, 0x0f, 0x1f, 0x38, 0x82, 0x30, 0x04, 
+0x27, 0xe1, 0xef, 0xc7, 0x80, 0x80, 0x81, 0x05, 0xc0, 0xc0, 0xe0, 0x7f, 0x7f, 0x1f, 0xf1, 0x00, 
+0x84, 0x01, 0xb6, 0x00, 0x01, 0xff, 0x00, 0xb9, 0x00, 0x06, 0x80, 0x80, 0xc0, 0xe0, 0x60, 0x60, 
+0x70, 0x82, 0x30, 0x06, 0x70, 0x60, 0x60, 0xe0, 0xc0, 0x80, 0x80, 0xe3, 0x00, 0x1d, 0x80, 0xc0, 
+0xe0, 0x80, 0xc8, 0x04, 0x17, 0x1f, 0x0d, 0x0c, 0x06, 0x06, 0xc6, 0xe6, 0xee, 0x3e, 0x3e, 0x06, 
+0x06, 0x0e, 0x0c, 0x1c, 0x38, 0xf1, 0x81, 0x07, 0x8f, 0x7c, 0xf8, 0xc0, 0xdb, 0x00, 0x0a, 0xc0, 
+0xf8, 0x7c, 0x0f, 0x03, 0x01, 0x00, 0x3f, 0xff, 0xe0, 0x80, 0x80, 0x00, 0x16, 0x60, 0x70, 0x71, 
+0x51, 0x70, 0x70, 0x38, 0xb8, 0x38, 0x18, 0x0c, 0x00, 0x00, 0x80, 0xff, 0xff, 0x66, 0x00, 0x9f, 
+0xff, 0xc0, 0xc0, 0x80, 0xd8, 0x00, 0x05, 0x0f, 0x3f, 0xf8, 0xe0, 0xc0, 0x80, 0x80, 0x00, 0x21, 
+0x73, 0x7f, 0x76, 0x30, 0x24, 0x2c, 0x2e, 0x7e, 0x6e, 0x67, 0xe3, 0xa1, 0xa1, 0x80, 0x10, 0x08, 
+0x2c, 0x36, 0x1f, 0x0b, 0x01, 0x28, 0x6f, 0xf6, 0xf4, 0xe0, 0xf7, 0xf9, 0xd3, 0x93, 0x98, 0xb8, 
+0xf0, 0xe0, 0xd6, 0x00, 0x00, 0x01, 0x80, 0x03, 0x16, 0x07, 0x06, 0x06, 0xfa, 0xf8, 0xf8, 0x08, 
+0x79, 0xff, 0xe3, 0xf3, 0x2f, 0x8f, 0x06, 0xde, 0x3c, 0xf0, 0xf8, 0x38, 0x70, 0xe0, 0xc0, 0x80, 
+0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x82, 0x01, 0xdd, 0x00, 0x04, 0x3f, 0xff, 0xe0, 0xc0, 0x80, 
+0x80, 0x81, 0x0b, 0xc0, 0xcf, 0xdf, 0x07, 0x9f, 0xdf, 0xc0, 0xc0, 0xe0, 0x60, 0x7f, 0x1f, 0xeb, 
+0x00, 0x84, 0x01, 0x82, 0x00, 0x00, 0x01, 0xb0, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xb0, 0x00, 
+0x17, 0x80, 0xc0, 0xe0, 0x60, 0x30, 0x38, 0x18, 0x1c, 0x0c, 0x0c, 0x06, 0x06, 0xc6, 0x66, 0x36, 
+0xe6, 0xe6, 0x76, 0x36, 0x7e, 0xec, 0xdc, 0x38, 0xf0, 0x80, 0xe0, 0xd8, 0x00, 0x0b, 0xc0, 0xe0, 
+0x70, 0x38, 0x1c, 0x0e, 0xc6, 0xff, 0x7f, 0x0c, 0x00, 0x02, 0x81, 0x03, 0x1a, 0x07, 0x06, 0x0e, 
+0x0c, 0x1c, 0xf8, 0xf1, 0xc2, 0x07, 0x0f, 0x0f, 0x87, 0x0e, 0x1c, 0x1e, 0x0f, 0x03, 0x80, 0xff, 
+0xff, 0xe6, 0xe0, 0x60, 0xe0, 0xc0, 0xc0, 0x80, 0xd1, 0x00, 0x02, 0xff, 0xff, 0x01, 0x81, 0x00, 
+0x23, 0x0f, 0x3f, 0x88, 0x98, 0xac, 0xb8, 0x18, 0x00, 0x00, 0x70, 0x78, 0x78, 0x2c, 0x3c, 0x14, 
+0x1d, 0x0f, 0x81, 0xf8, 0x7b, 0xc1, 0xc1, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x07, 0x0f, 0x0f, 
+0x1e, 0x0e, 0x0c, 0x1c, 0x19, 0x80, 0x1f, 0xcf, 0x00, 0x07, 0x03, 0x0f, 0x1e, 0x78, 0xe0, 0xc0, 
+0x80, 0x80, 0x80, 0x00, 0x1b, 0x31, 0x1b, 0x0b, 0x0f, 0x0b, 0x00, 0x00, 0x85, 0x86, 0xc6, 0xe6, 
+0x77, 0x3f, 0x1c, 0x04, 0x1b, 0xc1, 0x09, 0xd8, 0xe2, 0x88, 0x80, 0x44, 0x6c, 0xd8, 0xf0, 0x70, 
+0xc0, 0xdc, 0x00, 0x00, 0x01, 0x81, 0x03, 0x81, 0x06, 0x00, 0x07, 0x80, 0x03, 0x01, 0x01, 0x01, 
+0x83, 0x00, 0x0c, 0x0f, 0x3e, 0x67, 0xff, 0xf8, 0xb0, 0xa0, 0x00, 0x00, 0x0f, 0x24, 0x1f, 0x0f, 
+0xf5, 0x00, 0x00, 0x01, 0xb0, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xbc, 0x00, 0x09, 0xc0, 0x60, 
+0x30, 0x10, 0x58, 0x68, 0x08, 0x00, 0x00, 0x40, 0x90, 0x00, 0x00, 0x20, 0xc8, 0x00, 0x05, 0x80, 
+0x20, 0x10, 0x48, 0x24, 0x10, 0x87, 0x00, 0x11, 0x04, 0x01, 0x08, 0x02, 0x10, 0x24, 0x08, 0x11, 
+0x40, 0x04, 0x0c, 0x0c, 0x00, 0x00, 0x13, 0x19, 0x0e, 0x03, 0xa0, 0x00, 0x00, 0x20, 0xb6, 0x00, 
+0x03, 0xfe, 0x00, 0xfc, 0x01, 0x81, 0x00, 0x13, 0xc0, 0xe0, 0x90, 0xb8, 0x6c, 0x38, 0x18, 0x00, 
+0x00, 0x80, 0xb8, 0xb8, 0x9c, 0x08, 0x00, 0x03, 0x02, 0x70, 0x03, 0xf8, 0xe1, 0x00, 0x28, 0x01, 
+0x0c, 0x11, 0x26, 0x08, 0x20, 0x00, 0x00, 0x80, 0x7d, 0x7f, 0x7f, 0x0a, 0x23, 0x13, 0x15, 0x15, 
+0x1f, 0x0f, 0x0e, 0x47, 0x23, 0x90, 0x48, 0x22, 0x10, 0x06, 0x0a, 0x01, 0x00, 0x08, 0x80, 0x44, 
+0x46, 0x4a, 0x12, 0x34, 0x2c, 0xc8, 0x30, 0xe0, 0xda, 0x00, 0x05, 0x01, 0x02, 0x00, 0x00, 0x04, 
+0x05, 0x86, 0x00, 0x00, 0x01, 0x84, 0x00, 0x0b, 0x01, 0x1c, 0x10, 0x26, 0x68, 0x58, 0xd0, 0x50, 
+0x48, 0x27, 0x10, 0x08, 0xff, 0x00, 0xa7, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xbb, 0x00, 0x0a, 
+0xe0, 0x30, 0x10, 0x08, 0x68, 0xa4, 0x20, 0xc8, 0x90, 0xe0, 0x80, 0xdc, 0x00, 0x09, 0x80, 0x20, 
+0x10, 0x48, 0x24, 0x10, 0x02, 0x00, 0x01, 0x04, 0x85, 0x00, 0x00, 0x08, 0x80, 0x00, 0x0a, 0x81, 
+0x02, 0x40, 0x00, 0x00, 0x04, 0x01, 0x09, 0x0c, 0x07, 0x01, 0xdb, 0x00, 0x0b, 0x9e, 0x00, 0xfc, 
+0x01, 0x00, 0x00, 0x80, 0xc0, 0x00, 0x20, 0xe0, 0xc0, 0x82, 0x00, 0x0a, 0xb0, 0x88, 0x88, 0x9c, 
+0x08, 0x00, 0x00, 0x02, 0x00, 0x03, 0x30, 0xa3, 0x00, 0x00, 0x02, 0xba, 0x00, 0x29, 0x01, 0x08, 
+0x01, 0x04, 0x00, 0x20, 0x01, 0x03, 0x03, 0x7e, 0x7f, 0x7f, 0x22, 0x27, 0x07, 0x05, 0x15, 0x17, 
+0x0f, 0x8f, 0x47, 0x23, 0x90, 0x48, 0x22, 0x10, 0x06, 0x01, 0x20, 0x84, 0x11, 0x50, 0x22, 0x21, 
+0x2d, 0x08, 0x0a, 0x12, 0x24, 0x08, 0x10, 0xc0, 0xda, 0x00, 0x00, 0x02, 0x85, 0x00, 0x01, 0x01, 
+0x04, 0x80, 0x00, 0x00, 0x01, 0x85, 0x00, 0x0a, 0x02, 0x0c, 0x11, 0x16, 0x24, 0x28, 0x28, 0x20, 
+0x02, 0x00, 0x04, 0xff, 0x00, 0xa7, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xb9, 0x00, 0x0a, 0xc0, 
+0xe0, 0x00, 0x10, 0x80, 0xc8, 0xe8, 0xfc, 0xf8, 0xf0, 0xe0, 0xdf, 0x00, 0x09, 0x40, 0x00, 0x80, 
+0x00, 0x04, 0x00, 0x08, 0x00, 0x01, 0x04, 0x82, 0x00, 0x0e, 0x01, 0x00, 0x08, 0x00, 0x03, 0x07, 
+0x06, 0x04, 0x0c, 0x0f, 0x1f, 0x08, 0x01, 0x06, 0x03, 0xdd, 0x00, 0x01, 0x60, 0x01, 0x84, 0x00, 
+0x00, 0x40, 0x83, 0x00, 0x03, 0x20, 0x40, 0xc0, 0xb0, 0x82, 0x00, 0x02, 0x70, 0x00, 0xc8, 0xe3, 
+0x00, 0x00, 0x10, 0x82, 0x00, 0x00, 0x01, 0x80, 0x00, 0x07, 0x18, 0x64, 0xe2, 0xeb, 0xef, 0x77, 
+0x19, 0x01, 0x87, 0x00, 0x04, 0x08, 0x00, 0x82, 0x21, 0x24, 0x81, 0x00, 0x02, 0xc4, 0x00, 0x20, 
+0xda, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0x83, 0x00, 0x03, 0x01, 0x00, 0x00, 0x02, 0x86, 0x00, 
+0x04, 0x01, 0x00, 0x08, 0x00, 0x10, 0x80, 0x00, 0x03, 0x02, 0x01, 0x04, 0x01, 0xff, 0x00, 0xa6, 
+0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xb9, 0x00, 0x08, 0xc0, 0x60, 0x20, 0x20, 0x10, 0xd0, 0x90, 
+0x60, 0xc0, 0xe5, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x04, 0x82, 0x00, 0x0d, 0x01, 0x00, 0x08, 
+0x02, 0x00, 0x20, 0x08, 0x1b, 0x37, 0x10, 0x13, 0x0c, 0x07, 0x01, 0xe1, 0x00, 0x06, 0x02, 0x00, 
+0x00, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x01, 0x80, 0x80, 0x81, 0x00, 0x03, 0x01, 0x88, 0x00, 
+0x04, 0xe2, 0x00, 0x11, 0x04, 0x00, 0x02, 0x08, 0x00, 0x01, 0x00, 0x81, 0x00, 0x01, 0x00, 0x00, 
+0x68, 0xe2, 0xeb, 0xf7, 0x67, 0x11, 0x82, 0x00, 0x12, 0x04, 0x00, 0x00, 0x08, 0x00, 0x44, 0x00, 
+0x20, 0x00, 0x00, 0x01, 0x18, 0x00, 0x08, 0x10, 0x00, 0x08, 0x00, 0x80, 0xd9, 0x00, 0x03, 0x02, 
+0x00, 0x00, 0x05, 0x83, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x0a, 0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 
+0x00, 0x04, 0x10, 0x08, 0x02, 0xff, 0x00, 0xa6, 0x00, 0x00, 0xff, 0xff, 0xc7, 0xff, 0x18, 0x1f, 
+0x01, 0xf3, 0x79, 0x39, 0x03, 0x77, 0x77, 0xe7, 0x07, 0xe7, 0xe7, 0x27, 0x0f, 0xc7, 0xe7, 0xf7, 
+0xf7, 0xff, 0xff, 0x3f, 0x1f, 0xcf, 0xe7, 0xef, 0x80, 0xff, 0x07, 0x1f, 0x8f, 0xc7, 0xe7, 0xf7, 
+0xff, 0x1f, 0xc7, 0x80, 0xe7, 0x07, 0xff, 0xe7, 0xe7, 0xc7, 0x0f, 0xef, 0xcf, 0xcf, 0xce, 0xff, 
+0x24, 0x00, 0x00, 0x7e, 0x7e, 0x3e, 0x3e, 0x8f, 0x80, 0xc0, 0xc0, 0xdf, 0xdf, 0xc0, 0xc7, 0x9e, 
+0x9e, 0xde, 0xcc, 0xe1, 0xe1, 0xc0, 0x9f, 0xbb, 0x93, 0x9b, 0xdb, 0xc3, 0xe0, 0x80, 0x1b, 0x39, 
+0x79, 0x79, 0x3c, 0x98, 0x99, 0x3b, 0x80, 0x39, 0x04, 0x99, 0x81, 0xe3, 0xc0, 0x01, 0xb2, 0xff, 
+0x08, 0x3f, 0x1f, 0x8f, 0xc7, 0xe3, 0xf3, 0xf9, 0xf9, 0xf8, 0x83, 0xfc, 0x08, 0xf8, 0xf9, 0xf1, 
+0xf3, 0xe3, 0xc7, 0x8f, 0x1f, 0x7f, 0x84, 0xff, 0x01, 0xfe, 0xfe, 0xda, 0xff, 0x03, 0x07, 0x00, 
+0x70, 0xfe, 0x80, 0xff, 0x03, 0x3f, 0xbf, 0x3f, 0x3f, 0x82, 0xff, 0x02, 0x8f, 0x8f, 0xdf, 0x82, 
+0xff, 0x02, 0xfe, 0x00, 0x01, 0xe3, 0xff, 0x08, 0xf8, 0xe0, 0xc3, 0x8f, 0x1f, 0x3f, 0x7e, 0xfe, 
+0xfe, 0x80, 0xff, 0x00, 0xf7, 0x80, 0xf3, 0x18, 0xf9, 0xfd, 0x7d, 0x7f, 0x3f, 0x1f, 0x8f, 0xc3, 
+0xf0, 0xfc, 0xf1, 0xe0, 0x84, 0x01, 0x21, 0xe3, 0xc1, 0xc0, 0xf9, 0xf9, 0xf1, 0xe3, 0x87, 0x0f, 
+0x3f, 0xd9, 0xff, 0x00, 0xfe, 0x80, 0xfc, 0x00, 0xf8, 0x83, 0xf9, 0x04, 0xf8, 0xfc, 0xfc, 0xfe, 
+0xfe, 0x85, 0xff, 0x04, 0xfe, 0xfc, 0xf0, 0xf1, 0xe3, 0x80, 0xe7, 0x03, 0xe3, 0xf0, 0xf8, 0xfe, 
+0xb3, 0xff, 0x00, 0xfe, 0xf0, 0xff, 0x01, 0xff, 0x00, 0xc7, 0x00, 0x18, 0xe0, 0x02, 0x08, 0x80, 
+0x42, 0x00, 0x70, 0x90, 0x00, 0x00, 0xc0, 0x80, 0x38, 0xc0, 0x20, 0x00, 0x00, 0x08, 0x00, 0xc0, 
+0x20, 0x80, 0x00, 0x28, 0x10, 0x80, 0x00, 0x0a, 0x20, 0x90, 0x08, 0x00, 0x10, 0x80, 0x10, 0x08, 
+0x00, 0x00, 0x10, 0x80, 0x08, 0x02, 0x48, 0x00, 0x20, 0xd0, 0x00, 0x02, 0x4f, 0x00, 0x01, 0x80, 
+0x00, 0x17, 0x11, 0x04, 0x40, 0x40, 0x0f, 0x0f, 0x00, 0x48, 0x02, 0x02, 0x42, 0x00, 0x00, 0x01, 
+0x0f, 0x40, 0x28, 0x00, 0x08, 0x10, 0x08, 0x00, 0x40, 0x82, 0x80, 0x00, 0x0b, 0x43, 0xa0, 0x68, 
+0x48, 0x42, 0x40, 0x00, 0x00, 0x42, 0x14, 0x40, 0xfe, 0xb2, 0x00, 0x02, 0x40, 0x00, 0x80, 0x80, 
+0x00, 0x02, 0x08, 0x00, 0x01, 0x85, 0x00, 0x07, 0x08, 0x02, 0x00, 0x20, 0x08, 0x00, 0x40, 0x80, 
+0x84, 0x00, 0x00, 0x01, 0xda, 0x00, 0x03, 0xf8, 0x01, 0x70, 0x02, 0x80, 0x00, 0x02, 0xc0, 0x80, 
+0x80, 0x83, 0x00, 0x0b, 0x50, 0x80, 0xd0, 0xc0, 0x60, 0x20, 0x30, 0xb0, 0xe1, 0xf8, 0x01, 0xfc, 
+0xe2, 0x00, 0x28, 0x04, 0x10, 0x02, 0x08, 0x00, 0x00, 0x01, 0x80, 0x78, 0x5f, 0x56, 0x72, 0x7b, 
+0x3f, 0x3f, 0x15, 0x0f, 0x0e, 0x8e, 0x04, 0x06, 0x06, 0x03, 0x04, 0x10, 0x04, 0x01, 0x00, 0x44, 
+0x09, 0x30, 0x80, 0x00, 0x01, 0x10, 0x00, 0x00, 0x10, 0x44, 0x08, 0x20, 0xda, 0x00, 0x03, 0x02, 
+0x00, 0x00, 0x04, 0x86, 0x00, 0x00, 0x02, 0x86, 0x00, 0x04, 0x01, 0x02, 0x08, 0x00, 0x10, 0x80, 
+0x00, 0x03, 0x04, 0x11, 0x08, 0x02, 0xff, 0x00, 0xa5, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xaf, 
+0x00, 0x84, 0x80, 0x96, 0x00, 0x00, 0x08, 0x86, 0x00, 0x00, 0x08, 0x8d, 0x00, 0x00, 0x08, 0xb8, 
+0x00, 0x09, 0xc0, 0x60, 0x90, 0xcc, 0x34, 0x12, 0x0a, 0x0d, 0x05, 0x05, 0x82, 0x02, 0x0a, 0x00, 
+0x04, 0x05, 0x01, 0x00, 0x10, 0x24, 0x08, 0x00, 0x00, 0x80, 0xe2, 0x00, 0x03, 0xfe, 0x01, 0xfe, 
+0x03, 0x81, 0x00, 0x02, 0x40, 0x80, 0x00, 0x81, 0x80, 0x0c, 0xc0, 0xf0, 0x08, 0x08, 0x80, 0x00, 
+0x20, 0xf0, 0x30, 0xe3, 0xf8, 0x01, 0xfc, 0xe1, 0x00, 0x29, 0x01, 0x04, 0x00, 0x02, 0x08, 0x00, 
+0x00, 0x40, 0x78, 0x84, 0xe8, 0xe5, 0x93, 0x92, 0x53, 0x13, 0x29, 0x99, 0x94, 0xd4, 0x48, 0x2a, 
+0x91, 0x4c, 0x27, 0x18, 0x06, 0x09, 0x00, 0x44, 0x00, 0x20, 0x00, 0x20, 0x28, 0x15, 0x00, 0x08, 
+0x10, 0x40, 0x08, 0x20, 0xd9, 0x00, 0x04, 0x01, 0x00, 0x02, 0x00, 0x00, 0x83, 0x05, 0x04, 0x04, 
+0x02, 0x02, 0x03, 0x01, 0x87, 0x00, 0x02, 0x04, 0x09, 0x02, 0x81, 0x14, 0x02, 0x11, 0x08, 0x02, 
+0xff, 0x00, 0xa5, 0x00, 0x00, 0xff, 0xff, 0xc7, 0xff, 0x18, 0x1f, 0x01, 0xfb, 0x79, 0x39, 0x03, 
+0x77, 0x77, 0xe7, 0x07, 0xe7, 0xe7, 0x27, 0x0f, 0xc7, 0xe7, 0xf7, 0xf7, 0xff, 0xff, 0x3f, 0x1f, 
+0xcf, 0xe7, 0xef, 0x80, 0xff, 0x12, 0x1f, 0x8f, 0xc7, 0xe7, 0xf7, 0xff, 0x1f, 0xc7, 0xe7, 0xf7, 
+0xe7, 0xff, 0xe7, 0xe7, 0xc7, 0x0f, 0xef, 0xcf, 0xcf, 0xba, 0xff, 0x01, 0x7f, 0x7f, 0x8f, 0xff, 
+0x24, 0x00, 0x00, 0x7e, 0x7e, 0x3e, 0x3e, 0x8f, 0x80, 0xc0, 0xc0, 0xdf, 0xdf, 0xc0, 0xc7, 0x9e, 
+0x9e, 0xde, 0xcc, 0xe1, 0xe1, 0xc0, 0x9f, 0xbb, 0x93, 0x9b, 0xdb, 0xc3, 0xe0, 0x80, 0x1b, 0x3b, 
+0x79, 0x79, 0x3c, 0x98, 0x99, 0x3b, 0x80, 0x39, 0x04, 0x99, 0x81, 0xe3, 0xc0, 0x01, 0xb1, 0xff, 
+0x07, 0x3f, 0x1f, 0x87, 0xe7, 0xf3, 0xf1, 0xf9, 0xf8, 0x86, 0xfc, 0x07, 0xf9, 0xf9, 0xf3, 0xe3, 
+0xc7, 0x0f, 0x3f, 0x7f, 0x84, 0xff, 0x01, 0xfe, 0xfe, 0xda, 0xff, 0x02, 0x00, 0x00, 0xfe, 0x82, 
+0xff, 0x81, 0x3f, 0x81, 0xff, 0x0a, 0xef, 0xc7, 0xe7, 0xff, 0xff, 0x7f, 0x7f, 0xff, 0x70, 0x00, 
+0x87, 0xe2, 0xff, 0x0c, 0xfc, 0xf0, 0xe1, 0xc7, 0x8f, 0x1f, 0x3f, 0x7f, 0x63, 0xe8, 0xe8, 0xe1, 
+0xe1, 0x82, 0xf1, 0x0e, 0x78, 0x7c, 0x3c, 0x1e, 0x8e, 0xc3, 0xf0, 0xf8, 0xff, 0x7f, 0x11, 0x00, 
+0x00, 0x30, 0xe1, 0x81, 0xf3, 0x03, 0xe7, 0x47, 0x0f, 0x3f, 0xda, 0xff, 0x01, 0xfe, 0xfe, 0x80, 
+0xfc, 0x81, 0xf8, 0x80, 0xfc, 0x01, 0xfe, 0xfe, 0x85, 0xff, 0x0b, 0xfc, 0xf8, 0xf9, 0xf8, 0xf9, 
+0xf1, 0xf3, 0xf3, 0xf1, 0xf9, 0xf8, 0xfc, 0xb5, 0xff, 0x00, 0xfe, 0xf0, 0xff, 0x00, 0xff, 0xff, 
+0xc8, 0xff, 0x16, 0x03, 0xfb, 0xf9, 0x7b, 0x03, 0x07, 0xe7, 0xe7, 0x07, 0xe7, 0x67, 0x1f, 0xcf, 
+0xe7, 0xe7, 0xf7, 0xff, 0xff, 0x3f, 0x1f, 0x9f, 0xcf, 0xcf, 0x81, 0xff, 0x0f, 0x3f, 0x1f, 0xcf, 
+0xe7, 0xe7, 0x7f, 0x0f, 0xcf, 0xe7, 0xe7, 0xf7, 0xf7, 0xef, 0xef, 0x8f, 0x0f, 0x80, 0xcf, 0xce, 
+0xff, 0x0d, 0x4f, 0x00, 0x7f, 0x7e, 0x3e, 0x3e, 0x9e, 0x84, 0x80, 0x80, 0xd8, 0xd0, 0xc0, 0xcf, 
+0x80, 0x9c, 0x04, 0xcc, 0xe1, 0xe0, 0xc7, 0xdf, 0x80, 0x93, 0x12, 0xcb, 0xcb, 0xe0, 0xc0, 0x99, 
+0x39, 0x79, 0x79, 0x7f, 0x38, 0xf1, 0x73, 0x7b, 0x79, 0x39, 0x99, 0xc3, 0xf7, 0x80, 0xb1, 0xff, 
+0x09, 0x7f, 0x3f, 0x1f, 0x8f, 0xc7, 0xe7, 0xe3, 0xf3, 0xf3, 0xf1, 0x81, 0xf9, 0x09, 0xf1, 0xf3, 
+0xf3, 0xe3, 0xe7, 0xc7, 0x8f, 0x1f, 0x3f, 0x7f, 0x86, 0xff, 0x00, 0xfe, 0x88, 0xff, 0x14, 0x01, 
+0x00, 0x3c, 0x3c, 0xbe, 0xbe, 0xff, 0xff, 0x1f, 0x03, 0x03, 0x1f, 0x3f, 0xff, 0x01, 0x63, 0x8f, 
+0x1f, 0x7f, 0xc0, 0x03, 0xb9, 0xff, 0x03, 0x1f, 0x01, 0x00, 0xfc, 0x83, 0xff, 0x02, 0x3f, 0xbf, 
+0x3f, 0x82, 0xff, 0x02, 0xef, 0xc7, 0xc7, 0x80, 0xff, 0x03, 0xfc, 0x00, 0x01, 0xbf, 0x90, 0xff, 
+0x02, 0xfc, 0x80, 0x9f, 0x80, 0xff, 0x0f, 0x8f, 0xc1, 0xf8, 0xff, 0xff, 0xfc, 0xf0, 0xf3, 0xc0, 
+0xe0, 0xff, 0xff, 0xfc, 0xf8, 0xf0, 0xf8, 0xb8, 0xff, 0x06, 0xfe, 0xf0, 0xc0, 0x87, 0x1f, 0x3f, 
+0x7f, 0x80, 0xff, 0x07, 0xfe, 0xee, 0x8e, 0x8f, 0x1f, 0x0f, 0x07, 0xf7, 0x80, 0xff, 0x05, 0x7f, 
+0x3f, 0x1f, 0x87, 0x80, 0x10, 0x80, 0x1f, 0x02, 0x3f, 0x3f, 0x7f, 0x81, 0x3f, 0x00, 0x7f, 0xdc, 
+0xff, 0x04, 0xfe, 0xfc, 0xf8, 0xf9, 0xf9, 0x85, 0xf3, 0x04, 0xf9, 0xf9, 0xf8, 0xfc, 0xfe, 0x80, 
+0xff, 0x0d, 0xfe, 0xfe, 0xfc, 0xf8, 0xe0, 0x82, 0x86, 0x9e, 0x9f, 0x1f, 0x9e, 0x8c, 0xc0, 0xe0, 
+0xb7, 0xff, 0x00, 0xfe, 0xf0, 0xff, 0x01, 0xff, 0x00, 0xc7, 0x00, 0x07, 0xe0, 0x02, 0x08, 0x80, 
+0x42, 0x00, 0x70, 0x90, 0x80, 0x00, 0x0d, 0x80, 0x38, 0xc0, 0x20, 0x00, 0x00, 0x08, 0x00, 0xc0, 
+0x20, 0x80, 0x00, 0x28, 0x10, 0x81, 0x00, 0x09, 0x90, 0x08, 0x00, 0x10, 0x80, 0x10, 0x08, 0x00, 
+0x10, 0x10, 0x80, 0x08, 0x02, 0x48, 0x00, 0x20, 0xd0, 0x00, 0x02, 0x4f, 0x00, 0x01, 0x80, 0x00, 
+0x26, 0x11, 0x04, 0x40, 0x40, 0x07, 0x0f, 0x00, 0x08, 0x02, 0x02, 0x42, 0x00, 0x00, 0x01, 0x07, 
+0x40, 0x28, 0x00, 0x08, 0x10, 0x08, 0x00, 0x40, 0x82, 0x02, 0x00, 0x00, 0x43, 0x20, 0x68, 0x48, 
+0x42, 0x40, 0x00, 0x00, 0x42, 0x14, 0x40, 0xfe, 0xb0, 0x00, 0x09, 0x80, 0x40, 0x20, 0x90, 0x48, 
+0x28, 0x24, 0x14, 0x14, 0x02, 0x81, 0x0a, 0x09, 0x12, 0x14, 0x14, 0x24, 0x28, 0x48, 0x90, 0x20, 
+0x40, 0x80, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x02, 0x01, 0x01, 0x80, 0x22, 0x02, 0x80, 
+0x00, 0x0b, 0x04, 0x84, 0x00, 0x40, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x40, 0x03, 0xb9, 0x00, 
+0x04, 0x20, 0x02, 0x00, 0x04, 0x01, 0x80, 0x00, 0x04, 0x80, 0xc0, 0x00, 0xc0, 0xc0, 0x82, 0x00, 
+0x09, 0x60, 0x48, 0x18, 0x00, 0x00, 0x01, 0x04, 0x00, 0x02, 0xc0, 0x96, 0x00, 0x01, 0x40, 0x01, 
+0x80, 0x00, 0x0a, 0x02, 0x08, 0x12, 0x00, 0x1f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0b, 0xb8, 0x00, 
+0x20, 0x02, 0x10, 0x40, 0x88, 0x20, 0x40, 0x60, 0xf0, 0x19, 0x0b, 0x0e, 0x1c, 0x7d, 0x7c, 0xe8, 
+0x68, 0x60, 0x98, 0xb0, 0xe0, 0xc0, 0x80, 0x40, 0x20, 0x88, 0x80, 0x10, 0x00, 0x20, 0x20, 0x40, 
+0x40, 0x80, 0x81, 0x40, 0x00, 0x80, 0xdb, 0x00, 0x05, 0x01, 0x02, 0x04, 0x08, 0x09, 0x08, 0x80, 
+0x16, 0x82, 0x17, 0x05, 0x09, 0x09, 0x08, 0x04, 0x02, 0x01, 0x80, 0x00, 0x0c, 0x02, 0x04, 0x08, 
+0x20, 0x06, 0x9a, 0xa2, 0xa1, 0x01, 0x82, 0x00, 0x00, 0x01, 0xff, 0x00, 0xa9, 0x00, 0x01, 0xff, 
+0x00, 0xc7, 0x00, 0x18, 0xe0, 0x02, 0x08, 0x80, 0x42, 0x00, 0x70, 0x90, 0x00, 0x00, 0x80, 0x80, 
+0x38, 0xc0, 0x20, 0x00, 0x00, 0x08, 0x00, 0xc0, 0x20, 0x80, 0x00, 0x28, 0x10, 0x81, 0x00, 0x09, 
+0x90, 0x08, 0x00, 0x10, 0x80, 0x10, 0x08, 0x00, 0x10, 0x10, 0x80, 0x08, 0x02, 0x48, 0x00, 0x20, 
+0xd0, 0x00, 0x02, 0x6f, 0x00, 0x01, 0x80, 0x00, 0x26, 0x11, 0x04, 0x40, 0x40, 0x05, 0x0f, 0x00, 
+0x48, 0x02, 0x02, 0x42, 0x00, 0x00, 0x01, 0x07, 0x40, 0x28, 0x00, 0x08, 0x10, 0x08, 0x00, 0x40, 
+0x82, 0x02, 0x00, 0x00, 0x43, 0x20, 0x68, 0x48, 0x42, 0x40, 0x00, 0x00, 0x42, 0x14, 0x40, 0xfe, 
+0xb1, 0x00, 0x07, 0x80, 0x40, 0x20, 0x90, 0x50, 0x08, 0x28, 0x00, 0x82, 0x14, 0x08, 0x04, 0x00, 
+0x28, 0x08, 0x40, 0x90, 0x20, 0x40, 0x80, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x02, 0x01, 
+0x01, 0x80, 0x22, 0x02, 0x80, 0x00, 0x0b, 0x04, 0x84, 0x00, 0x40, 0x00, 0x00, 0x80, 0x08, 0x00, 
+0x00, 0x40, 0x03, 0xb9, 0x00, 0x05, 0x40, 0x04, 0x01, 0x08, 0x02, 0x01, 0x80, 0x00, 0x02, 0x40, 
+0xc0, 0x80, 0x82, 0x00, 0x09, 0xc0, 0xb0, 0xb0, 0x20, 0x00, 0x01, 0x02, 0x08, 0x01, 0x04, 0x97, 
+0x00, 0x01, 0x40, 0x01, 0x80, 0x00, 0x0a, 0x02, 0x08, 0x12, 0x00, 0x1f, 0x00, 0x00, 0x02, 0x00, 
+0x00, 0x0b, 0xb9, 0x00, 0x1d, 0x20, 0x80, 0x10, 0x40, 0x40, 0x00, 0x93, 0x2a, 0x18, 0x1c, 0x1d, 
+0x1c, 0x1c, 0x38, 0xa8, 0xa8, 0xb1, 0x11, 0x00, 0x00, 0x80, 0x80, 0x40, 0x10, 0x00, 0x00, 0x01, 
+0x00, 0x00, 0x40, 0xe1, 0x00, 0x15, 0x01, 0x02, 0x04, 0x08, 0x01, 0x11, 0x10, 0x04, 0x2c, 0x2c, 
+0x2d, 0x2d, 0x28, 0x28, 0x04, 0x10, 0x10, 0x00, 0x08, 0x04, 0x02, 0x01, 0x81, 0x00, 0x0a, 0x01, 
+0x02, 0x04, 0x18, 0x00, 0x00, 0x20, 0x00, 0x10, 0x40, 0x20, 0xff, 0x00, 0xa9, 0x00, 0x01, 0xff, 
+0x00, 0xd1, 0x00, 0x00, 0x40, 0xfc, 0x00, 0x02, 0x02, 0x00, 0x02, 0x88, 0x00, 0x01, 0x08, 0x10, 
+0x89, 0x00, 0x00, 0x02, 0xba, 0x00, 0x04, 0x20, 0x00, 0x40, 0x00, 0x28, 0x84, 0x00, 0x06, 0x08, 
+0x00, 0x40, 0x80, 0x20, 0x40, 0x80, 0xe4, 0x00, 0x04, 0x80, 0x18, 0x02, 0x31, 0x04, 0x80, 0x00, 
+0x01, 0x80, 0x80, 0x84, 0x00, 0x0a, 0xc0, 0x40, 0xc0, 0x00, 0x00, 0x01, 0x02, 0x0c, 0xe1, 0x04, 
+0x70, 0xe1, 0x00, 0x0a, 0x03, 0x30, 0xc0, 0x18, 0x40, 0x40, 0x60, 0xe3, 0xf4, 0xd4, 0x54, 0x80, 
+0x50, 0x17, 0x70, 0x70, 0xf0, 0xe2, 0x62, 0x63, 0x40, 0x00, 0x80, 0x80, 0x20, 0x0f, 0x00, 0x1e, 
+0x20, 0x00, 0x00, 0x40, 0x80, 0x80, 0x00, 0x40, 0x00, 0x80, 0xda, 0x00, 0x25, 0x01, 0x02, 0x04, 
+0x08, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x01, 0x01, 0x25, 0x00, 0x00, 0x10, 0x00, 
+0x00, 0x04, 0x02, 0x00, 0x01, 0x02, 0x04, 0x09, 0x33, 0x42, 0x84, 0x20, 0x00, 0x00, 0x02, 0x80, 
+0x0c, 0x01, 0x1e, 0xff, 0x00, 0xa8, 0x00, 0x01, 0xff, 0x00, 0xc7, 0x00, 0x18, 0xe0, 0x02, 0x08, 
+0x80, 0x42, 0x00, 0x70, 0x90, 0x00, 0x00, 0xc0, 0x80, 0x38, 0xc0, 0x20, 0x00, 0x00, 0x08, 0x00, 
+0xc0, 0x20, 0x80, 0x00, 0x28, 0x10, 0x81, 0x00, 0x09, 0x90, 0x08, 0x00, 0x10, 0x80, 0x10, 0x08, 
+0x00, 0x10, 0x10, 0x80, 0x08, 0x02, 0x48, 0x00, 0x20, 0xd0, 0x00, 0x02, 0x6f, 0x00, 0x01, 0x80, 
+0x00, 0x10, 0x11, 0x04, 0x40, 0x40, 0x07, 0x0f, 0x02, 0x48, 0x02, 0x02, 0x42, 0x00, 0x00, 0x01, 
+0x07, 0x40, 0x28, 0x80, 0x00, 0x12, 0x08, 0x00, 0x40, 0x82, 0x02, 0x00, 0x00, 0x43, 0xa0, 0x68, 
+0x48, 0x42, 0x42, 0x00, 0x00, 0x42, 0x14, 0x40, 0xfe, 0xb4, 0x00, 0x06, 0x20, 0x10, 0x40, 0x08, 
+0x28, 0x00, 0x04, 0x80, 0x14, 0x08, 0x04, 0x00, 0x20, 0x28, 0x00, 0x10, 0x80, 0x00, 0x40, 0x88, 
+0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x02, 0x01, 0x01, 0x80, 0x22, 0x02, 0x80, 0x00, 0x0b, 0x04, 
+0x84, 0x00, 0x40, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x40, 0x03, 0xba, 0x00, 0x02, 0x10, 0x00, 
+0x21, 0x8b, 0x00, 0x00, 0x80, 0x83, 0x00, 0x02, 0x10, 0x02, 0x08, 0x96, 0x00, 0x01, 0x40, 0x01, 
+0x80, 0x00, 0x0a, 0x02, 0x08, 0x12, 0x00, 0x1f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0b, 0xb9, 0x00, 
+0x09, 0x08, 0x00, 0x80, 0x20, 0x00, 0x80, 0x46, 0x08, 0x08, 0x81, 0x80, 0x80, 0x16, 0x00, 0x00, 
+0x82, 0x84, 0x80, 0x43, 0x40, 0x00, 0x80, 0x80, 0x00, 0x08, 0xc0, 0x00, 0x10, 0x30, 0xa0, 0x20, 
+0x40, 0x80, 0x00, 0x00, 0x40, 0xdf, 0x00, 0x06, 0x08, 0x03, 0x13, 0x05, 0x25, 0x2c, 0x2d, 0x80, 
+0x29, 0x14, 0x21, 0x04, 0x10, 0x10, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x01, 0x02, 0x04, 0x09, 
+0x02, 0x02, 0x80, 0x20, 0x20, 0x00, 0x80, 0xff, 0x00, 0xab, 0x00, 0x00, 0xbc, 0xff, 0x0f, 0x1f, 
+0x8f, 0xcf, 0xcf, 0x0f, 0x1f, 0x1f, 0xbf, 0x9f, 0x9f, 0x3f, 0x1f, 0x0f, 0xcf, 0x00, 0x07, 0xed, 
+0xff, 0x09, 0xfc, 0xfc, 0xf9, 0xfd, 0xfc, 0xf0, 0xf8, 0xf8, 0xff, 0xff, 0x80, 0xfc, 0x02, 0xfd, 
+0xfc, 0xfc, 0xff, 0xff, 0xda, 0xff, 0x07, 0x7f, 0x3f, 0x1f, 0x8f, 0xcf, 0xc7, 0xe7, 0xe7, 0x82, 
+0xf3, 0x08, 0xe3, 0xe7, 0xe7, 0xc7, 0xcf, 0x8f, 0x1f, 0x3f, 0x7f, 0xe4, 0xff, 0x08, 0x1f, 0x03, 
+0xc0, 0xf8, 0xfe, 0xff, 0xff, 0x7f, 0x7f, 0x83, 0xff, 0x80, 0x7f, 0x82, 0xff, 0x03, 0xfc, 0xf8, 
+0x01, 0x07, 0xe2, 0xff, 0x08, 0xfc, 0xe0, 0x83, 0x1f, 0x3f, 0xff, 0xd4, 0x14, 0x34, 0x80, 0xf7, 
+0x16, 0xf3, 0xf3, 0xfb, 0xf8, 0x78, 0x32, 0x07, 0x07, 0xff, 0xff, 0x7f, 0x3f, 0x0f, 0x80, 0xf0, 
+0xff, 0xff, 0x87, 0x03, 0x07, 0x07, 0x1f, 0x3f, 0x81, 0x7f, 0xda, 0xff, 0x05, 0xfe, 0xfc, 0xf8, 
+0xf1, 0xf2, 0xe0, 0x83, 0xe1, 0x07, 0xe4, 0xe4, 0xf2, 0xf3, 0xf1, 0xf8, 0xfc, 0xfe, 0x83, 0xff, 
+0x0a, 0xfe, 0xc0, 0x80, 0x98, 0x1e, 0x3e, 0x3e, 0x3c, 0x18, 0x80, 0xc3, 0xb5, 0xff, 0x00, 0xfe, 
+0xf0, 0xff, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xa4, 0x00, 0x08, 0x80, 0x40, 0x20, 0x90, 
+0x40, 0x08, 0x20, 0x00, 0x14, 0x86, 0x00, 0x04, 0x40, 0x90, 0x20, 0x40, 0x80, 0xe4, 0x00, 0x06, 
+0x18, 0x02, 0x38, 0x06, 0x01, 0x00, 0x80, 0x86, 0x00, 0x00, 0x40, 0x82, 0x00, 0x04, 0x01, 0x04, 
+0x38, 0x02, 0x18, 0xe2, 0x00, 0x26, 0x0c, 0x20, 0x8c, 0x20, 0x40, 0x00, 0x28, 0xd4, 0x34, 0x84, 
+0x04, 0x0c, 0x08, 0x08, 0x02, 0x00, 0x80, 0x09, 0x14, 0x00, 0x30, 0x80, 0x40, 0x30, 0x8e, 0x60, 
+0x0c, 0x00, 0x00, 0x78, 0xfc, 0xf8, 0xf8, 0x1c, 0x3c, 0xfc, 0x78, 0x60, 0x80, 0xd9, 0x00, 0x07, 
+0x01, 0x02, 0x04, 0x01, 0x02, 0x01, 0x02, 0x05, 0x81, 0x04, 0x08, 0x05, 0x04, 0x16, 0x00, 0x02, 
+0x09, 0x04, 0x02, 0x01, 0x83, 0x00, 0x0c, 0x01, 0x3f, 0x67, 0x58, 0x1e, 0x26, 0x00, 0x00, 0x24, 
+0xb8, 0xc3, 0xfe, 0x30, 0xf7, 0x00, 0x80, 0x01, 0xaa, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xa3, 0x00, 0x08, 0xc0, 0x60, 0xb0, 0xd0, 0x48, 0x28, 0x24, 0x14, 0x14, 0x85, 0x00, 0x05, 
+0x20, 0x48, 0x90, 0x20, 0x40, 0x80, 0xe3, 0x00, 0x0a, 0xf0, 0xfe, 0xe7, 0xfd, 0x06, 0x01, 0xc0, 
+0xc0, 0x40, 0x80, 0x80, 0x82, 0x00, 0x03, 0x80, 0x00, 0x40, 0x80, 0x80, 0x00, 0x05, 0x01, 0x06, 
+0xf8, 0xc3, 0xfc, 0xe0, 0xe0, 0x00, 0x1c, 0x03, 0x1f, 0x71, 0xcf, 0x30, 0x48, 0xbc, 0x7c, 0xcf, 
+0xb3, 0x73, 0x08, 0x08, 0x00, 0x00, 0x80, 0x83, 0x82, 0xc2, 0x28, 0x10, 0x80, 0xb0, 0x60, 0xb8, 
+0xcf, 0x71, 0x1f, 0x03, 0x83, 0x00, 0x06, 0xfc, 0xfc, 0x84, 0x06, 0x1e, 0xfc, 0xf0, 0xd7, 0x00, 
+0x08, 0x01, 0x02, 0x04, 0x01, 0x08, 0x01, 0x01, 0x00, 0x02, 0x80, 0x03, 0x08, 0x17, 0x16, 0x13, 
+0x0b, 0x0a, 0x0d, 0x04, 0x02, 0x01, 0x86, 0x00, 0x0a, 0x18, 0x03, 0x81, 0x10, 0x02, 0x02, 0x40, 
+0x44, 0x00, 0x00, 0x48, 0xfa, 0x00, 0x00, 0x01, 0xa9, 0x00, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x00, 
+0x01, 0x93, 0x00, 0x07, 0xf0, 0xf8, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0xf0, 0xe5, 0x00, 0x17, 0x1c, 
+0x38, 0xe0, 0xc0, 0xf0, 0x3c, 0xf4, 0xf8, 0x88, 0xce, 0x7e, 0x3c, 0x00, 0x7e, 0x40, 0x40, 0x78, 
+0x18, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xc6, 0x00, 0x09, 0xc0, 0xe0, 0x70, 0xf8, 0xf8, 0x6c, 
+0x3c, 0x36, 0x1e, 0x1a, 0x82, 0x0a, 0x09, 0x02, 0x00, 0x10, 0x04, 0x20, 0x48, 0x90, 0x20, 0xc0, 
+0x80, 0x83, 0x00, 0x04, 0x80, 0xf0, 0x3c, 0x0f, 0x01, 0xd7, 0x00, 0x07, 0xfc, 0xff, 0xf7, 0xff, 
+0x7f, 0xe3, 0xe1, 0x80, 0x80, 0xc0, 0x81, 0x00, 0x02, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x07, 0x00, 
+0x00, 0x01, 0x07, 0xfe, 0xff, 0xff, 0xfc, 0xe0, 0x00, 0x1c, 0x03, 0x1f, 0x3f, 0x6f, 0x9e, 0x70, 
+0x41, 0x8d, 0x3b, 0x71, 0xf1, 0xfd, 0x6f, 0x7f, 0x7a, 0x38, 0x05, 0x84, 0x85, 0x85, 0x45, 0x2c, 
+0x1c, 0x08, 0xbe, 0xef, 0x7b, 0x3f, 0x0f, 0x87, 0x00, 0x04, 0xf8, 0xfe, 0xfe, 0xfc, 0xf0, 0xd6, 
+0x00, 0x14, 0x01, 0x02, 0x04, 0x01, 0x00, 0x00, 0x01, 0x01, 0x11, 0x15, 0x15, 0x17, 0x1f, 0x0b, 
+0x0e, 0x0f, 0x07, 0x07, 0x03, 0x03, 0x01, 0x86, 0x00, 0x0c, 0xe0, 0xf8, 0x04, 0x66, 0xef, 0xdf, 
+0x3d, 0x7d, 0x75, 0xc0, 0xe1, 0x77, 0x03, 0xf0, 0x00, 0x09, 0x07, 0x0f, 0x1c, 0x18, 0x1c, 0x0c, 
+0x0f, 0x06, 0x02, 0x01, 0xa9, 0x00, 0x01, 0xff, 0x00, 0xbc, 0x00, 0x00, 0x01, 0xff, 0x00, 0xe1, 
+0x00, 0x00, 0x80, 0x80, 0x00, 0x04, 0x08, 0x20, 0x04, 0x00, 0x02, 0x84, 0x0a, 0x07, 0x12, 0x14, 
+0x24, 0x68, 0xd8, 0xb0, 0x60, 0xc0, 0xe3, 0x00, 0x08, 0xf0, 0x02, 0xf0, 0x04, 0x01, 0x80, 0x00, 
+0xa0, 0x80, 0x84, 0x00, 0x02, 0x40, 0x00, 0xc0, 0x81, 0x00, 0x04, 0x01, 0x0e, 0xf9, 0x07, 0xf8, 
+0xe1, 0x00, 0x10, 0x07, 0x1c, 0x63, 0xcc, 0xb0, 0x60, 0x82, 0x87, 0x09, 0x1b, 0x71, 0xd1, 0x9d, 
+0x1b, 0x83, 0x7e, 0x3d, 0x84, 0x00, 0x03, 0x08, 0x01, 0x08, 0x03, 0xe5, 0x00, 0x07, 0x01, 0x03, 
+0x06, 0x05, 0x09, 0x0a, 0x0a, 0x12, 0x80, 0x14, 0x21, 0x10, 0x00, 0x02, 0x0a, 0x00, 0x04, 0x80, 
+0x80, 0xc0, 0xe0, 0x70, 0x70, 0x30, 0x30, 0x38, 0x18, 0x78, 0x70, 0x60, 0xe0, 0xe0, 0x20, 0x38, 
+0xf8, 0xd8, 0xd8, 0x1c, 0xfc, 0xfe, 0xf6, 0x3f, 0x1f, 0x0f, 0x03, 0xe0, 0x00, 0x03, 0x0e, 0x0f, 
+0x0f, 0x0d, 0x81, 0x0c, 0x02, 0x0e, 0x06, 0x07, 0x82, 0x03, 0x08, 0x04, 0x0c, 0x1f, 0x19, 0x1d, 
+0x0c, 0x0e, 0x07, 0x03, 0xaa, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xa2, 0x00, 0x03, 
+0x10, 0x40, 0x08, 0x00, 0x80, 0x14, 0x01, 0x10, 0x10, 0x81, 0x14, 0x06, 0x2c, 0x68, 0x58, 0x90, 
+0x20, 0xc0, 0x80, 0xe3, 0x00, 0x08, 0xc0, 0x08, 0x80, 0x08, 0x00, 0xc0, 0x20, 0x20, 0x40, 0x84, 
+0x00, 0x00, 0x80, 0x83, 0x00, 0x04, 0x03, 0x0e, 0xf1, 0x06, 0xf8, 0xe1, 0x00, 0x10, 0x03, 0x18, 
+0x61, 0x9c, 0x30, 0xc0, 0x84, 0x06, 0x1a, 0x10, 0x20, 0x90, 0x24, 0x04, 0x00, 0x08, 0x01, 0x82, 
+0x00, 0x05, 0x80, 0x00, 0x10, 0x07, 0x20, 0x07, 0xdb, 0x00, 0x05, 0x80, 0xc0, 0xe0, 0x70, 0x30, 
+0x38, 0x80, 0x18, 0x21, 0x19, 0x1b, 0x1e, 0x1d, 0x3b, 0x3a, 0x76, 0xf4, 0xf4, 0xe4, 0xe0, 0xe0, 
+0xa0, 0x84, 0x14, 0x14, 0x00, 0x08, 0x01, 0x84, 0x82, 0xc1, 0xe0, 0x70, 0x70, 0x30, 0x30, 0x38, 
+0x18, 0x78, 0x70, 0x60, 0xe0, 0xe0, 0x82, 0xc0, 0xc5, 0x00, 0x0b, 0xe0, 0xf0, 0xf8, 0x1c, 0x0e, 
+0x06, 0x07, 0x02, 0x1f, 0x3f, 0x79, 0x60, 0x80, 0xc0, 0x82, 0x80, 0x0b, 0xc0, 0xc0, 0xe0, 0xf0, 
+0xf8, 0xff, 0x3f, 0x00, 0x00, 0xff, 0xff, 0x87, 0x80, 0x00, 0x03, 0x0e, 0x0f, 0x0f, 0x0d, 0x81, 
+0x0c, 0x02, 0x0e, 0x06, 0x07, 0x85, 0x03, 0x01, 0x01, 0x01, 0xae, 0x00, 0x01, 0xff, 0x00, 0xff, 
+0x00, 0xc9, 0x00, 0x03, 0x04, 0x00, 0x02, 0x04, 0x82, 0x00, 0x00, 0x08, 0x83, 0x00, 0x00, 0x40, 
+0xc4, 0x00, 0x14, 0x80, 0x40, 0x20, 0x80, 0x10, 0x40, 0x28, 0x28, 0x20, 0x00, 0x04, 0x04, 0x00, 
+0x00, 0x28, 0x28, 0x40, 0x10, 0x80, 0x20, 0x40, 0xe5, 0x00, 0x08, 0xc0, 0x08, 0x82, 0x08, 0x04, 
+0xc1, 0x00, 0x00, 0x80, 0x85, 0x00, 0x01, 0x40, 0x40, 0x80, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 
+0x80, 0xe1, 0x00, 0x0f, 0x03, 0x20, 0x81, 0x00, 0x40, 0x00, 0x05, 0x15, 0x2d, 0x3c, 0x5c, 0x8c, 
+0x38, 0x98, 0x88, 0x50, 0x84, 0x00, 0x04, 0x40, 0x10, 0x80, 0x20, 0x03, 0xd3, 0x00, 0x17, 0x80, 
+0xc0, 0xc0, 0xe0, 0xc0, 0xf0, 0x7c, 0x1e, 0x86, 0xc7, 0xe3, 0x73, 0x33, 0x3b, 0x1b, 0x1f, 0x06, 
+0xe4, 0xe0, 0x20, 0x60, 0xc0, 0xa4, 0x60, 0x82, 0xc8, 0x06, 0x88, 0xa8, 0x28, 0x20, 0x14, 0x12, 
+0x08, 0xd5, 0x00, 0x23, 0x80, 0xe0, 0xfe, 0x3f, 0xe3, 0xf1, 0xf8, 0x1c, 0x01, 0x19, 0x3f, 0x72, 
+0x7f, 0xff, 0xb9, 0xa0, 0x20, 0xa0, 0x30, 0x78, 0x7e, 0xbf, 0x8b, 0x78, 0x3f, 0xcf, 0xe1, 0xf0, 
+0xf8, 0xff, 0x3f, 0x00, 0x00, 0xff, 0xff, 0x87, 0xa6, 0x00, 0x00, 0x01, 0x9c, 0x00, 0x01, 0xff, 
+0x00, 0xff, 0x00, 0xc9, 0x00, 0x02, 0x04, 0x00, 0x02, 0x83, 0x00, 0x00, 0x08, 0xcc, 0x00, 0x07, 
+0x80, 0x40, 0x20, 0xa0, 0x90, 0x50, 0x50, 0x08, 0x82, 0x28, 0x06, 0x40, 0x50, 0x10, 0x80, 0x20, 
+0x40, 0x80, 0xe6, 0x00, 0x08, 0x10, 0x04, 0x31, 0x08, 0x02, 0xc1, 0x00, 0x40, 0xc0, 0x85, 0x00, 
+0x08, 0x80, 0x00, 0x00, 0x01, 0x02, 0x04, 0x01, 0x82, 0x08, 0xdd, 0x00, 0x82, 0x80, 0x83, 0x00, 
+0x0b, 0x01, 0x11, 0x50, 0x40, 0x20, 0x00, 0x90, 0x10, 0x10, 0x40, 0x00, 0x02, 0x82, 0x00, 0x04, 
+0x80, 0x60, 0x0f, 0x40, 0x0c, 0xd1, 0x00, 0x0b, 0x80, 0xc0, 0x40, 0x20, 0xa0, 0x00, 0x38, 0xcc, 
+0x72, 0x19, 0x05, 0x06, 0x80, 0x02, 0x0b, 0x00, 0x00, 0x08, 0xe0, 0x02, 0xc4, 0xc1, 0x82, 0x24, 
+0xa0, 0x28, 0x40, 0x84, 0x50, 0x07, 0x08, 0x28, 0x24, 0x12, 0x09, 0x04, 0x02, 0x01, 0xd0, 0x00, 
+0x0d, 0xc0, 0x70, 0x9e, 0xe1, 0x3c, 0x02, 0x01, 0x00, 0x07, 0x10, 0x23, 0x08, 0x00, 0x00, 0x80, 
+0xa0, 0x0a, 0x90, 0x98, 0x0c, 0x86, 0xe1, 0x38, 0xf7, 0x07, 0xf8, 0x0f, 0x01, 0xcf, 0x00, 0x01, 
+0xff, 0x00, 0xff, 0x00, 0xcb, 0x00, 0x00, 0x02, 0xd4, 0x00, 0x16, 0x80, 0x00, 0x20, 0x90, 0x58, 
+0x78, 0x2c, 0x3c, 0x3c, 0x3e, 0x36, 0x36, 0x76, 0x66, 0x6e, 0xee, 0xcc, 0x9c, 0x18, 0x38, 0x70, 
+0xe0, 0xc0, 0x91, 0x00, 0x01, 0xfe, 0xff, 0x81, 0x80, 0x81, 0x00, 0x00, 0x80, 0xc3, 0x00, 0x10, 
+0xe0, 0xf8, 0xde, 0xf3, 0x3c, 0x06, 0xc1, 0xc0, 0x00, 0xc0, 0x80, 0x00, 0x00, 0x80, 0x80, 0x40, 
+0x40, 0x80, 0xe0, 0x08, 0x81, 0x83, 0x07, 0x0e, 0x7c, 0xf1, 0x87, 0xff, 0xfc, 0x8f, 0x00, 0x07, 
+0x0f, 0x3f, 0x31, 0x30, 0x30, 0x1f, 0x1f, 0x3e, 0x81, 0x23, 0xb9, 0x00, 0x02, 0x80, 0x80, 0xc0, 
+0x82, 0x40, 0x1d, 0x80, 0xbf, 0xff, 0xef, 0xff, 0xf8, 0xc0, 0x00, 0x61, 0x61, 0xb9, 0xce, 0x87, 
+0x83, 0xe1, 0xe0, 0x81, 0x83, 0x01, 0x00, 0x00, 0x01, 0x83, 0xee, 0xfc, 0xf0, 0xbf, 0xff, 0x7f, 
+0x1f, 0xcd, 0x00, 0x0c, 0x80, 0xe0, 0x60, 0xb0, 0xf8, 0xf8, 0x7c, 0x18, 0x06, 0x33, 0x0d, 0x06, 
+0x03, 0x81, 0x01, 0x0e, 0x02, 0x02, 0x88, 0x01, 0x03, 0x23, 0x07, 0x0f, 0xdf, 0x36, 0x2c, 0x68, 
+0x58, 0x51, 0x51, 0x81, 0x11, 0x09, 0x01, 0x03, 0x0b, 0x27, 0x13, 0x0b, 0x0d, 0x06, 0x03, 0x01, 
+0xcd, 0x00, 0x1a, 0xf8, 0x3c, 0xff, 0x79, 0x1f, 0x03, 0x01, 0x00, 0x00, 0x04, 0x10, 0x22, 0x28, 
+0x68, 0x58, 0x50, 0x58, 0xb8, 0x8c, 0x84, 0xc3, 0x61, 0xd8, 0xff, 0x03, 0xf8, 0x06, 0xd1, 0x00, 
+0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xa2, 0x00, 0x08, 0xc0, 0x60, 0xb0, 0xd8, 0x68, 0x24, 
+0x14, 0x14, 0x02, 0x81, 0x0a, 0x05, 0x02, 0x02, 0x10, 0x04, 0x20, 0x08, 0x80, 0x00, 0x00, 0x80, 
+0xe3, 0x00, 0x1b, 0xe0, 0x0c, 0xc3, 0x18, 0x06, 0x01, 0x00, 0x00, 0x40, 0x80, 0xc0, 0x40, 0xc0, 
+0x80, 0xa0, 0x80, 0x80, 0x98, 0xf8, 0xd8, 0xc0, 0x80, 0x00, 0x01, 0x04, 0xf0, 0x02, 0xf8, 0xd7, 
+0x00, 0x02, 0x40, 0x00, 0x20, 0x80, 0xa0, 0x1f, 0x00, 0x40, 0x00, 0x80, 0x0f, 0x70, 0x87, 0x38, 
+0xc0, 0x00, 0x3d, 0x86, 0xd5, 0x96, 0x93, 0xe1, 0xe0, 0xe0, 0xc0, 0x40, 0xc0, 0xc0, 0x81, 0x43, 
+0x2f, 0x1f, 0x3f, 0xdc, 0x30, 0x8f, 0x60, 0x1f, 0xce, 0x00, 0x05, 0x90, 0x48, 0x20, 0x04, 0x10, 
+0x04, 0x86, 0x00, 0x1d, 0x01, 0x00, 0x04, 0x00, 0x02, 0x02, 0x05, 0x02, 0x04, 0x09, 0x12, 0x04, 
+0x20, 0x09, 0x01, 0x41, 0x41, 0x01, 0x01, 0x41, 0x03, 0x03, 0x0b, 0x05, 0x10, 0x02, 0x09, 0x04, 
+0x02, 0x01, 0xce, 0x00, 0x00, 0x80, 0x84, 0x00, 0x0e, 0x08, 0x10, 0x04, 0x00, 0x20, 0x28, 0xa0, 
+0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x80, 0xd3, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xd2, 
+0x00, 0x00, 0x08, 0xcf, 0x00, 0x06, 0x80, 0xc0, 0xe0, 0x70, 0xb8, 0x98, 0xd8, 0x80, 0xcc, 0x0b, 
+0xec, 0xec, 0xcc, 0xcc, 0xdc, 0xd8, 0xb8, 0xb0, 0x70, 0xe0, 0xc0, 0x80, 0xe4, 0x00, 0x0c, 0xf0, 
+0x3c, 0xef, 0x7f, 0x1f, 0xce, 0x03, 0x03, 0x41, 0xc1, 0xc0, 0x40, 0x40, 0x80, 0x60, 0x0a, 0x78, 
+0xb8, 0x98, 0x01, 0x81, 0x03, 0x07, 0x0d, 0x33, 0x0e, 0x18, 0xd8, 0x00, 0x01, 0x20, 0x80, 0x80, 
+0x00, 0x20, 0x20, 0x00, 0x40, 0x00, 0x00, 0x0f, 0x80, 0x07, 0x40, 0x00, 0x3c, 0x7f, 0x7b, 0x69, 
+0x4c, 0x5c, 0x54, 0x54, 0x34, 0x24, 0xac, 0xac, 0xcc, 0x8c, 0x0d, 0x2f, 0x57, 0x64, 0xc0, 0xf0, 
+0x9c, 0xe0, 0x1e, 0xd0, 0x00, 0x00, 0x10, 0x89, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 
+0x0a, 0x64, 0x09, 0x12, 0x2c, 0x68, 0x58, 0x80, 0xf0, 0x80, 0xb0, 0x80, 0xf0, 0x08, 0xd8, 0x7c, 
+0x6c, 0x3e, 0x3f, 0x1f, 0x0e, 0x03, 0x01, 0xcd, 0x00, 0x00, 0x04, 0x82, 0x00, 0x04, 0x02, 0x00, 
+0x01, 0x10, 0x04, 0x80, 0x00, 0x02, 0x04, 0x10, 0x80, 0x82, 0x00, 0x00, 0x08, 0x87, 0x00, 0x81, 
+0x01, 0xc4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xa7, 0x00, 0x05, 0x80, 0x80, 0x40, 
+0x40, 0x00, 0x00, 0x81, 0x20, 0x05, 0x00, 0x00, 0x40, 0x40, 0x80, 0x80, 0xe7, 0x00, 0x0a, 0xc0, 
+0xf0, 0xb8, 0xee, 0x76, 0xdf, 0xcd, 0xc2, 0x02, 0x01, 0x01, 0x82, 0x00, 0x0b, 0xc0, 0xc0, 0xc1, 
+0x01, 0x02, 0x06, 0x0d, 0x3b, 0xfe, 0xdc, 0xf0, 0xe0, 0xd3, 0x00, 0x04, 0x80, 0x40, 0x20, 0x80, 
+0x00, 0x80, 0x10, 0x01, 0x80, 0x20, 0x81, 0x00, 0x21, 0xff, 0xff, 0x7f, 0xff, 0x80, 0x00, 0x00, 
+0x18, 0x3b, 0x3b, 0x3a, 0x3a, 0x78, 0xa4, 0xec, 0xec, 0xcc, 0x8c, 0x0c, 0x8f, 0x2f, 0x3a, 0x00, 
+0x00, 0xe3, 0xff, 0xe1, 0xff, 0x3f, 0x33, 0x33, 0x3f, 0x1f, 0x06, 0xc4, 0x00, 0x0b, 0x40, 0x10, 
+0x48, 0x20, 0x14, 0x02, 0x0a, 0x00, 0x01, 0x08, 0x02, 0x01, 0x83, 0x00, 0x0e, 0x80, 0x40, 0x00, 
+0x81, 0x90, 0x00, 0x03, 0x67, 0x0d, 0x1b, 0x2e, 0x6c, 0x50, 0xb0, 0xa0, 0x85, 0x00, 0x09, 0xa0, 
+0xa0, 0x50, 0x58, 0x2c, 0x37, 0x1f, 0x0e, 0x03, 0x01, 0xc8, 0x00, 0x02, 0x04, 0x02, 0x08, 0x84, 
+0x00, 0x03, 0x04, 0x08, 0x02, 0x10, 0x80, 0x14, 0x09, 0x30, 0x12, 0x41, 0x20, 0x88, 0x04, 0x04, 
+0x40, 0x0c, 0x01, 0x86, 0x00, 0x05, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0xc2, 0x00, 0x01, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xa9, 0x00, 0x03, 0x80, 0x80, 0xc0, 0x40, 0x80, 0x00, 0x0c, 0x80, 
+0xa0, 0xa0, 0xb0, 0xb0, 0xe0, 0xe0, 0x60, 0x60, 0xe0, 0xc0, 0xc0, 0x80, 0xe3, 0x00, 0x0a, 0xc0, 
+0xf0, 0x78, 0x1c, 0xce, 0xfb, 0x3f, 0x0f, 0x06, 0x03, 0x01, 0x84, 0x00, 0x0e, 0x01, 0x01, 0x03, 
+0x07, 0x0e, 0x3c, 0xf1, 0xe3, 0x07, 0x1e, 0xfc, 0xf0, 0x80, 0x00, 0x00, 0x80, 0x80, 0x83, 0xc0, 
+0x00, 0x80, 0xc2, 0x00, 0x04, 0x80, 0x40, 0x20, 0x80, 0x00, 0x80, 0x10, 0x85, 0x00, 0x1f, 0xff, 
+0xff, 0x80, 0x00, 0x3f, 0xff, 0xc7, 0x07, 0x0e, 0x0e, 0x0c, 0xc0, 0x80, 0x80, 0x98, 0xf8, 0x38, 
+0x03, 0x07, 0x02, 0xc0, 0xc0, 0x66, 0x66, 0x91, 0xd9, 0x3f, 0xb3, 0xd3, 0xc0, 0x00, 0x04, 0x80, 
+0x0f, 0x00, 0x0d, 0x80, 0x0c, 0x03, 0x0e, 0x07, 0x03, 0x03, 0xb9, 0x00, 0x0b, 0x40, 0x10, 0x48, 
+0x20, 0x10, 0x02, 0x08, 0x00, 0x01, 0x08, 0x02, 0x01, 0x83, 0x00, 0x23, 0x80, 0x40, 0x00, 0x81, 
+0x90, 0x00, 0x00, 0x60, 0x03, 0x07, 0x1e, 0x1c, 0x30, 0x73, 0x67, 0xce, 0xdc, 0xf8, 0xf0, 0xb0, 
+0xa0, 0xa0, 0xa1, 0x21, 0x23, 0x81, 0x01, 0x51, 0x59, 0x6c, 0x3f, 0x3b, 0x1d, 0x0e, 0x07, 0x03, 
+0xc5, 0x00, 0x02, 0x84, 0x00, 0x48, 0x88, 0x00, 0x0c, 0x10, 0x14, 0x10, 0x20, 0x02, 0x41, 0x00, 
+0x88, 0x04, 0x04, 0x40, 0x0c, 0x01, 0x88, 0x00, 0x81, 0x01, 0xc2, 0x00, 0x01, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xac, 0x00, 0x12, 0x80, 0x40, 0x00, 0x20, 0x00, 0x00, 0x50, 0x40, 0x40, 0x50, 
+0x58, 0x50, 0x50, 0xd0, 0xf0, 0xb0, 0xe0, 0xe0, 0xc0, 0xe5, 0x00, 0x07, 0xc0, 0xf8, 0xfc, 0xf6, 
+0x39, 0x0c, 0x02, 0x01, 0x89, 0x00, 0x08, 0x01, 0x03, 0x07, 0x1f, 0xff, 0xf7, 0x9e, 0xfc, 0xe0, 
+0x80, 0x80, 0x83, 0xc0, 0x08, 0x80, 0x00, 0xc0, 0xc0, 0x60, 0x20, 0x40, 0xc0, 0xc0, 0x80, 0x00, 
+0x01, 0x80, 0xc0, 0x80, 0x00, 0x05, 0x80, 0xc0, 0xc0, 0x00, 0x80, 0x80, 0xad, 0x00, 0x18, 0x80, 
+0xc0, 0xe0, 0x60, 0xa0, 0x80, 0x10, 0x50, 0xd0, 0xf8, 0x98, 0x38, 0x30, 0x70, 0xe0, 0xe0, 0xc0, 
+0x80, 0x00, 0x3f, 0xff, 0xcf, 0x7f, 0xf0, 0xc0, 0x81, 0x00, 0x15, 0x18, 0x38, 0xe0, 0x78, 0xf8, 
+0xc0, 0x40, 0x40, 0xe6, 0xe6, 0xae, 0xe6, 0xc4, 0x4e, 0xa6, 0x3f, 0xff, 0xfd, 0x10, 0x0f, 0x0f, 
+0x0d, 0x80, 0x0c, 0x0b, 0x0e, 0x07, 0x03, 0x03, 0x00, 0x01, 0x07, 0x0f, 0x0e, 0x06, 0x07, 0x03, 
+0x80, 0x00, 0x15, 0xff, 0x1f, 0x1f, 0x18, 0x1e, 0x07, 0x01, 0xff, 0xf8, 0xe0, 0xe0, 0xf0, 0xe0, 
+0x30, 0x30, 0xf0, 0xe0, 0xe0, 0x60, 0x70, 0x70, 0x60, 0x98, 0x00, 0x0f, 0x80, 0xe0, 0x70, 0x38, 
+0x1c, 0xcc, 0xfe, 0xc4, 0xe2, 0x01, 0x05, 0x02, 0x7f, 0xff, 0xc7, 0x01, 0x80, 0x00, 0x24, 0x83, 
+0xff, 0xff, 0x1e, 0x7c, 0x18, 0x9f, 0x3f, 0x8f, 0xef, 0xfc, 0x38, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 
+0x3e, 0x6c, 0x78, 0x58, 0x5f, 0xde, 0xd4, 0x9c, 0x1d, 0x11, 0x51, 0x40, 0x00, 0x00, 0x04, 0x12, 
+0x09, 0x04, 0x03, 0x01, 0x93, 0x00, 0x01, 0x02, 0x03, 0x83, 0x00, 0x0a, 0x03, 0x03, 0x07, 0x07, 
+0x03, 0x03, 0x00, 0x00, 0x01, 0x03, 0x03, 0x80, 0x06, 0x01, 0x02, 0x02, 0x95, 0x00, 0x1e, 0x78, 
+0xfe, 0xcf, 0x03, 0x00, 0x3c, 0x7f, 0xe7, 0xc1, 0x01, 0x03, 0x07, 0x0e, 0x0c, 0x1c, 0x19, 0x9f, 
+0xcb, 0xfa, 0xf8, 0x99, 0xc9, 0x21, 0x07, 0x80, 0xc0, 0xc6, 0xe1, 0x7c, 0x3f, 0x07, 0xcd, 0x00, 
+0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb0, 0x00, 0x00, 0x80, 0x8b, 0x00, 0x00, 0x40, 0xe6, 
+0x00, 0x04, 0x40, 0x08, 0xc2, 0x00, 0x04, 0x8d, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x10, 0x88, 
+0x00, 0x14, 0xc0, 0x00, 0x80, 0x40, 0x00, 0x80, 0x00, 0xc0, 0x00, 0x00, 0x80, 0x20, 0x80, 0x00, 
+0x00, 0x80, 0x40, 0x20, 0x40, 0x80, 0x80, 0xb1, 0x00, 0x0d, 0x40, 0x20, 0x90, 0x50, 0x00, 0x08, 
+0x28, 0x08, 0x00, 0x40, 0x90, 0x00, 0x00, 0x80, 0x82, 0x00, 0x02, 0x08, 0x00, 0x80, 0x82, 0x00, 
+0x03, 0x18, 0x80, 0x80, 0xb8, 0x81, 0x80, 0x04, 0xc0, 0xc0, 0xc4, 0x42, 0x8a, 0x80, 0x00, 0x00, 
+0x20, 0x88, 0x00, 0x07, 0x01, 0x04, 0x08, 0x00, 0x0a, 0x01, 0x04, 0x03, 0x80, 0x00, 0x0b, 0x60, 
+0x18, 0x06, 0x26, 0x09, 0xfe, 0x00, 0xf8, 0x00, 0x01, 0x10, 0x50, 0x80, 0x00, 0x05, 0x20, 0x00, 
+0x00, 0x10, 0x10, 0x60, 0x9d, 0x00, 0x0a, 0xc0, 0x10, 0xc0, 0x24, 0x12, 0x08, 0x05, 0x78, 0x01, 
+0x38, 0x82, 0x84, 0x00, 0x0a, 0x80, 0x60, 0x1e, 0xc0, 0xb0, 0x28, 0x02, 0x44, 0x00, 0x00, 0x01, 
+0x80, 0x00, 0x11, 0x10, 0x00, 0x20, 0x02, 0x01, 0x01, 0x0f, 0x0e, 0x02, 0x42, 0x03, 0x03, 0x0b, 
+0x03, 0x01, 0x01, 0x00, 0x04, 0x94, 0x00, 0x01, 0x02, 0x02, 0x82, 0x00, 0x0b, 0x03, 0x0c, 0x03, 
+0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x04, 0x01, 0x01, 0x02, 0x9a, 0x00, 
+0x04, 0x3c, 0x03, 0x18, 0x02, 0x81, 0x82, 0x00, 0x10, 0x01, 0x00, 0x04, 0x01, 0x00, 0x88, 0x48, 
+0x20, 0x09, 0x00, 0x10, 0x48, 0x22, 0x9d, 0x41, 0x38, 0x01, 0xcc, 0x00, 0x01, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xad, 0x00, 0x04, 0x80, 0x40, 0x40, 0x20, 0x80, 0x80, 0x50, 0x0a, 0x00, 0x08, 
+0x00, 0x40, 0x50, 0x50, 0x10, 0x80, 0x20, 0x40, 0x40, 0xe9, 0x00, 0x03, 0x11, 0x00, 0x02, 0x01, 
+0x8b, 0x00, 0x05, 0x01, 0x00, 0x08, 0x20, 0x04, 0x10, 0x89, 0x00, 0x02, 0x40, 0x00, 0x80, 0x80, 
+0x00, 0x0d, 0x40, 0x00, 0x00, 0x80, 0x20, 0x80, 0x00, 0x00, 0x80, 0x40, 0x20, 0x40, 0x80, 0x80, 
+0xb1, 0x00, 0x04, 0x80, 0xc0, 0x60, 0xa0, 0xd0, 0x82, 0x50, 0x02, 0xb0, 0x60, 0xc0, 0x83, 0x00, 
+0x02, 0x09, 0x40, 0x80, 0x82, 0x00, 0x03, 0x30, 0x08, 0x08, 0x38, 0x84, 0x00, 0x05, 0x90, 0xd0, 
+0xc0, 0x20, 0x00, 0x40, 0x8a, 0x00, 0x05, 0x08, 0x00, 0x00, 0x0a, 0x08, 0x04, 0x80, 0x00, 0x0b, 
+0x60, 0x18, 0x06, 0x26, 0x09, 0xfe, 0x00, 0xf8, 0x00, 0x01, 0x10, 0x50, 0x80, 0x00, 0x05, 0x20, 
+0x00, 0x00, 0x10, 0x10, 0x60, 0x9e, 0x00, 0x0b, 0xe0, 0xf8, 0xd8, 0xec, 0x36, 0x1e, 0x1b, 0xf2, 
+0x03, 0x7c, 0x87, 0x01, 0x83, 0x00, 0x20, 0x80, 0xe2, 0x70, 0xc0, 0xbc, 0xfd, 0x82, 0xfe, 0x00, 
+0x01, 0x04, 0x08, 0x12, 0x14, 0x20, 0x24, 0x4a, 0x58, 0x50, 0x14, 0x14, 0x16, 0x14, 0x55, 0x51, 
+0x40, 0x28, 0x22, 0x11, 0x09, 0x00, 0x02, 0x01, 0x92, 0x00, 0x01, 0x02, 0x02, 0x82, 0x00, 0x0b, 
+0x03, 0x0c, 0x03, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x04, 0x01, 0x01, 
+0x02, 0x9b, 0x00, 0x05, 0x7c, 0xff, 0xc3, 0x81, 0xff, 0xff, 0x81, 0x00, 0x11, 0x03, 0x00, 0x00, 
+0x08, 0x02, 0x82, 0xca, 0x7a, 0x33, 0x21, 0xf1, 0x3c, 0x86, 0x1f, 0x4f, 0x39, 0x1f, 0x0f, 0xca, 
+0x00, 0x00, 0xc6, 0xff, 0x04, 0x00, 0x00, 0xcf, 0xe7, 0x67, 0x80, 0x0f, 0x0f, 0xcf, 0xcf, 0x0f, 
+0x8f, 0xcf, 0xdf, 0x7f, 0x1f, 0xcf, 0xcf, 0x1f, 0x1f, 0x00, 0x00, 0x33, 0xfb, 0x82, 0xff, 0x04, 
+0xcf, 0x9f, 0x3f, 0x7f, 0x7f, 0x80, 0x1f, 0x0a, 0xdf, 0x9f, 0x1f, 0x0f, 0x7f, 0xcf, 0x1f, 0x0f, 
+0x4f, 0xcf, 0xcf, 0xcd, 0xff, 0x0a, 0xfc, 0xf8, 0xfd, 0xfc, 0xfe, 0xfe, 0xfc, 0xfc, 0xff, 0xff, 
+0xfe, 0x82, 0xfc, 0x08, 0xf9, 0x7d, 0x04, 0x78, 0xf8, 0x00, 0x06, 0xfc, 0xfd, 0x80, 0xff, 0x0e, 
+0x7f, 0x1f, 0x8f, 0xe3, 0xf8, 0xfc, 0xff, 0x3c, 0x00, 0x01, 0x39, 0x3c, 0xfe, 0xfc, 0xfd, 0x80, 
+0xfc, 0xe0, 0xff, 0x0e, 0x00, 0x00, 0xfe, 0xfe, 0x80, 0x00, 0xc1, 0x91, 0xb8, 0xb8, 0x81, 0xc0, 
+0x9c, 0x9c, 0x99, 0x80, 0x81, 0x03, 0xf9, 0xf9, 0x80, 0x9f, 0xc7, 0xff, 0x01, 0x7f, 0x7f, 0x86, 
+0x3f, 0x01, 0x7f, 0x7f, 0x90, 0xff, 0x01, 0xfe, 0xfe, 0xd5, 0xff, 0x08, 0x1f, 0x07, 0xc3, 0xf1, 
+0xf8, 0xfc, 0xfc, 0xfe, 0xfe, 0x84, 0xff, 0x09, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xf1, 0xc3, 0x07, 
+0x1f, 0x7f, 0x89, 0xff, 0x82, 0x3f, 0x00, 0x7f, 0xc4, 0xff, 0x03, 0x7f, 0x7f, 0x3f, 0x3f, 0x80, 
+0x7f, 0x82, 0xff, 0x02, 0x80, 0x00, 0x3f, 0x83, 0xff, 0x02, 0xcf, 0x8f, 0xcf, 0x84, 0xff, 0x80, 
+0xe7, 0x04, 0xff, 0xff, 0x7f, 0x00, 0x80, 0x88, 0xff, 0x06, 0xf8, 0xf0, 0xe2, 0xe7, 0xe3, 0xf0, 
+0xf8, 0xbb, 0xff, 0x24, 0x3f, 0x1f, 0x8f, 0xcf, 0xc7, 0xe3, 0xf1, 0xf8, 0xfc, 0xfc, 0xfe, 0xfe, 
+0xff, 0xff, 0xfe, 0xfc, 0xf8, 0x01, 0x07, 0xe7, 0x07, 0x0f, 0xfc, 0xf8, 0xf1, 0xe3, 0xc7, 0x8f, 
+0x1f, 0x3f, 0x39, 0x39, 0x79, 0x79, 0x7d, 0x7d, 0x7c, 0x80, 0x3c, 0x06, 0x1c, 0x8d, 0xcf, 0xe3, 
+0xe1, 0xf8, 0xfc, 0xbc, 0xff, 0x00, 0xfe, 0x8e, 0xff, 0x02, 0xf8, 0x00, 0x03, 0x83, 0xff, 0x0c, 
+0x7f, 0x3f, 0x3f, 0x1f, 0x0f, 0x4f, 0x47, 0x21, 0x00, 0x84, 0xe3, 0xf0, 0xf8, 0x86, 0xff, 0x84, 
+0xfe, 0x99, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb1, 0x00, 
+0x01, 0x80, 0x80, 0x81, 0xc0, 0x00, 0x40, 0x81, 0xc0, 0x01, 0x80, 0x80, 0xea, 0x00, 0x08, 0xe0, 
+0x38, 0xdc, 0x76, 0x1b, 0x0f, 0x0d, 0x07, 0x06, 0x84, 0x03, 0x09, 0x02, 0x02, 0x05, 0x0d, 0x0b, 
+0x12, 0x44, 0x08, 0x20, 0x80, 0x88, 0x00, 0x00, 0x80, 0x81, 0x40, 0x01, 0xc0, 0x80, 0xc4, 0x00, 
+0x03, 0x80, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x82, 0x00, 0x03, 0x5f, 0x00, 0x3f, 0x01, 0x80, 0x00, 
+0x04, 0x80, 0xc0, 0xc8, 0x08, 0x48, 0x81, 0x20, 0x80, 0x30, 0x08, 0x04, 0xe4, 0xd0, 0x80, 0x00, 
+0x80, 0x00, 0x80, 0x30, 0x86, 0x00, 0x07, 0x0e, 0x38, 0x36, 0x2c, 0x21, 0x03, 0x00, 0x07, 0xbb, 
+0x00, 0x2f, 0xc0, 0xe0, 0x70, 0x30, 0x38, 0x1c, 0x0e, 0x87, 0xc3, 0xe3, 0x71, 0x31, 0x18, 0x1c, 
+0x0d, 0x0d, 0x01, 0xfa, 0xf4, 0x04, 0xc0, 0x00, 0xe0, 0xc8, 0xf0, 0xe4, 0xd8, 0xb0, 0x27, 0x4d, 
+0xca, 0xca, 0x8a, 0x82, 0x86, 0x8e, 0x8f, 0xcf, 0xcb, 0xcd, 0x6c, 0xff, 0xfc, 0xfb, 0x6e, 0x3b, 
+0x0c, 0x03, 0xcd, 0x00, 0x20, 0x07, 0xff, 0xfc, 0x00, 0x3e, 0xff, 0xe3, 0x03, 0x01, 0x80, 0xc0, 
+0xc0, 0xe0, 0xf0, 0xb0, 0xb8, 0xde, 0x7f, 0xfb, 0xdc, 0xef, 0x78, 0xdf, 0xe0, 0x7f, 0x3f, 0x04, 
+0x00, 0x01, 0x01, 0x03, 0x02, 0x02, 0x81, 0x06, 0x04, 0x02, 0x03, 0x03, 0x01, 0x01, 0xb5, 0x00, 
+0x01, 0xf1, 0x00, 0x00, 0x10, 0xff, 0x00, 0xff, 0x00, 0xc4, 0x00, 0x00, 0x80, 0xf1, 0x00, 0x09, 
+0x40, 0x00, 0x08, 0x24, 0x10, 0x02, 0x08, 0x01, 0x05, 0x04, 0x81, 0x00, 0x08, 0x04, 0x05, 0x05, 
+0x08, 0x02, 0x10, 0x24, 0x08, 0x10, 0x8a, 0x00, 0x82, 0x80, 0xd2, 0x00, 0x01, 0x20, 0x01, 0x83, 
+0x00, 0x03, 0x2c, 0x84, 0x44, 0x48, 0x81, 0x10, 0x0b, 0x50, 0x50, 0xfc, 0x90, 0xf0, 0xc8, 0x80, 
+0x00, 0x01, 0x00, 0x00, 0x40, 0x86, 0x00, 0x06, 0x0e, 0x3f, 0x39, 0x31, 0x39, 0x1f, 0x0f, 0xc3, 
+0x00, 0x16, 0x80, 0xc0, 0xe0, 0x70, 0x30, 0x18, 0x1c, 0x0c, 0x0e, 0x06, 0x04, 0x0c, 0x1c, 0x38, 
+0xf0, 0xe4, 0xd0, 0xc2, 0x88, 0x00, 0x00, 0x40, 0x80, 0x80, 0x04, 0x01, 0x08, 0x08, 0x80, 0x00, 
+0x09, 0x04, 0x00, 0x80, 0x02, 0x0c, 0x07, 0x00, 0x00, 0x10, 0x04, 0x80, 0x00, 0x81, 0x80, 0xca, 
+0x00, 0x04, 0x3e, 0xff, 0xe3, 0x03, 0x01, 0x85, 0x00, 0x25, 0x80, 0x80, 0xc0, 0xe0, 0x83, 0x23, 
+0xfe, 0x43, 0x5f, 0x64, 0x61, 0x72, 0xb2, 0xfc, 0x7d, 0x7d, 0xf9, 0xf9, 0xf1, 0x41, 0x05, 0x05, 
+0x00, 0x02, 0x12, 0x3d, 0x3e, 0xbe, 0xfe, 0xff, 0xf3, 0x07, 0x0e, 0x0e, 0x8f, 0xff, 0xff, 0x37, 
+0xa8, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaa, 0x00, 0x0a, 0x80, 0xe0, 
+0x70, 0x38, 0x1c, 0x0c, 0x0e, 0x06, 0x06, 0x07, 0x03, 0x80, 0x83, 0x09, 0x87, 0x06, 0x06, 0x0e, 
+0x0c, 0x1c, 0x38, 0x70, 0xe0, 0xc0, 0xe4, 0x00, 0x0a, 0x3e, 0x0f, 0x79, 0x18, 0x0c, 0x0e, 0x86, 
+0xeb, 0x5f, 0xc3, 0xcf, 0x81, 0x31, 0x0c, 0x61, 0x69, 0xb3, 0xb3, 0x0f, 0x03, 0x06, 0x06, 0x0d, 
+0xe3, 0xc7, 0x80, 0xe0, 0xe1, 0x00, 0x1c, 0x18, 0x20, 0x4c, 0x90, 0x20, 0x40, 0x87, 0xfd, 0xf8, 
+0xf9, 0xf9, 0xfc, 0xdc, 0xdc, 0x5c, 0x5c, 0x54, 0x56, 0x57, 0xe7, 0xb8, 0x90, 0x80, 0xbc, 0xdf, 
+0xe7, 0x7f, 0x3f, 0x07, 0x81, 0x80, 0xdb, 0x00, 0x05, 0x04, 0x00, 0x90, 0x00, 0x18, 0x01, 0x80, 
+0x00, 0x18, 0x01, 0x80, 0x00, 0x80, 0x02, 0x02, 0xa2, 0x82, 0xe2, 0xe5, 0xf5, 0xed, 0xe6, 0x85, 
+0x8d, 0xc3, 0xc0, 0xcd, 0xf9, 0xee, 0x0e, 0x8f, 0xff, 0xff, 0x37, 0xa8, 0x00, 0x01, 0xff, 0x00, 
+0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb5, 0x00, 0x81, 0x80, 0xed, 0x00, 0x0c, 0xc0, 0x30, 0x98, 
+0x68, 0x34, 0x16, 0x0a, 0x0b, 0x2d, 0xf9, 0xf9, 0x07, 0x03, 0x80, 0x02, 0x04, 0x0a, 0x7c, 0x3c, 
+0x01, 0x05, 0x80, 0x00, 0x06, 0x10, 0x24, 0xe8, 0xd8, 0x70, 0xe0, 0xc0, 0xde, 0x00, 0x02, 0x10, 
+0x00, 0x0b, 0x81, 0x00, 0x18, 0xe0, 0xe0, 0x41, 0x01, 0x08, 0x28, 0x28, 0xa0, 0xb0, 0xb8, 0xb0, 
+0xb4, 0x04, 0x04, 0x0e, 0xe4, 0x90, 0xc0, 0xe0, 0xff, 0xff, 0xe7, 0x7f, 0x3f, 0x06, 0xdb, 0x00, 
+0x1d, 0x38, 0x06, 0x13, 0x11, 0x22, 0x40, 0x50, 0x50, 0x68, 0x48, 0x00, 0xc0, 0x60, 0x02, 0x00, 
+0x08, 0x68, 0x48, 0x18, 0x1a, 0x0a, 0x02, 0x05, 0x65, 0x2d, 0x22, 0x30, 0xa1, 0x01, 0x11, 0xad, 
+0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb6, 0x00, 0x05, 0x80, 0xc0, 0xc0, 0xe0, 0x60, 
+0x60, 0x80, 0x70, 0x04, 0x60, 0xe0, 0xe0, 0xc0, 0x80, 0xea, 0x00, 0x07, 0x80, 0xf0, 0x78, 0x1e, 
+0x07, 0x03, 0x01, 0x80, 0x86, 0x00, 0x05, 0x01, 0x03, 0x0f, 0x7e, 0xf8, 0x80, 0xe1, 0x00, 0x1d, 
+0xc0, 0xe0, 0x70, 0x38, 0x18, 0xf3, 0xf3, 0x0e, 0x06, 0x06, 0x0a, 0x8d, 0xe4, 0x63, 0x63, 0x43, 
+0xc3, 0x83, 0x82, 0x8e, 0xb9, 0x19, 0x0c, 0x0c, 0x1c, 0xf8, 0xc7, 0x6f, 0xe0, 0xc0, 0xdc, 0x00, 
+0x21, 0xe0, 0xf0, 0xff, 0xcf, 0xfb, 0x60, 0xc0, 0x00, 0x81, 0xdf, 0xee, 0x48, 0x10, 0x38, 0x79, 
+0x79, 0xf3, 0xe3, 0x63, 0x2b, 0x2d, 0xac, 0xfc, 0x8e, 0xe4, 0xe0, 0xfc, 0x9e, 0x87, 0xc1, 0xe0, 
+0x7f, 0x3f, 0x06, 0xdb, 0x00, 0x1d, 0x3f, 0xe1, 0x93, 0x6e, 0xdf, 0x3b, 0x32, 0x50, 0x74, 0x04, 
+0x05, 0xcf, 0xed, 0x9b, 0x03, 0x03, 0x73, 0xf3, 0x43, 0x33, 0x03, 0x03, 0x27, 0x3f, 0xfe, 0xff, 
+0x72, 0xa0, 0xf8, 0xf1, 0xad, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xbc, 0x00, 0x85, 0x80, 0xee, 
+0x00, 0x08, 0xc0, 0xf0, 0x38, 0x9c, 0xce, 0xa7, 0x03, 0x03, 0x61, 0x80, 0x71, 0x09, 0x61, 0xe1, 
+0x83, 0x23, 0xe7, 0x0e, 0x3c, 0xf8, 0xe0, 0x80, 0xe5, 0x00, 0x09, 0x60, 0x0f, 0x77, 0x1e, 0xc7, 
+0x73, 0xb1, 0x98, 0x0c, 0x0c, 0x83, 0x06, 0x07, 0x0c, 0x0d, 0x1b, 0xef, 0xbe, 0xf8, 0x7f, 0xff, 
+0xe5, 0x00, 0x17, 0xff, 0xf0, 0x3f, 0xf9, 0xe3, 0x8b, 0x88, 0xe2, 0x67, 0x67, 0x46, 0xc2, 0x82, 
+0x82, 0x8a, 0xbd, 0x19, 0x06, 0x86, 0xc7, 0x13, 0xc3, 0x10, 0x03, 0xdd, 0x00, 0x1d, 0x60, 0x00, 
+0x08, 0x88, 0x70, 0x40, 0xc0, 0x40, 0x41, 0x2f, 0x1e, 0x08, 0x11, 0x33, 0x66, 0x46, 0x85, 0xcd, 
+0x6f, 0x3f, 0x3d, 0x7c, 0xbe, 0xce, 0xcf, 0xef, 0xc3, 0x67, 0xe7, 0x01, 0xdf, 0x00, 0x1c, 0x07, 
+0x1c, 0x73, 0xcf, 0x39, 0xe3, 0x83, 0xe0, 0xdf, 0x08, 0x04, 0x0c, 0x8b, 0x1e, 0x00, 0x00, 0x02, 
+0xe0, 0x40, 0x30, 0x00, 0x80, 0xc2, 0xdd, 0xdc, 0xdc, 0x72, 0x38, 0x06, 0xae, 0x00, 0x01, 0xff, 
+0x00, 0xff, 0x00, 0xb7, 0x00, 0x07, 0x80, 0xc0, 0xe0, 0x60, 0x70, 0x30, 0x38, 0x18, 0x82, 0x98, 
+0x07, 0x18, 0x38, 0x30, 0x30, 0x60, 0xe0, 0xc0, 0x80, 0xe5, 0x00, 0x0b, 0xe0, 0x3c, 0xee, 0x3f, 
+0x1d, 0x0e, 0x67, 0x63, 0xe2, 0xc2, 0xc0, 0xc1, 0x80, 0x81, 0x0b, 0x63, 0xe3, 0x67, 0x16, 0x20, 
+0xe4, 0xe0, 0x81, 0x07, 0x1f, 0xfc, 0xf0, 0xe1, 0x00, 0x0a, 0xe0, 0xf0, 0x30, 0xf8, 0x00, 0xcc, 
+0xdf, 0x63, 0x75, 0x7c, 0x46, 0x80, 0x66, 0x0d, 0x27, 0x27, 0x2d, 0x3d, 0x29, 0xd3, 0xe3, 0x23, 
+0xdd, 0x41, 0xcc, 0xf0, 0x7f, 0x0f, 0xe2, 0x00, 0x0a, 0x0f, 0x3f, 0xf9, 0xe2, 0x84, 0x00, 0x0b, 
+0x0b, 0x1f, 0x1e, 0x1a, 0x81, 0x32, 0x08, 0xb6, 0xfe, 0x5e, 0x1f, 0xff, 0x32, 0x09, 0x00, 0x03, 
+0xdc, 0x00, 0x1d, 0x80, 0xf0, 0xc6, 0x87, 0x37, 0x5f, 0xdc, 0xd8, 0xd8, 0xf8, 0x0c, 0x0e, 0x4f, 
+0x6d, 0xd9, 0x39, 0x7a, 0x3e, 0x14, 0x00, 0x02, 0x43, 0xc8, 0x58, 0xb8, 0x98, 0xbc, 0x1e, 0x1e, 
+0x3c, 0xe0, 0x00, 0x15, 0x03, 0x0f, 0x3e, 0xfb, 0xef, 0x9e, 0xb9, 0x80, 0xc4, 0xc8, 0xc2, 0x47, 
+0xf6, 0xf0, 0xe0, 0xe2, 0xe0, 0xe0, 0xe2, 0xe0, 0x60, 0x34, 0x80, 0x3b, 0x02, 0x0c, 0x06, 0x01, 
+0xae, 0x00, 0x01, 0xf1, 0x00, 0x00, 0x10, 0xff, 0x00, 0xc4, 0x00, 0x09, 0x80, 0x40, 0x20, 0x80, 
+0x10, 0x80, 0x88, 0x40, 0xc0, 0x80, 0x81, 0x00, 0x07, 0x20, 0x28, 0x00, 0x50, 0x80, 0x20, 0x40, 
+0x80, 0xe4, 0x00, 0x0b, 0xe0, 0x0c, 0xe2, 0x18, 0x02, 0x01, 0x00, 0x80, 0x81, 0xc3, 0xc0, 0xc1, 
+0x80, 0x80, 0x80, 0x00, 0x09, 0x18, 0x04, 0x04, 0x18, 0x01, 0x06, 0x18, 0xe3, 0x0c, 0xf0, 0xe1, 
+0x00, 0x1b, 0x0f, 0x30, 0xc7, 0x30, 0x7c, 0xef, 0x7b, 0x79, 0x70, 0x40, 0x60, 0xe0, 0xa0, 0x61, 
+0x61, 0x41, 0x51, 0x51, 0x13, 0x13, 0x1b, 0x22, 0xbe, 0x4c, 0x30, 0x87, 0x30, 0x0f, 0xdc, 0x00, 
+0x01, 0x80, 0x80, 0x83, 0x00, 0x15, 0x01, 0x02, 0x04, 0x09, 0x02, 0x14, 0x04, 0x00, 0x29, 0x88, 
+0x80, 0x00, 0x80, 0x00, 0x20, 0x20, 0xd0, 0x02, 0x08, 0x04, 0x00, 0x01, 0xde, 0x00, 0x1b, 0x80, 
+0x24, 0x50, 0x13, 0x04, 0x00, 0x04, 0xe0, 0x00, 0x40, 0x11, 0xa1, 0xc0, 0x00, 0x08, 0x04, 0x00, 
+0x01, 0x20, 0x09, 0x9d, 0x74, 0x44, 0x02, 0x06, 0x01, 0x03, 0x04, 0xe2, 0x00, 0x15, 0x02, 0x08, 
+0x11, 0x24, 0x28, 0x08, 0x0c, 0x00, 0x20, 0x10, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x10, 0x10, 
+0x00, 0x00, 0x04, 0x04, 0xb1, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xb8, 0x00, 0x09, 0x80, 0xc0, 
+0xe0, 0xe0, 0xf0, 0xf0, 0x38, 0x38, 0x78, 0x68, 0x80, 0x28, 0x07, 0x68, 0x78, 0x50, 0x50, 0xa0, 
+0x20, 0x40, 0x80, 0xe5, 0x00, 0x0c, 0xf0, 0x3c, 0xef, 0x7f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x01, 
+0x0e, 0x1f, 0x0e, 0x82, 0x00, 0x09, 0x18, 0x78, 0x78, 0x61, 0x02, 0x00, 0x10, 0xc0, 0x08, 0xc0, 
+0xe1, 0x00, 0x03, 0x0f, 0x20, 0x0f, 0x20, 0x82, 0x00, 0x12, 0xc0, 0x60, 0xf0, 0x58, 0x4c, 0x6c, 
+0x64, 0x64, 0x24, 0xbc, 0xb4, 0xcc, 0xfc, 0xbc, 0xc0, 0xf8, 0xdf, 0xf0, 0x3f, 0xdb, 0x00, 0x01, 
+0x80, 0x80, 0x85, 0x00, 0x15, 0x04, 0x09, 0x12, 0x14, 0x2c, 0x29, 0x7a, 0xdf, 0xd7, 0x56, 0x56, 
+0x9e, 0x9b, 0x9b, 0x3d, 0xfd, 0xfe, 0x9f, 0x1f, 0x0f, 0x07, 0x03, 0xda, 0x00, 0x1f, 0xf8, 0xc2, 
+0xe3, 0xdf, 0xff, 0x3f, 0x2c, 0x20, 0x00, 0xf2, 0x00, 0x21, 0x71, 0x21, 0xc2, 0x0c, 0x18, 0x7c, 
+0x1c, 0x03, 0x23, 0x01, 0x04, 0x08, 0x34, 0x07, 0xe7, 0x78, 0xfc, 0xfb, 0x7f, 0x18, 0xde, 0x00, 
+0x0d, 0x01, 0x03, 0x06, 0x09, 0x13, 0x24, 0x28, 0x4f, 0x45, 0x01, 0x23, 0x12, 0x02, 0x00, 0x80, 
+0x10, 0x01, 0x1d, 0x01, 0x82, 0x00, 0x03, 0x04, 0x06, 0x03, 0x01, 0xad, 0x00, 0x01, 0xff, 0x00, 
+0xff, 0x00, 0xbb, 0x00, 0x02, 0x80, 0xc0, 0xc0, 0x80, 0xe0, 0x00, 0x70, 0x80, 0x30, 0x00, 0x70, 
+0x80, 0x60, 0x02, 0xc0, 0xc0, 0x80, 0xe7, 0x00, 0x0c, 0xc0, 0xf0, 0x7c, 0x0e, 0x07, 0x03, 0x81, 
+0x80, 0xc0, 0xcf, 0x7f, 0x6e, 0x60, 0x82, 0x30, 0x08, 0x00, 0x00, 0x01, 0x63, 0xc7, 0xcf, 0xbc, 
+0xf8, 0xc0, 0xe2, 0x00, 0x0d, 0x1f, 0xff, 0x00, 0x78, 0x1e, 0x07, 0x03, 0x01, 0xc0, 0xe0, 0x30, 
+0x1a, 0x13, 0x10, 0x80, 0x04, 0x0c, 0x8c, 0x8c, 0xcc, 0xf3, 0x23, 0x1c, 0x01, 0xe3, 0xf8, 0x31, 
+0xfc, 0xf8, 0x80, 0xe1, 0x00, 0x1a, 0x06, 0x18, 0x32, 0x6c, 0xf8, 0xb0, 0xb1, 0x63, 0x27, 0x87, 
+0xd6, 0xd6, 0x96, 0x93, 0x93, 0x11, 0x81, 0x80, 0xe8, 0x2c, 0x1e, 0x9f, 0xdb, 0xe0, 0x78, 0x3f, 
+0x0f, 0xd4, 0x00, 0x25, 0xf0, 0xf8, 0xc0, 0x84, 0xfc, 0x5c, 0x50, 0x40, 0x48, 0xc0, 0xe0, 0x40, 
+0x82, 0xa3, 0x86, 0xce, 0x1c, 0x10, 0x20, 0x81, 0xe3, 0x0f, 0x0b, 0x88, 0xf9, 0xc5, 0x89, 0x78, 
+0xf8, 0x79, 0x1d, 0xc1, 0x49, 0x2b, 0x3b, 0xfd, 0xf9, 0x18, 0xd7, 0x00, 0x24, 0x01, 0x03, 0x07, 
+0x0f, 0x1f, 0x3f, 0x7e, 0x7c, 0xd8, 0xe9, 0x09, 0x07, 0x25, 0x27, 0x12, 0x13, 0x11, 0x12, 0x0e, 
+0x0f, 0x00, 0x0f, 0x03, 0x01, 0x09, 0x0c, 0x0c, 0x08, 0x18, 0x1c, 0x1f, 0x18, 0x1c, 0x0e, 0x06, 
+0x07, 0x03, 0xa7, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xba, 0x00, 0x06, 0x80, 0x00, 
+0x40, 0x00, 0xa0, 0xa0, 0x00, 0x82, 0x50, 0x80, 0x00, 0x00, 0xa0, 0xe9, 0x00, 0x0b, 0xe0, 0x08, 
+0xe2, 0x19, 0x04, 0x02, 0x01, 0x01, 0x00, 0x02, 0x1f, 0x1c, 0x80, 0xc0, 0x80, 0x00, 0x09, 0x0f, 
+0x1f, 0x9c, 0xc0, 0x80, 0x04, 0x00, 0xc0, 0x00, 0x60, 0xe1, 0x00, 0x0c, 0x07, 0x10, 0x03, 0x00, 
+0x00, 0x40, 0x00, 0x00, 0x40, 0xe0, 0x70, 0x70, 0x30, 0x80, 0x10, 0x0b, 0x90, 0x10, 0x50, 0x10, 
+0x21, 0xb9, 0x59, 0x20, 0x98, 0x47, 0x10, 0x07, 0xd2, 0x00, 0x12, 0xe0, 0x00, 0xc0, 0x48, 0x98, 
+0xa0, 0xa0, 0x80, 0x00, 0x80, 0x04, 0x90, 0xd2, 0x80, 0x84, 0x08, 0x30, 0x00, 0x20, 0x80, 0x00, 
+0x10, 0x70, 0x00, 0x80, 0x21, 0x09, 0x02, 0x82, 0x82, 0x02, 0x20, 0x00, 0x48, 0x55, 0x48, 0x06, 
+0x00, 0x69, 0xd6, 0x00, 0x12, 0x01, 0x02, 0x04, 0x19, 0x12, 0x24, 0x48, 0x90, 0xa0, 0x39, 0x22, 
+0x86, 0x62, 0x04, 0x05, 0x01, 0x22, 0x27, 0x0c, 0x81, 0x00, 0x0f, 0x0c, 0x12, 0x12, 0x11, 0x11, 
+0x10, 0x00, 0x20, 0x21, 0x28, 0x04, 0x16, 0x1a, 0x08, 0x04, 0x03, 0xa6, 0x00, 0x01, 0xf1, 0x00, 
+0x00, 0x10, 0xff, 0x00, 0xff, 0x00, 0xc9, 0x00, 0x07, 0x40, 0x20, 0xb0, 0xf8, 0x78, 0x6c, 0x6c, 
+0x6e, 0x82, 0x66, 0x08, 0xc6, 0xce, 0xcc, 0x9c, 0x18, 0x38, 0x70, 0xe0, 0xc0, 0xe2, 0x00, 0x06, 
+0xf0, 0xfc, 0xee, 0xf9, 0x1c, 0x02, 0x01, 0x81, 0x00, 0x02, 0xa0, 0xb0, 0xa0, 0x82, 0x00, 0x09, 
+0xe0, 0x21, 0xe3, 0x03, 0x0e, 0x3c, 0xf8, 0xe3, 0xff, 0xfc, 0xe0, 0x00, 0x08, 0x0f, 0x3f, 0x71, 
+0xef, 0xfe, 0xf8, 0xe0, 0xc0, 0x80, 0x80, 0xc0, 0x10, 0xe0, 0xe8, 0xe8, 0xfc, 0x5c, 0x36, 0x3e, 
+0x2b, 0x2b, 0x8f, 0xc6, 0x60, 0xb8, 0xff, 0x7b, 0x1f, 0x07, 0xd0, 0x00, 0x03, 0x20, 0x10, 0x48, 
+0x80, 0x80, 0x00, 0x21, 0x20, 0x90, 0x08, 0x04, 0x94, 0x94, 0x04, 0x08, 0x90, 0x40, 0x20, 0x20, 
+0x00, 0x01, 0x03, 0x83, 0x16, 0x05, 0x50, 0x31, 0x7a, 0x92, 0x80, 0x00, 0x02, 0xc2, 0xc2, 0x1a, 
+0x9d, 0x3d, 0x1e, 0x82, 0xf3, 0x61, 0xd4, 0x00, 0x27, 0x02, 0x04, 0x09, 0x02, 0x24, 0x48, 0x91, 
+0x20, 0x40, 0x6a, 0x08, 0x0c, 0x6d, 0x29, 0x21, 0x22, 0x44, 0x41, 0x20, 0x00, 0x01, 0x00, 0x01, 
+0x01, 0x1c, 0x0c, 0x26, 0x22, 0x23, 0x21, 0x01, 0x00, 0x4f, 0x63, 0x68, 0x2c, 0x37, 0x1b, 0x0c, 
+0x0f, 0xa5, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xcc, 0x00, 0x00, 0x10, 0x82, 0x00, 
+0x00, 0x80, 0xe3, 0x00, 0x02, 0x30, 0x00, 0xe0, 0x83, 0x00, 0x01, 0x10, 0x80, 0x80, 0xc0, 0x05, 
+0x40, 0x40, 0xc0, 0x80, 0x10, 0x10, 0x83, 0x00, 0x01, 0x02, 0x40, 0xe1, 0x00, 0x02, 0x01, 0x00, 
+0x01, 0x82, 0x00, 0x0c, 0x7e, 0x67, 0x41, 0x68, 0x68, 0x3c, 0x0c, 0x06, 0x06, 0x04, 0x1d, 0x11, 
+0x06, 0x80, 0x00, 0x02, 0x04, 0x20, 0x08, 0xd0, 0x00, 0x04, 0xc0, 0x20, 0x90, 0x80, 0x10, 0x80, 
+0x00, 0x02, 0x20, 0x10, 0x08, 0x80, 0x00, 0x02, 0x08, 0x10, 0xe0, 0x80, 0x00, 0x09, 0x80, 0x00, 
+0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0xe0, 0x80, 0x80, 0x00, 0x08, 0x40, 0x40, 0x90, 0x20, 0x01, 
+0x80, 0x00, 0x90, 0x20, 0xd3, 0x00, 0x10, 0x03, 0x04, 0x09, 0x12, 0x04, 0x40, 0x90, 0x21, 0x40, 
+0x33, 0x40, 0x00, 0x80, 0x00, 0x00, 0x01, 0x44, 0x85, 0x00, 0x01, 0x10, 0x20, 0x80, 0x00, 0x0a, 
+0x20, 0x20, 0x40, 0x44, 0x49, 0x00, 0x00, 0x04, 0x13, 0x00, 0x07, 0xa4, 0x00, 0x01, 0xff, 0x00, 
+0xff, 0x00, 0xff, 0x00, 0xbb, 0x00, 0x09, 0x80, 0x40, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x02, 
+0x08, 0xf1, 0x00, 0x04, 0xc0, 0x02, 0x00, 0x04, 0x01, 0x80, 0x00, 0x0b, 0x20, 0x00, 0x80, 0xa0, 
+0xc0, 0xc0, 0x40, 0x40, 0xc0, 0xd0, 0xc0, 0x40, 0x81, 0x00, 0x03, 0x02, 0xf0, 0x00, 0xb0, 0xe2, 
+0x00, 0x03, 0x08, 0x20, 0x04, 0x10, 0x80, 0x00, 0x13, 0x4e, 0x1f, 0x0d, 0x24, 0x06, 0x46, 0x16, 
+0x36, 0x2e, 0x28, 0x29, 0x21, 0x1e, 0x9e, 0x4e, 0x00, 0x88, 0x01, 0x10, 0x03, 0xd2, 0x00, 0x02, 
+0x10, 0x90, 0x20, 0x83, 0x00, 0x04, 0x20, 0x20, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x10, 0x81, 
+0x00, 0x0d, 0x02, 0x70, 0x10, 0x00, 0x00, 0x20, 0x00, 0x42, 0x88, 0x90, 0x44, 0x00, 0x00, 0x21, 
+0xd4, 0x00, 0x06, 0x02, 0x00, 0x01, 0x20, 0x08, 0x01, 0x01, 0x80, 0x00, 0x08, 0x04, 0x01, 0x01, 
+0x08, 0x00, 0x40, 0x00, 0x40, 0x20, 0x83, 0x00, 0x08, 0x18, 0x24, 0x22, 0x00, 0x01, 0x24, 0x00, 
+0x50, 0x56, 0x80, 0x00, 0x00, 0x10, 0xa6, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xbd, 
+0x00, 0x07, 0x20, 0x90, 0x40, 0x20, 0x04, 0x10, 0x00, 0x02, 0x85, 0x00, 0x06, 0x04, 0x20, 0x48, 
+0x90, 0x20, 0x40, 0x80, 0xe3, 0x00, 0x03, 0x3c, 0x01, 0xf8, 0x02, 0x80, 0x00, 0x03, 0x20, 0x00, 
+0x00, 0x20, 0x82, 0x00, 0x03, 0x30, 0x00, 0x00, 0x30, 0x80, 0x00, 0x04, 0x01, 0x0c, 0x01, 0x0e, 
+0xc0, 0xe1, 0x00, 0x1a, 0x07, 0x10, 0x43, 0x88, 0x20, 0x40, 0x80, 0x30, 0x08, 0x34, 0x88, 0xaa, 
+0x22, 0x42, 0x42, 0x12, 0x12, 0x0a, 0x0a, 0x22, 0x20, 0x10, 0x2a, 0x10, 0x46, 0x20, 0x0c, 0xd0, 
+0x00, 0x27, 0xc0, 0xe0, 0x60, 0x60, 0xe0, 0xc0, 0x40, 0x00, 0x20, 0x30, 0x38, 0x58, 0x58, 0xf8, 
+0xf0, 0xc0, 0xc0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0xe1, 0xf2, 0x70, 0x01, 0x00, 0x0a, 0x00, 0xe0, 
+0xf0, 0x00, 0x20, 0xc0, 0x00, 0x52, 0x48, 0xc1, 0x04, 0x72, 0xd5, 0x00, 0x16, 0x01, 0x07, 0x0f, 
+0x1c, 0x38, 0x70, 0x9f, 0xbf, 0x60, 0x75, 0x34, 0x10, 0xd4, 0x44, 0x42, 0x62, 0x78, 0x71, 0x21, 
+0x01, 0x00, 0x00, 0x01, 0x80, 0x00, 0x0d, 0x18, 0x1e, 0x3e, 0x1f, 0x3b, 0x3f, 0x6e, 0x60, 0x3f, 
+0x24, 0x14, 0x00, 0x08, 0x04, 0xa4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xbc, 0x00, 
+0x00, 0x80, 0x8a, 0x00, 0x08, 0x08, 0x02, 0x00, 0x10, 0x04, 0x00, 0x40, 0x10, 0x20, 0xe4, 0x00, 
+0x04, 0xc0, 0x02, 0x00, 0x04, 0x01, 0x80, 0x00, 0x02, 0x10, 0x00, 0x40, 0x84, 0x00, 0x00, 0x40, 
+0x82, 0x00, 0x03, 0x02, 0xf0, 0x01, 0x38, 0xe2, 0x00, 0x03, 0x08, 0x20, 0x04, 0x10, 0x80, 0x00, 
+0x13, 0x70, 0x78, 0xcc, 0xd4, 0x7c, 0x58, 0x58, 0x1c, 0x1c, 0x2c, 0x2c, 0x34, 0x32, 0x12, 0x0a, 
+0x00, 0x08, 0x01, 0x00, 0x03, 0xe8, 0x00, 0x0b, 0x04, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x10, 0x00, 
+0x00, 0xc0, 0x00, 0x08, 0xdd, 0x00, 0x0a, 0x3f, 0x00, 0x1e, 0x02, 0x01, 0x20, 0x00, 0x80, 0x0c, 
+0x41, 0x12, 0x8f, 0x00, 0x03, 0x10, 0x00, 0x00, 0x02, 0xa6, 0x00, 0x01, 0xe8, 0x00, 0x00, 0x20, 
+0xff, 0x00, 0xff, 0x00, 0xd2, 0x00, 0x08, 0x80, 0x00, 0x00, 0x10, 0x08, 0x28, 0x04, 0x14, 0x14, 
+0x81, 0x0a, 0x0a, 0x1e, 0x1e, 0x16, 0x34, 0x3c, 0x6c, 0xd8, 0xf0, 0x70, 0xe0, 0x80, 0xe2, 0x00, 
+0x05, 0x80, 0xf8, 0x02, 0xf8, 0x06, 0x01, 0x80, 0x00, 0x04, 0x60, 0x70, 0x20, 0xe0, 0xe0, 0x81, 
+0x00, 0x0a, 0x30, 0x10, 0x50, 0x60, 0x00, 0x01, 0x07, 0xff, 0xf7, 0x7f, 0xf8, 0xe0, 0x00, 0x1c, 
+0x01, 0x1f, 0x78, 0xef, 0xbc, 0xf0, 0xc0, 0x80, 0x00, 0xc0, 0xe0, 0xb0, 0xa8, 0xe8, 0xec, 0x64, 
+0x40, 0x50, 0x34, 0x24, 0x08, 0x0c, 0x0c, 0x00, 0x10, 0x0f, 0x21, 0x0e, 0x03, 0xd4, 0x00, 0x03, 
+0xc0, 0x40, 0x20, 0xa0, 0x89, 0x00, 0x12, 0x01, 0x03, 0x07, 0x0d, 0x0f, 0x1b, 0x1f, 0x1f, 0x15, 
+0x14, 0xf4, 0x64, 0x04, 0x04, 0xc0, 0xfa, 0x78, 0x70, 0x80, 0xd9, 0x00, 0x0b, 0x08, 0x00, 0x00, 
+0x01, 0x81, 0xa0, 0x80, 0x84, 0x10, 0x40, 0x30, 0x0c, 0x8d, 0x00, 0x07, 0x16, 0x70, 0x60, 0x7d, 
+0x7d, 0x3f, 0x38, 0x1c, 0xa4, 0x00, 0x00, 0xd8, 0xff, 0x09, 0x7f, 0x07, 0xc0, 0xf4, 0xf0, 0x01, 
+0x37, 0xf7, 0x07, 0x07, 0x80, 0xf3, 0x07, 0x03, 0x1f, 0x0f, 0xe7, 0xe7, 0xf7, 0xe7, 0x00, 0xe8, 
+0xff, 0x01, 0xfc, 0xfc, 0x80, 0xff, 0x04, 0xfe, 0xfc, 0xff, 0xfc, 0xfc, 0x80, 0xff, 0x81, 0xfc, 
+0x80, 0xf9, 0x00, 0xf8, 0xff, 0xff, 0xd0, 0xff, 0x05, 0x7f, 0x3f, 0x3f, 0x1f, 0x9f, 0x8f, 0x85, 
+0xcf, 0x04, 0x8f, 0x9f, 0x1f, 0x3f, 0x7f, 0xe6, 0xff, 0x05, 0x3f, 0x0f, 0x83, 0xf0, 0xf8, 0xfe, 
+0x84, 0xff, 0x02, 0x3f, 0x3f, 0x7f, 0x81, 0xff, 0x06, 0x3f, 0x1e, 0x3c, 0xf8, 0xe1, 0x03, 0x0f, 
+0xe2, 0xff, 0x09, 0xf0, 0x80, 0x07, 0x3f, 0xff, 0xff, 0x3f, 0x1f, 0x9f, 0xdf, 0x80, 0xcf, 0x02, 
+0xce, 0xee, 0xef, 0x80, 0xe7, 0x07, 0x67, 0x27, 0x07, 0x1f, 0x7f, 0x1f, 0x00, 0xc0, 0xd7, 0xff, 
+0x07, 0x7f, 0x3f, 0x1f, 0x9f, 0x1f, 0x3f, 0x7f, 0x7f, 0x82, 0xff, 0x05, 0xfe, 0xfc, 0xf8, 0xf0, 
+0xe0, 0xe3, 0x80, 0xc7, 0x0d, 0x83, 0x93, 0x9b, 0x99, 0x9d, 0xcc, 0x4c, 0x0c, 0x24, 0x20, 0x72, 
+0xf0, 0xf8, 0xfc, 0xaf, 0xff, 0x00, 0xfe, 0xa6, 0xff, 0x09, 0xc0, 0xc0, 0x9f, 0x9c, 0x98, 0x98, 
+0x9c, 0x8c, 0xc0, 0xe1, 0x8d, 0xff, 0x08, 0xbf, 0x00, 0x00, 0x30, 0x3c, 0x3c, 0x00, 0x81, 0xf3, 
+0x84, 0xff, 0x00, 0xfe, 0x9c, 0xff, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xbd, 0x00, 0x08, 
+0x40, 0x00, 0x20, 0x00, 0x10, 0x50, 0x50, 0x40, 0x40, 0x80, 0x50, 0x05, 0xd0, 0xb0, 0xa0, 0x60, 
+0xc0, 0x80, 0xe5, 0x00, 0x05, 0x80, 0x30, 0x08, 0x62, 0x08, 0x04, 0x84, 0x00, 0x03, 0x80, 0x00, 
+0x40, 0x80, 0x80, 0x00, 0x07, 0x81, 0x03, 0x26, 0xcd, 0x3b, 0xe6, 0x1c, 0xf0, 0xe1, 0x00, 0x1b, 
+0x1f, 0xf0, 0x8f, 0x78, 0xc0, 0x00, 0x00, 0xc0, 0xe0, 0x60, 0x20, 0x30, 0x30, 0x31, 0x30, 0x10, 
+0x90, 0x98, 0xd8, 0xd8, 0x58, 0x59, 0xf9, 0xe0, 0x40, 0x1f, 0x80, 0x3f, 0xd9, 0x00, 0x02, 0x20, 
+0xa0, 0x20, 0x84, 0x00, 0x17, 0x01, 0x06, 0x0d, 0x1b, 0x37, 0x2f, 0x60, 0x46, 0x42, 0x43, 0x93, 
+0x83, 0x81, 0x83, 0x05, 0x54, 0xc5, 0xc4, 0x60, 0x42, 0x83, 0x08, 0x04, 0x02, 0xd8, 0x00, 0x07, 
+0x06, 0x00, 0x40, 0x00, 0x04, 0x00, 0x04, 0x02, 0x90, 0x00, 0x08, 0xa0, 0x03, 0x41, 0x50, 0x44, 
+0x4c, 0x00, 0x86, 0x1c, 0xa4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xbd, 0x00, 0x02, 
+0x40, 0x00, 0x20, 0x81, 0x00, 0x08, 0x10, 0x10, 0x00, 0x00, 0x80, 0x20, 0x00, 0x40, 0x80, 0xe7, 
+0x00, 0x05, 0x60, 0x08, 0xc4, 0x11, 0x04, 0x02, 0x84, 0x00, 0x02, 0x80, 0xc0, 0x80, 0x80, 0x00, 
+0x07, 0x81, 0x02, 0x44, 0xc9, 0x32, 0xc4, 0x18, 0xe0, 0xe1, 0x00, 0x04, 0x0e, 0x60, 0x04, 0x70, 
+0x80, 0x82, 0x00, 0x03, 0x0e, 0x0e, 0x0c, 0x00, 0x80, 0x01, 0x0a, 0x80, 0x00, 0xc0, 0xc1, 0xc3, 
+0x80, 0x01, 0x80, 0x3f, 0x80, 0x7b, 0xd7, 0x00, 0x04, 0x80, 0x40, 0x00, 0x00, 0x20, 0x80, 0x00, 
+0x00, 0x80, 0x80, 0x00, 0x18, 0x01, 0x06, 0x09, 0x12, 0x24, 0x08, 0x40, 0x10, 0x1a, 0x9c, 0xbd, 
+0x2d, 0x2c, 0x26, 0x04, 0x06, 0x06, 0x07, 0x07, 0xa3, 0x81, 0x01, 0x00, 0x02, 0x01, 0xd7, 0x00, 
+0x0b, 0x3e, 0x79, 0x5e, 0x1f, 0x10, 0x5f, 0x58, 0x5c, 0x7e, 0x7d, 0x3f, 0x1e, 0x8d, 0x00, 0x08, 
+0x20, 0x04, 0xc2, 0x81, 0x88, 0x10, 0x00, 0x04, 0x20, 0xa4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 
+0xff, 0x00, 0xba, 0x00, 0x06, 0x80, 0xc0, 0x40, 0x20, 0xa0, 0x80, 0x10, 0x80, 0x50, 0x00, 0x10, 
+0x80, 0x00, 0x03, 0x20, 0x00, 0x40, 0x80, 0xe6, 0x00, 0x08, 0xc0, 0xf0, 0x9c, 0xf6, 0x3b, 0x0c, 
+0x02, 0x01, 0x01, 0x88, 0x00, 0x07, 0x01, 0x82, 0x84, 0x89, 0x32, 0xc4, 0x38, 0xe0, 0xe1, 0x00, 
+0x0e, 0x1f, 0xf1, 0x9f, 0x7b, 0x80, 0x00, 0x08, 0x5c, 0x5c, 0x60, 0x60, 0x2e, 0x3e, 0x3c, 0x10, 
+0x80, 0x18, 0x0a, 0x03, 0x83, 0x03, 0x01, 0x03, 0x01, 0xe0, 0x7f, 0xc0, 0x7f, 0x04, 0xda, 0x00, 
+0x04, 0x20, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x18, 0x03, 0x06, 0x09, 0x12, 0x04, 0x08, 0x00, 
+0x10, 0x0c, 0x04, 0x86, 0xa6, 0xa2, 0xa3, 0xa3, 0x81, 0x51, 0x51, 0x49, 0x2c, 0x16, 0x1b, 0x0c, 
+0x07, 0x01, 0xd7, 0x00, 0x02, 0x1e, 0x01, 0x0c, 0x81, 0x00, 0x03, 0x01, 0x20, 0x00, 0x0e, 0x90, 
+0x00, 0x07, 0x18, 0x00, 0x22, 0x11, 0x81, 0x40, 0x02, 0xd0, 0xa4, 0x00, 0x01, 0xdd, 0x00, 0x00, 
+0x01, 0xff, 0x00, 0x82, 0x00, 0x04, 0xf0, 0xf8, 0xc0, 0x70, 0x20, 0xe7, 0x00, 0x1d, 0x7e, 0xfe, 
+0x06, 0x06, 0x0e, 0x7c, 0x0e, 0x06, 0x06, 0xfc, 0x7c, 0xfc, 0xc6, 0x86, 0xc6, 0xfc, 0xf8, 0xff, 
+0xff, 0x1b, 0x30, 0x60, 0x40, 0x38, 0x7c, 0xce, 0x8e, 0xce, 0xcc, 0x40, 0xc4, 0x00, 0x17, 0x80, 
+0xc0, 0xe0, 0x60, 0x30, 0x38, 0x18, 0x98, 0xd8, 0xcc, 0xec, 0x6c, 0x7c, 0x68, 0x28, 0x28, 0x08, 
+0x40, 0x00, 0x80, 0xa0, 0x40, 0xc0, 0x80, 0xe2, 0x00, 0x1f, 0xc0, 0xfc, 0x7e, 0x07, 0x01, 0xf0, 
+0x80, 0x4c, 0x0e, 0x87, 0x83, 0xc1, 0xc0, 0x4c, 0x6e, 0x64, 0x60, 0x40, 0xc0, 0xc0, 0x80, 0x00, 
+0x00, 0x03, 0x07, 0xff, 0xfb, 0x07, 0x0e, 0x3c, 0xf8, 0xc0, 0xdd, 0x00, 0x0f, 0x03, 0x1f, 0x7e, 
+0xe0, 0xc0, 0x19, 0xf9, 0xef, 0x9f, 0x19, 0x30, 0x28, 0x3c, 0x3c, 0x00, 0x40, 0x80, 0x00, 0x0c, 
+0x2c, 0x0f, 0x07, 0x9f, 0xc3, 0xf3, 0x7c, 0x1f, 0x00, 0x00, 0xe0, 0xff, 0x3f, 0xdb, 0x00, 0x0f, 
+0x20, 0x80, 0x00, 0x20, 0x00, 0x00, 0x03, 0x03, 0x06, 0x0d, 0x0b, 0x12, 0x04, 0x00, 0x28, 0x28, 
+0x81, 0x78, 0x0b, 0x7c, 0x6c, 0x6e, 0x67, 0x63, 0x31, 0x30, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0xdd, 
+0x00, 0x05, 0x10, 0x40, 0x00, 0x21, 0x00, 0x10, 0x90, 0x00, 0x08, 0x40, 0x20, 0x8c, 0x44, 0x22, 
+0x02, 0x81, 0x00, 0x18, 0xa4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb0, 0x00, 0x08, 
+0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xf8, 0x6c, 0x3c, 0x36, 0x80, 0x1e, 0x0c, 0x0a, 0x0a, 0x02, 0x10, 
+0x14, 0x04, 0x20, 0x08, 0x40, 0x80, 0x60, 0xc0, 0x80, 0xe2, 0x00, 0x0a, 0xf8, 0xfe, 0xcf, 0xfd, 
+0x7e, 0x07, 0x71, 0x40, 0x40, 0x30, 0x80, 0x80, 0x00, 0x0e, 0x0e, 0x02, 0xaa, 0xe4, 0x60, 0x40, 
+0xc0, 0xc0, 0x80, 0x01, 0x07, 0xfc, 0xff, 0xfe, 0xf8, 0xe0, 0x00, 0x1c, 0x03, 0x1f, 0x3f, 0xef, 
+0xbf, 0x61, 0xc7, 0x01, 0x01, 0x08, 0x1c, 0x1e, 0x36, 0x26, 0x66, 0x67, 0x63, 0x23, 0x21, 0x30, 
+0x30, 0xbc, 0xd7, 0xef, 0xfb, 0xdf, 0xf7, 0x7f, 0x1f, 0xdd, 0x00, 0x0a, 0x80, 0x40, 0x20, 0x00, 
+0x00, 0x80, 0x20, 0x01, 0x03, 0x00, 0x04, 0x80, 0x00, 0x00, 0x10, 0x82, 0x14, 0x08, 0x16, 0x1e, 
+0x1e, 0x1f, 0x0f, 0x0f, 0x07, 0x03, 0x01, 0xdf, 0x00, 0x09, 0x21, 0x00, 0x12, 0x01, 0x00, 0x08, 
+0x04, 0x00, 0x00, 0x01, 0x90, 0x00, 0x08, 0x40, 0x20, 0x08, 0x44, 0x22, 0x12, 0xa1, 0x01, 0x04, 
+0xa4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0x09, 0x80, 0x60, 0xb0, 0xd8, 
+0x68, 0x24, 0x14, 0x02, 0x0a, 0x08, 0x82, 0x00, 0x01, 0x08, 0x02, 0x80, 0x00, 0x02, 0x40, 0x90, 
+0x20, 0xe4, 0x00, 0x12, 0xf8, 0x07, 0xf1, 0x0e, 0x01, 0x00, 0xf0, 0x80, 0xc0, 0xb0, 0xc0, 0x40, 
+0xc0, 0xc0, 0xa6, 0xa0, 0x8e, 0x04, 0x80, 0x82, 0x00, 0x03, 0x02, 0xf8, 0x03, 0xf8, 0xe1, 0x00, 
+0x0b, 0x01, 0x0c, 0x21, 0x44, 0x10, 0x00, 0x00, 0x06, 0x04, 0x04, 0x05, 0x01, 0x81, 0x05, 0x0b, 
+0x06, 0x02, 0x03, 0x01, 0x80, 0x80, 0x60, 0x30, 0xcc, 0x63, 0x18, 0x07, 0xdc, 0x00, 0x0a, 0x80, 
+0xc0, 0xe0, 0xf0, 0xf0, 0xd0, 0xd0, 0x90, 0x00, 0x40, 0xc0, 0x81, 0x00, 0x01, 0x08, 0x02, 0x81, 
+0x00, 0x07, 0x0a, 0x0a, 0x08, 0x05, 0x05, 0x02, 0x03, 0x01, 0x83, 0x00, 0x01, 0x80, 0x80, 0xd8, 
+0x00, 0x0b, 0x0f, 0x1f, 0x07, 0x0f, 0x59, 0x7c, 0x7e, 0x37, 0x33, 0x18, 0x1f, 0x0e, 0x90, 0x00, 
+0x08, 0x20, 0x1c, 0x46, 0xa3, 0x99, 0x81, 0x60, 0x03, 0xc4, 0xa4, 0x00, 0x01, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xaf, 0x00, 0x00, 0x40, 0x80, 0x00, 0x07, 0x04, 0x10, 0x02, 0x08, 0x00, 0x00, 
+0x01, 0x01, 0x88, 0x00, 0x00, 0x80, 0xe3, 0x00, 0x02, 0x04, 0x00, 0x08, 0x80, 0x00, 0x0b, 0x80, 
+0x80, 0x10, 0x00, 0x40, 0x00, 0x80, 0x8c, 0x28, 0xa0, 0x40, 0xc0, 0x83, 0x00, 0x00, 0x04, 0xe4, 
+0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x03, 0x80, 0x02, 0x81, 0x04, 0x05, 0x00, 0x01, 0x01, 0x00, 
+0x00, 0x01, 0x80, 0x00, 0x05, 0x40, 0x00, 0x80, 0x02, 0x10, 0x04, 0xda, 0x00, 0x0c, 0xc0, 0xe0, 
+0x70, 0xb8, 0xdc, 0xec, 0x7c, 0xcc, 0xc8, 0xc0, 0xf0, 0xe0, 0x80, 0x83, 0x00, 0x00, 0x08, 0x80, 
+0x02, 0x03, 0x0a, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0xc0, 0xc0, 0x40, 0xd6, 0x00, 0x08, 0x03, 
+0x07, 0x0e, 0x03, 0x11, 0x3f, 0x37, 0x3b, 0x1f, 0x80, 0x0f, 0x00, 0x07, 0x92, 0x00, 0x08, 0xe0, 
+0x03, 0x41, 0x18, 0x00, 0x08, 0x00, 0x04, 0x38, 0xa4, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xae, 0x00, 0x04, 0x80, 0x20, 0x10, 0x48, 0x20, 0x83, 0x00, 0x01, 0x01, 0x01, 0x80, 0x00, 
+0x07, 0x08, 0x02, 0x10, 0x24, 0x48, 0x90, 0x20, 0x40, 0x89, 0x00, 0x01, 0x80, 0x80, 0x80, 0x00, 
+0x02, 0x80, 0x80, 0x00, 0x81, 0x80, 0x02, 0x00, 0x80, 0xc0, 0x81, 0x00, 0x00, 0x80, 0xc3, 0x00, 
+0x0b, 0xf0, 0x02, 0xe0, 0x06, 0x01, 0x00, 0x80, 0x90, 0x80, 0x40, 0x00, 0x00, 0x80, 0x40, 0x02, 
+0x42, 0xc2, 0x80, 0x83, 0x00, 0x03, 0x03, 0xf8, 0x01, 0xfc, 0x87, 0x00, 0x13, 0x01, 0x01, 0xc3, 
+0x76, 0x1e, 0x07, 0x01, 0x1f, 0x31, 0x20, 0x20, 0x33, 0x1f, 0x0d, 0x1f, 0x38, 0x30, 0x30, 0x1c, 
+0x0f, 0xc3, 0x00, 0x11, 0x01, 0x0c, 0x10, 0x46, 0x98, 0x23, 0x43, 0x82, 0x00, 0x08, 0x0a, 0x0f, 
+0x0f, 0x0d, 0x05, 0x02, 0x03, 0x01, 0x82, 0x00, 0x04, 0x10, 0x0c, 0x21, 0x08, 0x03, 0x80, 0x80, 
+0x84, 0x00, 0x02, 0x0c, 0x07, 0x01, 0xcd, 0x00, 0x13, 0x20, 0x10, 0x48, 0x24, 0x10, 0x00, 0xc0, 
+0x00, 0x00, 0x30, 0x00, 0x00, 0x01, 0x02, 0x00, 0x04, 0x01, 0x00, 0x08, 0x0a, 0x80, 0x02, 0x82, 
+0x00, 0x00, 0x02, 0x80, 0x00, 0x0c, 0x20, 0xf0, 0xff, 0xff, 0x39, 0x3b, 0x5f, 0x1f, 0xce, 0xce, 
+0xec, 0x7c, 0x38, 0xd3, 0x00, 0x05, 0x02, 0x08, 0x00, 0x04, 0x00, 0x02, 0x96, 0x00, 0x02, 0x01, 
+0xfe, 0xfe, 0x80, 0x86, 0x01, 0xfe, 0xf8, 0xa5, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
+0xae, 0x00, 0x07, 0x80, 0xe0, 0x70, 0xf8, 0xd8, 0x7c, 0x6c, 0x7e, 0x84, 0x36, 0x08, 0x76, 0x6e, 
+0xec, 0xdc, 0xb8, 0xf0, 0xe0, 0xc0, 0x80, 0xe3, 0x00, 0x09, 0x10, 0x06, 0x01, 0x06, 0x03, 0x01, 
+0x80, 0x60, 0x30, 0x60, 0x81, 0x80, 0x0c, 0x8c, 0x0c, 0x0c, 0xc0, 0xc0, 0x00, 0x01, 0x01, 0x07, 
+0x0f, 0xff, 0x0f, 0x7e, 0xe2, 0x00, 0x20, 0x3e, 0xf0, 0xff, 0xf8, 0xe0, 0xc0, 0x80, 0xc0, 0xe2, 
+0x3f, 0x1d, 0x19, 0x19, 0xdf, 0xff, 0x38, 0x00, 0x01, 0x01, 0x00, 0x00, 0x80, 0xc0, 0x30, 0x84, 
+0x60, 0x08, 0x80, 0x00, 0x40, 0x40, 0x80, 0x80, 0xd5, 0x00, 0x16, 0x10, 0x08, 0x24, 0x10, 0x02, 
+0x82, 0x00, 0x00, 0x04, 0x3b, 0x07, 0x0e, 0x1d, 0x1c, 0x3c, 0x39, 0x38, 0x7a, 0x62, 0x60, 0x6b, 
+0x6d, 0x6c, 0x80, 0x36, 0x12, 0x1f, 0x1f, 0x0f, 0x06, 0x03, 0x01, 0x20, 0x88, 0x00, 0x00, 0x05, 
+0x02, 0x40, 0x50, 0x09, 0xa9, 0x9a, 0x42, 0x24, 0xd0, 0x00, 0x09, 0x02, 0x04, 0x0d, 0x0d, 0x05, 
+0x04, 0x00, 0x00, 0x02, 0x01, 0x95, 0x00, 0x84, 0x01, 0xa6, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 
+0xff, 0x00, 0xb1, 0x00, 0x05, 0x40, 0x00, 0x80, 0x00, 0x10, 0x50, 0x80, 0x00, 0x08, 0x40, 0x50, 
+0x50, 0x10, 0x80, 0x20, 0x40, 0x00, 0x80, 0xe6, 0x00, 0x00, 0x10, 0x83, 0x00, 0x02, 0x80, 0xc0, 
+0x80, 0x84, 0x00, 0x09, 0x40, 0x40, 0x00, 0x00, 0x02, 0x08, 0x31, 0x04, 0x10, 0x80, 0xe1, 0x00, 
+0x04, 0x0f, 0x40, 0x06, 0x60, 0x80, 0x80, 0x00, 0x02, 0xce, 0xee, 0x32, 0x80, 0x10, 0x05, 0xd0, 
+0xf8, 0x38, 0x80, 0x86, 0x06, 0x82, 0x00, 0x04, 0x07, 0x00, 0x0f, 0x00, 0x40, 0xd8, 0x00, 0x1b, 
+0x60, 0x08, 0x44, 0x10, 0x82, 0x88, 0x08, 0x0a, 0x12, 0x01, 0x84, 0x08, 0x12, 0x04, 0x24, 0x08, 
+0x49, 0x59, 0x1b, 0x0a, 0x0a, 0x00, 0x06, 0x01, 0x51, 0x40, 0x00, 0x20, 0x82, 0x00, 0x00, 0x30, 
+0x81, 0x00, 0x03, 0x14, 0x10, 0x20, 0xa4, 0x80, 0x00, 0x00, 0x10, 0xd1, 0x00, 0x07, 0x02, 0x00, 
+0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0xc6, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb0, 
+0x00, 0x03, 0x80, 0x80, 0xc0, 0xe0, 0x80, 0x60, 0x80, 0x30, 0x00, 0x70, 0x80, 0x60, 0x03, 0xe0, 
+0xc0, 0x80, 0x80, 0xe7, 0x00, 0x07, 0xf0, 0x78, 0x9e, 0xc7, 0xc3, 0x61, 0x60, 0x20, 0x81, 0x30, 
+0x80, 0x10, 0x0a, 0x30, 0x30, 0xb0, 0xb0, 0x30, 0x61, 0x63, 0x6f, 0xfe, 0x38, 0x60, 0xe1, 0x00, 
+0x04, 0xf8, 0xf3, 0xa0, 0xfe, 0x81, 0x81, 0x00, 0x02, 0x0f, 0x0f, 0x02, 0x83, 0x00, 0x0d, 0x80, 
+0x87, 0x87, 0x80, 0xc0, 0x40, 0x00, 0xc0, 0xfe, 0x7c, 0x07, 0x7e, 0x3c, 0x30, 0xd7, 0x00, 0x22, 
+0x98, 0x04, 0x30, 0x82, 0x08, 0x40, 0x40, 0x29, 0x11, 0x03, 0x73, 0x13, 0x24, 0x2b, 0x04, 0x48, 
+0x08, 0x18, 0x18, 0x1a, 0x3e, 0x3f, 0x3f, 0x29, 0x09, 0x1d, 0x57, 0x5b, 0x3d, 0x3e, 0x37, 0x1b, 
+0x1d, 0x0c, 0x07, 0x82, 0x00, 0x01, 0x20, 0x80, 0x80, 0x00, 0x00, 0x10, 0xd2, 0x00, 0x06, 0x02, 
+0x00, 0x00, 0x02, 0x02, 0x00, 0x01, 0xc6, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xff, 0x06, 
+0x7f, 0x1f, 0x3f, 0x3f, 0x7f, 0x1f, 0x1f, 0x80, 0xff, 0x04, 0x1f, 0x7f, 0xff, 0xff, 0x1f, 0x80, 
+0xff, 0x02, 0xbf, 0x1f, 0x3f, 0xe8, 0xff, 0x00, 0xfe, 0x83, 0xc0, 0x0e, 0xcc, 0xc0, 0xc0, 0x80, 
+0x80, 0x99, 0xc1, 0xc0, 0xc1, 0xc1, 0xdf, 0xc3, 0xc0, 0xc0, 0xcf, 0xc3, 0xff, 0x03, 0x7f, 0x7f, 
+0x3f, 0x3f, 0x81, 0x9f, 0x00, 0xdf, 0x86, 0xcf, 0x00, 0xdf, 0x80, 0x9f, 0x80, 0x3f, 0x00, 0x7f, 
+0xdf, 0xff, 0x05, 0x0f, 0x03, 0x01, 0xf8, 0xfc, 0xfe, 0x8c, 0xff, 0x03, 0x7f, 0x7f, 0x3f, 0x3f, 
+0x80, 0xff, 0x05, 0xfe, 0xfe, 0xfc, 0x70, 0x01, 0x07, 0x80, 0x7f, 0x85, 0xff, 0x01, 0x3f, 0x1f, 
+0x80, 0xcf, 0x0c, 0xff, 0x9f, 0x1f, 0xcf, 0xef, 0xef, 0xcf, 0xff, 0xcf, 0x1f, 0x7f, 0x3f, 0x0f, 
+0xb9, 0xff, 0x23, 0x9f, 0x07, 0x03, 0x73, 0x71, 0x79, 0x38, 0x38, 0x10, 0x01, 0x03, 0xe7, 0xe7, 
+0xce, 0xce, 0xc0, 0xd0, 0x90, 0x80, 0x80, 0x93, 0x93, 0x97, 0x97, 0x93, 0x93, 0x9a, 0xd8, 0xce, 
+0xce, 0xcf, 0xe7, 0xe7, 0xe3, 0xf3, 0xc9, 0x80, 0x00, 0x13, 0x06, 0x26, 0x20, 0x30, 0x38, 0x19, 
+0x81, 0xc3, 0xe7, 0xff, 0xff, 0xfc, 0xf8, 0xf9, 0xfb, 0xfb, 0xf9, 0xfc, 0xf8, 0xf9, 0x81, 0xff, 
+0x06, 0x7f, 0x0e, 0xc0, 0xf8, 0xff, 0xfd, 0xfd, 0x97, 0xff, 0x00, 0xfe, 0x9d, 0xff, 0x02, 0xfe, 
+0xfe, 0xfc, 0x80, 0xfe, 0x02, 0xfc, 0xfe, 0xfe, 0x99, 0xff, 0x01, 0xfe, 0xfe, 0x89, 0xff, 0x00, 
+0xfe, 0x87, 0xff, 0x01, 0xf8, 0xfc, 0x90, 0xff, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xad, 
+0x00, 0x0a, 0x80, 0xe0, 0xf0, 0xf8, 0xfc, 0xce, 0x66, 0x37, 0x1f, 0x1b, 0x0b, 0x81, 0x0f, 0x07, 
+0x1e, 0x1e, 0x0c, 0x7c, 0xf8, 0xf0, 0xc0, 0x80, 0xe5, 0x00, 0x08, 0x7c, 0x7f, 0xc7, 0x38, 0x5e, 
+0x63, 0x60, 0x60, 0x20, 0x86, 0x30, 0x07, 0x20, 0x60, 0x60, 0x63, 0x3f, 0x3f, 0x3e, 0x40, 0xdf, 
+0x00, 0x0f, 0xf0, 0x7c, 0x7e, 0x87, 0x00, 0x1e, 0x7c, 0xf7, 0xce, 0x9e, 0x1e, 0x1c, 0x1c, 0x18, 
+0x0c, 0x0c, 0x82, 0x06, 0x0c, 0x86, 0x86, 0xc6, 0xc6, 0xc3, 0xe1, 0x7f, 0x1e, 0x00, 0x03, 0x8f, 
+0xfe, 0x78, 0x88, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x80, 0x83, 0x00, 0x04, 0x50, 0x00, 0x00, 
+0x20, 0x80, 0xb9, 0x00, 0x24, 0x60, 0xc8, 0x00, 0x72, 0x49, 0x45, 0x04, 0x26, 0x1c, 0x01, 0x83, 
+0x20, 0x18, 0x32, 0x36, 0x39, 0x21, 0x73, 0x67, 0x67, 0x74, 0x54, 0x50, 0x50, 0x74, 0x74, 0x79, 
+0x2b, 0x3f, 0x36, 0x33, 0x19, 0x18, 0x1c, 0x0c, 0x36, 0x0f, 0x80, 0x00, 0x07, 0x20, 0x04, 0x10, 
+0x08, 0x88, 0x02, 0x04, 0x18, 0x81, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x06, 0x82, 0x00, 0x02, 
+0x08, 0x00, 0x04, 0xbb, 0x00, 0x08, 0x01, 0x01, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x01, 0x99, 
+0x00, 0x01, 0x01, 0x01, 0x95, 0x00, 0x00, 0x02, 0x90, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xad, 
+0x00, 0x06, 0x80, 0xe0, 0x70, 0x38, 0x18, 0x1c, 0x0c, 0x86, 0x06, 0x07, 0x0e, 0x0c, 0x1c, 0x38, 
+0x70, 0xe0, 0xc0, 0x80, 0xe3, 0x00, 0x0e, 0xf8, 0xff, 0x07, 0x01, 0x60, 0x18, 0xcc, 0x14, 0x10, 
+0x52, 0x9e, 0xcf, 0xff, 0x1b, 0x4b, 0x80, 0x4f, 0x08, 0xcf, 0xde, 0x9d, 0x8f, 0x7c, 0xf8, 0xf3, 
+0x3f, 0x7c, 0xe2, 0x00, 0x0c, 0x01, 0x0f, 0x3e, 0x84, 0x0c, 0xf8, 0x0e, 0x49, 0x74, 0x67, 0x67, 
+0x63, 0x21, 0x84, 0x20, 0x08, 0xa1, 0xe3, 0xff, 0x7c, 0x3f, 0xe0, 0xf8, 0xfe, 0xc0, 0xe0, 0x00, 
+0x80, 0x80, 0x0c, 0x03, 0x1f, 0x7d, 0xf4, 0xcd, 0x99, 0x18, 0x1a, 0x12, 0x14, 0x00, 0x00, 0x08, 
+0x80, 0x00, 0x0a, 0x05, 0x05, 0x07, 0x06, 0x06, 0xc3, 0xe1, 0x7f, 0x1f, 0x81, 0x80, 0x80, 0xe0, 
+0x03, 0x40, 0x40, 0x00, 0x80, 0xd3, 0x00, 0x10, 0x30, 0xfc, 0xfe, 0xc7, 0xc3, 0xc3, 0xe1, 0xf3, 
+0xff, 0x7f, 0x38, 0x00, 0x03, 0x07, 0x06, 0x0e, 0x1c, 0x80, 0x18, 0x80, 0x38, 0x16, 0x18, 0x18, 
+0x1c, 0x0c, 0x0e, 0x07, 0x03, 0x01, 0x00, 0x0e, 0x1f, 0x3f, 0xcf, 0xe7, 0xe7, 0xe1, 0xe0, 0xc4, 
+0xc0, 0xcf, 0x6e, 0x7c, 0x38, 0xd2, 0x00, 0x00, 0x01, 0xcc, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 
+0xac, 0x00, 0x07, 0x80, 0x60, 0x90, 0x40, 0x20, 0x04, 0x10, 0x02, 0x85, 0x00, 0x08, 0x0a, 0x02, 
+0x14, 0x24, 0x48, 0x90, 0x20, 0xc0, 0x80, 0xe2, 0x00, 0x0d, 0xf8, 0x07, 0xf0, 0x06, 0xe1, 0x10, 
+0x44, 0x32, 0x0a, 0x02, 0x50, 0x04, 0x00, 0xe0, 0x81, 0x00, 0x09, 0x80, 0x06, 0x4e, 0x0d, 0x83, 
+0x00, 0x03, 0xfc, 0x03, 0xfc, 0xe1, 0x00, 0x0d, 0x03, 0x0e, 0x31, 0x46, 0x98, 0x00, 0x04, 0x01, 
+0x80, 0x94, 0x04, 0x04, 0x02, 0x41, 0x82, 0x00, 0x08, 0xc0, 0xc0, 0x40, 0x00, 0x01, 0x80, 0xc3, 
+0xd8, 0x87, 0xe6, 0x00, 0x07, 0x01, 0x02, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x02, 0x83, 0x00, 0x12, 
+0x01, 0x0c, 0x1c, 0x3e, 0x3f, 0x39, 0x70, 0xe1, 0xc1, 0xc7, 0x0f, 0x7c, 0x18, 0x80, 0x60, 0xc0, 
+0xc0, 0x80, 0x80, 0x84, 0x00, 0x00, 0x40, 0x80, 0x00, 0x02, 0x20, 0x00, 0x80, 0x83, 0x00, 0x04, 
+0x50, 0x00, 0x00, 0x20, 0x80, 0xda, 0x00, 0x03, 0x0f, 0x1e, 0x3e, 0x3f, 0x80, 0x18, 0x02, 0x19, 
+0x1f, 0x1f, 0x86, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x06, 0x81, 0x00, 0x03, 0x80, 0x08, 0x00, 
+0x04, 0xfa, 0x00, 0x00, 0x02, 0x90, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xad, 0x00, 0x07, 0x20, 
+0x90, 0x50, 0x68, 0x2c, 0x14, 0x16, 0x1e, 0x80, 0x1a, 0x81, 0x1e, 0x06, 0x3c, 0x7c, 0x78, 0xd8, 
+0xb0, 0x60, 0xc0, 0xe5, 0x00, 0x19, 0x01, 0x08, 0x02, 0x00, 0x08, 0x80, 0x60, 0x08, 0x02, 0x00, 
+0x00, 0x08, 0x00, 0x00, 0x80, 0xb0, 0x78, 0xd8, 0x7e, 0x3e, 0xfe, 0xe1, 0xc7, 0xfd, 0x07, 0x7c, 
+0xe1, 0x00, 0x0b, 0x01, 0x1c, 0x70, 0xce, 0x98, 0x99, 0x18, 0x1c, 0x31, 0x30, 0x24, 0xa0, 0x80, 
+0x20, 0x01, 0x60, 0x61, 0x80, 0x67, 0x08, 0x87, 0x87, 0xde, 0x38, 0x0f, 0x83, 0xe0, 0xc6, 0x80, 
+0xe4, 0x00, 0x04, 0x03, 0x07, 0x07, 0x0d, 0x0f, 0x80, 0x1e, 0x80, 0x34, 0x12, 0x14, 0x14, 0x16, 
+0x1a, 0x0a, 0x09, 0x09, 0x18, 0x3c, 0x3e, 0x39, 0x70, 0xe1, 0xc1, 0xc7, 0x8f, 0xfc, 0xf8, 0x60, 
+0x89, 0x00, 0x00, 0x40, 0x80, 0x00, 0x02, 0x20, 0x00, 0x80, 0x83, 0x00, 0x04, 0x50, 0x00, 0x00, 
+0x20, 0x80, 0xda, 0x00, 0x80, 0x01, 0x8d, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x06, 0x81, 0x00, 
+0x03, 0x80, 0x08, 0x00, 0x04, 0xfa, 0x00, 0x00, 0x02, 0x90, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 
+0xac, 0x00, 0x08, 0x80, 0xc0, 0xe0, 0xe0, 0xf0, 0xf0, 0xd8, 0xd8, 0x78, 0x80, 0x7c, 0x00, 0xf8, 
+0x80, 0xd8, 0x05, 0xb0, 0xf0, 0x60, 0xe0, 0xc0, 0x80, 0xe4, 0x00, 0x1b, 0xc0, 0x08, 0x86, 0x19, 
+0x04, 0x03, 0x0b, 0x0d, 0xde, 0x5e, 0xdc, 0x3c, 0x1c, 0xf0, 0x00, 0x80, 0x20, 0x00, 0x01, 0xa1, 
+0x0b, 0x87, 0x9e, 0x1d, 0x3f, 0x1e, 0xf8, 0x80, 0xe1, 0x00, 0x1b, 0xfe, 0xe0, 0xff, 0x30, 0x03, 
+0x46, 0xf4, 0xff, 0xd9, 0xd8, 0xc8, 0xcc, 0x44, 0x47, 0x46, 0x44, 0x46, 0x40, 0x40, 0x58, 0x78, 
+0x51, 0xd8, 0x38, 0x10, 0x80, 0x00, 0x01, 0xe2, 0x00, 0x07, 0x03, 0x07, 0x0f, 0x1c, 0x3c, 0x71, 
+0x68, 0xea, 0x80, 0xda, 0x80, 0xfb, 0x09, 0xdb, 0xdb, 0xfb, 0x7f, 0x7f, 0x3d, 0x3f, 0x18, 0x0c, 
+0x02, 0x92, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x80, 0x83, 0x00, 0x04, 0x10, 0x00, 0x00, 0x20, 
+0x80, 0xed, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x06, 0x82, 0x00, 0x02, 0x08, 0x00, 0x04, 0xfa, 
+0x00, 0x00, 0x02, 0x90, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0x01, 0x80, 0x80, 0x80, 
+0xc0, 0x81, 0x60, 0x00, 0xe0, 0x80, 0xc0, 0x01, 0x80, 0x80, 0xe8, 0x00, 0x19, 0x40, 0x30, 0x98, 
+0x6e, 0x3f, 0xfb, 0xff, 0x3d, 0xbe, 0xb6, 0x36, 0xf6, 0xe6, 0x06, 0x06, 0x86, 0xee, 0xfc, 0x25, 
+0x81, 0x83, 0xc7, 0x2e, 0x7c, 0xf8, 0xe0, 0xe2, 0x00, 0x1b, 0xfc, 0x00, 0xfc, 0x80, 0xc0, 0x63, 
+0xff, 0xdf, 0x78, 0x6f, 0x6f, 0xef, 0xcf, 0x87, 0x06, 0xfe, 0xfa, 0xe9, 0xc1, 0xf1, 0xe9, 0xf1, 
+0x4a, 0xde, 0xfc, 0x1f, 0x0f, 0x1f, 0xe1, 0x00, 0x1a, 0x07, 0x1f, 0x7f, 0xf7, 0xcf, 0x90, 0xe4, 
+0x8f, 0x59, 0xd9, 0xfd, 0xfe, 0xdd, 0x44, 0x42, 0x02, 0x02, 0x82, 0xa2, 0x03, 0x93, 0xd2, 0xda, 
+0x64, 0x30, 0x1c, 0x01, 0x91, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x80, 0x83, 0x00, 0x04, 0x10, 
+0x00, 0x00, 0x20, 0x80, 0xc0, 0x00, 0x02, 0x01, 0x03, 0x03, 0x80, 0x07, 0x01, 0x0f, 0x0f, 0x80, 
+0x0d, 0x06, 0x0c, 0x0e, 0x06, 0x07, 0x03, 0x03, 0x01, 0x98, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 
+0x06, 0x82, 0x00, 0x02, 0x08, 0x00, 0x04, 0xfa, 0x00, 0x00, 0x02, 0x90, 0x00, 0x01, 0xff, 0x00, 
+0xff, 0x00, 0xff, 0x00, 0xa7, 0x00, 0x0a, 0x80, 0xc0, 0xe0, 0x70, 0x38, 0x18, 0x0c, 0x0c, 0x8e, 
+0x86, 0x86, 0x82, 0xc6, 0x07, 0xce, 0x8c, 0x9c, 0xb8, 0x30, 0xf0, 0xc0, 0x80, 0xe4, 0x00, 0x1b, 
+0xfc, 0xff, 0xc3, 0xf0, 0x78, 0x9c, 0xce, 0xc7, 0x63, 0x73, 0x71, 0xe1, 0xc0, 0x80, 0x00, 0xf8, 
+0xfe, 0xef, 0xc7, 0xf7, 0x75, 0x6d, 0x7a, 0x37, 0x23, 0x06, 0x10, 0x80, 0xe1, 0x00, 0x1b, 0x07, 
+0x60, 0x83, 0x31, 0xc0, 0xaf, 0xa3, 0x06, 0xe0, 0xc0, 0xcc, 0xcf, 0x60, 0xbb, 0xe1, 0xe1, 0xa1, 
+0x7f, 0x3f, 0x1f, 0x13, 0x1a, 0x34, 0x85, 0x43, 0xa7, 0xfe, 0xff, 0xe3, 0x00, 0x18, 0x03, 0x07, 
+0x1f, 0x3d, 0x7c, 0x76, 0xf7, 0xf7, 0xff, 0xbf, 0xbd, 0x9d, 0x9d, 0x9c, 0x9e, 0x96, 0xd7, 0xd3, 
+0xd3, 0x71, 0x79, 0x3b, 0x1f, 0x0f, 0x03, 0xec, 0x00, 0x86, 0x01, 0xbb, 0x00, 0x01, 0xff, 0x00, 
+0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0x80, 0x80, 0x83, 0x40, 0x02, 0x00, 0x80, 0x80, 0xea, 0x00, 
+0x09, 0xc0, 0x30, 0x88, 0x64, 0x12, 0x0b, 0x05, 0x04, 0x02, 0x02, 0x82, 0x01, 0x0a, 0x00, 0x02, 
+0x02, 0x80, 0x84, 0x08, 0x02, 0x00, 0x80, 0x00, 0x40, 0xe2, 0x00, 0x1b, 0x7f, 0x00, 0x3e, 0x01, 
+0x20, 0x7c, 0xfe, 0x3f, 0x0f, 0xcb, 0x0f, 0x93, 0xb0, 0x98, 0xd8, 0x60, 0x36, 0x02, 0x81, 0x14, 
+0x08, 0x20, 0x30, 0x80, 0xc0, 0x7c, 0x00, 0xfe, 0x8f, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x80, 
+0x83, 0x00, 0x04, 0x10, 0x00, 0x00, 0x20, 0x80, 0xbe, 0x00, 0x0a, 0x02, 0x00, 0x01, 0x02, 0x0f, 
+0x91, 0x0d, 0x1f, 0x07, 0x43, 0xd3, 0x80, 0xf3, 0x0b, 0xf2, 0xf2, 0xb6, 0x36, 0x72, 0x82, 0x8a, 
+0x44, 0x27, 0x13, 0x0c, 0x07, 0x92, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x06, 0x81, 0x00, 0x03, 
+0x80, 0x08, 0x00, 0x04, 0xc6, 0x00, 0x01, 0x01, 0x00, 0x85, 0x02, 0x80, 0x01, 0xa4, 0x00, 0x00, 
+0x02, 0x90, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb1, 0x00, 0x00, 0x80, 0x80, 0x00, 
+0x03, 0x40, 0x40, 0x00, 0x00, 0x80, 0x80, 0xea, 0x00, 0x05, 0xc0, 0x30, 0x88, 0x64, 0x10, 0x08, 
+0x86, 0x00, 0x80, 0x02, 0x07, 0x04, 0x0d, 0x0b, 0x32, 0x64, 0xd8, 0x30, 0xc0, 0xe2, 0x00, 0x03, 
+0xff, 0x00, 0xfe, 0x81, 0x85, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x08, 0x04, 0x02, 0x19, 0x15, 0x00, 
+0x40, 0x02, 0x80, 0xe3, 0x7e, 0x01, 0xff, 0x8e, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x80, 0x83, 
+0x00, 0x04, 0x10, 0x00, 0x00, 0x20, 0x80, 0xbe, 0x00, 0x0a, 0x01, 0x07, 0x1c, 0x33, 0x6e, 0xd8, 
+0x84, 0x10, 0x00, 0x00, 0x90, 0x80, 0x80, 0x0c, 0x01, 0x81, 0x84, 0x04, 0x00, 0x11, 0x00, 0x80, 
+0x47, 0x24, 0x13, 0x08, 0x03, 0x91, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x06, 0x81, 0x00, 0x03, 
+0x80, 0x08, 0x00, 0x04, 0xc6, 0x00, 0x01, 0x01, 0x01, 0x81, 0x02, 0x80, 0x00, 0x00, 0x02, 0xa7, 
+0x00, 0x00, 0x02, 0x90, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb3, 0x00, 0x03, 0x40, 
+0x40, 0x00, 0xa0, 0x83, 0xe0, 0x80, 0xc0, 0x00, 0x80, 0xe6, 0x00, 0x06, 0xc0, 0xf0, 0xb8, 0xec, 
+0x32, 0x09, 0x04, 0x80, 0x00, 0x84, 0x01, 0x0a, 0x03, 0x03, 0x87, 0xce, 0xdd, 0xdb, 0x97, 0x2e, 
+0xdc, 0xf8, 0xe0, 0xe0, 0x00, 0x1d, 0xff, 0xff, 0x81, 0x7f, 0xff, 0x60, 0xf0, 0x38, 0xfc, 0x94, 
+0x70, 0x32, 0x07, 0xfb, 0xe3, 0x87, 0x02, 0x7e, 0x66, 0x77, 0x01, 0x71, 0x66, 0xde, 0x3f, 0x47, 
+0x60, 0xff, 0xff, 0x1f, 0x8b, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x80, 0x83, 0x00, 0x04, 0x10, 
+0x00, 0x00, 0x20, 0x80, 0xc0, 0x00, 0x1a, 0x03, 0x0f, 0x1e, 0x39, 0x7e, 0xf0, 0xeb, 0xcb, 0xcd, 
+0x98, 0x9f, 0x1f, 0xbb, 0x3b, 0x32, 0x32, 0x72, 0x32, 0x2a, 0x86, 0x06, 0x41, 0x20, 0x10, 0x0c, 
+0x07, 0x03, 0x8f, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x06, 0x82, 0x00, 0x02, 0x08, 0x00, 0x04, 
+0xc8, 0x00, 0x81, 0x01, 0x80, 0x03, 0x81, 0x01, 0xa4, 0x00, 0x00, 0x02, 0x90, 0x00, 0x01, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xb2, 0x00, 0x04, 0x40, 0x00, 0xa0, 0xa0, 0x10, 0x82, 0x50, 0x07, 
+0xd0, 0xf0, 0xf0, 0xa0, 0xe0, 0xe0, 0xc0, 0x80, 0xe5, 0x00, 0x09, 0xc0, 0x10, 0xc4, 0x30, 0x08, 
+0x00, 0x00, 0x01, 0x00, 0x80, 0x81, 0xc0, 0x0d, 0x80, 0x00, 0x00, 0x80, 0xc0, 0x21, 0x03, 0x17, 
+0xdf, 0xaf, 0x1f, 0x1e, 0xf8, 0xe0, 0xe1, 0x00, 0x1b, 0x7f, 0xe0, 0xff, 0xf0, 0x80, 0x00, 0x78, 
+0xe0, 0xf1, 0x08, 0x04, 0x1d, 0xc7, 0x41, 0x3f, 0x3e, 0x30, 0x3f, 0x3c, 0x29, 0x29, 0x61, 0x47, 
+0x80, 0x73, 0x10, 0xe0, 0x1f, 0x8a, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x80, 0x83, 0x00, 0x04, 
+0x10, 0x00, 0x00, 0x20, 0x80, 0xc3, 0x00, 0x0f, 0x01, 0x07, 0x0e, 0x1f, 0x3f, 0x30, 0x67, 0x64, 
+0xc7, 0xeb, 0xeb, 0xa3, 0xb1, 0xb1, 0xb0, 0xb9, 0x80, 0x49, 0x05, 0x24, 0x03, 0x01, 0x00, 0x00, 
+0x01, 0x8e, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x06, 0x82, 0x00, 0x02, 0x08, 0x00, 0x04, 0xfa, 
+0x00, 0x00, 0x02, 0x90, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb3, 0x00, 0x04, 0x20, 
+0x00, 0x10, 0x40, 0x00, 0x82, 0x28, 0x07, 0x08, 0x00, 0x50, 0x10, 0x80, 0x20, 0x40, 0x80, 0x92, 
+0x00, 0x00, 0x40, 0xcf, 0x00, 0x02, 0x20, 0x00, 0x40, 0x82, 0x00, 0x01, 0x80, 0xc0, 0x80, 0x40, 
+0x82, 0x00, 0x0c, 0xe0, 0xe0, 0x70, 0xf1, 0x92, 0x18, 0x01, 0x06, 0x16, 0x87, 0xef, 0xff, 0x3c, 
+0xde, 0x00, 0x1c, 0x18, 0x40, 0x0c, 0x60, 0x80, 0x00, 0x1c, 0x07, 0x89, 0x98, 0x81, 0x45, 0x4e, 
+0x40, 0x41, 0xfc, 0x50, 0x53, 0x57, 0xf4, 0xec, 0xcd, 0x0e, 0x0f, 0x0c, 0x00, 0x20, 0x03, 0x01, 
+0xe2, 0x00, 0x09, 0x01, 0x02, 0x04, 0x09, 0x12, 0x04, 0x23, 0x0b, 0x03, 0x43, 0x80, 0x52, 0x03, 
+0x51, 0x01, 0x00, 0x28, 0xff, 0x00, 0xb2, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb0, 
+0x00, 0x07, 0x80, 0x40, 0x20, 0x80, 0x10, 0x40, 0x00, 0x28, 0x86, 0x00, 0x03, 0x80, 0x20, 0x40, 
+0x80, 0x83, 0x00, 0x08, 0xc0, 0xe0, 0xe0, 0x60, 0x70, 0x30, 0xc0, 0xc0, 0x80, 0xd6, 0x00, 0x05, 
+0x30, 0x04, 0x71, 0x0c, 0x02, 0x01, 0x81, 0x00, 0x81, 0x80, 0x84, 0x00, 0x10, 0xc1, 0xe2, 0xf8, 
+0x81, 0x06, 0x36, 0x87, 0xef, 0xff, 0x33, 0x1f, 0x1f, 0x1e, 0x1e, 0x0f, 0x07, 0x03, 0xd7, 0x00, 
+0x1c, 0x18, 0x40, 0x1c, 0x20, 0x80, 0x00, 0x70, 0xc4, 0xa0, 0x98, 0x84, 0x9e, 0x0e, 0x01, 0x07, 
+0x8c, 0x20, 0x20, 0x00, 0x00, 0x14, 0x01, 0x81, 0x43, 0x1b, 0xc0, 0x38, 0x03, 0x01, 0x88, 0x00, 
+0x00, 0x40, 0x82, 0x00, 0x00, 0x80, 0x83, 0x00, 0x04, 0x10, 0x00, 0x00, 0x20, 0x80, 0xc5, 0x00, 
+0x04, 0x01, 0x02, 0x04, 0x09, 0x02, 0x85, 0x00, 0x09, 0x02, 0x00, 0x29, 0x00, 0x04, 0x12, 0x09, 
+0x04, 0x02, 0x01, 0x8e, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x06, 0x82, 0x00, 0x02, 0x08, 0x00, 
+0x04, 0xfa, 0x00, 0x00, 0x02, 0x90, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 
+0x07, 0x80, 0x40, 0x20, 0x80, 0x10, 0x40, 0x00, 0x28, 0x82, 0x00, 0x07, 0x20, 0x08, 0x00, 0x40, 
+0x90, 0x20, 0x40, 0x80, 0x84, 0x00, 0x08, 0xc0, 0x20, 0x00, 0x98, 0xc8, 0x28, 0xc0, 0x00, 0x40, 
+0xd5, 0x00, 0x05, 0xf0, 0x0c, 0xf3, 0x0c, 0x02, 0x01, 0x8c, 0x00, 0x06, 0x01, 0x02, 0x04, 0x79, 
+0x86, 0x38, 0xc0, 0x80, 0x00, 0x08, 0x0f, 0x1c, 0x18, 0x19, 0x19, 0x08, 0x04, 0x00, 0x01, 0xd5, 
+0x00, 0x1b, 0x1f, 0x60, 0x9f, 0x20, 0xc0, 0x00, 0x80, 0x90, 0x1c, 0xae, 0x0f, 0x07, 0x1f, 0x27, 
+0x3e, 0x38, 0x00, 0x80, 0xa0, 0x82, 0x54, 0x10, 0xb1, 0x70, 0x3c, 0xc7, 0x38, 0x07, 0x8a, 0x00, 
+0x00, 0x40, 0x82, 0x00, 0x00, 0x80, 0x83, 0x00, 0x04, 0x10, 0x00, 0x00, 0x20, 0x80, 0xc4, 0x00, 
+0x0a, 0x01, 0x02, 0x04, 0x08, 0x71, 0xf1, 0xe2, 0xe6, 0x47, 0x0f, 0x07, 0x81, 0x03, 0x07, 0x29, 
+0x01, 0x04, 0x12, 0x09, 0x04, 0x02, 0x01, 0x8f, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x06, 0x82, 
+0x00, 0x02, 0x08, 0x00, 0x04, 0xfa, 0x00, 0x00, 0x02, 0x90, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 
+0xff, 0x00, 0xbb, 0x00, 0x05, 0x20, 0x08, 0x00, 0x40, 0x10, 0x20, 0x88, 0x00, 0x08, 0xc0, 0x00, 
+0x08, 0x40, 0x80, 0x80, 0x40, 0x00, 0xc0, 0xd3, 0x00, 0x02, 0xe0, 0x08, 0xc2, 0x91, 0x00, 0x04, 
+0x04, 0x18, 0x82, 0x08, 0xc0, 0x82, 0x00, 0x01, 0x03, 0x04, 0x80, 0x00, 0x03, 0x04, 0x00, 0x00, 
+0x01, 0xd3, 0x00, 0x0e, 0x0f, 0x60, 0x87, 0x20, 0x40, 0x00, 0x00, 0x80, 0xe0, 0xe0, 0x70, 0xec, 
+0xc0, 0xe4, 0xd8, 0x80, 0xc0, 0x09, 0x40, 0x60, 0x65, 0x30, 0x34, 0x02, 0x00, 0x83, 0x20, 0x07, 
+0x8b, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x80, 0x83, 0x00, 0x04, 0x10, 0x00, 0x00, 0x20, 0x80, 
+0xc4, 0x00, 0x0a, 0x82, 0xc4, 0xe1, 0xe3, 0xa3, 0x25, 0x46, 0xce, 0x4f, 0x0f, 0x07, 0x83, 0x00, 
+0x00, 0x10, 0x94, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x06, 0x82, 0x00, 0x02, 0x08, 0x00, 0x04, 
+0xc5, 0x00, 0x07, 0x3f, 0x3f, 0x77, 0xe7, 0xe3, 0x7f, 0x3f, 0x0c, 0xaa, 0x00, 0x00, 0x02, 0x90, 
+0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xae, 0x00, 0x07, 0x80, 0x40, 0x00, 0x80, 0x10, 
+0x40, 0x00, 0x08, 0x82, 0x00, 0x07, 0x08, 0x00, 0x00, 0x10, 0x80, 0x00, 0x40, 0x80, 0x87, 0x00, 
+0x00, 0x20, 0xda, 0x00, 0x05, 0x10, 0x04, 0x21, 0x08, 0x02, 0x01, 0x8c, 0x00, 0x05, 0x01, 0x02, 
+0x08, 0x61, 0x04, 0x30, 0x85, 0x00, 0x00, 0x04, 0xd9, 0x00, 0x04, 0x10, 0x00, 0x18, 0x40, 0x80, 
+0x81, 0x00, 0x04, 0x10, 0x38, 0x24, 0x2c, 0x18, 0x81, 0x00, 0x08, 0x06, 0x07, 0x01, 0x07, 0x83, 
+0x40, 0x18, 0x40, 0x10, 0x8c, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x80, 0x83, 0x00, 0x04, 0x10, 
+0x00, 0x00, 0x20, 0x80, 0xc3, 0x00, 0x07, 0x01, 0x80, 0xc0, 0xe8, 0xe0, 0xc4, 0xc0, 0x88, 0x84, 
+0x00, 0x07, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x02, 0x01, 0x90, 0x00, 0x00, 0x02, 0x82, 0x00, 
+0x00, 0x06, 0x82, 0x00, 0x02, 0x08, 0x00, 0x04, 0xc4, 0x00, 0x08, 0x1c, 0x41, 0xc0, 0xa9, 0x39, 
+0x2d, 0x81, 0x47, 0x0c, 0xaa, 0x00, 0x00, 0x02, 0x90, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xae, 0x00, 0x07, 0x80, 0x40, 0x00, 0x80, 0x10, 0x40, 0x00, 0x08, 0x82, 0x00, 0x07, 0x28, 
+0x08, 0x00, 0x50, 0x90, 0x20, 0x40, 0x80, 0x8b, 0x00, 0x01, 0x80, 0x80, 0x87, 0x00, 0x00, 0x02, 
+0xca, 0x00, 0x05, 0xf0, 0x0c, 0xe3, 0x08, 0x02, 0x01, 0x8c, 0x00, 0x06, 0x01, 0x02, 0x0c, 0x79, 
+0x86, 0x38, 0xc0, 0x82, 0x00, 0x02, 0x01, 0x04, 0x04, 0x81, 0x00, 0x00, 0x02, 0xd4, 0x00, 0x04, 
+0x1f, 0x60, 0x9f, 0x60, 0xc0, 0x81, 0x00, 0x03, 0x60, 0x48, 0x48, 0x10, 0x82, 0x00, 0x09, 0x08, 
+0x09, 0x0a, 0x00, 0x80, 0x40, 0x38, 0xc3, 0x30, 0x07, 0xe3, 0x00, 0x08, 0x01, 0x02, 0x04, 0x09, 
+0x02, 0x14, 0x04, 0x28, 0x08, 0x83, 0x00, 0x07, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x02, 0x01, 
+0xe6, 0x00, 0x07, 0x20, 0x82, 0x03, 0x62, 0x40, 0x52, 0x06, 0x88, 0xbf, 0x00, 0x01, 0xff, 0x00, 
+0xff, 0x00, 0xff, 0x00, 0xca, 0x00, 0x06, 0x80, 0xc0, 0xe0, 0x20, 0x80, 0xc8, 0xe0, 0x81, 0xc0, 
+0xf1, 0x00, 0x0b, 0x02, 0x0f, 0x0f, 0x0e, 0x08, 0x09, 0x0b, 0x00, 0x04, 0x02, 0x03, 0x01, 0xdc, 
+0x00, 0x03, 0x10, 0x80, 0x80, 0x60, 0x82, 0x00, 0x02, 0x02, 0x12, 0x10, 0x92, 0x00, 0x00, 0x40, 
+0x82, 0x00, 0x00, 0x80, 0x83, 0x00, 0x04, 0x10, 0x00, 0x00, 0x20, 0x80, 0xc4, 0x00, 0x82, 0x80, 
+0xa1, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x06, 0x82, 0x00, 0x02, 0x08, 0x00, 0x04, 0xc4, 0x00, 
+0x07, 0x32, 0x83, 0x83, 0x43, 0x51, 0x6b, 0x06, 0xf8, 0xab, 0x00, 0x00, 0x02, 0x90, 0x00, 0x01, 
+0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xcb, 0x00, 0x07, 0x40, 0x20, 0x00, 0x90, 0xf0, 0x78, 0xc0, 
+0xc0, 0x87, 0x00, 0x00, 0x02, 0xe6, 0x00, 0x0b, 0x78, 0x7e, 0x7d, 0x30, 0x36, 0x17, 0x01, 0x09, 
+0x0d, 0x07, 0x03, 0x01, 0xde, 0x00, 0x03, 0x60, 0x10, 0x10, 0x80, 0x82, 0x00, 0x03, 0x0c, 0x00, 
+0x00, 0x18, 0x91, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x80, 0x83, 0x00, 0x04, 0x10, 0x00, 0x00, 
+0x20, 0x80, 0xc4, 0x00, 0x05, 0xb0, 0x7c, 0x78, 0xf0, 0x72, 0xe0, 0xa0, 0x00, 0x00, 0x02, 0x82, 
+0x00, 0x00, 0x06, 0x82, 0x00, 0x02, 0x08, 0x00, 0x04, 0xc4, 0x00, 0x07, 0x0e, 0x7f, 0x78, 0xf1, 
+0xc1, 0xf8, 0xfd, 0x08, 0xab, 0x00, 0x00, 0x02, 0x90, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xca, 0x00, 0x05, 0x80, 0x80, 0xc0, 0xe0, 0xe0, 0xc0, 0xf3, 0x00, 0x09, 0x30, 0x78, 0x7e, 
+0x7f, 0x3f, 0x39, 0x18, 0x0e, 0x07, 0x01, 0xe2, 0x00, 0x03, 0xe0, 0x00, 0x10, 0xe0, 0x82, 0x00, 
+0x03, 0x1c, 0x00, 0x04, 0x08, 0x90, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x80, 0x83, 0x00, 0x04, 
+0x10, 0x00, 0x00, 0x20, 0x80, 0xc4, 0x00, 0x05, 0x30, 0xfc, 0xf8, 0x70, 0xf2, 0xe0, 0xa0, 0x00, 
+0x00, 0x02, 0x82, 0x00, 0x00, 0x06, 0x81, 0x00, 0x03, 0x80, 0x08, 0x00, 0x04, 0xc6, 0x00, 0x04, 
+0x07, 0x0e, 0x0e, 0x0f, 0x03, 0xac, 0x00, 0x00, 0x02, 0x90, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 
+0xff, 0x00, 0xff, 0x00, 0xc4, 0x00, 0x00, 0x30, 0xec, 0x00, 0x02, 0x80, 0x00, 0x90, 0x83, 0x00, 
+0x02, 0x10, 0x10, 0x04, 0x90, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x80, 0x83, 0x00, 0x04, 0x10, 
+0x00, 0x00, 0x20, 0x80, 0xed, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x06, 0x81, 0x00, 0x03, 0x80, 
+0x08, 0x00, 0x04, 0xfa, 0x00, 0x00, 0x02, 0x90, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
+0xff, 0x00, 0xff, 0x00, 0xb2, 0x00, 0x02, 0x10, 0x80, 0x10, 0x82, 0x00, 0x03, 0x0c, 0x02, 0x00, 
+0x0c, 0x90, 0x00, 0x01, 0x80, 0xe0, 0x80, 0x30, 0x0c, 0x00, 0xe0, 0xe0, 0x30, 0x10, 0x10, 0x30, 
+0x00, 0x60, 0xe0, 0x80, 0xe0, 0x70, 0xeb, 0x00, 0x01, 0x03, 0x07, 0x80, 0x04, 0x02, 0x06, 0x03, 
+0x07, 0x82, 0x00, 0x06, 0x80, 0xf9, 0x3f, 0x03, 0x00, 0x02, 0x02, 0xf6, 0x00, 0x01, 0x07, 0x01, 
+0x90, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb1, 0x00, 0x03, 
+0x70, 0x00, 0x00, 0x60, 0x82, 0x00, 0x00, 0x02, 0xff, 0x00, 0xff, 0x00, 0xb1, 0x00, 0x01, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb1, 0x00, 0x02, 0x10, 0x80, 0x80, 0x83, 
+0x00, 0x01, 0x02, 0x12, 0xff, 0x00, 0xff, 0x00, 0xb0, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xef, 0x00
+};
+
+const uint32_t PROGMEM frameOffsets[] = {
+0, 139, 264, 356, 465, 614, 716, 857, 959, 1065, 1189, 1346, 
+1520, 1663, 1807, 1936, 2085, 2234, 2381, 2516, 2654, 2823, 2994, 3143, 
+3282, 3440, 3587, 3740, 3909, 4082, 4261, 4402, 4609, 4798, 4993, 5187, 
+5318, 5546, 5741, 5953, 6166, 6309, 6517, 6718, 6922, 7139, 7311, 7604, 
+7840, 8137, 8359, 8589, 8850, 9062, 9366, 9582, 9789, 10046, 10258, 10544, 
+10685, 10876, 11135, 11345, 11595, 11814, 12023, 12309, 12540, 12823, 13071, 13232, 
+13447, 13718, 13950, 14161, 14374, 14598, 14767, 14902, 15143, 15406, 15701, 15995, 
+16257, 16449, 16652, 16831, 16987, 17181, 17432, 17657, 17900, 18114, 18333, 18608, 
+18783, 19100, 19409, 19770, 20091, 20278, 20585, 20895, 21212, 21393, 21548, 21730, 
+21874, 22049, 22190, 22392, 22540, 22668, 22788, 22849, 23018, 23145, 23251, 23316, 
+23436, 23599, 23751, 23874, 24048, 24262, 24476, 24606, 24763, 24912, 25043, 25282, 
+25468, 25657, 25845, 26008, 26173, 26293, 26387, 26538, 26685, 26837, 26977, 27118, 
+27264, 27422, 27639, 27840, 28000, 28155, 28318, 28468, 28650, 28789, 28925, 29072, 
+29206, 29304, 29476, 29633, 29794, 29963, 30116, 30271, 30408, 30527, 30693, 30826, 
+30946, 31069, 31203, 31387, 31530, 31647, 31759, 31898, 32129, 32354, 32574, 32787, 
+33005, 33141, 33349, 33588, 33891, 34174, 34427, 34715, 34960, 35252, 35505, 35792, 
+36032, 36272, 36561, 36793, 36993, 37266, 37507, 37788, 38019, 38221, 38502, 38754, 
+39027, 39260, 39490, 39684, 39897, 40102, 40264, 40423, 40561, 40697, 40934, 41162, 
+41316, 41549, 41830, 42110, 42382, 42535, 42795, 42962, 43098, 43242, 43446, 43606, 
+43788, 43966, 44127, 44336, 44506, 44675, 44862, 45068, 45360, 45596, 45841, 46135, 
+46336, 46514, 46653, 46769, 46918, 47070, 47250, 47430, 47613, 47812, 47981, 48163, 
+48317, 48472, 48647, 48763, 48918, 49110, 49254, 49403, 49548, 49750, 49906, 50060, 
+50202, 50409, 50571, 50712, 50856, 51080, 51274, 51451, 51623, 51787, 51941, 52109, 
+52237, 52387, 52533, 52686, 52837, 52952, 53111, 53275, 53425, 53578, 53709, 53807, 
+53914, 54011, 54073, 54146, 54174, 54202
+};
+
+// Durasi tiap frame dalam ms (bisa diubah sesuai kebutuhan)
+const uint16_t PROGMEM frameDurations[] = {
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 
+70, 70, 70, 70, 70, 70
+};
+
+const FramePack clip = { 128, 64, 294, frameOffsets, frameData, frameDurations, FRAME_LAYOUT_PAGES };
+
+} // namespace best_friend
+
+#endif
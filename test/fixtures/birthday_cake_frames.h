@@ -0,0 +1,1006 @@
+#ifndef BIRTHDAY_CAKE_FRAMES_H
+#define BIRTHDAY_CAKE_FRAMES_H
+
+#include <stdint.h>
+
+// The 15 hand-made birthday cake frames from animations/birthday_cake.cpp as
+// they were before packing: 128x64, image2cpp row order (drawBitmap), 80ms
+// each. Reference output for the decoder, gif2pack and blitter tests.
+
+static const uint16_t CAKE_FRAME_COUNT = 15;
+static const uint16_t CAKE_FRAME_MS = 80;
+
+static const uint8_t cakeFrames[CAKE_FRAME_COUNT][1024] = {
+{ // frame 0
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf0, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf3, 0xe7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf3, 0x87, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf0, 0x1f, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf0, 0x7f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xc4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x8e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1c, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x18, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x01, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc3, 0x0f, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xe2, 0x1f, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf8, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf8, 0x7f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xf8, 0xfd, 0xfc, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0xff, 0xf8, 0x3f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xf0, 0x7f, 0xf8, 0x3f, 0x06, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x7f, 0xf8, 0x3f, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x3f, 0xff, 0xfe, 0x3f, 0xf8, 0xff, 0xfc, 0x7f, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0x1f, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0x0f, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0xc7, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0x63, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfe, 0x07, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x0f, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0xe0, 0x07, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x9f, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x07, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xfc, 0x03, 0xff, 0x01, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x31, 0x88, 0x07, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x87, 0xf8, 0x8f, 0xe1, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf8, 0x0f, 0xf9, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xfc, 0x1f, 0xfc, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xf0, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0xff, 0xe0, 0x7f, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfc, 0xff, 0xe6, 0x7f, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x03, 0xfc, 0x3f, 0xe0, 0xff, 0xe4, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xef, 0xff, 0x01, 0xf0, 0x03, 0xc1, 0xff, 0xe0, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc1, 0xff, 0x38, 0xc1, 0x80, 0x09, 0xff, 0xe0, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xe0, 0x7f, 0x3c, 0x07, 0xf0, 0x19, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xf8, 0x08, 0x3c, 0x0f, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xc1, 0x1f, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xc7, 0x8f, 0xff, 0xff, 0xc3, 0xe3, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x87, 0xc0, 0xff, 0xff, 0x03, 0xe3, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0x80, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x87, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0x80, 0x00, 0x1e, 0x00, 0x00, 0xfc, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x7e, 0x07, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+},
+{ // frame 1
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xc4, 0x7f, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x8e, 0x1f, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0c, 0x1f, 0xfc, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1c, 0x00, 0x1e, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0x80, 0x0e, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x83, 0x0f, 0xc6, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xe3, 0x1f, 0xe3, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf0, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf8, 0x7f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xf8, 0xe3, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xfc, 0xff, 0xfc, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0x7f, 0xf8, 0x3e, 0x0f, 0xff, 0xff, 0xff, 0xfc, 0x2f, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xf0, 0x7f, 0xf8, 0x3f, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x7f, 0xf8, 0x3f, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfe, 0x7e, 0x3f, 0xf8, 0xff, 0xfc, 0x3f, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfc, 0x1e, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf8, 0x41, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xc3, 0xff, 0xf8, 0x00, 0x00, 0x07, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x07, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0x38, 0x07, 0xff, 0xe0, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x61, 0x8f, 0x03, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xf8, 0x9f, 0xf1, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xf8, 0x1f, 0xf8, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xfe, 0x3f, 0xf8, 0x1f, 0xfc, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xfe, 0x03, 0xfc, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xe7, 0xff, 0x01, 0xf0, 0x1f, 0xc0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc3, 0xff, 0x38, 0xc1, 0x80, 0x09, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xe0, 0x3f, 0x3c, 0x07, 0xc0, 0x19, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xfc, 0x08, 0x3e, 0x0f, 0xfe, 0x78, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xc3, 0x1f, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xc7, 0x8f, 0xff, 0xff, 0xe3, 0xe3, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x87, 0xc1, 0xff, 0xff, 0x07, 0xe3, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0x80, 0x00, 0xe0, 0x00, 0x00, 0x0f, 0x07, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0x80, 0x10, 0x1f, 0x00, 0x00, 0x38, 0x0f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff,
+},
+{ // frame 2
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfc, 0x7f, 0xff, 0xf2, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf8, 0x1f, 0xff, 0xf0, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf9, 0x8f, 0xff, 0xe0, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf9, 0x8f, 0xff, 0xe0, 0xc4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf0, 0x9f, 0xff, 0xe1, 0x8e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfc, 0x3f, 0xff, 0xc3, 0x1e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0x7f, 0xff, 0xc0, 0x1c, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xc1, 0x0f, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xe2, 0x1f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf8, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf8, 0x7f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xfc, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xf8, 0xfe, 0xfc, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0x7f, 0xf8, 0x3f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xf0, 0x7f, 0xf8, 0x3f, 0x86, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x7f, 0xf8, 0x3f, 0xe2, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf8, 0xff, 0xfc, 0x7f, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xcf, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x07, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x23, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+0xff, 0xb3, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x8f, 0xff, 0xfc, 0x3f, 0xff, 0xff,
+0xff, 0x93, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x80, 0x07, 0xf0, 0x1f, 0xff, 0xe0, 0x9f, 0xff, 0xff,
+0xff, 0x81, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x07, 0xf8, 0x1f, 0xff, 0xe7, 0x9f, 0xff, 0xff,
+0xff, 0xc3, 0xff, 0xf3, 0xff, 0xfd, 0xc0, 0x2f, 0xff, 0x00, 0x83, 0xff, 0xe2, 0x1f, 0xff, 0xff,
+0xff, 0xc7, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x80, 0x1f, 0xf0, 0x3f, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0x9e, 0x03, 0xfb, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x07, 0xf9, 0x9f, 0xe1, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xf8, 0x1f, 0xf8, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xf8, 0x1f, 0xfc, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xfe, 0x07, 0xf0, 0x7f, 0xf0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xe7, 0xff, 0x03, 0xe0, 0x1f, 0xe1, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xc1, 0xff, 0x30, 0x03, 0x81, 0x81, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xe0, 0x3e, 0x3c, 0x0f, 0xc0, 0x09, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xfc, 0x0c, 0x3f, 0x3f, 0xfc, 0x38, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xc3, 0x9f, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xe7, 0x8f, 0xff, 0xff, 0xe3, 0xe3, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xc7, 0xc1, 0xff, 0xff, 0x03, 0xe3, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0x80, 0x01, 0xe0, 0x00, 0x00, 0x0f, 0x03, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0x80, 0x00, 0x3e, 0x00, 0x00, 0xfc, 0x0f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff,
+},
+{ // frame 3
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x00, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x00, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x00, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x03, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xc4, 0x7f, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x8e, 0x3f, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1c, 0x1f, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x18, 0x00, 0x1f, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x01, 0x80, 0x0f, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc3, 0x0f, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xe2, 0x1f, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf8, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf8, 0x7f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xf8, 0xfd, 0xfc, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0xff, 0xf8, 0x3f, 0x0e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xf0, 0x7f, 0xf8, 0x3f, 0x04, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x7f, 0xf8, 0x3f, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf8, 0xff, 0xfc, 0x7f, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0xe0, 0x07, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x06, 0x00, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xfc, 0x03, 0xf0, 0x00, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf8, 0xcf, 0x83, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x87, 0xfc, 0x0f, 0xf1, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xfc, 0x1f, 0xfc, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x01, 0xfc, 0x1f, 0xe0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xf0, 0x03, 0xc0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc3, 0xff, 0x3c, 0xe3, 0xc0, 0x08, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x3f, 0x3c, 0x07, 0xfe, 0x18, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xe0, 0x00, 0x1e, 0x1f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xe1, 0x9f, 0xff, 0xff, 0xf1, 0x83, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xe7, 0xc7, 0xff, 0xff, 0xc1, 0xf3, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x83, 0xc0, 0x7f, 0xfb, 0x83, 0xe1, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xf8, 0x00, 0x78, 0x00, 0x00, 0x1f, 0x87, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0x80, 0x00, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xc0, 0xfe, 0x03, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+},
+{ // frame 4
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf0, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf3, 0xe7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf3, 0x87, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf0, 0x1f, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf0, 0x7f, 0xff, 0xff, 0xf8, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xc4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x8e, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0c, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1c, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x83, 0x0f, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xe3, 0x1f, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf0, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf8, 0x7f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xfc, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xfc, 0xff, 0xfc, 0x7e, 0x3e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0x7f, 0xf8, 0x3e, 0x0c, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xf0, 0x7f, 0xf8, 0x3f, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x7f, 0xf8, 0x3f, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x3f, 0xff, 0xfe, 0x3f, 0xf8, 0xff, 0xfc, 0x3f, 0xf0, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0x1f, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0x0f, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0xc7, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0x63, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfe, 0x07, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x0f, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x07, 0x00, 0x60, 0x0f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x9f, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x60, 0x03, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0x38, 0x07, 0xc0, 0xfe, 0x67, 0xe0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x87, 0xfe, 0x07, 0xfc, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xfe, 0x07, 0xfe, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfe, 0x6f, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x80, 0xfe, 0x0f, 0xf8, 0x3f, 0xe0, 0x7f, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x78, 0x01, 0xe2, 0x7f, 0xe6, 0x7f, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xc7, 0xff, 0x8e, 0x21, 0xe0, 0x06, 0x7f, 0xe4, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x0f, 0x8f, 0x03, 0xf0, 0x0e, 0x7f, 0xe0, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xe0, 0x00, 0x0f, 0xbf, 0xff, 0xfe, 0x1f, 0xe0, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xf8, 0xe1, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf3, 0xe3, 0xff, 0xff, 0xf0, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xc0, 0xf0, 0x0f, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xfc, 0x00, 0x3c, 0x00, 0x00, 0x07, 0x83, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xc0, 0x1c, 0x07, 0xe0, 0x00, 0xfc, 0x0f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xc0, 0xff, 0x80, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x01, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+},
+{ // frame 5
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xc4, 0x7f, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x8e, 0x3f, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x1e, 0x0f, 0xfc, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1c, 0x80, 0x1e, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x80, 0x06, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xc1, 0x0f, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xe2, 0x1f, 0xf1, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf8, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf8, 0x7f, 0xfc, 0x7f, 0x8f, 0xff, 0xff, 0xf8, 0x07, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xfc, 0xff, 0xfc, 0x7f, 0x8f, 0xff, 0xff, 0xf8, 0xe3, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xf8, 0xfe, 0xfc, 0x7e, 0x3e, 0x07, 0xff, 0xff, 0xfc, 0x03, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0x7f, 0xf8, 0x3e, 0x0c, 0x07, 0xff, 0xff, 0xfc, 0x2f, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xf0, 0x7f, 0xf8, 0x3f, 0x80, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x7f, 0xf8, 0x3f, 0xe0, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfe, 0x7e, 0x3f, 0xf8, 0xff, 0xfc, 0x7f, 0xf0, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfc, 0x1c, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf8, 0x41, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x20, 0x01, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xc3, 0xff, 0xf8, 0x00, 0x80, 0x00, 0x00, 0x67, 0x80, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x01, 0xfe, 0x67, 0xf8, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xfd, 0xc0, 0x2f, 0x87, 0xfe, 0x07, 0xfe, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfe, 0x07, 0xff, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0x81, 0xfc, 0x1f, 0xfc, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0xf8, 0x07, 0xf8, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xcc, 0x00, 0xe0, 0x60, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xcf, 0x03, 0xf0, 0x02, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x07, 0x0f, 0xcf, 0xff, 0x0e, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xe0, 0x20, 0xe7, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xf1, 0xe3, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xf1, 0xf0, 0x7f, 0xff, 0xc0, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xe0, 0x78, 0x00, 0x00, 0x03, 0xc0, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x80, 0x0f, 0x80, 0x00, 0x3f, 0x03, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xe0, 0x0f, 0x01, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xc0, 0x3f, 0xc0, 0x1f, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xe3, 0xff, 0xf8, 0x03, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x40, 0x3f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+},
+{ // frame 6
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfc, 0x7f, 0xff, 0xf2, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf8, 0x1f, 0xff, 0xf0, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf9, 0x8f, 0xff, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf9, 0x8f, 0xff, 0xe0, 0xc4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf0, 0x9f, 0xff, 0xe1, 0x8e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfc, 0x3f, 0xff, 0xc0, 0x1c, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0x7f, 0xff, 0xc0, 0x18, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x01, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc3, 0x0f, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xe2, 0x1f, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf8, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf8, 0x7f, 0xfc, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xfc, 0x7f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xf8, 0xfd, 0xfc, 0x7e, 0x3e, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0xff, 0xf8, 0x3f, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xf0, 0x7f, 0xf8, 0x3f, 0x00, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x7f, 0xf8, 0x3f, 0xe0, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf8, 0xff, 0xfc, 0x7f, 0xf8, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xcf, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x07, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x23, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x60, 0x3f, 0xfe, 0x3f, 0xff, 0xff,
+0xff, 0xb3, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x60, 0x07, 0xfc, 0x3f, 0xff, 0xff,
+0xff, 0x93, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0xe0, 0x00, 0x0c, 0x62, 0x01, 0xe0, 0x9f, 0xff, 0xff,
+0xff, 0x81, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x01, 0xfe, 0x23, 0xf8, 0x67, 0x9f, 0xff, 0xff,
+0xff, 0xc3, 0xff, 0xf3, 0xff, 0xff, 0xfc, 0x03, 0x8f, 0xfe, 0x03, 0xfe, 0x62, 0x1f, 0xff, 0xff,
+0xff, 0xc7, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0x07, 0xff, 0x30, 0x3f, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0xff, 0x0f, 0xf8, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xc0, 0x7c, 0x00, 0xf0, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xce, 0x30, 0x60, 0x02, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xcf, 0x01, 0xfc, 0x06, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xc0, 0x06, 0x0f, 0x03, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xfb, 0xf0, 0x47, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xe3, 0xff, 0xff, 0xf0, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xf0, 0x3f, 0xff, 0xc0, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xe0, 0x3c, 0x00, 0x00, 0x03, 0xe1, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x00, 0x07, 0x80, 0x00, 0x3f, 0x07, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xf0, 0x0f, 0x81, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xe0, 0x3f, 0xe0, 0x1f, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xf3, 0xff, 0xfe, 0x03, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x20, 0x7f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+},
+{ // frame 7
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x00, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x00, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x00, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x03, 0xff, 0xff, 0xf8, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xc4, 0x7f, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x8e, 0x1f, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0c, 0x1f, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1c, 0x00, 0x1f, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0x80, 0x0f, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x83, 0x0f, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xe3, 0x1f, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf0, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf8, 0x7f, 0xfc, 0x7f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xfc, 0x7e, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xfc, 0xff, 0xfc, 0x7e, 0x3e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0x7f, 0xf8, 0x3e, 0x0c, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xf0, 0x7f, 0xf8, 0x3f, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x7f, 0xf8, 0x3f, 0xe0, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf8, 0xff, 0xfc, 0x3f, 0xf0, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x20, 0x7f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x60, 0x03, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x18, 0x63, 0xc1, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x03, 0xfe, 0x27, 0xfc, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0x38, 0x07, 0x87, 0xfe, 0x07, 0xfe, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xfe, 0x07, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0x80, 0xff, 0x0f, 0xfc, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0x7c, 0x07, 0xf0, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xce, 0x30, 0x60, 0x02, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xcf, 0x01, 0xf0, 0x06, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xc0, 0x06, 0x0f, 0x83, 0xff, 0x9e, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xf8, 0xe0, 0xc7, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xf1, 0xe3, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xf0, 0x7f, 0xff, 0xc1, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xe0, 0x38, 0x00, 0x00, 0x03, 0xc1, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x04, 0x07, 0xc0, 0x00, 0x0e, 0x03, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xe0, 0x0f, 0x80, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xc0, 0x3f, 0xe0, 0x3f, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x30, 0x3f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+},
+{ // frame 8
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf0, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf3, 0xe7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf3, 0x87, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf0, 0x1f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf0, 0x7f, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xc4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x8e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x1e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1c, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xc1, 0x0f, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xe2, 0x1f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf8, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf8, 0x7f, 0xfc, 0x7f, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xfc, 0xff, 0xfc, 0x7f, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xf8, 0xfe, 0xfc, 0x7e, 0x3e, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0x7f, 0xf8, 0x3e, 0x0c, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xf0, 0x7f, 0xf8, 0x3f, 0x80, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x7f, 0xf8, 0x3f, 0xe0, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x3f, 0xff, 0xfe, 0x3f, 0xf8, 0xff, 0xfc, 0x7f, 0xf0, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0x1f, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0x0f, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0xc7, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0x63, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfe, 0x07, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x20, 0x03, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x0f, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x80, 0x00, 0x00, 0x67, 0x80, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x9f, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x01, 0xfe, 0x67, 0xf8, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xfd, 0xc0, 0x2f, 0x87, 0xfe, 0x07, 0xfe, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfe, 0x07, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0x81, 0xfc, 0x1f, 0xfc, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0xf8, 0x07, 0xf8, 0x7f, 0xf0, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xcc, 0x00, 0xe0, 0x60, 0x7f, 0xe0, 0x7f, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xcf, 0x03, 0xf0, 0x02, 0x7f, 0xe6, 0x7f, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x07, 0x0f, 0xcf, 0xff, 0x0e, 0x1f, 0xe4, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x07, 0xe0, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xe0, 0x20, 0xe7, 0xff, 0xff, 0xfc, 0x01, 0xe0, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xf1, 0xe3, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xf1, 0xf0, 0x7f, 0xff, 0xc0, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xe0, 0x78, 0x00, 0x00, 0x03, 0xc0, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x80, 0x0f, 0x80, 0x00, 0x3f, 0x03, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xe0, 0x0f, 0x01, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xc0, 0x3f, 0xc0, 0x1f, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xe3, 0xff, 0xf8, 0x03, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+},
+{ // frame 9
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xc4, 0x7f, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x8e, 0x3f, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1c, 0x1f, 0xfc, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x18, 0x00, 0x1e, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x01, 0x80, 0x0e, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc3, 0x0f, 0xc2, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xe2, 0x1f, 0xe1, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf8, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf8, 0x7f, 0xfc, 0xff, 0x8f, 0xff, 0xff, 0xf8, 0x07, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xfc, 0x7f, 0x0f, 0xff, 0xff, 0xf8, 0xe3, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xf8, 0xfd, 0xfc, 0x7e, 0x3e, 0x07, 0xff, 0xff, 0xfc, 0x03, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0xff, 0xf8, 0x3f, 0x04, 0x07, 0xff, 0xff, 0xfc, 0x2f, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xf0, 0x7f, 0xf8, 0x3f, 0x00, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x7f, 0xf8, 0x3f, 0xe0, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfe, 0x7e, 0x3f, 0xf8, 0xff, 0xfc, 0x7f, 0xf8, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfc, 0x1c, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf8, 0x41, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x60, 0x3f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x60, 0x01, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xc3, 0xff, 0xf8, 0x00, 0xe0, 0x00, 0x0c, 0x62, 0x00, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x01, 0xfe, 0x23, 0xf8, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xfc, 0x03, 0x8f, 0xfe, 0x03, 0xfe, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0x07, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0xff, 0x0f, 0xf8, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xc0, 0x7c, 0x00, 0xf0, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xce, 0x30, 0x60, 0x02, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xcf, 0x01, 0xfc, 0x06, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xc0, 0x06, 0x0f, 0x03, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xfb, 0xf0, 0x47, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xe3, 0xff, 0xff, 0xf0, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xf0, 0x3f, 0xff, 0xc0, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xe0, 0x3c, 0x00, 0x00, 0x03, 0xe1, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x00, 0x07, 0x80, 0x00, 0x3f, 0x07, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xf0, 0x0f, 0x81, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xe0, 0x3f, 0xe0, 0x1f, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xf3, 0xff, 0xfe, 0x03, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x20, 0x7f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+},
+{ // frame 10
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfc, 0x7f, 0xff, 0xf0, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf8, 0x1f, 0xff, 0xf0, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf9, 0x8f, 0xff, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf9, 0x8f, 0xff, 0xe1, 0xc4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf0, 0x9f, 0xff, 0xe1, 0x8e, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfc, 0x3f, 0xff, 0xc1, 0x0c, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0x7f, 0xff, 0xc0, 0x1c, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x83, 0x0f, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xe3, 0x1f, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf0, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf8, 0x7f, 0xfc, 0x7f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xfc, 0x7e, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xfc, 0xff, 0xfc, 0x7e, 0x3e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0x7f, 0xf8, 0x3e, 0x0c, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xf0, 0x7f, 0xf8, 0x3f, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x7f, 0xf8, 0x3f, 0xe0, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf8, 0xff, 0xfc, 0x3f, 0xf0, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xcf, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x07, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x23, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x20, 0x7f, 0xfe, 0x3f, 0xff, 0xff,
+0xff, 0xb3, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x60, 0x03, 0xfc, 0x3f, 0xff, 0xff,
+0xff, 0x93, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x18, 0x63, 0xc1, 0xe0, 0x9f, 0xff, 0xff,
+0xff, 0x81, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x03, 0xfe, 0x27, 0xfc, 0x67, 0x9f, 0xff, 0xff,
+0xff, 0xc3, 0xff, 0xf3, 0xff, 0xff, 0x38, 0x07, 0x87, 0xfe, 0x07, 0xfe, 0x22, 0x1f, 0xff, 0xff,
+0xff, 0xc7, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xfe, 0x07, 0xff, 0x30, 0x3f, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0x80, 0xff, 0x0f, 0xfc, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0x7c, 0x07, 0xf0, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xce, 0x30, 0x60, 0x02, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xcf, 0x01, 0xf0, 0x06, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xc0, 0x06, 0x0f, 0x83, 0xff, 0x9e, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xf8, 0xe0, 0xc7, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xf1, 0xe3, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xf0, 0x7f, 0xff, 0xc1, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xe0, 0x38, 0x00, 0x00, 0x03, 0xc1, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x04, 0x07, 0xc0, 0x00, 0x0e, 0x03, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xe0, 0x0f, 0x80, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xc0, 0x3f, 0xe0, 0x3f, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x30, 0x3f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+},
+{ // frame 11
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x00, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x00, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x00, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x03, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x60, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xc4, 0x7f, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x8e, 0x3f, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x1e, 0x0f, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1c, 0x80, 0x1f, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x80, 0x07, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xc1, 0x0f, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xe2, 0x1f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf8, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf8, 0x7f, 0xfc, 0x7f, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xfc, 0xff, 0xfc, 0x7f, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xf8, 0xfe, 0xfc, 0x7e, 0x3e, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0x7f, 0xf8, 0x3e, 0x0c, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xf0, 0x7f, 0xf8, 0x3f, 0x80, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x7f, 0xf8, 0x3f, 0xe0, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf8, 0xff, 0xfc, 0x7f, 0xf0, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x20, 0x07, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x80, 0x00, 0x00, 0x67, 0x80, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x01, 0xfe, 0x67, 0xf8, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xfd, 0xc0, 0x2f, 0x87, 0xfe, 0x07, 0xfe, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfe, 0x07, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0x81, 0xfc, 0x1f, 0xfc, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0xf8, 0x07, 0xf8, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xcc, 0x00, 0xe0, 0x60, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xcf, 0x03, 0xf0, 0x02, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x07, 0x0f, 0xcf, 0xff, 0x0e, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xe0, 0x20, 0xe7, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xf1, 0xe3, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xf1, 0xf0, 0x7f, 0xff, 0xc0, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xe0, 0x78, 0x00, 0x00, 0x03, 0xc0, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x80, 0x0f, 0x80, 0x00, 0x3f, 0x03, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xe0, 0x0f, 0x01, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xc0, 0x3f, 0xc0, 0x1f, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xe3, 0xff, 0xf8, 0x03, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x40, 0x3f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+},
+{ // frame 12
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf0, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf3, 0xe7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf3, 0x87, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf0, 0x1f, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xf0, 0x7f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xc4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x8e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1c, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x18, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x01, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc3, 0x0f, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xe2, 0x1f, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf8, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf8, 0x7f, 0xfc, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xfc, 0x7f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xf8, 0xfd, 0xfc, 0x7e, 0x3e, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0xff, 0xf8, 0x3f, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xf0, 0x7f, 0xf8, 0x3f, 0x00, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x7f, 0xf8, 0x3f, 0xe0, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x3f, 0xff, 0xfe, 0x3f, 0xf8, 0xff, 0xfc, 0x7f, 0xf8, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0x1f, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0x0f, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0xc7, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xfc, 0x63, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x60, 0x3f, 0xff, 0xff, 0xff, 0xff,
+0xfe, 0x07, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x60, 0x07, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x0f, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0xe0, 0x00, 0x0c, 0x62, 0x01, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x9f, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x01, 0xfe, 0x23, 0xf8, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xfc, 0x03, 0x8f, 0xfe, 0x03, 0xfe, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0x07, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0xff, 0x0f, 0xf8, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xc0, 0x7c, 0x00, 0xf0, 0x7f, 0xf0, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xce, 0x30, 0x60, 0x02, 0x7f, 0xe0, 0x7f, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xcf, 0x01, 0xfc, 0x06, 0x7f, 0xe6, 0x7f, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xc0, 0x06, 0x0f, 0x03, 0xff, 0xfe, 0x3f, 0xe4, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x07, 0xe0, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xfb, 0xf0, 0x47, 0xff, 0xff, 0xfc, 0x01, 0xe0, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xe3, 0xff, 0xff, 0xf0, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xf0, 0x3f, 0xff, 0xc0, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xe0, 0x3c, 0x00, 0x00, 0x03, 0xe1, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x00, 0x07, 0x80, 0x00, 0x3f, 0x07, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xf0, 0x0f, 0x81, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xe0, 0x3f, 0xe0, 0x1f, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xf3, 0xff, 0xfe, 0x03, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x20, 0x7f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+},
+{ // frame 13
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xc4, 0x7f, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x8e, 0x1f, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0c, 0x1f, 0xfc, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1c, 0x00, 0x1e, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0x80, 0x0e, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x83, 0x0f, 0xc6, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xe3, 0x1f, 0xe3, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf0, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf8, 0x7f, 0xfc, 0x7f, 0x3f, 0xff, 0xff, 0xf8, 0x07, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xfc, 0x7e, 0x1f, 0xff, 0xff, 0xf8, 0xe3, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xfc, 0xff, 0xfc, 0x7e, 0x3e, 0x0f, 0xff, 0xff, 0xfc, 0x03, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0x7f, 0xf8, 0x3e, 0x0c, 0x07, 0xff, 0xff, 0xfc, 0x2f, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xf0, 0x7f, 0xf8, 0x3f, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x7f, 0xf8, 0x3f, 0xe0, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfe, 0x7e, 0x3f, 0xf8, 0xff, 0xfc, 0x3f, 0xf0, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfc, 0x1e, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf8, 0x41, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfe, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x20, 0x7f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x60, 0x01, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xc3, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x18, 0x63, 0xc0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x03, 0xfe, 0x27, 0xfc, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0x38, 0x07, 0x87, 0xfe, 0x07, 0xfe, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xfe, 0x07, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0x80, 0xff, 0x0f, 0xfc, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0x7c, 0x07, 0xf0, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xce, 0x30, 0x60, 0x02, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xcf, 0x01, 0xf0, 0x06, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xc0, 0x06, 0x0f, 0x83, 0xff, 0x9e, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xf8, 0xe0, 0xc7, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xf1, 0xe3, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xf0, 0x7f, 0xff, 0xc1, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xe0, 0x38, 0x00, 0x00, 0x03, 0xc1, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x04, 0x07, 0xc0, 0x00, 0x0e, 0x03, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xe0, 0x0f, 0x80, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xc0, 0x3f, 0xe0, 0x3f, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x30, 0x3f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+},
+{ // frame 14
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfc, 0x7f, 0xff, 0xf2, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf8, 0x1f, 0xff, 0xf0, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf9, 0x8f, 0xff, 0xe0, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf9, 0x8f, 0xff, 0xe0, 0xc4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xf0, 0x9f, 0xff, 0xe1, 0x8e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xfc, 0x3f, 0xff, 0xc3, 0x1e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0x7f, 0xff, 0xc0, 0x1c, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xc1, 0x0f, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xe2, 0x1f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf8, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf8, 0x7f, 0xfc, 0x7f, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xfc, 0xff, 0xfc, 0x7f, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0xf8, 0xfe, 0xfc, 0x7e, 0x3e, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xc3, 0xf8, 0x7f, 0xf8, 0x3e, 0x0c, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xf0, 0x7f, 0xf8, 0x3f, 0x80, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x7f, 0xf8, 0x3f, 0xe0, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf8, 0xff, 0xfc, 0x7f, 0xf0, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xcf, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x07, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0x23, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x20, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+0xff, 0xb3, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x20, 0x07, 0xfc, 0x3f, 0xff, 0xff,
+0xff, 0x93, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x80, 0x00, 0x00, 0x67, 0x80, 0xe0, 0x9f, 0xff, 0xff,
+0xff, 0x81, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x01, 0xfe, 0x67, 0xf8, 0x67, 0x9f, 0xff, 0xff,
+0xff, 0xc3, 0xff, 0xf3, 0xff, 0xfd, 0xc0, 0x2f, 0x87, 0xfe, 0x07, 0xfe, 0x22, 0x1f, 0xff, 0xff,
+0xff, 0xc7, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfe, 0x07, 0xff, 0x30, 0x3f, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0x81, 0xfc, 0x1f, 0xfc, 0x3f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0xf8, 0x07, 0xf8, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xcc, 0x00, 0xe0, 0x60, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xcf, 0x03, 0xf0, 0x02, 0x7f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x07, 0x0f, 0xcf, 0xff, 0x0e, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xe0, 0x20, 0xe7, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xf1, 0xe3, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xf1, 0xf0, 0x7f, 0xff, 0xc0, 0xf8, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xe0, 0x78, 0x00, 0x00, 0x03, 0xc0, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x80, 0x0f, 0x80, 0x00, 0x3f, 0x03, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xe0, 0x0f, 0x01, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xc0, 0x3f, 0xc0, 0x1f, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xe3, 0xff, 0xf8, 0x03, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x40, 0x3f, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+},
+};
+
+#endif
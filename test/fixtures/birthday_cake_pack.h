@@ -0,0 +1,352 @@
+#ifndef BIRTHDAY_CAKE_PACK_H
+#define BIRTHDAY_CAKE_PACK_H
+
+#include "FramePack.h"
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+// The pack compiled into animations/birthday_cake.cpp, copied verbatim so the
+// tests decode exactly what the firmware ships. Regenerate both with gif2pack.
+namespace cake {
+
+// 15 frames, 5100 bytes packed (15360 raw), SSD1306 page layout. Format: see src/FramePack.h
+const uint8_t PROGMEM frameData[] = {
+0x00, 0x89, 0xff, 0x01, 0x7f, 0x7f, 0x80, 0x3f, 0x03, 0x1f, 0x9f, 0x1f, 0x3f, 0xf4, 0xff, 0x01, 
+0xf0, 0xf0, 0x80, 0xf3, 0x03, 0xf9, 0xf9, 0xfc, 0xfc, 0x94, 0xff, 0x0a, 0x3f, 0x07, 0x40, 0x30, 
+0x11, 0x83, 0xc3, 0x8f, 0x1f, 0x3f, 0x7f, 0xed, 0xff, 0x14, 0x7f, 0x3f, 0x1f, 0x07, 0x80, 0xc0, 
+0xc0, 0xe0, 0xc4, 0xc7, 0xc3, 0x81, 0x18, 0x1c, 0x0e, 0xc4, 0x60, 0x21, 0x03, 0x07, 0x8f, 0x83, 
+0xcf, 0x04, 0x8f, 0x1f, 0x3f, 0x3f, 0x7f, 0xd6, 0xff, 0x08, 0x7f, 0x3f, 0x1f, 0x9f, 0x8f, 0xc3, 
+0xe0, 0xfc, 0xfe, 0x80, 0xff, 0x00, 0x3f, 0x80, 0x0f, 0x00, 0x3f, 0x80, 0xff, 0x05, 0xfe, 0xf8, 
+0xe0, 0xf0, 0xf8, 0xfe, 0x80, 0xff, 0x00, 0x1f, 0x80, 0x0f, 0x0d, 0x1f, 0xff, 0xff, 0xfe, 0xfc, 
+0xf0, 0xe1, 0x87, 0x8f, 0x1f, 0x1f, 0x3f, 0x7f, 0x7f, 0x80, 0x3f, 0xb1, 0xff, 0x07, 0xe1, 0xc1, 
+0x88, 0x18, 0x11, 0x83, 0xc7, 0xef, 0x8b, 0xff, 0x05, 0x1f, 0x03, 0xc1, 0xf8, 0xfc, 0xfe, 0x88, 
+0xff, 0x80, 0x3e, 0x85, 0x3f, 0x80, 0x7f, 0x80, 0x3f, 0x80, 0x3e, 0x81, 0x3f, 0x84, 0xff, 0x07, 
+0x80, 0x00, 0x18, 0x3c, 0x3c, 0x10, 0x00, 0x03, 0xc5, 0xff, 0x05, 0xf0, 0xc0, 0x87, 0x0f, 0x3f, 
+0x3f, 0x80, 0x7f, 0x8e, 0xff, 0x85, 0xfe, 0x06, 0xff, 0x1f, 0x0f, 0xc7, 0xf3, 0xf3, 0xf1, 0x80, 
+0xf9, 0x0c, 0xf8, 0xf8, 0xfc, 0xfc, 0xf8, 0xe0, 0xc0, 0xc7, 0xcf, 0xc0, 0xc0, 0xe0, 0xfc, 0x80, 
+0xf8, 0x80, 0xf9, 0x05, 0xf3, 0xf3, 0xe7, 0x87, 0x1f, 0x7f, 0x88, 0xff, 0x81, 0x7f, 0xad, 0xff, 
+0x04, 0x1f, 0x02, 0x80, 0xf8, 0xfe, 0x8a, 0xff, 0x06, 0xef, 0xc7, 0xcf, 0x8f, 0x8f, 0x9f, 0x1f, 
+0x80, 0x3f, 0x05, 0x7f, 0x3f, 0x3f, 0x3c, 0x00, 0x03, 0x80, 0xf3, 0x10, 0xe3, 0x87, 0x8f, 0x9f, 
+0x9f, 0x8f, 0x8f, 0xc7, 0xe7, 0xe3, 0xf3, 0xf3, 0xe3, 0xe7, 0xe7, 0xc7, 0xc7, 0x81, 0xcf, 0x05, 
+0xc7, 0xe3, 0xf3, 0x03, 0x01, 0x38, 0x80, 0x7f, 0x85, 0xff, 0x05, 0xe0, 0xe0, 0xe6, 0xe2, 0xe0, 
+0xfc, 0xac, 0xff, 0x01, 0x80, 0x80, 0x8c, 0xff, 0x84, 0xe7, 0x01, 0xc7, 0xe3, 0x80, 0xe0, 0x0b, 
+0xe6, 0xe6, 0xc7, 0xce, 0x8c, 0x88, 0x99, 0x93, 0xb3, 0x33, 0x23, 0x27, 0x80, 0x67, 0x85, 0xe7, 
+0x81, 0x67, 0x0d, 0x33, 0x33, 0xb1, 0x91, 0x98, 0x98, 0xce, 0xce, 0xee, 0xe6, 0xe6, 0xf0, 0xf0, 
+0xf9, 0x97, 0xff, 0x01, 0x89, 0x00, 0x01, 0x80, 0x80, 0x80, 0xc0, 0x03, 0xe0, 0x60, 0xe0, 0xc0, 
+0xf4, 0x00, 0x01, 0x0f, 0x0f, 0x80, 0x0c, 0x03, 0x06, 0x06, 0x03, 0x03, 0x96, 0x00, 0x05, 0x40, 
+0x00, 0x08, 0x00, 0x00, 0x48, 0xf3, 0x00, 0x00, 0x80, 0x80, 0x00, 0x0c, 0x20, 0x0a, 0x00, 0x40, 
+0x00, 0x08, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x04, 0x87, 0x00, 0x08, 0x40, 0x88, 0x7c, 0xfc, 
+0x6c, 0x66, 0x36, 0x3e, 0x3e, 0xd6, 0x00, 0x00, 0x04, 0x82, 0x00, 0x03, 0x10, 0x00, 0x00, 0x20, 
+0x80, 0x00, 0x02, 0x02, 0x00, 0x10, 0x8d, 0x00, 0x03, 0x20, 0x40, 0x00, 0x80, 0x80, 0x00, 0x03, 
+0x40, 0x00, 0x40, 0xc0, 0x98, 0x00, 0x08, 0x0e, 0x3e, 0x3e, 0x36, 0x36, 0x16, 0x3e, 0x1e, 0x18, 
+0x8d, 0x00, 0x07, 0x1e, 0x3e, 0x77, 0xe7, 0xee, 0x7c, 0x38, 0x10, 0x84, 0x00, 0x09, 0x0c, 0x0e, 
+0x1f, 0x1f, 0x36, 0x7e, 0x7c, 0x1c, 0x00, 0x22, 0x96, 0x00, 0x80, 0x40, 0x83, 0x00, 0x00, 0x01, 
+0x86, 0x00, 0x08, 0x08, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x01, 0x44, 0xc7, 0x00, 0x02, 0x04, 
+0x90, 0x20, 0x80, 0x00, 0x00, 0x80, 0x88, 0x00, 0x01, 0x01, 0x01, 0x80, 0x00, 0x00, 0x01, 0x84, 
+0x00, 0x07, 0x01, 0x00, 0x10, 0x88, 0x00, 0x10, 0x00, 0x08, 0x80, 0x00, 0x07, 0x01, 0x05, 0x01, 
+0x04, 0x00, 0x20, 0x00, 0x01, 0x80, 0x00, 0x04, 0x18, 0x00, 0x04, 0x04, 0x05, 0x80, 0x00, 0x04, 
+0x0a, 0x02, 0x04, 0x40, 0x10, 0x89, 0x00, 0x81, 0x80, 0xad, 0x00, 0x02, 0x20, 0x02, 0x80, 0x8e, 
+0x00, 0x05, 0x08, 0x40, 0x10, 0x00, 0x00, 0x20, 0x82, 0x00, 0x03, 0x04, 0x00, 0x00, 0x80, 0x80, 
+0x00, 0x00, 0x40, 0x88, 0x00, 0x09, 0x20, 0x28, 0x08, 0x08, 0x00, 0x40, 0x40, 0x00, 0x00, 0x04, 
+0x80, 0x00, 0x01, 0x08, 0x03, 0x87, 0x00, 0x05, 0x1f, 0x1f, 0x19, 0x1d, 0x1f, 0x03, 0xab, 0x00, 
+0x00, 0x10, 0x95, 0x00, 0x06, 0x20, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x81, 0x00, 0x05, 0x08, 
+0x00, 0xa0, 0x00, 0x14, 0x40, 0x88, 0x00, 0x00, 0x80, 0x80, 0x00, 0x0b, 0x10, 0x10, 0x02, 0x00, 
+0x00, 0x14, 0x00, 0x00, 0x28, 0x00, 0x00, 0x10, 0x99, 0x00, 0x01, 0xff, 0x00, 0x90, 0x00, 0x00, 
+0x80, 0x80, 0xc0, 0x01, 0x80, 0x80, 0x8e, 0x00, 0x0b, 0x20, 0x04, 0x60, 0x00, 0x08, 0x80, 0x40, 
+0x00, 0x10, 0x00, 0x00, 0x80, 0xd9, 0x00, 0x07, 0x04, 0x07, 0x0f, 0x0c, 0x18, 0x0f, 0x07, 0x03, 
+0x8d, 0x00, 0x0f, 0x40, 0x00, 0x08, 0x02, 0x01, 0x40, 0x00, 0x08, 0x00, 0x00, 0x48, 0xa0, 0x10, 
+0x00, 0x04, 0x08, 0x84, 0x00, 0x0a, 0x80, 0x20, 0x40, 0x88, 0x7c, 0xfc, 0x6c, 0x66, 0x36, 0x3e, 
+0x3e, 0xd3, 0x00, 0x03, 0x48, 0x00, 0x00, 0x04, 0x82, 0x00, 0x00, 0x10, 0x83, 0x00, 0x03, 0x02, 
+0x00, 0x00, 0x10, 0x8c, 0x00, 0x01, 0x20, 0x04, 0x82, 0x00, 0x03, 0xc0, 0x00, 0x40, 0xc0, 0x98, 
+0x00, 0x08, 0x0e, 0x3e, 0x3e, 0x36, 0x36, 0x16, 0x3e, 0x1e, 0x18, 0x8f, 0x00, 0x06, 0x18, 0xf8, 
+0xcc, 0x9c, 0xf8, 0xf0, 0x80, 0x83, 0x00, 0x09, 0x0c, 0x0e, 0x1f, 0x1f, 0x36, 0x7e, 0x7c, 0x0c, 
+0x00, 0x22, 0x96, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x08, 0x08, 0x00, 0x00, 
+0x08, 0x00, 0x04, 0x00, 0x01, 0x84, 0x8c, 0x00, 0x07, 0xc0, 0xc0, 0x40, 0x60, 0x70, 0x30, 0xf0, 
+0xc0, 0x9c, 0x00, 0x80, 0x03, 0x00, 0x01, 0x8b, 0x00, 0x04, 0x10, 0x00, 0x04, 0x80, 0x20, 0x8a, 
+0x00, 0x01, 0x01, 0x00, 0x82, 0x01, 0x82, 0x00, 0x02, 0x01, 0x00, 0x01, 0x80, 0x00, 0x04, 0x80, 
+0x20, 0x00, 0x00, 0x08, 0x80, 0x00, 0x02, 0x01, 0x05, 0x05, 0x81, 0x00, 0x00, 0x0a, 0x80, 0x00, 
+0x04, 0x04, 0x00, 0x00, 0x01, 0x04, 0x80, 0x00, 0x03, 0x0a, 0x02, 0x00, 0x40, 0x81, 0x00, 0x03, 
+0x01, 0x03, 0x07, 0x02, 0x80, 0x03, 0x00, 0x01, 0xb2, 0x00, 0x03, 0x30, 0x00, 0xe0, 0x04, 0x8f, 
+0x00, 0x00, 0x10, 0x83, 0x00, 0x14, 0x40, 0x00, 0x20, 0x00, 0x02, 0x80, 0x00, 0x10, 0x04, 0x08, 
+0x40, 0x10, 0x10, 0x40, 0x48, 0x24, 0x04, 0x10, 0x00, 0x00, 0x04, 0x81, 0x00, 0x0a, 0x40, 0x10, 
+0x10, 0x40, 0x08, 0x20, 0x10, 0x00, 0x00, 0x08, 0x42, 0xbb, 0x00, 0x01, 0x10, 0x80, 0x95, 0x00, 
+0x0f, 0x04, 0x02, 0x10, 0x00, 0x00, 0x20, 0x08, 0x41, 0x00, 0x10, 0x00, 0x80, 0x20, 0x00, 0x10, 
+0x40, 0x8c, 0x00, 0x05, 0x50, 0x10, 0x80, 0x20, 0x00, 0x14, 0x84, 0x00, 0x00, 0x08, 0x97, 0x00, 
+0x00, 0x91, 0xff, 0x81, 0x7f, 0xab, 0xff, 0x01, 0xfe, 0xfe, 0xc5, 0xff, 0x83, 0xf0, 0x01, 0xf8, 
+0xf8, 0x91, 0xff, 0x0a, 0x3f, 0x07, 0x40, 0x30, 0x11, 0x83, 0xc3, 0x8f, 0x1f, 0x3f, 0x7f, 0xed, 
+0xff, 0x14, 0x7f, 0x3f, 0x1f, 0x07, 0x80, 0xc0, 0xc0, 0xe0, 0xc4, 0xc7, 0xc3, 0x81, 0x18, 0x1c, 
+0x0e, 0xc4, 0x60, 0x21, 0x03, 0x07, 0x8f, 0x83, 0xcf, 0x04, 0x8f, 0x1f, 0x3f, 0x3f, 0x7f, 0x8d, 
+0xff, 0x06, 0xef, 0xc7, 0xc0, 0xc8, 0xc1, 0xc1, 0xf1, 0xbf, 0xff, 0x08, 0x7f, 0x3f, 0x1f, 0x9f, 
+0x8f, 0xc3, 0xe0, 0xfc, 0xfe, 0x80, 0xff, 0x00, 0x3f, 0x80, 0x0f, 0x00, 0x3f, 0x80, 0xff, 0x05, 
+0xfe, 0xf8, 0xe0, 0xf0, 0xf8, 0xfe, 0x80, 0xff, 0x00, 0x1f, 0x80, 0x0f, 0x0d, 0x1f, 0xff, 0xff, 
+0xfe, 0xfc, 0xf0, 0xe1, 0x87, 0x8f, 0x9f, 0x1f, 0x3f, 0x7f, 0x3f, 0x80, 0x1f, 0x00, 0x3f, 0xc6, 
+0xff, 0x05, 0x1f, 0x03, 0xc1, 0xf8, 0xfc, 0xfe, 0x88, 0xff, 0x80, 0x3e, 0x85, 0x3f, 0x80, 0x7f, 
+0x80, 0x3f, 0x80, 0x3e, 0x81, 0x3f, 0x01, 0xff, 0xff, 0x82, 0x7f, 0x07, 0x60, 0x00, 0x00, 0x1c, 
+0x9e, 0x8c, 0x00, 0x00, 0x83, 0x7f, 0xbf, 0xff, 0x05, 0xf8, 0xe0, 0x87, 0x0f, 0x3f, 0x3f, 0x80, 
+0x7f, 0x8e, 0xff, 0x85, 0xfe, 0x06, 0xff, 0x0f, 0x07, 0xe3, 0xf1, 0xf9, 0xf8, 0x80, 0xfc, 0x82, 
+0xfe, 0x06, 0xfc, 0xe0, 0xe0, 0xe3, 0xe3, 0xe0, 0xf0, 0x82, 0xfe, 0x80, 0xfc, 0x04, 0xf9, 0xf9, 
+0xe3, 0x07, 0x0f, 0xbc, 0xff, 0x04, 0x1f, 0x02, 0x80, 0xf8, 0xfe, 0x8a, 0xff, 0x00, 0xe7, 0x80, 
+0xc7, 0x80, 0xcf, 0x01, 0x8f, 0x9f, 0x81, 0x1f, 0x08, 0x9f, 0x80, 0x00, 0x19, 0xf9, 0xf8, 0xf9, 
+0xe1, 0xc7, 0x80, 0xcf, 0x02, 0xe7, 0xe3, 0xf3, 0x81, 0xf9, 0x00, 0xf1, 0x80, 0xf3, 0x00, 0xf7, 
+0x80, 0xe7, 0x06, 0xe3, 0xf1, 0x79, 0x21, 0x00, 0x80, 0xbf, 0x80, 0x3f, 0x01, 0x7f, 0x7f, 0xb7, 
+0xff, 0x01, 0x80, 0x80, 0x8c, 0xff, 0x00, 0xf7, 0x80, 0xe7, 0x80, 0xe3, 0x11, 0xf3, 0xf1, 0xf1, 
+0xf0, 0xf0, 0xf1, 0xf3, 0xe3, 0xe3, 0xe7, 0xe4, 0xc4, 0xcc, 0xc9, 0x99, 0x99, 0x91, 0x13, 0x80, 
+0x33, 0x84, 0x73, 0x12, 0x33, 0x31, 0x33, 0xb3, 0x9b, 0x99, 0xd8, 0xcc, 0xcc, 0xc4, 0xe6, 0xe7, 
+0xf7, 0xf3, 0xf3, 0xf1, 0xf8, 0xfc, 0xfd, 0x96, 0xff, 0x00, 0x89, 0xff, 0x01, 0x7f, 0x7f, 0x80, 
+0x3f, 0x03, 0x1f, 0x9f, 0x1f, 0x3f, 0xf4, 0xff, 0x01, 0xf0, 0xf0, 0x80, 0xf3, 0x03, 0xf9, 0xf9, 
+0xfc, 0xfc, 0x94, 0xff, 0x0a, 0x3f, 0x07, 0x00, 0x30, 0x19, 0x83, 0xc3, 0xc7, 0x1f, 0x3f, 0x7f, 
+0xed, 0xff, 0x04, 0x7f, 0x3f, 0x1f, 0x87, 0x80, 0x80, 0xc0, 0x0c, 0xce, 0xc7, 0x83, 0x81, 0x10, 
+0x1c, 0x1e, 0xc4, 0xe0, 0x21, 0x03, 0x03, 0x8f, 0x83, 0xcf, 0x03, 0x8f, 0x1f, 0x3f, 0x7f, 0xd7, 
+0xff, 0x08, 0x7f, 0x3f, 0x1f, 0x9f, 0x8f, 0xc3, 0xe0, 0xf8, 0xfe, 0x80, 0xff, 0x04, 0x3f, 0x1f, 
+0x0f, 0x0f, 0x1f, 0x80, 0xff, 0x05, 0xfc, 0xf8, 0xf0, 0xf0, 0xf8, 0xfe, 0x80, 0xff, 0x00, 0x1f, 
+0x80, 0x0f, 0x13, 0x1f, 0xff, 0xff, 0xfe, 0xfc, 0xf0, 0xc1, 0xc3, 0x8f, 0x9f, 0x1f, 0x3f, 0x3f, 
+0x1f, 0x0f, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xae, 0xff, 0x07, 0xe1, 0xc1, 0x88, 0x18, 0x11, 0x83, 
+0xc7, 0xef, 0x8b, 0xff, 0x05, 0x0f, 0x03, 0xe3, 0xf8, 0xfc, 0xfe, 0x88, 0xff, 0x80, 0x3e, 0x8b, 
+0x3f, 0x81, 0x3e, 0x80, 0x3f, 0x80, 0x7f, 0x81, 0x3f, 0x08, 0x3e, 0x30, 0x20, 0x00, 0x07, 0xc7, 
+0xc6, 0x00, 0x00, 0x84, 0x3f, 0x01, 0x7f, 0x7f, 0xbb, 0xff, 0x07, 0xf0, 0xc0, 0x83, 0x9f, 0x1f, 
+0x3f, 0x7f, 0x7f, 0x89, 0xff, 0x01, 0xfe, 0xfe, 0x80, 0xff, 0x85, 0xfe, 0x80, 0xff, 0x07, 0x0f, 
+0x01, 0x70, 0xf8, 0x7c, 0x7e, 0x7e, 0xfe, 0x84, 0xff, 0x05, 0xf0, 0xf0, 0xf9, 0xf9, 0xf0, 0xf8, 
+0x83, 0xff, 0x80, 0xfe, 0x04, 0xfc, 0xf8, 0x31, 0x03, 0xdf, 0x86, 0xff, 0x81, 0x7f, 0xad, 0xff, 
+0x04, 0x3f, 0x00, 0x00, 0xf8, 0xfe, 0x8a, 0xff, 0x02, 0xf3, 0xe3, 0xe3, 0x82, 0xe7, 0x14, 0xc7, 
+0xc7, 0x0f, 0x0f, 0x8f, 0xcf, 0xcf, 0xc0, 0x80, 0x00, 0x7c, 0x7c, 0xfc, 0xf8, 0xf1, 0xe3, 0xf7, 
+0xf3, 0xf3, 0xf1, 0xf9, 0x81, 0xfc, 0x00, 0xf8, 0x80, 0xf1, 0x81, 0xf3, 0x0c, 0xf1, 0x79, 0x3c, 
+0x1e, 0x00, 0xc0, 0xce, 0xcf, 0x9f, 0x9f, 0x1f, 0x3f, 0x7f, 0x80, 0xff, 0x05, 0xe0, 0xe0, 0xe6, 
+0xe2, 0xe0, 0xfc, 0xab, 0xff, 0x02, 0xef, 0x80, 0x80, 0x8d, 0xff, 0x81, 0xf3, 0x04, 0xf1, 0xf1, 
+0xf9, 0xf9, 0xf8, 0x80, 0xfc, 0x09, 0xf8, 0xf8, 0xf9, 0xf1, 0xf3, 0xf3, 0xe2, 0xe6, 0xe4, 0xe4, 
+0x80, 0xcc, 0x03, 0xc8, 0x99, 0x99, 0x19, 0x83, 0x39, 0x02, 0x19, 0x99, 0x99, 0x80, 0xcc, 0x02, 
+0xe4, 0xe4, 0xe6, 0x80, 0xf3, 0x80, 0xf9, 0x03, 0xfc, 0xfc, 0xfe, 0xfe, 0x95, 0xff, 0x00, 0xff, 
+0xff, 0xa7, 0xff, 0x0b, 0x1f, 0x03, 0x60, 0x30, 0x11, 0x03, 0x83, 0xc7, 0x0f, 0x3f, 0x7f, 0x7f, 
+0xec, 0xff, 0x14, 0x7f, 0x3f, 0x1f, 0x87, 0x80, 0x80, 0xc0, 0xc8, 0xcc, 0xc6, 0xc3, 0x81, 0x18, 
+0x1c, 0x1e, 0x8c, 0x40, 0x31, 0x03, 0x07, 0x87, 0x83, 0xcf, 0x0b, 0x8f, 0x9f, 0x1f, 0x3f, 0x37, 
+0x83, 0x03, 0x93, 0x99, 0xc9, 0xc1, 0xc1, 0xcf, 0xff, 0x08, 0x7f, 0x3f, 0x1f, 0x9f, 0xc7, 0xc3, 
+0xe0, 0xfc, 0xfe, 0x80, 0xff, 0x00, 0x3f, 0x80, 0x0f, 0x00, 0x1f, 0x80, 0xff, 0x05, 0xfe, 0xf8, 
+0xf0, 0xe0, 0xf8, 0xfe, 0x80, 0xff, 0x00, 0x1f, 0x80, 0x0f, 0x14, 0x1f, 0xff, 0xff, 0xfe, 0xfc, 
+0xf0, 0xc1, 0xc3, 0x8f, 0x9f, 0x1f, 0x3f, 0x3f, 0x1f, 0x0f, 0x0f, 0x83, 0x83, 0x03, 0x0f, 0x3f, 
+0x94, 0xff, 0x08, 0xf1, 0xc1, 0xc1, 0xc9, 0xc9, 0xe9, 0xc1, 0xe1, 0xe7, 0x9c, 0xff, 0x0c, 0xf3, 
+0xf1, 0xe0, 0xe0, 0xc9, 0x81, 0x83, 0x03, 0x03, 0xc1, 0xf8, 0xfc, 0xfe, 0x88, 0xff, 0x80, 0x3e, 
+0x85, 0x3f, 0x00, 0x7f, 0x82, 0x3f, 0x80, 0x3e, 0x82, 0x3f, 0x00, 0x1f, 0x80, 0x9f, 0x0e, 0x8f, 
+0x8f, 0x8e, 0x8c, 0x80, 0x00, 0x01, 0xc3, 0xf3, 0x01, 0x00, 0xcc, 0xcf, 0xcf, 0xdf, 0x81, 0x9f, 
+0x04, 0x1f, 0x1f, 0x3f, 0x7f, 0x7f, 0xb7, 0xff, 0x07, 0xe0, 0xc0, 0x87, 0x1f, 0x3f, 0x3f, 0x7f, 
+0x7f, 0x87, 0xff, 0x00, 0xfe, 0x80, 0xff, 0x85, 0xfe, 0x01, 0xff, 0xfe, 0x82, 0xff, 0x06, 0x80, 
+0x00, 0x1e, 0x3e, 0x3f, 0x3f, 0x7f, 0x82, 0xff, 0x01, 0x7f, 0x3f, 0x81, 0x3c, 0x01, 0x7c, 0x7c, 
+0x85, 0xff, 0x05, 0x7f, 0x3f, 0x3e, 0x18, 0x80, 0xe5, 0xba, 0xff, 0x04, 0x0f, 0x00, 0xe0, 0xfc, 
+0xfe, 0x8a, 0xff, 0x00, 0xf3, 0x84, 0xe3, 0x15, 0xf3, 0x63, 0x03, 0x07, 0x07, 0x67, 0x73, 0xf3, 
+0xf0, 0xc0, 0x8f, 0x1f, 0x3e, 0x3e, 0x3c, 0x7c, 0x78, 0x78, 0x7c, 0x7c, 0x7e, 0x7e, 0x80, 0x7f, 
+0x00, 0x7e, 0x81, 0x7c, 0x0f, 0x78, 0x79, 0x39, 0x38, 0x3c, 0x1c, 0x8e, 0x80, 0xe0, 0xe3, 0x63, 
+0x67, 0x67, 0x0f, 0x0f, 0x1f, 0xb5, 0xff, 0x01, 0x00, 0x80, 0x8d, 0xff, 0x00, 0xfb, 0x80, 0xf1, 
+0x80, 0xf9, 0x02, 0xf8, 0xfc, 0xfc, 0x81, 0xfe, 0x0d, 0xfc, 0xfc, 0xf8, 0xf8, 0xf9, 0xf1, 0xf1, 
+0xf3, 0xf3, 0xe2, 0x82, 0x86, 0xc6, 0xc6, 0x80, 0xce, 0x01, 0x9e, 0x8e, 0x81, 0xce, 0x80, 0xe6, 
+0x05, 0xf7, 0xf3, 0xf3, 0xfb, 0xf9, 0xf9, 0x80, 0xfc, 0x80, 0xfe, 0x97, 0xff, 0x01, 0xff, 0x00, 
+0x90, 0x00, 0x00, 0x80, 0x80, 0xc0, 0x01, 0x80, 0x80, 0x8e, 0x00, 0x0b, 0x20, 0x04, 0x20, 0x00, 
+0x00, 0x80, 0x40, 0x48, 0x10, 0x00, 0x00, 0x80, 0xd9, 0x00, 0x07, 0x04, 0x07, 0x0f, 0x0c, 0x18, 
+0x0f, 0x07, 0x03, 0x8b, 0x00, 0x06, 0x80, 0x00, 0x40, 0x00, 0x28, 0x08, 0x01, 0x81, 0x00, 0x06, 
+0x10, 0x48, 0x20, 0x10, 0x00, 0x00, 0x08, 0x84, 0x00, 0x0a, 0x80, 0x20, 0x00, 0x48, 0x7c, 0xfc, 
+0x6c, 0x66, 0x36, 0x3e, 0x3e, 0xd3, 0x00, 0x00, 0x48, 0x88, 0x00, 0x00, 0x20, 0x82, 0x00, 0x01, 
+0x10, 0x10, 0x8c, 0x00, 0x01, 0x20, 0x44, 0x80, 0x00, 0x00, 0x20, 0x80, 0x00, 0x02, 0x88, 0x40, 
+0x40, 0x97, 0x00, 0x08, 0x0e, 0x3e, 0x3e, 0x36, 0x36, 0x16, 0x3e, 0x1e, 0x18, 0x8f, 0x00, 0x06, 
+0x18, 0xf8, 0xcc, 0x9c, 0xf8, 0xf0, 0x80, 0x83, 0x00, 0x07, 0x0c, 0x0e, 0x1f, 0x1f, 0x36, 0x7e, 
+0x7c, 0x1c, 0x99, 0x00, 0x01, 0x40, 0x40, 0x8e, 0x00, 0x05, 0x41, 0x42, 0x08, 0x00, 0x00, 0xb0, 
+0x80, 0x00, 0x04, 0xcc, 0x00, 0x40, 0x50, 0x10, 0x80, 0x00, 0x0d, 0x20, 0x20, 0x40, 0x00, 0x80, 
+0x00, 0xc0, 0xc0, 0x40, 0x60, 0x70, 0x30, 0xf0, 0xc0, 0x9c, 0x00, 0x80, 0x03, 0x00, 0x01, 0x8b, 
+0x00, 0x03, 0x18, 0x20, 0x00, 0x10, 0x81, 0x00, 0x00, 0x80, 0x86, 0x00, 0x00, 0x01, 0x80, 0x00, 
+0x81, 0x01, 0x81, 0x00, 0x03, 0x01, 0x00, 0x01, 0x01, 0x80, 0x00, 0x07, 0x40, 0x00, 0x22, 0x01, 
+0x00, 0x00, 0x40, 0x80, 0x81, 0x00, 0x02, 0x80, 0x40, 0x42, 0x80, 0x00, 0x04, 0x40, 0x00, 0x81, 
+0x80, 0x80, 0x81, 0x00, 0x01, 0x80, 0x40, 0x80, 0x00, 0x05, 0x01, 0x16, 0x01, 0x03, 0x07, 0x02, 
+0x80, 0x03, 0x00, 0x01, 0xb2, 0x00, 0x03, 0x10, 0x02, 0x60, 0x04, 0x8c, 0x00, 0x02, 0x10, 0x10, 
+0x00, 0x81, 0x10, 0x01, 0x00, 0x10, 0x80, 0x00, 0x11, 0x04, 0x10, 0x80, 0x10, 0x00, 0x00, 0x80, 
+0x01, 0x00, 0x04, 0x44, 0x01, 0x01, 0x04, 0x04, 0x02, 0x00, 0x01, 0x80, 0x00, 0x0a, 0x02, 0x02, 
+0x00, 0x00, 0x04, 0x05, 0x05, 0x04, 0x20, 0x02, 0x01, 0x80, 0x00, 0x00, 0x84, 0x81, 0x00, 0x00, 
+0x80, 0xb5, 0x00, 0x00, 0x80, 0x8e, 0x00, 0x01, 0x04, 0x0a, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 
+0x06, 0x02, 0x00, 0x04, 0x00, 0x01, 0x08, 0x08, 0x81, 0x00, 0x01, 0x40, 0x20, 0x81, 0x00, 0x0c, 
+0x50, 0x10, 0x40, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x04, 0x00, 0x08, 0x02, 0x81, 0x00, 0x03, 
+0x02, 0x00, 0x00, 0x01, 0x97, 0x00, 0x01, 0x91, 0x00, 0x81, 0x80, 0xab, 0x00, 0x01, 0x01, 0x01, 
+0xc5, 0x00, 0x82, 0x0f, 0x05, 0x8f, 0xc7, 0xc7, 0xc0, 0x80, 0x80, 0x90, 0x00, 0x05, 0x40, 0x00, 
+0x08, 0x00, 0x00, 0x48, 0xdd, 0x00, 0x07, 0x04, 0x07, 0x0f, 0x0c, 0x18, 0x0f, 0x07, 0x03, 0x8b, 
+0x00, 0x00, 0x80, 0x80, 0x00, 0x0c, 0x20, 0x0a, 0x00, 0x40, 0x00, 0x08, 0x00, 0x10, 0x00, 0x80, 
+0x00, 0x00, 0x04, 0x87, 0x00, 0x01, 0x40, 0x80, 0x8d, 0x00, 0x06, 0x10, 0x38, 0x3f, 0x37, 0x3e, 
+0x3e, 0x0e, 0xc6, 0x00, 0x00, 0x04, 0x82, 0x00, 0x03, 0x10, 0x00, 0x00, 0x20, 0x80, 0x00, 0x02, 
+0x02, 0x00, 0x10, 0x8d, 0x00, 0x01, 0x20, 0x44, 0x80, 0x00, 0x09, 0x20, 0x00, 0x00, 0x08, 0x04, 
+0x40, 0x44, 0x0c, 0x10, 0x40, 0xaf, 0x00, 0x06, 0x18, 0xf8, 0xcc, 0x9c, 0xf8, 0xf0, 0x80, 0x8a, 
+0x00, 0x02, 0x10, 0x00, 0x22, 0x96, 0x00, 0x80, 0x40, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 
+0x80, 0x80, 0x00, 0x0f, 0x10, 0x50, 0x11, 0x40, 0x08, 0x00, 0x02, 0x10, 0x00, 0x01, 0x00, 0x84, 
+0x00, 0x40, 0x40, 0x50, 0x80, 0x00, 0x00, 0xa0, 0x82, 0x00, 0x07, 0xc0, 0xc0, 0x40, 0x60, 0x70, 
+0x30, 0xf0, 0xc0, 0x9c, 0x00, 0x80, 0x03, 0x00, 0x01, 0x8b, 0x00, 0x04, 0x08, 0x20, 0x04, 0x90, 
+0x20, 0x80, 0x00, 0x00, 0x80, 0x88, 0x00, 0x01, 0x01, 0x01, 0x80, 0x00, 0x00, 0x01, 0x84, 0x00, 
+0x00, 0x01, 0x80, 0x00, 0x03, 0x40, 0x08, 0x00, 0x01, 0x87, 0x00, 0x00, 0x02, 0x82, 0x00, 0x02, 
+0x81, 0x80, 0x80, 0x82, 0x00, 0x09, 0x40, 0x00, 0x00, 0x04, 0x81, 0x34, 0x01, 0x03, 0x07, 0x02, 
+0x80, 0x03, 0x00, 0x01, 0xb2, 0x00, 0x02, 0x20, 0x02, 0x80, 0x90, 0x00, 0x01, 0x10, 0x10, 0x80, 
+0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x10, 0x80, 0x00, 0x05, 0x08, 0x80, 0x00, 0x00, 0x04, 0x40, 
+0x87, 0x00, 0x01, 0x02, 0x02, 0x80, 0x00, 0x0e, 0x04, 0x04, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 
+0x00, 0x84, 0x00, 0x00, 0x08, 0x00, 0x10, 0xb4, 0x00, 0x00, 0x10, 0x8f, 0x00, 0x03, 0x04, 0x02, 
+0x08, 0x08, 0x84, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x40, 0x82, 0x00, 
+0x0a, 0x40, 0x00, 0x50, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x01, 0x01, 0x80, 0x00, 0x06, 0x01, 
+0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x97, 0x00, 0x01, 0x89, 0x00, 0x01, 0x80, 0x80, 0x80, 0xc0, 
+0x03, 0xe0, 0x60, 0xe0, 0x40, 0x80, 0x80, 0xab, 0x00, 0x01, 0x01, 0x01, 0xc1, 0x00, 0x0b, 0x0f, 
+0x0f, 0x0c, 0x0c, 0x03, 0x09, 0x09, 0x0c, 0x0c, 0x0f, 0x07, 0x07, 0x91, 0x00, 0x0b, 0x20, 0x04, 
+0x60, 0x00, 0x08, 0x80, 0x40, 0x00, 0x10, 0x00, 0x00, 0x80, 0xf1, 0x00, 0x0f, 0x40, 0x00, 0x08, 
+0x02, 0x01, 0x40, 0x00, 0x08, 0x00, 0x00, 0x48, 0xa0, 0x10, 0x00, 0x04, 0x08, 0x84, 0x00, 0x03, 
+0x80, 0x20, 0x40, 0x80, 0x8d, 0x00, 0x06, 0x10, 0x38, 0x3f, 0x37, 0x3e, 0x3e, 0x0e, 0xc3, 0x00, 
+0x03, 0x48, 0x00, 0x00, 0x04, 0x82, 0x00, 0x00, 0x10, 0x83, 0x00, 0x03, 0x02, 0x00, 0x00, 0x10, 
+0x94, 0x00, 0x06, 0x08, 0x8c, 0x00, 0x04, 0x0c, 0x10, 0x40, 0xad, 0x00, 0x07, 0x1e, 0x3e, 0x77, 
+0xe7, 0xee, 0x7c, 0x38, 0x10, 0x8d, 0x00, 0x00, 0x22, 0x96, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 
+0x01, 0x81, 0x00, 0x00, 0x80, 0x80, 0x00, 0x0f, 0x10, 0x50, 0x50, 0x02, 0x00, 0x00, 0x02, 0xa0, 
+0x00, 0x01, 0x00, 0x48, 0x00, 0x00, 0x10, 0x40, 0x80, 0x00, 0x02, 0x80, 0x00, 0x40, 0xb9, 0x00, 
+0x04, 0x10, 0x00, 0x04, 0x80, 0x20, 0x8a, 0x00, 0x01, 0x01, 0x00, 0x82, 0x01, 0x82, 0x00, 0x02, 
+0x01, 0x00, 0x01, 0x82, 0x00, 0x01, 0x08, 0x22, 0x80, 0x00, 0x01, 0x40, 0x80, 0x81, 0x00, 0x02, 
+0x80, 0x40, 0x40, 0x80, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x80, 0x80, 0x00, 0x02, 0x04, 0x80, 
+0x20, 0x86, 0x00, 0x81, 0x80, 0xad, 0x00, 0x03, 0x30, 0x00, 0xe0, 0x04, 0x8c, 0x00, 0x01, 0x10, 
+0x10, 0x80, 0x00, 0x01, 0x10, 0x10, 0x82, 0x00, 0x11, 0x04, 0x00, 0x80, 0x10, 0x00, 0x08, 0x00, 
+0x01, 0x00, 0x00, 0x04, 0x01, 0x01, 0x04, 0x04, 0x02, 0x00, 0x01, 0x84, 0x00, 0x07, 0x04, 0x01, 
+0x01, 0x04, 0x00, 0x02, 0x01, 0x40, 0x82, 0x00, 0x02, 0x08, 0x00, 0x90, 0x80, 0x00, 0x05, 0x1f, 
+0x1f, 0x19, 0x1d, 0x1f, 0x03, 0xab, 0x00, 0x01, 0x10, 0x80, 0x8f, 0x00, 0x80, 0x08, 0x02, 0x00, 
+0x00, 0x01, 0x81, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x01, 0x08, 0x08, 0x02, 
+0x00, 0x01, 0x04, 0x00, 0x20, 0x82, 0x00, 0x01, 0x10, 0x10, 0x83, 0x00, 0x05, 0x05, 0x01, 0x08, 
+0x02, 0x00, 0x01, 0x9d, 0x00, 0x00, 0xff, 0xff, 0xa7, 0xff, 0x0a, 0x3f, 0x07, 0x40, 0x30, 0x11, 
+0x83, 0xc3, 0x8f, 0x1f, 0x3f, 0x7f, 0xed, 0xff, 0x14, 0x7f, 0x3f, 0x1f, 0x07, 0x80, 0xc0, 0xc0, 
+0xe0, 0xc4, 0xc7, 0xc3, 0x81, 0x18, 0x1c, 0x0e, 0xc4, 0x60, 0x21, 0x03, 0x07, 0x8f, 0x83, 0xcf, 
+0x0b, 0x8f, 0x1f, 0x3f, 0x3f, 0x77, 0x83, 0x03, 0x93, 0x99, 0xc9, 0xc1, 0xc1, 0xcf, 0xff, 0x08, 
+0x7f, 0x3f, 0x1f, 0x9f, 0x8f, 0xc3, 0xe0, 0xfc, 0xfe, 0x80, 0xff, 0x00, 0x3f, 0x80, 0x0f, 0x00, 
+0x3f, 0x80, 0xff, 0x05, 0xfe, 0xf8, 0xe0, 0xf0, 0xf8, 0xfe, 0x80, 0xff, 0x00, 0x1f, 0x80, 0x0f, 
+0x14, 0x1f, 0xff, 0xff, 0xfe, 0xfc, 0xf0, 0xe1, 0x87, 0x8f, 0x9f, 0x1f, 0x1f, 0x3f, 0x1f, 0x0f, 
+0x87, 0xc3, 0xc3, 0x03, 0x0f, 0x3f, 0x94, 0xff, 0x08, 0xf1, 0xc1, 0xc1, 0xc9, 0xc9, 0xe9, 0xc1, 
+0xe1, 0xe7, 0x9c, 0xff, 0x0c, 0xf3, 0xf1, 0xe0, 0xe0, 0xc9, 0x81, 0x83, 0x03, 0x03, 0xc1, 0xf8, 
+0xfc, 0xfe, 0x88, 0xff, 0x80, 0x3e, 0x85, 0x3f, 0x80, 0x7f, 0x80, 0x3f, 0x80, 0x3e, 0x82, 0x3f, 
+0x00, 0x1f, 0x80, 0x9f, 0x0c, 0x8f, 0x8f, 0xcf, 0xce, 0x88, 0x00, 0x01, 0x73, 0xf3, 0x01, 0x00, 
+0x00, 0xcf, 0x80, 0x8f, 0x80, 0x9f, 0x03, 0x1f, 0x1f, 0x3f, 0x3f, 0xb8, 0xff, 0x05, 0xf8, 0xe0, 
+0x87, 0x0f, 0x3f, 0x3f, 0x80, 0x7f, 0x8e, 0xff, 0x85, 0xfe, 0x80, 0xff, 0x02, 0xc0, 0x00, 0x3c, 
+0x81, 0x3f, 0x00, 0x7f, 0x82, 0xff, 0x01, 0x7f, 0x7e, 0x81, 0x3c, 0x03, 0x7c, 0x7e, 0x7f, 0x7f, 
+0x81, 0xff, 0x06, 0x7f, 0x3f, 0x3f, 0x3e, 0x18, 0x80, 0xf3, 0xba, 0xff, 0x04, 0x1f, 0x02, 0x80, 
+0xf8, 0xfe, 0x8a, 0xff, 0x80, 0xf3, 0x00, 0xe3, 0x82, 0xf3, 0x17, 0x73, 0x03, 0x07, 0x07, 0x63, 
+0x63, 0x73, 0xe0, 0xc0, 0x8f, 0x9f, 0x3f, 0x3e, 0x38, 0x38, 0x79, 0x79, 0x78, 0x78, 0x7c, 0x7e, 
+0x7e, 0x7f, 0x7f, 0x80, 0x7e, 0x81, 0x7c, 0x0d, 0x3c, 0x3c, 0x1c, 0x1e, 0x8f, 0x80, 0xe0, 0xe3, 
+0xe7, 0x67, 0x67, 0x0f, 0x0f, 0x9f, 0xb5, 0xff, 0x01, 0x80, 0x80, 0x8e, 0xff, 0x08, 0xfb, 0xf1, 
+0xf1, 0xf9, 0xf9, 0xf8, 0xf8, 0xfc, 0xfc, 0x82, 0xfe, 0x0c, 0xfc, 0xfc, 0xf8, 0xf8, 0xf9, 0xf9, 
+0xf3, 0xf3, 0xe2, 0x82, 0xc6, 0xe6, 0xc6, 0x81, 0xce, 0x0a, 0x9e, 0x8e, 0xce, 0xce, 0xc6, 0xe6, 
+0xe6, 0xf6, 0xf3, 0xf3, 0xfb, 0x80, 0xf9, 0x01, 0xfc, 0xfc, 0x80, 0xfe, 0x98, 0xff, 0x01, 0xff, 
+0x00, 0x90, 0x00, 0x00, 0x80, 0x80, 0xc0, 0x01, 0x80, 0x80, 0x90, 0x00, 0x05, 0x40, 0x00, 0x08, 
+0x00, 0x00, 0x48, 0xdd, 0x00, 0x07, 0x04, 0x07, 0x0f, 0x0c, 0x18, 0x0f, 0x07, 0x03, 0x8b, 0x00, 
+0x00, 0x80, 0x80, 0x00, 0x0c, 0x20, 0x0a, 0x00, 0x40, 0x00, 0x08, 0x00, 0x10, 0x00, 0x80, 0x00, 
+0x00, 0x04, 0x87, 0x00, 0x08, 0x40, 0x88, 0x7c, 0xfc, 0x6c, 0x66, 0x36, 0x3e, 0x3e, 0xd6, 0x00, 
+0x00, 0x04, 0x82, 0x00, 0x03, 0x10, 0x00, 0x00, 0x20, 0x80, 0x00, 0x02, 0x02, 0x00, 0x10, 0x8d, 
+0x00, 0x01, 0x20, 0x44, 0x80, 0x00, 0x09, 0x20, 0x00, 0x00, 0x08, 0x04, 0x40, 0x44, 0x0c, 0x10, 
+0x40, 0x94, 0x00, 0x08, 0x0e, 0x3e, 0x3e, 0x36, 0x36, 0x16, 0x3e, 0x1e, 0x18, 0x8f, 0x00, 0x06, 
+0x18, 0xf8, 0xcc, 0x9c, 0xf8, 0xf0, 0x80, 0x83, 0x00, 0x09, 0x0c, 0x0e, 0x1f, 0x1f, 0x36, 0x7e, 
+0x7c, 0x0c, 0x00, 0x22, 0x96, 0x00, 0x80, 0x40, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x80, 
+0x80, 0x00, 0x0f, 0x10, 0x50, 0x11, 0x40, 0x08, 0x00, 0x02, 0x10, 0x00, 0x01, 0x00, 0x84, 0x00, 
+0x40, 0x40, 0x50, 0x80, 0x00, 0x0d, 0x80, 0x20, 0x40, 0x40, 0x00, 0x00, 0xc0, 0xc0, 0x40, 0x60, 
+0x70, 0x30, 0xf0, 0xc0, 0x9c, 0x00, 0x80, 0x03, 0x00, 0x01, 0x8b, 0x00, 0x04, 0x08, 0x20, 0x04, 
+0x90, 0x20, 0x80, 0x00, 0x00, 0x80, 0x88, 0x00, 0x01, 0x01, 0x01, 0x80, 0x00, 0x00, 0x01, 0x84, 
+0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0x40, 0x08, 0x00, 0x01, 0x87, 0x00, 0x00, 0x02, 0x82, 0x00, 
+0x02, 0x81, 0x80, 0x80, 0x82, 0x00, 0x09, 0x40, 0x00, 0x00, 0x04, 0x80, 0x34, 0x01, 0x03, 0x07, 
+0x02, 0x80, 0x03, 0x00, 0x01, 0xb2, 0x00, 0x02, 0x20, 0x02, 0x80, 0x90, 0x00, 0x01, 0x10, 0x10, 
+0x80, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x10, 0x80, 0x00, 0x05, 0x08, 0x80, 0x00, 0x00, 0x04, 
+0x40, 0x87, 0x00, 0x01, 0x02, 0x02, 0x80, 0x00, 0x09, 0x04, 0x04, 0x00, 0x20, 0x00, 0x00, 0x40, 
+0x00, 0x00, 0x80, 0xb9, 0x00, 0x00, 0x10, 0x8f, 0x00, 0x03, 0x04, 0x02, 0x08, 0x08, 0x84, 0x00, 
+0x00, 0x01, 0x86, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x40, 0x82, 0x00, 0x0a, 0x40, 0x00, 0x50, 
+0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x01, 0x01, 0x80, 0x00, 0x06, 0x01, 0x00, 0x00, 0x02, 0x00, 
+0x00, 0x01, 0x97, 0x00, 0x01, 0x91, 0x00, 0x81, 0x80, 0xab, 0x00, 0x01, 0x01, 0x01, 0xc5, 0x00, 
+0x82, 0x0f, 0x05, 0x8f, 0xc7, 0xc7, 0xc0, 0x80, 0x80, 0x8e, 0x00, 0x0b, 0x20, 0x04, 0x60, 0x00, 
+0x08, 0x80, 0x40, 0x00, 0x10, 0x00, 0x00, 0x80, 0xd9, 0x00, 0x07, 0x04, 0x07, 0x0f, 0x0c, 0x18, 
+0x0f, 0x07, 0x03, 0x8d, 0x00, 0x0f, 0x40, 0x00, 0x08, 0x02, 0x01, 0x40, 0x00, 0x08, 0x00, 0x00, 
+0x48, 0xa0, 0x10, 0x00, 0x04, 0x08, 0x84, 0x00, 0x03, 0x80, 0x20, 0x40, 0x80, 0x8d, 0x00, 0x06, 
+0x10, 0x38, 0x3f, 0x37, 0x3e, 0x3e, 0x0e, 0xc3, 0x00, 0x03, 0x48, 0x00, 0x00, 0x04, 0x82, 0x00, 
+0x00, 0x10, 0x83, 0x00, 0x03, 0x02, 0x00, 0x00, 0x10, 0x94, 0x00, 0x06, 0x08, 0x8c, 0x00, 0x04, 
+0x0c, 0x10, 0x40, 0xaf, 0x00, 0x06, 0x18, 0xf8, 0xcc, 0x9c, 0xf8, 0xf0, 0x80, 0x8c, 0x00, 0x00, 
+0x22, 0x96, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x80, 0x80, 0x00, 0x0f, 
+0x10, 0x50, 0x50, 0x02, 0x00, 0x00, 0x02, 0xa0, 0x00, 0x01, 0x00, 0x48, 0x00, 0x00, 0x10, 0x40, 
+0x80, 0x00, 0x02, 0xa0, 0x00, 0x40, 0x80, 0x00, 0x07, 0xc0, 0xc0, 0x40, 0x60, 0x70, 0x30, 0xf0, 
+0xc0, 0x9c, 0x00, 0x80, 0x03, 0x00, 0x01, 0x8b, 0x00, 0x04, 0x10, 0x00, 0x04, 0x80, 0x20, 0x8a, 
+0x00, 0x01, 0x01, 0x00, 0x82, 0x01, 0x82, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x01, 0x08, 
+0x22, 0x80, 0x00, 0x01, 0x40, 0x80, 0x81, 0x00, 0x02, 0x80, 0x40, 0x40, 0x80, 0x00, 0x00, 0x40, 
+0x85, 0x00, 0x00, 0x80, 0x80, 0x00, 0x06, 0x04, 0x80, 0x20, 0x01, 0x03, 0x07, 0x02, 0x80, 0x03, 
+0x00, 0x01, 0xb2, 0x00, 0x03, 0x30, 0x00, 0xe0, 0x04, 0x8c, 0x00, 0x01, 0x10, 0x10, 0x80, 0x00, 
+0x01, 0x10, 0x10, 0x82, 0x00, 0x11, 0x04, 0x00, 0x80, 0x10, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 
+0x04, 0x01, 0x01, 0x04, 0x04, 0x02, 0x00, 0x01, 0x84, 0x00, 0x0f, 0x04, 0x01, 0x01, 0x04, 0x00, 
+0x02, 0x01, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x90, 0xb4, 0x00, 0x01, 0x10, 0x80, 
+0x8f, 0x00, 0x80, 0x08, 0x02, 0x00, 0x00, 0x01, 0x81, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x02, 0x00, 
+0x04, 0x00, 0x01, 0x08, 0x08, 0x02, 0x00, 0x01, 0x04, 0x00, 0x20, 0x81, 0x00, 0x80, 0x10, 0x83, 
+0x00, 0x05, 0x05, 0x01, 0x08, 0x02, 0x00, 0x01, 0x9d, 0x00, 0x01, 0x89, 0x00, 0x01, 0x80, 0x80, 
+0x80, 0xc0, 0x03, 0xe0, 0x60, 0xe0, 0x40, 0x80, 0x80, 0xab, 0x00, 0x01, 0x01, 0x01, 0xc1, 0x00, 
+0x0b, 0x0f, 0x0f, 0x0c, 0x0c, 0x03, 0x09, 0x09, 0x0c, 0x0c, 0x0f, 0x07, 0x07, 0x91, 0x00, 0x0b, 
+0x20, 0x04, 0x20, 0x00, 0x00, 0x80, 0x40, 0x48, 0x10, 0x00, 0x00, 0x80, 0xef, 0x00, 0x06, 0x80, 
+0x00, 0x40, 0x00, 0x28, 0x08, 0x01, 0x81, 0x00, 0x06, 0x10, 0x48, 0x20, 0x10, 0x00, 0x00, 0x08, 
+0x84, 0x00, 0x01, 0x80, 0x20, 0x8f, 0x00, 0x06, 0x10, 0x38, 0x3f, 0x37, 0x3e, 0x3e, 0x0e, 0xc3, 
+0x00, 0x00, 0x48, 0x88, 0x00, 0x00, 0x20, 0x82, 0x00, 0x01, 0x10, 0x10, 0x8c, 0x00, 0x01, 0x20, 
+0x44, 0x80, 0x00, 0x00, 0x20, 0x80, 0x00, 0x02, 0x88, 0x40, 0x40, 0xb0, 0x00, 0x07, 0x1e, 0x3e, 
+0x77, 0xe7, 0xee, 0x7c, 0x38, 0x10, 0x8b, 0x00, 0x00, 0x10, 0x99, 0x00, 0x01, 0x40, 0x40, 0x8e, 
+0x00, 0x05, 0x41, 0x42, 0x08, 0x00, 0x00, 0xb0, 0x80, 0x00, 0x04, 0xcc, 0x00, 0x40, 0x50, 0x10, 
+0x82, 0x00, 0x00, 0x40, 0xb9, 0x00, 0x03, 0x10, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x80, 0x86, 
+0x00, 0x00, 0x01, 0x80, 0x00, 0x81, 0x01, 0x81, 0x00, 0x03, 0x01, 0x00, 0x01, 0x01, 0x80, 0x00, 
+0x07, 0x40, 0x00, 0x22, 0x01, 0x00, 0x00, 0x40, 0x80, 0x81, 0x00, 0x02, 0x80, 0x40, 0x42, 0x80, 
+0x00, 0x04, 0x40, 0x00, 0x81, 0x80, 0x80, 0x81, 0x00, 0x01, 0x80, 0x40, 0x80, 0x00, 0x01, 0x01, 
+0x14, 0x86, 0x00, 0x81, 0x80, 0xad, 0x00, 0x03, 0x10, 0x02, 0x60, 0x04, 0x8c, 0x00, 0x02, 0x10, 
+0x10, 0x00, 0x81, 0x10, 0x01, 0x00, 0x10, 0x80, 0x00, 0x11, 0x04, 0x10, 0x80, 0x10, 0x00, 0x00, 
+0x80, 0x01, 0x00, 0x04, 0x44, 0x01, 0x01, 0x04, 0x04, 0x02, 0x00, 0x01, 0x80, 0x00, 0x0a, 0x02, 
+0x02, 0x00, 0x00, 0x04, 0x05, 0x05, 0x04, 0x20, 0x02, 0x01, 0x80, 0x00, 0x05, 0x84, 0x00, 0x00, 
+0x08, 0x00, 0x90, 0x80, 0x00, 0x05, 0x1f, 0x1f, 0x19, 0x1d, 0x1f, 0x03, 0xac, 0x00, 0x00, 0x80, 
+0x8e, 0x00, 0x01, 0x04, 0x0a, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x02, 0x00, 0x04, 0x00, 
+0x01, 0x08, 0x08, 0x81, 0x00, 0x01, 0x40, 0x20, 0x81, 0x00, 0x0c, 0x50, 0x10, 0x40, 0x00, 0x00, 
+0x08, 0x00, 0x00, 0x10, 0x04, 0x00, 0x08, 0x02, 0x81, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0x97, 
+0x00, 0x01, 0x89, 0x00, 0x01, 0x80, 0x80, 0x80, 0xc0, 0x03, 0xe0, 0x60, 0xe0, 0xc0, 0xf4, 0x00, 
+0x01, 0x0f, 0x0f, 0x80, 0x0c, 0x03, 0x06, 0x06, 0x03, 0x03, 0x96, 0x00, 0x05, 0x40, 0x00, 0x08, 
+0x00, 0x00, 0x48, 0xf3, 0x00, 0x00, 0x80, 0x80, 0x00, 0x0c, 0x20, 0x0a, 0x00, 0x40, 0x00, 0x08, 
+0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x04, 0x87, 0x00, 0x08, 0x40, 0x88, 0x7c, 0xfc, 0x6c, 0x66, 
+0x36, 0x3e, 0x3e, 0xd6, 0x00, 0x00, 0x04, 0x82, 0x00, 0x03, 0x10, 0x00, 0x00, 0x20, 0x80, 0x00, 
+0x02, 0x02, 0x00, 0x10, 0x8d, 0x00, 0x01, 0x20, 0x44, 0x80, 0x00, 0x09, 0x20, 0x00, 0x00, 0x08, 
+0x04, 0x40, 0x44, 0x0c, 0x10, 0x40, 0x94, 0x00, 0x08, 0x0e, 0x3e, 0x3e, 0x36, 0x36, 0x16, 0x3e, 
+0x1e, 0x18, 0x8d, 0x00, 0x07, 0x1e, 0x3e, 0x77, 0xe7, 0xee, 0x7c, 0x38, 0x10, 0x84, 0x00, 0x09, 
+0x0c, 0x0e, 0x1f, 0x1f, 0x36, 0x7e, 0x7c, 0x1c, 0x00, 0x22, 0x96, 0x00, 0x80, 0x40, 0x83, 0x00, 
+0x00, 0x01, 0x81, 0x00, 0x00, 0x80, 0x80, 0x00, 0x0f, 0x10, 0x50, 0x11, 0x40, 0x08, 0x00, 0x02, 
+0x10, 0x00, 0x01, 0x00, 0x84, 0x00, 0x40, 0x40, 0x50, 0x80, 0x00, 0x04, 0xa0, 0x20, 0x40, 0x00, 
+0x80, 0xb9, 0x00, 0x02, 0x04, 0x90, 0x20, 0x80, 0x00, 0x00, 0x80, 0x88, 0x00, 0x01, 0x01, 0x01, 
+0x80, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0x40, 0x08, 0x00, 0x01, 0x87, 
+0x00, 0x00, 0x02, 0x82, 0x00, 0x02, 0x81, 0x80, 0x80, 0x82, 0x00, 0x05, 0x40, 0x00, 0x00, 0x04, 
+0x81, 0x30, 0x86, 0x00, 0x81, 0x80, 0xad, 0x00, 0x02, 0x20, 0x02, 0x80, 0x90, 0x00, 0x01, 0x10, 
+0x10, 0x80, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x10, 0x80, 0x00, 0x05, 0x08, 0x80, 0x00, 0x00, 
+0x04, 0x40, 0x87, 0x00, 0x01, 0x02, 0x02, 0x80, 0x00, 0x09, 0x04, 0x04, 0x00, 0x20, 0x00, 0x00, 
+0x40, 0x00, 0x00, 0x80, 0x85, 0x00, 0x05, 0x1f, 0x1f, 0x19, 0x1d, 0x1f, 0x03, 0xab, 0x00, 0x00, 
+0x10, 0x8f, 0x00, 0x03, 0x04, 0x02, 0x08, 0x08, 0x84, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x02, 
+0x00, 0x01, 0x04, 0x40, 0x82, 0x00, 0x0a, 0x40, 0x00, 0x50, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 
+0x01, 0x01, 0x80, 0x00, 0x06, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x97, 0x00, 0x01, 0xff, 
+0x00, 0x90, 0x00, 0x00, 0x80, 0x80, 0xc0, 0x01, 0x80, 0x80, 0x8e, 0x00, 0x0b, 0x20, 0x04, 0x60, 
+0x00, 0x08, 0x80, 0x40, 0x00, 0x10, 0x00, 0x00, 0x80, 0xd9, 0x00, 0x07, 0x04, 0x07, 0x0f, 0x0c, 
+0x18, 0x0f, 0x07, 0x03, 0x8d, 0x00, 0x0f, 0x40, 0x00, 0x08, 0x02, 0x01, 0x40, 0x00, 0x08, 0x00, 
+0x00, 0x48, 0xa0, 0x10, 0x00, 0x04, 0x08, 0x84, 0x00, 0x0a, 0x80, 0x20, 0x40, 0x88, 0x7c, 0xfc, 
+0x6c, 0x66, 0x36, 0x3e, 0x3e, 0xd3, 0x00, 0x03, 0x48, 0x00, 0x00, 0x04, 0x82, 0x00, 0x00, 0x10, 
+0x83, 0x00, 0x03, 0x02, 0x00, 0x00, 0x10, 0x94, 0x00, 0x06, 0x08, 0x8c, 0x00, 0x04, 0x0c, 0x10, 
+0x40, 0x94, 0x00, 0x08, 0x0e, 0x3e, 0x3e, 0x36, 0x36, 0x16, 0x3e, 0x1e, 0x18, 0x8f, 0x00, 0x06, 
+0x18, 0xf8, 0xcc, 0x9c, 0xf8, 0xf0, 0x80, 0x83, 0x00, 0x09, 0x0c, 0x0e, 0x1f, 0x1f, 0x36, 0x7e, 
+0x7c, 0x0c, 0x00, 0x22, 0x96, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x80, 
+0x80, 0x00, 0x0f, 0x10, 0x50, 0x50, 0x02, 0x00, 0x00, 0x02, 0xa0, 0x00, 0x01, 0x00, 0x48, 0x00, 
+0x00, 0x10, 0x40, 0x80, 0x00, 0x0d, 0xa0, 0x20, 0x00, 0x00, 0x80, 0x00, 0xc0, 0xc0, 0x40, 0x60, 
+0x70, 0x30, 0xf0, 0xc0, 0x9c, 0x00, 0x80, 0x03, 0x00, 0x01, 0x8b, 0x00, 0x04, 0x10, 0x00, 0x04, 
+0x80, 0x20, 0x8a, 0x00, 0x01, 0x01, 0x00, 0x82, 0x01, 0x82, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 
+0x00, 0x01, 0x08, 0x22, 0x80, 0x00, 0x01, 0x40, 0x80, 0x81, 0x00, 0x02, 0x80, 0x40, 0x40, 0x80, 
+0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x80, 0x80, 0x00, 0x06, 0x04, 0x80, 0x24, 0x01, 0x03, 0x07, 
+0x02, 0x80, 0x03, 0x00, 0x01, 0xb2, 0x00, 0x03, 0x30, 0x00, 0xe0, 0x04, 0x8c, 0x00, 0x01, 0x10, 
+0x10, 0x80, 0x00, 0x01, 0x10, 0x10, 0x82, 0x00, 0x11, 0x04, 0x00, 0x80, 0x10, 0x00, 0x08, 0x00, 
+0x01, 0x00, 0x00, 0x04, 0x01, 0x01, 0x04, 0x04, 0x02, 0x00, 0x01, 0x84, 0x00, 0x0a, 0x04, 0x01, 
+0x01, 0x04, 0x00, 0x02, 0x01, 0x40, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x80, 0xb4, 0x00, 0x01, 
+0x10, 0x80, 0x8f, 0x00, 0x80, 0x08, 0x02, 0x00, 0x00, 0x01, 0x81, 0x00, 0x0f, 0x01, 0x00, 0x00, 
+0x02, 0x00, 0x04, 0x00, 0x01, 0x08, 0x08, 0x02, 0x00, 0x01, 0x04, 0x00, 0x20, 0x81, 0x00, 0x80, 
+0x10, 0x83, 0x00, 0x05, 0x05, 0x01, 0x08, 0x02, 0x00, 0x01, 0x9d, 0x00
+};
+
+const uint32_t PROGMEM frameOffsets[] = {
+0, 339, 650, 976, 1305, 1662, 2013, 2374, 2712, 3045, 3390, 3732, 
+4074, 4417, 4750
+};
+
+// Display time of each frame in ms
+const uint16_t PROGMEM frameDurations[] = {
+80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 
+80, 80, 80
+};
+
+const FramePack clip = { 128, 64, 15, frameOffsets, frameData, frameDurations, FRAME_LAYOUT_PAGES };
+
+} // namespace cake
+
+#endif
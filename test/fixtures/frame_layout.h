@@ -0,0 +1,33 @@
+#ifndef FRAME_LAYOUT_FIXTURE_H
+#define FRAME_LAYOUT_FIXTURE_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Reference conversion from image2cpp row order (8 horizontal pixels per
+// byte, MSB = left) to SSD1306 page order (8 vertical pixels, LSB = top),
+// written pixel by pixel so it can check the optimized paths
+static void rowsToPages(const uint8_t* rows, uint8_t* pages, int width = 128, int height = 64) {
+    memset(pages, 0, (size_t)width * height / 8);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (rows[y * (width / 8) + x / 8] & (0x80 >> (x & 7))) {
+                pages[(y / 8) * width + x] |= 1 << (y & 7);
+            }
+        }
+    }
+}
+
+// And back, for comparing decoded frames with row-order references
+static void pagesToRows(const uint8_t* pages, uint8_t* rows, int width = 128, int height = 64) {
+    memset(rows, 0, (size_t)width * height / 8);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (pages[(y / 8) * width + x] & (1 << (y & 7))) {
+                rows[y * (width / 8) + x / 8] |= 0x80 >> (x & 7);
+            }
+        }
+    }
+}
+
+#endif
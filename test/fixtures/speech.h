@@ -0,0 +1,180 @@
+#ifndef SPEECH_FIXTURE_H
+#define SPEECH_FIXTURE_H
+
+#include <math.h>
+#include <stdint.h>
+#include <initializer_list>
+#include <vector>
+
+// Labelled speech/noise audio for the audio tests, synthesized so every
+// run (and every host) gets the same samples and exact ground truth.
+//
+// Talk is built like voiced speech: a glottal pulse train with a gliding
+// pitch, shaped by two formant resonators into ~180ms syllables, each led
+// by a short unvoiced fricative burst and separated by 80ms pauses. Under
+// everything runs a hiss floor; NOISE parts add louder low-passed noise
+// (a fan, traffic) that must not count as speech.
+//
+//   LabelledAudio a = speechFixture(16000, {
+//       { 500, PART_QUIET, 0 }, { 1200, PART_TALK, 8000 }, { 700, PART_QUIET, 0 } });
+//
+// Every part's length is in ms; TALK fills it with whole syllables (one
+// pause-fricative-vowel cycle is 290ms) at the given peak amplitude, NOISE
+// with noise at the given RMS.
+
+enum PartKind { PART_QUIET, PART_TALK, PART_NOISE };
+
+struct Part {
+    uint32_t ms;
+    PartKind kind;
+    int level;
+};
+
+struct Span {
+    uint32_t startMs;
+    uint32_t endMs;
+};
+
+struct LabelledAudio {
+    uint32_t rate;
+    std::vector<int16_t> pcm;
+    std::vector<Span> talk;       // Utterances: first fricative to last vowel end
+    std::vector<Span> syllables;  // Voiced vowels inside them
+
+    uint32_t ms() const { return (uint32_t)((uint64_t)pcm.size() * 1000 / rate); }
+
+    static bool within(const std::vector<Span>& spans, uint32_t ms) {
+        for (const Span& s : spans) {
+            if (ms >= s.startMs && ms < s.endMs) return true;
+        }
+        return false;
+    }
+};
+
+static const uint32_t SYLLABLE_PAUSE_MS = 80;
+static const uint32_t SYLLABLE_FRICATIVE_MS = 30;
+static const uint32_t SYLLABLE_VOWEL_MS = 180;
+static const uint32_t SYLLABLE_MS = SYLLABLE_PAUSE_MS + SYLLABLE_FRICATIVE_MS + SYLLABLE_VOWEL_MS;
+
+// Deterministic noise: LCG, roughly Gaussian from four uniforms
+struct FixtureNoise {
+    uint32_t state;
+    explicit FixtureNoise(uint32_t seed) : state(seed) {}
+    double uniform() {
+        state = state * 1664525u + 1013904223u;
+        return (state >> 8) / 16777216.0 - 0.5;
+    }
+    double gauss() { return (uniform() + uniform() + uniform() + uniform()) * 1.732; }
+};
+
+// Two-pole resonator at `hz`
+struct Resonator {
+    double a1, a2, y1, y2;
+    Resonator(double hz, double bandwidth, uint32_t rate) : y1(0), y2(0) {
+        double r = exp(-M_PI * bandwidth / rate);
+        a1 = 2 * r * cos(2 * M_PI * hz / rate);
+        a2 = -r * r;
+    }
+    double step(double x) {
+        double y = x + a1 * y1 + a2 * y2;
+        y2 = y1;
+        y1 = y;
+        return y;
+    }
+};
+
+static void addSyllable(std::vector<double>& out, size_t start, uint32_t rate, int peak,
+                        int index, FixtureNoise& noise) {
+    // Fricative: differentiated (high-passed) noise
+    size_t fric = (size_t)rate * SYLLABLE_FRICATIVE_MS / 1000;
+    double prev = 0;
+    for (size_t i = 0; i < fric; i++) {
+        double w = noise.gauss();
+        double env = sin(M_PI * i / fric);
+        out[start + i] += (w - prev) * peak * 0.06 * env;
+        prev = w;
+    }
+
+    // Vowel: pulse train through F1/F2, vowel colour changing per syllable
+    static const double F1[4] = { 700, 400, 550, 300 };
+    static const double F2[4] = { 1200, 2000, 1700, 900 };
+    size_t n = (size_t)rate * SYLLABLE_VOWEL_MS / 1000;
+    size_t at = start + fric;
+    Resonator r1(F1[index & 3], 90, rate);
+    Resonator r2(F2[index & 3], 120, rate);
+    std::vector<double> v(n);
+    double phase = 1;
+    double maxAbs = 0;
+    for (size_t i = 0; i < n; i++) {
+        double t = (double)i / rate;
+        double f0 = 110 + 40 * (index % 3) + 30 * sin(2 * M_PI * 3 * t);
+        phase += f0 / rate;
+        double pulse = 0;
+        if (phase >= 1) {
+            phase -= 1;
+            pulse = 1;
+        }
+        v[i] = r1.step(pulse) + 0.5 * r2.step(pulse);
+        if (fabs(v[i]) > maxAbs) maxAbs = fabs(v[i]);
+    }
+    for (size_t i = 0; i < n; i++) {
+        // Quick attack and release, flat-ish middle
+        double env = sin(M_PI * i / n);
+        env = sqrt(env);
+        out[at + i] += v[i] / maxAbs * peak * env;
+    }
+}
+
+static LabelledAudio speechFixture(uint32_t rate, std::initializer_list<Part> parts,
+                                   int hissRms = 40, uint32_t seed = 1) {
+    LabelledAudio a;
+    a.rate = rate;
+    uint32_t totalMs = 0;
+    for (const Part& p : parts) totalMs += p.ms;
+    std::vector<double> out((size_t)rate * totalMs / 1000, 0.0);
+    FixtureNoise noise(seed);
+
+    uint32_t ms = 0;
+    int syllable = 0;
+    for (const Part& p : parts) {
+        size_t start = (size_t)rate * ms / 1000;
+        size_t n = (size_t)rate * p.ms / 1000;
+        if (p.kind == PART_TALK) {
+            Span utterance = { ms + SYLLABLE_PAUSE_MS, ms + SYLLABLE_PAUSE_MS };
+            for (uint32_t s = 0; s + SYLLABLE_MS <= p.ms; s += SYLLABLE_MS) {
+                uint32_t at = ms + s + SYLLABLE_PAUSE_MS;
+                addSyllable(out, (size_t)rate * at / 1000, rate, p.level, syllable++, noise);
+                uint32_t vowel = at + SYLLABLE_FRICATIVE_MS;
+                a.syllables.push_back(Span{ vowel, vowel + SYLLABLE_VOWEL_MS });
+                utterance.endMs = vowel + SYLLABLE_VOWEL_MS;
+            }
+            a.talk.push_back(utterance);
+        } else if (p.kind == PART_NOISE) {
+            // One-pole low-pass: rumbly, like a fan
+            double lp = 0;
+            for (size_t i = 0; i < n; i++) {
+                lp += 0.2 * (noise.gauss() - lp);
+                out[start + i] += lp * p.level * 3.0;   // Low-pass keeps 1/9 of the power
+            }
+        }
+        ms += p.ms;
+    }
+
+    a.pcm.resize(out.size());
+    for (size_t i = 0; i < out.size(); i++) {
+        double s = out[i] + noise.gauss() * hissRms;
+        if (s > 32767) s = 32767;
+        if (s < -32768) s = -32768;
+        a.pcm[i] = (int16_t)lrint(s);
+    }
+    return a;
+}
+
+// RMS of pcm[from, to) in samples
+static inline double fixtureRms(const std::vector<int16_t>& pcm, size_t from, size_t to) {
+    double sum = 0;
+    for (size_t i = from; i < to; i++) sum += (double)pcm[i] * pcm[i];
+    return to > from ? sqrt(sum / (to - from)) : 0;
+}
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef TEST_SUPPORT_ARDUINO_H
+#define TEST_SUPPORT_ARDUINO_H
+
+// Host stand-in for the few parts of the Arduino core that the modules
+// under test use (String, Stream). Only on the native test include path.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <string>
+
+class String {
+public:
+    String(const char* text = "") : _s(text) {}
+    const char* c_str() const { return _s.c_str(); }
+    unsigned int length() const { return (unsigned int)_s.size(); }
+    String operator+(const String& other) const { return String(_s + other._s); }
+    String operator+(const char* other) const { return String(_s + other); }
+    bool operator==(const String& other) const { return _s == other._s; }
+
+private:
+    explicit String(const std::string& s) : _s(s) {}
+    std::string _s;
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t) = 0;
+    virtual void flush() {}
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    // The core reads byte by byte with a timeout; memory never waits
+    virtual size_t readBytes(char* buffer, size_t length) {
+        size_t n = 0;
+        int c;
+        while (n < length && (c = read()) >= 0) buffer[n++] = (char)c;
+        return n;
+    }
+    virtual size_t readBytes(uint8_t* buffer, size_t length) { return readBytes((char*)buffer, length); }
+};
+
+#endif
@@ -0,0 +1,157 @@
+#include <unity.h>
+#include <string.h>
+#include <vector>
+
+#include "AudioDecoder.h"
+
+// Reads a whole message through the AudioDecoder interface, `block` at a time
+static std::vector<int16_t> drain(AudioDecoder& d, size_t block) {
+    std::vector<int16_t> out;
+    int16_t buf[256];
+    size_t n;
+    while ((n = d.read(buf, block)) > 0) out.insert(out.end(), buf, buf + n);
+    return out;
+}
+
+// A stand-in for an application decoder: one sample per byte
+class ByteDecoder : public AudioDecoder {
+public:
+    ByteDecoder() : resets(0), _data(NULL), _left(0) {}
+    AudioCodec codec() const { return CODEC_PCM16; }
+    bool begin(const uint8_t* data, size_t length) {
+        _data = data;
+        _left = length;
+        return length > 0;
+    }
+    size_t read(int16_t* out, size_t maxSamples) {
+        size_t n = _left < maxSamples ? _left : maxSamples;
+        for (size_t i = 0; i < n; i++) out[i] = (int16_t)(*_data++ * 100);
+        _left -= n;
+        return n;
+    }
+    void reset() {
+        _left = 0;
+        resets++;
+    }
+    int resets;
+
+private:
+    const uint8_t* _data;
+    size_t _left;
+};
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_pcm_reads_unaligned_little_endian(void) {
+    // Payload starts at an odd address, as it can inside a WebSocket frame
+    uint8_t frame[1 + 2 * 300 + 1];
+    for (int i = 0; i < 300; i++) {
+        int16_t s = (int16_t)(i * 211 - 30000);
+        frame[1 + 2 * i] = (uint8_t)(s & 0xFF);
+        frame[2 + 2 * i] = (uint8_t)((uint16_t)s >> 8);
+    }
+    PcmDecoder d;
+    TEST_ASSERT_TRUE(d.begin(frame + 1, 2 * 300 + 1));   // Odd trailing byte dropped
+    std::vector<int16_t> out = drain(d, 77);
+    TEST_ASSERT_EQUAL(300, out.size());
+    for (int i = 0; i < 300; i++) TEST_ASSERT_EQUAL_INT16((int16_t)(i * 211 - 30000), out[i]);
+
+    TEST_ASSERT_FALSE(d.begin(frame, 1));
+    TEST_ASSERT_EQUAL(0, drain(d, 64).size());
+}
+
+void test_adpcm_through_the_interface(void) {
+    int16_t pcm[480];
+    for (int i = 0; i < 480; i++) pcm[i] = (int16_t)((i % 48) * 400 - 9600);
+    ImaAdpcmEncoder enc;
+    uint8_t block[4 + 240];
+    size_t bytes = enc.encodeBlock(pcm, 480, block);
+    int16_t whole[480];
+    ImaAdpcmDecoder::decodeBlock(block, bytes, whole);
+
+    ImaAdpcmBlockDecoder d;
+    AudioDecoder& a = d;
+    TEST_ASSERT_EQUAL(CODEC_IMA_ADPCM, a.codec());
+    TEST_ASSERT_TRUE(a.begin(block, bytes));
+    std::vector<int16_t> out = drain(a, 100);
+    TEST_ASSERT_EQUAL(480, out.size());
+    TEST_ASSERT_EQUAL_INT16_ARRAY(whole, out.data(), 480);
+
+    block[2] = 99;
+    TEST_ASSERT_FALSE(a.begin(block, bytes));
+    TEST_ASSERT_EQUAL(0, drain(a, 100).size());
+}
+
+void test_reset_drops_a_message_part_way(void) {
+    uint8_t raw[200] = { 0 };
+    PcmDecoder p;
+    p.begin(raw, sizeof(raw));
+    int16_t buf[10];
+    TEST_ASSERT_EQUAL(10, p.read(buf, 10));
+    p.reset();
+    TEST_ASSERT_EQUAL(0, p.read(buf, 10));
+
+    uint8_t block[4 + 50] = { 0 };
+    ImaAdpcmBlockDecoder a;
+    a.begin(block, sizeof(block));
+    TEST_ASSERT_EQUAL(10, a.read(buf, 10));
+    a.reset();
+    TEST_ASSERT_EQUAL(0, a.read(buf, 10));
+}
+
+void test_server_switches_built_in_decoders(void) {
+    DownlinkDecoders decoders;
+    TEST_ASSERT_FALSE(decoders.custom());
+    TEST_ASSERT_EQUAL(CODEC_PCM16, decoders.current()->codec());
+
+    // A PCM message half read when CODEC:ima_adpcm arrives, then back again:
+    // the PCM decoder must not carry on with the old message
+    uint8_t raw[100] = { 0 };
+    int16_t buf[10];
+    decoders.current()->begin(raw, sizeof(raw));
+    decoders.current()->read(buf, 10);
+    TEST_ASSERT_TRUE(decoders.select(CODEC_IMA_ADPCM));
+    TEST_ASSERT_EQUAL(CODEC_IMA_ADPCM, decoders.current()->codec());
+    TEST_ASSERT_TRUE(decoders.select(CODEC_PCM16));
+    TEST_ASSERT_EQUAL(CODEC_PCM16, decoders.current()->codec());
+    TEST_ASSERT_EQUAL(0, decoders.current()->read(buf, 10));
+}
+
+void test_custom_decoder_is_not_replaced(void) {
+    DownlinkDecoders decoders;
+    ByteDecoder mine;
+    decoders.setCustom(&mine);
+    TEST_ASSERT_TRUE(decoders.custom());
+    TEST_ASSERT_TRUE(decoders.current() == &mine);
+    TEST_ASSERT_EQUAL(1, mine.resets);
+
+    // CODEC: from the server is refused while the application's decoder is set
+    TEST_ASSERT_FALSE(decoders.select(CODEC_IMA_ADPCM));
+    TEST_ASSERT_FALSE(decoders.select(CODEC_PCM16));
+    TEST_ASSERT_TRUE(decoders.current() == &mine);
+    TEST_ASSERT_EQUAL(1, mine.resets);
+
+    uint8_t bytes[3] = { 1, 2, 3 };
+    TEST_ASSERT_TRUE(decoders.current()->begin(bytes, 3));
+    std::vector<int16_t> out = drain(*decoders.current(), 2);
+    TEST_ASSERT_EQUAL(3, out.size());
+    TEST_ASSERT_EQUAL_INT16(300, out[2]);
+
+    // Clearing it hands control back to the server
+    decoders.setCustom(NULL);
+    TEST_ASSERT_FALSE(decoders.custom());
+    TEST_ASSERT_EQUAL(CODEC_PCM16, decoders.current()->codec());
+    TEST_ASSERT_TRUE(decoders.select(CODEC_IMA_ADPCM));
+    TEST_ASSERT_EQUAL(CODEC_IMA_ADPCM, decoders.current()->codec());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_pcm_reads_unaligned_little_endian);
+    RUN_TEST(test_adpcm_through_the_interface);
+    RUN_TEST(test_reset_drops_a_message_part_way);
+    RUN_TEST(test_server_switches_built_in_decoders);
+    RUN_TEST(test_custom_decoder_is_not_replaced);
+    return UNITY_END();
+}
@@ -0,0 +1,158 @@
+#include <unity.h>
+#include <stdint.h>
+
+#include "AudioEnvelope.h"
+#include "../fixtures/speech.h"
+
+static const uint32_t RATE = 24000;   // Reply audio rate
+
+// Feeds `a` the way the player does: 1024-sample chunks written about
+// `leadMs` before they are heard. Returns level() for every ms of playback.
+static std::vector<int16_t> playThrough(AudioEnvelope& env, const LabelledAudio& a, uint32_t leadMs = 100) {
+    std::vector<int16_t> levels;
+    size_t pos = 0;
+    for (uint32_t ms = 0; ms < a.ms(); ms++) {
+        while (pos < a.pcm.size() && pos * 1000 / RATE < ms + leadMs) {
+            size_t n = a.pcm.size() - pos < 1024 ? a.pcm.size() - pos : 1024;
+            env.push(&a.pcm[pos], n, (uint32_t)(pos * 1000 / RATE));
+            pos += n;
+        }
+        levels.push_back(env.level(ms));
+    }
+    return levels;
+}
+
+static bool nearVowel(const LabelledAudio& a, uint32_t ms, uint32_t margin) {
+    for (const Span& s : a.syllables) {
+        if (ms + margin >= s.startMs && ms < s.endMs + margin) return true;
+    }
+    return false;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_isqrt_is_exact_floor(void) {
+    const uint64_t values[] = { 0, 1, 2, 3, 4, 15, 16, 17, 1073741824ull, 999999999999ull,
+                                (uint64_t)32768 * 32768, 0xFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull };
+    for (uint64_t v : values) {
+        uint64_t r = AudioEnvelope::isqrt(v);
+        TEST_ASSERT_TRUE(r * r <= v);
+        TEST_ASSERT_TRUE((r + 1) * (r + 1) > v || r == 0xFFFFFFFFull);
+    }
+    // Sums of squares up to 20ms of full-scale 48kHz audio, and beyond
+    uint64_t v = 1;
+    for (int i = 0; i < 100000; i++) {
+        v = v * 6364136223846793005ull + 1442695040888963407ull;
+        uint64_t x = v >> (i % 30);
+        uint64_t r = AudioEnvelope::isqrt(x);
+        TEST_ASSERT_TRUE(r * r <= x && ((r + 1) * (r + 1) > x || r == 0xFFFFFFFFull));
+    }
+}
+
+void test_no_audio_means_no_level(void) {
+    AudioEnvelope env;
+    env.begin(RATE);
+    TEST_ASSERT_EQUAL_INT16(-1, env.level(0));
+    // Hiss only: the gate keeps the mouth shut
+    LabelledAudio a = speechFixture(RATE, { { 1000, PART_QUIET, 0 } }, 60);
+    std::vector<int16_t> levels = playThrough(env, a);
+    for (uint32_t ms = 50; ms < levels.size(); ms++) TEST_ASSERT_EQUAL_INT16(0, levels[ms]);
+}
+
+void test_mouth_follows_syllables(void) {
+    AudioEnvelope env;
+    env.begin(RATE);
+    LabelledAudio a = speechFixture(RATE, { { 300, PART_QUIET, 0 }, { 2400, PART_TALK, 9000 },
+                                            { 500, PART_QUIET, 0 } });
+    std::vector<int16_t> levels = playThrough(env, a);
+
+    for (const Span& s : a.syllables) {
+        // Wide open through the middle of every vowel
+        uint32_t len = s.endMs - s.startMs;
+        for (uint32_t ms = s.startMs + len / 4; ms < s.endMs - len / 4; ms++) {
+            TEST_ASSERT_GREATER_THAN(60, levels[ms]);
+        }
+        // Opens within two 20ms blocks of the vowel, but not before the fricative
+        uint32_t opened = s.startMs - SYLLABLE_FRICATIVE_MS;
+        while (opened < s.endMs && levels[opened] == 0) opened++;
+        TEST_ASSERT_LESS_OR_EQUAL(s.startMs + 40, opened);
+        TEST_ASSERT_GREATER_OR_EQUAL(s.startMs - SYLLABLE_FRICATIVE_MS, opened);
+    }
+    // Shut in the pauses between syllables and after the last one
+    int shut = 0;
+    for (uint32_t ms = 50; ms < levels.size(); ms++) {
+        if (nearVowel(a, ms, 40)) continue;
+        TEST_ASSERT_EQUAL_INT16(0, levels[ms]);
+        shut++;
+    }
+    TEST_ASSERT_GREATER_THAN(700, shut);
+}
+
+void test_quiet_voice_uses_the_whole_mouth(void) {
+    // Same speech 12dB down: normalized to its own peak, so after a
+    // second the mouth opens about as wide as for the loud voice
+    LabelledAudio loud = speechFixture(RATE, { { 300, PART_QUIET, 0 }, { 3000, PART_TALK, 16000 } });
+    LabelledAudio quiet = speechFixture(RATE, { { 300, PART_QUIET, 0 }, { 3000, PART_TALK, 4000 } });
+    AudioEnvelope a, b;
+    a.begin(RATE);
+    b.begin(RATE);
+    std::vector<int16_t> la = playThrough(a, loud);
+    std::vector<int16_t> lb = playThrough(b, quiet);
+
+    long sumA = 0, sumB = 0;
+    for (const Span& s : loud.syllables) {
+        if (s.startMs < 1300) continue;
+        for (uint32_t ms = s.startMs; ms < s.endMs; ms++) {
+            sumA += la[ms];
+            sumB += lb[ms];
+        }
+    }
+    TEST_ASSERT_GREATER_THAN(sumA * 3 / 4, sumB);
+}
+
+void test_gaps_in_the_stream_close_the_mouth(void) {
+    AudioEnvelope env;
+    env.begin(RATE);
+    LabelledAudio a = speechFixture(RATE, { { 300, PART_TALK, 9000 } });
+    env.push(a.pcm.data(), a.pcm.size(), 1000);
+    // Before the audio is heard, and after it is over
+    TEST_ASSERT_EQUAL_INT16(0, env.level(990));
+    TEST_ASSERT_GREATER_THAN(0, env.level(1000 + a.syllables[0].startMs + 60));
+    TEST_ASSERT_EQUAL_INT16(0, env.level(1400));
+
+    // Wraps with the millisecond clock
+    env.reset();
+    env.push(a.pcm.data(), a.pcm.size(), 0xFFFFFF00u);
+    TEST_ASSERT_GREATER_THAN(0, env.level(0xFFFFFF00u + a.syllables[0].startMs + 60));
+}
+
+void test_deep_queue_keeps_every_block(void) {
+    // Written up to 4s ahead, as with a full PSRAM jitter queue: the first
+    // syllables are still moving the mouth when they are finally heard
+    AudioEnvelope env;
+    env.begin(RATE);
+    LabelledAudio a = speechFixture(RATE, { { 300, PART_QUIET, 0 }, { 5000, PART_TALK, 9000 } });
+    std::vector<int16_t> levels = playThrough(env, a, 4000);
+
+    int syllables = 0;
+    for (const Span& s : a.syllables) {
+        uint32_t len = s.endMs - s.startMs;
+        for (uint32_t ms = s.startMs + len / 4; ms < s.endMs - len / 4; ms++) {
+            TEST_ASSERT_GREATER_THAN(60, levels[ms]);
+        }
+        syllables++;
+    }
+    TEST_ASSERT_GREATER_THAN(10, syllables);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_isqrt_is_exact_floor);
+    RUN_TEST(test_no_audio_means_no_level);
+    RUN_TEST(test_mouth_follows_syllables);
+    RUN_TEST(test_quiet_voice_uses_the_whole_mouth);
+    RUN_TEST(test_gaps_in_the_stream_close_the_mouth);
+    RUN_TEST(test_deep_queue_keeps_every_block);
+    return UNITY_END();
+}
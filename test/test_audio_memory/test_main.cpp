@@ -0,0 +1,85 @@
+#include <unity.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "AudioMemory.h"
+
+// The host build has one heap, accounted as internal RAM. The counters
+// are process-wide, so each test works from where the last one left them.
+static const AudioMemory::Pool POOL = AudioMemory::POOL_INTERNAL;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_alloc_and_release_are_accounted(void) {
+    size_t before = AudioMemory::used(POOL);
+    void* a = AudioMemory::alloc(1000);
+    void* b = AudioMemory::alloc(24, AUDIO_MEM_FAST);
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_NOT_NULL(b);
+    TEST_ASSERT_EQUAL(before + 1024, AudioMemory::used(POOL));
+    TEST_ASSERT_EQUAL(0, AudioMemory::used(AudioMemory::POOL_PSRAM));
+
+    // Usable, and aligned for any sample type
+    TEST_ASSERT_EQUAL(0, (uintptr_t)a % 8);
+    TEST_ASSERT_EQUAL(0, (uintptr_t)b % 8);
+    memset(a, 0x55, 1000);
+    memset(b, 0xAA, 24);
+
+    AudioMemory::release(a);
+    TEST_ASSERT_EQUAL(before + 24, AudioMemory::used(POOL));
+    AudioMemory::release(b);
+    TEST_ASSERT_EQUAL(before, AudioMemory::used(POOL));
+}
+
+void test_peak_is_the_high_water_mark(void) {
+    size_t base = AudioMemory::used(POOL);
+    void* a = AudioMemory::alloc(50000);
+    void* b = AudioMemory::alloc(30000);
+    size_t high = AudioMemory::used(POOL);
+    TEST_ASSERT_EQUAL(base + 80000, high);
+    TEST_ASSERT_GREATER_OR_EQUAL(high, AudioMemory::peak(POOL));
+
+    // Freeing does not lower it, and a smaller buffer later does not move it
+    AudioMemory::release(a);
+    AudioMemory::release(b);
+    size_t peak = AudioMemory::peak(POOL);
+    void* c = AudioMemory::alloc(10);
+    TEST_ASSERT_EQUAL(peak, AudioMemory::peak(POOL));
+    AudioMemory::release(c);
+    TEST_ASSERT_EQUAL(base, AudioMemory::used(POOL));
+}
+
+void test_release_null_is_a_no_op(void) {
+    size_t used = AudioMemory::used(POOL);
+    uint32_t failures = AudioMemory::failures();
+    AudioMemory::release(NULL);
+    TEST_ASSERT_EQUAL(used, AudioMemory::used(POOL));
+    TEST_ASSERT_EQUAL_UINT32(failures, AudioMemory::failures());
+}
+
+void test_zero_bytes_is_still_a_block(void) {
+    size_t used = AudioMemory::used(POOL);
+    void* p = AudioMemory::alloc(0);
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_EQUAL(used, AudioMemory::used(POOL));
+    AudioMemory::release(p);
+    TEST_ASSERT_EQUAL(used, AudioMemory::used(POOL));
+}
+
+void test_fit_keeps_within_wanted_and_minimum(void) {
+    // No heap limits on the host: what is wanted, never under the minimum
+    TEST_ASSERT_EQUAL(8000, AudioMemory::fit(8000, 1000));
+    TEST_ASSERT_EQUAL(1000, AudioMemory::fit(500, 1000));
+    TEST_ASSERT_FALSE(AudioMemory::psramAvailable());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_alloc_and_release_are_accounted);
+    RUN_TEST(test_peak_is_the_high_water_mark);
+    RUN_TEST(test_release_null_is_a_no_op);
+    RUN_TEST(test_zero_bytes_is_still_a_block);
+    RUN_TEST(test_fit_keeps_within_wanted_and_minimum);
+    return UNITY_END();
+}
@@ -0,0 +1,169 @@
+#include <unity.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+
+#include "DisplayService.h"
+
+// An SSD1306 that understands the two addressing commands PageFlusher uses
+class SimBus : public OledBus {
+public:
+    uint8_t panel[OLED_BUFFER_SIZE];
+    size_t dataBytes;
+    bool yieldOften;
+
+    SimBus() : dataBytes(0), yieldOften(false), _c0(0), _c1(127), _p0(0), _p1(7), _col(0), _page(0) {
+        memset(panel, 0, sizeof(panel));
+    }
+
+    void commands(const uint8_t* cmds, size_t length) override {
+        for (size_t i = 0; i < length;) {
+            if (cmds[i] == 0x21 && i + 2 < length) {
+                _c0 = cmds[i + 1];
+                _c1 = cmds[i + 2];
+                _col = _c0;
+                i += 3;
+            } else if (cmds[i] == 0x22 && i + 2 < length) {
+                _p0 = cmds[i + 1];
+                _p1 = cmds[i + 2];
+                _page = _p0;
+                i += 3;
+            } else {
+                i++;
+            }
+        }
+    }
+
+    void data(const uint8_t* bytes, size_t length) override {
+        for (size_t i = 0; i < length; i++) {
+            panel[_page * OLED_WIDTH + _col] = bytes[i];
+            if (++_col > _c1) {
+                _col = _c0;
+                if (++_page > _p1) _page = _p0;
+            }
+            // Stretch the transfer so the renderer really runs alongside it
+            if (yieldOften && (i & 63) == 0) std::this_thread::yield();
+        }
+        dataBytes += length;
+    }
+
+private:
+    uint8_t _c0, _c1, _p0, _p1, _col, _page;
+};
+
+static bool uniform(const uint8_t* panel, uint8_t value) {
+    for (int i = 0; i < OLED_BUFFER_SIZE; i++) {
+        if (panel[i] != value) return false;
+    }
+    return true;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_nothing_to_flush_until_presented(void) {
+    SimBus bus;
+    DisplayService svc;
+    svc.begin(&bus);
+    TEST_ASSERT_FALSE(svc.flushPending());
+
+    // RENDERING: the task leaves the back buffer alone
+    memset(svc.beginFrame(), 0x11, OLED_BUFFER_SIZE);
+    TEST_ASSERT_FALSE(svc.flushPending());
+
+    svc.present();
+    TEST_ASSERT_TRUE(svc.flushPending());
+    TEST_ASSERT_TRUE(uniform(bus.panel, 0x11));
+    TEST_ASSERT_FALSE(svc.flushPending());
+    TEST_ASSERT_EQUAL_UINT32(1, svc.presentedFrames());
+    TEST_ASSERT_EQUAL_UINT32(1, svc.flushedFrames());
+    TEST_ASSERT_EQUAL_UINT32(0, svc.droppedFrames());
+}
+
+void test_newer_frame_replaces_ready_one(void) {
+    SimBus bus;
+    DisplayService svc;
+    svc.begin(&bus);
+
+    uint8_t frame[OLED_BUFFER_SIZE];
+    memset(frame, 0x22, sizeof(frame));
+    svc.submit(frame);
+    // READY but not taken yet: claiming the back buffer drops that frame
+    uint8_t* back = svc.beginFrame();
+    memset(back, 0x33, OLED_BUFFER_SIZE);
+    svc.present();
+    TEST_ASSERT_EQUAL_UINT32(1, svc.droppedFrames());
+
+    TEST_ASSERT_TRUE(svc.flushPending());
+    TEST_ASSERT_FALSE(svc.flushPending());
+    TEST_ASSERT_TRUE(uniform(bus.panel, 0x33));
+    TEST_ASSERT_EQUAL_UINT32(2, svc.presentedFrames());
+    TEST_ASSERT_EQUAL_UINT32(1, svc.flushedFrames());
+
+    // The next frame is drawn in the other buffer, never the one on the bus
+    TEST_ASSERT_TRUE(svc.beginFrame() != back);
+}
+
+void test_only_changes_are_sent_until_invalidated(void) {
+    SimBus bus;
+    DisplayService svc;
+    svc.begin(&bus);
+    uint8_t frame[OLED_BUFFER_SIZE];
+    memset(frame, 0x44, sizeof(frame));
+
+    svc.submit(frame);
+    svc.flushPending();
+    TEST_ASSERT_EQUAL(OLED_BUFFER_SIZE, bus.dataBytes);
+
+    frame[300] = 0x45;
+    svc.submit(frame);
+    svc.flushPending();
+    TEST_ASSERT_LESS_THAN(OLED_BUFFER_SIZE + 16, bus.dataBytes);
+    TEST_ASSERT_EQUAL_UINT8(0x45, bus.panel[300]);
+
+    svc.invalidate();
+    svc.submit(frame);
+    svc.flushPending();
+    TEST_ASSERT_GREATER_OR_EQUAL(2 * OLED_BUFFER_SIZE, bus.dataBytes);
+}
+
+// Renderer and flush task on two threads: every frame on the panel must be
+// one whole frame, and the last one presented must end up shown
+void test_no_torn_frames_across_threads(void) {
+    SimBus bus;
+    bus.yieldOften = true;
+    DisplayService svc;
+    svc.begin(&bus);
+
+    const int FRAMES = 20000;
+    std::atomic<bool> stop(false);
+    std::atomic<int> torn(0);
+    std::thread task([&] {
+        while (!stop) {
+            if (svc.flushPending() && !uniform(bus.panel, bus.panel[0])) torn++;
+        }
+        while (svc.flushPending()) {
+        }
+    });
+
+    for (int n = 1; n <= FRAMES; n++) {
+        memset(svc.beginFrame(), n & 0xFF, OLED_BUFFER_SIZE);
+        svc.present();
+    }
+    stop = true;
+    task.join();
+
+    TEST_ASSERT_EQUAL_INT(0, torn.load());
+    TEST_ASSERT_TRUE(uniform(bus.panel, FRAMES & 0xFF));
+    TEST_ASSERT_EQUAL_UINT32(FRAMES, svc.presentedFrames());
+    TEST_ASSERT_EQUAL_UINT32(FRAMES, svc.flushedFrames() + svc.droppedFrames());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_nothing_to_flush_until_presented);
+    RUN_TEST(test_newer_frame_replaces_ready_one);
+    RUN_TEST(test_only_changes_are_sent_until_invalidated);
+    RUN_TEST(test_no_torn_frames_across_threads);
+    return UNITY_END();
+}
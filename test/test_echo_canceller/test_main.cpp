@@ -0,0 +1,157 @@
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+#include "EchoCanceller.h"
+#include "../fixtures/speech.h"
+
+static const uint32_t RATE = 16000;
+static const size_t BLOCK = 160;   // 10ms, what the capture task hands over
+
+// The robot's voice through a small room: 2ms to the mic, then a decaying
+// tail, well inside the 256-tap (16ms) filter span
+static std::vector<double> roomPath(uint32_t seed) {
+    std::vector<double> h(200, 0.0);
+    FixtureNoise n(seed);
+    h[32] = 0.6;
+    for (size_t i = 33; i < h.size(); i++) h[i] = 0.2 * exp(-(double)(i - 32) / 80) * n.gauss();
+    return h;
+}
+
+struct EchoScene {
+    std::vector<int16_t> ref;    // What the speaker played
+    std::vector<int16_t> mic;    // Echo + near-end talk + hiss
+    std::vector<int16_t> near;   // The user alone, for scoring
+};
+
+// `seconds` of the robot talking; the user talks over it in [nearFrom, nearTo) ms
+static EchoScene scene(uint32_t seconds, uint32_t nearFrom = 0, uint32_t nearTo = 0) {
+    EchoScene s;
+    LabelledAudio robot = speechFixture(RATE, { { seconds * 1000, PART_TALK, 12000 } }, 0, 21);
+    s.ref = robot.pcm;
+    s.near.assign(s.ref.size(), 0);
+    if (nearTo > nearFrom) {
+        LabelledAudio user = speechFixture(RATE, { { nearTo - nearFrom, PART_TALK, 9000 } }, 0, 33);
+        for (size_t i = 0; i < user.pcm.size(); i++) s.near[(size_t)RATE * nearFrom / 1000 + i] = user.pcm[i];
+    }
+
+    std::vector<double> h = roomPath(5);
+    FixtureNoise hiss(8);
+    s.mic.resize(s.ref.size());
+    for (size_t n = 0; n < s.ref.size(); n++) {
+        double e = 0;
+        for (size_t i = 0; i < h.size() && i <= n; i++) e += h[i] * s.ref[n - i];
+        double m = e + s.near[n] + hiss.gauss() * 20;
+        s.mic[n] = (int16_t)(m > 32767 ? 32767 : (m < -32768 ? -32768 : lrint(m)));
+    }
+    return s;
+}
+
+static std::vector<int16_t> cancel(EchoCanceller& aec, const EchoScene& s) {
+    std::vector<int16_t> out(s.mic.size());
+    for (size_t n = 0; n + BLOCK <= s.mic.size(); n += BLOCK) aec.process(&s.mic[n], &s.ref[n], &out[n], BLOCK);
+    return out;
+}
+
+// Mic energy over output energy in [fromMs, toMs), in dB
+static double reductionDb(const EchoScene& s, const std::vector<int16_t>& out, uint32_t fromMs, uint32_t toMs) {
+    size_t a = (size_t)RATE * fromMs / 1000, b = (size_t)RATE * toMs / 1000;
+    return 20 * log10(fixtureRms(s.mic, a, b) / fixtureRms(out, a, b));
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_filter_alone_converges(void) {
+    EchoCanceller aec;
+    TEST_ASSERT_TRUE(aec.begin(RATE, 256));
+    aec.setSuppression(false);
+    EchoScene s = scene(6);
+    std::vector<int16_t> out = cancel(aec, s);
+
+    char msg[64];
+    double late = reductionDb(s, out, 3000, 6000);
+    snprintf(msg, sizeof(msg), "filter-only echo reduction %.1f dB, ERLE %d", late, aec.erleDb());
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE_MESSAGE(late > 30.0, msg);
+    TEST_ASSERT_GREATER_THAN(15, aec.erleDb());
+    // Converging within the first second, not ending there
+    TEST_ASSERT_TRUE(reductionDb(s, out, 1000, 2000) > 12.0);
+    TEST_ASSERT_FALSE(aec.doubleTalk());
+}
+
+void test_suppression_takes_the_residual_further(void) {
+    EchoCanceller a, b;
+    a.begin(RATE, 256);
+    b.begin(RATE, 256);
+    a.setSuppression(false);
+    EchoScene s = scene(5);
+    double filterOnly = reductionDb(s, cancel(a, s), 3000, 5000);
+    double both = reductionDb(s, cancel(b, s), 3000, 5000);
+    TEST_ASSERT_TRUE(both > filterOnly + 3.0);
+}
+
+void test_double_talk_keeps_the_user_and_the_path(void) {
+    EchoCanceller aec;
+    aec.begin(RATE, 256);
+    EchoScene s = scene(8, 4000, 5500);
+    std::vector<int16_t> out = cancel(aec, s);
+
+    // The user's voice comes through: compare the output with the user alone
+    size_t a = RATE * 4000 / 1000, b = RATE * 5500 / 1000;
+    double sig = 0, err = 0;
+    for (size_t n = a; n < b; n++) {
+        double d = (double)out[n] - s.near[n];
+        sig += (double)s.near[n] * s.near[n];
+        err += d * d;
+    }
+    double nearSnr = 10 * log10(sig / err);
+    char msg[64];
+    snprintf(msg, sizeof(msg), "near-end SNR during double talk %.1f dB", nearSnr);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE_MESSAGE(nearSnr > 20.0, msg);
+
+    // And the echo path was not thrown away: cancelling right after
+    TEST_ASSERT_TRUE(reductionDb(s, out, 5600, 6600) > 20.0);
+}
+
+void test_clear_history_keeps_the_path(void) {
+    EchoCanceller aec;
+    aec.begin(RATE, 256);
+    aec.setSuppression(false);
+    EchoScene s = scene(4);
+    cancel(aec, s);
+
+    // Streams restarted: new audio, same room
+    aec.clearHistory();
+    EchoScene next = scene(1);
+    std::vector<int16_t> out = cancel(aec, next);
+    TEST_ASSERT_TRUE(reductionDb(next, out, 100, 1000) > 20.0);
+
+    // reset() starts from nothing
+    aec.reset();
+    out = cancel(aec, next);
+    TEST_ASSERT_TRUE(reductionDb(next, out, 0, 150) < 6.0);
+}
+
+void test_silent_reference_passes_the_mic(void) {
+    // Nothing played: the user is heard unchanged, in place
+    EchoCanceller aec;
+    aec.begin(RATE, 256);
+    LabelledAudio user = speechFixture(RATE, { { 1500, PART_TALK, 9000 } }, 40, 3);
+    std::vector<int16_t> ref(user.pcm.size(), 0);
+    std::vector<int16_t> buf = user.pcm;
+    for (size_t n = 0; n + BLOCK <= buf.size(); n += BLOCK) aec.process(&buf[n], &ref[n], &buf[n], BLOCK);
+    for (size_t n = 0; n < buf.size() - buf.size() % BLOCK; n++) TEST_ASSERT_INT_WITHIN(2, user.pcm[n], buf[n]);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_filter_alone_converges);
+    RUN_TEST(test_suppression_takes_the_residual_further);
+    RUN_TEST(test_double_talk_keeps_the_user_and_the_path);
+    RUN_TEST(test_clear_history_keeps_the_path);
+    RUN_TEST(test_silent_reference_passes_the_mic);
+    return UNITY_END();
+}
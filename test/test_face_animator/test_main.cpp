@@ -0,0 +1,176 @@
+#include <unity.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+
+#include "FaceAnimator.h"
+
+static const FaceEase EASES[] = { EASE_LINEAR, EASE_IN, EASE_OUT, EASE_IN_OUT };
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_easing_endpoints_and_monotonic(void) {
+    for (FaceEase e : EASES) {
+        TEST_ASSERT_EQUAL_UINT32(0, faceEase(e, 0));
+        TEST_ASSERT_EQUAL_UINT32(65536, faceEase(e, 65536));
+        TEST_ASSERT_EQUAL_UINT32(65536, faceEase(e, 100000));   // Past the end holds
+        uint32_t last = 0;
+        for (uint32_t t = 0; t <= 65536; t++) {
+            uint32_t v = faceEase(e, t);
+            TEST_ASSERT_TRUE(v >= last && v <= 65536);
+            last = v;
+        }
+    }
+    // Slow start under the line, slow end over it, smoothstep through the middle
+    TEST_ASSERT_LESS_THAN(16384, faceEase(EASE_IN, 16384));
+    TEST_ASSERT_GREATER_THAN(16384, faceEase(EASE_OUT, 16384));
+    TEST_ASSERT_EQUAL_UINT32(32768, faceEase(EASE_IN_OUT, 32768));
+}
+
+void test_tween_lands_on_its_keyframes(void) {
+    // Up and back down, both ways round, for every ease
+    for (FaceEase e : EASES) {
+        FaceTrack t;
+        t.set(-300);
+        TEST_ASSERT_TRUE(t.push(700, 100, e, 1000));
+        TEST_ASSERT_TRUE(t.push(-300, 50, e, 1000));
+        TEST_ASSERT_EQUAL_INT16(-300, t.update(1000));
+        int16_t last = -300;
+        for (uint32_t ms = 1000; ms < 1100; ms++) {
+            int16_t v = t.update(ms);
+            TEST_ASSERT_TRUE(v >= last);
+            last = v;
+        }
+        TEST_ASSERT_EQUAL_INT16(700, t.update(1100));
+        last = 700;
+        for (uint32_t ms = 1100; ms < 1150; ms++) {
+            int16_t v = t.update(ms);
+            TEST_ASSERT_TRUE(v <= last);
+            last = v;
+        }
+        TEST_ASSERT_EQUAL_INT16(-300, t.update(1150));
+        TEST_ASSERT_FALSE(t.busy());
+    }
+}
+
+void test_keyframe_queue_overflow(void) {
+    FaceTrack t;
+    // One playing plus a full queue; the rest are refused
+    TEST_ASSERT_TRUE(t.push(10, 10, EASE_LINEAR, 0));
+    for (int16_t v = 20; v <= 50; v += 10) TEST_ASSERT_TRUE(t.push(v, 10, EASE_LINEAR, 0));
+    TEST_ASSERT_FALSE(t.push(60, 10, EASE_LINEAR, 0));
+    TEST_ASSERT_FALSE(t.push(70, 10, EASE_LINEAR, 0));
+    TEST_ASSERT_EQUAL_INT16(50, t.target());
+
+    // The accepted ones play back to back, each from where the last ended,
+    // even when update() is only called long after
+    TEST_ASSERT_EQUAL_INT16(25, t.update(25));
+    TEST_ASSERT_TRUE(t.push(60, 10, EASE_LINEAR, 25));   // Room again
+    TEST_ASSERT_EQUAL_INT16(60, t.update(1000));
+    TEST_ASSERT_FALSE(t.busy());
+
+    // set() drops the queue
+    t.push(100, 10, EASE_LINEAR, 1000);
+    t.push(200, 10, EASE_LINEAR, 1000);
+    t.set(5);
+    TEST_ASSERT_FALSE(t.busy());
+    TEST_ASSERT_EQUAL_INT16(5, t.update(2000));
+
+    // A blink asked for mid-blink is not queued behind it
+    FaceAnimator a;
+    a.begin(0, 10);
+    a.blink(0);
+    a.blink(50);
+    a.update(100);
+    TEST_ASSERT_EQUAL_INT16(0, a.pose().eyeOpen);
+    a.update(200);
+    TEST_ASSERT_EQUAL_INT16(FACE_ONE, a.pose().eyeOpen);
+    a.update(300);
+    TEST_ASSERT_EQUAL_INT16(FACE_ONE, a.pose().eyeOpen);
+}
+
+void test_frame_clock_ignores_call_rate(void) {
+    // Any call rate faster than the frame period gives the same frames,
+    // on the same 33ms grid
+    const uint32_t steps[] = { 1, 3, 7, 16, 33 };
+    for (uint32_t step : steps) {
+        FaceAnimator a;
+        a.begin(0, 33);
+        uint32_t due = 0;
+        for (uint32_t ms = 0; ms < 1000; ms += step) {
+            if (a.update(ms)) {
+                TEST_ASSERT_TRUE(ms >= due && ms < due + step);
+                due = a.nextDeadline();
+                TEST_ASSERT_EQUAL_UINT32(0, due % 33);
+            }
+        }
+        TEST_ASSERT_EQUAL_UINT32(31, a.frameCount());
+    }
+
+    // Slower than that: one frame per call, late ones skipped, still on the grid
+    FaceAnimator slow;
+    slow.begin(0, 33);
+    for (uint32_t ms = 0; ms < 1000; ms += 50) {
+        TEST_ASSERT_TRUE(slow.update(ms));
+        TEST_ASSERT_EQUAL_UINT32(0, slow.nextDeadline() % 33);
+        TEST_ASSERT_GREATER_THAN(ms, slow.nextDeadline());
+        TEST_ASSERT_LESS_OR_EQUAL(ms + 33, slow.nextDeadline());
+    }
+    TEST_ASSERT_EQUAL_UINT32(20, slow.frameCount());
+}
+
+void test_frame_clock_resyncs_after_a_stall(void) {
+    FaceAnimator a;
+    a.begin(0, 33);
+    TEST_ASSERT_TRUE(a.update(0));
+    // Over a second late: no burst of catch-up frames, the clock restarts
+    TEST_ASSERT_TRUE(a.update(5000));
+    TEST_ASSERT_EQUAL_UINT32(5033, a.nextDeadline());
+    TEST_ASSERT_FALSE(a.update(5001));
+    TEST_ASSERT_FALSE(a.update(5032));
+    TEST_ASSERT_TRUE(a.update(5033));
+    TEST_ASSERT_EQUAL_UINT32(3, a.frameCount());
+
+    // And runs on across the millisecond clock wrapping
+    FaceAnimator w;
+    w.begin(0xFFFFFFF0u, 33);
+    TEST_ASSERT_TRUE(w.update(0xFFFFFFF0u));
+    TEST_ASSERT_FALSE(w.update(0xFFFFFFF0u + 32));
+    TEST_ASSERT_TRUE(w.update(0xFFFFFFF0u + 33));
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFFFF0u + 66, w.nextDeadline());
+}
+
+void test_update_speed(void) {
+    // Reported, not asserted: host timings say little about the ESP32
+    const uint32_t N = 200000;
+    FaceAnimator a;
+    a.begin(0, 33, 7);
+    a.setIdle(true, 0);
+    a.setSpeaking(true, 0);
+    volatile int16_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t n = 0; n < N; n++) {
+        a.update(n * 33);
+        sink ^= a.pose().mouthOpen;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    double us = std::chrono::duration<double, std::micro>(t1 - t0).count() / N;
+
+    char line[64];
+    snprintf(line, sizeof(line), "FaceAnimator::update %.3f us/frame", us);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_EQUAL_UINT32(N, a.frameCount());
+    (void)sink;
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_easing_endpoints_and_monotonic);
+    RUN_TEST(test_tween_lands_on_its_keyframes);
+    RUN_TEST(test_keyframe_queue_overflow);
+    RUN_TEST(test_frame_clock_ignores_call_rate);
+    RUN_TEST(test_frame_clock_resyncs_after_a_stall);
+    RUN_TEST(test_update_speed);
+    return UNITY_END();
+}
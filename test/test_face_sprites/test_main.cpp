@@ -0,0 +1,315 @@
+#include <unity.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "FaceSprites.h"
+
+static constexpr sprites::Sprite kIdleOpen = sprites::idleFace(true);
+static constexpr sprites::Sprite kIdleClosed = sprites::idleFace(false);
+static constexpr sprites::Sprite kListening = sprites::listeningFace();
+static constexpr sprites::Sprite kWaiting = sprites::waitingFace();
+static constexpr sprites::Sprite kSmile = sprites::smileFace();
+
+#define WHITE 1
+#define sq(x) ((x) * (x))
+
+static void swap16(int16_t& a, int16_t& b) {
+    int16_t t = a;
+    a = b;
+    b = t;
+}
+
+// Adafruit_GFX + Adafruit_SSD1306 as the runtime drew the faces: int16_t
+// arithmetic, one page-layout buffer, clipping per pixel
+class RuntimeGfx {
+public:
+    uint8_t buffer[OLED_BUFFER_SIZE];
+
+    void clearDisplay() { memset(buffer, 0, sizeof(buffer)); }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t) {
+        if (x < 0 || x >= OLED_WIDTH || y < 0 || y >= OLED_HEIGHT) return;
+        buffer[x + (y / 8) * OLED_WIDTH] |= (1 << (y & 7));
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t c) {
+        for (int16_t i = 0; i < h; i++) drawPixel(x, y + i, c);
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c) {
+        for (int16_t i = 0; i < w; i++) drawPixel(x + i, y, c);
+    }
+
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t c) {
+        if (x0 == x1) {
+            if (y0 > y1) swap16(y0, y1);
+            drawFastVLine(x0, y0, y1 - y0 + 1, c);
+            return;
+        }
+        if (y0 == y1) {
+            if (x0 > x1) swap16(x0, x1);
+            drawFastHLine(x0, y0, x1 - x0 + 1, c);
+            return;
+        }
+        int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+        if (steep) {
+            swap16(x0, y0);
+            swap16(x1, y1);
+        }
+        if (x0 > x1) {
+            swap16(x0, x1);
+            swap16(y0, y1);
+        }
+        int16_t dx = x1 - x0;
+        int16_t dy = abs(y1 - y0);
+        int16_t err = dx / 2;
+        int16_t ystep = (y0 < y1) ? 1 : -1;
+        for (; x0 <= x1; x0++) {
+            if (steep) {
+                drawPixel(y0, x0, c);
+            } else {
+                drawPixel(x0, y0, c);
+            }
+            err -= dy;
+            if (err < 0) {
+                y0 += ystep;
+                err += dx;
+            }
+        }
+    }
+
+    void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t c) {
+        int16_t f = 1 - r;
+        int16_t ddF_x = 1;
+        int16_t ddF_y = -2 * r;
+        int16_t x = 0;
+        int16_t y = r;
+        int16_t px = x;
+        int16_t py = y;
+        delta++;
+        while (x < y) {
+            if (f >= 0) {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+            if (x < (y + 1)) {
+                if (corners & 1) drawFastVLine(x0 + x, y0 - y, 2 * y + delta, c);
+                if (corners & 2) drawFastVLine(x0 - x, y0 - y, 2 * y + delta, c);
+            }
+            if (y != py) {
+                if (corners & 1) drawFastVLine(x0 + py, y0 - px, 2 * px + delta, c);
+                if (corners & 2) drawFastVLine(x0 - py, y0 - px, 2 * px + delta, c);
+                py = y;
+            }
+            px = x;
+        }
+    }
+
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t c) {
+        drawFastVLine(x0, y0 - r, 2 * r + 1, c);
+        fillCircleHelper(x0, y0, r, 3, 0, c);
+    }
+
+    void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t c) {
+        int16_t maxRadius = ((w < h) ? w : h) / 2;
+        if (r > maxRadius) r = maxRadius;
+        for (int16_t i = x + r; i < x + r + w - 2 * r; i++) drawFastVLine(i, y, h, c);
+        fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, c);
+        fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, c);
+    }
+
+    void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t c) {
+        int16_t a, b, y, last;
+        if (y0 > y1) { swap16(y0, y1); swap16(x0, x1); }
+        if (y1 > y2) { swap16(y2, y1); swap16(x2, x1); }
+        if (y0 > y1) { swap16(y0, y1); swap16(x0, x1); }
+
+        if (y0 == y2) {
+            a = b = x0;
+            if (x1 < a) a = x1; else if (x1 > b) b = x1;
+            if (x2 < a) a = x2; else if (x2 > b) b = x2;
+            drawFastHLine(a, y0, b - a + 1, c);
+            return;
+        }
+
+        int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0,
+                dx12 = x2 - x1, dy12 = y2 - y1;
+        int32_t sa = 0, sb = 0;
+        last = (y1 == y2) ? y1 : y1 - 1;
+        for (y = y0; y <= last; y++) {
+            a = x0 + sa / dy01;
+            b = x0 + sb / dy02;
+            sa += dx01;
+            sb += dx02;
+            if (a > b) swap16(a, b);
+            drawFastHLine(a, y, b - a + 1, c);
+        }
+        sa = (int32_t)dx12 * (y - y1);
+        sb = (int32_t)dx02 * (y - y0);
+        for (; y <= y2; y++) {
+            a = x1 + sa / dy12;
+            b = x0 + sb / dy02;
+            sa += dx12;
+            sb += dx02;
+            if (a > b) swap16(a, b);
+            drawFastHLine(a, y, b - a + 1, c);
+        }
+    }
+};
+
+static RuntimeGfx display;
+
+// The FaceDisplay draw calls from before the sprites, unchanged
+
+static void drawIdle(bool eyeOpen) {
+    display.clearDisplay();
+    int eyeY = 25;
+    int eyeX1 = 35;
+    int eyeX2 = 93;
+    int eyeWidth = 14;
+    int eyeHeight = 22;
+    if (eyeOpen) {
+        display.fillRoundRect(eyeX1 - eyeWidth/2, eyeY - eyeHeight/2, eyeWidth, eyeHeight, 5, WHITE);
+        display.fillRoundRect(eyeX2 - eyeWidth/2, eyeY - eyeHeight/2, eyeWidth, eyeHeight, 5, WHITE);
+    } else {
+        display.drawLine(eyeX1 - 10, eyeY, eyeX1 + 10, eyeY, WHITE);
+        display.drawLine(eyeX2 - 10, eyeY, eyeX2 + 10, eyeY, WHITE);
+    }
+    display.fillTriangle(63, 40, 65, 40, 64, 42, WHITE);
+}
+
+static void drawListening() {
+    display.clearDisplay();
+    int eyeY = 25;
+    int eyeX1 = 35;
+    int eyeX2 = 93;
+    int eyeRadius = 12;
+    display.fillCircle(eyeX1, eyeY, eyeRadius, WHITE);
+    display.fillCircle(eyeX2, eyeY, eyeRadius, WHITE);
+    display.fillTriangle(63, 40, 65, 40, 64, 42, WHITE);
+}
+
+static void drawWaiting() {
+    display.clearDisplay();
+    int eyeY = 25;
+    int eyeX1 = 35;
+    int eyeX2 = 93;
+    int eyeRadius = 10;
+    display.fillCircle(eyeX1, eyeY - 5, eyeRadius, WHITE);
+    display.fillCircle(eyeX2, eyeY - 5, eyeRadius, WHITE);
+    display.fillTriangle(63, 40, 65, 40, 64, 42, WHITE);
+    display.fillCircle(10, 10, 2, WHITE);
+    display.fillCircle(18, 5, 3, WHITE);
+    display.fillCircle(28, 2, 4, WHITE);
+}
+
+static void drawSmile() {
+    display.clearDisplay();
+    int eyeY = 25;
+    int leftEyeX = 35;
+    int rightEyeX = 93;
+    int eyeWidth = 10;
+    int eyeHeight = 5;
+    int tilt = 2;
+    for (int yOffset = 0; yOffset <= 2; yOffset++) {
+        for (int x = -eyeWidth; x <= eyeWidth; x++) {
+            float y = -eyeHeight * sqrt(1.0 - sq((float)x / eyeWidth)) + yOffset;
+            y += (x > 0) ? -tilt : 0;
+            display.drawPixel(leftEyeX + x, eyeY + y, WHITE);
+        }
+    }
+    for (int yOffset = 0; yOffset <= 2; yOffset++) {
+        for (int x = -eyeWidth; x <= eyeWidth; x++) {
+            float y = -eyeHeight * sqrt(1.0 - sq((float)x / eyeWidth)) + yOffset;
+            y += (x < 0) ? -tilt : 0;
+            display.drawPixel(rightEyeX + x, eyeY + y, WHITE);
+        }
+    }
+    display.fillTriangle(63, 40, 65, 40, 64, 42, WHITE);
+    int mouthCenterX = 64;
+    int mouthCenterY = 46;
+    int mouthRadiusX = 18;
+    int mouthRadiusY = 6;
+    for (int i = -mouthRadiusX; i <= mouthRadiusX; i++) {
+        float y = mouthRadiusY * sqrt(1.0 - sq((float)i / mouthRadiusX));
+        display.drawPixel(mouthCenterX + i, mouthCenterY + y, WHITE);
+    }
+    int teethOffset = 4;
+    display.drawLine(mouthCenterX - 18, mouthCenterY + 1 + teethOffset,
+                     mouthCenterX - 15, mouthCenterY + 6 + teethOffset, WHITE);
+    display.drawLine(mouthCenterX - 15, mouthCenterY + 6 + teethOffset,
+                     mouthCenterX - 12, mouthCenterY + 1 + teethOffset, WHITE);
+    display.drawLine(mouthCenterX + 18, mouthCenterY + 1 + teethOffset,
+                     mouthCenterX + 15, mouthCenterY + 6 + teethOffset, WHITE);
+    display.drawLine(mouthCenterX + 15, mouthCenterY + 6 + teethOffset,
+                     mouthCenterX - 12, mouthCenterY + 1 + teethOffset, WHITE);
+}
+
+static int litPixels(const uint8_t* buf) {
+    int n = 0;
+    for (int i = 0; i < OLED_BUFFER_SIZE; i++) n += __builtin_popcount(buf[i]);
+    return n;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_idle_open_matches_runtime(void) {
+    drawIdle(true);
+    TEST_ASSERT_GREATER_THAN(100, litPixels(display.buffer));
+    TEST_ASSERT_EQUAL_MEMORY(display.buffer, kIdleOpen.buf, OLED_BUFFER_SIZE);
+}
+
+void test_idle_closed_matches_runtime(void) {
+    drawIdle(false);
+    TEST_ASSERT_EQUAL_MEMORY(display.buffer, kIdleClosed.buf, OLED_BUFFER_SIZE);
+}
+
+void test_listening_matches_runtime(void) {
+    drawListening();
+    TEST_ASSERT_EQUAL_MEMORY(display.buffer, kListening.buf, OLED_BUFFER_SIZE);
+}
+
+void test_waiting_matches_runtime(void) {
+    // The top thinking dot runs off the panel and is clipped
+    drawWaiting();
+    TEST_ASSERT_EQUAL_MEMORY(display.buffer, kWaiting.buf, OLED_BUFFER_SIZE);
+}
+
+void test_smile_matches_runtime(void) {
+    drawSmile();
+    TEST_ASSERT_EQUAL_MEMORY(display.buffer, kSmile.buf, OLED_BUFFER_SIZE);
+}
+
+void test_csqrt_matches_libm(void) {
+    // The values the smile takes the root of, then a spread of magnitudes
+    for (int w : { 10, 18 }) {
+        for (int x = -w; x <= w; x++) {
+            double v = 1.0 - sq((float)x / w);
+            TEST_ASSERT_TRUE(sprites::csqrt(v) == sqrt(v));
+        }
+    }
+    srand(8);
+    for (int i = 0; i < 100000; i++) {
+        double v = ldexp((double)rand() / RAND_MAX + 0.5, (rand() % 80) - 40);
+        TEST_ASSERT_TRUE(sprites::csqrt(v) == sqrt(v));
+    }
+    TEST_ASSERT_TRUE(sprites::csqrt(0.0) == 0.0);
+    TEST_ASSERT_TRUE(sprites::csqrt(-1.0) == 0.0);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_idle_open_matches_runtime);
+    RUN_TEST(test_idle_closed_matches_runtime);
+    RUN_TEST(test_listening_matches_runtime);
+    RUN_TEST(test_waiting_matches_runtime);
+    RUN_TEST(test_smile_matches_runtime);
+    RUN_TEST(test_csqrt_matches_libm);
+    return UNITY_END();
+}
@@ -0,0 +1,207 @@
+#include <unity.h>
+#include <string.h>
+
+#include "FramePack.h"
+#include "../fixtures/birthday_cake_frames.h"
+#include "../fixtures/birthday_cake_pack.h"
+#include "../fixtures/frame_layout.h"
+#include "../fixtures/best_friend_pack.h"
+#include "../fixtures/best_friend_crcs.h"
+
+static const size_t FRAME_BYTES = 1024;
+
+static uint8_t buffer[FRAME_BYTES];
+static uint8_t expected[CAKE_FRAME_COUNT][FRAME_BYTES];
+
+// CRC-32 as zlib computes it, bit by bit
+static uint32_t crc32(const uint8_t* data, size_t length, uint32_t crc = 0) {
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+void setUp(void) {
+    memset(buffer, 0x5A, sizeof(buffer));
+}
+
+void tearDown(void) {}
+
+void test_cake_pack_decodes_every_frame(void) {
+    FramePackDecoder d;
+    d.begin(&cake::clip, buffer);
+    TEST_ASSERT_EQUAL_UINT16(CAKE_FRAME_COUNT, d.frameCount());
+    for (uint16_t i = 0; i < CAKE_FRAME_COUNT; i++) {
+        TEST_ASSERT_TRUE(d.next());
+        TEST_ASSERT_EQUAL_UINT16(i, d.frameIndex());
+        TEST_ASSERT_EQUAL_MEMORY(expected[i], buffer, FRAME_BYTES);
+        TEST_ASSERT_EQUAL_UINT16(CAKE_FRAME_MS, d.frameDuration(i));
+    }
+}
+
+void test_best_friend_pack_matches_the_original_bitmaps(void) {
+    // The whole shipped clip, against the frames it replaced
+    FramePackDecoder d;
+    d.begin(&best_friend::clip, buffer);
+    TEST_ASSERT_EQUAL_UINT16(BEST_FRIEND_FRAME_COUNT, d.frameCount());
+    uint8_t rows[FRAME_BYTES];
+    uint32_t clipCrc = 0;
+    for (uint16_t i = 0; i < BEST_FRIEND_FRAME_COUNT; i++) {
+        TEST_ASSERT_TRUE(d.next());
+        TEST_ASSERT_EQUAL_UINT16(i, d.frameIndex());
+        TEST_ASSERT_EQUAL_UINT16(BEST_FRIEND_FRAME_MS, d.frameDuration(i));
+        pagesToRows(buffer, rows);
+        TEST_ASSERT_EQUAL_HEX32(bestFriendFrameCrcs[i], crc32(rows, FRAME_BYTES));
+        clipCrc = crc32(rows, FRAME_BYTES, clipCrc);
+    }
+    TEST_ASSERT_EQUAL_HEX32(BEST_FRIEND_CLIP_CRC, clipCrc);
+}
+
+void test_next_wraps_to_key_frame(void) {
+    FramePackDecoder d;
+    d.begin(&cake::clip, buffer);
+    for (uint16_t i = 0; i < CAKE_FRAME_COUNT; i++) TEST_ASSERT_TRUE(d.next());
+    TEST_ASSERT_TRUE(d.next());
+    TEST_ASSERT_EQUAL_UINT16(0, d.frameIndex());
+    TEST_ASSERT_EQUAL_MEMORY(expected[0], buffer, FRAME_BYTES);
+}
+
+void test_seek_replays_from_key_frame(void) {
+    FramePackDecoder d;
+    d.begin(&cake::clip, buffer);
+    const uint16_t order[] = { 9, 2, 14, 7, 8, 0, 13 };
+    for (uint16_t i : order) {
+        TEST_ASSERT_TRUE(d.decode(i));
+        TEST_ASSERT_EQUAL_MEMORY(expected[i], buffer, FRAME_BYTES);
+    }
+    TEST_ASSERT_FALSE(d.decode(CAKE_FRAME_COUNT));
+}
+
+// 0x7F copies 128 literals, 0xFF repeats 130 times: the longest tokens
+void test_rle_longest_tokens(void) {
+    static uint8_t data[1 + 1 + 128 + 8 * 2 + 2];
+    size_t n = 0;
+    data[n++] = FRAME_KEY;
+    data[n++] = 0x7F;
+    for (int i = 0; i < 128; i++) data[n++] = (uint8_t)i;
+    // 896 bytes left: 6 x 130 + 116
+    for (int i = 0; i < 6; i++) {
+        data[n++] = 0xFF;
+        data[n++] = (uint8_t)(0xA0 + i);
+    }
+    data[n++] = 0x80 + 116 - 3;
+    data[n++] = 0xEE;
+    static const uint32_t offsets[] = { 0 };
+    FramePack pack = { 128, 64, 1, offsets, data, NULL, FRAME_LAYOUT_ROWS };
+
+    FramePackDecoder d;
+    d.begin(&pack, buffer);
+    TEST_ASSERT_TRUE(d.decode(0));
+    for (int i = 0; i < 128; i++) TEST_ASSERT_EQUAL_UINT8(i, buffer[i]);
+    for (int i = 0; i < 6 * 130; i++) TEST_ASSERT_EQUAL_UINT8(0xA0 + i / 130, buffer[128 + i]);
+    for (int i = 128 + 6 * 130; i < 1024; i++) TEST_ASSERT_EQUAL_UINT8(0xEE, buffer[i]);
+    TEST_ASSERT_EQUAL_UINT16(0, d.frameDuration(0));
+}
+
+// 16x8 frames: a key frame, then a delta that inverts one byte
+void test_delta_applies_on_previous_frame(void) {
+    static const uint8_t data[] = {
+        FRAME_KEY, 0x80 + 16 - 3, 0x0F,
+        FRAME_DELTA, 0x80 + 4 - 3, 0x00, 0x01, 0xFF, 0x00, 0x80 + 10 - 3, 0x00,
+    };
+    static const uint32_t offsets[] = { 0, 3 };
+    static const uint16_t durations[] = { 40, 120 };
+    FramePack pack = { 16, 8, 2, offsets, data, durations, FRAME_LAYOUT_ROWS };
+
+    FramePackDecoder d;
+    d.begin(&pack, buffer);
+    TEST_ASSERT_TRUE(d.decode(1));   // Seek straight to the delta
+    for (int i = 0; i < 16; i++) {
+        uint8_t want = 0x0F;
+        if (i == 4) want = 0xF0;
+        if (i == 5) want = 0x0F;
+        TEST_ASSERT_EQUAL_UINT8(want, buffer[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT16(120, d.frameDuration(1));
+}
+
+void test_corrupt_blob_is_rejected(void) {
+    // Repeat runs past the end of a 16-byte frame; unknown frame type
+    static const uint8_t data[] = { FRAME_KEY, 0x80 + 20 - 3, 0x00, 7, 0x80, 0x00 };
+    static const uint32_t offsets[] = { 0, 3 };
+    FramePack pack = { 16, 8, 2, offsets, data, NULL, FRAME_LAYOUT_ROWS };
+
+    FramePackDecoder d;
+    d.begin(&pack, buffer);
+    TEST_ASSERT_FALSE(d.decode(0));
+    TEST_ASSERT_FALSE(d.decode(1));
+}
+
+void test_player_keeps_deadlines_when_drawing_is_slow(void) {
+    FramePackPlayer p;
+    p.begin(&cake::clip, buffer);
+    // Each shown frame costs 25ms to push out; loop() polls every 1ms
+    uint32_t t = 1000;
+    uint32_t shownAt[45];
+    int shown = 0;
+    while (shown < 45) {
+        if (p.update(t)) {
+            TEST_ASSERT_EQUAL_MEMORY(expected[p.frameIndex()], buffer, FRAME_BYTES);
+            shownAt[shown++] = t;
+            t += 25;
+        } else {
+            t += 1;
+        }
+    }
+    // Frame k is due at 1000 + 80k, never later: no drift
+    for (int k = 0; k < 45; k++) {
+        TEST_ASSERT_EQUAL_UINT32(1000 + 80 * k, shownAt[k]);
+    }
+}
+
+void test_player_skips_frames_that_are_over(void) {
+    FramePackPlayer p;
+    p.begin(&cake::clip, buffer);
+    TEST_ASSERT_TRUE(p.update(0));
+    TEST_ASSERT_FALSE(p.update(79));
+    // 250ms late: frames 1 and 2 are over, frame 3 is due
+    TEST_ASSERT_TRUE(p.update(250));
+    TEST_ASSERT_EQUAL_UINT16(3, p.frameIndex());
+    TEST_ASSERT_EQUAL_UINT32(320, p.nextDeadline());
+    TEST_ASSERT_EQUAL_MEMORY(expected[3], buffer, FRAME_BYTES);
+
+    // Stalled for seconds: restart the clock instead of catching up
+    TEST_ASSERT_TRUE(p.update(5000));
+    TEST_ASSERT_EQUAL_UINT16(4, p.frameIndex());
+    TEST_ASSERT_EQUAL_UINT32(5080, p.nextDeadline());
+}
+
+void test_player_wraps_around_the_millisecond_clock(void) {
+    FramePackPlayer p;
+    p.begin(&cake::clip, buffer);
+    uint32_t t = 0xFFFFFFFF - 100;
+    TEST_ASSERT_TRUE(p.update(t));
+    TEST_ASSERT_FALSE(p.update(t + 79));
+    TEST_ASSERT_TRUE(p.update(t + 80));
+    TEST_ASSERT_TRUE(p.update(t + 160));   // Past zero
+    TEST_ASSERT_EQUAL_UINT16(2, p.frameIndex());
+}
+
+int main(void) {
+    for (uint16_t i = 0; i < CAKE_FRAME_COUNT; i++) rowsToPages(cakeFrames[i], expected[i]);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_cake_pack_decodes_every_frame);
+    RUN_TEST(test_best_friend_pack_matches_the_original_bitmaps);
+    RUN_TEST(test_next_wraps_to_key_frame);
+    RUN_TEST(test_seek_replays_from_key_frame);
+    RUN_TEST(test_rle_longest_tokens);
+    RUN_TEST(test_delta_applies_on_previous_frame);
+    RUN_TEST(test_corrupt_blob_is_rejected);
+    RUN_TEST(test_player_keeps_deadlines_when_drawing_is_slow);
+    RUN_TEST(test_player_skips_frames_that_are_over);
+    RUN_TEST(test_player_wraps_around_the_millisecond_clock);
+    return UNITY_END();
+}
@@ -0,0 +1,180 @@
+#include <unity.h>
+#include <string.h>
+#include <vector>
+
+// The host tool is not part of the firmware sources: build it in here
+#include "../../tools/gif2pack/GifDecoder.cpp"
+#include "../../tools/gif2pack/FrameConverter.cpp"
+#include "../../tools/gif2pack/FramePackEncoder.cpp"
+
+#include "FramePack.h"
+#include "../fixtures/birthday_cake_frames.h"
+#include "../fixtures/frame_layout.h"
+
+static const size_t FRAME_BYTES = 1024;
+
+// Decodes `enc` with the firmware decoder
+struct DecodedPack {
+    std::vector<std::vector<uint8_t>> frames;
+    std::vector<uint16_t> durations;
+};
+
+static DecodedPack decodePack(const FramePackEncoder& enc, int width, int height, bool pageLayout) {
+    FramePack pack = { (uint16_t)width, (uint16_t)height, (uint16_t)enc.frameCount(),
+                       enc.offsets().data(), enc.data().data(), enc.durations().data(),
+                       pageLayout ? FRAME_LAYOUT_PAGES : FRAME_LAYOUT_ROWS };
+    std::vector<uint8_t> buffer(FramePackDecoder::frameBytes(pack));
+    FramePackDecoder decoder;
+    decoder.begin(&pack, buffer.data());
+
+    DecodedPack out;
+    for (size_t i = 0; i < enc.frameCount(); i++) {
+        if (!decoder.next()) break;
+        out.frames.push_back(buffer);
+        out.durations.push_back(decoder.frameDuration((uint16_t)i));
+    }
+    return out;
+}
+
+// A 128x64 canvas as GifDecoder would deliver it: lit pixels white
+static GifFrame canvasFor(const uint8_t* rows) {
+    GifFrame frame;
+    frame.luma.resize(128 * 64);
+    frame.alpha.assign(128 * 64, 255);
+    for (int i = 0; i < 128 * 64; i++) {
+        frame.luma[i] = (rows[i / 8] & (0x80 >> (i & 7))) ? 255 : 0;
+    }
+    frame.delayMs = CAKE_FRAME_MS;
+    return frame;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void roundTrip(bool pageLayout) {
+    ConvertOptions options;
+    options.dither = false;
+    options.pageLayout = pageLayout;
+    FrameConverter converter(128, 64, options);
+    FramePackEncoder encoder(FRAME_BYTES);
+
+    std::vector<std::vector<uint8_t>> original;
+    for (uint16_t i = 0; i < CAKE_FRAME_COUNT; i++) {
+        std::vector<uint8_t> want(FRAME_BYTES);
+        if (pageLayout) {
+            rowsToPages(cakeFrames[i], want.data());
+        } else {
+            memcpy(want.data(), cakeFrames[i], FRAME_BYTES);
+        }
+        GifFrame canvas = canvasFor(cakeFrames[i]);
+        std::vector<uint8_t> converted = converter.convert(canvas);
+        TEST_ASSERT_EQUAL_MEMORY(want.data(), converted.data(), FRAME_BYTES);
+        encoder.addFrame(converted, canvas.delayMs);
+        original.push_back(want);
+    }
+
+    TEST_ASSERT_EQUAL(CAKE_FRAME_COUNT, encoder.frameCount());
+    TEST_ASSERT_LESS_THAN(encoder.rawBytes() / 2, encoder.data().size());
+
+    DecodedPack decoded = decodePack(encoder, 128, 64, pageLayout);
+    TEST_ASSERT_EQUAL(CAKE_FRAME_COUNT, decoded.frames.size());
+    for (uint16_t i = 0; i < CAKE_FRAME_COUNT; i++) {
+        TEST_ASSERT_EQUAL_MEMORY(original[i].data(), decoded.frames[i].data(), FRAME_BYTES);
+        TEST_ASSERT_EQUAL_UINT16(CAKE_FRAME_MS, decoded.durations[i]);
+    }
+}
+
+void test_cake_round_trip_rows(void) {
+    roundTrip(false);
+}
+
+void test_cake_round_trip_pages(void) {
+    roundTrip(true);
+}
+
+void test_identical_frames_merge(void) {
+    FramePackEncoder encoder(FRAME_BYTES);
+    std::vector<uint8_t> a(cakeFrames[0], cakeFrames[0] + FRAME_BYTES);
+    std::vector<uint8_t> b(cakeFrames[1], cakeFrames[1] + FRAME_BYTES);
+    encoder.addFrame(a, 80);
+    encoder.addFrame(a, 120);
+    encoder.addFrame(b, 80);
+    encoder.addFrame(a, 80);
+
+    TEST_ASSERT_EQUAL(3, encoder.frameCount());
+    TEST_ASSERT_EQUAL(1, encoder.mergedFrames());
+    DecodedPack decoded = decodePack(encoder, 128, 64, false);
+    TEST_ASSERT_EQUAL(3, decoded.frames.size());
+    TEST_ASSERT_EQUAL_UINT16(200, decoded.durations[0]);
+    TEST_ASSERT_EQUAL_MEMORY(a.data(), decoded.frames[0].data(), FRAME_BYTES);
+    TEST_ASSERT_EQUAL_MEMORY(b.data(), decoded.frames[1].data(), FRAME_BYTES);
+    TEST_ASSERT_EQUAL_MEMORY(a.data(), decoded.frames[2].data(), FRAME_BYTES);
+}
+
+// Two 1x1 frames, black then white, after a graphic control extension with
+// the given delays in centiseconds
+static std::vector<uint8_t> tinyGif(uint16_t cs0, uint16_t cs1) {
+    std::vector<uint8_t> gif = {
+        'G', 'I', 'F', '8', '9', 'a', 1, 0, 1, 0, 0x80, 0, 0,
+        0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    };
+    const uint16_t delays[2] = { cs0, cs1 };
+    // LZW, minimum code size 2: clear, pixel, end
+    const uint8_t lzw[2][2] = { { 0x44, 0x01 }, { 0x4C, 0x01 } };
+    for (int i = 0; i < 2; i++) {
+        const uint8_t gce[] = { 0x21, 0xF9, 4, 0, (uint8_t)delays[i], (uint8_t)(delays[i] >> 8), 0, 0 };
+        const uint8_t image[] = { 0x2C, 0, 0, 0, 0, 1, 0, 1, 0, 0, 2, 2, lzw[i][0], lzw[i][1], 0 };
+        gif.insert(gif.end(), gce, gce + sizeof(gce));
+        gif.insert(gif.end(), image, image + sizeof(image));
+    }
+    gif.push_back(0x3B);
+    return gif;
+}
+
+void test_gif_delays_past_16_bits(void) {
+    // 100s, then 0 ("as fast as allowed", played at 100ms like browsers do)
+    std::vector<uint8_t> data = tinyGif(10000, 0);
+    GifDecoder gif;
+    TEST_ASSERT_TRUE_MESSAGE(gif.decode(data.data(), data.size()), gif.error().c_str());
+    TEST_ASSERT_EQUAL(2, gif.frames().size());
+    TEST_ASSERT_EQUAL_UINT32(100000, gif.frames()[0].delayMs);
+    TEST_ASSERT_EQUAL_UINT32(100, gif.frames()[1].delayMs);
+    TEST_ASSERT_EQUAL_UINT8(0, gif.frames()[0].luma[0]);
+    TEST_ASSERT_EQUAL_UINT8(255, gif.frames()[1].luma[0]);
+
+    // The hold is split into frames of at most 65535ms
+    ConvertOptions options;
+    options.width = 8;
+    options.height = 8;
+    FrameConverter converter(gif.width(), gif.height(), options);
+    FramePackEncoder encoder(8);
+    for (const GifFrame& frame : gif.frames()) encoder.addFrame(converter.convert(frame), frame.delayMs);
+
+    DecodedPack decoded = decodePack(encoder, 8, 8, true);
+    TEST_ASSERT_EQUAL(3, decoded.frames.size());
+    TEST_ASSERT_EQUAL_UINT16(65535, decoded.durations[0]);
+    TEST_ASSERT_EQUAL_UINT16(100000 - 65535, decoded.durations[1]);
+    TEST_ASSERT_EQUAL_UINT16(100, decoded.durations[2]);
+    const uint8_t dark[8] = { 0 };
+    const uint8_t lit[8] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    TEST_ASSERT_EQUAL_MEMORY(dark, decoded.frames[0].data(), 8);
+    TEST_ASSERT_EQUAL_MEMORY(dark, decoded.frames[1].data(), 8);
+    TEST_ASSERT_EQUAL_MEMORY(lit, decoded.frames[2].data(), 8);
+}
+
+void test_truncated_gif_is_rejected(void) {
+    std::vector<uint8_t> data = tinyGif(8, 8);
+    GifDecoder gif;
+    TEST_ASSERT_FALSE(gif.decode(data.data(), 20));
+    TEST_ASSERT_FALSE(gif.error().empty());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_cake_round_trip_rows);
+    RUN_TEST(test_cake_round_trip_pages);
+    RUN_TEST(test_identical_frames_merge);
+    RUN_TEST(test_gif_delays_past_16_bits);
+    RUN_TEST(test_truncated_gif_is_rejected);
+    return UNITY_END();
+}
@@ -0,0 +1,211 @@
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+#include "ImaAdpcm.h"
+#include "../fixtures/speech.h"
+
+static const uint32_t RATE = 16000;
+static const size_t FRAME = 320;   // 20ms, what the uplink sends per message
+
+// Textbook IMA-ADPCM decoder (IMA Digital Audio Focus and Technical Working
+// Group, 1992), written out separately so the codes are checked against the
+// standard and not only against our own encoder
+static const int REF_STEPS[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60,
+    66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371,
+    408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878,
+    2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845,
+    8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086,
+    29794, 32767
+};
+static const int REF_INDEX[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+
+static std::vector<int16_t> referenceDecode(const uint8_t* block, size_t length) {
+    int predictor = (int16_t)(block[0] | (block[1] << 8));
+    int index = block[2];
+    std::vector<int16_t> out;
+    for (size_t i = 4; i < length; i++) {
+        for (int half = 0; half < 2; half++) {
+            int code = half ? block[i] >> 4 : block[i] & 0x0F;
+            int step = REF_STEPS[index];
+            int vpdiff = step >> 3;
+            if (code & 4) vpdiff += step;
+            if (code & 2) vpdiff += step >> 1;
+            if (code & 1) vpdiff += step >> 2;
+            predictor += (code & 8) ? -vpdiff : vpdiff;
+            if (predictor > 32767) predictor = 32767;
+            if (predictor < -32768) predictor = -32768;
+            index += REF_INDEX[code];
+            if (index < 0) index = 0;
+            if (index > 88) index = 88;
+            out.push_back((int16_t)predictor);
+        }
+    }
+    return out;
+}
+
+// Encodes `in` a frame per block and decodes each block on its own
+static std::vector<int16_t> roundTrip(const std::vector<int16_t>& in, std::vector<std::vector<uint8_t> >* blocks = NULL) {
+    ImaAdpcmEncoder enc;
+    std::vector<uint8_t> block(ImaAdpcmEncoder::blockBytes(FRAME));
+    std::vector<int16_t> out, pcm(FRAME);
+    for (size_t pos = 0; pos + FRAME <= in.size(); pos += FRAME) {
+        size_t bytes = enc.encodeBlock(&in[pos], FRAME, block.data());
+        TEST_ASSERT_EQUAL(ImaAdpcmEncoder::blockBytes(FRAME), bytes);
+        TEST_ASSERT_EQUAL(FRAME, ImaAdpcmDecoder::decodeBlock(block.data(), bytes, pcm.data()));
+        out.insert(out.end(), pcm.begin(), pcm.end());
+        if (blocks) blocks->push_back(std::vector<uint8_t>(block.begin(), block.begin() + bytes));
+    }
+    return out;
+}
+
+static double snrDb(const std::vector<int16_t>& ref, const std::vector<int16_t>& out) {
+    double sig = 0, err = 0;
+    for (size_t i = 0; i < out.size(); i++) {
+        double d = (double)ref[i] - out[i];
+        sig += (double)ref[i] * ref[i];
+        err += d * d;
+    }
+    return 10 * log10(sig / err);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_header_carries_the_starting_state(void) {
+    ImaAdpcmEncoder enc;
+    std::vector<int16_t> ramp(FRAME);
+    for (size_t i = 0; i < FRAME; i++) ramp[i] = (int16_t)(-(int)i * 40);
+    uint8_t first[200], second[200];
+    enc.encodeBlock(ramp.data(), FRAME, first);
+    TEST_ASSERT_EQUAL_UINT8(0, first[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, first[1]);
+    TEST_ASSERT_EQUAL_UINT8(0, first[2]);
+    TEST_ASSERT_EQUAL_UINT8(0, first[3]);
+
+    // The next block starts where this one's decode ended
+    size_t bytes = enc.encodeBlock(ramp.data(), FRAME, second);
+    int16_t pcm[FRAME];
+    ImaAdpcmDecoder::decodeBlock(first, bytes, pcm);
+    TEST_ASSERT_EQUAL_INT16(pcm[FRAME - 1], (int16_t)(second[0] | (second[1] << 8)));
+    TEST_ASSERT_LESS_THAN(0, pcm[FRAME - 1]);   // Negative, little-endian
+    TEST_ASSERT_LESS_OR_EQUAL(88, second[2]);
+    TEST_ASSERT_EQUAL_UINT8(0, second[3]);
+
+    enc.reset();
+    enc.encodeBlock(ramp.data(), FRAME, second);
+    TEST_ASSERT_EQUAL_MEMORY(first, second, bytes);
+}
+
+void test_codes_match_the_reference_decoder(void) {
+    LabelledAudio a = speechFixture(RATE, { { 200, PART_QUIET, 0 }, { 1500, PART_TALK, 20000 },
+                                            { 500, PART_NOISE, 3000 } });
+    std::vector<std::vector<uint8_t> > blocks;
+    std::vector<int16_t> out = roundTrip(a.pcm, &blocks);
+    size_t at = 0;
+    for (const std::vector<uint8_t>& b : blocks) {
+        std::vector<int16_t> ref = referenceDecode(b.data(), b.size());
+        TEST_ASSERT_EQUAL(FRAME, ref.size());
+        TEST_ASSERT_EQUAL_INT16_ARRAY(ref.data(), &out[at], FRAME);
+        at += FRAME;
+    }
+
+    // Arbitrary codes and start states too, including clipping at both rails
+    uint32_t seed = 7;
+    for (int n = 0; n < 500; n++) {
+        uint8_t block[4 + 64];
+        for (size_t i = 0; i < sizeof(block); i++) {
+            seed = seed * 1664525u + 1013904223u;
+            block[i] = (uint8_t)(seed >> 24);
+        }
+        block[2] %= 89;
+        int16_t pcm[128];
+        TEST_ASSERT_EQUAL(128, ImaAdpcmDecoder::decodeBlock(block, sizeof(block), pcm));
+        std::vector<int16_t> ref = referenceDecode(block, sizeof(block));
+        TEST_ASSERT_EQUAL_INT16_ARRAY(ref.data(), pcm, 128);
+    }
+}
+
+void test_speech_survives_the_round_trip(void) {
+    LabelledAudio a = speechFixture(RATE, { { 200, PART_QUIET, 0 }, { 2900, PART_TALK, 12000 } });
+    std::vector<int16_t> out = roundTrip(a.pcm);
+    double snr = snrDb(a.pcm, out);
+    char msg[48];
+    snprintf(msg, sizeof(msg), "speech SNR %.1f dB", snr);
+    TEST_MESSAGE(msg);
+    // Glottal pulses are the hard case for a 4-bit delta coder; this
+    // synthetic voice measures about 18dB, a sine about 28dB
+    TEST_ASSERT_TRUE_MESSAGE(snr > 16.0, msg);
+
+    std::vector<int16_t> tone(RATE);
+    for (size_t i = 0; i < tone.size(); i++) tone[i] = (int16_t)lround(12000 * sin(2 * M_PI * 1000 * i / RATE));
+    TEST_ASSERT_TRUE(snrDb(tone, roundTrip(tone)) > 25.0);
+
+    // Full-scale square wave: the predictor clips instead of wrapping
+    std::vector<int16_t> square(RATE / 4);
+    for (size_t i = 0; i < square.size(); i++) square[i] = (i / 40) & 1 ? 32767 : -32768;
+    std::vector<int16_t> sq = roundTrip(square);
+    TEST_ASSERT_INT_WITHIN(64, 32767, sq[79]);
+    TEST_ASSERT_INT_WITHIN(64, -32768, sq[119]);
+}
+
+void test_streaming_read_matches_whole_block(void) {
+    LabelledAudio a = speechFixture(RATE, { { 600, PART_TALK, 9000 } });
+    ImaAdpcmEncoder enc;
+    uint8_t block[4 + FRAME / 2];
+    size_t bytes = enc.encodeBlock(&a.pcm[2000], FRAME, block);
+    int16_t whole[FRAME];
+    ImaAdpcmDecoder::decodeBlock(block, bytes, whole);
+
+    for (size_t piece : { (size_t)1, (size_t)3, (size_t)77, (size_t)1000 }) {
+        ImaAdpcmDecoder dec;
+        TEST_ASSERT_TRUE(dec.begin(block, bytes));
+        int16_t out[FRAME];
+        size_t n = 0, got;
+        while ((got = dec.read(out + n, piece < FRAME - n ? piece : FRAME - n)) > 0) n += got;
+        TEST_ASSERT_EQUAL(FRAME, n);
+        TEST_ASSERT_EQUAL_INT16_ARRAY(whole, out, FRAME);
+        TEST_ASSERT_EQUAL(0, dec.read(out, 10));
+    }
+}
+
+void test_odd_count_repeats_the_last_sample(void) {
+    int16_t pcm[321];
+    for (int i = 0; i < 321; i++) pcm[i] = (int16_t)(i * 50);
+    ImaAdpcmEncoder enc;
+    uint8_t block[200];
+    size_t bytes = enc.encodeBlock(pcm, 321, block);
+    TEST_ASSERT_EQUAL(ImaAdpcmEncoder::blockBytes(321), bytes);
+    TEST_ASSERT_EQUAL(165, bytes);
+    int16_t out[322];
+    TEST_ASSERT_EQUAL(322, ImaAdpcmDecoder::decodeBlock(block, bytes, out));
+    TEST_ASSERT_INT_WITHIN(64, 16000, out[320]);
+    TEST_ASSERT_INT_WITHIN(64, 16000, out[321]);
+}
+
+void test_malformed_blocks_decode_to_nothing(void) {
+    uint8_t block[8] = { 0, 0, 0, 0, 0x12, 0x34, 0x56, 0x78 };
+    int16_t out[16];
+    TEST_ASSERT_EQUAL(0, ImaAdpcmDecoder::decodeBlock(block, 4, out));   // Header only
+    TEST_ASSERT_EQUAL(0, ImaAdpcmDecoder::decodeBlock(block, 2, out));
+    block[2] = 89;                                                         // Index out of range
+    TEST_ASSERT_EQUAL(0, ImaAdpcmDecoder::decodeBlock(block, sizeof(block), out));
+    ImaAdpcmDecoder dec;
+    TEST_ASSERT_FALSE(dec.begin(block, sizeof(block)));
+    TEST_ASSERT_EQUAL(0, dec.read(out, 16));
+    block[2] = 88;
+    TEST_ASSERT_EQUAL(8, ImaAdpcmDecoder::decodeBlock(block, sizeof(block), out));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_header_carries_the_starting_state);
+    RUN_TEST(test_codes_match_the_reference_decoder);
+    RUN_TEST(test_speech_survives_the_round_trip);
+    RUN_TEST(test_streaming_read_matches_whole_block);
+    RUN_TEST(test_odd_count_repeats_the_last_sample);
+    RUN_TEST(test_malformed_blocks_decode_to_nothing);
+    return UNITY_END();
+}
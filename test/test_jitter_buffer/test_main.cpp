@@ -0,0 +1,258 @@
+#include <unity.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "AudioRingBuffer.h"
+#include "JitterBuffer.h"
+
+// Sample n of a stream is (n % 30000) + 1, so silence (0) never looks like audio
+static void ramp(int16_t* out, size_t count, uint32_t& next) {
+    for (size_t i = 0; i < count; i++) out[i] = (int16_t)(next++ % 30000 + 1);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_ring_rounds_up_and_wraps(void) {
+    AudioRingBuffer ring;
+    TEST_ASSERT_TRUE(ring.begin(1000));
+    TEST_ASSERT_EQUAL(1024, ring.capacity());
+
+    // Odd-sized chunks so reads and writes straddle the end of the array
+    uint32_t wrote = 0, expect = 0;
+    int16_t in[700], out[700];
+    for (int round = 0; round < 200; round++) {
+        size_t n = 1 + (round * 241) % 700;
+        ramp(in, n, wrote);
+        TEST_ASSERT_EQUAL(n, ring.write(in, n));
+        TEST_ASSERT_EQUAL(n, ring.available());
+        TEST_ASSERT_EQUAL(1024 - n, ring.space());
+        TEST_ASSERT_EQUAL(n, ring.read(out, n));
+        for (size_t i = 0; i < n; i++) TEST_ASSERT_EQUAL_INT16((int16_t)(expect++ % 30000 + 1), out[i]);
+    }
+    TEST_ASSERT_EQUAL(0, ring.read(out, 1));
+}
+
+void test_fit_capacity_stays_in_budget(void) {
+    // On the host fit() grants what is wanted: the ring rounds down into it
+    TEST_ASSERT_EQUAL(16384, AudioRingBuffer::fitCapacity(20000, 9600));
+    TEST_ASSERT_EQUAL(32768, AudioRingBuffer::fitCapacity(32768, 9600));
+    TEST_ASSERT_EQUAL(32768, AudioRingBuffer::fitCapacity(64000, 9600));
+    // The minimum wins, and begin() rounds that one up as before
+    TEST_ASSERT_EQUAL(9600, AudioRingBuffer::fitCapacity(4000, 9600));
+    for (size_t wanted = 1000; wanted < 200000; wanted = wanted * 3 / 2) {
+        size_t c = AudioRingBuffer::fitCapacity(wanted, 1);
+        TEST_ASSERT_EQUAL(0, c & (c - 1));
+        TEST_ASSERT_LESS_OR_EQUAL(wanted, c);
+        TEST_ASSERT_GREATER_THAN(wanted / 2, c);
+    }
+}
+
+void test_ring_full_and_skip(void) {
+    AudioRingBuffer ring;
+    ring.begin(256);
+    int16_t in[300];
+    uint32_t next = 0;
+    ramp(in, 300, next);
+    TEST_ASSERT_EQUAL(256, ring.write(in, 300));
+    TEST_ASSERT_EQUAL(0, ring.space());
+    TEST_ASSERT_EQUAL(0, ring.write(in, 1));
+    TEST_ASSERT_EQUAL(100, ring.skip(100));
+    int16_t out[200];
+    TEST_ASSERT_EQUAL(156, ring.read(out, 200));
+    TEST_ASSERT_EQUAL_INT16(in[100], out[0]);
+    TEST_ASSERT_EQUAL_INT16(in[255], out[155]);
+    TEST_ASSERT_EQUAL(0, ring.skip(10));
+}
+
+void test_ring_indices_wrap_at_2_32(void) {
+    // Run the free-running indices past 2^32: 65537 laps of a 64K ring
+    AudioRingBuffer ring;
+    ring.begin(65536);
+    std::vector<int16_t> block(65536, 7);
+    for (uint32_t lap = 0; lap <= 65536; lap++) {
+        TEST_ASSERT_EQUAL(65536, ring.write(block.data(), 65536));
+        TEST_ASSERT_EQUAL(65536, ring.skip(65536));
+    }
+    int16_t in[100], out[100];
+    uint32_t next = 0;
+    ramp(in, 100, next);
+    ring.write(in, 60);
+    TEST_ASSERT_EQUAL(60, ring.available());
+    TEST_ASSERT_EQUAL(65536 - 60, ring.space());
+    TEST_ASSERT_EQUAL(60, ring.read(out, 100));
+    TEST_ASSERT_EQUAL_MEMORY(in, out, 60 * sizeof(int16_t));
+}
+
+void test_jitter_prebuffers_to_target(void) {
+    JitterBuffer jb;
+    TEST_ASSERT_TRUE(jb.begin(4096, 1000));
+    int16_t in[400], out[256];
+    uint32_t next = 0;
+
+    // 800 queued, still filling: silence, nothing consumed
+    for (int i = 0; i < 2; i++) {
+        ramp(in, 400, next);
+        jb.push(in, 400);
+        TEST_ASSERT_EQUAL(0, jb.pop(out, 256));
+        TEST_ASSERT_EQUAL_INT16(0, out[0]);
+        TEST_ASSERT_EQUAL_INT16(0, out[255]);
+    }
+    TEST_ASSERT_FALSE(jb.playing());
+    TEST_ASSERT_EQUAL(800, jb.depth());
+
+    ramp(in, 400, next);
+    jb.push(in, 400);
+    TEST_ASSERT_EQUAL(256, jb.pop(out, 256));
+    TEST_ASSERT_TRUE(jb.playing());
+    TEST_ASSERT_EQUAL_INT16(1, out[0]);
+    TEST_ASSERT_EQUAL_INT16(256, out[255]);
+    TEST_ASSERT_EQUAL_UINT32(512, jb.silenceSamples());
+}
+
+void test_jitter_underrun_rebuffers(void) {
+    JitterBuffer jb;
+    jb.begin(4096, 512);
+    int16_t in[600], out[256];
+    uint32_t next = 0;
+    ramp(in, 600, next);
+    jb.push(in, 600);
+
+    TEST_ASSERT_EQUAL(256, jb.pop(out, 256));
+    TEST_ASSERT_EQUAL(256, jb.pop(out, 256));
+    // 88 left: real audio, then silence to the end of the block
+    TEST_ASSERT_EQUAL(88, jb.pop(out, 256));
+    TEST_ASSERT_EQUAL_INT16(600, out[87]);
+    TEST_ASSERT_EQUAL_INT16(0, out[88]);
+    TEST_ASSERT_EQUAL_UINT32(1, jb.underruns());
+    TEST_ASSERT_FALSE(jb.playing());
+
+    // Late packet: not played until the target is queued again
+    ramp(in, 300, next);
+    jb.push(in, 300);
+    TEST_ASSERT_EQUAL(0, jb.pop(out, 256));
+    ramp(in, 300, next);
+    jb.push(in, 300);
+    TEST_ASSERT_EQUAL(256, jb.pop(out, 256));
+    TEST_ASSERT_EQUAL_INT16(601, out[0]);   // Nothing lost or repeated
+    TEST_ASSERT_EQUAL_UINT32(1, jb.underruns());
+}
+
+void test_jitter_releases_short_tail(void) {
+    // The last 300 samples of a reply never reach the 1000 target
+    JitterBuffer jb;
+    jb.begin(4096, 1000);
+    int16_t in[300], out[200];
+    uint32_t next = 0;
+    ramp(in, 300, next);
+    jb.push(in, 300);
+
+    size_t played = 0;
+    int pops = 0;
+    while (played == 0 && pops < 20) {
+        played = jb.pop(out, 200);
+        pops++;
+    }
+    // Released after about a target depth of silence with no arrivals
+    TEST_ASSERT_EQUAL(200, played);
+    TEST_ASSERT_EQUAL_INT16(1, out[0]);
+    TEST_ASSERT_LESS_OR_EQUAL(7, pops);
+    TEST_ASSERT_EQUAL(100, jb.pop(out, 200));
+}
+
+void test_jitter_flush_drops_only_older_audio(void) {
+    JitterBuffer jb;
+    jb.begin(8192, 500);
+    int16_t in[1500], out[256];
+    uint32_t next = 0;
+    ramp(in, 1500, next);
+    jb.push(in, 1500);
+    TEST_ASSERT_EQUAL(256, jb.pop(out, 256));
+
+    // Barge-in, then the next reply starts arriving before the consumer runs
+    jb.flush();
+    uint32_t fresh = 100000;
+    ramp(in, 600, fresh);
+    jb.push(in, 600);
+
+    TEST_ASSERT_TRUE(jb.applyFlush());
+    TEST_ASSERT_FALSE(jb.applyFlush());
+    TEST_ASSERT_EQUAL(600, jb.depth());
+    TEST_ASSERT_FALSE(jb.playing());
+    TEST_ASSERT_EQUAL(256, jb.pop(out, 256));
+    TEST_ASSERT_EQUAL_INT16(in[0], out[0]);
+}
+
+void test_jitter_counts_overrun(void) {
+    JitterBuffer jb;
+    jb.begin(1024, 256);
+    std::vector<int16_t> in(1500, 5);
+    TEST_ASSERT_EQUAL(1024, jb.space());
+    TEST_ASSERT_EQUAL(1024, jb.push(in.data(), 1500));
+    TEST_ASSERT_EQUAL_UINT32(476, jb.overrunSamples());
+    TEST_ASSERT_EQUAL(0, jb.space());
+
+    // A producer that waits for space() before pushing loses nothing
+    std::vector<int16_t> out(256);
+    jb.pop(out.data(), 256);
+    TEST_ASSERT_EQUAL(256, jb.space());
+    TEST_ASSERT_EQUAL(256, jb.push(in.data(), 256));
+    TEST_ASSERT_EQUAL_UINT32(476, jb.overrunSamples());
+}
+
+// Bursty producer thread, steady consumer thread: every real sample comes
+// out once and in order
+void test_jitter_two_threads(void) {
+    JitterBuffer jb;
+    jb.begin(8192, 1200);
+    const uint32_t TOTAL = 400000;
+    std::atomic<bool> done(false);
+
+    std::thread producer([&] {
+        uint32_t next = 0;
+        int16_t burst[900];
+        while (next < TOTAL) {
+            size_t n = 100 + next % 800;
+            if (n > TOTAL - next) n = TOTAL - next;
+            // Waits for room like playReceived(), so the sequence stays whole
+            while (jb.space() < n) std::this_thread::yield();
+            ramp(burst, n, next);
+            jb.push(burst, n);
+        }
+        done = true;
+    });
+
+    uint32_t expect = 0;
+    int16_t out[256];
+    bool ordered = true;
+    while (expect < TOTAL) {
+        size_t got = jb.pop(out, 256);
+        for (size_t i = 0; i < got; i++) {
+            if (out[i] != (int16_t)(expect % 30000 + 1)) ordered = false;
+            expect++;
+        }
+        if (got == 0) std::this_thread::yield();
+    }
+    producer.join();
+    TEST_ASSERT_TRUE(done);
+    TEST_ASSERT_TRUE(ordered);
+    TEST_ASSERT_EQUAL_UINT32(TOTAL, expect);
+    TEST_ASSERT_EQUAL_UINT32(0, jb.overrunSamples());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_ring_rounds_up_and_wraps);
+    RUN_TEST(test_fit_capacity_stays_in_budget);
+    RUN_TEST(test_ring_full_and_skip);
+    RUN_TEST(test_ring_indices_wrap_at_2_32);
+    RUN_TEST(test_jitter_prebuffers_to_target);
+    RUN_TEST(test_jitter_underrun_rebuffers);
+    RUN_TEST(test_jitter_releases_short_tail);
+    RUN_TEST(test_jitter_flush_drops_only_older_audio);
+    RUN_TEST(test_jitter_counts_overrun);
+    RUN_TEST(test_jitter_two_threads);
+    return UNITY_END();
+}
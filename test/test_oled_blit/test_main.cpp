@@ -0,0 +1,100 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "OledFlush.h"
+#include "../fixtures/birthday_cake_frames.h"
+#include "../fixtures/frame_layout.h"
+
+static uint8_t reference[OLED_BUFFER_SIZE];
+static uint8_t blitted[OLED_BUFFER_SIZE];
+
+// What the sketches did before: clearDisplay() then Adafruit_GFX::drawBitmap,
+// one drawPixel() per lit bit into the SSD1306 page buffer
+static void drawPixel(uint8_t* buf, int16_t x, int16_t y) {
+    if (x < 0 || y < 0 || x >= OLED_WIDTH || y >= OLED_HEIGHT) return;
+    buf[x + (y / 8) * OLED_WIDTH] |= 1 << (y & 7);
+}
+
+static void drawBitmap(uint8_t* buf, const uint8_t* bitmap, int16_t w, int16_t h) {
+    memset(buf, 0, OLED_BUFFER_SIZE);
+    int16_t byteWidth = (w + 7) / 8;
+    uint8_t b = 0;
+    for (int16_t j = 0; j < h; j++) {
+        for (int16_t i = 0; i < w; i++) {
+            if (i & 7) {
+                b <<= 1;
+            } else {
+                b = bitmap[j * byteWidth + i / 8];
+            }
+            if (b & 0x80) drawPixel(buf, i, j);
+        }
+    }
+}
+
+void setUp(void) {
+    memset(blitted, 0xA5, sizeof(blitted));   // Stale pixels must be overwritten
+}
+
+void tearDown(void) {}
+
+void test_blit_rows_matches_draw_bitmap_on_cake(void) {
+    for (uint16_t i = 0; i < CAKE_FRAME_COUNT; i++) {
+        drawBitmap(reference, cakeFrames[i], OLED_WIDTH, OLED_HEIGHT);
+        oledBlitRows(blitted, cakeFrames[i]);
+        TEST_ASSERT_EQUAL_MEMORY(reference, blitted, OLED_BUFFER_SIZE);
+    }
+}
+
+void test_blit_rows_matches_draw_bitmap_on_every_byte_value(void) {
+    // Each 8x8 block gets a different mix of byte values in every position
+    uint8_t rows[OLED_BUFFER_SIZE];
+    for (int seed = 0; seed < 8; seed++) {
+        for (int i = 0; i < OLED_BUFFER_SIZE; i++) rows[i] = (uint8_t)(i * 37 + seed * 101 + (i >> 4));
+        drawBitmap(reference, rows, OLED_WIDTH, OLED_HEIGHT);
+        oledBlitRows(blitted, rows);
+        TEST_ASSERT_EQUAL_MEMORY(reference, blitted, OLED_BUFFER_SIZE);
+    }
+}
+
+void test_blit_pages_is_a_copy(void) {
+    uint8_t pages[OLED_BUFFER_SIZE];
+    rowsToPages(cakeFrames[7], pages);
+    oledBlit(blitted, pages);
+    drawBitmap(reference, cakeFrames[7], OLED_WIDTH, OLED_HEIGHT);
+    TEST_ASSERT_EQUAL_MEMORY(reference, blitted, OLED_BUFFER_SIZE);
+}
+
+void test_blit_speed(void) {
+    // Reported, not asserted: host timings say little about the ESP32
+    const int N = 5000;
+    volatile uint8_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < N; n++) {
+        drawBitmap(reference, cakeFrames[n % CAKE_FRAME_COUNT], OLED_WIDTH, OLED_HEIGHT);
+        sink ^= reference[n & 1023];
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int n = 0; n < N; n++) {
+        oledBlitRows(blitted, cakeFrames[n % CAKE_FRAME_COUNT]);
+        sink ^= blitted[n & 1023];
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    double drawUs = std::chrono::duration<double, std::micro>(t1 - t0).count() / N;
+    double blitUs = std::chrono::duration<double, std::micro>(t2 - t1).count() / N;
+
+    char line[96];
+    snprintf(line, sizeof(line), "drawBitmap %.2f us/frame, oledBlitRows %.2f us/frame", drawUs, blitUs);
+    TEST_MESSAGE(line);
+    (void)sink;
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_blit_rows_matches_draw_bitmap_on_cake);
+    RUN_TEST(test_blit_rows_matches_draw_bitmap_on_every_byte_value);
+    RUN_TEST(test_blit_pages_is_a_copy);
+    RUN_TEST(test_blit_speed);
+    return UNITY_END();
+}
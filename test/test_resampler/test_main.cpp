@@ -0,0 +1,160 @@
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+#include "Resampler.h"
+
+struct Ratio {
+    uint32_t in, out;
+};
+
+static const Ratio RATIOS[] = { { 24000, 16000 }, { 16000, 24000 }, { 48000, 16000 },
+                                { 44100, 22050 }, { 8000, 24000 } };
+
+static std::vector<int16_t> tone(double hz, uint32_t rate, size_t count, double amplitude = 16000) {
+    std::vector<int16_t> v(count);
+    for (size_t i = 0; i < count; i++) v[i] = (int16_t)lround(amplitude * sin(2 * M_PI * hz * i / rate));
+    return v;
+}
+
+// Streams `in` through `r` in `chunk`-sized calls, the way the mic path does
+static std::vector<int16_t> run(Resampler& r, const std::vector<int16_t>& in, size_t chunk) {
+    std::vector<int16_t> out(r.maxOutput(in.size()));
+    r.reset();
+    size_t produced = 0;
+    for (size_t pos = 0; pos < in.size(); pos += chunk) {
+        size_t n = in.size() - pos < chunk ? in.size() - pos : chunk;
+        produced += r.process(&in[pos], n, &out[produced]);
+    }
+    out.resize(produced);
+    return out;
+}
+
+// Least-squares fit of a sine at `hz`; returns signal-to-residual in dB.
+// The first and last `skip` samples (filter warm-up) are left out.
+static double snrDb(const std::vector<int16_t>& y, double hz, uint32_t rate, size_t skip) {
+    double ss = 0, cc = 0, sc = 0, ys = 0, yc = 0;
+    for (size_t n = skip; n < y.size() - skip; n++) {
+        double s = sin(2 * M_PI * hz * n / rate), c = cos(2 * M_PI * hz * n / rate);
+        ss += s * s;
+        cc += c * c;
+        sc += s * c;
+        ys += y[n] * s;
+        yc += y[n] * c;
+    }
+    double det = ss * cc - sc * sc;
+    double a = (ys * cc - yc * sc) / det, b = (yc * ss - ys * sc) / det;
+    double sig = 0, err = 0;
+    for (size_t n = skip; n < y.size() - skip; n++) {
+        double m = a * sin(2 * M_PI * hz * n / rate) + b * cos(2 * M_PI * hz * n / rate);
+        sig += m * m;
+        err += (y[n] - m) * (y[n] - m);
+    }
+    return 10 * log10(sig / err);
+}
+
+static double levelDb(const std::vector<int16_t>& y, size_t skip, double reference) {
+    double sum = 0;
+    for (size_t n = skip; n < y.size(); n++) sum += (double)y[n] * y[n];
+    return 20 * log10(sqrt(sum / (y.size() - skip)) / (reference / sqrt(2)));
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_rejects_unsupported_ratios(void) {
+    Resampler r;
+    TEST_ASSERT_FALSE(r.begin(0, 16000));
+    TEST_ASSERT_FALSE(r.begin(16000, 0));
+    TEST_ASSERT_FALSE(r.begin(16001, 16000));   // 16001/16000 after reduction
+    TEST_ASSERT_TRUE(r.begin(16000, 16000));
+    TEST_ASSERT_TRUE(r.passthrough());
+}
+
+void test_equal_rates_copy(void) {
+    Resampler r;
+    r.begin(16000, 16000);
+    std::vector<int16_t> in = tone(1000, 16000, 1000);
+    std::vector<int16_t> out = run(r, in, 333);
+    TEST_ASSERT_EQUAL(in.size(), out.size());
+    TEST_ASSERT_EQUAL_INT16_ARRAY(in.data(), out.data(), in.size());
+}
+
+void test_output_length_tracks_the_ratio(void) {
+    for (const Ratio& c : RATIOS) {
+        Resampler r;
+        TEST_ASSERT_TRUE(r.begin(c.in, c.out));
+        // Odd chunk sizes: the phase must carry across calls, no drift
+        for (size_t chunk : { (size_t)1, (size_t)97, (size_t)333, (size_t)4096 }) {
+            std::vector<int16_t> in(c.in * 3 + 7);
+            std::vector<int16_t> out = run(r, in, chunk);
+            double exact = (double)in.size() * c.out / c.in;
+            TEST_ASSERT_TRUE(fabs(out.size() - exact) <= 1.0);
+        }
+    }
+}
+
+void test_chunking_does_not_change_the_output(void) {
+    for (const Ratio& c : RATIOS) {
+        Resampler r;
+        r.begin(c.in, c.out);
+        std::vector<int16_t> in = tone(700, c.in, c.in);
+        std::vector<int16_t> whole = run(r, in, in.size());
+        std::vector<int16_t> pieces = run(r, in, 61);
+        TEST_ASSERT_EQUAL(whole.size(), pieces.size());
+        TEST_ASSERT_EQUAL_INT16_ARRAY(whole.data(), pieces.data(), whole.size());
+    }
+}
+
+void test_tones_come_through_clean(void) {
+    // Q14 taps, 32-bit accumulator: the residual stays near 16-bit rounding
+    char msg[80];
+    for (const Ratio& c : RATIOS) {
+        Resampler r;
+        r.begin(c.in, c.out);
+        for (double hz : { 440.0, 1000.0, 3000.0 }) {
+            std::vector<int16_t> out = run(r, tone(hz, c.in, c.in * 2), 333);
+            double snr = snrDb(out, hz, c.out, 200);
+            snprintf(msg, sizeof(msg), "%u->%u %.0fHz: %.1f dB", (unsigned)c.in, (unsigned)c.out, hz, snr);
+            TEST_ASSERT_TRUE_MESSAGE(snr >= 60.0, msg);
+        }
+    }
+}
+
+void test_passband_is_flat(void) {
+    for (const Ratio& c : RATIOS) {
+        Resampler r;
+        r.begin(c.in, c.out);
+        uint32_t low = c.in < c.out ? c.in : c.out;
+        for (double f : { 0.3 * low, 0.4 * low }) {
+            std::vector<int16_t> out = run(r, tone(f, c.in, c.in), c.in);
+            TEST_ASSERT_TRUE(fabs(levelDb(out, 200, 16000)) < 0.1);
+        }
+    }
+}
+
+void test_decimation_rejects_aliases(void) {
+    for (const Ratio& c : RATIOS) {
+        if (c.in <= c.out) continue;
+        Resampler r;
+        r.begin(c.in, c.out);
+        // Well inside the stopband: would fold back into the voice band
+        for (double f : { c.out * 0.5 + 3000.0, c.out * 0.8 }) {
+            std::vector<int16_t> out = run(r, tone(f, c.in, c.in), c.in);
+            TEST_ASSERT_LESS_THAN(-60, (int)levelDb(out, 200, 16000));
+        }
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_rejects_unsupported_ratios);
+    RUN_TEST(test_equal_rates_copy);
+    RUN_TEST(test_output_length_tracks_the_ratio);
+    RUN_TEST(test_chunking_does_not_change_the_output);
+    RUN_TEST(test_tones_come_through_clean);
+    RUN_TEST(test_passband_is_flat);
+    RUN_TEST(test_decimation_rejects_aliases);
+    return UNITY_END();
+}
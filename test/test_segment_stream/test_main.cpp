@@ -0,0 +1,160 @@
+#include <unity.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "SegmentStream.h"
+#include "WavWriter.h"
+
+// The upload body the recorder sends: multipart preamble, WAV header,
+// the recording, closing boundary
+static const char* BOUNDARY = "------------------------Esp32Boundary";
+
+struct Upload {
+    String head;
+    uint8_t wav[WavWriter::HEADER_SIZE];
+    std::vector<uint8_t> pcm;
+    String tail;
+    SegmentStream body;
+
+    explicit Upload(size_t pcmBytes) : pcm(pcmBytes) {
+        head = String("--") + BOUNDARY + "\r\n" +
+               "Content-Disposition: form-data; name=\"audio\"; filename=\"esp32.wav\"\r\n" +
+               "Content-Type: audio/wav\r\n\r\n";
+        tail = String("\r\n--") + BOUNDARY + "--\r\n";
+        uint32_t seed = 99;
+        for (uint8_t& b : pcm) {
+            seed = seed * 1664525u + 1013904223u;
+            b = (uint8_t)(seed >> 24);
+        }
+        WavWriter::header(wav, 16000, 1, 16, (uint32_t)pcm.size());
+        body.add(head);
+        body.add(wav, sizeof(wav));
+        body.add(pcm.data(), pcm.size());
+        body.add(tail);
+    }
+
+    std::string expected() const {
+        std::string s(head.c_str(), head.length());
+        s.append((const char*)wav, sizeof(wav));
+        s.append((const char*)pcm.data(), pcm.size());
+        s.append(tail.c_str(), tail.length());
+        return s;
+    }
+};
+
+// Pulls the body the way HTTPClient::sendRequest() does: available(), then
+// readBytes() of at most a buffer's worth. `sizes` cycles.
+static std::string pull(Stream& s, const std::vector<size_t>& sizes) {
+    std::string out;
+    size_t most = 0;
+    for (size_t n : sizes) most = n > most ? n : most;
+    std::vector<char> buf(most);
+    size_t i = 0;
+    while (s.available() > 0) {
+        size_t want = sizes[i++ % sizes.size()];
+        if (want > (size_t)s.available()) want = s.available();
+        int before = s.available();
+        size_t got = s.readBytes(buf.data(), want);
+        TEST_ASSERT_EQUAL(want, got);
+        TEST_ASSERT_EQUAL(before - (int)got, s.available());
+        out.append(buf.data(), got);
+    }
+    return out;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_segmented_reads_match_the_joined_body(void) {
+    Upload u(32000);
+    std::string expected = u.expected();
+    TEST_ASSERT_EQUAL(expected.size(), u.body.size());
+    TEST_ASSERT_EQUAL((int)expected.size(), u.body.available());
+
+    // TCP-sized, tiny, and sizes that end exactly on segment boundaries
+    const std::vector<size_t> patterns[] = {
+        { 1460 }, { 1 }, { 7, 3, 1000, 13 }, { u.head.length(), WavWriter::HEADER_SIZE, u.pcm.size(), 4096 },
+        { u.head.length() - 1, 2, WavWriter::HEADER_SIZE + 5 }, { 4096 } };
+    for (const std::vector<size_t>& sizes : patterns) {
+        u.body.rewind();
+        std::string got = pull(u.body, sizes);
+        TEST_ASSERT_EQUAL(expected.size(), got.size());
+        TEST_ASSERT_TRUE(got == expected);
+        TEST_ASSERT_EQUAL(0, u.body.readBytes((char*)NULL, 0));
+        char c;
+        TEST_ASSERT_EQUAL(0, u.body.readBytes(&c, 1));
+    }
+}
+
+void test_byte_reads_and_peek(void) {
+    Upload u(333);
+    std::string expected = u.expected();
+    std::string got;
+    int c;
+    while ((c = u.body.peek()) >= 0) {
+        TEST_ASSERT_EQUAL(c, u.body.read());
+        got.push_back((char)c);
+    }
+    TEST_ASSERT_EQUAL(-1, u.body.read());
+    TEST_ASSERT_EQUAL(0, u.body.available());
+    TEST_ASSERT_TRUE(got == expected);
+}
+
+void test_body_parses_as_multipart_wav(void) {
+    Upload u(16000 * 2);
+    std::string body = pull(u.body, { 1460 });
+
+    // Opening delimiter, part headers, blank line
+    std::string delimiter = std::string("--") + BOUNDARY;
+    TEST_ASSERT_EQUAL(0, body.find(delimiter + "\r\n"));
+    size_t headersEnd = body.find("\r\n\r\n");
+    TEST_ASSERT_TRUE(headersEnd != std::string::npos);
+    std::string headers = body.substr(delimiter.size() + 2, headersEnd - delimiter.size() - 2);
+    TEST_ASSERT_TRUE(headers.find("Content-Disposition: form-data; name=\"audio\"; filename=\"esp32.wav\"") != std::string::npos);
+    TEST_ASSERT_TRUE(headers.find("Content-Type: audio/wav") != std::string::npos);
+
+    // The part runs to CRLF + closing delimiter, which ends the body
+    std::string closing = "\r\n" + delimiter + "--\r\n";
+    TEST_ASSERT_EQUAL(body.size() - closing.size(), body.rfind(closing));
+    size_t partStart = headersEnd + 4;
+    std::string part = body.substr(partStart, body.size() - closing.size() - partStart);
+    // The delimiter must not occur inside the part
+    TEST_ASSERT_TRUE(part.find("\r\n" + delimiter) == std::string::npos);
+
+    // The part is a WAV whose data chunk is exactly the recording
+    const uint8_t* w = (const uint8_t*)part.data();
+    TEST_ASSERT_EQUAL_MEMORY("RIFF", w, 4);
+    TEST_ASSERT_EQUAL_MEMORY("WAVE", w + 8, 4);
+    uint32_t riff = w[4] | (w[5] << 8) | (w[6] << 16) | ((uint32_t)w[7] << 24);
+    TEST_ASSERT_EQUAL_UINT32(part.size() - 8, riff);
+    TEST_ASSERT_EQUAL_MEMORY("data", w + 36, 4);
+    uint32_t dataBytes = w[40] | (w[41] << 8) | (w[42] << 16) | ((uint32_t)w[43] << 24);
+    TEST_ASSERT_EQUAL_UINT32(u.pcm.size(), dataBytes);
+    TEST_ASSERT_EQUAL(WavWriter::HEADER_SIZE + u.pcm.size(), part.size());
+    TEST_ASSERT_EQUAL_MEMORY(u.pcm.data(), w + WavWriter::HEADER_SIZE, u.pcm.size());
+}
+
+void test_segment_limit_and_empty_segments(void) {
+    SegmentStream s;
+    uint8_t data[3] = { 1, 2, 3 };
+    TEST_ASSERT_TRUE(s.add(data, 0));   // Empty ones take no slot
+    for (uint8_t i = 0; i < SegmentStream::MAX_SEGMENTS; i++) TEST_ASSERT_TRUE(s.add(data, 3));
+    TEST_ASSERT_FALSE(s.add(data, 3));
+    TEST_ASSERT_EQUAL(3 * SegmentStream::MAX_SEGMENTS, s.size());
+    TEST_ASSERT_EQUAL(0, s.write('x'));
+
+    SegmentStream empty;
+    TEST_ASSERT_EQUAL(0, empty.available());
+    TEST_ASSERT_EQUAL(-1, empty.peek());
+    TEST_ASSERT_EQUAL(-1, empty.read());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_segmented_reads_match_the_joined_body);
+    RUN_TEST(test_byte_reads_and_peek);
+    RUN_TEST(test_body_parses_as_multipart_wav);
+    RUN_TEST(test_segment_limit_and_empty_segments);
+    return UNITY_END();
+}
@@ -0,0 +1,194 @@
+#include <unity.h>
+#include <string.h>
+#include <vector>
+
+#include "UplinkPacketizer.h"
+
+static const uint32_t RATE = 16000;
+
+struct Packet {
+    std::vector<uint8_t> bytes;
+    uint16_t seq() const { return bytes[2] | (bytes[3] << 8); }
+    uint32_t timestamp() const {
+        return bytes[4] | (bytes[5] << 8) | (bytes[6] << 16) | ((uint32_t)bytes[7] << 24);
+    }
+    uint16_t samples() const { return bytes[8] | (bytes[9] << 8); }
+    uint8_t flags() const { return bytes[10]; }
+};
+
+// Feeds `count` ramp samples in `chunk`-sized writes, collecting packets
+static void feed(UplinkPacketizer& p, std::vector<Packet>& out, uint32_t& next, size_t count, size_t chunk) {
+    std::vector<int16_t> buf(chunk);
+    while (count > 0) {
+        size_t n = count < chunk ? count : chunk;
+        for (size_t i = 0; i < n; i++) buf[i] = (int16_t)(next + i);
+        const int16_t* at = buf.data();
+        size_t left = n;
+        while (left > 0) {
+            size_t used = p.write(at, left);
+            at += used;
+            left -= used;
+            if (p.ready()) {
+                out.push_back(Packet{ std::vector<uint8_t>(p.packet(), p.packet() + p.packetLength()) });
+                p.consume();
+            }
+        }
+        next += (uint32_t)n;
+        count -= n;
+    }
+}
+
+static void finish(UplinkPacketizer& p, std::vector<Packet>& out) {
+    p.finish();
+    TEST_ASSERT_TRUE(p.ready());
+    out.push_back(Packet{ std::vector<uint8_t>(p.packet(), p.packet() + p.packetLength()) });
+    p.consume();
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_frames_carry_seq_timestamp_and_count(void) {
+    UplinkPacketizer p;
+    TEST_ASSERT_TRUE(p.begin(RATE, CODEC_PCM16, 20));
+    std::vector<Packet> out;
+    uint32_t next = 0;
+    feed(p, out, next, 320 * 5 + 100, 137);   // Mic blocks never line up with frames
+    TEST_ASSERT_EQUAL(5, out.size());
+    finish(p, out);
+
+    for (size_t i = 0; i < out.size(); i++) {
+        const Packet& k = out[i];
+        TEST_ASSERT_EQUAL_UINT8(UPLINK_VERSION, k.bytes[0]);
+        TEST_ASSERT_EQUAL_UINT8(CODEC_PCM16, k.bytes[1]);
+        TEST_ASSERT_EQUAL_UINT16(i, k.seq());
+        TEST_ASSERT_EQUAL_UINT32(i * 320, k.timestamp());
+        TEST_ASSERT_EQUAL_UINT8(0, k.bytes[11]);
+        size_t n = i < 5 ? 320 : 100;
+        TEST_ASSERT_EQUAL_UINT16(n, k.samples());
+        TEST_ASSERT_EQUAL(UPLINK_HEADER_SIZE + n * 2, k.bytes.size());
+        TEST_ASSERT_EQUAL_UINT8(i < 5 ? 0 : UPLINK_FLAG_LAST, k.flags());
+        // Payload is the samples in order, little-endian
+        for (size_t s = 0; s < n; s++) {
+            int16_t v = (int16_t)(k.bytes[UPLINK_HEADER_SIZE + 2 * s] | (k.bytes[UPLINK_HEADER_SIZE + 2 * s + 1] << 8));
+            TEST_ASSERT_EQUAL_INT16((int16_t)(i * 320 + s), v);
+        }
+    }
+}
+
+void test_reset_restarts_the_turn(void) {
+    UplinkPacketizer p;
+    p.begin(RATE, CODEC_PCM16, 40);
+    std::vector<Packet> out;
+    uint32_t next = 0;
+    feed(p, out, next, 640 * 3 + 5, 640);
+    p.reset();
+    out.clear();
+    feed(p, out, next, 640, 640);
+    TEST_ASSERT_EQUAL(1, out.size());
+    TEST_ASSERT_EQUAL_UINT16(0, out[0].seq());
+    TEST_ASSERT_EQUAL_UINT32(0, out[0].timestamp());
+    TEST_ASSERT_EQUAL_UINT16(640, out[0].samples());
+
+    // Nothing pending: the last frame is empty but still flagged
+    finish(p, out);
+    TEST_ASSERT_EQUAL_UINT16(0, out[1].samples());
+    TEST_ASSERT_EQUAL_UINT8(UPLINK_FLAG_LAST, out[1].flags());
+    TEST_ASSERT_EQUAL(UPLINK_HEADER_SIZE, out[1].bytes.size());
+}
+
+void test_discontinuity_marks_one_frame(void) {
+    UplinkPacketizer p;
+    p.begin(RATE, CODEC_PCM16, 20);
+    std::vector<Packet> out;
+    uint32_t next = 0;
+    feed(p, out, next, 100, 100);
+    p.markDiscontinuity();
+    feed(p, out, next, 540, 100);
+    TEST_ASSERT_EQUAL(2, out.size());
+    TEST_ASSERT_EQUAL_UINT8(UPLINK_FLAG_DISCONTINUITY, out[0].flags());
+    TEST_ASSERT_EQUAL_UINT8(0, out[1].flags());
+}
+
+void test_adpcm_frames_hold_one_block(void) {
+    UplinkPacketizer p;
+    p.begin(RATE, CODEC_IMA_ADPCM, 20);
+    std::vector<Packet> out;
+    uint32_t next = 0;
+    feed(p, out, next, 320 * 2 + 51, 256);
+    finish(p, out);
+    TEST_ASSERT_EQUAL(3, out.size());
+    TEST_ASSERT_EQUAL_UINT8(CODEC_IMA_ADPCM, out[0].bytes[1]);
+    TEST_ASSERT_EQUAL(UPLINK_HEADER_SIZE + ImaAdpcmEncoder::blockBytes(320), out[0].bytes.size());
+    TEST_ASSERT_EQUAL_UINT16(51, out[2].samples());
+    TEST_ASSERT_EQUAL(UPLINK_HEADER_SIZE + ImaAdpcmEncoder::blockBytes(51), out[2].bytes.size());
+
+    // Each block decodes on its own, to about the ramp that went in
+    int16_t pcm[320];
+    const Packet& second = out[1];
+    size_t n = ImaAdpcmDecoder::decodeBlock(&second.bytes[UPLINK_HEADER_SIZE],
+                                            second.bytes.size() - UPLINK_HEADER_SIZE, pcm);
+    TEST_ASSERT_EQUAL(320, n);
+    TEST_ASSERT_INT_WITHIN(40, 320 + 319, pcm[319]);
+}
+
+void test_headerless_packets_are_plain_pcm(void) {
+    // What a server without "UPLINK:framed" receives
+    UplinkPacketizer p;
+    p.begin(RATE, CODEC_PCM16, 20);
+    p.setHeader(false);
+    std::vector<Packet> out;
+    uint32_t next = 0;
+    feed(p, out, next, 320 * 2 + 10, 200);
+    TEST_ASSERT_EQUAL(2, out.size());
+    finish(p, out);
+
+    std::vector<int16_t> joined;
+    for (const Packet& k : out) {
+        TEST_ASSERT_EQUAL(0, k.bytes.size() % 2);
+        for (size_t i = 0; i < k.bytes.size(); i += 2) joined.push_back((int16_t)(k.bytes[i] | (k.bytes[i + 1] << 8)));
+    }
+    TEST_ASSERT_EQUAL(650, joined.size());
+    for (size_t i = 0; i < joined.size(); i++) TEST_ASSERT_EQUAL_INT16((int16_t)i, joined[i]);
+
+    // An empty last frame is an empty packet (the streamer skips it)
+    p.reset();
+    p.finish();
+    TEST_ASSERT_TRUE(p.ready());
+    TEST_ASSERT_EQUAL(0, p.packetLength());
+    p.consume();
+
+    // Back on: headers again from the next frame
+    p.setHeader(true);
+    out.clear();
+    feed(p, out, next, 320, 320);
+    TEST_ASSERT_EQUAL(UPLINK_HEADER_SIZE + 640, out[0].bytes.size());
+    TEST_ASSERT_EQUAL_UINT8(UPLINK_VERSION, out[0].bytes[0]);
+}
+
+void test_sequence_wraps(void) {
+    UplinkPacketizer p;
+    p.begin(8000, CODEC_PCM16, 20);   // 160 samples a frame
+    std::vector<Packet> out;
+    std::vector<int16_t> frame(160);
+    for (uint32_t i = 0; i < 65537; i++) {
+        p.write(frame.data(), 160);
+        TEST_ASSERT_TRUE(p.ready());
+        if (i >= 65535) out.push_back(Packet{ std::vector<uint8_t>(p.packet(), p.packet() + p.packetLength()) });
+        p.consume();
+    }
+    TEST_ASSERT_EQUAL_UINT16(65535, out[0].seq());
+    TEST_ASSERT_EQUAL_UINT16(0, out[1].seq());
+    TEST_ASSERT_EQUAL_UINT32(65536u * 160, out[1].timestamp());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_frames_carry_seq_timestamp_and_count);
+    RUN_TEST(test_reset_restarts_the_turn);
+    RUN_TEST(test_discontinuity_marks_one_frame);
+    RUN_TEST(test_adpcm_frames_hold_one_block);
+    RUN_TEST(test_headerless_packets_are_plain_pcm);
+    RUN_TEST(test_sequence_wraps);
+    return UNITY_END();
+}
@@ -0,0 +1,175 @@
+#include <unity.h>
+#include <stdio.h>
+#include <vector>
+
+#include "VoiceActivityDetector.h"
+#include "../fixtures/speech.h"
+
+static const uint32_t RATE = 16000;
+static const uint16_t HANGOVER_MS = 400;
+
+struct Events {
+    std::vector<uint32_t> starts;   // ms at the end of the chunk that raised it
+    std::vector<uint32_t> ends;
+    std::vector<uint32_t> endQuietMs;
+    std::vector<bool> speaking;     // Per 10ms chunk
+};
+
+// Runs `a` through the detector in 10ms chunks, as the mic task delivers it
+static Events run(VoiceActivityDetector& vad, const LabelledAudio& a) {
+    Events e;
+    const size_t chunk = RATE / 100;
+    for (size_t pos = 0; pos + chunk <= a.pcm.size(); pos += chunk) {
+        uint8_t ev = vad.process(&a.pcm[pos], chunk);
+        uint32_t ms = (uint32_t)((pos + chunk) * 1000 / RATE);
+        if (ev & VoiceActivityDetector::VAD_SPEECH_START) e.starts.push_back(ms);
+        if (ev & VoiceActivityDetector::VAD_SPEECH_END) {
+            e.ends.push_back(ms);
+            e.endQuietMs.push_back(vad.quietMs());
+        }
+        e.speaking.push_back(vad.speaking());
+    }
+    return e;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_log2q8(void) {
+    TEST_ASSERT_EQUAL_INT16(0, VoiceActivityDetector::log2q8(0));
+    TEST_ASSERT_EQUAL_INT16(0, VoiceActivityDetector::log2q8(1));
+    TEST_ASSERT_EQUAL_INT16(256, VoiceActivityDetector::log2q8(2));
+    TEST_ASSERT_EQUAL_INT16(384, VoiceActivityDetector::log2q8(3));
+    TEST_ASSERT_EQUAL_INT16(31 * 256, VoiceActivityDetector::log2q8(0x80000000u));
+    for (uint32_t v = 1; v < 0x7FFFFFFF; v = v * 3 + 1) {
+        int16_t q = VoiceActivityDetector::log2q8(v);
+        TEST_ASSERT_TRUE(fabs(q / 256.0 - log2((double)v)) < 0.1);
+    }
+}
+
+void test_learned_floor_is_the_rounded_mean(void) {
+    // Ten frames of hiss at different levels: after learning, the floor is
+    // their mean energy, not a running mean that truncated at every step
+    VoiceActivityDetector vad;
+    vad.begin(RATE, HANGOVER_MS);
+    FixtureNoise noise(3);
+    const int levels[10] = { 900, 300, 310, 320, 305, 330, 295, 315, 300, 325 };
+    int32_t sum = 0;
+    std::vector<int16_t> frame(RATE / 50);
+    for (int f = 0; f < 10; f++) {
+        for (size_t i = 0; i < frame.size(); i++) frame[i] = (int16_t)lrint(noise.gauss() * levels[f]);
+        vad.process(frame.data(), frame.size());
+        sum += vad.energy();
+    }
+    TEST_ASSERT_EQUAL_INT16((int16_t)((sum + 5) / 10), vad.noiseFloor());
+    TEST_ASSERT_FALSE(vad.speaking());
+}
+
+void test_hiss_alone_is_never_speech(void) {
+    VoiceActivityDetector vad;
+    vad.begin(RATE, HANGOVER_MS);
+    LabelledAudio a = speechFixture(RATE, { { 5000, PART_QUIET, 0 } }, 120);
+    Events e = run(vad, a);
+    TEST_ASSERT_EQUAL(0, e.starts.size());
+}
+
+void test_onset_and_hangover(void) {
+    VoiceActivityDetector vad;
+    vad.begin(RATE, HANGOVER_MS);
+    LabelledAudio a = speechFixture(RATE, { { 600, PART_QUIET, 0 }, { 2030, PART_TALK, 6000 },
+                                            { 1200, PART_QUIET, 0 } });
+    Events e = run(vad, a);
+    const Span& talk = a.talk[0];
+
+    // One turn: the 80ms pauses between syllables do not end it
+    TEST_ASSERT_EQUAL(1, e.starts.size());
+    TEST_ASSERT_EQUAL(1, e.ends.size());
+
+    // Starts within the first syllable: after its fricative began, no later
+    // than two frames into the vowel (plus the chunk it was reported in)
+    TEST_ASSERT_GREATER_OR_EQUAL(talk.startMs, e.starts[0]);
+    TEST_ASSERT_LESS_OR_EQUAL(a.syllables[0].startMs + 60, e.starts[0]);
+
+    // Ends one hangover after the last vowel, and says so
+    char msg[64];
+    snprintf(msg, sizeof(msg), "talk ends %u, VAD end %u", (unsigned)talk.endMs, (unsigned)e.ends[0]);
+    TEST_ASSERT_INT_WITHIN_MESSAGE(60, talk.endMs + HANGOVER_MS, e.ends[0], msg);
+    TEST_ASSERT_INT_WITHIN(60, HANGOVER_MS, e.endQuietMs[0]);
+
+    // Speaking throughout the talk
+    for (uint32_t ms = a.syllables[0].startMs + 60; ms < talk.endMs; ms += 10) {
+        TEST_ASSERT_TRUE(e.speaking[ms / 10]);
+    }
+}
+
+void test_two_utterances_two_turns(void) {
+    // A pause longer than the hangover splits them
+    VoiceActivityDetector vad;
+    vad.begin(RATE, HANGOVER_MS);
+    LabelledAudio a = speechFixture(RATE, { { 500, PART_QUIET, 0 }, { 870, PART_TALK, 5000 },
+                                            { 900, PART_QUIET, 0 }, { 870, PART_TALK, 5000 },
+                                            { 800, PART_QUIET, 0 } });
+    Events e = run(vad, a);
+    TEST_ASSERT_EQUAL(2, e.starts.size());
+    TEST_ASSERT_EQUAL(2, e.ends.size());
+    TEST_ASSERT_GREATER_OR_EQUAL(a.talk[1].startMs, e.starts[1]);
+    TEST_ASSERT_LESS_THAN(a.talk[1].startMs, e.ends[0]);
+}
+
+// Low-passed noise like the fixture's NOISE parts, added on top of `a`
+static void addFan(LabelledAudio& a, int rms, uint32_t seed) {
+    FixtureNoise n(seed);
+    double lp = 0;
+    for (size_t i = 0; i < a.pcm.size(); i++) {
+        lp += 0.2 * (n.gauss() - lp);
+        double s = a.pcm[i] + lp * rms * 3.0;
+        a.pcm[i] = (int16_t)(s > 32767 ? 32767 : (s < -32768 ? -32768 : s));
+    }
+}
+
+void test_floor_follows_a_fan(void) {
+    // A fan comes on after the floor was learnt in a quiet room. It may
+    // look like speech at first, but within ~2s the floor has caught up
+    VoiceActivityDetector vad;
+    vad.begin(RATE, HANGOVER_MS);
+    LabelledAudio room = speechFixture(RATE, { { 1000, PART_QUIET, 0 } });
+    run(vad, room);
+    int16_t quietFloor = vad.noiseFloor();
+
+    LabelledAudio fan = speechFixture(RATE, { { 5000, PART_NOISE, 600 } }, 40, 9);
+    Events e = run(vad, fan);
+    for (uint32_t ms = 2500; ms < fan.ms(); ms += 10) TEST_ASSERT_FALSE(e.speaking[ms / 10]);
+    TEST_ASSERT_GREATER_THAN(quietFloor + 3 * 256, vad.noiseFloor());
+
+    // Speech over the same fan is still heard, once
+    LabelledAudio talk = speechFixture(RATE, { { 1160, PART_TALK, 8000 }, { 800, PART_QUIET, 0 } }, 40, 11);
+    addFan(talk, 600, 5);
+    Events t = run(vad, talk);
+    TEST_ASSERT_EQUAL(1, t.starts.size());
+    TEST_ASSERT_LESS_OR_EQUAL(talk.syllables[0].startMs + 60, t.starts[0]);
+    TEST_ASSERT_EQUAL(1, t.ends.size());
+}
+
+void test_reset_relearns(void) {
+    VoiceActivityDetector vad;
+    vad.begin(RATE, HANGOVER_MS);
+    LabelledAudio loud = speechFixture(RATE, { { 1000, PART_NOISE, 2000 } });
+    run(vad, loud);
+    int16_t high = vad.noiseFloor();
+    vad.reset();
+    LabelledAudio quiet = speechFixture(RATE, { { 400, PART_QUIET, 0 } });
+    run(vad, quiet);
+    TEST_ASSERT_LESS_THAN(high - 5 * 256, vad.noiseFloor());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_log2q8);
+    RUN_TEST(test_learned_floor_is_the_rounded_mean);
+    RUN_TEST(test_hiss_alone_is_never_speech);
+    RUN_TEST(test_onset_and_hangover);
+    RUN_TEST(test_two_utterances_two_turns);
+    RUN_TEST(test_floor_follows_a_fan);
+    RUN_TEST(test_reset_relearns);
+    return UNITY_END();
+}
@@ -0,0 +1,196 @@
+#include <unity.h>
+#include <string.h>
+#include <vector>
+
+#include "WavWriter.h"
+
+// A file in memory. `seekable` false is a socket; `limit` makes writes
+// come up short past that many bytes, like a full flash.
+struct MemorySink : public WavSink {
+    std::vector<uint8_t> bytes;
+    size_t pos = 0;
+    bool seekable = true;
+    size_t limit = (size_t)-1;
+
+    size_t write(const uint8_t* data, size_t length) override {
+        if (pos + length > limit) length = pos < limit ? limit - pos : 0;
+        if (pos + length > bytes.size()) bytes.resize(pos + length);
+        if (length > 0) memcpy(&bytes[pos], data, length);
+        pos += length;
+        return length;
+    }
+    bool seek(uint32_t position) override {
+        if (!seekable || position > bytes.size()) return false;
+        pos = position;
+        return true;
+    }
+};
+
+static uint16_t le16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static uint32_t le32(const uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+struct Parsed {
+    uint16_t format = 0, channels = 0, blockAlign = 0, bits = 0;
+    uint32_t rate = 0, byteRate = 0;
+    const uint8_t* data = NULL;
+    uint32_t dataBytes = 0;
+    int chunks = 0;
+};
+
+// Strict RIFF walk, written from the spec rather than from WavWriter: the
+// RIFF size covers the file exactly, every chunk fits, odd chunks are
+// followed by a pad byte, and "fmt " comes before "data"
+static bool parseWav(const std::vector<uint8_t>& f, Parsed& out) {
+    if (f.size() < 12 || memcmp(&f[0], "RIFF", 4) != 0 || memcmp(&f[8], "WAVE", 4) != 0) return false;
+    if (le32(&f[4]) != f.size() - 8) return false;
+    bool haveFmt = false;
+    size_t pos = 12;
+    while (pos < f.size()) {
+        if (f.size() - pos < 8) return false;
+        uint32_t size = le32(&f[pos + 4]);
+        size_t body = pos + 8;
+        if (size > f.size() - body) return false;
+        if (memcmp(&f[pos], "fmt ", 4) == 0) {
+            if (size < 16) return false;
+            out.format = le16(&f[body]);
+            out.channels = le16(&f[body + 2]);
+            out.rate = le32(&f[body + 4]);
+            out.byteRate = le32(&f[body + 8]);
+            out.blockAlign = le16(&f[body + 12]);
+            out.bits = le16(&f[body + 14]);
+            haveFmt = true;
+        } else if (memcmp(&f[pos], "data", 4) == 0) {
+            if (!haveFmt) return false;
+            out.data = &f[body];
+            out.dataBytes = size;
+        }
+        out.chunks++;
+        pos = body + size + (size & 1);
+        if ((size & 1) && pos > f.size()) return false;
+    }
+    return pos == f.size() && haveFmt && out.data != NULL;
+}
+
+struct Case {
+    uint32_t rate;
+    uint16_t channels;
+    uint16_t bits;
+    size_t bytes;
+    int writes;   // The recording arrives in this many pieces
+};
+
+static std::vector<uint8_t> pcmBytes(size_t n) {
+    std::vector<uint8_t> pcm(n);
+    for (size_t i = 0; i < n; i++) pcm[i] = (uint8_t)(i * 31 + 7);
+    return pcm;
+}
+
+static void record(WavWriter& w, const std::vector<uint8_t>& pcm, int writes) {
+    size_t off = 0;
+    for (int k = 0; k < writes; k++) {
+        size_t n = k == writes - 1 ? pcm.size() - off : pcm.size() / writes;
+        TEST_ASSERT_EQUAL(n, w.write(pcm.data() + off, n));
+        off += n;
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_recordings_parse_back(void) {
+    // Empty, one byte (padded), odd 16-bit, the recorder's formats, stereo,
+    // 8-bit, 24-bit with an odd length
+    const Case cases[] = {
+        { 8000, 1, 16, 0, 1 },        { 8000, 1, 16, 1, 1 },
+        { 16000, 1, 16, 32001, 7 },   { 24000, 1, 16, 48000, 3 },
+        { 44100, 2, 16, 176400, 5 },  { 22050, 1, 8, 12345, 2 },
+        { 48000, 2, 24, 144003, 4 } };
+    for (const Case& c : cases) {
+        MemorySink sink;
+        WavWriter w;
+        std::vector<uint8_t> pcm = pcmBytes(c.bytes);
+        TEST_ASSERT_TRUE(w.begin(&sink, c.rate, c.channels, c.bits));
+        record(w, pcm, c.writes);
+        TEST_ASSERT_TRUE(w.finish());
+        TEST_ASSERT_EQUAL(c.bytes, w.dataBytes());
+        TEST_ASSERT_EQUAL(WavWriter::HEADER_SIZE + c.bytes + (c.bytes & 1), sink.bytes.size());
+        TEST_ASSERT_EQUAL(sink.bytes.size(), sink.pos);   // Left at the end
+
+        Parsed p;
+        TEST_ASSERT_TRUE(parseWav(sink.bytes, p));
+        uint16_t align = c.channels * ((c.bits + 7) / 8);
+        TEST_ASSERT_EQUAL(2, p.chunks);
+        TEST_ASSERT_EQUAL(1, p.format);
+        TEST_ASSERT_EQUAL(c.channels, p.channels);
+        TEST_ASSERT_EQUAL_UINT32(c.rate, p.rate);
+        TEST_ASSERT_EQUAL_UINT32(c.rate * align, p.byteRate);
+        TEST_ASSERT_EQUAL(align, p.blockAlign);
+        TEST_ASSERT_EQUAL(c.bits, p.bits);
+        TEST_ASSERT_EQUAL_UINT32(c.bytes, p.dataBytes);
+        if (c.bytes > 0) TEST_ASSERT_EQUAL_MEMORY(pcm.data(), p.data, c.bytes);
+        if (c.bytes & 1) TEST_ASSERT_EQUAL_UINT8(0, sink.bytes.back());
+    }
+}
+
+void test_one_way_sink_keeps_unknown_sizes(void) {
+    MemorySink sink;
+    sink.seekable = false;
+    WavWriter w;
+    std::vector<uint8_t> pcm = pcmBytes(32000);
+    TEST_ASSERT_TRUE(w.begin(&sink, 16000));
+    record(w, pcm, 3);
+    TEST_ASSERT_FALSE(w.finish());
+    TEST_ASSERT_EQUAL_UINT32(WavWriter::UNKNOWN_SIZE, le32(&sink.bytes[4]));
+    TEST_ASSERT_EQUAL_UINT32(WavWriter::UNKNOWN_SIZE, le32(&sink.bytes[40]));
+    TEST_ASSERT_EQUAL(WavWriter::HEADER_SIZE + pcm.size(), sink.bytes.size());
+    TEST_ASSERT_EQUAL_MEMORY(pcm.data(), &sink.bytes[WavWriter::HEADER_SIZE], pcm.size());
+}
+
+void test_header_matches_what_finish_writes(void) {
+    // What the HTTP upload sends up front is what a patched file starts with
+    MemorySink sink;
+    WavWriter w;
+    std::vector<uint8_t> pcm = pcmBytes(3201);
+    w.begin(&sink, 16000);
+    record(w, pcm, 1);
+    w.finish();
+    uint8_t h[WavWriter::HEADER_SIZE];
+    WavWriter::header(h, 16000, 1, 16, (uint32_t)pcm.size());
+    TEST_ASSERT_EQUAL_MEMORY(h, sink.bytes.data(), WavWriter::HEADER_SIZE);
+    // RIFF size sits in bytes 4..7 and counts the pad
+    TEST_ASSERT_EQUAL_UINT32(36 + 3202, le32(h + 4));
+}
+
+void test_full_sink(void) {
+    // Not even the header fits
+    MemorySink tiny;
+    tiny.limit = 20;
+    WavWriter a;
+    TEST_ASSERT_FALSE(a.begin(&tiny, 16000));
+    TEST_ASSERT_EQUAL(0, a.write("ab", 2));
+    TEST_ASSERT_FALSE(a.finish());
+
+    // Fills up mid-recording: what got there is counted, nothing after,
+    // and the sizes are left as "until the end"
+    MemorySink full;
+    full.limit = WavWriter::HEADER_SIZE + 100;
+    WavWriter b;
+    std::vector<uint8_t> pcm = pcmBytes(300);
+    TEST_ASSERT_TRUE(b.begin(&full, 16000));
+    TEST_ASSERT_EQUAL(100, b.write(pcm.data(), 150));
+    TEST_ASSERT_EQUAL(0, b.write(pcm.data(), 150));
+    TEST_ASSERT_EQUAL_UINT32(100, b.dataBytes());
+    TEST_ASSERT_FALSE(b.finish());
+    TEST_ASSERT_EQUAL_UINT32(WavWriter::UNKNOWN_SIZE, le32(&full.bytes[40]));
+
+    TEST_ASSERT_FALSE(WavWriter().finish());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_recordings_parse_back);
+    RUN_TEST(test_one_way_sink_keeps_unknown_sizes);
+    RUN_TEST(test_header_matches_what_finish_writes);
+    RUN_TEST(test_full_sink);
+    return UNITY_END();
+}
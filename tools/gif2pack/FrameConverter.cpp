@@ -0,0 +1,125 @@
+#include "FrameConverter.h"
+
+#include <math.h>
+
+FrameConverter::FrameConverter(int srcWidth, int srcHeight, const ConvertOptions& options)
+    : _srcWidth(srcWidth), _srcHeight(srcHeight), _options(options) {
+    int dstW = options.width;
+    int dstH = options.height;
+    int offX = 0, offY = 0;
+
+    if (options.keepAspect) {
+        // Fit inside the target, centred, background around it
+        if ((long)srcWidth * dstH > (long)srcHeight * dstW) {
+            dstH = (int)((long)srcHeight * options.width / srcWidth);
+            offY = (options.height - dstH) / 2;
+        } else {
+            dstW = (int)((long)srcWidth * options.height / srcHeight);
+            offX = (options.width - dstW) / 2;
+        }
+        if (dstW < 1) dstW = 1;
+        if (dstH < 1) dstH = 1;
+    }
+
+    _xTaps.assign(options.width, std::vector<Tap>());
+    _yTaps.assign(options.height, std::vector<Tap>());
+    buildTaps(srcWidth, options.width, offX, dstW, _xTaps);
+    buildTaps(srcHeight, options.height, offY, dstH, _yTaps);
+}
+
+void FrameConverter::buildTaps(int srcSize, int dstSize, int dstOffset, int dstExtent,
+                               std::vector<std::vector<Tap>>& taps) {
+    double scale = (double)srcSize / dstExtent;
+    for (int d = 0; d < dstSize; d++) {
+        int rel = d - dstOffset;
+        if (rel < 0 || rel >= dstExtent) continue;
+
+        // Box filter: every source pixel overlapping [start, end) contributes
+        // by the length of the overlap. Upscaling degenerates to one tap.
+        double start = rel * scale;
+        double end = (rel + 1) * scale;
+        double total = end - start;
+        for (int s = (int)floor(start); s < (int)ceil(end) && s < srcSize; s++) {
+            double lo = s > start ? s : start;
+            double hi = s + 1 < end ? s + 1 : end;
+            if (hi > lo) {
+                Tap tap = { s, (float)((hi - lo) / total) };
+                taps[d].push_back(tap);
+            }
+        }
+    }
+}
+
+std::vector<uint8_t> FrameConverter::convert(const GifFrame& frame) {
+    const int w = _options.width;
+    const int h = _options.height;
+    const float bg = _options.background;
+
+    // Horizontal pass over every source row, then vertical pass
+    std::vector<float> rows((size_t)_srcHeight * w);
+    _rowLuma.resize(_srcWidth);
+    for (int y = 0; y < _srcHeight; y++) {
+        const uint8_t* luma = &frame.luma[(size_t)y * _srcWidth];
+        const uint8_t* alpha = &frame.alpha[(size_t)y * _srcWidth];
+        for (int x = 0; x < _srcWidth; x++) {
+            _rowLuma[x] = alpha[x] ? luma[x] : bg;
+        }
+        float* out = &rows[(size_t)y * w];
+        for (int x = 0; x < w; x++) {
+            if (_xTaps[x].empty()) {
+                out[x] = bg;
+                continue;
+            }
+            float sum = 0;
+            for (const Tap& t : _xTaps[x]) sum += _rowLuma[t.index] * t.weight;
+            out[x] = sum;
+        }
+    }
+
+    _image.assign((size_t)w * h, bg);
+    for (int y = 0; y < h; y++) {
+        if (_yTaps[y].empty()) continue;
+        float* out = &_image[(size_t)y * w];
+        for (int x = 0; x < w; x++) out[x] = 0;
+        for (const Tap& t : _yTaps[y]) {
+            const float* src = &rows[(size_t)t.index * w];
+            for (int x = 0; x < w; x++) out[x] += src[x] * t.weight;
+        }
+    }
+
+    std::vector<uint8_t> bits((size_t)w * h / 8, 0);
+    const float threshold = (float)_options.threshold;
+
+    for (int y = 0; y < h; y++) {
+        // Serpentine scan keeps Floyd-Steinberg from streaking sideways
+        bool reverse = _options.dither && (y & 1);
+        for (int i = 0; i < w; i++) {
+            int x = reverse ? w - 1 - i : i;
+            float v = _image[(size_t)y * w + x];
+            bool lit = v >= threshold;
+
+            if (_options.dither) {
+                float err = v - (lit ? 255.0f : 0.0f);
+                int dir = reverse ? -1 : 1;
+                if (x + dir >= 0 && x + dir < w) {
+                    _image[(size_t)y * w + x + dir] += err * 7 / 16;
+                }
+                if (y + 1 < h) {
+                    float* below = &_image[(size_t)(y + 1) * w];
+                    if (x - dir >= 0 && x - dir < w) below[x - dir] += err * 3 / 16;
+                    below[x] += err * 5 / 16;
+                    if (x + dir >= 0 && x + dir < w) below[x + dir] += err * 1 / 16;
+                }
+            }
+
+            if (lit != _options.invert) {
+                if (_options.pageLayout) {
+                    bits[(size_t)(y / 8) * w + x] |= 1 << (y & 7);
+                } else {
+                    bits[(size_t)y * (w / 8) + x / 8] |= 0x80 >> (x & 7);
+                }
+            }
+        }
+    }
+    return bits;
+}
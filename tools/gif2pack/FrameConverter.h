@@ -0,0 +1,51 @@
+#ifndef FRAME_CONVERTER_H
+#define FRAME_CONVERTER_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "GifDecoder.h"
+
+// Turns a composited GIF canvas into a 1-bit OLED frame: area-averaged
+// resize, transparency flattened onto a background, then threshold or
+// Floyd-Steinberg dithering. Output is SSD1306 page layout by default, so
+// frames decode straight into the display buffer; `pageLayout = false` gives
+// the image2cpp row layout that drawBitmap() expects.
+
+struct ConvertOptions {
+    int width = 128;
+    int height = 64;
+    bool dither = true;
+    int threshold = 128;       // Luma at or above this is a lit pixel
+    bool invert = false;
+    uint8_t background = 255;  // Luma used for transparent pixels
+    bool keepAspect = false;   // Letterbox instead of stretching
+    bool pageLayout = true;    // SSD1306 pages instead of image2cpp rows
+};
+
+class FrameConverter {
+public:
+    FrameConverter(int srcWidth, int srcHeight, const ConvertOptions& options);
+
+    // Returns width * height / 8 bytes
+    std::vector<uint8_t> convert(const GifFrame& frame);
+
+private:
+    struct Tap {
+        int index;
+        float weight;
+    };
+
+    void buildTaps(int srcSize, int dstSize, int dstOffset, int dstExtent,
+                   std::vector<std::vector<Tap>>& taps);
+
+    int _srcWidth;
+    int _srcHeight;
+    ConvertOptions _options;
+    std::vector<std::vector<Tap>> _xTaps;  // Per destination column
+    std::vector<std::vector<Tap>> _yTaps;  // Per destination row
+    std::vector<float> _rowLuma;           // Scratch: one source row, background applied
+    std::vector<float> _image;             // Scratch: resized luma
+};
+
+#endif
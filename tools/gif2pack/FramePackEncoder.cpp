@@ -0,0 +1,135 @@
+#include "FramePackEncoder.h"
+
+#include <ctype.h>
+
+#include "FramePack.h"
+
+FramePackEncoder::FramePackEncoder(size_t frameBytes) {
+    _frameBytes = frameBytes;
+    _merged = 0;
+}
+
+void FramePackEncoder::rle(const uint8_t* src, size_t length, std::vector<uint8_t>& out) {
+    size_t i = 0;
+    size_t litStart = 0;
+
+    auto flushLiterals = [&](size_t upTo) {
+        while (litStart < upTo) {
+            size_t n = upTo - litStart;
+            if (n > 128) n = 128;
+            out.push_back((uint8_t)(n - 1));
+            out.insert(out.end(), src + litStart, src + litStart + n);
+            litStart += n;
+        }
+    };
+
+    while (i < length) {
+        size_t j = i;
+        while (j < length && src[j] == src[i] && j - i < 130) j++;
+        if (j - i >= 3) {
+            flushLiterals(i);
+            out.push_back((uint8_t)(0x80 + (j - i) - 3));
+            out.push_back(src[i]);
+            i = j;
+            litStart = i;
+        } else {
+            i++;
+        }
+    }
+    flushLiterals(length);
+}
+
+void FramePackEncoder::addFrame(const std::vector<uint8_t>& frame, uint32_t durationMs) {
+    // Same picture as the last frame: just hold it longer
+    if (!_frames.empty() && frame == _frames.back()) {
+        uint32_t total = _durations.back() + durationMs;
+        if (total <= 0xFFFF) {
+            _durations.back() = (uint16_t)total;
+            _merged++;
+            return;
+        }
+    }
+
+    while (durationMs > 0xFFFF) {
+        appendFrame(frame, 0xFFFF);
+        durationMs -= 0xFFFF;
+    }
+    appendFrame(frame, (uint16_t)durationMs);
+}
+
+void FramePackEncoder::appendFrame(const std::vector<uint8_t>& frame, uint16_t durationMs) {
+    std::vector<uint8_t> key;
+    key.push_back(FRAME_KEY);
+    rle(frame.data(), frame.size(), key);
+
+    std::vector<uint8_t> best = key;
+
+    if (!_frames.empty()) {
+        const std::vector<uint8_t>& prev = _frames.back();
+        std::vector<uint8_t> x(frame.size());
+        for (size_t i = 0; i < frame.size(); i++) x[i] = frame[i] ^ prev[i];
+
+        std::vector<uint8_t> delta;
+        delta.push_back(FRAME_DELTA);
+        rle(x.data(), x.size(), delta);
+
+        // A blob that is already stored costs nothing
+        std::string keyStr(key.begin(), key.end());
+        std::string deltaStr(delta.begin(), delta.end());
+        size_t keyCost = _blobs.count(keyStr) ? 0 : key.size();
+        size_t deltaCost = _blobs.count(deltaStr) ? 0 : delta.size();
+        if (deltaCost < keyCost) best = delta;
+    }
+
+    std::string blob(best.begin(), best.end());
+    auto it = _blobs.find(blob);
+    if (it != _blobs.end()) {
+        _offsets.push_back(it->second);
+    } else {
+        uint32_t offset = (uint32_t)_data.size();
+        _data.insert(_data.end(), best.begin(), best.end());
+        _blobs[blob] = offset;
+        _offsets.push_back(offset);
+    }
+    _durations.push_back(durationMs);
+    _frames.push_back(frame);
+}
+
+void FramePackEncoder::writeHeader(FILE* out, const std::string& name, int width, int height,
+                                   bool pageLayout, const std::string& source) const {
+    std::string guard;
+    for (char c : name) guard += (char)toupper((unsigned char)c);
+    guard += "_PACK_H";
+
+    fprintf(out, "// Generated by gif2pack from %s. Do not edit.\n", source.c_str());
+    fprintf(out, "// %zu frames (%zu merged), %zu bytes packed (%zu raw). Format: see src/FramePack.h\n",
+            frameCount(), _merged, _data.size(), rawBytes());
+    fprintf(out, "\n#ifndef %s\n#define %s\n\n", guard.c_str(), guard.c_str());
+    fprintf(out, "#include <Arduino.h>\n#include \"FramePack.h\"\n\n");
+
+    fprintf(out, "const uint8_t PROGMEM %s_data[] = {\n", name.c_str());
+    for (size_t i = 0; i < _data.size(); i++) {
+        fprintf(out, "0x%02x%s", _data[i], i + 1 < _data.size() ? ", " : "");
+        if (i % 16 == 15 || i + 1 == _data.size()) fprintf(out, "\n");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "const uint32_t PROGMEM %s_offsets[] = {\n", name.c_str());
+    for (size_t i = 0; i < _offsets.size(); i++) {
+        fprintf(out, "%u%s", _offsets[i], i + 1 < _offsets.size() ? ", " : "");
+        if (i % 12 == 11 || i + 1 == _offsets.size()) fprintf(out, "\n");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "const uint16_t PROGMEM %s_durations[] = {\n", name.c_str());
+    for (size_t i = 0; i < _durations.size(); i++) {
+        fprintf(out, "%u%s", _durations[i], i + 1 < _durations.size() ? ", " : "");
+        if (i % 12 == 11 || i + 1 == _durations.size()) fprintf(out, "\n");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "const FramePack %s = { %d, %d, %zu, %s_offsets, %s_data, %s_durations, %s };\n",
+            name.c_str(), width, height, frameCount(), name.c_str(), name.c_str(), name.c_str(),
+            pageLayout ? "FRAME_LAYOUT_PAGES" : "FRAME_LAYOUT_ROWS");
+    fprintf(out, "\n#endif\n");
+}
@@ -0,0 +1,52 @@
+#ifndef FRAME_PACK_ENCODER_H
+#define FRAME_PACK_ENCODER_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Host-side writer for the format decoded by FramePackDecoder
+// (src/FramePack.h).
+//
+// Consecutive identical frames are merged into one frame whose duration is
+// the sum. Every other frame is stored as whichever of its key or XOR-delta
+// blob is cheaper, and byte-identical blobs are stored once and shared, so
+// repeated poses and looping segments cost nothing after the first time.
+
+class FramePackEncoder {
+public:
+    explicit FramePackEncoder(size_t frameBytes);
+
+    void addFrame(const std::vector<uint8_t>& frame, uint32_t durationMs);
+
+    size_t frameCount() const { return _offsets.size(); }
+    size_t mergedFrames() const { return _merged; }
+    size_t rawBytes() const { return _offsets.size() * _frameBytes; }
+    const std::vector<uint8_t>& data() const { return _data; }
+    const std::vector<uint32_t>& offsets() const { return _offsets; }
+    const std::vector<uint16_t>& durations() const { return _durations; }
+
+    // The decoded frames, for verifying the pack after decoding
+    const std::vector<std::vector<uint8_t>>& frames() const { return _frames; }
+
+    // Emit a self-contained header defining `<name>` as a FramePack
+    void writeHeader(FILE* out, const std::string& name, int width, int height,
+                     bool pageLayout, const std::string& source) const;
+
+    static void rle(const uint8_t* src, size_t length, std::vector<uint8_t>& out);
+
+private:
+    void appendFrame(const std::vector<uint8_t>& frame, uint16_t durationMs);
+
+    size_t _frameBytes;
+    size_t _merged;
+    std::vector<uint8_t> _data;
+    std::vector<uint32_t> _offsets;
+    std::vector<uint16_t> _durations;
+    std::vector<std::vector<uint8_t>> _frames;
+    std::unordered_map<std::string, uint32_t> _blobs;  // Blob bytes -> offset
+};
+
+#endif
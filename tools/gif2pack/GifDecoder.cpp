@@ -0,0 +1,311 @@
+#include "GifDecoder.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static uint16_t readU16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+// Skip a chain of data sub-blocks (size byte + payload, terminated by 0)
+static bool skipSubBlocks(const uint8_t*& p, const uint8_t* end) {
+    while (p < end) {
+        uint8_t size = *p++;
+        if (size == 0) return true;
+        if (end - p < size) return false;
+        p += size;
+    }
+    return false;
+}
+
+bool GifDecoder::fail(const char* message) {
+    _error = message;
+    return false;
+}
+
+bool GifDecoder::decodeFile(const std::string& path) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (f == NULL) return fail("cannot open file");
+
+    std::vector<uint8_t> data;
+    uint8_t chunk[64 * 1024];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+        data.insert(data.end(), chunk, chunk + n);
+    }
+    fclose(f);
+    return decode(data.data(), data.size());
+}
+
+bool GifDecoder::decode(const uint8_t* data, size_t length) {
+    _frames.clear();
+    _error.clear();
+
+    const uint8_t* p = data;
+    const uint8_t* end = data + length;
+
+    if (length < 13 || (memcmp(p, "GIF87a", 6) != 0 && memcmp(p, "GIF89a", 6) != 0)) {
+        return fail("not a GIF file");
+    }
+    p += 6;
+
+    _width = readU16(p);
+    _height = readU16(p + 2);
+    uint8_t packed = p[4];
+    uint8_t bgIndex = p[5];
+    p += 7;
+    if (_width == 0 || _height == 0) return fail("empty logical screen");
+
+    const uint8_t* gct = NULL;
+    int gctSize = 0;
+    if (packed & 0x80) {
+        gctSize = 1 << ((packed & 0x07) + 1);
+        if (end - p < gctSize * 3) return fail("truncated global palette");
+        gct = p;
+        p += gctSize * 3;
+    }
+    (void)bgIndex; // Browsers treat the background as transparent, so do we
+
+    size_t pixels = (size_t)_width * _height;
+    _canvasLuma.assign(pixels, 255);
+    _canvasAlpha.assign(pixels, 0);
+    _prevDisposal = 0;
+    _prevRect[0] = _prevRect[1] = _prevRect[2] = _prevRect[3] = 0;
+
+    int disposal = 0;
+    int transparent = -1;
+    uint32_t delayMs = 0;
+
+    while (p < end) {
+        uint8_t block = *p++;
+
+        if (block == 0x3B) {
+            break; // Trailer
+        } else if (block == 0x21) {
+            if (p >= end) return fail("truncated extension");
+            uint8_t label = *p++;
+            if (label == 0xF9) {
+                // Graphic Control Extension: applies to the next image only
+                if (end - p < 6 || p[0] != 4) return fail("bad graphic control block");
+                uint8_t flags = p[1];
+                disposal = (flags >> 2) & 0x07;
+                transparent = (flags & 0x01) ? p[4] : -1;
+                uint16_t cs = readU16(p + 2);
+                // Same clamp as browsers: 0 or 10ms means "as fast as allowed"
+                delayMs = (cs <= 1) ? 100 : (uint32_t)cs * 10;
+                p += 5;
+                if (!skipSubBlocks(p, end)) return fail("truncated extension");
+            } else {
+                if (!skipSubBlocks(p, end)) return fail("truncated extension");
+            }
+        } else if (block == 0x2C) {
+            if (!readImage(p, end, gct, gctSize, disposal, transparent, delayMs ? delayMs : 100)) {
+                return false;
+            }
+            disposal = 0;
+            transparent = -1;
+            delayMs = 0;
+        } else {
+            return fail("unknown block");
+        }
+    }
+
+    if (_frames.empty()) return fail("no frames");
+    return true;
+}
+
+bool GifDecoder::readImage(const uint8_t*& p, const uint8_t* end,
+                           const uint8_t* gct, int gctSize,
+                           int disposal, int transparent, uint32_t delayMs) {
+    if (end - p < 9) return fail("truncated image descriptor");
+    int left = readU16(p);
+    int top = readU16(p + 2);
+    int w = readU16(p + 4);
+    int h = readU16(p + 6);
+    uint8_t packed = p[8];
+    p += 9;
+
+    const uint8_t* palette = gct;
+    int paletteSize = gctSize;
+    if (packed & 0x80) {
+        paletteSize = 1 << ((packed & 0x07) + 1);
+        if (end - p < paletteSize * 3) return fail("truncated local palette");
+        palette = p;
+        p += paletteSize * 3;
+    }
+    if (palette == NULL) return fail("image without palette");
+    bool interlaced = (packed & 0x40) != 0;
+
+    if (p >= end) return fail("truncated image data");
+    int minCodeSize = *p++;
+    if (minCodeSize < 2 || minCodeSize > 8) return fail("bad LZW code size");
+
+    std::vector<uint8_t> indices;
+    if (!lzwDecode(p, end, minCodeSize, indices, (size_t)w * h)) return false;
+
+    // Apply the previous frame's disposal before drawing this one
+    if (_prevDisposal == 2) {
+        for (int y = _prevRect[1]; y < _prevRect[1] + _prevRect[3] && y < _height; y++) {
+            for (int x = _prevRect[0]; x < _prevRect[0] + _prevRect[2] && x < _width; x++) {
+                _canvasLuma[(size_t)y * _width + x] = 255;
+                _canvasAlpha[(size_t)y * _width + x] = 0;
+            }
+        }
+    } else if (_prevDisposal == 3 && !_savedLuma.empty()) {
+        _canvasLuma = _savedLuma;
+        _canvasAlpha = _savedAlpha;
+    }
+
+    if (disposal == 3) {
+        _savedLuma = _canvasLuma;
+        _savedAlpha = _canvasAlpha;
+    }
+
+    // Palette index -> luminance (ITU-R BT.601 weights)
+    uint8_t lumaOf[256];
+    for (int i = 0; i < 256; i++) {
+        if (i < paletteSize) {
+            const uint8_t* c = palette + i * 3;
+            lumaOf[i] = (uint8_t)((c[0] * 299 + c[1] * 587 + c[2] * 114 + 500) / 1000);
+        } else {
+            lumaOf[i] = 0;
+        }
+    }
+
+    // Interlaced images store rows in four passes
+    static const int passStart[4] = { 0, 4, 2, 1 };
+    static const int passStep[4]  = { 8, 8, 4, 2 };
+    int pass = 0;
+    int row = 0;
+
+    for (int i = 0; i < h; i++) {
+        int y;
+        if (interlaced) {
+            while (row >= h && pass < 3) {
+                pass++;
+                row = passStart[pass];
+            }
+            y = row;
+            row += passStep[pass];
+        } else {
+            y = i;
+        }
+
+        int cy = top + y;
+        if (cy < 0 || cy >= _height) continue;
+        const uint8_t* src = &indices[(size_t)i * w];
+        for (int x = 0; x < w; x++) {
+            int cx = left + x;
+            if (cx < 0 || cx >= _width) continue;
+            uint8_t idx = src[x];
+            if (idx == transparent) continue;
+            _canvasLuma[(size_t)cy * _width + cx] = lumaOf[idx];
+            _canvasAlpha[(size_t)cy * _width + cx] = 255;
+        }
+    }
+
+    GifFrame frame;
+    frame.luma = _canvasLuma;
+    frame.alpha = _canvasAlpha;
+    frame.delayMs = delayMs;
+    _frames.push_back(frame);
+
+    _prevDisposal = disposal;
+    _prevRect[0] = left;
+    _prevRect[1] = top;
+    _prevRect[2] = w;
+    _prevRect[3] = h;
+    return true;
+}
+
+bool GifDecoder::lzwDecode(const uint8_t*& p, const uint8_t* end, int minCodeSize,
+                           std::vector<uint8_t>& out, size_t expected) {
+    const int clearCode = 1 << minCodeSize;
+    const int endCode = clearCode + 1;
+
+    uint16_t prefix[4096];
+    uint8_t suffix[4096];
+    uint8_t stack[4097];
+
+    for (int i = 0; i < clearCode; i++) {
+        prefix[i] = 0xFFFF;
+        suffix[i] = (uint8_t)i;
+    }
+
+    int codeSize = minCodeSize + 1;
+    int nextCode = endCode + 1;
+    int prevCode = -1;
+    uint8_t firstChar = 0;
+
+    uint32_t bits = 0;
+    int bitCount = 0;
+    bool done = false;
+
+    out.clear();
+    out.reserve(expected);
+
+    while (p < end) {
+        uint8_t size = *p++;
+        if (size == 0) break;
+        if (end - p < size) return fail("truncated LZW data");
+        const uint8_t* blockEnd = p + size;
+
+        while (p < blockEnd) {
+            bits |= (uint32_t)(*p++) << bitCount;
+            bitCount += 8;
+
+            while (!done && bitCount >= codeSize) {
+                int code = bits & ((1 << codeSize) - 1);
+                bits >>= codeSize;
+                bitCount -= codeSize;
+
+                if (code == clearCode) {
+                    codeSize = minCodeSize + 1;
+                    nextCode = endCode + 1;
+                    prevCode = -1;
+                    continue;
+                }
+                if (code == endCode) {
+                    done = true;
+                    break;
+                }
+
+                if (prevCode < 0) {
+                    if (code >= clearCode) return fail("bad first LZW code");
+                    out.push_back((uint8_t)code);
+                    firstChar = (uint8_t)code;
+                    prevCode = code;
+                    continue;
+                }
+
+                int top = 0;
+                int cur = code;
+                if (code >= nextCode) {
+                    // KwKwK: the code being defined right now
+                    if (code > nextCode) return fail("bad LZW code");
+                    stack[top++] = firstChar;
+                    cur = prevCode;
+                }
+                while (cur >= clearCode) {
+                    stack[top++] = suffix[cur];
+                    cur = prefix[cur];
+                }
+                stack[top++] = (uint8_t)cur;
+                firstChar = (uint8_t)cur;
+                while (top > 0) out.push_back(stack[--top]);
+
+                if (nextCode < 4096) {
+                    prefix[nextCode] = (uint16_t)prevCode;
+                    suffix[nextCode] = firstChar;
+                    nextCode++;
+                    if (nextCode == (1 << codeSize) && codeSize < 12) codeSize++;
+                }
+                prevCode = code;
+            }
+        }
+    }
+
+    // Some encoders omit the end code or stop short; pad with index 0
+    out.resize(expected, 0);
+    return true;
+}
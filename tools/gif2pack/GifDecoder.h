@@ -0,0 +1,52 @@
+#ifndef GIF_DECODER_H
+#define GIF_DECODER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+// Minimal GIF87a/GIF89a decoder for the frame pack compiler.
+//
+// Every frame is composited onto the logical screen (disposal, transparency,
+// interlacing and local palettes are honoured), so callers get full canvases
+// exactly as a browser would show them, plus each frame's own delay.
+
+struct GifFrame {
+    std::vector<uint8_t> luma;   // width * height, 0 = black, 255 = white
+    std::vector<uint8_t> alpha;  // width * height, 0 = transparent, 255 = opaque
+    uint32_t delayMs;            // May exceed 65535; the encoder splits long holds
+};
+
+class GifDecoder {
+public:
+    // Returns false and fills error() on malformed input.
+    bool decode(const uint8_t* data, size_t length);
+    bool decodeFile(const std::string& path);
+
+    int width() const { return _width; }
+    int height() const { return _height; }
+    const std::vector<GifFrame>& frames() const { return _frames; }
+    const std::string& error() const { return _error; }
+
+private:
+    bool fail(const char* message);
+    bool readImage(const uint8_t*& p, const uint8_t* end,
+                   const uint8_t* gct, int gctSize,
+                   int disposal, int transparent, uint32_t delayMs);
+    bool lzwDecode(const uint8_t*& p, const uint8_t* end, int minCodeSize,
+                   std::vector<uint8_t>& out, size_t expected);
+
+    int _width = 0;
+    int _height = 0;
+    std::vector<GifFrame> _frames;
+    std::vector<uint8_t> _canvasLuma;
+    std::vector<uint8_t> _canvasAlpha;
+    std::vector<uint8_t> _savedLuma;   // Canvas before a "restore to previous" frame
+    std::vector<uint8_t> _savedAlpha;
+    int _prevDisposal = 0;
+    int _prevRect[4] = { 0, 0, 0, 0 }; // x, y, w, h of the last drawn image
+    std::string _error;
+};
+
+#endif
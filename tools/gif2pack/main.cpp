@@ -0,0 +1,192 @@
+// gif2pack: GIF -> FramePack header compiler
+//
+// Replaces the ezgif split / resize / image2cpp round trip. Each input GIF is
+// decoded, resized and dithered to the OLED size, compressed into a FramePack
+// (src/FramePack.h) that keeps every frame's own GIF delay, verified by
+// decoding it back with the firmware decoder, and written as <name>.h.
+//
+// Build (from the repo root):
+//   g++ -O2 -std=c++17 -Isrc -Itools/gif2pack tools/gif2pack/*.cpp src/FramePack.cpp -o gif2pack
+//
+// Usage:
+//   gif2pack [options] input.gif [more.gif ...]
+//     -o DIR          output directory (default: current directory)
+//     -n NAME         symbol name (single input only; default: file name)
+//     -s WxH          frame size (default: 128x64)
+//     --no-dither     plain threshold, like image2cpp
+//     --threshold N   luma threshold 0..255 (default: 128)
+//     --invert        light pixels become unlit
+//     --black-bg      transparent pixels are black (default: white)
+//     --fit           keep aspect ratio and letterbox (default: stretch)
+//     --rows          image2cpp row layout for drawBitmap() (default: SSD1306 pages)
+//     --delay MS      override every frame's delay
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "FramePack.h"
+#include "FramePackEncoder.h"
+#include "FrameConverter.h"
+#include "GifDecoder.h"
+
+static void usage() {
+    fprintf(stderr,
+            "usage: gif2pack [-o DIR] [-n NAME] [-s WxH] [--no-dither] [--threshold N]\n"
+            "                [--invert] [--black-bg] [--fit] [--rows] [--delay MS] input.gif...\n");
+}
+
+// Whole decimal number in [min, max]; atoi() would take "300" or "12ms"
+static bool parseInt(const char* text, long min, long max, int& out) {
+    char* end;
+    errno = 0;
+    long value = strtol(text, &end, 10);
+    if (end == text || *end != '\0' || errno != 0 || value < min || value > max) return false;
+    out = (int)value;
+    return true;
+}
+
+// "cat-wave (1).gif" -> "cat_wave_1"
+static std::string symbolFor(const std::string& path) {
+    size_t slash = path.find_last_of("/\\");
+    std::string base = slash == std::string::npos ? path : path.substr(slash + 1);
+    size_t dot = base.find_last_of('.');
+    if (dot != std::string::npos) base = base.substr(0, dot);
+
+    std::string name;
+    for (char c : base) {
+        bool ok = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+        if (ok) {
+            name += c;
+        } else if (!name.empty() && name.back() != '_') {
+            name += '_';
+        }
+    }
+    while (!name.empty() && name.back() == '_') name.pop_back();
+    if (name.empty() || (name[0] >= '0' && name[0] <= '9')) name = "clip_" + name;
+    return name;
+}
+
+// Decode the pack with the firmware decoder and compare every frame
+static bool verify(const FramePackEncoder& enc, const ConvertOptions& options) {
+    FramePack pack = { (uint16_t)options.width, (uint16_t)options.height, (uint16_t)enc.frameCount(),
+                       enc.offsets().data(), enc.data().data(), enc.durations().data(),
+                       options.pageLayout ? FRAME_LAYOUT_PAGES : FRAME_LAYOUT_ROWS };
+    std::vector<uint8_t> buffer(FramePackDecoder::frameBytes(pack));
+    FramePackDecoder decoder;
+    decoder.begin(&pack, buffer.data());
+
+    for (size_t i = 0; i < enc.frameCount(); i++) {
+        if (!decoder.next() || buffer != enc.frames()[i]) return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    ConvertOptions options;
+    std::string outDir = ".";
+    std::string forcedName;
+    int forcedDelay = -1;
+    std::vector<std::string> inputs;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "-o" && hasValue) {
+            outDir = argv[++i];
+        } else if (arg == "-n" && hasValue) {
+            forcedName = argv[++i];
+        } else if (arg == "-s" && hasValue) {
+            if (sscanf(argv[++i], "%dx%d", &options.width, &options.height) != 2 ||
+                options.width <= 0 || options.height <= 0 ||
+                options.width % 8 != 0 || options.height % 8 != 0) {
+                fprintf(stderr, "gif2pack: size must be WxH, both multiples of 8\n");
+                return 2;
+            }
+        } else if (arg == "--no-dither") {
+            options.dither = false;
+        } else if (arg == "--threshold" && hasValue) {
+            if (!parseInt(argv[++i], 0, 255, options.threshold)) {
+                fprintf(stderr, "gif2pack: threshold must be 0..255\n");
+                return 2;
+            }
+        } else if (arg == "--invert") {
+            options.invert = true;
+        } else if (arg == "--black-bg") {
+            options.background = 0;
+        } else if (arg == "--fit") {
+            options.keepAspect = true;
+        } else if (arg == "--rows") {
+            options.pageLayout = false;
+        } else if (arg == "--delay" && hasValue) {
+            // Longer than 65535ms is fine: the encoder splits the hold
+            if (!parseInt(argv[++i], 0, 3600000, forcedDelay)) {
+                fprintf(stderr, "gif2pack: delay must be 0..3600000 ms\n");
+                return 2;
+            }
+        } else if (!arg.empty() && arg[0] == '-') {
+            usage();
+            return 2;
+        } else {
+            inputs.push_back(arg);
+        }
+    }
+
+    if (inputs.empty() || (!forcedName.empty() && inputs.size() > 1)) {
+        usage();
+        return 2;
+    }
+
+    auto started = std::chrono::steady_clock::now();
+    int failures = 0;
+    size_t totalRaw = 0, totalPacked = 0;
+
+    for (const std::string& input : inputs) {
+        GifDecoder gif;
+        if (!gif.decodeFile(input)) {
+            fprintf(stderr, "gif2pack: %s: %s\n", input.c_str(), gif.error().c_str());
+            failures++;
+            continue;
+        }
+
+        FrameConverter converter(gif.width(), gif.height(), options);
+        FramePackEncoder encoder((size_t)options.width * options.height / 8);
+        for (const GifFrame& frame : gif.frames()) {
+            uint32_t delay = forcedDelay >= 0 ? (uint32_t)forcedDelay : frame.delayMs;
+            encoder.addFrame(converter.convert(frame), delay);
+        }
+
+        if (!verify(encoder, options)) {
+            fprintf(stderr, "gif2pack: %s: pack failed round-trip check\n", input.c_str());
+            failures++;
+            continue;
+        }
+
+        std::string name = forcedName.empty() ? symbolFor(input) : forcedName;
+        std::string path = outDir + "/" + name + ".h";
+        FILE* out = fopen(path.c_str(), "w");
+        if (out == NULL) {
+            fprintf(stderr, "gif2pack: cannot write %s\n", path.c_str());
+            failures++;
+            continue;
+        }
+        encoder.writeHeader(out, name, options.width, options.height, options.pageLayout, input);
+        fclose(out);
+
+        totalRaw += encoder.rawBytes();
+        totalPacked += encoder.data().size();
+        printf("%s -> %s: %zu frames (%zu merged), %zu -> %zu bytes\n",
+               input.c_str(), path.c_str(), encoder.frameCount(), encoder.mergedFrames(),
+               encoder.rawBytes(), encoder.data().size());
+    }
+
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    printf("%zu clip(s), %zu -> %zu bytes, %.2fs\n",
+           inputs.size() - failures, totalRaw, totalPacked, secs);
+    return failures ? 1 : 0;
+}